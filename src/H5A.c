@@ -33,6 +33,8 @@
 #include "H5Sprivate.h"  /* Dataspace functions                      */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -1087,6 +1089,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aread_async() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_batch
+ PURPOSE
+    Read several attributes of an object in one call
+ USAGE
+    herr_t H5Aread_batch (obj_id, nnames, names, nattrs, attrs, arena_size, arena)
+        hid_t obj_id;               IN: Object to read attributes of
+        size_t nnames;              IN: Number of names in NAMES
+        const char *names[];        IN: Names of attributes to read, or NULL for all
+        size_t *nattrs;             IN/OUT: Number of entries in ATTRS
+        H5A_batch_attr_t attrs[];   OUT: Attributes read
+        size_t *arena_size;         IN/OUT: Size of ARENA
+        void *arena;                OUT: Buffer for attribute names & values
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+        This function reads the attributes named in NAMES, or all the
+    attributes of the object, returning their names, datatypes, dataspaces
+    and values.  When ATTRS or ARENA is NULL, only the number of entries
+    and the size of the arena needed are returned.
+--------------------------------------------------------------------------*/
+herr_t
+H5Aread_batch(hid_t obj_id, size_t nnames, const char *names[], size_t *nattrs /*in,out*/,
+              H5A_batch_attr_t attrs[] /*out*/, size_t *arena_size /*in,out*/, void *arena /*out*/)
+{
+    H5VL_object_t *                    vol_obj;             /* Object for obj_id */
+    H5VL_optional_args_t               vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_native_object_optional_args_t obj_opt_args;        /* Arguments for optional operation */
+    H5VL_loc_params_t                  loc_params;          /* Location parameters */
+    size_t                             u;                   /* Local index variable */
+    herr_t                             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iz**s*zx*zx", obj_id, nnames, names, nattrs, attrs, arena_size, arena);
+
+    /* Check arguments */
+    if (H5I_ATTR == H5I_get_type(obj_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not valid for an attribute")
+    if (!nattrs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nattrs parameter cannot be NULL")
+    if (!arena_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "arena_size parameter cannot be NULL")
+    if (names)
+        for (u = 0; u < nnames; u++)
+            if (!names[u] || !*names[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name parameter cannot be NULL or an empty string")
+
+    /* Get the VOL object */
+    if (NULL == (vol_obj = H5VL_vol_object(obj_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid object identifier")
+
+    /* Fill in location struct fields */
+    loc_params.type     = H5VL_OBJECT_BY_SELF;
+    loc_params.obj_type = H5I_get_type(obj_id);
+
+    /* Set up VOL callback arguments */
+    obj_opt_args.read_attr_batch.nnames     = nnames;
+    obj_opt_args.read_attr_batch.names      = names;
+    obj_opt_args.read_attr_batch.nattrs     = nattrs;
+    obj_opt_args.read_attr_batch.attrs      = attrs;
+    obj_opt_args.read_attr_batch.arena_size = arena_size;
+    obj_opt_args.read_attr_batch.arena      = arena;
+    vol_cb_args.op_type                     = H5VL_NATIVE_OBJECT_READ_ATTR_BATCH;
+    vol_cb_args.args                        = &obj_opt_args;
+
+    /* Read the attributes */
+    if (H5VL_object_optional(vol_obj, &loc_params, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) <
+        0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_batch() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5Aget_space
@@ -47,6 +47,11 @@
 /* Local Macros */
 /****************/
 
+/* Alignment of attribute values in the arena filled by H5A__read_batch() */
+#define H5A_BATCH_VALUE_ALIGNMENT 16
+#define H5A_BATCH_VALUE_ALIGN(X)                                                                             \
+    (H5A_BATCH_VALUE_ALIGNMENT * (((X) + (H5A_BATCH_VALUE_ALIGNMENT - 1)) / H5A_BATCH_VALUE_ALIGNMENT))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -91,6 +96,8 @@ static int    H5A__attr_cmp_name_inc(const void *attr1, const void *attr2);
 static int    H5A__attr_cmp_name_dec(const void *attr1, const void *attr2);
 static int    H5A__attr_cmp_corder_inc(const void *attr1, const void *attr2);
 static int    H5A__attr_cmp_corder_dec(const void *attr1, const void *attr2);
+static int    H5A__attr_cmp_name_key(const void *name, const void *attr);
+static htri_t H5A__batch_has_value(const H5A_t *attr);
 static herr_t H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type, H5_iter_order_t order);
 static herr_t H5A__iterate_common(hid_t loc_id, H5_index_t idx_type, H5_iter_order_t order, hsize_t *idx,
                                   H5A_attr_iter_op_t *attr_op, void *op_data);
@@ -780,7 +787,8 @@ H5A__read(const H5A_t *attr, const H5T_t *mem_type, void *buf)
         else { /* Attribute exists and has a value */
             /* Convert memory buffer into disk buffer */
             /* Set up type conversion function */
-            if (NULL == (tpath = H5T_path_find(attr->shared->dt, mem_type)))
+            if (NULL == (tpath = H5T_path_find_memo(attr->shared->dt, mem_type, attr->shared->dt,
+                                                    &attr->shared->read_tpath)))
                 HGOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, FAIL,
                             "unable to convert between src and dst datatypes")
 
@@ -881,7 +889,8 @@ H5A__write(H5A_t *attr, const H5T_t *mem_type, const void *buf)
 
         /* Convert memory buffer into disk buffer */
         /* Set up type conversion function */
-        if (NULL == (tpath = H5T_path_find(mem_type, attr->shared->dt)))
+        if (NULL == (tpath = H5T_path_find_memo(mem_type, attr->shared->dt, attr->shared->dt,
+                                                &attr->shared->write_tpath)))
             HGOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dst datatypes")
 
         /* Check for type conversion required */
@@ -2031,6 +2040,213 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5A__attr_release_table() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5A__attr_cmp_name_key
+ *
+ * Purpose:     Callback routine for looking up an attribute name in a
+ *              table of attributes sorted in increasing alphabetic order
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              name is considered to be respectively less than, equal to,
+ *              or greater than the attribute's name.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5A__attr_cmp_name_key(const void *name, const void *attr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp((const char *)name, (*(const H5A_t *const *)attr)->shared->name))
+} /* end H5A__attr_cmp_name_key() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__batch_has_value
+ *
+ * Purpose:     Determines whether H5A__read_batch copies an attribute's
+ *              value: it must have one, and its datatype must not hold
+ *              variable-length or reference data.
+ *
+ * Return:      TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5A__batch_has_value(const H5A_t *attr)
+{
+    htri_t has_class;         /* Whether the datatype contains a class */
+    htri_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (attr->shared->data_size > 0) {
+        if ((has_class = H5T_detect_class(attr->shared->dt, H5T_VLEN, FALSE)) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for variable-length datatype")
+        if (!has_class) {
+            if ((has_class = H5T_detect_class(attr->shared->dt, H5T_REFERENCE, FALSE)) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for reference datatype")
+            ret_value = !has_class;
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__batch_has_value() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__read_batch
+ *
+ * Purpose:     Reads the attributes of the object at LOC named in NAMES,
+ *              or all of them (in increasing name order) when NAMES is
+ *              NULL.  The object header's attribute messages, or the
+ *              dense attribute storage, are visited once to build a
+ *              table of the attributes, and the entries returned in
+ *              ATTRS are filled from that table.
+ *
+ *              Each attribute's value is copied, as stored, into ARENA
+ *              at an offset that is a multiple of H5A_BATCH_VALUE_ALIGNMENT,
+ *              and is followed by its name.  Values of datatypes holding
+ *              variable-length or reference data need the file to be
+ *              read, so they are not copied and their VALUE is NULL.
+ *
+ *              When ATTRS or ARENA is NULL, only the number of entries
+ *              and the arena size needed are returned in NATTRS and
+ *              ARENA_SIZE.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5A__read_batch(const H5O_loc_t *loc, size_t nnames, const char *names[], size_t *nattrs,
+                H5A_batch_attr_t attrs[], size_t *arena_size, void *arena)
+{
+    H5A_attr_table_t atable  = {0, NULL}; /* Table of attributes */
+    H5A_t **         sel     = NULL;      /* Attributes to return */
+    size_t           nsel    = 0;         /* Number of attributes to return */
+    size_t           needed  = 0;         /* Arena size needed */
+    size_t           nfilled = 0;         /* Number of entries filled */
+    htri_t           has_value;           /* Whether an attribute's value is copied */
+    size_t           u;                   /* Local index variable */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(nattrs);
+    HDassert(arena_size);
+
+    /* Build the table of attributes, sorted by name */
+    if (H5O__attr_build_table(loc, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+
+    /* Select the attributes to return */
+    if (names) {
+        if (nnames > 0 && NULL == (sel = (H5A_t **)H5MM_malloc(nnames * sizeof(H5A_t *))))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate attribute selection")
+        for (u = 0; u < nnames; u++) {
+            H5A_t **found = NULL; /* Table entry for the name */
+
+            if (atable.nattrs > 0)
+                found = (H5A_t **)HDbsearch(names[u], atable.attrs, atable.nattrs, sizeof(H5A_t *),
+                                            H5A__attr_cmp_name_key);
+            if (NULL == found)
+                HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "attribute '%s' not found", names[u])
+            sel[u] = *found;
+        } /* end for */
+        nsel = nnames;
+    } /* end if */
+    else {
+        sel  = atable.attrs;
+        nsel = atable.nattrs;
+    } /* end else */
+
+    /* Compute the size of the arena needed */
+    for (u = 0; u < nsel; u++) {
+        if ((has_value = H5A__batch_has_value(sel[u])) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check attribute's datatype")
+        if (has_value)
+            needed = H5A_BATCH_VALUE_ALIGN(needed) + sel[u]->shared->data_size;
+        needed += HDstrlen(sel[u]->shared->name) + 1;
+    } /* end for */
+
+    /* Only report the sizes, when the caller hasn't supplied buffers */
+    if (NULL == attrs || NULL == arena) {
+        *nattrs     = nsel;
+        *arena_size = needed;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if (*nattrs < nsel)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "attribute array too small")
+    if (*arena_size < needed)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "arena too small")
+
+    /* Fill in the entries */
+    needed = 0;
+    for (u = 0; u < nsel; u++) {
+        H5A_t *attr = sel[u]; /* Attribute to return */
+        size_t name_len;      /* Length of attribute name */
+
+        /* Attributes in the table aren't attached to the object yet */
+        attr->oloc.file = loc->file;
+        attr->oloc.addr = loc->addr;
+
+        /* Get IDs for the datatype & dataspace */
+        attrs[u].type_id  = H5I_INVALID_HID;
+        attrs[u].space_id = H5I_INVALID_HID;
+        nfilled++;
+        if ((attrs[u].type_id = H5A__get_type(attr)) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get datatype ID of attribute")
+        if ((attrs[u].space_id = H5A_get_space(attr)) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get dataspace ID of attribute")
+
+        /* Copy the value */
+        if ((has_value = H5A__batch_has_value(attr)) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check attribute's datatype")
+        if (has_value) {
+            needed         = H5A_BATCH_VALUE_ALIGN(needed);
+            attrs[u].value = (uint8_t *)arena + needed;
+            attrs[u].size  = attr->shared->data_size;
+            if (attr->shared->data)
+                H5MM_memcpy(attrs[u].value, attr->shared->data, attrs[u].size);
+            else
+                HDmemset(attrs[u].value, 0, attrs[u].size);
+            needed += attrs[u].size;
+        } /* end if */
+        else {
+            attrs[u].value = NULL;
+            attrs[u].size  = 0;
+        } /* end else */
+
+        /* Copy the name */
+        name_len = HDstrlen(attr->shared->name) + 1;
+        H5MM_memcpy((uint8_t *)arena + needed, attr->shared->name, name_len);
+        attrs[u].name = (const char *)arena + needed;
+        needed += name_len;
+    } /* end for */
+    *nattrs     = nsel;
+    *arena_size = needed;
+
+done:
+    /* Release the IDs already handed out, on error */
+    if (ret_value < 0)
+        for (u = 0; u < nfilled; u++) {
+            if (attrs[u].type_id >= 0 && H5I_dec_app_ref(attrs[u].type_id) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "unable to release datatype ID")
+            if (attrs[u].space_id >= 0 && H5I_dec_app_ref(attrs[u].space_id) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "unable to release dataspace ID")
+        } /* end for */
+
+    /* Release resources */
+    if (sel != atable.attrs)
+        H5MM_xfree(sel);
+    if (atable.attrs && H5A__attr_release_table(&atable) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__read_batch() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5A__get_ainfo
  *
@@ -85,6 +85,10 @@ typedef struct H5A_shared_t {
     size_t            data_size; /* Size of data on disk */
     H5O_msg_crt_idx_t crt_idx;   /* Attribute's creation index in the object header */
     unsigned          nrefs;     /* Ref count for times this object is referred	*/
+
+    /* Conversion paths found for recent reads & writes */
+    H5T_path_memo_t read_tpath;  /* Path from the attribute's datatype to memory */
+    H5T_path_memo_t write_tpath; /* Path from memory to the attribute's datatype */
 } H5A_shared_t;
 
 /* Define the main attribute structure */
@@ -208,6 +212,8 @@ H5_DLL herr_t H5A__exists_by_name(H5G_loc_t loc, const char *obj_name, const cha
 H5_DLL herr_t H5A__write(H5A_t *attr, const H5T_t *mem_type, const void *buf);
 H5_DLL herr_t H5A__read(const H5A_t *attr, const H5T_t *mem_type, void *buf);
 H5_DLL herr_t H5A__get_name(H5A_t *attr, size_t buf_size, char *buf, size_t *attr_name_len);
+H5_DLL herr_t H5A__read_batch(const H5O_loc_t *loc, size_t nnames, const char *names[], size_t *nattrs,
+                              H5A_batch_attr_t attrs[], size_t *arena_size, void *arena);
 
 /* Attribute "dense" storage routines */
 H5_DLL herr_t H5A__dense_create(H5F_t *f, H5O_ainfo_t *ainfo);
@@ -244,6 +250,8 @@ H5_DLL herr_t H5O__attr_write(const H5O_loc_t *loc, H5A_t *attr);
 H5_DLL herr_t H5O__attr_rename(const H5O_loc_t *loc, const char *old_name, const char *new_name);
 H5_DLL herr_t H5O__attr_iterate(hid_t loc_id, H5_index_t idx_type, H5_iter_order_t order, hsize_t skip,
                                 hsize_t *last_attr, const H5A_attr_iter_op_t *op, void *op_data);
+H5_DLL herr_t H5O__attr_build_table(const H5O_loc_t *loc, H5_index_t idx_type, H5_iter_order_t order,
+                                    H5A_attr_table_t *atable);
 H5_DLL herr_t H5O__attr_remove(const H5O_loc_t *loc, const char *name);
 H5_DLL herr_t H5O__attr_remove_by_idx(const H5O_loc_t *loc, H5_index_t idx_type, H5_iter_order_t order,
                                       hsize_t n);
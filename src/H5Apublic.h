@@ -34,6 +34,19 @@ typedef struct {
 } H5A_info_t;
 //! <!-- [H5A_info_t_snip] -->
 
+//! <!-- [H5A_batch_attr_t_snip] -->
+/**
+ * Attribute returned by H5Aread_batch()
+ */
+typedef struct {
+    const char *name;     /**< Name of the attribute, in the arena          */
+    hid_t       type_id;  /**< Datatype of the attribute                    */
+    hid_t       space_id; /**< Dataspace of the attribute                   */
+    size_t      size;     /**< Size of the value, in bytes                  */
+    void *      value;    /**< Value of the attribute, in the arena, or NULL */
+} H5A_batch_attr_t;
+//! <!-- [H5A_batch_attr_t_snip] -->
+
 //! <!-- [H5A_operator2_t_snip] -->
 /**
  * Typedef for H5Aiterate2() / H5Aiterate_by_name() callbacks
@@ -998,6 +1011,59 @@ H5_DLL herr_t H5Aread(hid_t attr_id, hid_t type_id, void *buf);
  */
 H5_DLL herr_t H5Aread_async(const char *app_file, const char *app_func, unsigned app_line, hid_t attr_id,
                             hid_t dtype_id, void *buf, hid_t es_id);
+/*--------------------------------------------------------------------------*/
+/**
+ * \ingroup H5A
+ *
+ * \brief Reads several attributes of an object in one call
+ *
+ * \obj_id
+ * \param[in]     nnames     Number of names in \p names
+ * \param[in]     names      Names of the attributes to read, or NULL
+ * \param[in,out] nattrs     Number of entries in \p attrs
+ * \param[out]    attrs      Attributes read
+ * \param[in,out] arena_size Size of \p arena, in bytes
+ * \param[out]    arena      Buffer for the attributes' names and values
+ *
+ * \return \herr_t
+ *
+ * \details H5Aread_batch() reads the attributes named in \p names
+ *          from the object specified by \p obj_id, returning them in
+ *          the same order, or every attribute of the object, in
+ *          increasing name order, when \p names is NULL.  It is an
+ *          error for a name not to be an attribute of the object.
+ *
+ *          Each entry of \p attrs holds the name of the attribute, new
+ *          identifiers for its datatype and dataspace, which must be
+ *          closed with H5Tclose() and H5Sclose(), and its value as it is
+ *          stored in the file, i.e., in the attribute's own datatype.
+ *          The names and values are copied into \p arena; each value
+ *          begins at a multiple of 16 bytes from the start of the arena.
+ *          The value of an attribute whose datatype holds variable-length
+ *          or reference data is not copied and its \c value is NULL;
+ *          it can be read with H5Aread().
+ *
+ *          When \p attrs or \p arena is NULL, nothing is read and the
+ *          number of entries and the arena size needed are returned in
+ *          \p nattrs and \p arena_size.  Otherwise, \p nattrs and
+ *          \p arena_size give the capacities of the buffers on input,
+ *          and the function fails if they are too small; on return they
+ *          hold the number of entries and the number of bytes used.
+ *
+ *          With the native VOL connector, the object header's attribute
+ *          messages, or the object's dense attribute storage, are read
+ *          once for the whole call, rather than once per attribute as
+ *          with H5Aopen() and H5Aread().  Other VOL connectors do not
+ *          support this operation.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Aread(), H5Aiterate2()
+ *
+ */
+H5_DLL herr_t H5Aread_batch(hid_t obj_id, size_t nnames, const char *names[], size_t *nattrs /*in,out*/,
+                            H5A_batch_attr_t attrs[] /*out*/, size_t *arena_size /*in,out*/,
+                            void *arena /*out*/);
 /*-------------------------------------------------------------------------*/
 /**
  * \ingroup H5A
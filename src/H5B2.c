@@ -81,6 +81,7 @@ extern const H5B2_class_t H5A_BT2_NAME[1];
 extern const H5B2_class_t H5A_BT2_CORDER[1];
 extern const H5B2_class_t H5D_BT2[1];
 extern const H5B2_class_t H5D_BT2_FILT[1];
+extern const H5B2_class_t H5M_BT2[1];
 extern const H5B2_class_t H5B2_TEST2[1];
 
 const H5B2_class_t *const H5B2_client_class_g[] = {
@@ -96,7 +97,8 @@ const H5B2_class_t *const H5B2_client_class_g[] = {
     H5A_BT2_CORDER,           /* 9 - H5B2_ATTR_DENSE_CORDER_ID 	*/
     H5D_BT2,                  /* 10 - H5B2_CDSET_ID                   */
     H5D_BT2_FILT,             /* 11 - H5B2_CDSET_FILT_ID              */
-    H5B2_TEST2                /* 12 - H5B2_TEST_ID 			*/
+    H5M_BT2,                  /* 12 - H5B2_MAP_ID                     */
+    H5B2_TEST2                /* 13 - H5B2_TEST_ID 			*/
 };
 
 /*****************************/
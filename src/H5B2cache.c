@@ -192,20 +192,22 @@ H5B2__cache_hdr_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5B2__cache_hdr_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5B2__cache_hdr_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *      image = (const uint8_t *)_image;       /* Pointer into raw data buffer */
+    H5B2_hdr_cache_ud_t *udata = (H5B2_hdr_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t             stored_chksum;                         /* Stored metadata checksum value */
+    uint32_t             computed_chksum;                       /* Computed metadata checksum value */
+    htri_t               ret_value = TRUE;                      /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -398,7 +400,7 @@ H5B2__cache_hdr_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED le
     H5F_ENCODE_LENGTH(f, image, hdr->root.all_nrec);
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (hdr->hdr_size - H5B2_SIZEOF_CHKSUM), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (hdr->hdr_size - H5B2_SIZEOF_CHKSUM), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -593,7 +595,7 @@ H5B2__cache_int_verify_chksum(const void *_image, size_t H5_ATTR_UNUSED len, voi
                ((size_t)(udata->nrec + 1) * H5B2_INT_POINTER_SIZE(udata->hdr, udata->depth));
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, chk_size, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, chk_size, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -825,7 +827,7 @@ H5B2__cache_int_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED le
     } /* end for */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1011,7 +1013,7 @@ H5B2__cache_leaf_verify_chksum(const void *_image, size_t H5_ATTR_UNUSED len, vo
     chk_size = H5B2_LEAF_PREFIX_SIZE + (udata->nrec * udata->hdr->rrec_size);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, chk_size, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, chk_size, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1160,8 +1162,7 @@ H5B2__cache_leaf_image_len(const void *_thing, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5B2__cache_leaf_serialize(const H5F_t H5_ATTR_UNUSED *f, void *_image, size_t H5_ATTR_UNUSED len,
-                           void *_thing)
+H5B2__cache_leaf_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED len, void *_thing)
 {
     H5B2_leaf_t *leaf  = (H5B2_leaf_t *)_thing; /* Pointer to the B-tree leaf node  */
     uint8_t *    image = (uint8_t *)_image;     /* Pointer into raw data buffer */
@@ -1204,7 +1205,7 @@ H5B2__cache_leaf_serialize(const H5F_t H5_ATTR_UNUSED *f, void *_image, size_t H
 
     /* Compute metadata checksum */
     metadata_chksum =
-        H5_checksum_metadata(_image, (size_t)((const uint8_t *)image - (const uint8_t *)_image), 0);
+        H5F_checksum_metadata(f, _image, (size_t)((const uint8_t *)image - (const uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
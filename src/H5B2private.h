@@ -56,6 +56,7 @@ typedef enum H5B2_subid_t {
                                   on objects */
     H5B2_CDSET_ID,             /* B-tree is for non-filtered chunked dataset storage w/ >1 unlim dims */
     H5B2_CDSET_FILT_ID,        /* B-tree is for filtered chunked dataset storage w/ >1 unlim dims */
+    H5B2_MAP_ID,               /* B-tree is for indexing the key-value pairs of maps by key hash */
     H5B2_TEST2_ID,             /* Another B-tree is for testing (do not use for actual data) */
     H5B2_NUM_BTREE_ID          /* Number of B-tree IDs (must be last)  */
 } H5B2_subid_t;
@@ -243,15 +243,21 @@ typedef struct H5CX_t {
     hbool_t  mpio_chunk_opt_ratio_valid; /* Whether collective chunk ratio is valid */
 #endif                                   /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;    /* Error detection info (H5D_XFER_EDC_NAME) */
-    hbool_t               err_detect_valid;     /* Whether error detection info is valid */
-    H5Z_cb_t              filter_cb;            /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
-    hbool_t               filter_cb_valid;      /* Whether filter callback function is valid */
-    H5Z_data_xform_t *    data_transform;       /* Data transform info (H5D_XFER_XFORM_NAME) */
-    hbool_t               data_transform_valid; /* Whether data transform info is valid */
-    H5T_vlen_alloc_info_t vl_alloc_info;        /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
-    hbool_t               vl_alloc_info_valid;  /* Whether VL datatype alloc info is valid */
-    H5T_conv_cb_t         dt_conv_cb;           /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
-    hbool_t               dt_conv_cb_valid;     /* Whether datatype conversion struct is valid */
+    hbool_t               err_detect_valid;      /* Whether error detection info is valid */
+    H5Z_cb_t              filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    hbool_t               filter_cb_valid;       /* Whether filter callback function is valid */
+    H5Z_data_xform_t *    data_transform;        /* Data transform info (H5D_XFER_XFORM_NAME) */
+    hbool_t               data_transform_valid;  /* Whether data transform info is valid */
+    H5T_vlen_alloc_info_t vl_alloc_info;         /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
+    hbool_t               vl_alloc_info_valid;   /* Whether VL datatype alloc info is valid */
+    H5T_conv_cb_t         dt_conv_cb;            /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    hbool_t               dt_conv_cb_valid;      /* Whether datatype conversion struct is valid */
+    unsigned              conv_nthreads;         /* Conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
+    hbool_t               conv_nthreads_valid;   /* Whether datatype conversion threads is valid */
+    unsigned              filter_nthreads;       /* Filter threads (H5D_XFER_FILTER_NTHREADS_NAME) */
+    hbool_t               filter_nthreads_valid; /* Whether filter threads is valid */
+    H5D_vlen_arena_t *    vlen_arena;            /* Arena for VL data read (H5D_XFER_VLEN_ARENA_NAME) */
+    hbool_t               vlen_arena_valid;      /* Whether VL data arena is valid */
 
     /* Return-only DXPL properties to return to application */
 #ifdef H5_HAVE_PARALLEL
@@ -375,10 +381,13 @@ typedef struct H5CX_dxpl_cache_t {
     unsigned mpio_chunk_opt_ratio;        /* Collective chunk ratio (H5D_XFER_MPIO_CHUNK_OPT_RATIO_NAME) */
 #endif                                    /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;     /* Error detection info (H5D_XFER_EDC_NAME) */
-    H5Z_cb_t              filter_cb;      /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
-    H5Z_data_xform_t *    data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
-    H5T_vlen_alloc_info_t vl_alloc_info;  /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
-    H5T_conv_cb_t         dt_conv_cb;     /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    H5Z_cb_t              filter_cb;       /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    H5Z_data_xform_t *    data_transform;  /* Data transform info (H5D_XFER_XFORM_NAME) */
+    H5T_vlen_alloc_info_t vl_alloc_info;   /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
+    H5T_conv_cb_t         dt_conv_cb;      /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    unsigned              conv_nthreads;   /* Datatype conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
+    unsigned              filter_nthreads; /* Filter threads (H5D_XFER_FILTER_NTHREADS_NAME) */
+    H5D_vlen_arena_t *    vlen_arena;      /* Arena for VL data read (H5D_XFER_VLEN_ARENA_NAME) */
 } H5CX_dxpl_cache_t;
 
 /* Typedef for cached default link creation property list information */
@@ -570,6 +579,18 @@ H5CX__init_package(void)
     if (H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &H5CX_def_dxpl_cache.dt_conv_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback")
 
+    /* Get number of datatype conversion threads */
+    if (H5P_get(dx_plist, H5D_XFER_CONV_NTHREADS_NAME, &H5CX_def_dxpl_cache.conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve number of datatype conversion threads")
+
+    /* Get number of filter threads */
+    if (H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &H5CX_def_dxpl_cache.filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve number of filter threads")
+
+    /* Get arena for VL data read */
+    if (H5P_get(dx_plist, H5D_XFER_VLEN_ARENA_NAME, &H5CX_def_dxpl_cache.vlen_arena) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL data arena")
+
     /* Reset the "default LCPL cache" information */
     HDmemset(&H5CX_def_lcpl_cache, 0, sizeof(H5CX_lcpl_cache_t));
 
@@ -1203,7 +1224,14 @@ H5CX_set_dcpl(hid_t dcpl_id)
     HDassert(head && *head);
 
     /* Set the API context's DCPL to a new value */
-    (*head)->ctx.dcpl_id = dcpl_id;
+    if ((*head)->ctx.dcpl_id != dcpl_id) {
+        (*head)->ctx.dcpl_id = dcpl_id;
+
+        /* Forget the values retrieved from the old DCPL */
+        (*head)->ctx.dcpl                   = NULL;
+        (*head)->ctx.do_min_dset_ohdr_valid = FALSE;
+        (*head)->ctx.ohdr_flags_valid       = FALSE;
+    } /* end if */
 
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_dcpl() */
@@ -2561,6 +2589,102 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_dt_conv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_conv_nthreads
+ *
+ * Purpose:     Retrieves the number of datatype conversion threads for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_conv_nthreads(unsigned *conv_nthreads)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(conv_nthreads);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_NTHREADS_NAME, conv_nthreads)
+
+    /* Get the value */
+    *conv_nthreads = (*head)->ctx.conv_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_nthreads
+ *
+ * Purpose:     Retrieves the number of filter threads for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_nthreads(unsigned *filter_nthreads)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_nthreads);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_NTHREADS_NAME, filter_nthreads)
+
+    /* Get the value */
+    *filter_nthreads = (*head)->ctx.filter_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_vlen_arena
+ *
+ * Purpose:     Retrieves the arena for VL data read for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_vlen_arena(H5D_vlen_arena_t **vlen_arena)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(vlen_arena);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_VLEN_ARENA_NAME, vlen_arena)
+
+    /* Get the value */
+    *vlen_arena = (*head)->ctx.vlen_arena;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_vlen_arena() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_encoding
  *
@@ -3134,6 +3258,7 @@ H5CX_set_vlen_alloc_info(H5MM_allocate_t alloc_func, void *alloc_info, H5MM_free
     (*head)->ctx.vl_alloc_info.alloc_info = alloc_info;
     (*head)->ctx.vl_alloc_info.free_func  = free_func;
     (*head)->ctx.vl_alloc_info.free_info  = free_info;
+    (*head)->ctx.vl_alloc_info.arena      = NULL;
 
     /* Mark the value as valid */
     (*head)->ctx.vl_alloc_info_valid = TRUE;
@@ -3142,6 +3267,40 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_set_vlen_alloc_info() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_vlen_arena
+ *
+ * Purpose:     Sets the arena that VL data is allocated in for the current
+ *              API call context, or stops using one when ARENA is NULL.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_set_vlen_arena(H5T_vlen_arena_t *arena)
+{
+    H5CX_node_t **        head = NULL;         /* Pointer to head of API context list */
+    H5T_vlen_alloc_info_t vl_alloc_info;       /* VL allocation info */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    HDassert(head && *head);
+
+    /* Make sure the rest of the allocation info has been retrieved */
+    if (H5CX_get_vlen_alloc_info(&vl_alloc_info) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
+
+    /* Set the API context value */
+    (*head)->ctx.vl_alloc_info.arena = arena;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_set_vlen_arena() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_set_nlinks
  *
@@ -120,6 +120,9 @@ H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
 H5_DLL herr_t H5CX_get_data_transform(H5Z_data_xform_t **data_transform);
 H5_DLL herr_t H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info);
 H5_DLL herr_t H5CX_get_dt_conv_cb(H5T_conv_cb_t *cb_struct);
+H5_DLL herr_t H5CX_get_conv_nthreads(unsigned *conv_nthreads);
+H5_DLL herr_t H5CX_get_filter_nthreads(unsigned *filter_nthreads);
+H5_DLL herr_t H5CX_get_vlen_arena(H5D_vlen_arena_t **vlen_arena);
 
 /* "Getter" routines for LCPL properties cached in API context */
 H5_DLL herr_t H5CX_get_encoding(H5T_cset_t *encoding);
@@ -156,6 +159,7 @@ H5_DLL herr_t H5CX_set_io_xfer_mode(H5FD_mpio_xfer_t io_xfer_mode);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5CX_set_vlen_alloc_info(H5MM_allocate_t alloc_func, void *alloc_info, H5MM_free_t free_func,
                                        void *free_info);
+H5_DLL herr_t H5CX_set_vlen_arena(H5T_vlen_arena_t *arena);
 
 /* "Setter" routines for LAPL properties cached in API context */
 H5_DLL herr_t H5CX_set_nlinks(size_t nlinks);
@@ -27,6 +27,7 @@
 #include "H5ESprivate.h" /* Event Sets                               */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -55,6 +56,9 @@ static herr_t H5D__read_api_common(hid_t dset_id, hid_t mem_type_id, hid_t mem_s
 static herr_t H5D__write_api_common(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
                                     hid_t dxpl_id, const void *buf, void **token_ptr,
                                     H5VL_object_t **_vol_obj_ptr);
+static herr_t H5D__io_multi_api_common(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+                                       hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, void *rbuf[],
+                                       const void *wbuf[]);
 static herr_t H5D__set_extent_api_common(hid_t dset_id, const hsize_t size[], void **token_ptr,
                                          H5VL_object_t **_vol_obj_ptr);
 
@@ -322,6 +326,159 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dcreate_anon() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dcreate_multi
+ *
+ * Purpose:     Creates COUNT new datasets in the group at LOC_ID, named
+ *              NAME[I] and created from TYPE_ID[I], SPACE_ID[I] and
+ *              DCPL_ID[I], just as H5Dcreate2() would, and returns their
+ *              IDs in DSET_ID.  All the links are created with LCPL_ID
+ *              and all the datasets are opened with DAPL_ID.
+ *
+ *              When the native VOL connector holds LOC_ID, the object
+ *              headers are allocated next to each other in the file and
+ *              the links are inserted into the group in one batch.
+ *              Otherwise, the datasets are created one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dcreate_multi(hid_t loc_id, size_t count, const char *name[], hid_t type_id[], hid_t space_id[],
+                hid_t lcpl_id, hid_t dcpl_id[], hid_t dapl_id, hid_t dset_id[] /*out*/)
+{
+    H5VL_object_t *   vol_obj = NULL;      /* Object for loc_id */
+    H5VL_loc_params_t loc_params;          /* Location parameters for object access */
+    hid_t *           dcpl    = NULL;      /* Dataset creation property lists */
+    void **           dset    = NULL;      /* New datasets */
+    uint64_t          supported;           /* Whether the multi-object operation is supported by VOL connector */
+    size_t            nregistered = 0;     /* # of datasets with IDs */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("e", "iz**s*i*ii*iix", loc_id, count, name, type_id, space_id, lcpl_id, dcpl_id, dapl_id,
+             dset_id);
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name array not provided")
+    if (!type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "type_id array not provided")
+    if (!space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "space_id array not provided")
+    if (!dcpl_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dcpl_id array not provided")
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    for (u = 0; u < count; u++)
+        if (!name[u] || !*name[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name parameter cannot be NULL or an empty string")
+
+    /* Set up object access arguments */
+    if (H5VL_setup_acc_args(loc_id, H5P_CLS_DACC, TRUE, &dapl_id, &vol_obj, &loc_params) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set object access arguments")
+
+    /* Get link creation property list */
+    if (H5P_DEFAULT == lcpl_id)
+        lcpl_id = H5P_LINK_CREATE_DEFAULT;
+    else if (TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "lcpl_id is not a link creation property list")
+
+    /* Get dataset creation property lists */
+    if (NULL == (dcpl = (hid_t *)H5MM_malloc(count * sizeof(hid_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate property list array")
+    for (u = 0; u < count; u++) {
+        if (H5P_DEFAULT == dcpl_id[u])
+            dcpl[u] = H5P_DATASET_CREATE_DEFAULT;
+        else if (TRUE != H5P_isa_class(dcpl_id[u], H5P_DATASET_CREATE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dcpl_id is not a dataset create property list ID")
+        else
+            dcpl[u] = dcpl_id[u];
+    } /* end for */
+
+    /* Set the LCPL for the API context */
+    H5CX_set_lcpl(lcpl_id);
+
+    /* Allocate space for the new datasets */
+    if (NULL == (dset = (void **)H5MM_calloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate dataset object array")
+
+    /* Check if the multi-object operation is supported */
+    supported = 0;
+    if (H5_VOL_NATIVE == vol_obj->connector->cls->value &&
+        H5VL_introspect_opt_query(vol_obj, H5VL_SUBCLS_OBJECT, H5VL_NATIVE_OBJECT_CREATE_MULTI, &supported) <
+            0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for multi-object create operation")
+    if (supported & H5VL_OPT_QUERY_SUPPORTED) {
+        H5VL_optional_args_t               vol_cb_args;  /* Arguments to VOL callback */
+        H5VL_native_object_optional_args_t obj_opt_args; /* Arguments for optional operation */
+
+        /* Set up VOL callback arguments */
+        obj_opt_args.create_multi.obj_type = H5O_TYPE_DATASET;
+        obj_opt_args.create_multi.count    = count;
+        obj_opt_args.create_multi.name     = name;
+        obj_opt_args.create_multi.type_id  = type_id;
+        obj_opt_args.create_multi.space_id = space_id;
+        obj_opt_args.create_multi.cpl_id   = dcpl;
+        obj_opt_args.create_multi.lcpl_id  = lcpl_id;
+        obj_opt_args.create_multi.apl_id   = dapl_id;
+        obj_opt_args.create_multi.obj      = dset;
+        vol_cb_args.op_type                = H5VL_NATIVE_OBJECT_CREATE_MULTI;
+        vol_cb_args.args                   = &obj_opt_args;
+
+        /* Create the datasets */
+        if (H5VL_object_optional(vol_obj, &loc_params, &vol_cb_args, H5P_DATASET_XFER_DEFAULT,
+                                 H5_REQUEST_NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "unable to create datasets")
+    } /* end if */
+    else {
+        /* Create the datasets one at a time */
+        for (u = 0; u < count; u++) {
+            /* Set the DCPL for the API context */
+            H5CX_set_dcpl(dcpl[u]);
+
+            if (NULL == (dset[u] = H5VL_dataset_create(vol_obj, &loc_params, name[u], lcpl_id, type_id[u],
+                                                       space_id[u], dcpl[u], dapl_id,
+                                                       H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "unable to create dataset")
+        } /* end for */
+    }     /* end else */
+
+    /* Get IDs for the datasets */
+    for (u = 0; u < count; u++) {
+        if ((dset_id[u] = H5VL_register(H5I_DATASET, dset[u], vol_obj->connector, TRUE)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "unable to register dataset")
+        dset[u] = NULL;
+        nregistered++;
+    } /* end for */
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && dset) {
+        for (u = 0; u < nregistered; u++)
+            if (H5I_dec_app_ref(dset_id[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataset")
+        for (u = nregistered; u < count; u++)
+            if (dset[u]) {
+                H5VL_object_t *dset_vol_obj; /* Object for the dataset */
+
+                if (NULL == (dset_vol_obj = H5VL_create_object(dset[u], vol_obj->connector)) ||
+                    H5VL_dataset_close(dset_vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataset")
+                if (dset_vol_obj && H5VL_free_object(dset_vol_obj) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "unable to free VOL object")
+            } /* end if */
+    }         /* end if */
+    H5MM_xfree(dset);
+    H5MM_xfree(dcpl);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dcreate_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__open_api_common
  *
@@ -1275,6 +1432,200 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_multi_api_common
+ *
+ * Purpose:     Common helper routine for H5Dread_multi / H5Dwrite_multi.
+ *              Reads into RBUF or writes from WBUF, whichever isn't NULL.
+ *
+ *              When all the datasets belong to the native VOL connector,
+ *              the I/O is handed to it in one operation, so it can be
+ *              combined across the datasets.  Otherwise, the datasets
+ *              are read or written one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_multi_api_common(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                         hid_t file_space_id[], hid_t dxpl_id, void *rbuf[], const void *wbuf[])
+{
+    H5VL_object_t **vol_objs  = NULL; /* Objects for the datasets */
+    hbool_t         is_native = TRUE; /* Whether all the datasets belong to the native VOL connector */
+    uint64_t        supported;        /* Whether the multi-dataset operation is supported by VOL connector */
+    size_t          u;                /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if (!rbuf && !wbuf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+
+    /* Get the datasets */
+    if (NULL == (vol_objs = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate dataset object array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_objs[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (H5_VOL_NATIVE != vol_objs[u]->connector->cls->value)
+            is_native = FALSE;
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Check if the multi-dataset operation is supported */
+    supported = 0;
+    if (is_native && H5VL_introspect_opt_query(vol_objs[0], H5VL_SUBCLS_DATASET,
+                                               rbuf ? H5VL_NATIVE_DATASET_READ_MULTI
+                                                    : H5VL_NATIVE_DATASET_WRITE_MULTI,
+                                               &supported) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for multi-dataset I/O operation")
+    if (supported & H5VL_OPT_QUERY_SUPPORTED) {
+        H5VL_optional_args_t                vol_cb_args;   /* Arguments to VOL callback */
+        H5VL_native_dataset_optional_args_t dset_opt_args; /* Arguments for optional operation */
+
+        /* Set up VOL callback arguments */
+        if (rbuf) {
+            dset_opt_args.read_multi.count         = count;
+            dset_opt_args.read_multi.dset_id       = dset_id;
+            dset_opt_args.read_multi.mem_type_id   = mem_type_id;
+            dset_opt_args.read_multi.mem_space_id  = mem_space_id;
+            dset_opt_args.read_multi.file_space_id = file_space_id;
+            dset_opt_args.read_multi.buf           = rbuf;
+            vol_cb_args.op_type                    = H5VL_NATIVE_DATASET_READ_MULTI;
+        } /* end if */
+        else {
+            dset_opt_args.write_multi.count         = count;
+            dset_opt_args.write_multi.dset_id       = dset_id;
+            dset_opt_args.write_multi.mem_type_id   = mem_type_id;
+            dset_opt_args.write_multi.mem_space_id  = mem_space_id;
+            dset_opt_args.write_multi.file_space_id = file_space_id;
+            dset_opt_args.write_multi.buf           = wbuf;
+            vol_cb_args.op_type                     = H5VL_NATIVE_DATASET_WRITE_MULTI;
+        } /* end else */
+        vol_cb_args.args = &dset_opt_args;
+
+        /* Read or write the data */
+        if (H5VL_dataset_optional(vol_objs[0], &vol_cb_args, dxpl_id, H5_REQUEST_NULL) < 0) {
+            if (rbuf)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            else
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        } /* end if */
+    }     /* end if */
+    else {
+        /* Read or write the datasets one at a time */
+        for (u = 0; u < count; u++)
+            if (rbuf) {
+                if (H5VL_dataset_read(vol_objs[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                      rbuf[u], H5_REQUEST_NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            } /* end if */
+            else if (H5VL_dataset_write(vol_objs[u], mem_type_id[u], mem_space_id[u], file_space_id[u],
+                                        dxpl_id, wbuf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end else */
+
+done:
+    H5MM_xfree(vol_objs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_multi_api_common() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) COUNT datasets from their files into
+ *              application memory.  Element I of each array describes a
+ *              read from DSET_ID[I] into BUF[I], just as the matching
+ *              arguments of H5Dread() do, and all the reads use the
+ *              data transfer properties in DXPL_ID.
+ *
+ *              Raw data that needs no datatype conversion is read from
+ *              each file in address order once all the datasets have
+ *              been set up, with the reads for neighboring pieces of
+ *              storage combined, whichever dataset they belong to.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+              hid_t dxpl_id, void *buf[] /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Read the data */
+    if (H5D__io_multi_api_common(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                 NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) COUNT datasets to their files from
+ *              application memory.  Element I of each array describes a
+ *              write to DSET_ID[I] from BUF[I], just as the matching
+ *              arguments of H5Dwrite() do, and all the writes use the
+ *              data transfer properties in DXPL_ID.
+ *
+ *              Raw data that needs no datatype conversion is written to
+ *              each file in address order once all the datasets have
+ *              been set up, with the writes for neighboring pieces of
+ *              storage combined, whichever dataset they belong to.
+ *              Writes to a dataset listed more than once land in the
+ *              order they are listed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+               hid_t file_space_id[], hid_t dxpl_id, const void *buf[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Write the data */
+    if (H5D__io_multi_api_common(count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, NULL,
+                                 buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
  *
@@ -1744,6 +2095,37 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dvlen_get_buf_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dvlen_arena_free
+ *
+ * Purpose:     Frees the variable-length data that a read placed in an
+ *              arena set with H5Pset_vlen_arena(), and empties the arena.
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dvlen_arena_free(H5D_vlen_arena_t *arena)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*#", arena);
+
+    /* Check args */
+    if (NULL == arena)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid 'arena' pointer")
+
+    /* The data was allocated with the system allocator, like other VL data */
+    HDfree(arena->buf);
+    HDfree(arena->offset);
+    HDmemset(arena, 0, sizeof(*arena));
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dvlen_arena_free() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__set_extent_api_common
  *
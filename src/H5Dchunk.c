@@ -106,6 +106,9 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Largest number of chunks in a chunk mapping that's kept for reuse by later I/O */
+#define H5D_CHUNK_MAP_CACHE_MAX_NCHUNKS 4096
+
 /* Flags for the "edge_chunk_state" field below */
 #define H5D_RDCC_DISABLE_FILTERS 0x01u /* Disable filters on this chunk */
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS                                                                      \
@@ -295,6 +298,11 @@ static herr_t   H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
 static herr_t   H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata);
 static hbool_t  H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata);
 static herr_t   H5D__free_chunk_info(void *item, void *key, void *opdata);
+static htri_t   H5D__chunk_map_cache_same_space(const H5S_t *cached_space, const H5S_t *space);
+static htri_t   H5D__chunk_map_cache_lookup(const H5D_io_info_t *io_info, const H5S_t *file_space,
+                                            const H5S_t *mem_space, H5D_chunk_map_t *fm);
+static herr_t   H5D__chunk_map_cache_store(const H5D_io_info_t *io_info, const H5S_t *file_space,
+                                           const H5S_t *mem_space, H5D_chunk_map_t *fm);
 static herr_t   H5D__create_chunk_map_single(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info);
 static herr_t   H5D__create_chunk_file_map_all(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info);
 static herr_t   H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t *io_info);
@@ -744,6 +752,10 @@ H5D__chunk_set_info(const H5D_t *dset)
     /* Sanity checks */
     HDassert(dset);
 
+    /* Drop any kept chunk mapping, the chunk indices it holds may change */
+    if (H5D__chunk_map_cache_reset(&dset->shared->cache.chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release kept chunk mapping")
+
     /* Set the base layout information */
     if (H5D__chunk_set_info_real(&dset->shared->layout.u.chunk, dset->shared->ndims, dset->shared->curr_dims,
                                  dset->shared->max_dims) < 0)
@@ -1062,6 +1074,7 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     const H5D_t *dataset = io_info->dset;       /* Local pointer to dataset info */
     hssize_t     old_offset[H5O_LAYOUT_NDIMS];  /* Old selection offset */
     htri_t       file_space_normalized = FALSE; /* File dataspace was normalized */
+    htri_t       map_found             = FALSE; /* Whether a kept chunk mapping was found */
     unsigned     f_ndims;                       /* The number of dimensions of the file's dataspace */
     int          sm_ndims;            /* The number of dimensions of the memory buffer's dataspace (signed) */
     unsigned     u;                   /* Local index variable */
@@ -1082,15 +1095,6 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     /* Get rank for file dataspace */
     fm->f_ndims = f_ndims = dataset->shared->layout.u.chunk.ndims - 1;
 
-    /* Normalize hyperslab selections by adjusting them by the offset */
-    /* (It might be worthwhile to normalize both the file and memory dataspaces
-     * before any (contiguous, chunked, etc) file I/O operation, in order to
-     * speed up hyperslab calculations by removing the extra checks and/or
-     * additions involving the offset and the hyperslab selection -QAK)
-     */
-    if ((file_space_normalized = H5S_hyper_normalize_offset((H5S_t *)file_space, old_offset)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to normalize selection")
-
     /* Decide the number of chunks in each dimension */
     for (u = 0; u < f_ndims; u++)
         /* Keep the size of the chunk dimensions as hsize_t for various routines */
@@ -1112,6 +1116,22 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     fm->last_index      = (hsize_t)-1;
     fm->last_chunk_info = NULL;
 
+    /* Reuse the chunk mapping kept from an earlier I/O with the same selections, if there is one */
+    fm->kept = FALSE;
+    if ((map_found = H5D__chunk_map_cache_lookup(io_info, file_space, mem_space, fm)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for kept chunk mapping")
+    if (map_found)
+        HGOTO_DONE(SUCCEED)
+
+    /* Normalize hyperslab selections by adjusting them by the offset */
+    /* (It might be worthwhile to normalize both the file and memory dataspaces
+     * before any (contiguous, chunked, etc) file I/O operation, in order to
+     * speed up hyperslab calculations by removing the extra checks and/or
+     * additions involving the offset and the hyperslab selection -QAK)
+     */
+    if ((file_space_normalized = H5S_hyper_normalize_offset((H5S_t *)file_space, old_offset)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to normalize selection")
+
     /* Point at the dataspaces */
     fm->file_space = file_space;
     fm->mem_space  = mem_space;
@@ -1129,6 +1149,11 @@ done:
             0) /* (Casting away const OK -QAK) */
             HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't denormalize selection")
 
+    /* Keep a newly built mapping for reuse by later I/O with the same selections */
+    if (ret_value >= 0 && !map_found)
+        if (H5D__chunk_map_cache_store(io_info, file_space, mem_space, fm) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't keep chunk mapping")
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_io_init() */
 
@@ -1338,6 +1363,228 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_io_init_selections() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_same_space
+ *
+ * Purpose:     Checks if a dataspace has the same extent and selects the
+ *              same elements as the copy of a dataspace a kept chunk
+ *              mapping was built for.  Selections with the same shape and
+ *              the same bounds (which include the selection offset) are
+ *              the same selection.
+ *
+ * Return:      TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_map_cache_same_space(const H5S_t *cached_space, const H5S_t *space)
+{
+    hsize_t  cached_start[H5S_MAX_RANK]; /* Low bounds of the kept selection */
+    hsize_t  cached_end[H5S_MAX_RANK];   /* High bounds of the kept selection */
+    hsize_t  start[H5S_MAX_RANK];        /* Low bounds of the selection */
+    hsize_t  end[H5S_MAX_RANK];          /* High bounds of the selection */
+    unsigned u;                          /* Local index variable */
+    htri_t   ret_value = TRUE;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cached_space);
+    HDassert(space);
+
+    /* Check the cheap things first */
+    if (H5S_GET_SELECT_TYPE(cached_space) != H5S_GET_SELECT_TYPE(space) ||
+        H5S_GET_SELECT_NPOINTS(cached_space) != H5S_GET_SELECT_NPOINTS(space) ||
+        H5S_GET_SELECT_NPOINTS(space) == 0)
+        HGOTO_DONE(FALSE)
+    if (!H5S_extent_equal(cached_space, space))
+        HGOTO_DONE(FALSE)
+
+    /* Check where the selections are */
+    if (H5S_SELECT_BOUNDS(cached_space, cached_start, cached_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds")
+    if (H5S_SELECT_BOUNDS(space, start, end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds")
+    for (u = 0; u < (unsigned)H5S_GET_EXTENT_NDIMS(space); u++)
+        if (cached_start[u] != start[u] || cached_end[u] != end[u])
+            HGOTO_DONE(FALSE)
+
+    /* Check the shape of the selections */
+    if ((ret_value = H5S_SELECT_SHAPE_SAME(cached_space, space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't compare selections")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_same_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_lookup
+ *
+ * Purpose:     Looks for a chunk mapping kept by the dataset from an
+ *              earlier I/O with the same file and memory selections, and
+ *              if there is one, sets up FM to use it.
+ *
+ * Return:      TRUE if a kept mapping was found, FALSE if not, FAIL on
+ *              error.
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_map_cache_lookup(const H5D_io_info_t *io_info, const H5S_t *file_space, const H5S_t *mem_space,
+                            H5D_chunk_map_t *fm)
+{
+    H5D_chunk_map_cache_t *map_cache = &io_info->dset->shared->cache.chunk.map_cache; /* Kept mapping */
+    htri_t                 ret_value = FALSE;                                         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fm);
+
+    if (NULL == map_cache->sel_chunks)
+        HGOTO_DONE(FALSE)
+#ifdef H5_HAVE_PARALLEL
+    if (io_info->using_mpi_vfd)
+        HGOTO_DONE(FALSE)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Check that the selections match the ones the mapping was built for */
+    if ((ret_value = H5D__chunk_map_cache_same_space(map_cache->file_space, file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't compare file selections")
+    if (ret_value)
+        if ((ret_value = H5D__chunk_map_cache_same_space(map_cache->mem_space, mem_space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't compare memory selections")
+    if (!ret_value)
+        HGOTO_DONE(FALSE)
+
+    /* Use the kept mapping */
+    fm->sel_chunks  = map_cache->sel_chunks;
+    fm->use_single  = FALSE;
+    fm->fsel_type   = map_cache->fsel_type;
+    fm->msel_type   = map_cache->msel_type;
+    fm->mchunk_tmpl = NULL;
+    fm->kept        = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_store
+ *
+ * Purpose:     Keeps the chunk mapping just built in FM with the dataset,
+ *              in place of any mapping kept before, so the next I/O with
+ *              the same selections doesn't need to build it again.
+ *              Mappings for single element I/O, or with too many chunks,
+ *              aren't kept.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_map_cache_store(const H5D_io_info_t *io_info, const H5S_t *file_space, const H5S_t *mem_space,
+                           H5D_chunk_map_t *fm)
+{
+    H5D_rdcc_t *           rdcc      = &io_info->dset->shared->cache.chunk; /* Dataset's chunk cache */
+    H5D_chunk_map_cache_t *map_cache = &rdcc->map_cache;                    /* Kept mapping */
+    H5SL_node_t *          curr_node;                                       /* Current node in skip list */
+    herr_t                 ret_value = SUCCEED;                             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fm);
+    HDassert(!fm->kept);
+
+    if (fm->use_single || NULL == fm->sel_chunks || H5SL_count(fm->sel_chunks) == 0 ||
+        H5SL_count(fm->sel_chunks) > H5D_CHUNK_MAP_CACHE_MAX_NCHUNKS)
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    if (io_info->using_mpi_vfd)
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Release the mapping kept before */
+    if (H5D__chunk_map_cache_reset(rdcc) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release kept chunk mapping")
+
+    /* Copy the dataspaces the mapping was built for */
+    if (NULL == (map_cache->file_space = H5S_copy(file_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
+    if (NULL == (map_cache->mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+    /* Point chunks that share the application's memory dataspace at the copy instead */
+    curr_node = H5SL_first(fm->sel_chunks);
+    while (curr_node) {
+        H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node); /* Chunk's information */
+
+        HDassert(!chunk_info->fspace_shared);
+        if (chunk_info->mspace_shared) {
+            HDassert(chunk_info->mspace == mem_space);
+            chunk_info->mspace = map_cache->mem_space;
+        } /* end if */
+
+        curr_node = H5SL_next(curr_node);
+    } /* end while */
+
+    /* Take the skip list of chunks from the dataset, which creates another for the next mapping built */
+    map_cache->sel_chunks = fm->sel_chunks;
+    map_cache->fsel_type  = fm->fsel_type;
+    map_cache->msel_type  = fm->msel_type;
+    HDassert(rdcc->sel_chunks == fm->sel_chunks);
+    rdcc->sel_chunks = NULL;
+    fm->kept         = TRUE;
+
+done:
+    if (ret_value < 0 && NULL == map_cache->sel_chunks) {
+        if (map_cache->file_space && H5S_close(map_cache->file_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release dataspace")
+        if (map_cache->mem_space && H5S_close(map_cache->mem_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release dataspace")
+        map_cache->file_space = map_cache->mem_space = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_reset
+ *
+ * Purpose:     Releases the chunk mapping kept by a dataset for reuse, if
+ *              there is one.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_map_cache_reset(H5D_rdcc_t *rdcc)
+{
+    H5D_chunk_map_cache_t *map_cache = &rdcc->map_cache; /* Kept mapping */
+    herr_t                 ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(rdcc);
+
+    if (map_cache->sel_chunks) {
+        if (H5SL_destroy(map_cache->sel_chunks, H5D__free_chunk_info, NULL) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release kept chunk selections")
+        map_cache->sel_chunks = NULL;
+    } /* end if */
+    if (map_cache->file_space) {
+        if (H5S_close(map_cache->file_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release dataspace")
+        map_cache->file_space = NULL;
+    } /* end if */
+    if (map_cache->mem_space) {
+        if (H5S_close(map_cache->mem_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release dataspace")
+        map_cache->mem_space = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_reset() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_mem_alloc
  *
@@ -2822,8 +3069,8 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
         H5S_select_all(fm->single_space, TRUE);
     } /* end if */
     else {
-        /* Release the nodes on the list of selected chunks */
-        if (fm->sel_chunks)
+        /* Release the nodes on the list of selected chunks, unless the dataset keeps them */
+        if (fm->sel_chunks && !fm->kept)
             if (H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
     } /* end else */
@@ -3328,6 +3575,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
             size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
             size_t    nbytes;                           /* Chunk size (in bytes) */
+            double    min_ratio = dset->shared->dcpl_cache.min_filter_ratio; /* Minimum compression ratio */
 
             /* Retrieve filter settings from API context */
             if (H5CX_get_err_detect(&err_detect) < 0)
@@ -3335,11 +3583,12 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             if (H5CX_get_filter_cb(&filter_cb) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
 
-            if (!reset) {
+            if (!reset || min_ratio > 0.0) {
                 /*
                  * Copy the chunk to a new buffer before running it through
                  * the pipeline because we'll want to save the original buffer
-                 * for later.
+                 * for later, or write it instead if it doesn't compress well
+                 * enough.
                  */
                 if (NULL == (buf = H5MM_malloc(alloc)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
@@ -3365,7 +3614,39 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             if (nbytes > ((size_t)0xffffffff))
                 HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
 #endif /* H5_SIZEOF_SIZE_T > 4 */
-            H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
+
+            /* Store the chunk uncompressed if the pipeline didn't shrink it enough,
+             * skipping the compression filters in its filter mask so reads bypass
+             * them too.  Checksums and any other filters are still applied.
+             */
+            if (min_ratio > 0.0 && (double)udata.chunk_block.length < min_ratio * (double)nbytes) {
+                unsigned skip_mask = H5Z_compression_mask(&(dset->shared->dcpl_cache.pline));
+
+                if (skip_mask == (unsigned)(((uint64_t)1 << dset->shared->dcpl_cache.pline.nused) - 1)) {
+                    /* Every filter is skipped, write the chunk as it is */
+                    H5MM_xfree(buf);
+                    buf               = ent->chunk;
+                    udata.filter_mask = skip_mask;
+                } /* end if */
+                else if (skip_mask) {
+                    /* Run the chunk through the remaining filters */
+                    H5MM_xfree(buf);
+                    alloc = udata.chunk_block.length;
+                    if (NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    H5MM_memcpy(buf, ent->chunk, alloc);
+                    nbytes            = alloc;
+                    udata.filter_mask = skip_mask;
+                    if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
+                                     filter_cb, &nbytes, &alloc, &buf) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+                    H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
+                } /* end else-if */
+                else
+                    H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
+            } /* end if */
+            else
+                H5_CHECKED_ASSIGN(udata.chunk_block.length, hsize_t, nbytes, size_t);
 
             /* Indicate that the chunk must be allocated */
             must_alloc = TRUE;
@@ -3884,8 +4165,12 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 size_t buf_alloc      = chunk_alloc; /* [Re-]allocated buffer size */
 
                 /* Chunk size on disk isn't [likely] the same size as the final chunk
-                 * size in memory, so allocate memory big enough. */
-                if (NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc,
+                 * size in memory, so allocate memory big enough.  (Filters that
+                 * expand the data, like deflate, use the buffer's size as their
+                 * initial output size, so make sure it can hold the whole chunk.) */
+                if (old_pline && old_pline->nused)
+                    buf_alloc = MAX(buf_alloc, chunk_size);
+                if (NULL == (chunk = H5D__chunk_mem_alloc(buf_alloc,
                                                           (udata->new_unfilt_chunk ? old_pline : pline))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL,
                                 "memory allocation failed for raw data chunk")
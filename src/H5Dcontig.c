@@ -63,9 +63,10 @@ typedef struct H5D_contig_readvv_sieve_ud_t {
 
 /* Callback info for [plain] readvv operation */
 typedef struct H5D_contig_readvv_ud_t {
-    H5F_shared_t * f_sh;      /* Shared file for dataset */
-    haddr_t        dset_addr; /* Address of dataset */
-    unsigned char *rbuf;      /* Pointer to buffer to fill */
+    H5F_shared_t *  f_sh;      /* Shared file for dataset */
+    haddr_t         dset_addr; /* Address of dataset */
+    unsigned char * rbuf;      /* Pointer to buffer to fill */
+    H5D_io_batch_t *batch;     /* Batch to put the reads off to, if not NULL */
 } H5D_contig_readvv_ud_t;
 
 /* Callback info for sieve buffer writevv operation */
@@ -81,6 +82,7 @@ typedef struct H5D_contig_writevv_ud_t {
     H5F_shared_t *       f_sh;      /* Shared file for dataset */
     haddr_t              dset_addr; /* Address of dataset */
     const unsigned char *wbuf;      /* Pointer to buffer to write */
+    H5D_io_batch_t *     batch;     /* Batch to put the writes off to, if not NULL */
 } H5D_contig_writevv_ud_t;
 
 /********************/
@@ -103,6 +105,11 @@ static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t H5D__contig_sieve_find(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len,
+                                     hbool_t write);
+static herr_t H5D__contig_sieve_release(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, unsigned first,
+                                        haddr_t addr, hsize_t size, hbool_t evict);
+static herr_t H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, unsigned idx);
 
 /*********************/
 /* Package Variables */
@@ -122,7 +129,7 @@ const H5D_layout_ops_t H5D_LOPS_CONTIG[1] = {
 /*******************/
 
 /* Declare a PQ free list to manage the sieve buffer information */
-H5FL_BLK_DEFINE(sieve_buf);
+H5FL_BLK_DEFINE_STATIC(sieve_buf);
 
 /* Declare extern the free list to manage blocks of type conversion data */
 H5FL_BLK_EXTERN(type_conv);
@@ -410,6 +417,9 @@ H5D__contig_construct(H5F_t *f, H5D_t *dset)
     else
         dset->shared->cache.contig.sieve_buf_size = tmp_sieve_buf_size;
 
+    /* Start with a single data sieve window */
+    dset->shared->cache.contig.sieve_max_nwins = 1;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_construct() */
@@ -481,6 +491,9 @@ H5D__contig_init(H5F_t H5_ATTR_UNUSED *f, const H5D_t *dset, hid_t H5_ATTR_UNUSE
     else
         dset->shared->cache.contig.sieve_buf_size = tmp_sieve_buf_size;
 
+    /* Start with a single data sieve window */
+    dset->shared->cache.contig.sieve_max_nwins = 1;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_init() */
@@ -533,7 +546,7 @@ H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
     /* Sanity checks */
     HDassert(shared_dset);
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
+    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_nwins > 0)
 } /* end H5D__contig_is_data_cached() */
 
 /*-------------------------------------------------------------------------
@@ -668,6 +681,221 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_find
+ *
+ * Purpose:	Move the data sieve window to use for a sequence of LEN
+ *		bytes at ADDR to the front of the dataset's windows.
+ *
+ *		A window holding the whole sequence is used as it is, as
+ *		is a dirty first window that a write can be added onto.
+ *		Otherwise a window is put in front for the caller to load:
+ *		an unused one, while the dataset may have more windows, or
+ *		else the least recently used one.
+ *
+ *		The dataset starts with a single window, which sequential
+ *		access needs.  Another window is allowed each time a
+ *		sequence lands in a window that was replaced recently,
+ *		which is what interleaved access to distant regions looks
+ *		like, up to H5D_SIEVE_MAX_NWINS.  One is taken away again
+ *		when H5D_SIEVE_PERIOD windows are loaded without a hit on
+ *		any window but the first.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_find(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len,
+                       hbool_t write)
+{
+    H5D_sieve_win_t *win = dset_contig->sieve_win; /* Data sieve windows */
+    H5D_sieve_win_t  tmp_win;                      /* Window being moved to the front */
+    haddr_t          end = addr + len;             /* End of the sequence */
+    unsigned         u;                            /* Local index variable */
+    herr_t           ret_value = SUCCEED;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sequences that don't fit in a window are read or written directly */
+    if (len > dset_contig->sieve_buf_size)
+        HGOTO_DONE(SUCCEED)
+    HDassert(dset_contig->sieve_max_nwins > 0);
+
+    /* Look for a window holding the whole sequence */
+    for (u = 0; u < dset_contig->sieve_nwins; u++)
+        if (addr >= win[u].loc && end <= (win[u].loc + win[u].size)) {
+            /* Move it to the front */
+            if (u > 0) {
+                tmp_win = win[u];
+                HDmemmove(win + 1, win, u * sizeof(H5D_sieve_win_t));
+                win[0] = tmp_win;
+                dset_contig->sieve_nhits++;
+            } /* end if */
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+    /* Writes are added onto the front window when they're next to it */
+    if (write && dset_contig->sieve_nwins > 0 && win[0].dirty &&
+        (end == win[0].loc || addr == (win[0].loc + win[0].size)) &&
+        (len + win[0].size) <= dset_contig->sieve_buf_size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allow another window if the sequence was in a window replaced recently */
+    if (dset_contig->sieve_max_nwins < H5D_SIEVE_MAX_NWINS)
+        for (u = 0; u < dset_contig->sieve_nevicted; u++)
+            if (addr >= dset_contig->sieve_evicted[u] &&
+                end <= (dset_contig->sieve_evicted[u] + dset_contig->sieve_buf_size)) {
+                dset_contig->sieve_max_nwins++;
+                break;
+            } /* end if */
+
+    /* Allow one less window if the other windows haven't been hit for a while */
+    if (++dset_contig->sieve_nloads >= H5D_SIEVE_PERIOD) {
+        if (0 == dset_contig->sieve_nhits && dset_contig->sieve_max_nwins > 1)
+            dset_contig->sieve_max_nwins--;
+        dset_contig->sieve_nloads = 0;
+        dset_contig->sieve_nhits  = 0;
+    } /* end if */
+    while (dset_contig->sieve_nwins > dset_contig->sieve_max_nwins)
+        if (H5D__contig_sieve_evict(f_sh, dset_contig, dset_contig->sieve_nwins - 1) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict data sieve window")
+
+    /* Put a window in front for the sequence */
+    if (dset_contig->sieve_nwins < dset_contig->sieve_max_nwins) {
+        /* Start using another window */
+        HDmemmove(win + 1, win, dset_contig->sieve_nwins * sizeof(H5D_sieve_win_t));
+        win[0].buf   = NULL;
+        win[0].loc   = HADDR_UNDEF;
+        win[0].size  = 0;
+        win[0].dirty = FALSE;
+        dset_contig->sieve_nwins++;
+    } /* end if */
+    else {
+        u = dset_contig->sieve_nwins - 1;
+
+        /* Remember where the least recently used window was, for when it's needed again */
+        HDmemmove(dset_contig->sieve_evicted + 1, dset_contig->sieve_evicted,
+                  (H5D_SIEVE_MAX_NWINS - 1) * sizeof(haddr_t));
+        dset_contig->sieve_evicted[0] = win[u].loc;
+        if (dset_contig->sieve_nevicted < H5D_SIEVE_MAX_NWINS)
+            dset_contig->sieve_nevicted++;
+
+        /* Move it to the front, for the caller to replace */
+        tmp_win = win[u];
+        HDmemmove(win + 1, win, u * sizeof(H5D_sieve_win_t));
+        win[0] = tmp_win;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_release
+ *
+ * Purpose:	Write the data sieve windows from FIRST on that overlap
+ *		SIZE bytes at ADDR to the file, if they're dirty, and
+ *		evict them too when EVICT is set.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_release(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, unsigned first, haddr_t addr,
+                          hsize_t size, hbool_t evict)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (u = dset_contig->sieve_nwins; u > first; u--) {
+        H5D_sieve_win_t *win = &dset_contig->sieve_win[u - 1]; /* Window to check */
+
+        if (win->buf && win->loc < (addr + size) && addr < (win->loc + win->size)) {
+            if (evict) {
+                if (H5D__contig_sieve_evict(f_sh, dset_contig, u - 1) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict data sieve window")
+            } /* end if */
+            else if (win->dirty) {
+                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+                win->dirty = FALSE;
+            } /* end if */
+        }     /* end if */
+    }         /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_evict
+ *
+ * Purpose:	Write data sieve window IDX to the file, if it's dirty,
+ *		and stop using it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, unsigned idx)
+{
+    H5D_sieve_win_t *win       = &dset_contig->sieve_win[idx]; /* Window to evict */
+    herr_t           ret_value = SUCCEED;                      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(idx < dset_contig->sieve_nwins);
+
+    /* Flush the window, if it's dirty */
+    if (win->dirty) {
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+        win->dirty = FALSE;
+    } /* end if */
+
+    /* Release the window's buffer and close the gap */
+    if (win->buf)
+        win->buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->buf);
+    HDmemmove(win, win + 1, (dset_contig->sieve_nwins - idx - 1) * sizeof(H5D_sieve_win_t));
+    dset_contig->sieve_nwins--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_sieve_free
+ *
+ * Purpose:	Release all of a dataset's data sieve windows, without
+ *		writing them to the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_sieve_free(H5D_rdcdc_t *dset_contig)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset_contig);
+
+    for (u = 0; u < dset_contig->sieve_nwins; u++)
+        if (dset_contig->sieve_win[u].buf)
+            dset_contig->sieve_win[u].buf =
+                (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset_contig->sieve_win[u].buf);
+    dset_contig->sieve_nwins = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_sieve_free() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -688,12 +916,12 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig; /* Contiguous storage info for this I/O operation */
-    unsigned char *buf;      /* Pointer to buffer to fill */
-    haddr_t        addr;     /* Actual address to read */
+        udata->store_contig;  /* Contiguous storage info for this I/O operation */
+    H5D_sieve_win_t *win;     /* Data sieve window for this sequence */
+    unsigned char *  buf;     /* Pointer to buffer to fill */
+    haddr_t          addr;    /* Actual address to read */
     haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
     haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
     haddr_t rel_eoa;                                            /* Relative end of file address	*/
     hsize_t max_data;                                           /* Actual maximum size of data to cache */
     hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
@@ -701,33 +929,37 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these value */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->rbuf + src_off;
 
-    /* Check if the sieve buffer is allocated yet */
-    if (NULL == dset_contig->sieve_buf) {
+    /* Bring the window for this sequence to the front */
+    if (H5D__contig_sieve_find(f_sh, dset_contig, addr, len, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't find data sieve window")
+    win = &dset_contig->sieve_win[0];
+
+    /* Stash local copies of these value */
+    if (dset_contig->sieve_nwins > 0 && win->buf != NULL) {
+        sieve_start = win->loc;
+        sieve_end   = sieve_start + win->size;
+    } /* end if */
+
+    /* Check if the window is allocated yet */
+    if (0 == dset_contig->sieve_nwins || NULL == win->buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
             if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
+            /* Allocate room for the data sieve window */
+            if (NULL == (win->buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
 
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
+            /* Determine the new window size & location */
+            win->loc = addr;
 
             /* Make certain we don't read off the end of the file */
             if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
@@ -736,51 +968,43 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
             /* Set up the buffer parameters */
             max_data = store_contig->dset_size - dst_off;
 
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+            /* Compute the size of the window */
+            min = MIN3(rel_eoa - win->loc, max_data, dset_contig->sieve_buf_size);
+            H5_CHECKED_ASSIGN(win->size, size_t, min, hsize_t);
 
-            /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
+            /* Write out the other windows covering the same data */
+            if (H5D__contig_sieve_release(f_sh, dset_contig, 1, win->loc, (hsize_t)win->size, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
+
+            /* Read the new window */
+            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
             /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+            H5MM_memcpy(buf, win->buf, len);
 
-            /* Reset sieve buffer dirty flag */
-            dset_contig->sieve_dirty = FALSE;
+            /* Reset window dirty flag */
+            win->dirty = FALSE;
         } /* end else */
     }     /* end if */
     else {
         /* Compute end of sequence to retrieve */
         contig_end = addr + len - 1;
 
-        /* If entire read is within the sieve buffer, read it from the buffer */
+        /* If entire read is within the window, read it from the buffer */
         if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+            unsigned char *base_sieve_buf = win->buf + (addr - sieve_start);
 
             /* Grab the data out of the buffer */
             H5MM_memcpy(buf, base_sieve_buf, len);
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
+        /* Entire request is not within this data sieve window */
         else {
             /* Check if we can actually hold the I/O request in the sieve buffer */
             if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-                }     /* end if */
+                /* Flush any dirty windows overlapping the request */
+                if (H5D__contig_sieve_release(f_sh, dset_contig, 0, addr, (hsize_t)len, FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
 
                 /* Read directly into the user's buffer */
                 if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
@@ -788,45 +1012,47 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
             } /* end if */
             /* Element size fits within the buffer size */
             else {
-                /* Flush the sieve buffer if it's dirty */
-                if (dset_contig->sieve_dirty) {
+                /* Flush the window if it's dirty */
+                if (win->dirty) {
                     /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
+                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
-                    /* Reset sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = FALSE;
+                    /* Reset window dirty flag */
+                    win->dirty = FALSE;
                 } /* end if */
 
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
+                /* Determine the new window size & location */
+                win->loc = addr;
 
                 /* Make certain we don't read off the end of the file */
                 if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
 
-                /* Only need this when resizing sieve buffer */
+                /* Only need this when resizing the window */
                 max_data = store_contig->dset_size - dst_off;
 
-                /* Compute the size of the sieve buffer.
+                /* Compute the size of the window.
                  * Don't read off the end of the file, don't read past
                  * the end of the data element, and don't read more than
                  * the buffer size.
                  */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+                min = MIN3(rel_eoa - win->loc, max_data, dset_contig->sieve_buf_size);
+                H5_CHECKED_ASSIGN(win->size, size_t, min, hsize_t);
+
+                /* Write out the other windows covering the same data */
+                if (H5D__contig_sieve_release(f_sh, dset_contig, 1, win->loc, (hsize_t)win->size, TRUE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
 
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                /* Read the new window */
+                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
                 /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+                H5MM_memcpy(buf, win->buf, len);
 
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = FALSE;
+                /* Reset window dirty flag */
+                win->dirty = FALSE;
             } /* end else */
         }     /* end else */
     }         /* end else */
@@ -855,9 +1081,14 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                              (udata->rbuf + src_off)) < 0)
+    /* Put the read off to the batch, or read the data now */
+    if (udata->batch) {
+        if (H5D__io_batch_add(udata->batch, (udata->dset_addr + dst_off), len, (udata->rbuf + src_off),
+                              NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTAPPEND, FAIL, "can't add read to batch")
+    } /* end if */
+    else if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
+                                   (udata->rbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
@@ -900,8 +1131,8 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
-    /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    /* Check if data sieving is enabled (batched reads skip the sieve buffer) */
+    if (!io_info->batch && H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -923,6 +1154,7 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
         udata.f_sh      = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.rbuf      = (unsigned char *)io_info->u.rbuf;
+        udata.batch     = io_info->batch;
 
         /* Call generic sequence operation routine */
         if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
@@ -956,6 +1188,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
         udata->store_contig;   /* Contiguous storage info for this I/O operation */
+    H5D_sieve_win_t *    win;  /* Data sieve window for this sequence */
     const unsigned char *buf;  /* Pointer to buffer to fill */
     haddr_t              addr; /* Actual address to read */
     haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
@@ -968,37 +1201,38 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these values */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
-    /* No data sieve buffer yet, go allocate one */
-    if (NULL == dset_contig->sieve_buf) {
+    /* Bring the window for this sequence to the front */
+    if (H5D__contig_sieve_find(f_sh, dset_contig, addr, len, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't find data sieve window")
+    win = &dset_contig->sieve_win[0];
+
+    /* Stash local copies of these values */
+    if (dset_contig->sieve_nwins > 0 && win->buf != NULL) {
+        sieve_start = win->loc;
+        sieve_size  = win->size;
+        sieve_end   = sieve_start + sieve_size;
+    } /* end if */
+
+    /* No data sieve window yet, go allocate one */
+    if (0 == dset_contig->sieve_nwins || NULL == win->buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
             if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
         } /* end if */
         else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
+            /* Allocate room for the data sieve window */
+            if (NULL == (win->buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
 
-            /* Clear memory */
-            if (dset_contig->sieve_size > len)
-                HDmemset(dset_contig->sieve_buf + len, 0, (dset_contig->sieve_size - len));
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
+            /* Determine the new window size & location */
+            win->loc = addr;
 
             /* Make certain we don't read off the end of the file */
             if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
@@ -1007,66 +1241,49 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
             /* Set up the buffer parameters */
             max_data = store_contig->dset_size - dst_off;
 
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+            /* Compute the size of the window */
+            min = MIN3(rel_eoa - win->loc, max_data, dset_contig->sieve_buf_size);
+            H5_CHECKED_ASSIGN(win->size, size_t, min, hsize_t);
+
+            /* Write out the other windows covering the same data */
+            if (H5D__contig_sieve_release(f_sh, dset_contig, 1, win->loc, (hsize_t)win->size, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
 
             /* Check if there is any point in reading the data from the file */
-            if (dset_contig->sieve_size > len) {
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+            if (win->size > len) {
+                /* Read the new window */
+                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
 
             /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
+            H5MM_memcpy(win->buf, buf, len);
 
-            /* Stash local copies of these values */
-            sieve_start = dset_contig->sieve_loc;
-            sieve_size  = dset_contig->sieve_size;
-            sieve_end   = sieve_start + sieve_size;
+            /* Set window dirty flag */
+            win->dirty = TRUE;
         } /* end else */
     }     /* end if */
     else {
         /* Compute end of sequence to retrieve */
         contig_end = addr + len - 1;
 
-        /* If entire write is within the sieve buffer, write it to the buffer */
+        /* If entire write is within the window, write it to the buffer */
         if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+            unsigned char *base_sieve_buf = win->buf + (addr - sieve_start);
 
-            /* Put the data into the sieve buffer */
+            /* Put the data into the window */
             H5MM_memcpy(base_sieve_buf, buf, len);
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
+            /* Set window dirty flag */
+            win->dirty = TRUE;
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
+        /* Entire request is not within this data sieve window */
         else {
             /* Check if we can actually hold the I/O request in the sieve buffer */
             if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-
-                    /* Force the sieve buffer to be re-read the next time */
-                    dset_contig->sieve_loc  = HADDR_UNDEF;
-                    dset_contig->sieve_size = 0;
-                } /* end if */
+                /* Flush and drop any windows overlapping the request, so they're re-read the next time */
+                if (H5D__contig_sieve_release(f_sh, dset_contig, 0, addr, (hsize_t)len, TRUE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
 
                 /* Write directly from the user's buffer */
                 if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
@@ -1074,75 +1291,82 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
             } /* end if */
             /* Element size fits within the buffer size */
             else {
-                /* Check if it is possible to (exactly) prepend or append to existing (dirty) sieve buffer */
+                /* Check if it is possible to (exactly) prepend or append to existing (dirty) window */
                 if (((addr + len) == sieve_start || addr == sieve_end) &&
-                    (len + sieve_size) <= dset_contig->sieve_buf_size && dset_contig->sieve_dirty) {
-                    /* Prepend to existing sieve buffer */
+                    (len + sieve_size) <= dset_contig->sieve_buf_size && win->dirty) {
+                    /* Drop the other windows covering the new data */
+                    if (H5D__contig_sieve_release(f_sh, dset_contig, 1, addr, (hsize_t)len, TRUE) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
+
+                    /* Prepend to existing window */
                     if ((addr + len) == sieve_start) {
                         /* Move existing sieve information to correct location */
-                        HDmemmove(dset_contig->sieve_buf + len, dset_contig->sieve_buf,
-                                  dset_contig->sieve_size);
+                        HDmemmove(win->buf + len, win->buf, win->size);
 
-                        /* Copy in new information (must be first in sieve buffer) */
-                        H5MM_memcpy(dset_contig->sieve_buf, buf, len);
+                        /* Copy in new information (must be first in window) */
+                        H5MM_memcpy(win->buf, buf, len);
 
-                        /* Adjust sieve location */
-                        dset_contig->sieve_loc = addr;
+                        /* Adjust window location */
+                        win->loc = addr;
 
                     } /* end if */
-                    /* Append to existing sieve buffer */
+                    /* Append to existing window */
                     else {
                         /* Copy in new information */
-                        H5MM_memcpy(dset_contig->sieve_buf + sieve_size, buf, len);
+                        H5MM_memcpy(win->buf + sieve_size, buf, len);
                     } /* end else */
 
-                    /* Adjust sieve size */
-                    dset_contig->sieve_size += len;
+                    /* Adjust window size */
+                    win->size += len;
                 } /* end if */
-                /* Can't add the new data onto the existing sieve buffer */
+                /* Can't add the new data onto the existing window */
                 else {
-                    /* Flush the sieve buffer if it's dirty */
-                    if (dset_contig->sieve_dirty) {
+                    /* Flush the window if it's dirty */
+                    if (win->dirty) {
                         /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
+                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size, win->buf) <
+                            0)
                             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
+                        /* Reset window dirty flag */
+                        win->dirty = FALSE;
                     } /* end if */
 
-                    /* Determine the new sieve buffer size & location */
-                    dset_contig->sieve_loc = addr;
+                    /* Determine the new window size & location */
+                    win->loc = addr;
 
                     /* Make certain we don't read off the end of the file */
                     if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
 
-                    /* Only need this when resizing sieve buffer */
+                    /* Only need this when resizing the window */
                     max_data = store_contig->dset_size - dst_off;
 
-                    /* Compute the size of the sieve buffer.
+                    /* Compute the size of the window.
                      * Don't read off the end of the file, don't read past
                      * the end of the data element, and don't read more than
                      * the buffer size.
                      */
-                    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
+                    min = MIN3(rel_eoa - win->loc, max_data, dset_contig->sieve_buf_size);
+                    H5_CHECKED_ASSIGN(win->size, size_t, min, hsize_t);
+
+                    /* Write out the other windows covering the same data */
+                    if (H5D__contig_sieve_release(f_sh, dset_contig, 1, win->loc, (hsize_t)win->size, TRUE) <
+                        0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to release data sieve windows")
 
                     /* Check if there is any point in reading the data from the file */
-                    if (dset_contig->sieve_size > len) {
-                        /* Read the new sieve buffer */
-                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                                  dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
+                    if (win->size > len) {
+                        /* Read the new window */
+                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
                     } /* end if */
 
                     /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                    H5MM_memcpy(dset_contig->sieve_buf, buf, len);
+                    H5MM_memcpy(win->buf, buf, len);
 
-                    /* Set sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = TRUE;
+                    /* Set window dirty flag */
+                    win->dirty = TRUE;
                 } /* end else */
             }     /* end else */
         }         /* end else */
@@ -1173,9 +1397,14 @@ H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udat
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if (H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                               (udata->wbuf + src_off)) < 0)
+    /* Put the write off to the batch, or write the data now */
+    if (udata->batch) {
+        if (H5D__io_batch_add(udata->batch, (udata->dset_addr + dst_off), len, NULL,
+                              (udata->wbuf + src_off)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTAPPEND, FAIL, "can't add write to batch")
+    } /* end if */
+    else if (H5F_shared_block_write(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
+                                    (udata->wbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
@@ -1218,8 +1447,8 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
-    /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    /* Check if data sieving is enabled (batched writes skip the sieve buffer) */
+    if (!io_info->batch && H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1241,6 +1470,7 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
         udata.f_sh      = io_info->f_sh;
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.wbuf      = (const unsigned char *)io_info->u.wbuf;
+        udata.batch     = io_info->batch;
 
         /* Call generic sequence operation routine */
         if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
@@ -1327,10 +1557,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     hbool_t       fix_ref     = FALSE; /* Flag to indicate that ref values should be fixed */
     H5D_shared_t *shared_fo =
         (H5D_shared_t *)cpy_info->shared_fo; /* Pointer to the shared struct for dataset object */
-    hbool_t try_sieve   = FALSE;             /* Try to get data from the sieve buffer */
-    haddr_t sieve_start = HADDR_UNDEF;       /* Start location of sieve buffer */
-    haddr_t sieve_end   = HADDR_UNDEF;       /* End locations of sieve buffer */
-    herr_t  ret_value   = SUCCEED;           /* Return value */
+    hbool_t                try_sieve = FALSE;   /* Try to get data from the sieve buffer */
+    const H5D_sieve_win_t *sieve_win;           /* Sieve window holding the data to copy */
+    herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1456,11 +1685,8 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
 
     /* If data sieving is enabled and the dataset is open in the file,
        set up to copy data out of the sieve buffer if deemed possible later */
-    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_buf) {
-        try_sieve   = TRUE;
-        sieve_start = shared_fo->cache.contig.sieve_loc;
-        sieve_end   = sieve_start + shared_fo->cache.contig.sieve_size;
-    }
+    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_nwins > 0)
+        try_sieve = TRUE;
 
     while (total_src_nbytes > 0) {
         /* Check if we should reduce the number of bytes to transfer */
@@ -1487,9 +1713,22 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
                 dst_nbytes = mem_nbytes = src_nbytes;
         } /* end if */
 
-        /* If the entire copy is within the sieve buffer, copy data from the sieve buffer */
-        if (try_sieve && (addr_src >= sieve_start) && ((addr_src + src_nbytes - 1) < sieve_end)) {
-            unsigned char *base_sieve_buf = shared_fo->cache.contig.sieve_buf + (addr_src - sieve_start);
+        /* Look for a sieve window holding the entire copy */
+        sieve_win = NULL;
+        if (try_sieve) {
+            const H5D_sieve_win_t *win = shared_fo->cache.contig.sieve_win; /* Data sieve windows */
+            unsigned               u;                                      /* Local index variable */
+
+            for (u = 0; u < shared_fo->cache.contig.sieve_nwins; u++)
+                if (addr_src >= win[u].loc && (addr_src + src_nbytes) <= (win[u].loc + win[u].size)) {
+                    sieve_win = &win[u];
+                    break;
+                } /* end if */
+        }         /* end if */
+
+        /* If the entire copy is within a sieve window, copy data from the window */
+        if (sieve_win) {
+            unsigned char *base_sieve_buf = sieve_win->buf + (addr_src - sieve_win->loc);
 
             H5MM_memcpy(buf, base_sieve_buf, src_nbytes);
         }
@@ -116,9 +116,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_chunk_info_t struct */
 H5FL_EXTERN(H5D_chunk_info_t);
 
@@ -219,6 +216,8 @@ H5D__init_package(void)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve fill value")
     if (H5P_get(def_dcpl, H5O_CRT_PIPELINE_NAME, &H5D_def_dset.dcpl_cache.pline) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve pipeline filter")
+    if (H5P_get(def_dcpl, H5D_CRT_MIN_FILTER_RATIO_NAME, &H5D_def_dset.dcpl_cache.min_filter_ratio) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve minimum compression ratio")
 
     /* Mark "top" of interface as initialized, too */
     H5D_top_package_initialize_s = TRUE;
@@ -403,6 +402,81 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__create_named() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__create_named_multi
+ *
+ * Purpose:     Internal routine to create COUNT new "named" datasets in
+ *              the group at LOC, with their object headers next to each
+ *              other in the file and their links inserted in one batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__create_named_multi(const H5G_loc_t *loc, size_t count, const char *name[], const hid_t type_id[],
+                        const H5S_t *space[], hid_t lcpl_id, const hid_t dcpl_id[], hid_t dapl_id,
+                        H5D_t *dset[] /*out*/)
+{
+    H5O_obj_create_t *ocrt_info = NULL;    /* Information for object creation */
+    H5D_obj_create_t *dcrt_info = NULL;    /* Information for dataset creation */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(name);
+    HDassert(type_id);
+    HDassert(space);
+    HDassert(lcpl_id != H5P_DEFAULT);
+    HDassert(dcpl_id);
+    HDassert(dapl_id != H5P_DEFAULT);
+    HDassert(dset);
+
+    /* Allocate the creation information */
+    if (NULL == (ocrt_info = (H5O_obj_create_t *)H5MM_calloc(count * sizeof(H5O_obj_create_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for creation information")
+    if (NULL == (dcrt_info = (H5D_obj_create_t *)H5MM_malloc(count * sizeof(H5D_obj_create_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed for creation information")
+
+    for (u = 0; u < count; u++) {
+        /* Set up dataset creation info */
+        dcrt_info[u].type_id = type_id[u];
+        dcrt_info[u].space   = space[u];
+        dcrt_info[u].dcpl_id = dcpl_id[u];
+        dcrt_info[u].dapl_id = dapl_id;
+
+        /* Set up object creation information */
+        ocrt_info[u].obj_type = H5O_TYPE_DATASET;
+        ocrt_info[u].crt_info = &dcrt_info[u];
+        ocrt_info[u].new_obj  = NULL;
+    } /* end for */
+
+    /* Create the new datasets and link them to their parent group */
+    if (H5L_link_object_multi(loc, count, name, ocrt_info, lcpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create and link to datasets")
+
+    /* Set the datasets to return */
+    for (u = 0; u < count; u++) {
+        HDassert(ocrt_info[u].new_obj);
+        dset[u] = (H5D_t *)ocrt_info[u].new_obj;
+    } /* end for */
+
+done:
+    /* Release the datasets created, on failure */
+    if (ret_value < 0 && ocrt_info)
+        for (u = 0; u < count; u++)
+            if (ocrt_info[u].new_obj && H5D_close((H5D_t *)ocrt_info[u].new_obj) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataset")
+
+    H5MM_xfree(dcrt_info);
+    H5MM_xfree(ocrt_info);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_named_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_space_status
  *
@@ -1312,6 +1386,9 @@ H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id, hid_t
         if (H5P_get(dc_plist, H5D_CRT_EXT_FILE_LIST_NAME, efl) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't retrieve external file list")
         efl_copied = TRUE;
+        if (H5P_get(dc_plist, H5D_CRT_MIN_FILTER_RATIO_NAME, &new_dset->shared->dcpl_cache.min_filter_ratio) <
+            0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't retrieve minimum compression ratio")
 
         if (FALSE == ignore_filters) {
             /* Check that chunked layout is used if filters are enabled */
@@ -1643,6 +1720,61 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_open() */
 
+/*
+ *-------------------------------------------------------------------------
+ * Function: H5D__reopen
+ *
+ * Purpose:  Opens another reference to an open dataset, sharing its
+ *           information.  Unlike H5D_open(), the access properties of
+ *           the current API context aren't checked against the open
+ *           dataset's.  Released with H5D_close().
+ *
+ * Return:   Success:    Pointer to the new dataset struct
+ *           Failure:    NULL
+ *-------------------------------------------------------------------------
+ */
+H5D_t *
+H5D__reopen(const H5D_t *dset)
+{
+    H5D_t *dataset   = NULL; /* New dataset struct */
+    H5D_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(dset && dset->oloc.file && dset->shared);
+
+    /* Allocate the dataset structure */
+    if (NULL == (dataset = H5FL_CALLOC(H5D_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the object location and group hier. path */
+    if (H5O_loc_copy_deep(&(dataset->oloc), &(dset->oloc)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy object location")
+    if (H5G_name_copy(&(dataset->path), &(dset->path), H5_COPY_DEEP) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "can't copy path")
+
+    /* Increment object count for the object in the top file */
+    if (H5FO_top_incr(dataset->oloc.file, dataset->oloc.addr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, NULL, "can't increment object count")
+
+    /* Point to shared info */
+    dataset->shared = dset->shared;
+    dataset->shared->fo_count++;
+
+    /* Set the dataset to return */
+    ret_value = dataset;
+
+done:
+    if (ret_value == NULL && dataset) {
+        H5O_loc_free(&(dataset->oloc));
+        H5G_name_free(&(dataset->path));
+        dataset = H5FL_FREE(H5D_t, dataset);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__reopen() */
+
 /*
  *-------------------------------------------------------------------------
  * Function: H5D__flush_append_setup
@@ -1933,12 +2065,15 @@ H5D_close(H5D_t *dataset)
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                if (H5D__contig_sieve_free(&dataset->shared->cache.contig) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free data sieve buffer")
                 break;
 
             case H5D_CHUNKED:
+                /* Release any chunk mapping kept for reuse */
+                if (H5D__chunk_map_cache_reset(&dataset->shared->cache.chunk) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release kept chunk mapping")
+
                 /* Check for skip list for iterating over chunks during I/O to close */
                 if (dataset->shared->cache.chunk.sel_chunks) {
                     HDassert(H5SL_count(dataset->shared->cache.chunk.sel_chunks) == 0);
@@ -1975,6 +2110,8 @@ H5D_close(H5D_t *dataset)
                     /* Close source dataset */
                     if (dataset->shared->layout.storage.u.virt.list[i].source_dset.dset) {
                         HDassert(dataset->shared->layout.storage.u.virt.list[i].source_dset.dset != dataset);
+                        H5D__virtual_src_lru_remove(
+                            &dataset->shared->layout.storage.u.virt.list[i].source_dset);
                         if (H5D_close(dataset->shared->layout.storage.u.virt.list[i].source_dset.dset) < 0)
                             HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
                         dataset->shared->layout.storage.u.virt.list[i].source_dset.dset = NULL;
@@ -1985,6 +2122,8 @@ H5D_close(H5D_t *dataset)
                         if (dataset->shared->layout.storage.u.virt.list[i].sub_dset[j].dset) {
                             HDassert(dataset->shared->layout.storage.u.virt.list[i].sub_dset[j].dset !=
                                      dataset);
+                            H5D__virtual_src_lru_remove(
+                                &dataset->shared->layout.storage.u.virt.list[i].sub_dset[j]);
                             if (H5D_close(dataset->shared->layout.storage.u.virt.list[i].sub_dset[j].dset) <
                                 0)
                                 HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL,
@@ -2127,12 +2266,15 @@ H5D_mult_refresh_close(hid_t dset_id)
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                if (H5D__contig_sieve_free(&dataset->shared->cache.contig) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free data sieve buffer")
                 break;
 
             case H5D_CHUNKED:
+                /* Release any chunk mapping kept for reuse */
+                if (H5D__chunk_map_cache_reset(&dataset->shared->cache.chunk) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release kept chunk mapping")
+
                 /* Check for skip list for iterating over chunks during I/O to close */
                 if (dataset->shared->cache.chunk.sel_chunks) {
                     HDassert(H5SL_count(dataset->shared->cache.chunk.sel_chunks) == 0);
@@ -2672,7 +2814,7 @@ H5D__vlen_get_buf_size_cb(void H5_ATTR_UNUSED *elem, hid_t type_id, unsigned H5_
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, H5_ITER_ERROR, "can't select point")
 
     /* Read in the point (with the custom VL memory allocator) */
-    if (H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace,
+    if (H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace, NULL,
                   vlen_bufsize->common.fl_tbuf) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, H5_ITER_ERROR, "can't read point")
 
@@ -3206,27 +3348,31 @@ done:
 herr_t
 H5D__flush_sieve_buf(H5D_t *dataset)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
     /* Check args */
     HDassert(dataset);
 
-    /* Flush the raw data buffer, if we have a dirty one */
-    if (dataset->shared->cache.contig.sieve_buf && dataset->shared->cache.contig.sieve_dirty) {
-        HDassert(dataset->shared->layout.type !=
-                 H5D_COMPACT); /* We should never have a sieve buffer for compact storage */
+    /* Flush the raw data buffer windows that are dirty */
+    for (u = 0; u < dataset->shared->cache.contig.sieve_nwins; u++) {
+        H5D_sieve_win_t *win = &dataset->shared->cache.contig.sieve_win[u]; /* Data sieve window */
 
-        /* Write dirty data sieve buffer to file */
-        if (H5F_shared_block_write(
-                H5F_SHARED(dataset->oloc.file), H5FD_MEM_DRAW, dataset->shared->cache.contig.sieve_loc,
-                dataset->shared->cache.contig.sieve_size, dataset->shared->cache.contig.sieve_buf) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+        if (win->buf && win->dirty) {
+            HDassert(dataset->shared->layout.type !=
+                     H5D_COMPACT); /* We should never have a sieve buffer for compact storage */
 
-        /* Reset sieve buffer dirty flag */
-        dataset->shared->cache.contig.sieve_dirty = FALSE;
-    } /* end if */
+            /* Write dirty data sieve window to file */
+            if (H5F_shared_block_write(H5F_SHARED(dataset->oloc.file), H5FD_MEM_DRAW, win->loc, win->size,
+                                       win->buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+            /* Reset sieve window dirty flag */
+            win->dirty = FALSE;
+        } /* end if */
+    }     /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
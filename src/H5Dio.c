@@ -35,6 +35,16 @@
 /* Local Macros */
 /****************/
 
+/* Initial number of pieces allocated for a batch of raw data I/O */
+#define H5D_IO_BATCH_INIT_NPIECES 64
+
+/* Bounds on the type conversion buffer size chosen for a transfer */
+#define H5D_TEMP_BUF_MIN_SIZE (64 * 1024)
+#define H5D_TEMP_BUF_MAX_SIZE (8 * 1024 * 1024)
+
+/* Fewest strips a transfer with pipelined conversion is split into */
+#define H5D_TEMP_BUF_PIPE_NSTRIPS 4
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -46,14 +56,22 @@
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *store,
                                H5D_io_info_t *io_info);
-static herr_t H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
+static herr_t H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, hsize_t nelmts,
                                  H5D_type_info_t *type_info);
+static size_t H5D__typeinfo_buf_size(const H5D_t *dset, const H5D_type_info_t *type_info, hsize_t nelmts);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset, const H5S_t *file_space,
                                  const H5S_t *mem_space, const H5D_type_info_t *type_info);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Batched raw data I/O routines */
+static herr_t H5D__io_batch_prep(H5D_io_batch_t *batch, H5D_t *dsets[], size_t idx, size_t *first,
+                                 H5D_io_batch_t **dset_batch);
+static int    H5D__io_batch_cmp(const void *_piece1, const void *_piece2);
+static int    H5D__io_batch_seq_cmp(const void *_piece1, const void *_piece2);
+static herr_t H5D__io_batch_flush(H5D_io_batch_t *batch);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -74,6 +92,10 @@ H5FL_DEFINE(H5D_chunk_map_t);
  * Purpose:	Reads (part of) a DATASET into application memory BUF. See
  *		H5Dread() for complete details.
  *
+ *		When BATCH is not NULL, raw data that is read straight
+ *		into BUF is put off to BATCH instead of being read from
+ *		the file; it is read when the batch is flushed.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -83,7 +105,7 @@ H5FL_DEFINE(H5D_chunk_map_t);
  */
 herr_t
 H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-          void *buf /*out*/)
+          H5D_io_batch_t *batch, void *buf /*out*/)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -102,11 +124,13 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
                                                   /* Note that if this variable is used, the        */
                                                   /* projected mem space must be discarded at the   */
                                                   /* end of the function to avoid a memory leak.    */
-    H5D_storage_t store;                          /* union of EFL and chunk pointer in file space */
-    hsize_t       nelmts;                         /* total number of elmts	*/
-    hbool_t       io_op_init = FALSE;             /* Whether the I/O op has been initialized */
-    char          fake_char;                      /* Temporary variable for NULL buffer pointers */
-    herr_t        ret_value = SUCCEED;            /* Return value	*/
+    H5D_storage_t     store;                      /* union of EFL and chunk pointer in file space */
+    hsize_t           nelmts;                     /* total number of elmts	*/
+    hbool_t           io_op_init = FALSE;         /* Whether the I/O op has been initialized */
+    H5D_vlen_arena_t *vlen_arena = NULL;          /* Application's arena for VL data */
+    H5T_vlen_arena_t *arena      = NULL;          /* Arena taking the VL data read */
+    char              fake_char;                  /* Temporary variable for NULL buffer pointers */
+    herr_t            ret_value = SUCCEED;        /* Return value	*/
 
     FUNC_ENTER_PACKAGE_TAG(dataset->oloc.addr)
 
@@ -116,10 +140,32 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     HDassert(mem_space);
 
     /* Set up datatype info for operation */
-    if (H5D__typeinfo_init(dataset, mem_type_id, FALSE, &type_info) < 0)
+    if (H5D__typeinfo_init(dataset, mem_type_id, FALSE, H5S_GET_SELECT_NPOINTS(file_space), &type_info) <
+        0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
     type_info_init = TRUE;
 
+    /* Gather any VL data read into the application's arena, unless the
+     * caller (H5D__read_multi, or the read of a virtual dataset) has already
+     * bound an arena that takes it
+     */
+    if (H5T_detect_class(type_info.mem_type, H5T_VLEN, FALSE) > 0) {
+        H5T_vlen_alloc_info_t vl_alloc_info; /* VL allocation info */
+
+        if (H5CX_get_vlen_alloc_info(&vl_alloc_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve VL datatype alloc info")
+        if (NULL == vl_alloc_info.arena && H5CX_get_vlen_arena(&vlen_arena) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get VL data arena")
+        if (vlen_arena) {
+            if (vlen_arena->buf || vlen_arena->offset)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VL data arena already holds data")
+            if (NULL == (arena = H5T_vlen_arena_create()))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create VL data arena")
+            if (H5CX_set_vlen_arena(arena) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set VL data arena")
+        } /* end if */
+    }     /* end if */
+
 #ifdef H5_HAVE_PARALLEL
     /* Check for non-MPI-based VFD */
     if (!(H5F_HAS_FEATURE(dataset->oloc.file, H5FD_FEAT_HAS_MPI))) {
@@ -235,6 +281,15 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     if (H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
 
+    /* Put the reads off to the batch, when reading straight into the application's buffer */
+    if (batch && type_info.is_xform_noop && type_info.is_conv_noop) {
+        /* The batch bypasses the sieve buffer, so make sure the file has its data */
+        if (H5D__flush_sieve_buf(dataset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+
+        io_info.batch = batch;
+    } /* end if */
+
     /* Sanity check that space is allocated, if there are elements */
     if (nelmts > 0)
         HDassert((*dataset->shared->layout.ops->is_space_alloc)(&dataset->shared->layout.storage) ||
@@ -263,6 +318,24 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
+    /* Hand the VL data read over to the application */
+    if (arena) {
+        if (H5CX_set_vlen_arena(NULL) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't reset VL data arena")
+        if (ret_value >= 0) {
+            H5T_vlen_arena_buf_t arena_buf; /* Buffer the VL data was read into */
+
+            arena_buf.dt    = type_info.mem_type;
+            arena_buf.space = mem_space;
+            arena_buf.buf   = buf;
+            if (H5T_vlen_arena_finish(arena, (size_t)1, &arena_buf, &vlen_arena->buf, &vlen_arena->size,
+                                      &vlen_arena->offset, &vlen_arena->nseqs) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't finish VL data arena")
+        } /* end if */
+        else if (H5T_vlen_arena_discard(arena) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't free VL data arena")
+    } /* end if */
+
     /* Shut down the I/O op information */
     if (io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
@@ -287,6 +360,11 @@ done:
  * Purpose:	Writes (part of) a DATASET to a file from application memory
  *		BUF. See H5Dwrite() for complete details.
  *
+ *		When BATCH is not NULL, raw data that is written straight
+ *		from BUF is put off to BATCH instead of being written to
+ *		the file; it is written when the batch is flushed.  BUF
+ *		must stay unchanged until then.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -296,7 +374,7 @@ done:
  */
 herr_t
 H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-           const void *buf)
+           H5D_io_batch_t *batch, const void *buf)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -341,7 +419,7 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "no write intent on file")
 
     /* Set up datatype info for operation */
-    if (H5D__typeinfo_init(dataset, mem_type_id, TRUE, &type_info) < 0)
+    if (H5D__typeinfo_init(dataset, mem_type_id, TRUE, H5S_GET_SELECT_NPOINTS(file_space), &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
     type_info_init = TRUE;
 
@@ -454,6 +532,19 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
     } /* end if */
 
+    /* Put the writes off to the batch, when writing straight from the application's buffer */
+    if (batch && type_info.is_xform_noop && type_info.is_conv_noop) {
+        /* The batch bypasses the sieve buffer (which may hold fill values
+         * from allocating storage above), so flush it and drop its contents
+         */
+        if (H5D__flush_sieve_buf(dataset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+        if (H5D__contig_sieve_free(&dataset->shared->cache.contig) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free sieve buffer")
+
+        io_info.batch = batch;
+    } /* end if */
+
     /* Allocate the chunk map */
     if (NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
@@ -511,6 +602,461 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) several DATASETs into application memory.
+ *		The raw data read straight into the application's buffers
+ *		is gathered across the datasets and read from each file in
+ *		address order, with neighboring pieces sharing a block read.
+ *		See H5Dread_multi() for complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], H5S_t *mem_spaces[],
+                H5S_t *file_spaces[], void *bufs[] /*out*/)
+{
+    H5D_io_batch_t        batch;               /* Reads put off across the datasets */
+    H5D_io_batch_t *      dset_batch;          /* Batch for the current dataset */
+    H5D_vlen_arena_t *    vlen_arena  = NULL;  /* Application's arena for VL data */
+    H5T_vlen_arena_t *    arena       = NULL;  /* Arena taking the VL data read */
+    H5T_vlen_arena_buf_t *arena_bufs  = NULL;  /* Buffers the VL data is read into */
+    size_t                narena_bufs = 0;     /* Number of buffers the VL data is read into */
+    size_t                first       = 0;     /* First dataset with reads in the batch */
+    size_t                u;                   /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(dsets);
+    HDassert(mem_type_ids);
+    HDassert(mem_spaces);
+    HDassert(file_spaces);
+    HDassert(bufs);
+
+    HDmemset(&batch, 0, sizeof(batch));
+    batch.op_type = H5D_IO_OP_READ;
+
+    /* Gather the VL data read for all the datasets into the application's
+     * arena, which can only take the data of one read
+     */
+    if (H5CX_get_vlen_arena(&vlen_arena) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get VL data arena")
+    if (vlen_arena) {
+        for (u = 0; u < count; u++) {
+            const H5T_t *mem_type; /* Memory datatype */
+            htri_t       has_vlen; /* Whether the memory datatype holds VL data */
+
+            if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_ids[u], H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+            if ((has_vlen = H5T_detect_class(mem_type, H5T_VLEN, FALSE)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for VL datatype")
+            if (has_vlen) {
+                if (NULL == arena_bufs &&
+                    NULL == (arena_bufs = (H5T_vlen_arena_buf_t *)H5MM_malloc(
+                                 (count - u) * sizeof(H5T_vlen_arena_buf_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate VL data buffer list")
+                arena_bufs[narena_bufs].dt    = mem_type;
+                arena_bufs[narena_bufs].space = mem_spaces[u];
+                arena_bufs[narena_bufs].buf   = bufs[u];
+                narena_bufs++;
+            } /* end if */
+        }     /* end for */
+
+        if (narena_bufs > 0) {
+            if (vlen_arena->buf || vlen_arena->offset)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VL data arena already holds data")
+            if (NULL == (arena = H5T_vlen_arena_create()))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create VL data arena")
+            if (H5CX_set_vlen_arena(arena) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set VL data arena")
+        } /* end if */
+    }     /* end if */
+
+    /* Set up each dataset's I/O, putting its reads off to the batch */
+    for (u = 0; u < count; u++) {
+        if (H5D__io_batch_prep(&batch, dsets, u, &first, &dset_batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up batched read")
+        if (H5D__read(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], dset_batch, bufs[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end for */
+
+    /* Read the data for the datasets */
+    if (H5D__io_batch_flush(&batch) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read batched data")
+
+done:
+    /* Hand the VL data read over to the application */
+    if (arena) {
+        if (H5CX_set_vlen_arena(NULL) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't reset VL data arena")
+        if (ret_value >= 0) {
+            if (H5T_vlen_arena_finish(arena, narena_bufs, arena_bufs, &vlen_arena->buf, &vlen_arena->size,
+                                      &vlen_arena->offset, &vlen_arena->nseqs) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't finish VL data arena")
+        } /* end if */
+        else if (H5T_vlen_arena_discard(arena) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't free VL data arena")
+    } /* end if */
+    if (arena_bufs)
+        arena_bufs = (H5T_vlen_arena_buf_t *)H5MM_xfree(arena_bufs);
+    if (batch.pieces)
+        batch.pieces = (H5D_io_piece_t *)H5MM_xfree(batch.pieces);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) several DATASETs to their files from
+ *		application memory.  The raw data written straight from the
+ *		application's buffers is gathered across the datasets and
+ *		written to each file in address order, with neighboring
+ *		pieces sharing a block write.  See H5Dwrite_multi() for
+ *		complete details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], H5S_t *mem_spaces[],
+                 H5S_t *file_spaces[], const void *bufs[])
+{
+    H5D_io_batch_t  batch;               /* Writes put off across the datasets */
+    H5D_io_batch_t *dset_batch;          /* Batch for the current dataset */
+    size_t          first = 0;           /* First dataset with writes in the batch */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(dsets);
+    HDassert(mem_type_ids);
+    HDassert(mem_spaces);
+    HDassert(file_spaces);
+    HDassert(bufs);
+
+    HDmemset(&batch, 0, sizeof(batch));
+    batch.op_type = H5D_IO_OP_WRITE;
+
+    /* Set up each dataset's I/O, putting its writes off to the batch */
+    for (u = 0; u < count; u++) {
+        if (H5D__io_batch_prep(&batch, dsets, u, &first, &dset_batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up batched write")
+        if (H5D__write(dsets[u], mem_type_ids[u], mem_spaces[u], file_spaces[u], dset_batch, bufs[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end for */
+
+    /* Write the data for the datasets */
+    if (H5D__io_batch_flush(&batch) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write batched data")
+
+done:
+    if (batch.pieces)
+        batch.pieces = (H5D_io_piece_t *)H5MM_xfree(batch.pieces);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_prep
+ *
+ * Purpose:	Gets a batch ready for the I/O on dataset IDX of DSETS,
+ *		flushing the I/O already in it when the dataset is in
+ *		another file, or when writes to the dataset must land
+ *		after the writes in the batch.  FIRST is the first dataset
+ *		with I/O in the batch and is updated on a flush.
+ *
+ *		Returns in DSET_BATCH the batch to put the dataset's I/O
+ *		off to, or NULL if its I/O shouldn't be batched.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_batch_prep(H5D_io_batch_t *batch, H5D_t *dsets[], size_t idx, size_t *first,
+                   H5D_io_batch_t **dset_batch)
+{
+    H5D_t * dset  = dsets[idx]; /* Dataset to set up */
+    hbool_t flush = FALSE;      /* Whether to flush the batch first */
+    size_t  u;                  /* Local index variable */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(first && *first <= idx);
+    HDassert(dset_batch);
+
+    /* Block I/O can only be shared within a file */
+    if (batch->f && H5F_SHARED(batch->f) != H5F_SHARED(dset->oloc.file))
+        flush = TRUE;
+    else if (batch->op_type == H5D_IO_OP_WRITE) {
+        /* Writes to a virtual dataset go straight to its source datasets */
+        if (dset->shared->layout.type == H5D_VIRTUAL)
+            flush = TRUE;
+
+        /* Writes to a dataset already in the batch may overlap the earlier ones */
+        for (u = *first; u < idx && !flush; u++)
+            if (dsets[u]->shared == dset->shared)
+                flush = TRUE;
+    } /* end if */
+
+    if (flush) {
+        if (H5D__io_batch_flush(batch) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush batched I/O")
+        *first = idx;
+    } /* end if */
+    batch->f = dset->oloc.file;
+
+    *dset_batch = batch;
+#ifdef H5_HAVE_PARALLEL
+    /* MPI-based drivers have their own ways of combining I/O */
+    if (H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        *dset_batch = NULL;
+#endif /* H5_HAVE_PARALLEL */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_batch_prep() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_add
+ *
+ * Purpose:	Puts a piece of raw data I/O off to a batch, extending the
+ *		last piece when the new one follows it in both the file
+ *		and memory.  The piece is read into RBUF or written from
+ *		WBUF, depending on the batch's operation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_batch_add(H5D_io_batch_t *batch, haddr_t addr, size_t len, void *rbuf, const void *wbuf)
+{
+    H5D_io_piece_t *piece;               /* Piece for the I/O */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(batch);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(batch->op_type == H5D_IO_OP_READ ? (rbuf && !wbuf) : (wbuf && !rbuf));
+
+    /* Extend the last piece, if possible */
+    if (batch->npieces > 0) {
+        piece = &batch->pieces[batch->npieces - 1];
+        if (H5F_addr_eq(piece->addr + piece->len, addr) &&
+            (batch->op_type == H5D_IO_OP_READ
+                 ? (const uint8_t *)piece->u.rbuf + piece->len == (const uint8_t *)rbuf
+                 : (const uint8_t *)piece->u.wbuf + piece->len == (const uint8_t *)wbuf)) {
+            piece->len += len;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }     /* end if */
+
+    /* Make room for another piece */
+    if (batch->npieces == batch->nalloc) {
+        size_t          new_nalloc = MAX(H5D_IO_BATCH_INIT_NPIECES, 2 * batch->nalloc);
+        H5D_io_piece_t *new_pieces;
+
+        if (NULL == (new_pieces = (H5D_io_piece_t *)H5MM_realloc(batch->pieces,
+                                                                 new_nalloc * sizeof(H5D_io_piece_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't grow batch of raw data I/O")
+        batch->pieces = new_pieces;
+        batch->nalloc = new_nalloc;
+    } /* end if */
+
+    piece       = &batch->pieces[batch->npieces];
+    piece->addr = addr;
+    piece->len  = len;
+    if (batch->op_type == H5D_IO_OP_READ)
+        piece->u.rbuf = rbuf;
+    else
+        piece->u.wbuf = wbuf;
+    piece->seq = batch->npieces;
+    batch->npieces++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_batch_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_cmp
+ *
+ * Purpose:	Compares two pieces of batched I/O by file address, keeping
+ *		pieces at the same address in the order they were added.
+ *
+ * Return:	An integer less than, equal to, or greater than zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__io_batch_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_io_piece_t *piece1 = (const H5D_io_piece_t *)_piece1;
+    const H5D_io_piece_t *piece2 = (const H5D_io_piece_t *)_piece2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_addr_lt(piece1->addr, piece2->addr))
+        ret_value = -1;
+    else if (H5F_addr_gt(piece1->addr, piece2->addr))
+        ret_value = 1;
+    else
+        ret_value = (piece1->seq > piece2->seq) - (piece1->seq < piece2->seq);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_batch_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_seq_cmp
+ *
+ * Purpose:	Compares two pieces of batched I/O by the order they were
+ *		added in.
+ *
+ * Return:	An integer less than, equal to, or greater than zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__io_batch_seq_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5D_io_piece_t *piece1 = (const H5D_io_piece_t *)_piece1;
+    const H5D_io_piece_t *piece2 = (const H5D_io_piece_t *)_piece2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI((piece1->seq > piece2->seq) - (piece1->seq < piece2->seq))
+} /* end H5D__io_batch_seq_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_batch_flush
+ *
+ * Purpose:	Performs the raw data I/O put off to a batch.  The pieces
+ *		are sorted by file address and runs of pieces next to each
+ *		other in the file share a block read or write, through a
+ *		buffer no larger than the file's sieve buffer when the
+ *		pieces aren't next to each other in memory.
+ *
+ *		Overlapping writes are performed one at a time, in the
+ *		order they were added.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_batch_flush(H5D_io_batch_t *batch)
+{
+    H5F_shared_t *f_sh;                    /* Shared file for the pieces */
+    uint8_t *     span_buf      = NULL;    /* Buffer for a run of pieces */
+    size_t        span_buf_size = 0;       /* Size of span_buf */
+    size_t        max_span;                /* Largest run of pieces to stage in span_buf */
+    hbool_t       one_at_a_time = FALSE;   /* Whether to perform the pieces one at a time */
+    size_t        u, v;                    /* Local index variables */
+    herr_t        ret_value     = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+
+    if (0 == batch->npieces)
+        HGOTO_DONE(SUCCEED)
+    HDassert(batch->f);
+    f_sh     = H5F_SHARED(batch->f);
+    max_span = H5F_SIEVE_BUF_SIZE(batch->f);
+
+    /* Go through the pieces in file order */
+    if (batch->npieces > 1)
+        HDqsort(batch->pieces, batch->npieces, sizeof(H5D_io_piece_t), H5D__io_batch_cmp);
+
+    /* Put overlapping writes back in their original order */
+    if (batch->op_type == H5D_IO_OP_WRITE)
+        for (u = 1; u < batch->npieces && !one_at_a_time; u++)
+            if (H5F_addr_lt(batch->pieces[u].addr, batch->pieces[u - 1].addr + batch->pieces[u - 1].len)) {
+                HDqsort(batch->pieces, batch->npieces, sizeof(H5D_io_piece_t), H5D__io_batch_seq_cmp);
+                one_at_a_time = TRUE;
+            } /* end if */
+
+    for (u = 0; u < batch->npieces; u = v) {
+        const H5D_io_piece_t *piece      = &batch->pieces[u]; /* First piece in the run */
+        size_t                span_len   = piece->len;        /* Length of the run */
+        hbool_t               mem_contig = TRUE; /* Whether the run is contiguous in memory */
+
+        /* Find the run of pieces next to each other in the file */
+        for (v = u + 1; v < batch->npieces && !one_at_a_time; v++) {
+            const H5D_io_piece_t *prev = &batch->pieces[v - 1];
+            const H5D_io_piece_t *next = &batch->pieces[v];
+            hbool_t               next_contig; /* Whether the next piece follows in memory */
+
+            if (!H5F_addr_eq(prev->addr + prev->len, next->addr))
+                break;
+            next_contig = (hbool_t)(batch->op_type == H5D_IO_OP_READ
+                                        ? (const uint8_t *)prev->u.rbuf + prev->len == next->u.rbuf
+                                        : (const uint8_t *)prev->u.wbuf + prev->len == next->u.wbuf);
+            if (!(mem_contig && next_contig) && span_len + next->len > max_span)
+                break;
+            mem_contig = (hbool_t)(mem_contig && next_contig);
+            span_len += next->len;
+        } /* end for */
+        if (one_at_a_time)
+            v = u + 1;
+
+        if (mem_contig) {
+            /* The run is contiguous in memory too, so use the application's buffer */
+            if (batch->op_type == H5D_IO_OP_READ) {
+                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, piece->addr, span_len, piece->u.rbuf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+            } /* end if */
+            else if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, piece->addr, span_len, piece->u.wbuf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+        } /* end if */
+        else {
+            uint8_t *p;     /* Pointer into span_buf */
+            size_t   w;     /* Local index variable */
+
+            /* Stage the run in a buffer */
+            if (span_len > span_buf_size) {
+                if (NULL == (span_buf = H5FL_BLK_REALLOC(type_conv, span_buf, span_len)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate buffer for batched I/O")
+                span_buf_size = span_len;
+            } /* end if */
+
+            if (batch->op_type == H5D_IO_OP_READ) {
+                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, piece->addr, span_len, span_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+                for (w = u, p = span_buf; w < v; p += batch->pieces[w].len, w++)
+                    H5MM_memcpy(batch->pieces[w].u.rbuf, p, batch->pieces[w].len);
+            } /* end if */
+            else {
+                for (w = u, p = span_buf; w < v; p += batch->pieces[w].len, w++)
+                    H5MM_memcpy(p, batch->pieces[w].u.wbuf, batch->pieces[w].len);
+                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, piece->addr, span_len, span_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+            } /* end else */
+        }     /* end else */
+    }         /* end for */
+
+done:
+    /* The batch is empty, even if the I/O failed */
+    batch->npieces = 0;
+    if (span_buf)
+        span_buf = H5FL_BLK_FREE(type_conv, span_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_batch_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
  *
@@ -540,6 +1086,7 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
     io_info->dset  = dset;
     io_info->f_sh  = H5F_SHARED(dset->oloc.file);
     io_info->store = store;
+    io_info->batch = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
@@ -577,7 +1124,8 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
  * Function:	H5D__typeinfo_init
  *
  * Purpose:	Routine for determining correct datatype information for
- *              each I/O action.
+ *              each I/O action.  NELMTS is the number of elements the
+ *              action transfers, used to size the conversion buffers.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -587,7 +1135,8 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_type_info_t *type_info)
+H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, hsize_t nelmts,
+                   H5D_type_info_t *type_info)
 {
     const H5T_t *     src_type;            /* Source datatype */
     const H5T_t *     dst_type;            /* Destination datatype */
@@ -632,7 +1181,9 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
      * enough value in xfer_parms since turning off datatype conversion also
      * turns off background preservation.
      */
-    if (NULL == (type_info->tpath = H5T_path_find(src_type, dst_type)))
+    if (NULL == (type_info->tpath = H5T_path_find_memo(
+                     src_type, dst_type, dset->shared->type,
+                     do_write ? &dset->shared->write_tpath : &dset->shared->read_tpath)))
         HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
 
     /* Retrieve info from API context */
@@ -655,6 +1206,7 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
         size_t    max_temp_buf;  /* Maximum temporary buffer size */
         H5T_bkg_t bkgr_buf_type; /* Background buffer type */
         size_t    target_size;   /* Desired buffer size	*/
+        unsigned  conv_nthreads; /* Datatype conversion threads */
 
         /* Get info from API context */
         if (H5CX_get_max_temp_buf(&max_temp_buf) < 0)
@@ -684,26 +1236,30 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
                 type_info->need_bkg = H5T_BKG_NO; /*never needed even if app says yes*/
         }                                         /* end else */
 
-        /* Set up datatype conversion/background buffers */
+        /* Check whether the conversion can run in other threads */
+        if (H5CX_get_conv_nthreads(&conv_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of datatype conversion threads")
+        if (conv_nthreads > 1 && !type_info->is_conv_noop) {
+            htri_t conv_split; /* Whether the conversion is split across threads */
 
-        target_size = max_temp_buf;
+            if ((conv_split = H5T_convert_can_split(type_info->tpath)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check datatype conversion threads")
+            type_info->conv_split = (hbool_t)conv_split;
+        } /* end if */
 
-        /* If the buffer is too small to hold even one element, try to make it bigger */
-        if (target_size < type_info->max_type_size) {
-            hbool_t default_buffer_info; /* Whether the buffer information are the defaults */
+        /* Set up datatype conversion/background buffers */
 
-            /* Detect if we have all default settings for buffers */
-            default_buffer_info =
-                (hbool_t)((H5D_TEMP_BUF_SIZE == max_temp_buf) && (NULL == tconv_buf) && (NULL == bkgr_buf));
+        /* Check if we are using the default buffer info */
+        if ((H5D_TEMP_BUF_SIZE == max_temp_buf) && (NULL == tconv_buf) && (NULL == bkgr_buf))
+            /* OK to pick a size for this transfer with library default settings */
+            target_size = H5D__typeinfo_buf_size(dset, type_info, nelmts);
+        else {
+            target_size = max_temp_buf;
 
-            /* Check if we are using the default buffer info */
-            if (default_buffer_info)
-                /* OK to get bigger for library default settings */
-                target_size = type_info->max_type_size;
-            else
-                /* Don't get bigger than the application has requested */
+            /* Don't get bigger than the application has requested */
+            if (target_size < type_info->max_type_size)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "temporary buffer max size is too small")
-        } /* end if */
+        } /* end else */
 
         /* Compute the number of elements that will fit into buffer */
         type_info->request_nelmts = target_size / type_info->max_type_size;
@@ -728,8 +1284,8 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write, H5D_t
             /* Compute the background buffer size */
             /* (don't try to use buffers smaller than the default size) */
             bkg_size = type_info->request_nelmts * type_info->dst_type_size;
-            if (bkg_size < max_temp_buf)
-                bkg_size = max_temp_buf;
+            if (bkg_size < target_size)
+                bkg_size = target_size;
 
             /* Allocate background buffer */
             /* (Need calloc()-like call since memory needs to be initialized) */
@@ -744,6 +1300,71 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__typeinfo_init() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__typeinfo_buf_size
+ *
+ * Purpose:	Choose the size of the type conversion buffer for a
+ *		transfer of NELMTS elements when the application hasn't set
+ *		one with H5Pset_buffer().
+ *
+ *		The buffer is sized to hold the largest piece of the
+ *		selection that is gathered at once: the whole selection,
+ *		or no more than one chunk of a chunked dataset.  That is
+ *		capped at H5D_TEMP_BUF_MAX_SIZE, so that large transfers
+ *		reach the file in a few big strips rather than many 1 MiB
+ *		ones, and small transfers don't allocate and clear a buffer
+ *		they can't use.  A chunked dataset's buffer is also kept
+ *		within the dataset's chunk cache size (but no smaller than
+ *		H5D_TEMP_BUF_MIN_SIZE), which is how much memory the
+ *		application has set aside for the dataset's raw data.
+ *
+ *		When the conversion is split across threads, the piece is
+ *		split into at least H5D_TEMP_BUF_PIPE_NSTRIPS strips (of no
+ *		less than H5D_TEMP_BUF_MIN_SIZE) so that gathering one strip
+ *		overlaps with converting another in a second buffer.
+ *
+ * Return:	Buffer size in bytes, never less than one element (can't
+ *		fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__typeinfo_buf_size(const H5D_t *dset, const H5D_type_info_t *type_info, hsize_t nelmts)
+{
+    hsize_t piece_size;                       /* Largest piece of the selection gathered at once, in bytes */
+    hsize_t max_size = H5D_TEMP_BUF_MAX_SIZE; /* Largest buffer to use */
+    size_t  ret_value = 0;                    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(type_info->max_type_size > 0);
+
+    /* A chunked dataset's selection is transferred a chunk at a time, and
+     * its buffer shouldn't outgrow the dataset's chunk cache
+     */
+    if (H5D_CHUNKED == dset->shared->layout.type) {
+        size_t  dset_type_size = H5T_GET_SIZE(dset->shared->type);
+        hsize_t chunk_nelmts   = dset->shared->layout.u.chunk.size / dset_type_size;
+
+        nelmts   = MIN(nelmts, chunk_nelmts);
+        max_size = MIN(max_size, MAX(dset->shared->cache.chunk.nbytes_max, H5D_TEMP_BUF_MIN_SIZE));
+    } /* end if */
+
+    /* Size of the piece, capped to avoid overflow */
+    if (nelmts > max_size / type_info->max_type_size)
+        piece_size = max_size;
+    else
+        piece_size = nelmts * type_info->max_type_size;
+
+    /* Leave several strips to pipeline through the conversion threads */
+    if (type_info->conv_split && piece_size > H5D_TEMP_BUF_MIN_SIZE)
+        piece_size = MAX(piece_size / H5D_TEMP_BUF_PIPE_NSTRIPS, H5D_TEMP_BUF_MIN_SIZE);
+
+    ret_value = (size_t)MAX(piece_size, type_info->max_type_size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__typeinfo_buf_size() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
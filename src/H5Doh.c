@@ -283,6 +283,10 @@ H5O__dset_create(H5F_t *f, void *_crt_info, H5G_loc_t *obj_loc)
     HDassert(crt_info);
     HDassert(obj_loc);
 
+    /* Use the dataset's creation properties for the API context */
+    /* (objects created in a batch each have their own) */
+    H5CX_set_dcpl(crt_info->dcpl_id);
+
     /* Create the the dataset */
     if (NULL ==
         (dset = H5D__create(f, crt_info->type_id, crt_info->space, crt_info->dcpl_id, crt_info->dapl_id)))
@@ -50,12 +50,14 @@
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_WRITE;                                                                    \
+    (io_info)->batch   = NULL;                                                                               \
     (io_info)->u.wbuf  = buf
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                                                          \
     (io_info)->dset    = ds;                                                                                 \
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_READ;                                                                     \
+    (io_info)->batch   = NULL;                                                                               \
     (io_info)->u.rbuf  = buf
 
 /* Flags for marking aspects of a dataset dirty */
@@ -83,6 +85,16 @@
 #define H5D_BT2_SPLIT_PERC        100
 #define H5D_BT2_MERGE_PERC        40
 
+/* Data sieve buffer windows for contiguous datasets */
+#define H5D_SIEVE_MAX_NWINS 4  /* Most windows a dataset's data sieve buffer grows to */
+#define H5D_SIEVE_PERIOD    64 /* Window loads between checks for shrinking */
+
+/* Number of source datasets of virtual datasets kept open between I/O operations */
+#define H5D_VIRTUAL_MAX_OPEN_SRC_DSETS 256
+
+/* Number of mappings at which the mappings of a virtual dataset are indexed */
+#define H5D_VIRTUAL_INDEX_MIN_NENTS 16
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -104,6 +116,7 @@ typedef struct H5D_type_info_t {
     hbool_t                  is_xform_noop;  /* Whether the data transform is a NOOP */
     const H5T_subset_info_t *cmpd_subset;    /* Info related to the compound subset conversion functions */
     H5T_bkg_t                need_bkg;       /* Type of background buf needed */
+    hbool_t                  conv_split;     /* Whether conversions are split across threads */
     size_t                   request_nelmts; /* Requested strip mine */
     uint8_t *                tconv_buf;      /* Datatype conv buffer */
     hbool_t                  tconv_buf_allocated; /* Whether the type conversion buffer was allocated */
@@ -211,6 +224,26 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE /* Write operation */
 } H5D_io_op_type_t;
 
+/* Piece of raw data I/O put off until the end of a multi-dataset operation */
+typedef struct H5D_io_piece_t {
+    haddr_t addr; /* File address of the piece */
+    size_t  len;  /* Length of the piece, in bytes */
+    union {
+        void *      rbuf; /* Application buffer to read the piece into */
+        const void *wbuf; /* Application buffer to write the piece from */
+    } u;
+    size_t seq; /* Order the piece was added in */
+} H5D_io_piece_t;
+
+/* Raw data I/O gathered across the datasets of a multi-dataset operation */
+typedef struct H5D_io_batch_t {
+    H5D_io_op_type_t op_type; /* Whether the pieces are read or written */
+    H5F_t *          f;       /* File the pieces are in */
+    size_t           npieces; /* Number of pieces put off */
+    size_t           nalloc;  /* Number of pieces allocated */
+    H5D_io_piece_t * pieces;  /* Pieces put off */
+} H5D_io_batch_t;
+
 typedef struct H5D_io_info_t {
     const H5D_t *dset;  /* Pointer to dataset being operated on */
                         /* QAK: Delete the f_sh field when oloc has a shared file pointer? */
@@ -223,6 +256,7 @@ typedef struct H5D_io_info_t {
     H5D_layout_ops_t layout_ops; /* Dataset layout I/O operation function pointers */
     H5D_io_ops_t     io_ops;     /* I/O operation function pointers */
     H5D_io_op_type_t op_type;
+    H5D_io_batch_t * batch;      /* Batch to put raw data I/O off to, if not NULL */
     union {
         void *      rbuf; /* Pointer to buffer for read */
         const void *wbuf; /* Pointer to buffer to write */
@@ -367,6 +401,8 @@ typedef struct H5D_chunk_map_t {
 
     hsize_t chunk_dim[H5O_LAYOUT_NDIMS]; /* Size of chunk in each dimension */
 
+    hbool_t kept; /* Whether the chunk selections are kept by the dataset for reuse */
+
 #ifdef H5_HAVE_PARALLEL
     H5D_chunk_info_t **select_chunk; /* Store the information about whether this chunk is selected or not */
 #endif                               /* H5_HAVE_PARALLEL */
@@ -382,6 +418,15 @@ typedef struct H5D_chunk_cached_t {
     unsigned filter_mask;              /*excluded filters */
 } H5D_chunk_cached_t;
 
+/* Chunk mapping kept from an earlier I/O, for reuse by I/O with the same selections */
+typedef struct H5D_chunk_map_cache_t {
+    H5S_t *      file_space; /* Copy of the file dataspace the mapping was built for */
+    H5S_t *      mem_space;  /* Copy of the memory dataspace the mapping was built for */
+    H5S_sel_type fsel_type;  /* Selection type in file */
+    H5S_sel_type msel_type;  /* Selection type in memory */
+    H5SL_t *     sel_chunks; /* Skip list containing information for each chunk selected */
+} H5D_chunk_map_cache_t;
+
 /****************************/
 /* Virtual dataset typedefs */
 /****************************/
@@ -392,6 +437,34 @@ typedef struct H5D_virtual_held_file_t {
     struct H5D_virtual_held_file_t *next; /* Pointer to next node in list */
 } H5D_virtual_held_file_t;
 
+/* Open source datasets of all virtual datasets, most recently used first */
+typedef struct H5D_virtual_src_lru_t {
+    H5O_storage_virtual_srcdset_t *head;     /* Most recently used source dataset */
+    H5O_storage_virtual_srcdset_t *tail;     /* Least recently used source dataset */
+    size_t                         nopen;    /* Number of source datasets in the list */
+    unsigned                       io_depth; /* Number of virtual dataset I/O operations in progress */
+} H5D_virtual_src_lru_t;
+
+/* Entry in the index of a virtual dataset's mappings */
+typedef struct H5D_virtual_index_ent_t {
+    hsize_t start;   /* Low bound of the mapping in the indexed dimension */
+    hsize_t end;     /* High bound of the mapping in the indexed dimension */
+    hsize_t max_end; /* Largest high bound in the subtree rooted at this entry */
+    size_t  idx;     /* Index of the mapping in the mapping list */
+} H5D_virtual_index_ent_t;
+
+/* Index of a virtual dataset's mappings by the bounds of their virtual
+ * selections.  The entries, sorted by low bound in one dimension, form an
+ * implicit interval tree where each range of entries is rooted at its middle
+ * entry.  The bounds in the other dimensions weed out what the tree finds. */
+typedef struct H5D_virtual_index_t {
+    unsigned                 rank;   /* Rank of the virtual dataset */
+    unsigned                 dim;    /* Dimension the tree is built on */
+    size_t                   nents;  /* Number of entries (and mappings) */
+    H5D_virtual_index_ent_t *ents;   /* Tree entries */
+    hsize_t *                bounds; /* Low then high bounds of each mapping, in mapping order */
+} H5D_virtual_index_t;
+
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t; /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
@@ -416,6 +489,7 @@ typedef struct H5D_rdcc_t {
     H5SL_t *                sel_chunks;        /* Skip list containing information for each chunk selected */
     H5S_t *                 single_space;      /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t *      single_chunk_info; /* Pointer to single chunk's info */
+    H5D_chunk_map_cache_t   map_cache;         /* Chunk mapping kept from an earlier I/O */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t  scaled_dims[H5S_MAX_RANK];        /* The scaled dim sizes */
@@ -423,13 +497,26 @@ typedef struct H5D_rdcc_t {
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
 } H5D_rdcc_t;
 
+/* A window of the data sieve buffer for contiguous data */
+typedef struct H5D_sieve_win_t {
+    unsigned char *buf;   /* Buffer to hold the window's data */
+    haddr_t        loc;   /* File location (offset) of the window */
+    size_t         size;  /* Size of the window used (in bytes) */
+    hbool_t        dirty; /* Flag to indicate that the window is dirty */
+} H5D_sieve_win_t;
+
 /* The raw data contiguous data cache */
 typedef struct H5D_rdcdc_t {
-    unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
-    size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
-    hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    H5D_sieve_win_t sieve_win[H5D_SIEVE_MAX_NWINS]; /* Data sieve windows, most recently used first */
+    unsigned        sieve_nwins;                    /* Number of data sieve windows in use */
+    unsigned        sieve_max_nwins;                /* Number of data sieve windows allowed */
+    size_t          sieve_buf_size;                 /* Size of each data sieve window allocated (in bytes) */
+
+    /* Information for adapting the number of windows to the access pattern */
+    haddr_t  sieve_evicted[H5D_SIEVE_MAX_NWINS]; /* Locations of the windows replaced, most recent first */
+    unsigned sieve_nevicted;                     /* Number of locations in sieve_evicted */
+    unsigned sieve_nloads;                       /* Windows loaded in this period */
+    unsigned sieve_nhits;                        /* Hits on windows other than the first in this period */
 } H5D_rdcdc_t;
 
 /*
@@ -450,6 +537,10 @@ struct H5D_shared_t {
     H5O_layout_t     layout;          /* Data layout                  */
     hbool_t          checked_filters; /* TRUE if dataset passes can_apply check */
 
+    /* Conversion paths found for recent reads & writes */
+    H5T_path_memo_t read_tpath;  /* Path from the dataset's datatype to memory */
+    H5T_path_memo_t write_tpath; /* Path from memory to the dataset's datatype */
+
     /* Cached dataspace info */
     unsigned ndims;                       /* The dataset's dataspace rank */
     hsize_t  curr_dims[H5S_MAX_RANK];     /* The curr. size of dataset dimensions */
@@ -530,6 +621,9 @@ H5_DLLVAR const H5D_layout_ops_t H5D_LOPS_COMPACT[1];
 H5_DLLVAR const H5D_layout_ops_t H5D_LOPS_CHUNK[1];
 H5_DLLVAR const H5D_layout_ops_t H5D_LOPS_VIRTUAL[1];
 
+/* Open source datasets of virtual datasets */
+H5_DLLVAR H5D_virtual_src_lru_t H5D_virtual_src_lru_g;
+
 /* Chunked layout operations */
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_BTREE[1];
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_NONE[1];
@@ -552,7 +646,11 @@ H5_DLLVAR const unsigned H5O_layout_ver_bounds[H5F_LIBVER_NBOUNDS];
 H5_DLL H5D_t *H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id, hid_t dapl_id);
 H5_DLL H5D_t *H5D__create_named(const H5G_loc_t *loc, const char *name, hid_t type_id, const H5S_t *space,
                                 hid_t lcpl_id, hid_t dcpl_id, hid_t dapl_id);
+H5_DLL herr_t H5D__create_named_multi(const H5G_loc_t *loc, size_t count, const char *name[],
+                                     const hid_t type_id[], const H5S_t *space[], hid_t lcpl_id,
+                                     const hid_t dcpl_id[], hid_t dapl_id, H5D_t *dset[]);
 H5_DLL H5D_t * H5D__open_name(const H5G_loc_t *loc, const char *name, hid_t dapl_id);
+H5_DLL H5D_t * H5D__reopen(const H5D_t *dset);
 H5_DLL hid_t   H5D__get_space(const H5D_t *dset);
 H5_DLL hid_t   H5D__get_type(const H5D_t *dset);
 H5_DLL herr_t  H5D__get_space_status(const H5D_t *dset, H5D_space_status_t *allocation);
@@ -582,9 +680,15 @@ H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 
 /* Internal I/O routines */
 H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                        void *buf /*out*/);
+                        H5D_io_batch_t *batch, void *buf /*out*/);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                         const void *buf);
+                         H5D_io_batch_t *batch, const void *buf);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], H5S_t *mem_spaces[],
+                              H5S_t *file_spaces[], void *bufs[] /*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dsets[], const hid_t mem_type_ids[], H5S_t *mem_spaces[],
+                               H5S_t *file_spaces[], const void *bufs[]);
+H5_DLL herr_t H5D__io_batch_add(H5D_io_batch_t *batch, haddr_t addr, size_t len, void *rbuf,
+                                const void *wbuf);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
@@ -623,11 +727,13 @@ H5_DLL herr_t  H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *
 H5_DLL herr_t  H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f_dst,
                                 H5O_storage_contig_t *storage_dst, H5T_t *src_dtype, H5O_copy_t *cpy_info);
 H5_DLL herr_t  H5D__contig_delete(H5F_t *f, const H5O_storage_t *store);
+H5_DLL herr_t  H5D__contig_sieve_free(H5D_rdcdc_t *dset_contig);
 
 /* Functions that operate on chunked dataset storage */
 H5_DLL htri_t  H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op);
 H5_DLL herr_t  H5D__chunk_create(const H5D_t *dset /*in,out*/);
 H5_DLL herr_t  H5D__chunk_set_info(const H5D_t *dset);
+H5_DLL herr_t  H5D__chunk_map_cache_reset(H5D_rdcc_t *rdcc);
 H5_DLL hbool_t H5D__chunk_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL hbool_t H5D__chunk_is_data_cached(const H5D_shared_t *shared_dset);
 H5_DLL herr_t  H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udata);
@@ -679,6 +785,7 @@ H5_DLL hbool_t H5D__virtual_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL herr_t  H5D__virtual_hold_source_dset_files(const H5D_t *dset, H5D_virtual_held_file_t **head);
 H5_DLL herr_t  H5D__virtual_refresh_source_dsets(H5D_t *dset);
 H5_DLL herr_t  H5D__virtual_release_source_dset_files(H5D_virtual_held_file_t *head);
+H5_DLL void    H5D__virtual_src_lru_remove(H5O_storage_virtual_srcdset_t *source_dset);
 
 /* Functions that operate on EFL (External File List)*/
 H5_DLL hbool_t H5D__efl_is_space_alloc(const H5O_storage_t *storage);
@@ -739,6 +846,9 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__sieve_nwins_test(hid_t did, unsigned *nwins, unsigned *max_nwins);
+H5_DLL herr_t H5D__virtual_open_src_dsets_test(size_t *nopen);
+H5_DLL herr_t H5D__virtual_index_test(hid_t did, size_t *nents, unsigned *dim);
 #endif /* H5D_TESTING */
 
 #endif /*H5Dpkg_H*/
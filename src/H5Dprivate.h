@@ -45,6 +45,7 @@
 #define H5D_CRT_ALLOC_TIME_STATE_NAME  "alloc_time_state" /* Space allocation time state */
 #define H5D_CRT_EXT_FILE_LIST_NAME     "efl"              /* External file list */
 #define H5D_CRT_MIN_DSET_HDR_SIZE_NAME "dset_oh_minimize" /* Minimize object header */
+#define H5D_CRT_MIN_FILTER_RATIO_NAME  "min_filter_ratio" /* Minimum compression ratio for filtered chunks */
 
 /* ========  Dataset access property names ======== */
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME "rdcc_nslots"          /* Size of raw data chunk cache(slots) */
@@ -66,6 +67,7 @@
 #define H5D_XFER_VLEN_ALLOC_INFO_NAME       "vlen_alloc_info"     /* Vlen allocation info */
 #define H5D_XFER_VLEN_FREE_NAME             "vlen_free"           /* Vlen free function */
 #define H5D_XFER_VLEN_FREE_INFO_NAME        "vlen_free_info"      /* Vlen free info */
+#define H5D_XFER_VLEN_ARENA_NAME            "vlen_arena"          /* Arena for vlen data read */
 #define H5D_XFER_VFL_ID_NAME                "vfl_id"              /* File driver ID */
 #define H5D_XFER_VFL_INFO_NAME              "vfl_info"            /* File driver info */
 #define H5D_XFER_HYPER_VECTOR_SIZE_NAME     "vec_size"            /* Hyperslab vector size */
@@ -80,11 +82,13 @@
     "local_no_collective_cause" /* cause of broken collective I/O in each process */
 #define H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME                                                             \
     "global_no_collective_cause"                      /* cause of broken collective I/O in all processes */
-#define H5D_XFER_EDC_NAME         "err_detect"        /* EDC */
-#define H5D_XFER_FILTER_CB_NAME   "filter_cb"         /* Filter callback function */
-#define H5D_XFER_CONV_CB_NAME     "type_conv_cb"      /* Type conversion callback function */
-#define H5D_XFER_XFORM_NAME       "data_transform"    /* Data transform */
-#define H5D_XFER_DSET_IO_SEL_NAME "dset_io_selection" /* Dataset I/O selection */
+#define H5D_XFER_EDC_NAME             "err_detect"         /* EDC */
+#define H5D_XFER_FILTER_CB_NAME       "filter_cb"          /* Filter callback function */
+#define H5D_XFER_CONV_CB_NAME         "type_conv_cb"       /* Type conversion callback function */
+#define H5D_XFER_CONV_NTHREADS_NAME   "type_conv_nthreads" /* Number of type conversion threads */
+#define H5D_XFER_FILTER_NTHREADS_NAME "filter_nthreads"    /* Number of filter threads */
+#define H5D_XFER_XFORM_NAME           "data_transform"     /* Data transform */
+#define H5D_XFER_DSET_IO_SEL_NAME     "dset_io_selection"  /* Dataset I/O selection */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME        "coll_chunk_link_hard"
@@ -133,6 +137,7 @@ typedef struct H5D_dcpl_cache_t {
     H5O_fill_t  fill;  /* Fill value info (H5D_CRT_FILL_VALUE_NAME) */
     H5O_pline_t pline; /* I/O pipeline info (H5O_CRT_PIPELINE_NAME) */
     H5O_efl_t   efl;   /* External file list info (H5D_CRT_EXT_FILE_LIST_NAME) */
+    double      min_filter_ratio; /* Minimum compression ratio (H5D_CRT_MIN_FILTER_RATIO_NAME) */
 } H5D_dcpl_cache_t;
 
 /* Callback information for copying datasets */
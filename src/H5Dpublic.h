@@ -168,6 +168,19 @@ typedef herr_t (*H5D_gather_func_t)(const void *dst_buf, size_t dst_buf_bytes_us
 typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, uint32_t filter_mask, haddr_t addr, uint32_t nbytes,
                                    void *op_data);
 
+//! <!-- [H5D_vlen_arena_t_snip] -->
+/**
+ * Variable-length data of a dataset read, gathered into one block by
+ * H5Pset_vlen_arena()
+ */
+typedef struct H5D_vlen_arena_t {
+    void *  buf;    /**< Block holding the data of every sequence and string read */
+    size_t  size;   /**< Number of bytes of data in \p buf */
+    size_t  nseqs;  /**< Number of sequences and strings with data in \p buf */
+    size_t *offset; /**< Offset in \p buf of each sequence's or string's data, in the order converted */
+} H5D_vlen_arena_t;
+//! <!-- [H5D_vlen_arena_t_snip] -->
+
 /********************/
 /* Public Variables */
 /********************/
@@ -317,6 +330,53 @@ H5_DLL hid_t H5Dcreate_async(const char *app_file, const char *app_func, unsigne
  */
 H5_DLL hid_t H5Dcreate_anon(hid_t loc_id, hid_t type_id, hid_t space_id, hid_t dcpl_id, hid_t dapl_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Creates several new datasets in a group and links them into it
+ *
+ * \fgdta_loc_id
+ * \param[in]  count    Number of datasets to create
+ * \param[in]  name     Names of the datasets to create
+ * \param[in]  type_id  Identifiers of the datasets' datatypes
+ * \param[in]  space_id Identifiers of the datasets' dataspaces
+ * \lcpl_id
+ * \param[in]  dcpl_id  Identifiers of the dataset creation property lists
+ * \dapl_id
+ * \param[out] dset_id  Identifiers of the new datasets
+ *
+ * \return \herr_t
+ *
+ * \details H5Dcreate_multi() creates \p count datasets in the group
+ *          specified by \p loc_id in one call.  Element \c i of \p name,
+ *          \p type_id, \p space_id and \p dcpl_id describe a dataset just
+ *          as the matching arguments of H5Dcreate2() do, and the new
+ *          dataset's identifier is returned in element \c i of \p dset_id.
+ *          All the links are created with \p lcpl_id and all the datasets
+ *          are opened with \p dapl_id.
+ *
+ *          Each name is the name of a link in the group, not a path, and
+ *          the names must differ from each other and from the links
+ *          already in the group.
+ *
+ *          With the native VOL connector, the datasets' object headers
+ *          are allocated next to each other in the file and the links
+ *          are inserted into the group in one batch, which is much
+ *          cheaper than creating the datasets one at a time when a group
+ *          receives many of them.  Other VOL connectors create the
+ *          datasets one at a time with H5Dcreate2().
+ *
+ *          The dataset identifiers should be closed with H5Dclose() when
+ *          they are no longer needed.
+ *
+ * \see H5Dcreate2(), H5Gcreate_multi()
+ *
+ */
+H5_DLL herr_t H5Dcreate_multi(hid_t loc_id, size_t count, const char *name[], hid_t type_id[],
+                              hid_t space_id[], hid_t lcpl_id, hid_t dcpl_id[], hid_t dapl_id,
+                              hid_t dset_id[] /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -975,6 +1035,83 @@ H5_DLL herr_t H5Dwrite_async(const char *app_file, const char *app_func, unsigne
                              hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
                              const void *buf, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Reads raw data from several datasets into buffers
+ *
+ * \param[in]  count         Number of datasets to read from
+ * \param[in]  dset_id       Identifiers of the datasets to read from
+ * \param[in]  mem_type_id   Identifiers of the memory datatypes
+ * \param[in]  mem_space_id  Identifiers of the memory dataspaces
+ * \param[in]  file_space_id Identifiers of the datasets' dataspaces in the file
+ * \dxpl_id
+ * \param[out] buf           Buffers to receive data read from the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dread_multi() reads \p count (partial) datasets in one call.
+ *          Element \c i of \p dset_id, \p mem_type_id, \p mem_space_id,
+ *          \p file_space_id and \p buf describe a read just as the
+ *          matching arguments of H5Dread() do, and all the reads use the
+ *          data transfer properties in \p dxpl_id.
+ *
+ *          Raw data that needs no datatype conversion or data transform
+ *          is read from each file in address order once all the
+ *          datasets have been set up, with the reads for neighboring
+ *          pieces of storage combined, whichever dataset they belong to.
+ *          This suits reading many small datasets, or small selections
+ *          from many datasets.
+ *
+ *          When a dataset does not belong to the native VOL connector,
+ *          the datasets are read one at a time with H5Dread().
+ *
+ * \see H5Dread(), H5Dwrite_multi()
+ *
+ */
+H5_DLL herr_t H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                            hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/);
+
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Writes raw data from buffers to several datasets
+ *
+ * \param[in] count         Number of datasets to write to
+ * \param[in] dset_id       Identifiers of the datasets to write to
+ * \param[in] mem_type_id   Identifiers of the memory datatypes
+ * \param[in] mem_space_id  Identifiers of the memory dataspaces
+ * \param[in] file_space_id Identifiers of the datasets' dataspaces in the file
+ * \dxpl_id
+ * \param[in] buf           Buffers with data to be written to the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dwrite_multi() writes \p count (partial) datasets in one call.
+ *          Element \c i of \p dset_id, \p mem_type_id, \p mem_space_id,
+ *          \p file_space_id and \p buf describe a write just as the
+ *          matching arguments of H5Dwrite() do, and all the writes use the
+ *          data transfer properties in \p dxpl_id.
+ *
+ *          Raw data that needs no datatype conversion or data transform
+ *          is written to each file in address order once all the
+ *          datasets have been set up, with the writes for neighboring
+ *          pieces of storage combined, whichever dataset they belong to.
+ *          The buffers must not change until the call returns. When a
+ *          dataset is listed more than once, its writes land in the order
+ *          they are listed.
+ *
+ *          When a dataset does not belong to the native VOL connector,
+ *          the datasets are written one at a time with H5Dwrite().
+ *
+ * \see H5Dwrite(), H5Dread_multi()
+ *
+ */
+H5_DLL herr_t H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                             hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -1202,6 +1339,28 @@ H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id, H5D_operator_
  */
 H5_DLL herr_t H5Dvlen_get_buf_size(hid_t dset_id, hid_t type_id, hid_t space_id, hsize_t *size);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Frees the variable-length data gathered into an arena by a read
+ *
+ * \param[in,out] arena Arena set with H5Pset_vlen_arena()
+ *
+ * \return \herr_t
+ *
+ * \details H5Dvlen_arena_free() frees the block of variable-length data
+ *          and the array of offsets that an H5Dread() call placed in \p
+ *          arena, in place of H5Treclaim() on the buffer read, and resets
+ *          the arena so that it can be used by another read.  The
+ *          pointers to variable-length data in the buffer read are no
+ *          longer valid afterwards.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dvlen_arena_free(H5D_vlen_arena_t *arena);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
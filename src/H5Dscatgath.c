@@ -46,6 +46,14 @@ static size_t H5D__gather_file(const H5D_io_info_t *io_info, H5S_sel_iter_t *fil
 static herr_t H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_t *type_info,
                                      void *user_buf /*out*/);
 static herr_t H5D__compound_opt_write(size_t nelmts, const H5D_type_info_t *type_info);
+static hbool_t H5D__scatgath_can_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                      hsize_t nelmts);
+static herr_t  H5D__scatgath_read_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                       hsize_t nelmts, H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter,
+                                       unsigned conv_nthreads);
+static herr_t  H5D__scatgath_write_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                        hsize_t nelmts, H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter,
+                                        unsigned conv_nthreads);
 
 /*********************/
 /* Package Variables */
@@ -64,6 +72,9 @@ H5FL_SEQ_EXTERN(size_t);
 /* Declare extern free list to manage sequences of hsize_t */
 H5FL_SEQ_EXTERN(hsize_t);
 
+/* Declare extern free list to manage blocks of type conversion data */
+H5FL_BLK_EXTERN(type_conv);
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__scatter_file
  *
@@ -448,6 +459,7 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     hbool_t         file_iter_init = FALSE; /* File selection iteration info has been initialized */
     hsize_t         smine_start;            /* Strip mine start loc	*/
     size_t          smine_nelmts;           /* Elements per strip	*/
+    unsigned        conv_nthreads;          /* Datatype conversion threads */
     herr_t          ret_value = SUCCEED;    /* Return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -483,6 +495,17 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+    /* Retrieve the number of datatype conversion threads */
+    if (H5CX_get_conv_nthreads(&conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of datatype conversion threads")
+
+    /* Check for overlapping the conversion of each strip with gathering the next */
+    if (H5D__scatgath_can_pipe(io_info, type_info, nelmts)) {
+        if (H5D__scatgath_read_pipe(io_info, type_info, nelmts, file_iter, mem_iter, conv_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "pipelined read failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
@@ -522,8 +545,9 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
             /*
              * Perform datatype conversion.
              */
-            if (H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
-                            (size_t)0, (size_t)0, type_info->tconv_buf, type_info->bkg_buf) < 0)
+            if (H5T_convert_mt(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
+                               (size_t)0, (size_t)0, type_info->tconv_buf, type_info->bkg_buf,
+                               conv_nthreads) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
 
             /* Do the data transform after the conversion (since we're using type mem_type) */
@@ -588,6 +612,7 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
     hbool_t         file_iter_init = FALSE; /* File selection iteration info has been initialized */
     hsize_t         smine_start;            /* Strip mine start loc	*/
     size_t          smine_nelmts;           /* Elements per strip	*/
+    unsigned        conv_nthreads;          /* Datatype conversion threads */
     herr_t          ret_value = SUCCEED;    /* Return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -624,6 +649,17 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE; /*file selection iteration info has been initialized */
 
+    /* Retrieve the number of datatype conversion threads */
+    if (H5CX_get_conv_nthreads(&conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of datatype conversion threads")
+
+    /* Check for overlapping the conversion of each strip with gathering the next */
+    if (H5D__scatgath_can_pipe(io_info, type_info, nelmts)) {
+        if (H5D__scatgath_write_pipe(io_info, type_info, nelmts, file_iter, mem_iter, conv_nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "pipelined write failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Start strip mining... */
     for (smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n; /* Elements operated on */
@@ -676,8 +712,9 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_type_info_t *type_in
             /*
              * Perform datatype conversion.
              */
-            if (H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
-                            (size_t)0, (size_t)0, type_info->tconv_buf, type_info->bkg_buf) < 0)
+            if (H5T_convert_mt(type_info->tpath, type_info->src_type_id, type_info->dst_type_id, smine_nelmts,
+                               (size_t)0, (size_t)0, type_info->tconv_buf, type_info->bkg_buf,
+                               conv_nthreads) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
         } /* end else */
 
@@ -706,6 +743,213 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_can_pipe
+ *
+ * Purpose:	Decide whether a scatter/gather transfer should overlap the
+ *		datatype conversion of each strip with gathering the next.
+ *		That takes more than one strip, a conversion that is split
+ *		across conversion threads (so it really runs while the next
+ *		strip is gathered) and that needs no background buffer.  The
+ *		dataset's filter pipeline must be empty too, since filters
+ *		run during the gather may call back into the library while
+ *		a conversion is running.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__scatgath_can_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (type_info->conv_split && nelmts > type_info->request_nelmts && !type_info->is_conv_noop &&
+        H5T_BKG_NO == type_info->need_bkg && NULL == type_info->cmpd_subset &&
+        0 == io_info->dset->shared->dcpl_cache.pline.nused)
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_can_pipe() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_read_pipe
+ *
+ * Purpose:	Perform scatter/gather read from a contiguous [piece of a]
+ *		dataset, converting each strip in the background while the
+ *		next is gathered from the file and the previous one is
+ *		scattered to memory.  A second type conversion buffer lets
+ *		the two strips proceed independently.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_read_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
+                        H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter, unsigned conv_nthreads)
+{
+    void *            buf            = io_info->u.rbuf; /* Local pointer to application buffer */
+    uint8_t *         tconv_buf[2]   = {(uint8_t *)type_info->tconv_buf, NULL}; /* Conversion buffers */
+    H5Z_data_xform_t *data_transform = NULL;                                   /* Data transform info */
+    H5T_conv_req_t *  req            = NULL; /* Conversion of the current strip */
+    size_t            req_nelmts     = 0;    /* Elements in the current strip */
+    unsigned          cur            = 0;    /* Conversion buffer for the current strip */
+    size_t            tconv_size;            /* Size of a conversion buffer */
+    hsize_t           smine_start;           /* Strip mine start loc	*/
+    herr_t            ret_value = SUCCEED;   /* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    /* Allocate the second conversion buffer */
+    tconv_size = type_info->request_nelmts * MAX(type_info->src_type_size, type_info->dst_type_size);
+    if (NULL == (tconv_buf[1] = (uint8_t *)H5FL_BLK_MALLOC(type_conv, tconv_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+
+    /* Retrieve info from API context */
+    if (!type_info->is_xform_noop && H5CX_get_data_transform(&data_transform) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+
+    /* Start strip mining... */
+    for (smine_start = 0; smine_start < nelmts || req; smine_start += req_nelmts) {
+        H5T_conv_req_t *prev_req    = req;        /* Conversion of the previous strip */
+        size_t          prev_nelmts = req_nelmts; /* Elements in the previous strip */
+
+        /* Gather the next strip from disk while the previous one converts */
+        req        = NULL;
+        req_nelmts = 0;
+        if (smine_start < nelmts) {
+            HDassert(H5S_SELECT_ITER_NELMTS(file_iter) == (nelmts - smine_start));
+            req_nelmts = (size_t)MIN(type_info->request_nelmts, (nelmts - smine_start));
+            if (H5D__gather_file(io_info, file_iter, req_nelmts, tconv_buf[cur] /*out*/) != req_nelmts) {
+                req = prev_req;
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+            } /* end if */
+        }     /* end if */
+
+        /* Finish converting the previous strip */
+        if (prev_req && H5T_convert_wait(prev_req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Start converting this strip */
+        if (req_nelmts > 0)
+            if (H5T_convert_start(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                                  req_nelmts, tconv_buf[cur], NULL, conv_nthreads, &req) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Transform and scatter the previous strip into memory while this one converts */
+        if (prev_nelmts > 0) {
+            if (data_transform &&
+                H5Z_xform_eval(data_transform, tconv_buf[1 - cur], prev_nelmts, type_info->mem_type) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Error performing data transform")
+            if (H5D__scatter_mem(tconv_buf[1 - cur], mem_iter, prev_nelmts, buf /*out*/) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+        } /* end if */
+
+        cur = 1 - cur;
+    } /* end for */
+
+done:
+    /* Wait for a conversion still running */
+    if (req && H5T_convert_wait(req) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    if (tconv_buf[1])
+        tconv_buf[1] = H5FL_BLK_FREE(type_conv, tconv_buf[1]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_read_pipe() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__scatgath_write_pipe
+ *
+ * Purpose:	Perform scatter/gather write to a contiguous [piece of a]
+ *		dataset, converting each strip in the background while the
+ *		next is gathered from memory and the previous one is
+ *		scattered to the file.  A second type conversion buffer
+ *		lets the two strips proceed independently.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__scatgath_write_pipe(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
+                         H5S_sel_iter_t *file_iter, H5S_sel_iter_t *mem_iter, unsigned conv_nthreads)
+{
+    const void *      buf            = io_info->u.wbuf; /* Local pointer to application buffer */
+    uint8_t *         tconv_buf[2]   = {(uint8_t *)type_info->tconv_buf, NULL}; /* Conversion buffers */
+    H5Z_data_xform_t *data_transform = NULL;                                   /* Data transform info */
+    H5T_conv_req_t *  req            = NULL; /* Conversion of the current strip */
+    size_t            req_nelmts     = 0;    /* Elements in the current strip */
+    unsigned          cur            = 0;    /* Conversion buffer for the current strip */
+    size_t            tconv_size;            /* Size of a conversion buffer */
+    hsize_t           smine_start;           /* Strip mine start loc	*/
+    herr_t            ret_value = SUCCEED;   /* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    /* Allocate the second conversion buffer */
+    tconv_size = type_info->request_nelmts * MAX(type_info->src_type_size, type_info->dst_type_size);
+    if (NULL == (tconv_buf[1] = (uint8_t *)H5FL_BLK_MALLOC(type_conv, tconv_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+
+    /* Retrieve info from API context */
+    if (!type_info->is_xform_noop && H5CX_get_data_transform(&data_transform) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get data transform info")
+
+    /* Start strip mining... */
+    for (smine_start = 0; smine_start < nelmts || req; smine_start += req_nelmts) {
+        H5T_conv_req_t *prev_req    = req;        /* Conversion of the previous strip */
+        size_t          prev_nelmts = req_nelmts; /* Elements in the previous strip */
+
+        /* Gather (and transform) the next strip from memory while the previous one converts */
+        req        = NULL;
+        req_nelmts = 0;
+        if (smine_start < nelmts) {
+            req_nelmts = (size_t)MIN(type_info->request_nelmts, (nelmts - smine_start));
+            if (H5D__gather_mem(buf, mem_iter, req_nelmts, tconv_buf[cur] /*out*/) != req_nelmts) {
+                req = prev_req;
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "mem gather failed")
+            } /* end if */
+            if (data_transform &&
+                H5Z_xform_eval(data_transform, tconv_buf[cur], req_nelmts, type_info->mem_type) < 0) {
+                req = prev_req;
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "Error performing data transform")
+            } /* end if */
+        }     /* end if */
+
+        /* Finish converting the previous strip */
+        if (prev_req && H5T_convert_wait(prev_req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Start converting this strip */
+        if (req_nelmts > 0)
+            if (H5T_convert_start(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                                  req_nelmts, tconv_buf[cur], NULL, conv_nthreads, &req) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+        /* Scatter the previous strip out to the file while this one converts */
+        if (prev_nelmts > 0) {
+            HDassert(H5S_SELECT_ITER_NELMTS(file_iter) == (nelmts - (smine_start - prev_nelmts)));
+            if (H5D__scatter_file(io_info, file_iter, prev_nelmts, tconv_buf[1 - cur]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "scatter failed")
+        } /* end if */
+
+        cur = 1 - cur;
+    } /* end for */
+
+done:
+    /* Wait for a conversion still running */
+    if (req && H5T_convert_wait(req) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    if (tconv_buf[1])
+        tconv_buf[1] = H5FL_BLK_FREE(type_conv, tconv_buf[1]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__scatgath_write_pipe() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__compound_opt_read
  *
@@ -31,19 +31,35 @@
 #include "H5Dpkg.h"      /* Datasets				*/
 #include "H5Eprivate.h"  /* Error handling		  	*/
 #include "H5FLprivate.h" /* Free Lists                           */
+#include "H5MMprivate.h" /* Memory management                    */
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Largest number of elements in a point selection to sort by file offset at once */
+#define H5D_SELECT_POINTS_SORT_MAX (1024 * 1024)
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Offsets of an element selected in the file and memory, for sorting point selections */
+typedef struct H5D_select_pnt_t {
+    hsize_t file_off; /* Offset of element in the file */
+    hsize_t mem_off;  /* Offset of element in memory */
+    size_t  idx;      /* Position of element in the selection */
+} H5D_select_pnt_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 
+static int    H5D__select_pnt_cmp(const void *_pnt1, const void *_pnt2);
+static herr_t H5D__select_io_vec(const H5D_io_info_t *io_info, size_t nseq, size_t file_len[],
+                                 hsize_t file_off[], size_t mem_len[], hsize_t mem_off[]);
+static herr_t H5D__select_io_points(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts,
+                                    const H5S_t *file_space, const H5S_t *mem_space);
 static herr_t H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts,
                              const H5S_t *file_space, const H5S_t *mem_space);
 
@@ -64,6 +80,262 @@ H5FL_SEQ_DEFINE(hsize_t);
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__select_pnt_cmp
+ *
+ * Purpose:	Compares two selected elements by their offset in the file,
+ *		then by their position in the selection, for sorting points.
+ *
+ * Return:	Negative, zero or positive, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__select_pnt_cmp(const void *_pnt1, const void *_pnt2)
+{
+    const H5D_select_pnt_t *pnt1      = (const H5D_select_pnt_t *)_pnt1;
+    const H5D_select_pnt_t *pnt2      = (const H5D_select_pnt_t *)_pnt2;
+    int                     ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (pnt1->file_off < pnt2->file_off)
+        ret_value = -1;
+    else if (pnt1->file_off > pnt2->file_off)
+        ret_value = 1;
+    else if (pnt1->idx < pnt2->idx)
+        ret_value = -1;
+    else if (pnt1->idx > pnt2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__select_pnt_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__select_io_vec
+ *
+ * Purpose:	Performs I/O on a list of file sequences and the matching
+ *		list of memory sequences.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__select_io_vec(const H5D_io_info_t *io_info, size_t nseq, size_t file_len[], hsize_t file_off[],
+                   size_t mem_len[], hsize_t mem_off[])
+{
+    size_t curr_mem_seq  = 0;       /* Current memory sequence to operate on */
+    size_t curr_file_seq = 0;       /* Current file sequence to operate on */
+    herr_t ret_value     = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (curr_file_seq < nseq) {
+        if (io_info->op_type == H5D_IO_OP_READ) {
+            if ((*io_info->layout_ops.readvv)(io_info, nseq, &curr_file_seq, file_len, file_off, nseq,
+                                              &curr_mem_seq, mem_len, mem_off) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_READERROR, FAIL, "read error")
+        } /* end if */
+        else {
+            HDassert(io_info->op_type == H5D_IO_OP_WRITE);
+            if ((*io_info->layout_ops.writevv)(io_info, nseq, &curr_file_seq, file_len, file_off, nseq,
+                                               &curr_mem_seq, mem_len, mem_off) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_WRITEERROR, FAIL, "write error")
+        } /* end else */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__select_io_vec() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__select_io_points
+ *
+ * Purpose:	Perform I/O directly from application memory and a file,
+ *		for a point selection in the file.
+ *
+ *		Points are iterated over in the order they were selected,
+ *		which can jump back and forth through the file and turn
+ *		into one tiny sequence per point.  Instead, the file and
+ *		memory offsets of each element are found first, the
+ *		elements are sorted by their offset in the file, and runs
+ *		of elements that are next to each other in both the file
+ *		and memory are merged into one sequence.  Each element
+ *		still goes to or from its own place in memory, and if
+ *		the same point is written more than once, the last write
+ *		wins, just as before.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__select_io_points(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, const H5S_t *file_space,
+                      const H5S_t *mem_space)
+{
+    H5S_sel_iter_t *  mem_iter       = NULL;  /* Memory selection iteration info */
+    hbool_t           mem_iter_init  = FALSE; /* Memory selection iteration info has been initialized */
+    H5S_sel_iter_t *  file_iter      = NULL;  /* File selection iteration info */
+    hbool_t           file_iter_init = FALSE; /* File selection iteration info has been initialized */
+    H5D_select_pnt_t *pnt            = NULL;  /* Offsets of the elements being operated on */
+    hsize_t *         mem_off        = NULL;  /* Pointer to sequence offsets in memory */
+    hsize_t *         file_off       = NULL;  /* Pointer to sequence offsets in the file */
+    size_t *          mem_len        = NULL;  /* Pointer to sequence lengths in memory */
+    size_t *          file_len       = NULL;  /* Pointer to sequence lengths in the file */
+    size_t            max_npnts;              /* Number of elements to sort at a time */
+    size_t            dxpl_vec_size;          /* Vector length from API context's DXPL */
+    size_t            vec_size;               /* Vector length */
+    herr_t            ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(io_info);
+    HDassert(elmt_size > 0);
+    HDassert(nelmts > 1);
+    HDassert(H5S_SEL_POINTS == H5S_GET_SELECT_TYPE(file_space));
+
+    /* Get info from API context */
+    if (H5CX_get_vec_size(&dxpl_vec_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size")
+
+    /* Allocate the vector I/O arrays */
+    if (dxpl_vec_size > H5D_IO_VECTOR_SIZE)
+        vec_size = dxpl_vec_size;
+    else
+        vec_size = H5D_IO_VECTOR_SIZE;
+    if (NULL == (mem_len = H5FL_SEQ_MALLOC(size_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+    if (NULL == (mem_off = H5FL_SEQ_MALLOC(hsize_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+    if (NULL == (file_len = H5FL_SEQ_MALLOC(size_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+    if (NULL == (file_off = H5FL_SEQ_MALLOC(hsize_t, vec_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+
+    /* Allocate the array of element offsets */
+    max_npnts = MIN(nelmts, H5D_SELECT_POINTS_SORT_MAX);
+    if (NULL == (pnt = (H5D_select_pnt_t *)H5MM_malloc(max_npnts * sizeof(H5D_select_pnt_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate element offset array")
+
+    /* Allocate the iterators */
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
+    if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator")
+
+    /* Initialize file iterator */
+    if (H5S_select_iter_init(file_iter, file_space, elmt_size, 0) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    file_iter_init = 1; /* File selection iteration info has been initialized */
+
+    /* Initialize memory iterator */
+    if (H5S_select_iter_init(mem_iter, mem_space, elmt_size, 0) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    mem_iter_init = 1; /* Memory selection iteration info has been initialized */
+
+    /* Loop, until all elements are processed */
+    while (nelmts > 0) {
+        size_t  npnts  = MIN(nelmts, max_npnts); /* Number of elements this time */
+        hbool_t sorted = TRUE;                   /* Whether the elements are in file offset order */
+        size_t  nseq;                            /* Number of sequences */
+        size_t  nelem;                           /* Number of elements used in sequences */
+        size_t  u, v;                            /* Local index variables */
+
+        /* Find the offset of each element in the file */
+        for (u = 0; u < npnts;) {
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(file_iter, vec_size, npnts - u, &nseq, &nelem, file_off,
+                                             file_len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            if (0 == nelem)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "ran out of elements in file selection")
+            for (v = 0; v < nseq; v++) {
+                hsize_t off; /* Offset of element */
+
+                for (off = file_off[v]; off < file_off[v] + file_len[v]; off += elmt_size, u++) {
+                    if (u > 0 && off < pnt[u - 1].file_off)
+                        sorted = FALSE;
+                    pnt[u].file_off = off;
+                    pnt[u].idx      = u;
+                } /* end for */
+            }     /* end for */
+        }         /* end for */
+
+        /* Find the offset of each element in memory */
+        for (u = 0; u < npnts;) {
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, vec_size, npnts - u, &nseq, &nelem, mem_off, mem_len) <
+                0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+            if (0 == nelem)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "ran out of elements in memory selection")
+            for (v = 0; v < nseq; v++) {
+                hsize_t off; /* Offset of element */
+
+                for (off = mem_off[v]; off < mem_off[v] + mem_len[v]; off += elmt_size, u++)
+                    pnt[u].mem_off = off;
+            } /* end for */
+        }     /* end for */
+
+        /* Sort the elements by their offset in the file */
+        if (!sorted)
+            HDqsort(pnt, npnts, sizeof(H5D_select_pnt_t), H5D__select_pnt_cmp);
+
+        /* Merge elements next to each other into sequences and perform I/O on them */
+        nseq = 0;
+        for (u = 0; u < npnts; u++) {
+            if (nseq > 0 && pnt[u].file_off == file_off[nseq - 1] + file_len[nseq - 1] &&
+                pnt[u].mem_off == mem_off[nseq - 1] + mem_len[nseq - 1]) {
+                file_len[nseq - 1] += elmt_size;
+                mem_len[nseq - 1] += elmt_size;
+            } /* end if */
+            else {
+                if (nseq == vec_size) {
+                    if (H5D__select_io_vec(io_info, nseq, file_len, file_off, mem_len, mem_off) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTOPERATE, FAIL, "I/O on point selection failed")
+                    nseq = 0;
+                } /* end if */
+
+                file_off[nseq] = pnt[u].file_off;
+                file_len[nseq] = elmt_size;
+                mem_off[nseq]  = pnt[u].mem_off;
+                mem_len[nseq]  = elmt_size;
+                nseq++;
+            } /* end else */
+        }     /* end for */
+        if (nseq > 0)
+            if (H5D__select_io_vec(io_info, nseq, file_len, file_off, mem_len, mem_off) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTOPERATE, FAIL, "I/O on point selection failed")
+
+        /* Decrement number of elements left to process */
+        nelmts -= npnts;
+    } /* end while */
+
+done:
+    /* Release selection iterators */
+    if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if (file_iter)
+        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+
+    /* Release vector arrays, if allocated */
+    if (file_len)
+        file_len = H5FL_SEQ_FREE(size_t, file_len);
+    if (file_off)
+        file_off = H5FL_SEQ_FREE(hsize_t, file_off);
+    if (mem_len)
+        mem_len = H5FL_SEQ_FREE(size_t, mem_len);
+    if (mem_off)
+        mem_off = H5FL_SEQ_FREE(hsize_t, mem_off);
+    H5MM_xfree(pnt);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__select_io_points() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__select_io
  *
@@ -105,8 +377,13 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size, size_t nelmts, co
     HDassert(io_info->store);
     HDassert(io_info->u.rbuf);
 
+    /* Check for a point selection in the file */
+    if (nelmts > 1 && H5S_SEL_POINTS == H5S_GET_SELECT_TYPE(file_space)) {
+        if (H5D__select_io_points(io_info, elmt_size, nelmts, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTOPERATE, FAIL, "I/O on point selection failed")
+    } /* end if */
     /* Check for only one element in selection */
-    if (nelmts == 1) {
+    else if (nelmts == 1) {
         hsize_t single_mem_off;  /* Offset in memory */
         hsize_t single_file_off; /* Offset in the file */
         size_t  single_mem_len;  /* Length in memory */
@@ -295,3 +295,121 @@ H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__current_cache_size_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__sieve_nwins_test
+ PURPOSE
+    Determine the number of data sieve windows of a contiguous dataset
+ USAGE
+    herr_t H5D__sieve_nwins_test(did, nwins, max_nwins)
+        hid_t did;              IN: Dataset to query
+        unsigned *nwins;        OUT: Pointer to location to place number of windows in use
+        unsigned *max_nwins;    OUT: Pointer to location to place number of windows allowed
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks how many data sieve windows a contiguous dataset uses and may use.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__sieve_nwins_test(hid_t did, unsigned *nwins, unsigned *max_nwins)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    HDassert(dset->shared->layout.type == H5D_CONTIGUOUS);
+
+    if (nwins)
+        *nwins = dset->shared->cache.contig.sieve_nwins;
+    if (max_nwins)
+        *max_nwins = dset->shared->cache.contig.sieve_max_nwins;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__sieve_nwins_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__virtual_open_src_dsets_test
+ PURPOSE
+    Determine the number of open source datasets of virtual datasets
+ USAGE
+    herr_t H5D__virtual_open_src_dsets_test(nopen)
+        size_t *nopen;          OUT: Pointer to location to place number of open source datasets
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks how many source datasets all virtual datasets hold open.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__virtual_open_src_dsets_test(size_t *nopen)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(nopen);
+
+    *nopen = H5D_virtual_src_lru_g.nopen;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__virtual_open_src_dsets_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__virtual_index_test
+ PURPOSE
+    Determine the shape of the mapping index of a virtual dataset
+ USAGE
+    herr_t H5D__virtual_index_test(did, nents, dim)
+        hid_t did;              IN: Dataset to query
+        size_t *nents;          OUT: Pointer to location to place number of indexed mappings
+        unsigned *dim;          OUT: Pointer to location to place dimension the index is built on
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks how many mappings of a virtual dataset are indexed (0 if the
+    dataset has no mapping index) and which dimension the index uses.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__virtual_index_test(hid_t did, size_t *nents, unsigned *dim)
+{
+    H5D_t *                    dset;                /* Pointer to dataset to query */
+    const H5D_virtual_index_t *index;               /* Mapping index */
+    herr_t                     ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if (dset->shared->layout.type != H5D_VIRTUAL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a virtual dataset")
+
+    index = dset->shared->layout.storage.u.virt.index;
+    if (nents)
+        *nents = index ? index->nents : 0;
+    if (dim)
+        *dim = index ? index->dim : 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__virtual_index_test() */
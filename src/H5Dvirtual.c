@@ -73,10 +73,30 @@
 /* Default size for sub_dset array */
 #define H5D_VIRTUAL_DEF_SUB_DSET_SIZE 128
 
+/* Default size for the array of source datasets in an I/O operation */
+#define H5D_VIRTUAL_DEF_IO_LIST_SIZE 16
+
+/* Default size for the array of mappings found in the mapping index */
+#define H5D_VIRTUAL_DEF_INDEX_FOUND_SIZE 16
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Source datasets with elements selected in a virtual dataset I/O operation */
+typedef struct H5D_virtual_io_list_t {
+    H5O_storage_virtual_srcdset_t **src_dsets; /* Source datasets, in mapping order */
+    size_t                          nused;     /* Number of source datasets in the array */
+    size_t                          nalloc;    /* Number of slots allocated in the array */
+} H5D_virtual_io_list_t;
+
+/* Mappings found in the index of a virtual dataset's mappings */
+typedef struct H5D_virtual_index_found_t {
+    size_t *idx;    /* Indices of the mappings in the mapping list */
+    size_t  nused;  /* Number of mappings in the array */
+    size_t  nalloc; /* Number of slots allocated in the array */
+} H5D_virtual_index_found_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -94,6 +114,11 @@ static herr_t H5D__virtual_open_source_dset(const H5D_t *vdset, H5O_storage_virt
                                             H5O_storage_virtual_srcdset_t *source_dset);
 static herr_t H5D__virtual_reset_source_dset(H5O_storage_virtual_ent_t *    virtual_ent,
                                              H5O_storage_virtual_srcdset_t *source_dset);
+static void   H5D__virtual_src_lru_touch(H5O_storage_virtual_srcdset_t *source_dset);
+static void   H5D__virtual_src_lru_replace(H5O_storage_virtual_srcdset_t *old_dset,
+                                           H5O_storage_virtual_srcdset_t *new_dset);
+static herr_t H5D__virtual_src_lru_trim(void);
+static herr_t H5D__virtual_extend_sub_dset(H5O_storage_virtual_ent_t *virtual_ent, size_t new_nalloc);
 static herr_t H5D__virtual_str_append(const char *src, size_t src_len, char **p, char **buf,
                                       size_t *buf_size);
 static herr_t H5D__virtual_copy_parsed_name(H5O_storage_virtual_name_seg_t **dst,
@@ -103,14 +128,29 @@ static herr_t H5D__virtual_build_source_name(char *
                                              size_t static_strlen, size_t nsubs, hsize_t blockno,
                                              char **built_name);
 static herr_t H5D__virtual_init_all(const H5D_t *dset);
+static herr_t H5D__virtual_io_list_add(H5D_virtual_io_list_t *        io_list,
+                                       H5O_storage_virtual_srcdset_t *source_dset);
 static herr_t H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage,
-                                  const H5S_t *file_space, const H5S_t *mem_space, hsize_t *tot_nelmts);
-static herr_t H5D__virtual_post_io(H5O_storage_virtual_t *storage);
+                                  const H5S_t *file_space, const H5S_t *mem_space, hsize_t *tot_nelmts,
+                                  H5D_virtual_io_list_t *io_list);
+static herr_t H5D__virtual_post_io(H5D_virtual_io_list_t *io_list);
 static herr_t H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                     const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset);
 static herr_t H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                      const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset);
 
+/* Mapping index functions */
+static int     H5D__virtual_index_cmp(const void *_ent1, const void *_ent2);
+static int     H5D__virtual_index_idx_cmp(const void *_idx1, const void *_idx2);
+static hsize_t H5D__virtual_index_max_end(H5D_virtual_index_ent_t *ents, size_t lo, size_t hi);
+static herr_t  H5D__virtual_index_build(const H5D_t *dset);
+static void    H5D__virtual_index_free(H5O_storage_virtual_t *storage);
+static herr_t  H5D__virtual_index_search(const H5D_virtual_index_t *index, size_t lo, size_t hi,
+                                         const hsize_t *low, const hsize_t *high,
+                                         H5D_virtual_index_found_t *found);
+static herr_t  H5D__virtual_index_find(const H5D_virtual_index_t *index, const H5S_t *file_space,
+                                       H5D_virtual_index_found_t *found);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -124,6 +164,9 @@ const H5D_layout_ops_t H5D_LOPS_VIRTUAL[1] = {{NULL, H5D__virtual_init, H5D__vir
 #endif /* H5_HAVE_PARALLEL */
                                                NULL, NULL, H5D__virtual_flush, NULL, NULL}};
 
+/* Open source datasets of all virtual datasets */
+H5D_virtual_src_lru_t H5D_virtual_src_lru_g = {NULL, NULL, 0, 0};
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -134,6 +177,9 @@ H5FL_DEFINE(H5O_storage_virtual_name_seg_t);
 /* Declare a static free list to manage H5D_virtual_file_list_t structs */
 H5FL_DEFINE_STATIC(H5D_virtual_held_file_t);
 
+/* Declare a static free list to manage H5D_virtual_index_t structs */
+H5FL_DEFINE_STATIC(H5D_virtual_index_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5D_virtual_check_mapping_pre
  *
@@ -568,6 +614,9 @@ H5D__virtual_copy_layout(H5O_layout_t *layout)
     orig_list         = virt->list;
     virt->list        = NULL;
 
+    /* The mapping index belongs to the original, the copy builds its own */
+    virt->index = NULL;
+
     /* Copy entry list */
     if (virt->list_nused > 0) {
         HDassert(orig_list);
@@ -755,6 +804,9 @@ H5D__virtual_reset_layout(H5O_layout_t *layout)
     virt->list_nused  = (size_t)0;
     (void)HDmemset(virt->min_dims, 0, sizeof(virt->min_dims));
 
+    /* Free the mapping index */
+    H5D__virtual_index_free(virt);
+
     /* Close access property lists */
     if (virt->source_fapl >= 0) {
         if (H5I_dec_ref(virt->source_fapl) < 0)
@@ -941,6 +993,9 @@ H5D__virtual_open_source_dset(const H5D_t *vdset, H5O_storage_virtual_ent_t *vir
             /* Dataset exists */
             source_dset->dset_exists = TRUE;
 
+            /* Keep track of it with the other open source datasets */
+            H5D__virtual_src_lru_touch(source_dset);
+
             /* Patch the source selection if necessary */
             if (virtual_ent->source_space_status != H5O_VIRTUAL_STATUS_CORRECT) {
                 if (H5S_extent_copy(virtual_ent->source_select, source_dset->dset->shared->space) < 0)
@@ -984,6 +1039,7 @@ H5D__virtual_reset_source_dset(H5O_storage_virtual_ent_t *    virtual_ent,
 
     /* Free dataset */
     if (source_dset->dset) {
+        H5D__virtual_src_lru_remove(source_dset);
         if (H5D_close(source_dset->dset) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
         source_dset->dset = NULL;
@@ -1041,6 +1097,216 @@ H5D__virtual_reset_source_dset(H5O_storage_virtual_ent_t *    virtual_ent,
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_reset_source_dset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_src_lru_touch
+ *
+ * Purpose:     Moves an open source dataset to the front of the list of
+ *              open source datasets, adding it to the list if it isn't
+ *              there yet.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_src_lru_touch(H5O_storage_virtual_srcdset_t *source_dset)
+{
+    H5D_virtual_src_lru_t *lru = &H5D_virtual_src_lru_g; /* Convenience pointer */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(source_dset);
+    HDassert(source_dset->dset);
+
+    if (lru->head != source_dset) {
+        /* Take the source dataset out of the list, if it's there */
+        H5D__virtual_src_lru_remove(source_dset);
+
+        /* Put it at the front */
+        source_dset->lru_prev = NULL;
+        source_dset->lru_next = lru->head;
+        if (lru->head)
+            lru->head->lru_prev = source_dset;
+        else
+            lru->tail = source_dset;
+        lru->head = source_dset;
+        lru->nopen++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_src_lru_touch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_src_lru_remove
+ *
+ * Purpose:     Takes a source dataset out of the list of open source
+ *              datasets.  Does nothing if it isn't in the list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__virtual_src_lru_remove(H5O_storage_virtual_srcdset_t *source_dset)
+{
+    H5D_virtual_src_lru_t *lru = &H5D_virtual_src_lru_g; /* Convenience pointer */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(source_dset);
+
+    /* Only the source dataset at the front of the list has no previous one */
+    if (source_dset->lru_prev || lru->head == source_dset) {
+        if (source_dset->lru_prev)
+            source_dset->lru_prev->lru_next = source_dset->lru_next;
+        else
+            lru->head = source_dset->lru_next;
+        if (source_dset->lru_next)
+            source_dset->lru_next->lru_prev = source_dset->lru_prev;
+        else
+            lru->tail = source_dset->lru_prev;
+        source_dset->lru_prev = NULL;
+        source_dset->lru_next = NULL;
+
+        HDassert(lru->nopen > 0);
+        lru->nopen--;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_src_lru_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_src_lru_replace
+ *
+ * Purpose:     Puts new_dset in old_dset's place in the list of open
+ *              source datasets, keeping its recency.  Does nothing if
+ *              old_dset isn't in the list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_src_lru_replace(H5O_storage_virtual_srcdset_t *old_dset, H5O_storage_virtual_srcdset_t *new_dset)
+{
+    H5D_virtual_src_lru_t *lru = &H5D_virtual_src_lru_g; /* Convenience pointer */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(old_dset);
+    HDassert(new_dset);
+
+    if (old_dset->lru_prev || lru->head == old_dset) {
+        new_dset->lru_prev = old_dset->lru_prev;
+        new_dset->lru_next = old_dset->lru_next;
+        if (new_dset->lru_prev)
+            new_dset->lru_prev->lru_next = new_dset;
+        else
+            lru->head = new_dset;
+        if (new_dset->lru_next)
+            new_dset->lru_next->lru_prev = new_dset;
+        else
+            lru->tail = new_dset;
+        old_dset->lru_prev = NULL;
+        old_dset->lru_next = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_src_lru_replace() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_src_lru_trim
+ *
+ * Purpose:     Closes the least recently used source datasets until no
+ *              more than H5D_VIRTUAL_MAX_OPEN_SRC_DSETS are open.  Their
+ *              names and selections are kept, so they are just opened
+ *              again the next time I/O needs them.  Must not be called
+ *              while any virtual dataset I/O is in progress.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_src_lru_trim(void)
+{
+    H5D_virtual_src_lru_t *lru       = &H5D_virtual_src_lru_g; /* Convenience pointer */
+    herr_t                 ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(lru->io_depth == 0);
+
+    while (lru->nopen > H5D_VIRTUAL_MAX_OPEN_SRC_DSETS) {
+        H5O_storage_virtual_srcdset_t *source_dset = lru->tail; /* Source dataset to close */
+        H5D_t *                        dset        = source_dset->dset;
+
+        HDassert(dset);
+        HDassert(!source_dset->projected_mem_space);
+
+        /* Take the source dataset off the list first, closing a virtual
+         * source dataset takes its own source datasets off the list */
+        H5D__virtual_src_lru_remove(source_dset);
+        source_dset->dset = NULL;
+        if (H5D_close(dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_src_lru_trim() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_extend_sub_dset
+ *
+ * Purpose:     Extends the sub-source dataset array of a printf mapping
+ *              to new_nalloc entries, clearing the new ones.  The open
+ *              sub-source datasets keep their places in the list of open
+ *              source datasets.  The array is left alone on failure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_extend_sub_dset(H5O_storage_virtual_ent_t *virtual_ent, size_t new_nalloc)
+{
+    H5O_storage_virtual_srcdset_t *sub_dset;            /* New sub-source dataset array */
+    size_t                         u;                   /* Local index variable */
+    herr_t                         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(virtual_ent);
+    HDassert(virtual_ent->sub_dset);
+    HDassert(new_nalloc > virtual_ent->sub_dset_nalloc);
+
+    /* Allocate a new array instead of reallocating, the list of open source
+     * datasets points into the old one until they are moved over */
+    if (NULL == (sub_dset = (H5O_storage_virtual_srcdset_t *)H5MM_malloc(
+                     new_nalloc * sizeof(H5O_storage_virtual_srcdset_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend sub dataset array")
+    H5MM_memcpy(sub_dset, virtual_ent->sub_dset,
+                virtual_ent->sub_dset_nalloc * sizeof(H5O_storage_virtual_srcdset_t));
+    (void)HDmemset(&sub_dset[virtual_ent->sub_dset_nalloc], 0,
+                   (new_nalloc - virtual_ent->sub_dset_nalloc) * sizeof(H5O_storage_virtual_srcdset_t));
+
+    /* Move the open sub-source datasets over in the list */
+    for (u = 0; u < virtual_ent->sub_dset_nalloc; u++)
+        H5D__virtual_src_lru_replace(&virtual_ent->sub_dset[u], &sub_dset[u]);
+
+    H5MM_xfree(virtual_ent->sub_dset);
+    virtual_ent->sub_dset        = sub_dset;
+    virtual_ent->sub_dset_nalloc = new_nalloc;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_extend_sub_dset() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_str_append
  *
@@ -1585,24 +1851,11 @@ H5D__virtual_set_extent_unlim(const H5D_t *dset)
                             storage->list[i].sub_dset_nalloc = H5D_VIRTUAL_DEF_SUB_DSET_SIZE;
                         } /* end if */
                         else {
-                            H5O_storage_virtual_srcdset_t *tmp_sub_dset;
-
                             /* Extend sub_dset */
-                            if (NULL ==
-                                (tmp_sub_dset = (H5O_storage_virtual_srcdset_t *)H5MM_realloc(
-                                     storage->list[i].sub_dset, 2 * storage->list[i].sub_dset_nalloc *
-                                                                    sizeof(H5O_storage_virtual_srcdset_t))))
-                                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                            if (H5D__virtual_extend_sub_dset(&storage->list[i],
+                                                             2 * storage->list[i].sub_dset_nalloc) < 0)
+                                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                                             "unable to extend sub dataset array")
-                            storage->list[i].sub_dset = tmp_sub_dset;
-
-                            /* Clear new space in sub_dset */
-                            (void)HDmemset(&storage->list[i].sub_dset[storage->list[i].sub_dset_nalloc], 0,
-                                           storage->list[i].sub_dset_nalloc *
-                                               sizeof(H5O_storage_virtual_srcdset_t));
-
-                            /* Update sub_dset_nalloc */
-                            storage->list[i].sub_dset_nalloc *= 2;
                         } /* end else */
                     }     /* end if */
 
@@ -1655,12 +1908,16 @@ H5D__virtual_set_extent_unlim(const H5D_t *dset)
                             /* Update first_missing */
                             first_missing = j + 1;
 
-                            /* Close source dataset so we don't have huge
+                            /* Keep the source dataset open for I/O if there's
+                             * room, otherwise close it so we don't have huge
                              * numbers of datasets open */
-                            if (H5D_close(storage->list[i].sub_dset[j].dset) < 0)
-                                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL,
-                                            "unable to close source dataset")
-                            storage->list[i].sub_dset[j].dset = NULL;
+                            if (H5D_virtual_src_lru_g.nopen > H5D_VIRTUAL_MAX_OPEN_SRC_DSETS) {
+                                H5D__virtual_src_lru_remove(&storage->list[i].sub_dset[j]);
+                                if (H5D_close(storage->list[i].sub_dset[j].dset) < 0)
+                                    HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL,
+                                                "unable to close source dataset")
+                                storage->list[i].sub_dset[j].dset = NULL;
+                            } /* end if */
                         } /* end if */
                     }     /* end else */
                 }         /* end for */
@@ -2058,22 +2315,9 @@ H5D__virtual_init_all(const H5D_t *dset)
                     storage->list[i].sub_dset_nalloc = sub_dset_max;
                 } /* end if */
                 else if (sub_dset_max > storage->list[i].sub_dset_nalloc) {
-                    H5O_storage_virtual_srcdset_t *tmp_sub_dset;
-
                     /* Extend sub_dset array */
-                    if (NULL == (tmp_sub_dset = (H5O_storage_virtual_srcdset_t *)H5MM_realloc(
-                                     storage->list[i].sub_dset,
-                                     sub_dset_max * sizeof(H5O_storage_virtual_srcdset_t))))
-                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend sub dataset array")
-                    storage->list[i].sub_dset = tmp_sub_dset;
-
-                    /* Clear new space in sub_dset */
-                    (void)HDmemset(&storage->list[i].sub_dset[storage->list[i].sub_dset_nalloc], 0,
-                                   (sub_dset_max - storage->list[i].sub_dset_nalloc) *
-                                       sizeof(H5O_storage_virtual_srcdset_t));
-
-                    /* Update sub_dset_nalloc */
-                    storage->list[i].sub_dset_nalloc = sub_dset_max;
+                    if (H5D__virtual_extend_sub_dset(&storage->list[i], sub_dset_max) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to extend sub dataset array")
                 } /* end if */
 
                 /* Iterate over sub dsets */
@@ -2159,6 +2403,273 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_init_all() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_cmp
+ *
+ * Purpose:     Compares two entries of a virtual mapping index by their
+ *              low bounds, then by mapping order.  For use with
+ *              HDqsort().
+ *
+ * Return:      -1, 0 or 1 as the first entry sorts before, with or
+ *              after the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_index_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_virtual_index_ent_t *ent1      = (const H5D_virtual_index_ent_t *)_ent1;
+    const H5D_virtual_index_ent_t *ent2      = (const H5D_virtual_index_ent_t *)_ent2;
+    int                            ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (ent1->start < ent2->start)
+        ret_value = -1;
+    else if (ent1->start > ent2->start)
+        ret_value = 1;
+    else if (ent1->idx < ent2->idx)
+        ret_value = -1;
+    else if (ent1->idx > ent2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_idx_cmp
+ *
+ * Purpose:     Compares two mapping indices.  For use with HDqsort().
+ *
+ * Return:      -1, 0 or 1 as the first index is less than, equal to or
+ *              greater than the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_index_idx_cmp(const void *_idx1, const void *_idx2)
+{
+    size_t idx1      = *(const size_t *)_idx1;
+    size_t idx2      = *(const size_t *)_idx2;
+    int    ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (idx1 < idx2)
+        ret_value = -1;
+    else if (idx1 > idx2)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_idx_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_max_end
+ *
+ * Purpose:     Sets max_end for the entries in [lo, hi) of a virtual
+ *              mapping index, which form the subtree rooted at the middle
+ *              entry.
+ *
+ * Return:      Largest high bound in the subtree (0 if it is empty)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__virtual_index_max_end(H5D_virtual_index_ent_t *ents, size_t lo, size_t hi)
+{
+    size_t  mid;           /* Root of the subtree */
+    hsize_t sub_max_end;   /* Largest high bound in a child subtree */
+    hsize_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (lo < hi) {
+        mid       = lo + (hi - lo) / 2;
+        ret_value = ents[mid].end;
+        if ((sub_max_end = H5D__virtual_index_max_end(ents, lo, mid)) > ret_value)
+            ret_value = sub_max_end;
+        if ((sub_max_end = H5D__virtual_index_max_end(ents, mid + 1, hi)) > ret_value)
+            ret_value = sub_max_end;
+        ents[mid].max_end = ret_value;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_max_end() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_build
+ *
+ * Purpose:     Builds the index of the mappings of a virtual dataset by
+ *              the bounds of their virtual selections, replacing any
+ *              previous index.  Virtual datasets with fewer than
+ *              H5D_VIRTUAL_INDEX_MIN_NENTS mappings are not indexed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_index_build(const H5D_t *dset)
+{
+    H5O_storage_virtual_t *storage;              /* Convenience pointer */
+    H5D_virtual_index_t *  index = NULL;         /* New index */
+    hsize_t                dims[H5S_MAX_RANK];   /* Current VDS dimensions */
+    hsize_t                span;                 /* Size of a dimension covered by the mappings */
+    double                 coverage;             /* Overlap of the mappings in a dimension */
+    double                 best_coverage = -1.0; /* Least overlap found so far */
+    int                    rank;                 /* Rank of the VDS */
+    size_t                 i;                    /* Local index variable */
+    unsigned               u;                    /* Local index variable */
+    herr_t                 ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset);
+    storage = &dset->shared->layout.storage.u.virt;
+
+    /* Free any previous index */
+    H5D__virtual_index_free(storage);
+
+    /* Searching a few mappings directly is cheaper than the index */
+    if (storage->list_nused < H5D_VIRTUAL_INDEX_MIN_NENTS)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get current VDS dimensions */
+    if ((rank = H5S_get_simple_extent_dims(dset->shared->space, dims, NULL)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get VDS dimensions")
+
+    /* Allocate the index */
+    if (NULL == (index = H5FL_CALLOC(H5D_virtual_index_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate virtual mapping index")
+    index->rank  = (unsigned)rank;
+    index->nents = storage->list_nused;
+    if (NULL == (index->ents = (H5D_virtual_index_ent_t *)H5MM_malloc(index->nents *
+                                                                      sizeof(H5D_virtual_index_ent_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate virtual mapping index entries")
+    if (NULL == (index->bounds = (hsize_t *)H5MM_malloc(index->nents * 2 * index->rank * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate virtual mapping bounds")
+
+    /* Get the bounds of the virtual selection of each mapping */
+    for (i = 0; i < index->nents; i++) {
+        const H5S_t *virtual_select = storage->list[i].source_dset.virtual_select;
+        hsize_t *    low            = &index->bounds[2 * index->rank * i];
+        hsize_t *    high           = low + index->rank;
+
+        switch (H5S_GET_SELECT_TYPE(virtual_select)) {
+            case H5S_SEL_NONE:
+                /* Bounds that intersect nothing */
+                for (u = 0; u < index->rank; u++) {
+                    low[u]  = HSIZE_UNDEF;
+                    high[u] = 0;
+                } /* end for */
+                break;
+
+            case H5S_SEL_ALL:
+                /* The whole extent, however the VDS grows */
+                for (u = 0; u < index->rank; u++) {
+                    low[u]  = 0;
+                    high[u] = HSIZE_UNDEF;
+                } /* end for */
+                break;
+
+            case H5S_SEL_ERROR:
+            case H5S_SEL_POINTS:
+            case H5S_SEL_HYPERSLABS:
+            case H5S_SEL_N:
+            default:
+                if (H5S_SELECT_BOUNDS(virtual_select, low, high) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+
+                /* Unlimited selections (including printf mappings) reach the
+                 * end of the VDS in their unlimited dimension */
+                if (storage->list[i].unlim_dim_virtual >= 0)
+                    high[storage->list[i].unlim_dim_virtual] = HSIZE_UNDEF;
+                break;
+        } /* end switch */
+    }     /* end for */
+
+    /* Build the tree on the dimension where the mappings overlap least,
+     * relative to the size of the dimension, so queries find few mappings
+     * that must then be rejected by their other bounds */
+    for (u = 0; u < index->rank; u++) {
+        /* Size of the dimension, at least as large as the limited bounds */
+        span = dims[u];
+        for (i = 0; i < index->nents; i++) {
+            hsize_t high = index->bounds[(2 * i + 1) * index->rank + u];
+
+            if (high != HSIZE_UNDEF && high >= span)
+                span = high + 1;
+        } /* end for */
+        if (span == 0)
+            continue;
+
+        /* Sum of the lengths of the mappings in the dimension */
+        coverage = 0.0;
+        for (i = 0; i < index->nents; i++) {
+            hsize_t low  = index->bounds[2 * i * index->rank + u];
+            hsize_t high = index->bounds[(2 * i + 1) * index->rank + u];
+
+            if (low < span)
+                coverage += (double)(MIN(high, span - 1) - low + 1);
+        } /* end for */
+        coverage /= (double)span;
+
+        if (best_coverage < 0.0 || coverage < best_coverage) {
+            index->dim    = u;
+            best_coverage = coverage;
+        } /* end if */
+    }     /* end for */
+
+    /* Build the tree, sorted by low bound in the chosen dimension */
+    for (i = 0; i < index->nents; i++) {
+        index->ents[i].start = index->bounds[2 * i * index->rank + index->dim];
+        index->ents[i].end   = index->bounds[(2 * i + 1) * index->rank + index->dim];
+        index->ents[i].idx   = i;
+    } /* end for */
+    HDqsort(index->ents, index->nents, sizeof(H5D_virtual_index_ent_t), H5D__virtual_index_cmp);
+    (void)H5D__virtual_index_max_end(index->ents, (size_t)0, index->nents);
+
+    /* Hand the index to the layout */
+    storage->index = index;
+    index          = NULL;
+
+done:
+    if (index) {
+        H5MM_xfree(index->ents);
+        H5MM_xfree(index->bounds);
+        index = H5FL_FREE(H5D_virtual_index_t, index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_free
+ *
+ * Purpose:     Frees the index of the mappings of a virtual dataset, if
+ *              it has one.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_index_free(H5O_storage_virtual_t *storage)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(storage);
+
+    if (storage->index) {
+        H5MM_xfree(storage->index->ents);
+        H5MM_xfree(storage->index->bounds);
+        storage->index = H5FL_FREE(H5D_virtual_index_t, storage->index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_index_free() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_init
  *
@@ -2274,6 +2785,10 @@ H5D__virtual_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
         if ((storage->source_dapl = H5P_copy_plist(dapl, FALSE)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dapl")
 
+    /* Index the mappings by where they are in the VDS */
+    if (H5D__virtual_index_build(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't build virtual mapping index")
+
     /* Mark layout as not fully initialized (must be done prior to I/O for
      * unlimited/printf selections) */
     storage->init = FALSE;
@@ -2361,13 +2876,172 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_is_data_cached() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_io_list_add
+ *
+ * Purpose:     Appends a source dataset to the list of source datasets
+ *              in an I/O operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_io_list_add(H5D_virtual_io_list_t *io_list, H5O_storage_virtual_srcdset_t *source_dset)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_list);
+    HDassert(source_dset);
+
+    /* Make room for another source dataset */
+    if (io_list->nused == io_list->nalloc) {
+        H5O_storage_virtual_srcdset_t **new_src_dsets;
+        size_t                          new_nalloc = MAX(H5D_VIRTUAL_DEF_IO_LIST_SIZE, 2 * io_list->nalloc);
+
+        if (NULL == (new_src_dsets = (H5O_storage_virtual_srcdset_t **)H5MM_realloc(
+                         io_list->src_dsets, new_nalloc * sizeof(H5O_storage_virtual_srcdset_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to extend I/O source dataset list")
+        io_list->src_dsets = new_src_dsets;
+        io_list->nalloc    = new_nalloc;
+    } /* end if */
+
+    io_list->src_dsets[io_list->nused++] = source_dset;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_io_list_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_search
+ *
+ * Purpose:     Adds to found the mappings among the entries in [lo, hi)
+ *              of a virtual mapping index whose bounds intersect the
+ *              bounds low/high.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_index_search(const H5D_virtual_index_t *index, size_t lo, size_t hi, const hsize_t *low,
+                          const hsize_t *high, H5D_virtual_index_found_t *found)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Recurse into the subtree left of each root, then continue with the
+     * subtree right of it */
+    while (lo < hi) {
+        size_t                         mid = lo + (hi - lo) / 2;
+        const H5D_virtual_index_ent_t *ent = &index->ents[mid];
+
+        /* Nothing in this subtree reaches the low bound */
+        if (ent->max_end < low[index->dim])
+            break;
+
+        /* Search the entries starting before this one */
+        if (H5D__virtual_index_search(index, lo, mid, low, high, found) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't search virtual mapping index")
+
+        /* This entry and all after it start past the high bound */
+        if (ent->start > high[index->dim])
+            break;
+
+        /* Check the other dimensions of the mapping's bounds */
+        if (ent->end >= low[index->dim]) {
+            const hsize_t *ent_low  = &index->bounds[2 * ent->idx * index->rank];
+            const hsize_t *ent_high = ent_low + index->rank;
+            unsigned       u;
+
+            for (u = 0; u < index->rank; u++)
+                if (ent_low[u] > high[u] || ent_high[u] < low[u])
+                    break;
+
+            if (u == index->rank) {
+                /* Grow the list if necessary */
+                if (found->nused == found->nalloc) {
+                    size_t  new_nalloc = MAX(H5D_VIRTUAL_DEF_INDEX_FOUND_SIZE, found->nalloc * 2);
+                    size_t *new_idx;
+
+                    if (NULL == (new_idx = (size_t *)H5MM_realloc(found->idx, new_nalloc * sizeof(size_t))))
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to grow found mapping list")
+                    found->idx    = new_idx;
+                    found->nalloc = new_nalloc;
+                } /* end if */
+
+                found->idx[found->nused++] = ent->idx;
+            } /* end if */
+        }     /* end if */
+
+        lo = mid + 1;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_search() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_find
+ *
+ * Purpose:     Finds the mappings of a virtual dataset whose virtual
+ *              selections may intersect file_space, using the mapping
+ *              index.  The mappings are stored in found in mapping order,
+ *              so where they overlap the last one still wins.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_index_find(const H5D_virtual_index_t *index, const H5S_t *file_space,
+                        H5D_virtual_index_found_t *found)
+{
+    hsize_t low[H5S_MAX_RANK];   /* Low bounds of the selection */
+    hsize_t high[H5S_MAX_RANK];  /* High bounds of the selection */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(index);
+    HDassert(file_space);
+    HDassert(found);
+    HDassert(found->nused == 0);
+
+    /* An empty selection intersects no mapping (and has no bounds) */
+    if (H5S_GET_SELECT_NPOINTS(file_space) == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get selection bounds */
+    if (H5S_SELECT_BOUNDS(file_space, low, high) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+
+    /* Search the index */
+    if (H5D__virtual_index_search(index, (size_t)0, index->nents, low, high, found) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't search virtual mapping index")
+
+    /* Put the mappings back in mapping order */
+    if (found->nused > 1)
+        HDqsort(found->idx, found->nused, sizeof(size_t), H5D__virtual_index_idx_cmp);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_find() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_pre_io
  *
  * Purpose:     Project all virtual mappings onto mem_space, with the
  *              results stored in projected_mem_space for each mapping.
  *              Opens all source datasets if possible.  The total number
- *              of elements is stored in tot_nelmts.
+ *              of elements is stored in tot_nelmts, and the source
+ *              datasets with elements selected are added to io_list, so
+ *              the I/O itself only visits those.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2378,15 +3052,17 @@ done:
  */
 static herr_t
 H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, const H5S_t *file_space,
-                    const H5S_t *mem_space, hsize_t *tot_nelmts)
+                    const H5S_t *mem_space, hsize_t *tot_nelmts, H5D_virtual_io_list_t *io_list)
 {
-    hssize_t select_nelmts;              /* Number of elements in selection */
-    hsize_t  bounds_start[H5S_MAX_RANK]; /* Selection bounds start */
-    hsize_t  bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
-    int      rank        = 0;
-    hbool_t  bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
-    size_t   i, j, k;             /* Local index variables */
-    herr_t   ret_value = SUCCEED; /* Return value */
+    H5D_virtual_index_found_t found = {NULL, 0, 0};       /* Mappings found in the mapping index */
+    size_t                    nmaps;                      /* Number of mappings to visit */
+    hssize_t                  select_nelmts;              /* Number of elements in selection */
+    hsize_t                   bounds_start[H5S_MAX_RANK]; /* Selection bounds start */
+    hsize_t                   bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
+    int                       rank        = 0;
+    hbool_t                   bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
+    size_t                    u, i, j, k;          /* Local index variables */
+    herr_t                    ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -2395,6 +3071,7 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
     HDassert(mem_space);
     HDassert(file_space);
     HDassert(tot_nelmts);
+    HDassert(io_list);
 
     /* Initialize layout if necessary */
     if (!storage->init)
@@ -2404,8 +3081,20 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
     /* Initialize tot_nelmts */
     *tot_nelmts = 0;
 
+    /* Only visit the mappings the selection may intersect, if they are
+     * indexed */
+    if (storage->index) {
+        if (H5D__virtual_index_find(storage->index, file_space, &found) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't search virtual mapping index")
+        nmaps = found.nused;
+    } /* end if */
+    else
+        nmaps = storage->list_nused;
+
     /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+    for (u = 0; u < nmaps; u++) {
+        i = storage->index ? found.idx[u] : u;
+
         /* Sanity check that the virtual space has been patched by now */
         HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
@@ -2526,6 +3215,12 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                 /* Only continue if we managed to obtain a
                  * clipped_virtual_select */
                 if (storage->list[i].sub_dset[j].clipped_virtual_select) {
+                    /* Add the sub-source dataset to the I/O list (before
+                     * projecting, so post_io always finds the projection) */
+                    if (H5D__virtual_io_list_add(io_list, &storage->list[i].sub_dset[j]) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTAPPEND, FAIL,
+                                    "unable to add source dataset to I/O list")
+
                     /* Project intersection of file space and mapping virtual space
                      * onto memory space */
                     if (H5S_select_project_intersection(
@@ -2563,14 +3258,23 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                             HGOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL,
                                         "can't close projected memory space")
                         storage->list[i].sub_dset[j].projected_mem_space = NULL;
+                        io_list->nused--;
                     } /* end if */
-                    else
+                    else {
                         *tot_nelmts += (hsize_t)select_nelmts;
+                        if (storage->list[i].sub_dset[j].dset)
+                            H5D__virtual_src_lru_touch(&storage->list[i].sub_dset[j]);
+                    } /* end else */
                 } /* end if */
             }     /* end for */
         }         /* end if */
         else {
             if (storage->list[i].source_dset.clipped_virtual_select) {
+                /* Add the source dataset to the I/O list (before projecting, so
+                 * post_io always finds the projection) */
+                if (H5D__virtual_io_list_add(io_list, &storage->list[i].source_dset) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTAPPEND, FAIL, "unable to add source dataset to I/O list")
+
                 /* Project intersection of file space and mapping virtual space onto
                  * memory space */
                 if (H5S_select_project_intersection(
@@ -2606,9 +3310,13 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                     if (H5S_close(storage->list[i].source_dset.projected_mem_space) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close projected memory space")
                     storage->list[i].source_dset.projected_mem_space = NULL;
+                    io_list->nused--;
                 } /* end if */
-                else
+                else {
                     *tot_nelmts += (hsize_t)select_nelmts;
+                    if (storage->list[i].source_dset.dset)
+                        H5D__virtual_src_lru_touch(&storage->list[i].source_dset);
+                } /* end else */
             } /* end if */
             else {
                 /* If there is no clipped_dim_virtual, this must be an unlimited
@@ -2623,6 +3331,8 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
     }         /* end for */
 
 done:
+    H5MM_xfree(found.idx);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_pre_io() */
 
@@ -2639,37 +3349,30 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__virtual_post_io(H5O_storage_virtual_t *storage)
+H5D__virtual_post_io(H5D_virtual_io_list_t *io_list)
 {
-    size_t i, j;                /* Local index variables */
+    size_t u;                   /* Local index variable */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
-    HDassert(storage);
+    HDassert(io_list);
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++)
-        /* Check for "printf" source dataset resolution */
-        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
-            /* Iterate over sub-source dsets */
-            for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
-                /* Close projected memory space */
-                if (storage->list[i].sub_dset[j].projected_mem_space) {
-                    if (H5S_close(storage->list[i].sub_dset[j].projected_mem_space) < 0)
-                        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close temporary space")
-                    storage->list[i].sub_dset[j].projected_mem_space = NULL;
-                } /* end if */
-        }         /* end if */
-        else
-            /* Close projected memory space */
-            if (storage->list[i].source_dset.projected_mem_space) {
-            if (H5S_close(storage->list[i].source_dset.projected_mem_space) < 0)
+    /* Iterate over source datasets in the I/O */
+    for (u = 0; u < io_list->nused; u++)
+        /* Close projected memory space */
+        if (io_list->src_dsets[u]->projected_mem_space) {
+            if (H5S_close(io_list->src_dsets[u]->projected_mem_space) < 0)
                 HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close temporary space")
-            storage->list[i].source_dset.projected_mem_space = NULL;
+            io_list->src_dsets[u]->projected_mem_space = NULL;
         } /* end if */
 
+    /* Free the list */
+    io_list->src_dsets = (H5O_storage_virtual_srcdset_t **)H5MM_xfree(io_list->src_dsets);
+    io_list->nused     = 0;
+    io_list->nalloc    = 0;
+
     /* Note the lack of a done: label.  This is because there are no HGOTO_ERROR
      * calls.  If one is added, a done: label must also be added */
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2715,7 +3418,7 @@ H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
         /* Perform read on source dataset */
         if (H5D__read(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space,
-                      projected_src_space, io_info->u.rbuf) < 0)
+                      projected_src_space, NULL, io_info->u.rbuf) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read source dataset")
 
         /* Close projected_src_space */
@@ -2752,9 +3455,10 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
                   const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t H5_ATTR_UNUSED *fm)
 {
     H5O_storage_virtual_t *storage;             /* Convenient pointer into layout struct */
+    H5D_virtual_io_list_t  io_list;             /* Source datasets with elements selected */
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
     H5S_t *                fill_space = NULL;   /* Space to fill with fill value */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 u;                   /* Local index variable */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2769,6 +3473,11 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
     storage = &io_info->dset->shared->layout.storage.u.virt;
     HDassert((storage->view == H5D_VDS_FIRST_MISSING) || (storage->view == H5D_VDS_LAST_AVAILABLE));
 
+    /* Source datasets must stay open until the outermost virtual dataset I/O
+     * is done */
+    HDmemset(&io_list, 0, sizeof(io_list));
+    H5D_virtual_src_lru_g.io_depth++;
+
 #ifdef H5_HAVE_PARALLEL
     /* Parallel reads are not supported (yet) */
     if (H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI))
@@ -2776,26 +3485,13 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
 #endif /* H5_HAVE_PARALLEL */
 
     /* Prepare for I/O operation */
-    if (H5D__virtual_pre_io(io_info, storage, file_space, mem_space, &tot_nelmts) < 0)
+    if (H5D__virtual_pre_io(io_info, storage, file_space, mem_space, &tot_nelmts, &io_list) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to prepare for I/O operation")
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
-        /* Sanity check that the virtual space has been patched by now */
-        HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
-
-        /* Check for "printf" source dataset resolution */
-        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
-            /* Iterate over sub-source dsets */
-            for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
-                if (H5D__virtual_read_one(io_info, type_info, file_space, &storage->list[i].sub_dset[j]) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset")
-        } /* end if */
-        else
-            /* Read from source dataset */
-            if (H5D__virtual_read_one(io_info, type_info, file_space, &storage->list[i].source_dset) < 0)
+    /* Read from the source datasets with elements selected */
+    for (u = 0; u < io_list.nused; u++)
+        if (H5D__virtual_read_one(io_info, type_info, file_space, io_list.src_dsets[u]) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset")
-    } /* end for */
 
     /* Fill unmapped part of buffer with fill value */
     if (tot_nelmts < nelmts) {
@@ -2811,21 +3507,11 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
             if (NULL == (fill_space = H5S_copy(mem_space, FALSE, TRUE)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy memory selection")
 
-            /* Iterate over mappings */
-            for (i = 0; i < storage->list_nused; i++)
-                /* Check for "printf" source dataset resolution */
-                if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
-                    /* Iterate over sub-source dsets */
-                    for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
-                        if (storage->list[i].sub_dset[j].projected_mem_space)
-                            if (H5S_select_subtract(fill_space,
-                                                    storage->list[i].sub_dset[j].projected_mem_space) < 0)
-                                HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to clip fill selection")
-                } /* end if */
-                else if (storage->list[i].source_dset.projected_mem_space)
-                    /* Subtract projected memory space from fill space */
-                    if (H5S_select_subtract(fill_space, storage->list[i].source_dset.projected_mem_space) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to clip fill selection")
+            /* Subtract the projected memory spaces of the source datasets
+             * read from fill space */
+            for (u = 0; u < io_list.nused; u++)
+                if (H5S_select_subtract(fill_space, io_list.src_dsets[u]->projected_mem_space) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to clip fill selection")
 
             /* Write fill values to memory buffer */
             if (H5D__fill(io_info->dset->shared->dcpl_cache.fill.buf, io_info->dset->shared->type,
@@ -2854,9 +3540,13 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
 
 done:
     /* Cleanup I/O operation */
-    if (H5D__virtual_post_io(storage) < 0)
+    if (H5D__virtual_post_io(&io_list) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't cleanup I/O operation")
 
+    /* Close source datasets beyond the limit, once no I/O needs them */
+    if (--H5D_virtual_src_lru_g.io_depth == 0 && H5D__virtual_src_lru_trim() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close unused source datasets")
+
     /* Close fill space */
     if (fill_space)
         if (H5S_close(fill_space) < 0)
@@ -2907,7 +3597,7 @@ H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
         /* Perform write on source dataset */
         if (H5D__write(source_dset->dset, type_info->dst_type_id, source_dset->projected_mem_space,
-                       projected_src_space, io_info->u.wbuf) < 0)
+                       projected_src_space, NULL, io_info->u.wbuf) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write to source dataset")
 
         /* Close projected_src_space */
@@ -2944,8 +3634,9 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
                    const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t H5_ATTR_UNUSED *fm)
 {
     H5O_storage_virtual_t *storage;             /* Convenient pointer into layout struct */
+    H5D_virtual_io_list_t  io_list;             /* Source datasets with elements selected */
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 u;                   /* Local index variable */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2960,6 +3651,11 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
     storage = &io_info->dset->shared->layout.storage.u.virt;
     HDassert((storage->view == H5D_VDS_FIRST_MISSING) || (storage->view == H5D_VDS_LAST_AVAILABLE));
 
+    /* Source datasets must stay open until the outermost virtual dataset I/O
+     * is done */
+    HDmemset(&io_list, 0, sizeof(io_list));
+    H5D_virtual_src_lru_g.io_depth++;
+
 #ifdef H5_HAVE_PARALLEL
     /* Parallel writes are not supported (yet) */
     if (H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI))
@@ -2967,7 +3663,7 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
 #endif /* H5_HAVE_PARALLEL */
 
     /* Prepare for I/O operation */
-    if (H5D__virtual_pre_io(io_info, storage, file_space, mem_space, &tot_nelmts) < 0)
+    if (H5D__virtual_pre_io(io_info, storage, file_space, mem_space, &tot_nelmts, &io_list) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to prepare for I/O operation")
 
     /* Fail if there are unmapped parts of the selection as they would not be
@@ -2976,29 +3672,20 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
         HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
                     "write requested to unmapped portion of virtual dataset")
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
-        /* Sanity check that virtual space has been patched by now */
-        HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
-
-        /* Check for "printf" source dataset resolution */
-        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
-            /* Iterate over sub-source dsets */
-            for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
-                if (H5D__virtual_write_one(io_info, type_info, file_space, &storage->list[i].sub_dset[j]) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write to source dataset")
-        } /* end if */
-        else
-            /* Write to source dataset */
-            if (H5D__virtual_write_one(io_info, type_info, file_space, &storage->list[i].source_dset) < 0)
+    /* Write to the source datasets with elements selected */
+    for (u = 0; u < io_list.nused; u++)
+        if (H5D__virtual_write_one(io_info, type_info, file_space, io_list.src_dsets[u]) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write to source dataset")
-    } /* end for */
 
 done:
     /* Cleanup I/O operation */
-    if (H5D__virtual_post_io(storage) < 0)
+    if (H5D__virtual_post_io(&io_list) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't cleanup I/O operation")
 
+    /* Close source datasets beyond the limit, once no I/O needs them */
+    if (--H5D_virtual_src_lru_g.io_depth == 0 && H5D__virtual_src_lru_trim() < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close unused source datasets")
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_write() */
 
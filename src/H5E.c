@@ -1024,6 +1024,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E__get_current_stack() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5E_get_current_stack_id
+ *
+ * Purpose:     Moves the errors on the current thread's error stack to a
+ *              new error stack, and registers it with an internal ID.
+ *              Used to keep the errors from operations that complete in
+ *              the background.
+ *
+ * Return:      Success:    Error stack ID
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5E_get_current_stack_id(void)
+{
+    H5E_t *stk       = NULL;            /* Error stack */
+    hid_t  ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Get the current stack */
+    if (NULL == (stk = H5E__get_current_stack()))
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTCREATE, H5I_INVALID_HID, "can't create error stack")
+
+    /* Register the stack */
+    if ((ret_value = H5I_register(H5I_ERROR_STACK, stk, FALSE)) < 0)
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTREGISTER, H5I_INVALID_HID, "can't create error stack")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_get_current_stack_id() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Eset_current_stack
  *
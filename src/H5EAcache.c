@@ -253,20 +253,22 @@ H5EA__cache_hdr_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5EA__cache_hdr_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5EA__cache_hdr_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *      image = (const uint8_t *)_image;       /* Pointer into raw data buffer */
+    H5EA_hdr_cache_ud_t *udata = (H5EA_hdr_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t             stored_chksum;                         /* Stored metadata checksum value */
+    uint32_t             computed_chksum;                       /* Computed metadata checksum value */
+    htri_t               ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -490,7 +492,7 @@ H5EA__cache_hdr_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED le
     H5F_addr_encode(f, &image, hdr->idx_blk_addr); /* Address of index block */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -663,9 +665,10 @@ H5EA__cache_iblock_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5EA__cache_iblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5EA__cache_iblock_verify_chksum(const void *_image, size_t len, void *_udata)
 {
     const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
+    H5EA_hdr_t *   udata = (H5EA_hdr_t *)_udata;    /* User data for callback */
     uint32_t       stored_chksum;                   /* Stored metadata checksum value */
     uint32_t       computed_chksum;                 /* Computed metadata checksum value */
     htri_t         ret_value = TRUE;
@@ -674,9 +677,10 @@ H5EA__cache_iblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UN
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -895,7 +899,7 @@ H5EA__cache_iblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED
     } /* end if */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1083,20 +1087,22 @@ H5EA__cache_sblock_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5EA__cache_sblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5EA__cache_sblock_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *         image = (const uint8_t *)_image;          /* Pointer into raw data buffer */
+    H5EA_sblock_cache_ud_t *udata = (H5EA_sblock_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                stored_chksum;                            /* Stored metadata checksum value */
+    uint32_t                computed_chksum;                          /* Computed metadata checksum value */
+    htri_t                  ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->hdr->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1300,7 +1306,7 @@ H5EA__cache_sblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED
         H5F_addr_encode(f, &image, sblock->dblk_addrs[u]);
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1509,20 +1515,22 @@ H5EA__cache_dblock_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5EA__cache_dblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5EA__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *         image = (const uint8_t *)_image;          /* Pointer into raw data buffer */
+    H5EA_dblock_cache_ud_t *udata = (H5EA_dblock_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                stored_chksum;                            /* Stored metadata checksum value */
+    uint32_t                computed_chksum;                          /* Computed metadata checksum value */
+    htri_t                  ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->hdr->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1725,7 +1733,7 @@ H5EA__cache_dblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED
     } /* end if */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1954,20 +1962,22 @@ H5EA__cache_dblk_page_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5EA__cache_dblk_page_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5EA__cache_dblk_page_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *            image = (const uint8_t *)_image;             /* Pointer into raw data buffer */
+    H5EA_dblk_page_cache_ud_t *udata = (H5EA_dblk_page_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                   stored_chksum;                               /* Stored metadata checksum value */
+    uint32_t                   computed_chksum;                             /* Computed metadata checksum value */
+    htri_t                     ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->hdr->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -2091,8 +2101,7 @@ H5EA__cache_dblk_page_image_len(const void *_thing, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5EA__cache_dblk_page_serialize(const H5F_t H5_ATTR_NDEBUG_UNUSED *f, void *_image, size_t H5_ATTR_UNUSED len,
-                                void *_thing)
+H5EA__cache_dblk_page_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED len, void *_thing)
 {
     H5EA_dblk_page_t *dblk_page = (H5EA_dblk_page_t *)_thing; /* Pointer to the object to serialize */
     uint8_t *         image     = (uint8_t *)_image;          /* Pointer into raw data buffer */
@@ -2118,7 +2127,7 @@ H5EA__cache_dblk_page_serialize(const H5F_t H5_ATTR_NDEBUG_UNUSED *f, void *_ima
     image += (dblk_page->hdr->dblk_page_nelmts * dblk_page->hdr->cparam.raw_elmt_size);
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
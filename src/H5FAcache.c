@@ -199,20 +199,22 @@ H5FA__cache_hdr_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5FA__cache_hdr_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5FA__cache_hdr_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *      image = (const uint8_t *)_image;       /* Pointer into raw data buffer */
+    H5FA_hdr_cache_ud_t *udata = (H5FA_hdr_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t             stored_chksum;                         /* Stored metadata checksum value */
+    uint32_t             computed_chksum;                       /* Computed metadata checksum value */
+    htri_t               ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -412,7 +414,7 @@ H5FA__cache_hdr_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED le
     H5F_addr_encode(f, &image, hdr->dblk_addr); /* Address of fixed array data block */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -601,20 +603,22 @@ H5FA__cache_dblock_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5FA__cache_dblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5FA__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *         image = (const uint8_t *)_image;          /* Pointer into raw data buffer */
+    H5FA_dblock_cache_ud_t *udata = (H5FA_dblock_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                stored_chksum;                            /* Stored metadata checksum value */
+    uint32_t                computed_chksum;                          /* Computed metadata checksum value */
+    htri_t                  ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->hdr->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -817,7 +821,7 @@ H5FA__cache_dblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED
     }
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1027,20 +1031,22 @@ H5FA__cache_dblk_page_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5FA__cache_dblk_page_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5FA__cache_dblk_page_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;
+    const uint8_t *            image = (const uint8_t *)_image;             /* Pointer into raw data buffer */
+    H5FA_dblk_page_cache_ud_t *udata = (H5FA_dblk_page_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                   stored_chksum;                               /* Stored metadata checksum value */
+    uint32_t                   computed_chksum;                             /* Computed metadata checksum value */
+    htri_t                     ret_value = TRUE;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->hdr->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1165,8 +1171,7 @@ H5FA__cache_dblk_page_image_len(const void *_thing, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FA__cache_dblk_page_serialize(const H5F_t H5_ATTR_NDEBUG_UNUSED *f, void *_image, size_t H5_ATTR_UNUSED len,
-                                void *_thing)
+H5FA__cache_dblk_page_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNUSED len, void *_thing)
 {
     H5FA_dblk_page_t *dblk_page = (H5FA_dblk_page_t *)_thing; /* Pointer to the object to serialize */
     uint8_t *         image     = (uint8_t *)_image;          /* Pointer into raw data buffer */
@@ -1192,7 +1197,7 @@ H5FA__cache_dblk_page_serialize(const H5F_t H5_ATTR_NDEBUG_UNUSED *f, void *_ima
     image += (dblk_page->nelmts * dblk_page->hdr->cparam.raw_elmt_size);
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
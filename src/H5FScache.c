@@ -185,20 +185,22 @@ H5FS__cache_hdr_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 htri_t
-H5FS__cache_hdr_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5FS__cache_hdr_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *      image = (const uint8_t *)_image;       /* Pointer into raw data buffer */
+    H5FS_hdr_cache_ud_t *udata = (H5FS_hdr_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t             stored_chksum;                         /* Stored metadata checksum value */
+    uint32_t             computed_chksum;                       /* Computed metadata checksum value */
+    htri_t               ret_value = TRUE;                      /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -761,7 +763,7 @@ H5FS__cache_hdr_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_NDEBUG_UN
     H5F_ENCODE_LENGTH(f, image, fspace->alloc_sect_size);
 
     /* Compute checksum */
-    metadata_chksum = H5_checksum_metadata((uint8_t *)_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, (uint8_t *)_image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -919,20 +921,22 @@ H5FS__cache_sinfo_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 htri_t
-H5FS__cache_sinfo_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5FS__cache_sinfo_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *        image = (const uint8_t *)_image;         /* Pointer into raw data buffer */
+    H5FS_sinfo_cache_ud_t *udata = (H5FS_sinfo_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t               stored_chksum;                           /* Stored metadata checksum value */
+    uint32_t               computed_chksum;                         /* Computed metadata checksum value */
+    htri_t                 ret_value = TRUE;                        /* Return value */
 
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1289,7 +1293,7 @@ H5FS__cache_sinfo_serialize(const H5F_t *f, void *_image, size_t len, void *_thi
 
     /* There may be empty space between entries and chksum */
     chksum_image    = (uint8_t *)(_image) + len - H5FS_SIZEOF_CHKSUM;
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(chksum_image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(chksum_image - (uint8_t *)_image), 0);
     /* Metadata checksum */
     UINT32ENCODE(chksum_image, metadata_chksum);
 
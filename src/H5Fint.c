@@ -31,6 +31,7 @@
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5Lprivate.h"  /* Links                                    */
+#include "H5Mprivate.h"  /* Maps                                     */
 #include "H5MFprivate.h" /* File memory management                   */
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
@@ -698,8 +699,8 @@ H5F__get_objects_cb(void *obj_ptr, hid_t obj_id, void *key)
                 break;
 
             case H5I_MAP:
-                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5_ITER_ERROR,
-                            "maps not supported in native VOL connector")
+                oloc = H5M_oloc((H5M_t *)obj_ptr);
+                break;
 
             case H5I_UNINIT:
             case H5I_BADID:
@@ -1184,6 +1185,8 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         if (H5P_get(plist, H5F_CRT_FILE_SPACE_PAGE_SIZE_NAME, &f->shared->fs_page_size) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get file space page size")
         HDassert(f->shared->fs_page_size >= H5F_FILE_SPACE_PAGE_SIZE_MIN);
+        if (H5P_get(plist, H5F_CRT_METADATA_CHECKSUM_NAME, &f->shared->meta_chksum_alg) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata checksum algorithm")
 
         /* Temporary for multi/split drivers: fail file creation
          * when persisting free-space or using paged aggregation strategy.
@@ -1225,6 +1228,7 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         if (H5P_get(plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'small data' cache size")
         f->shared->sdata_aggr.feature_flag = H5FD_FEAT_AGGREGATE_SMALLDATA;
+        f->shared->ohdr_resv.addr         = HADDR_UNDEF;
         if (H5P_get(plist, H5F_ACS_EFC_SIZE_NAME, &efc_size) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get elink file cache size")
         if (efc_size > 0)
@@ -1578,6 +1582,9 @@ H5F__dest(H5F_t *f, hbool_t flush)
         if (H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if (H5G_path_cache_dest(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
 
         /* Destroy file creation properties */
         if (H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -2955,6 +2962,30 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_path_cache
+ *
+ * Purpose:     Set the path_cache field, to a new path-resolution cache or
+ *              to NULL when the cache is released.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_path_cache(H5F_t *f, H5G_path_cache_t *pc)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->path_cache = pc;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_path_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
  *
@@ -3844,6 +3875,11 @@ H5F__format_convert(H5F_t *f)
     HDassert(f);
     HDassert(f->shared);
 
+    /* Metadata checksummed with a non-default algorithm can't be read by 1.8 */
+    if (f->shared->meta_chksum_alg != H5F_METADATA_CHECKSUM_LOOKUP3)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL,
+                    "can't downgrade file with non-default metadata checksum algorithm")
+
     /* Check if the superblock should be downgraded */
     if (f->shared->sblock->super_vers > HDF5_SUPERBLOCK_VERSION_V18_LATEST) {
         f->shared->sblock->super_vers = HDF5_SUPERBLOCK_VERSION_V18_LATEST;
@@ -370,11 +370,13 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5F_get_checksums(const uint8_t *buf, size_t buf_size, uint32_t *s_chksum /*out*/, uint32_t *c_chksum /*out*/)
+H5F_get_checksums(const H5F_t *f, const uint8_t *buf, size_t buf_size, uint32_t *s_chksum /*out*/,
+                  uint32_t *c_chksum /*out*/)
 {
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     /* Check arguments */
+    HDassert(f);
     HDassert(buf);
     HDassert(buf_size);
 
@@ -391,7 +393,40 @@ H5F_get_checksums(const uint8_t *buf, size_t buf_size, uint32_t *s_chksum /*out*
 
     /* Return the computed checksum for the buffer */
     if (c_chksum)
-        *c_chksum = H5_checksum_metadata(buf, buf_size - H5_SIZEOF_CHKSUM, 0);
+        *c_chksum = H5F_checksum_metadata(f, buf, buf_size - H5_SIZEOF_CHKSUM, 0);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5F_get_chksums() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_checksum_metadata
+ *
+ * Purpose:     Compute the checksum of a piece of metadata for a file,
+ *              with the algorithm recorded in the file's superblock.
+ *
+ * Note:        The superblock itself is always checksummed with
+ *              H5_checksum_metadata(), since it must be verified before
+ *              the algorithm for the rest of the file is known.
+ *
+ * Return:      Checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5F_checksum_metadata(const H5F_t *f, const void *data, size_t len, uint32_t initval)
+{
+    uint32_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if (f->shared->meta_chksum_alg == H5F_METADATA_CHECKSUM_CRC32C)
+        ret_value = H5_checksum_crc32c(data, len, initval);
+    else
+        ret_value = H5_checksum_metadata(data, len, initval);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_checksum_metadata() */
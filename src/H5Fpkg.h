@@ -125,10 +125,14 @@
      + (sizeof_addr)      /* EOF address */                                                                  \
      + (sizeof_addr)      /* root group object header address */                                             \
      + H5F_SIZEOF_CHKSUM) /* superblock checksum (keep this last) */
+#define H5F_SUPERBLOCK_VARLEN_SIZE_V4(sizeof_addr)                                                           \
+    (H5F_SUPERBLOCK_VARLEN_SIZE_V2(sizeof_addr) /* Version 2 variable-length info */                         \
+     + 1)                                       /* metadata checksum algorithm */
 #define H5F_SUPERBLOCK_VARLEN_SIZE(v, sizeof_addr, sizeof_size)                                              \
     ((v == 0 ? H5F_SUPERBLOCK_VARLEN_SIZE_V0(sizeof_addr, sizeof_size) : 0) +                                \
      (v == 1 ? H5F_SUPERBLOCK_VARLEN_SIZE_V1(sizeof_addr, sizeof_size) : 0) +                                \
-     (v >= 2 ? H5F_SUPERBLOCK_VARLEN_SIZE_V2(sizeof_addr) : 0))
+     ((v == 2 || v == 3) ? H5F_SUPERBLOCK_VARLEN_SIZE_V2(sizeof_addr) : 0) +                                 \
+     (v >= 4 ? H5F_SUPERBLOCK_VARLEN_SIZE_V4(sizeof_addr) : 0))
 
 /* Total size of superblock, depends on superblock version */
 #define H5F_SUPERBLOCK_SIZE(s)                                                                               \
@@ -198,6 +202,13 @@ typedef struct H5F_meta_accum_t {
     hbool_t        dirty;      /* Flag to indicate that the accumulated metadata is dirty */
 } H5F_meta_accum_t;
 
+/* Structure for file space reserved for the object headers of a batch of new objects */
+typedef struct H5F_ohdr_resv_t {
+    size_t  nobjs; /* Number of object headers left to allocate in the batch */
+    haddr_t addr;  /* Location of reserved space left */
+    hsize_t size;  /* Size of reserved space left */
+} H5F_ohdr_resv_t;
+
 /* A record of the mount table */
 typedef struct H5F_mount_t {
     struct H5G_t *group; /* Mount point group held open		*/
@@ -305,6 +316,7 @@ struct H5F_shared_t {
     struct H5G_t *       root_grp;          /* Open root group			*/
     H5FO_t *             open_objs;         /* Open objects in file                 */
     H5UC_t *             grp_btree_shared;  /* Ref-counted group B-tree node info   */
+    H5G_path_cache_t *   path_cache;        /* Links found when resolving paths     */
     hbool_t              use_file_locking;  /* Whether or not to use file locking */
     hbool_t              closing;           /* File is in the process of being closed */
 
@@ -339,13 +351,17 @@ struct H5F_shared_t {
     /* Free-space aggregation info */
     unsigned   fs_aggr_merge[H5FD_MEM_NTYPES]; /* Flags for whether free space can merge with aggregator(s) */
     H5FD_mem_t fs_type_map[H5FD_MEM_NTYPES];   /* Mapping of "real" file space type into tracked type */
-    H5F_blk_aggr_t meta_aggr;  /* Metadata aggregation info (if aggregating metadata allocations) */
-    H5F_blk_aggr_t sdata_aggr; /* "Small data" aggregation info (if aggregating "small data" allocations) */
+    H5F_blk_aggr_t  meta_aggr;  /* Metadata aggregation info (if aggregating metadata allocations) */
+    H5F_blk_aggr_t  sdata_aggr; /* "Small data" aggregation info (if aggregating "small data" allocations) */
+    H5F_ohdr_resv_t ohdr_resv;  /* Space reserved for the object headers of a batch of new objects */
 
     /* Paged aggregation info */
     hsize_t fs_page_size;     /* File space page size */
     size_t  pgend_meta_thres; /* Do not track page end meta section <= this threshold */
 
+    /* Metadata checksum info */
+    H5F_metadata_checksum_t meta_chksum_alg; /* Checksum algorithm for file metadata */
+
     /* Metadata accumulator information */
     H5F_meta_accum_t accum; /* Metadata accumulator info */
 
@@ -364,6 +364,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F)          ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_PATH_CACHE(F)                ((F)->shared->path_cache)
+#define H5F_SET_PATH_CACHE(F, PC)        ((F)->shared->path_cache = (PC), SUCCEED)
 #define H5F_USE_TMP_SPACE(F)             ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -427,6 +429,8 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F)          (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_PATH_CACHE(F)                (H5F_path_cache(F))
+#define H5F_SET_PATH_CACHE(F, PC)        (H5F_set_path_cache((F), (PC)))
 #define H5F_USE_TMP_SPACE(F)             (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -550,6 +554,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_CRT_FREE_SPACE_PERSIST_NAME   "free_space_persist"   /* Free-space persisting status */
 #define H5F_CRT_FREE_SPACE_THRESHOLD_NAME "free_space_threshold" /* Free space section threshold */
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_NAME "file_space_page_size" /* File space page size */
+#define H5F_CRT_METADATA_CHECKSUM_NAME    "metadata_checksum"    /* Metadata checksum algorithm */
 
 /* ========= File Access properties ============ */
 #define H5F_ACS_META_CACHE_INIT_CONFIG_NAME                                                                  \
@@ -638,7 +643,9 @@ typedef struct H5F_t H5F_t;
 #define HDF5_SUPERBLOCK_VERSION_2   2 /* Revised version with superblock extension and checksum */
 #define HDF5_SUPERBLOCK_VERSION_3                                                                            \
     3 /* With file locking and consistency flags (at least this version for SWMR support) */
-#define HDF5_SUPERBLOCK_VERSION_LATEST HDF5_SUPERBLOCK_VERSION_3 /* The maximum super block format    */
+#define HDF5_SUPERBLOCK_VERSION_4                                                                            \
+    4 /* With metadata checksum algorithm (only used for non-default algorithms) */
+#define HDF5_SUPERBLOCK_VERSION_LATEST HDF5_SUPERBLOCK_VERSION_4 /* The maximum super block format    */
 #define HDF5_SUPERBLOCK_VERSION_V18_LATEST                                                                   \
     HDF5_SUPERBLOCK_VERSION_2       /* The latest superblock version for v18 */
 #define HDF5_FREESPACE_VERSION    0 /* of the Free-Space Info      */
@@ -755,6 +762,7 @@ typedef struct H5F_t H5F_t;
 /* Forward declarations (for prototypes & type definitions) */
 struct H5B_class_t;
 struct H5UC_t;
+struct H5G_path_cache_t;
 struct H5G_loc_t;
 struct H5O_loc_t;
 struct H5HG_heap_t;
@@ -899,6 +907,10 @@ H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
 H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
 H5_DLL char *  H5F_mdc_log_location(const H5F_t *f);
 
+/* Path-resolution cache for the file's groups */
+H5_DLL struct H5G_path_cache_t *H5F_path_cache(const H5F_t *f);
+H5_DLL herr_t                   H5F_set_path_cache(H5F_t *f, struct H5G_path_cache_t *pc);
+
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t   H5F_get_driver_id(const H5F_t *f);
 H5_DLL herr_t  H5F_get_fileno(const H5F_t *f, unsigned long *filenum);
@@ -929,7 +941,9 @@ H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
 H5_DLL herr_t H5F_evict_tagged_metadata(H5F_t *f, haddr_t tag);
 
 /* Functions that verify a piece of metadata with checksum */
-H5_DLL herr_t H5F_get_checksums(const uint8_t *buf, size_t chk_size, uint32_t *s_chksum, uint32_t *c_chksum);
+H5_DLL herr_t   H5F_get_checksums(const H5F_t *f, const uint8_t *buf, size_t chk_size, uint32_t *s_chksum,
+                                  uint32_t *c_chksum);
+H5_DLL uint32_t H5F_checksum_metadata(const H5F_t *f, const void *data, size_t len, uint32_t initval);
 
 /* Routine to track the # of retries */
 H5_DLL herr_t H5F_track_metadata_read_retries(H5F_t *f, unsigned actype, unsigned retries);
@@ -210,6 +210,19 @@ typedef enum H5F_fspace_strategy_t {
 } H5F_fspace_strategy_t;
 //! <!-- [H5F_fspace_strategy_t_snip] -->
 
+/**
+ * Checksum algorithm for file metadata
+ */
+//! <!-- [H5F_metadata_checksum_t_snip] -->
+typedef enum H5F_metadata_checksum_t {
+    H5F_METADATA_CHECKSUM_LOOKUP3 = 0, /**< Jenkins' lookup3 hash, readable by all versions of the library
+                                          that checksum metadata.  This is the library default */
+    H5F_METADATA_CHECKSUM_CRC32C = 1,  /**< CRC-32C (Castagnoli), computed in hardware when the CPU supports
+                                          it.  Requires a version 4 superblock */
+    H5F_METADATA_CHECKSUM_NTYPES       /**< Sentinel */
+} H5F_metadata_checksum_t;
+//! <!-- [H5F_metadata_checksum_t_snip] -->
+
 /**
  * File space handling strategy for release 1.10.0
  *
@@ -688,6 +688,28 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_path_cache
+ *
+ * Purpose:  Retrieve the file's path-resolution cache.
+ *
+ * Return:   Success:    The path-resolution cache, or NULL if nothing
+ *                       has been cached for the file yet.
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+H5G_path_cache_t *
+H5F_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->path_cache)
+} /* end H5F_path_cache() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
  *
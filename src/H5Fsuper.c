@@ -36,6 +36,14 @@
 /* Local Macros */
 /****************/
 
+/* Highest superblock version allowed by a file's high bound.  Version 4 is
+ * only written for files using a non-default metadata checksum algorithm,
+ * so it's not the default version for any bound, but is allowed by "latest".
+ */
+#define H5F_SUPER_VERS_HIGH_BOUND(f)                                                                         \
+    ((f)->shared->high_bound == H5F_LIBVER_LATEST ? HDF5_SUPERBLOCK_VERSION_LATEST                           \
+                                                  : HDF5_superblock_ver_bounds[(f)->shared->high_bound])
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -67,11 +75,11 @@ H5FL_DEFINE(H5F_super_t);
 
 /* Format version bounds for superblock */
 static const unsigned HDF5_superblock_ver_bounds[] = {
-    HDF5_SUPERBLOCK_VERSION_DEF,   /* H5F_LIBVER_EARLIEST */
-    HDF5_SUPERBLOCK_VERSION_2,     /* H5F_LIBVER_V18 */
-    HDF5_SUPERBLOCK_VERSION_3,     /* H5F_LIBVER_V110 */
-    HDF5_SUPERBLOCK_VERSION_3,     /* H5F_LIBVER_V112 */
-    HDF5_SUPERBLOCK_VERSION_LATEST /* H5F_LIBVER_LATEST */
+    HDF5_SUPERBLOCK_VERSION_DEF, /* H5F_LIBVER_EARLIEST */
+    HDF5_SUPERBLOCK_VERSION_2,   /* H5F_LIBVER_V18 */
+    HDF5_SUPERBLOCK_VERSION_3,   /* H5F_LIBVER_V110 */
+    HDF5_SUPERBLOCK_VERSION_3,   /* H5F_LIBVER_V112 */
+    HDF5_SUPERBLOCK_VERSION_3    /* H5F_LIBVER_LATEST */
 };
 
 /*-------------------------------------------------------------------------
@@ -487,7 +495,7 @@ H5F__super_read(H5F_t *f, H5P_genplist_t *fa_plist, hbool_t initial_read)
         f->shared->low_bound = MAX(H5F_LIBVER_V110, f->shared->low_bound);
 
     /* Version bounds check */
-    if (sblock->super_vers > HDF5_superblock_ver_bounds[f->shared->high_bound])
+    if (sblock->super_vers > H5F_SUPER_VERS_HIGH_BOUND(f))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "superblock version exceeds high bound")
 
     /* Pin the superblock in the cache */
@@ -529,6 +537,8 @@ H5F__super_read(H5F_t *f, H5P_genplist_t *fa_plist, hbool_t initial_read)
     /* Set information in the file's creation property list */
     if (H5P_set(c_plist, H5F_CRT_SUPER_VERS_NAME, &sblock->super_vers) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set superblock version")
+    if (H5P_set(c_plist, H5F_CRT_METADATA_CHECKSUM_NAME, &f->shared->meta_chksum_alg) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set metadata checksum algorithm")
     if (H5P_set(c_plist, H5F_CRT_ADDR_BYTE_NUM_NAME, &sblock->sizeof_addr) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set byte number in an address")
     if (H5P_set(c_plist, H5F_CRT_OBJ_BYTE_NUM_NAME, &sblock->sizeof_size) < 0)
@@ -1185,8 +1195,12 @@ H5F__super_init(H5F_t *f)
     /* Finalize superblock version to that allowed by the file's low bound if higher */
     super_vers = MAX(super_vers, HDF5_superblock_ver_bounds[f->shared->low_bound]);
 
+    /* A non-default metadata checksum algorithm is recorded in a version 4 superblock */
+    if (f->shared->meta_chksum_alg != H5F_METADATA_CHECKSUM_LOOKUP3)
+        super_vers = HDF5_SUPERBLOCK_VERSION_4;
+
     /* Version bounds check */
-    if (super_vers > HDF5_superblock_ver_bounds[f->shared->high_bound])
+    if (super_vers > H5F_SUPER_VERS_HIGH_BOUND(f))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "superblock version out of bounds")
 
     /* If a newer superblock version is required, set it here */
@@ -385,9 +385,14 @@ H5F__cache_superblock_verify_chksum(const void *_image, size_t len, void *_udata
 
     /* No checksum for version 0 & 1 */
     if (udata->super_vers >= HDF5_SUPERBLOCK_VERSION_2) {
+        const uint8_t *chk_p = image + len - H5F_SIZEOF_CHKSUM; /* Pointer to the stored checksum */
 
-        /* Get stored and computed checksums */
-        H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+        /* Get stored and computed checksums.  The superblock records the
+         * metadata checksum algorithm for the rest of the file, so it is
+         * always checksummed with the default algorithm.
+         */
+        UINT32DECODE(chk_p, stored_chksum);
+        computed_chksum = H5_checksum_metadata(image, len - H5F_SIZEOF_CHKSUM, 0);
 
         if (stored_chksum != computed_chksum)
             ret_value = FALSE;
@@ -561,6 +566,17 @@ H5F__cache_superblock_deserialize(const void *_image, size_t H5_ATTR_NDEBUG_UNUS
         H5F_addr_decode(udata->f, (const uint8_t **)&image, &udata->stored_eof /*out*/);
         H5F_addr_decode(udata->f, (const uint8_t **)&image, &sblock->root_addr /*out*/);
 
+        /* Metadata checksum algorithm for the rest of the file */
+        if (sblock->super_vers >= HDF5_SUPERBLOCK_VERSION_4) {
+            unsigned meta_chksum_alg = *image++;
+
+            if (meta_chksum_alg >= H5F_METADATA_CHECKSUM_NTYPES)
+                HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, NULL, "bad metadata checksum algorithm in superblock")
+            udata->f->shared->meta_chksum_alg = (H5F_metadata_checksum_t)meta_chksum_alg;
+        } /* end if */
+        else
+            udata->f->shared->meta_chksum_alg = H5F_METADATA_CHECKSUM_LOOKUP3;
+
         /* checksum verification already done in verify_chksum cb */
 
         /* Decode checksum */
@@ -739,6 +755,12 @@ H5F__cache_superblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_UNU
         /* Encode address of root group's object header */
         H5F_addr_encode(f, &image, root_oloc->addr);
 
+        /* Encode the metadata checksum algorithm for the rest of the file */
+        if (sblock->super_vers >= HDF5_SUPERBLOCK_VERSION_4)
+            *image++ = (uint8_t)f->shared->meta_chksum_alg;
+        else
+            HDassert(f->shared->meta_chksum_alg == H5F_METADATA_CHECKSUM_LOOKUP3);
+
         /* Compute superblock checksum */
         chksum = H5_checksum_metadata(_image, ((size_t)H5F_SUPERBLOCK_SIZE(sblock) - H5F_SIZEOF_CHKSUM), 0);
 
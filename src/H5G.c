@@ -86,9 +86,12 @@
 #include "H5ESprivate.h" /* Event Sets                               */
 #include "H5Gpkg.h"      /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -361,6 +364,149 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Gcreate_anon() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Gcreate_multi
+ *
+ * Purpose:     Creates COUNT new groups in the group at LOC_ID, named
+ *              NAME[I] and created with GCPL_ID[I], just as H5Gcreate2()
+ *              would, and returns their IDs in GROUP_ID.  All the links
+ *              are created with LCPL_ID and all the groups are opened
+ *              with GAPL_ID.
+ *
+ *              When the native VOL connector holds LOC_ID, the object
+ *              headers are allocated next to each other in the file and
+ *              the links are inserted into the group in one batch.
+ *              Otherwise, the groups are created one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Gcreate_multi(hid_t loc_id, size_t count, const char *name[], hid_t lcpl_id, hid_t gcpl_id[], hid_t gapl_id,
+                hid_t group_id[] /*out*/)
+{
+    H5VL_object_t *   vol_obj = NULL;      /* Object for loc_id */
+    H5VL_loc_params_t loc_params;          /* Location parameters for object access */
+    hid_t *           gcpl    = NULL;      /* Group creation property lists */
+    void **           grp     = NULL;      /* New groups */
+    uint64_t          supported;           /* Whether the multi-object operation is supported by VOL connector */
+    size_t            nregistered = 0;     /* # of groups with IDs */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iz**si*iix", loc_id, count, name, lcpl_id, gcpl_id, gapl_id, group_id);
+
+    /* Check arguments */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name array not provided")
+    if (!gcpl_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "gcpl_id array not provided")
+    if (!group_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "group_id array not provided")
+    for (u = 0; u < count; u++)
+        if (!name[u] || !*name[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name parameter cannot be NULL or an empty string")
+
+    /* Set up object access arguments */
+    if (H5VL_setup_acc_args(loc_id, H5P_CLS_GACC, TRUE, &gapl_id, &vol_obj, &loc_params) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set object access arguments")
+
+    /* Check link creation property list */
+    if (H5P_DEFAULT == lcpl_id)
+        lcpl_id = H5P_LINK_CREATE_DEFAULT;
+    else if (TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a link creation property list")
+
+    /* Check group creation property lists */
+    if (NULL == (gcpl = (hid_t *)H5MM_malloc(count * sizeof(hid_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate property list array")
+    for (u = 0; u < count; u++) {
+        if (H5P_DEFAULT == gcpl_id[u])
+            gcpl[u] = H5P_GROUP_CREATE_DEFAULT;
+        else if (TRUE != H5P_isa_class(gcpl_id[u], H5P_GROUP_CREATE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a group creation property list")
+        else
+            gcpl[u] = gcpl_id[u];
+    } /* end for */
+
+    /* Set the LCPL for the API context */
+    H5CX_set_lcpl(lcpl_id);
+
+    /* Allocate space for the new groups */
+    if (NULL == (grp = (void **)H5MM_calloc(count * sizeof(void *))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate group object array")
+
+    /* Check if the multi-object operation is supported */
+    supported = 0;
+    if (H5_VOL_NATIVE == vol_obj->connector->cls->value &&
+        H5VL_introspect_opt_query(vol_obj, H5VL_SUBCLS_OBJECT, H5VL_NATIVE_OBJECT_CREATE_MULTI, &supported) <
+            0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for multi-object create operation")
+    if (supported & H5VL_OPT_QUERY_SUPPORTED) {
+        H5VL_optional_args_t               vol_cb_args;  /* Arguments to VOL callback */
+        H5VL_native_object_optional_args_t obj_opt_args; /* Arguments for optional operation */
+
+        /* Set up VOL callback arguments */
+        obj_opt_args.create_multi.obj_type = H5O_TYPE_GROUP;
+        obj_opt_args.create_multi.count    = count;
+        obj_opt_args.create_multi.name     = name;
+        obj_opt_args.create_multi.type_id  = NULL;
+        obj_opt_args.create_multi.space_id = NULL;
+        obj_opt_args.create_multi.cpl_id   = gcpl;
+        obj_opt_args.create_multi.lcpl_id  = lcpl_id;
+        obj_opt_args.create_multi.apl_id   = gapl_id;
+        obj_opt_args.create_multi.obj      = grp;
+        vol_cb_args.op_type                = H5VL_NATIVE_OBJECT_CREATE_MULTI;
+        vol_cb_args.args                   = &obj_opt_args;
+
+        /* Create the groups */
+        if (H5VL_object_optional(vol_obj, &loc_params, &vol_cb_args, H5P_DATASET_XFER_DEFAULT,
+                                 H5_REQUEST_NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create groups")
+    } /* end if */
+    else {
+        /* Create the groups one at a time */
+        for (u = 0; u < count; u++)
+            if (NULL == (grp[u] = H5VL_group_create(vol_obj, &loc_params, name[u], lcpl_id, gcpl[u], gapl_id,
+                                                    H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL)))
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create group")
+    } /* end else */
+
+    /* Get IDs for the groups */
+    for (u = 0; u < count; u++) {
+        if ((group_id[u] = H5VL_register(H5I_GROUP, grp[u], vol_obj->connector, TRUE)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTREGISTER, FAIL, "unable to get ID for group handle")
+        grp[u] = NULL;
+        nregistered++;
+    } /* end for */
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && grp) {
+        for (u = 0; u < nregistered; u++)
+            if (H5I_dec_app_ref(group_id[u]) < 0)
+                HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to release group")
+        for (u = nregistered; u < count; u++)
+            if (grp[u]) {
+                H5VL_object_t *grp_vol_obj; /* Object for the group */
+
+                if (NULL == (grp_vol_obj = H5VL_create_object(grp[u], vol_obj->connector)) ||
+                    H5VL_group_close(grp_vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+                    HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to release group")
+                if (grp_vol_obj && H5VL_free_object(grp_vol_obj) < 0)
+                    HDONE_ERROR(H5E_SYM, H5E_CANTDEC, FAIL, "unable to free VOL object")
+            } /* end if */
+    }         /* end if */
+    H5MM_xfree(grp);
+    H5MM_xfree(gcpl);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Gcreate_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5G__open_api_common
  *
@@ -439,6 +439,155 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_insert() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5G__dense_insert_cmp
+ *
+ * Purpose:     Compares the B-tree records of two links being inserted,
+ *              by name hash and then by name, for qsort.
+ *
+ * Return:      <0, 0 or >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__dense_insert_cmp(const void *_udata1, const void *_udata2)
+{
+    const H5G_bt2_ud_ins_t *udata1    = (const H5G_bt2_ud_ins_t *)_udata1;
+    const H5G_bt2_ud_ins_t *udata2    = (const H5G_bt2_ud_ins_t *)_udata2;
+    int                     ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (udata1->common.name_hash != udata2->common.name_hash)
+        ret_value = udata1->common.name_hash < udata2->common.name_hash ? -1 : 1;
+    else
+        ret_value = HDstrcmp(udata1->common.name, udata2->common.name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__dense_insert_multi
+ *
+ * Purpose:     Insert COUNT links into the dense link storage at once.
+ *
+ *              The fractal heap and the index v2 B-trees are opened once
+ *              for the whole batch.  The links go into the heap and the
+ *              creation order index in the order given, which is also
+ *              their creation order, and into the name index in name
+ *              hash order, so that consecutive insertions land in the
+ *              same B-tree leaf where they can.
+ *
+ *              The link names must not already be in the group, nor be
+ *              repeated in the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo, size_t count, const H5O_link_t lnk[])
+{
+    H5G_bt2_ud_ins_t *udata      = NULL;           /* User data for v2 B-tree insertions */
+    H5HF_t *          fheap      = NULL;           /* Fractal heap handle */
+    H5B2_t *          bt2_name   = NULL;           /* v2 B-tree handle for name index */
+    H5B2_t *          bt2_corder = NULL;           /* v2 B-tree handle for creation order index */
+    size_t            link_size;                   /* Size of serialized link in the heap */
+    H5WB_t *          wb = NULL;                   /* Wrapped buffer for link data */
+    uint8_t           link_buf[H5G_LINK_BUF_SIZE]; /* Buffer for serializing link */
+    void *            link_ptr  = NULL;            /* Pointer to serialized link */
+    size_t            u;                           /* Local index variable */
+    herr_t            ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(lnk);
+
+    /* Allocate the B-tree records */
+    if (NULL == (udata = (H5G_bt2_ud_ins_t *)H5MM_malloc(count * sizeof(H5G_bt2_ud_ins_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed for B-tree records")
+
+    /* Wrap the local buffer for serialized links */
+    if (NULL == (wb = H5WB_wrap(link_buf, sizeof(link_buf))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+
+    /* Open the fractal heap */
+    if (NULL == (fheap = H5HF_open(f, linfo->fheap_addr)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+
+    /* Insert the serialized links into the fractal heap */
+    for (u = 0; u < count; u++) {
+        /* Find out the size of buffer needed for serialized link */
+        if ((link_size = H5O_msg_raw_size(f, H5O_LINK_ID, FALSE, &lnk[u])) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+
+        /* Get a pointer to a buffer that's large enough for link */
+        if (NULL == (link_ptr = H5WB_actual(wb, link_size)))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+
+        /* Create serialized form of link */
+        if (H5O_msg_encode(f, H5O_LINK_ID, FALSE, (unsigned char *)link_ptr, &lnk[u]) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't encode link")
+
+        /* Insert the serialized link into the fractal heap */
+        if (H5HF_insert(fheap, link_size, link_ptr, udata[u].id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into fractal heap")
+
+        /* Create the callback information for v2 B-tree record insertion */
+        udata[u].common.f             = f;
+        udata[u].common.fheap         = fheap;
+        udata[u].common.name          = lnk[u].name;
+        udata[u].common.name_hash     = H5_checksum_lookup3(lnk[u].name, HDstrlen(lnk[u].name), 0);
+        udata[u].common.corder        = lnk[u].corder;
+        udata[u].common.found_op      = NULL;
+        udata[u].common.found_op_data = NULL;
+    } /* end for */
+
+    /* Check if we should create creation order index v2 B-tree records */
+    if (linfo->index_corder) {
+        /* Open the creation order index v2 B-tree */
+        HDassert(H5F_addr_defined(linfo->corder_bt2_addr));
+        if (NULL == (bt2_corder = H5B2_open(f, linfo->corder_bt2_addr, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+
+        /* Insert the records into the creation order index v2 B-tree */
+        for (u = 0; u < count; u++)
+            if (H5B2_insert(bt2_corder, &udata[u]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+    } /* end if */
+
+    /* Sort the records into name index order */
+    HDqsort(udata, count, sizeof(H5G_bt2_ud_ins_t), H5G__dense_insert_cmp);
+
+    /* Open the name index v2 B-tree */
+    if (NULL == (bt2_name = H5B2_open(f, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+
+    /* Insert the links into 'name' tracking v2 B-tree */
+    for (u = 0; u < count; u++)
+        if (H5B2_insert(bt2_name, &udata[u]) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+
+done:
+    /* Release resources */
+    if (fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if (bt2_name && H5B2_close(bt2_name) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if (bt2_corder && H5B2_close(bt2_corder) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
+    if (wb && H5WB_unwrap(wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    H5MM_xfree(udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G__dense_lookup_cb
  *
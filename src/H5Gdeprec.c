@@ -123,7 +123,7 @@ H5G_map_obj_type(H5O_type_t obj_type)
             break;
 
         case H5O_TYPE_MAP:
-            /* Maps not supported in native VOL connector */
+            /* Maps have no deprecated object type */
 
         case H5O_TYPE_UNKNOWN:
         case H5O_TYPE_NTYPES:
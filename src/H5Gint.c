@@ -335,6 +335,75 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__create_named() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5G__create_named_multi
+ *
+ * Purpose:     Internal routine to create COUNT new "named" groups in the
+ *              group at LOC, with their object headers next to each other
+ *              in the file and their links inserted in one batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__create_named_multi(const H5G_loc_t *loc, size_t count, const char *name[], hid_t lcpl_id,
+                        const hid_t gcpl_id[], H5G_t *grp[] /*out*/)
+{
+    H5O_obj_create_t *ocrt_info = NULL;    /* Information for object creation */
+    H5G_obj_create_t *gcrt_info = NULL;    /* Information for group creation */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(name);
+    HDassert(lcpl_id != H5P_DEFAULT);
+    HDassert(gcpl_id);
+    HDassert(grp);
+
+    /* Allocate the creation information */
+    if (NULL == (ocrt_info = (H5O_obj_create_t *)H5MM_calloc(count * sizeof(H5O_obj_create_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed for creation information")
+    if (NULL == (gcrt_info = (H5G_obj_create_t *)H5MM_calloc(count * sizeof(H5G_obj_create_t))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed for creation information")
+
+    for (u = 0; u < count; u++) {
+        /* Set up group creation info */
+        gcrt_info[u].gcpl_id    = gcpl_id[u];
+        gcrt_info[u].cache_type = H5G_NOTHING_CACHED;
+
+        /* Set up object creation information */
+        ocrt_info[u].obj_type = H5O_TYPE_GROUP;
+        ocrt_info[u].crt_info = &gcrt_info[u];
+        ocrt_info[u].new_obj  = NULL;
+    } /* end for */
+
+    /* Create the new groups and link them to their parent group */
+    if (H5L_link_object_multi(loc, count, name, ocrt_info, lcpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create and link to groups")
+
+    /* Set the groups to return */
+    for (u = 0; u < count; u++) {
+        HDassert(ocrt_info[u].new_obj);
+        grp[u] = (H5G_t *)ocrt_info[u].new_obj;
+    } /* end for */
+
+done:
+    /* Release the groups created, on failure */
+    if (ret_value < 0 && ocrt_info)
+        for (u = 0; u < count; u++)
+            if (ocrt_info[u].new_obj && H5G_close((H5G_t *)ocrt_info[u].new_obj) < 0)
+                HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to release group")
+
+    H5MM_xfree(gcrt_info);
+    H5MM_xfree(ocrt_info);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__create_named_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G__create
  *
@@ -38,6 +38,7 @@
 #include "H5Gpkg.h"     /* Groups		  		*/
 #include "H5Iprivate.h" /* IDs			  		*/
 #include "H5Lprivate.h" /* Links				*/
+#include "H5Mprivate.h" /* Maps                                 */
 
 /****************/
 /* Local Macros */
@@ -204,8 +205,15 @@ H5G_loc_real(void *obj, H5I_type_t type, H5G_loc_t *loc)
         case H5I_DATASPACE:
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get group location of dataspace")
 
-        case H5I_MAP:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "maps not supported in native VOL connector")
+        case H5I_MAP: {
+            H5M_t *map = (H5M_t *)obj;
+
+            if (NULL == (loc->oloc = H5M_oloc(map)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get object location of map")
+            if (NULL == (loc->path = H5M_nameof(map)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get path of map")
+            break;
+        }
 
         case H5I_GENPROP_CLS:
         case H5I_GENPROP_LST:
@@ -39,6 +39,7 @@
 #include "H5Gpkg.h"      /* Groups		  		*/
 #include "H5Iprivate.h"  /* IDs			  		*/
 #include "H5Lprivate.h"  /* Links                                */
+#include "H5Mprivate.h"  /* Maps                                 */
 #include "H5MMprivate.h" /* Memory wrappers			*/
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -716,7 +717,9 @@ H5G__name_replace_cb(void *obj_ptr, hid_t obj_id, void *key)
             break;
 
         case H5I_MAP:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "maps not supported in native VOL connector")
+            oloc     = H5M_oloc((H5M_t *)obj_ptr);
+            obj_path = H5M_nameof((H5M_t *)obj_ptr);
+            break;
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -954,6 +957,7 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file, H5RS
         hbool_t search_group    = FALSE; /* Flag to indicate that groups are to be searched */
         hbool_t search_dataset  = FALSE; /* Flag to indicate that datasets are to be searched */
         hbool_t search_datatype = FALSE; /* Flag to indicate that datatypes are to be searched */
+        hbool_t search_map      = FALSE; /* Flag to indicate that maps are to be searched */
 
         /* Check for particular link to operate on */
         if (lnk) {
@@ -989,8 +993,9 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file, H5RS
                             break;
 
                         case H5O_TYPE_MAP:
-                            HGOTO_ERROR(H5E_SYM, H5E_BADTYPE, FAIL,
-                                        "maps not supported in native VOL connector")
+                            /* Search and replace names through map IDs */
+                            search_map = TRUE;
+                            break;
 
                         case H5O_TYPE_UNKNOWN:
                         case H5O_TYPE_NTYPES:
@@ -1003,7 +1008,7 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file, H5RS
 
                 case H5L_TYPE_SOFT:
                     /* Symbolic links might resolve to any object, so we need to search all IDs */
-                    search_group = search_dataset = search_datatype = TRUE;
+                    search_group = search_dataset = search_datatype = search_map = TRUE;
                     break;
 
                 case H5L_TYPE_ERROR:
@@ -1023,11 +1028,11 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file, H5RS
         }     /* end if */
         else {
             /* We pass NULL as link pointer when we need to search all IDs */
-            search_group = search_dataset = search_datatype = TRUE;
+            search_group = search_dataset = search_datatype = search_map = TRUE;
         }
 
         /* Check if we need to operate on the objects affected */
-        if (search_group || search_dataset || search_datatype) {
+        if (search_group || search_dataset || search_datatype || search_map) {
             H5G_names_t names; /* Structure to hold operation information for callback */
 
             /* Find top file in src location's mount hierarchy */
@@ -1055,6 +1060,11 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file, H5RS
             if (search_datatype)
                 if (H5I_iterate(H5I_DATATYPE, H5G__name_replace_cb, &names, FALSE) < 0)
                     HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over datatypes")
+
+            /* Search through map IDs */
+            if (search_map)
+                if (H5I_iterate(H5I_MAP, H5G__name_replace_cb, &names, FALSE) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over maps")
         } /* end if */
     }     /* end if */
 
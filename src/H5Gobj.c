@@ -81,6 +81,7 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5G__obj_compact_to_dense_cb(const void *_mesg, unsigned idx, void *_udata);
+static herr_t H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo);
 static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo);
 
 /*********************/
@@ -372,6 +373,68 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__obj_compact_to_dense_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5G__obj_compact_to_dense
+ *
+ * Purpose:     Converts a group's link storage from "compact" to "dense"
+ *              form, moving its link messages into the dense storage.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo)
+{
+    H5O_pline_t         tmp_pline;           /* Pipeline message */
+    H5O_pline_t *       pline = NULL;        /* Pointer to pipeline message */
+    htri_t              pline_exists;        /* Whether the pipeline message exists */
+    H5G_obj_oh_it_ud1_t udata;               /* User data for iteration */
+    H5O_mesg_operator_t op;                  /* Message operator */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(linfo);
+
+    /* Get the pipeline message, if it exists */
+    if ((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+    if (pline_exists) {
+        if (NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+        pline = &tmp_pline;
+    } /* end if */
+
+    /* Create the "dense" storage for links */
+    if (H5G__dense_create(grp_oloc->file, linfo, pline) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+    /* Set up user data for object header message iteration */
+    udata.f       = grp_oloc->file;
+    udata.oh_addr = grp_oloc->addr;
+    udata.linfo   = linfo;
+
+    /* Iterate over the 'link' messages, inserting them into the dense link storage  */
+    op.op_type  = H5O_MESG_OP_APP;
+    op.u.app_op = H5G__obj_compact_to_dense_cb;
+    if (H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
+
+    /* Remove all the 'link' messages */
+    if (H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+
+done:
+    /* Free any space used by the pipeline message */
+    if (pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__obj_compact_to_dense() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G__obj_stab_to_new_cb
  *
@@ -426,13 +489,11 @@ herr_t
 H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk, hbool_t adj_link,
                H5O_type_t obj_type, const void *crt_info)
 {
-    H5O_pline_t  tmp_pline;             /* Pipeline message */
-    H5O_pline_t *pline = NULL;          /* Pointer to pipeline message */
-    H5O_linfo_t  linfo;                 /* Link info message */
-    htri_t       linfo_exists;          /* Whether the link info message exists */
-    hbool_t      use_old_format;        /* Whether to use 'old format' (symbol table) for insertions or not */
-    hbool_t      use_new_dense = FALSE; /* Whether to use "dense" form of 'new format' group */
-    herr_t       ret_value     = SUCCEED; /* Return value */
+    H5O_linfo_t linfo;                 /* Link info message */
+    htri_t      linfo_exists;          /* Whether the link info message exists */
+    hbool_t     use_old_format;        /* Whether to use 'old format' (symbol table) for insertions or not */
+    hbool_t     use_new_dense = FALSE; /* Whether to use "dense" form of 'new format' group */
+    herr_t      ret_value     = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
 
@@ -441,6 +502,9 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     HDassert(name && *name);
     HDassert(obj_lnk);
 
+    /* Forget any link cached for this name */
+    H5G__path_cache_evict_link(grp_oloc, name);
+
     /* Check if we have information about the number of objects in this group */
     /* (by attempting to get the link info message for this group) */
     if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
@@ -479,38 +543,10 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
         else if (linfo.nlinks < ginfo.max_compact && link_msg_size < H5O_MESG_MAX_SIZE)
             use_new_dense = FALSE;
         else {
-            htri_t              pline_exists; /* Whether the pipeline message exists */
-            H5G_obj_oh_it_ud1_t udata;        /* User data for iteration */
-            H5O_mesg_operator_t op;           /* Message operator */
-
-            /* Get the pipeline message, if it exists */
-            if ((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
-            if (pline_exists) {
-                if (NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
-                    HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
-                pline = &tmp_pline;
-            } /* end if */
-
             /* The group doesn't currently have "dense" storage for links */
-            if (H5G__dense_create(grp_oloc->file, &linfo, pline) < 0)
+            if (H5G__obj_compact_to_dense(grp_oloc, &linfo) < 0)
                 HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
 
-            /* Set up user data for object header message iteration */
-            udata.f       = grp_oloc->file;
-            udata.oh_addr = grp_oloc->addr;
-            udata.linfo   = &linfo;
-
-            /* Iterate over the 'link' messages, inserting them into the dense link storage  */
-            op.op_type  = H5O_MESG_OP_APP;
-            op.u.app_op = H5G__obj_compact_to_dense_cb;
-            if (H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
-
-            /* Remove all the 'link' messages */
-            if (H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
-
             use_new_dense = TRUE;
         } /* end else */
     }     /* end if */
@@ -599,13 +635,110 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     } /* end if */
 
 done:
-    /* Free any space used by the pipeline message */
-    if (pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
-        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
-
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G_obj_insert() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5G_obj_insert_multi
+ *
+ * Purpose:     Insert COUNT new links into a group at once.
+ *
+ *              When the new links leave the group with "dense" link
+ *              storage, the group is converted to it once, if needed,
+ *              the links are inserted into it in one batch, and the link
+ *              info message is written once.  Otherwise, the links are
+ *              inserted one at a time.
+ *
+ *              The link names must not already be in the group, nor be
+ *              repeated in the batch.  OBJ_TYPE and CRT_INFO (which may
+ *              be NULL) describe the objects linked to, as for
+ *              H5G_obj_insert().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_obj_insert_multi(const H5O_loc_t *grp_oloc, size_t count, H5O_link_t *obj_lnk, hbool_t adj_link,
+                     H5O_type_t obj_type, const void *const crt_info[])
+{
+    H5O_linfo_t linfo;               /* Link info message */
+    H5O_ginfo_t ginfo;               /* Group info message */
+    htri_t      linfo_exists;        /* Whether the link info message exists */
+    size_t      u;                   /* Local index variable */
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(obj_lnk);
+
+    /* Check if the group will use "dense" link storage */
+    /* (old format groups, and groups whose links stay compact, insert the links one at a time) */
+    if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if (linfo_exists && !H5F_addr_defined(linfo.fheap_addr)) {
+        /* Get the group info */
+        if (NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+
+        if (linfo.nlinks + count <= ginfo.max_compact)
+            linfo_exists = FALSE;
+    } /* end if */
+    if (!linfo_exists) {
+        for (u = 0; u < count; u++)
+            if (H5G_obj_insert(grp_oloc, obj_lnk[u].name, &obj_lnk[u], adj_link, obj_type,
+                               crt_info ? crt_info[u] : NULL) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into group")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Forget any links cached for these names */
+    for (u = 0; u < count; u++)
+        H5G__path_cache_evict_link(grp_oloc, obj_lnk[u].name);
+
+    /* Convert the group to "dense" link storage, if it doesn't have it yet */
+    if (!H5F_addr_defined(linfo.fheap_addr))
+        if (H5G__obj_compact_to_dense(grp_oloc, &linfo) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+    /* Set the creation order for the new links, if it is tracked */
+    for (u = 0; u < count; u++)
+        if (linfo.track_corder) {
+            obj_lnk[u].corder       = linfo.max_corder++;
+            obj_lnk[u].corder_valid = TRUE;
+        } /* end if */
+
+    /* Insert the links into the dense link storage */
+    if (H5G__dense_insert_multi(grp_oloc->file, &linfo, count, obj_lnk) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+
+    /* Increment the number of objects in this group */
+    linfo.nlinks += count;
+    if (H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't update link info message")
+
+    /* Increment link count on the objects, if requested and they're hard links */
+    if (adj_link)
+        for (u = 0; u < count; u++)
+            if (obj_lnk[u].type == H5L_TYPE_HARD) {
+                H5O_loc_t obj_oloc; /* Object location */
+                H5O_loc_reset(&obj_oloc);
+
+                /* Create temporary object location */
+                obj_oloc.file = grp_oloc->file;
+                obj_oloc.addr = obj_lnk[u].u.hard.addr;
+
+                /* Increment reference count for object */
+                if (H5O_link(&obj_oloc, 1) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
+            } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5G_obj_insert_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G__obj_iterate
  *
@@ -955,6 +1088,9 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Forget the link, if it's cached */
+    H5G__path_cache_evict_link(oloc, name);
+
     /* Attempt to get the link info for this group */
     if ((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1018,6 +1154,9 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r, H5
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Forget the group's cached links, since the link's name isn't known here */
+    H5G_path_cache_evict(grp_oloc->file, grp_oloc->addr);
+
     /* Attempt to get the link info for this group */
     if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1090,6 +1229,13 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O
     /* check arguments */
     HDassert(grp_oloc && grp_oloc->file);
     HDassert(name && *name);
+    HDassert(found);
+
+    /* Check the file's path-resolution cache first */
+    if (H5G__path_cache_lookup(grp_oloc, name, found, lnk) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check path cache")
+    if (*found)
+        HGOTO_DONE(SUCCEED)
 
     /* Attempt to get the link info message for this group */
     if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
@@ -1112,6 +1258,13 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O
         if (H5G__stab_lookup(grp_oloc, name, found, lnk) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
 
+    /* Remember the link, for resolving the name again */
+    if (*found && H5G__path_cache_insert(grp_oloc, lnk) < 0) {
+        H5O_msg_reset(H5O_LINK_ID, lnk);
+        *found = FALSE;
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add link to path cache")
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G__obj_lookup() */
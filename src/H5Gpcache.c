@@ -0,0 +1,367 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gpcache.c
+ *
+ * Purpose:		Path-resolution cache: remembers the links found when
+ *			looking up path components, so that opening objects
+ *			by name again doesn't search the groups' link storage.
+ *
+ *			The cache belongs to the shared file and holds copies
+ *			of links, found by the address of the group's object
+ *			header and then by link name.  A group's links are
+ *			evicted when links are added to or removed from the
+ *			group and when the group's object header is deleted.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Gmodule.h" /* This source code file is part of the H5G module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Fprivate.h"  /* File access                              */
+#include "H5FLprivate.h" /* Free Lists                               */
+#include "H5Gpkg.h"      /* Groups                                   */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Oprivate.h"  /* Object headers                           */
+
+/* uthash is an external, header-only hash table implementation.
+ *
+ * We include the file directly in src/ and #define a few functions
+ * to use our internal memory calls.
+ */
+#define uthash_malloc(sz)    H5MM_malloc(sz)
+#define uthash_free(ptr, sz) H5MM_free(ptr) /* Ignoring sz is intentional */
+#include "uthash.h"
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of links cached for a file before the oldest group's links are evicted */
+#define H5G_PATH_CACHE_MAX_LINKS 65536
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A link in a group */
+typedef struct H5G_path_cache_link_t {
+    H5O_link_t     lnk; /* Copy of link (its name is the key) */
+    UT_hash_handle hh;  /* Hash table handle (must be LAST) */
+} H5G_path_cache_link_t;
+
+/* The links cached for a group */
+typedef struct H5G_path_cache_grp_t {
+    haddr_t                addr;   /* Address of group's object header (key) */
+    size_t                 nlinks; /* Number of links cached for group */
+    H5G_path_cache_link_t *links;  /* Hash table of links, by name */
+    UT_hash_handle         hh;     /* Hash table handle (must be LAST) */
+} H5G_path_cache_grp_t;
+
+/* The path-resolution cache for a file */
+struct H5G_path_cache_t {
+    size_t                nlinks; /* Number of links cached, over all groups */
+    H5G_path_cache_grp_t *grps;   /* Hash table of groups, by address, oldest first */
+};
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5G__path_cache_free_grp(H5G_path_cache_t *pc, H5G_path_cache_grp_t *grp);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the cache's structs */
+H5FL_DEFINE_STATIC(H5G_path_cache_t);
+H5FL_DEFINE_STATIC(H5G_path_cache_grp_t);
+H5FL_DEFINE_STATIC(H5G_path_cache_link_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_free_grp
+ *
+ * Purpose:     Removes a group and all its links from the cache
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__path_cache_free_grp(H5G_path_cache_t *pc, H5G_path_cache_grp_t *grp)
+{
+    H5G_path_cache_link_t *ent, *tmp; /* Links in group */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(pc);
+    HDassert(grp);
+    HDassert(pc->nlinks >= grp->nlinks);
+
+    HASH_ITER(hh, grp->links, ent, tmp)
+    {
+        HASH_DELETE(hh, grp->links, ent);
+        H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+        ent = H5FL_FREE(H5G_path_cache_link_t, ent);
+    } /* end HASH_ITER */
+    pc->nlinks -= grp->nlinks;
+
+    HASH_DELETE(hh, pc->grps, grp);
+    grp = H5FL_FREE(H5G_path_cache_grp_t, grp);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__path_cache_free_grp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_lookup
+ *
+ * Purpose:     Looks up a link in a group in the file's path-resolution
+ *              cache.  If it is found, a copy of the link is returned in
+ *              LNK, which the caller must reset.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found, H5O_link_t *lnk)
+{
+    H5G_path_cache_t *     pc;                  /* File's cache */
+    H5G_path_cache_grp_t * grp       = NULL;    /* Group's cached links */
+    H5G_path_cache_link_t *ent       = NULL;    /* Cached link */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name && *name);
+    HDassert(found);
+    HDassert(lnk);
+
+    *found = FALSE;
+
+    /* Find the group, then the link */
+    if (NULL == (pc = H5F_PATH_CACHE(grp_oloc->file)))
+        HGOTO_DONE(SUCCEED)
+    HASH_FIND(hh, pc->grps, &grp_oloc->addr, sizeof(haddr_t), grp);
+    if (NULL == grp)
+        HGOTO_DONE(SUCCEED)
+    HASH_FIND_STR(grp->links, name, ent);
+    if (NULL == ent)
+        HGOTO_DONE(SUCCEED)
+
+    /* Copy the link for the caller */
+    if (NULL == H5O_msg_copy(H5O_LINK_ID, &ent->lnk, lnk))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "unable to copy cached link")
+    *found = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_insert
+ *
+ * Purpose:     Adds a copy of a link found in a group to the file's
+ *              path-resolution cache, evicting the links of the groups
+ *              that were cached first if the cache is full.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk)
+{
+    H5G_path_cache_t *     pc;                  /* File's cache */
+    H5G_path_cache_grp_t * grp       = NULL;    /* Group's cached links */
+    H5G_path_cache_link_t *ent       = NULL;    /* New cached link */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(H5F_addr_defined(grp_oloc->addr));
+    HDassert(lnk && lnk->name);
+
+    /* Create the file's cache, the first time a link is cached */
+    if (NULL == (pc = H5F_PATH_CACHE(grp_oloc->file))) {
+        if (NULL == (pc = H5FL_CALLOC(H5G_path_cache_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate path cache")
+        if (H5F_SET_PATH_CACHE(grp_oloc->file, pc) < 0) {
+            pc = H5FL_FREE(H5G_path_cache_t, pc);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set path cache for file")
+        } /* end if */
+    }     /* end if */
+
+    /* Make room for the link, by evicting the oldest groups' links */
+    while (pc->nlinks >= H5G_PATH_CACHE_MAX_LINKS && pc->grps)
+        H5G__path_cache_free_grp(pc, pc->grps);
+
+    /* Find the group's links, adding the group if needed */
+    HASH_FIND(hh, pc->grps, &grp_oloc->addr, sizeof(haddr_t), grp);
+    if (NULL == grp) {
+        if (NULL == (grp = H5FL_CALLOC(H5G_path_cache_grp_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate path cache group")
+        grp->addr = grp_oloc->addr;
+        HASH_ADD(hh, pc->grps, addr, sizeof(haddr_t), grp);
+    } /* end if */
+    else {
+        HASH_FIND_STR(grp->links, lnk->name, ent);
+        if (ent)
+            HGOTO_DONE(SUCCEED)
+    } /* end else */
+
+    /* Copy the link into the cache */
+    if (NULL == (ent = H5FL_MALLOC(H5G_path_cache_link_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate path cache link")
+    if (NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &ent->lnk)) {
+        ent = H5FL_FREE(H5G_path_cache_link_t, ent);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "unable to copy link")
+    } /* end if */
+    HASH_ADD_KEYPTR(hh, grp->links, ent->lnk.name, (unsigned)HDstrlen(ent->lnk.name), ent);
+    grp->nlinks++;
+    pc->nlinks++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_evict_link
+ *
+ * Purpose:     Removes a group's link from the file's path-resolution
+ *              cache, if it is there.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5G__path_cache_evict_link(const H5O_loc_t *grp_oloc, const char *name)
+{
+    H5G_path_cache_t *     pc;         /* File's cache */
+    H5G_path_cache_grp_t * grp = NULL; /* Group's cached links */
+    H5G_path_cache_link_t *ent = NULL; /* Cached link */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name);
+
+    if (NULL != (pc = H5F_PATH_CACHE(grp_oloc->file))) {
+        HASH_FIND(hh, pc->grps, &grp_oloc->addr, sizeof(haddr_t), grp);
+        if (grp) {
+            HASH_FIND_STR(grp->links, name, ent);
+            if (ent) {
+                HASH_DELETE(hh, grp->links, ent);
+                H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+                ent = H5FL_FREE(H5G_path_cache_link_t, ent);
+                grp->nlinks--;
+                pc->nlinks--;
+
+                /* Don't keep empty groups */
+                if (0 == grp->nlinks)
+                    H5G__path_cache_free_grp(pc, grp);
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__path_cache_evict_link() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_evict
+ *
+ * Purpose:     Removes all of a group's links from the file's
+ *              path-resolution cache.  ADDR need not be the address of a
+ *              group.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5G_path_cache_evict(const H5F_t *f, haddr_t addr)
+{
+    H5G_path_cache_t *    pc;         /* File's cache */
+    H5G_path_cache_grp_t *grp = NULL; /* Group's cached links */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    if (NULL != (pc = H5F_PATH_CACHE(f))) {
+        HASH_FIND(hh, pc->grps, &addr, sizeof(haddr_t), grp);
+        if (grp)
+            H5G__path_cache_free_grp(pc, grp);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G_path_cache_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_dest
+ *
+ * Purpose:     Releases the file's path-resolution cache, if it has one.
+ *              The cache is created again when a link is next cached.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_path_cache_dest(H5F_t *f)
+{
+    H5G_path_cache_t *pc;                  /* File's cache */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+
+    if (NULL != (pc = H5F_PATH_CACHE(f))) {
+        while (pc->grps)
+            H5G__path_cache_free_grp(pc, pc->grps);
+        HDassert(0 == pc->nlinks);
+        pc = H5FL_FREE(H5G_path_cache_t, pc);
+
+        if (H5F_SET_PATH_CACHE(f, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't reset path cache for file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_dest() */
@@ -327,6 +327,8 @@ H5FL_EXTERN(H5G_shared_t);
  */
 H5_DLL H5G_t *H5G__create(H5F_t *file, H5G_obj_create_t *gcrt_info);
 H5_DLL H5G_t *H5G__create_named(const H5G_loc_t *loc, const char *name, hid_t lcpl_id, hid_t gcpl_id);
+H5_DLL herr_t H5G__create_named_multi(const H5G_loc_t *loc, size_t count, const char *name[], hid_t lcpl_id,
+                                     const hid_t gcpl_id[], H5G_t *grp[]);
 H5_DLL H5G_t *H5G__open_name(const H5G_loc_t *loc, const char *name);
 H5_DLL herr_t H5G__get_info_by_name(const H5G_loc_t *loc, const char *name, H5G_info_t *grp_info);
 H5_DLL herr_t H5G__get_info_by_idx(const H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
@@ -427,6 +429,8 @@ H5_DLL herr_t H5G__dense_build_table(H5F_t *f, const H5O_linfo_t *linfo, H5_inde
                                      H5_iter_order_t order, H5G_link_table_t *ltable);
 H5_DLL herr_t H5G__dense_create(H5F_t *f, H5O_linfo_t *linfo, const H5O_pline_t *pline);
 H5_DLL herr_t H5G__dense_insert(H5F_t *f, const H5O_linfo_t *linfo, const H5O_link_t *lnk);
+H5_DLL herr_t H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo, size_t count,
+                                      const H5O_link_t lnk[]);
 H5_DLL herr_t H5G__dense_lookup(H5F_t *f, const H5O_linfo_t *linfo, const char *name, hbool_t *found,
                                 H5O_link_t *lnk);
 H5_DLL herr_t H5G__dense_lookup_by_idx(H5F_t *f, const H5O_linfo_t *linfo, H5_index_t idx_type,
@@ -458,6 +462,12 @@ H5_DLL herr_t H5G__get_objinfo(const H5G_loc_t *loc, const char *name, hbool_t f
                                H5G_stat_t *statbuf /*out*/);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+/* Functions that operate on the file's path-resolution cache */
+H5_DLL herr_t H5G__path_cache_lookup(const H5O_loc_t *grp_oloc, const char *name, hbool_t *found,
+                                     H5O_link_t *lnk);
+H5_DLL herr_t H5G__path_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk);
+H5_DLL void   H5G__path_cache_evict_link(const H5O_loc_t *grp_oloc, const char *name);
+
 /*
  * These functions operate on group hierarchy names.
  */
@@ -482,6 +492,7 @@ H5_DLL herr_t H5G__user_path_test(hid_t obj_id, char *user_path, size_t *user_pa
                                   unsigned *user_path_hidden);
 H5_DLL herr_t H5G__verify_cached_stab_test(H5O_loc_t *grp_oloc, H5G_entry_t *ent);
 H5_DLL herr_t H5G__verify_cached_stabs_test(hid_t gid);
+H5_DLL htri_t H5G__path_cache_test(hid_t gid, const char *name);
 #endif /* H5G_TESTING */
 
 #endif /* H5Gpkg_H */
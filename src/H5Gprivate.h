@@ -181,9 +181,10 @@ typedef struct {
     } op_func;
 } H5G_link_iterate_t;
 
-typedef struct H5G_t        H5G_t;
-typedef struct H5G_shared_t H5G_shared_t;
-typedef struct H5G_entry_t  H5G_entry_t;
+typedef struct H5G_t            H5G_t;
+typedef struct H5G_shared_t     H5G_shared_t;
+typedef struct H5G_entry_t      H5G_entry_t;
+typedef struct H5G_path_cache_t H5G_path_cache_t;
 
 /*
  * Library prototypes...  These are the ones that other packages routinely
@@ -229,6 +230,9 @@ H5_DLL herr_t H5G_link_to_info(const struct H5O_loc_t *link_loc, const struct H5
  */
 H5_DLL herr_t H5G_obj_insert(const struct H5O_loc_t *grp_oloc, const char *name, struct H5O_link_t *obj_lnk,
                              hbool_t adj_link, H5O_type_t obj_type, const void *crt_info);
+H5_DLL herr_t H5G_obj_insert_multi(const struct H5O_loc_t *grp_oloc, size_t count,
+                                   struct H5O_link_t *obj_lnk, hbool_t adj_link, H5O_type_t obj_type,
+                                   const void *const crt_info[]);
 H5_DLL herr_t H5G_obj_get_name_by_idx(const struct H5O_loc_t *oloc, H5_index_t idx_type,
                                       H5_iter_order_t order, hsize_t n, char *name, size_t name_size,
                                       size_t *name_len);
@@ -294,4 +298,10 @@ H5_DLL herr_t H5G_root_loc(H5F_t *f, H5G_loc_t *loc);
 H5_DLL herr_t H5G_root_free(H5G_t *grp);
 H5_DLL H5G_t *H5G_rootof(H5F_t *f);
 
+/*
+ * These functions operate on the file's path-resolution cache
+ */
+H5_DLL void   H5G_path_cache_evict(const H5F_t *f, haddr_t addr);
+H5_DLL herr_t H5G_path_cache_dest(H5F_t *f);
+
 #endif /* H5Gprivate_H */
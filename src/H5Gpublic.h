@@ -182,6 +182,47 @@ H5_DLL hid_t H5Gcreate_async(const char *app_file, const char *app_func, unsigne
  */
 H5_DLL hid_t H5Gcreate_anon(hid_t loc_id, hid_t gcpl_id, hid_t gapl_id);
 
+/**
+ *-------------------------------------------------------------------------
+ * \ingroup H5G
+ *
+ * \brief Creates several new groups in a group and links them into it
+ *
+ * \fgdta_loc_id
+ * \param[in]  count    Number of groups to create
+ * \param[in]  name     Names of the groups to create
+ * \lcpl_id
+ * \param[in]  gcpl_id  Identifiers of the group creation property lists
+ * \gapl_id
+ * \param[out] group_id Identifiers of the new groups
+ *
+ * \return \herr_t
+ *
+ * \details H5Gcreate_multi() creates \p count groups in the group
+ *          specified by \p loc_id in one call.  Element \c i of \p name
+ *          and \p gcpl_id describe a group just as the matching arguments
+ *          of H5Gcreate2() do, and the new group's identifier is returned
+ *          in element \c i of \p group_id.  All the links are created with
+ *          \p lcpl_id and all the groups are opened with \p gapl_id.
+ *
+ *          Each name is the name of a link in the group, not a path, and
+ *          the names must differ from each other and from the links
+ *          already in the group.
+ *
+ *          With the native VOL connector, the groups' object headers are
+ *          allocated next to each other in the file and the links are
+ *          inserted into the group in one batch.  Other VOL connectors
+ *          create the groups one at a time with H5Gcreate2().
+ *
+ *          The group identifiers should be closed with H5Gclose() when
+ *          they are no longer needed.
+ *
+ * \see H5Gcreate2(), H5Dcreate_multi()
+ *
+ */
+H5_DLL herr_t H5Gcreate_multi(hid_t loc_id, size_t count, const char *name[], hid_t lcpl_id, hid_t gcpl_id[],
+                              hid_t gapl_id, hid_t group_id[] /*out*/);
+
 /**
  *-------------------------------------------------------------------------
  * \ingroup H5G
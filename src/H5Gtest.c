@@ -34,6 +34,7 @@
 #include "H5Gpkg.h"      /* Groups                                   */
 #include "H5HLprivate.h" /* Local Heaps                              */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5Mprivate.h"  /* Maps                                     */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 /****************/
@@ -592,7 +593,8 @@ H5G__user_path_test(hid_t obj_id, char *user_path, size_t *user_path_len, unsign
             break;
 
         case H5I_MAP:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "maps not supported in native VOL connector")
+            obj_path = H5M_nameof((H5M_t *)obj_ptr);
+            break;
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -849,3 +851,42 @@ H5G__verify_cached_stabs_test(hid_t gid)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__verify_cached_stabs_test() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_test
+ *
+ * Purpose:     Determine whether a link in a group is in the file's
+ *              path-resolution cache.
+ *
+ * Return:      Success:    TRUE if the link is cached, FALSE otherwise
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__path_cache_test(hid_t gid, const char *name)
+{
+    H5G_t *    grp = NULL;          /* Group */
+    H5O_link_t lnk;                 /* Cached link */
+    hbool_t    found     = FALSE;   /* Whether the link is cached */
+    htri_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (grp = (H5G_t *)H5VL_object_verify(gid, H5I_GROUP)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a group")
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no name given")
+
+    /* Look for the link */
+    if (H5G__path_cache_lookup(&(grp->oloc), name, &found, &lnk) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check path cache")
+    if (found)
+        H5O_msg_reset(H5O_LINK_ID, &lnk);
+
+    ret_value = found;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_test() */
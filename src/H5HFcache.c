@@ -426,20 +426,22 @@ done:
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5HF__cache_hdr_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5HF__cache_hdr_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *      image = (const uint8_t *)_image;       /* Pointer into raw data buffer */
+    H5HF_hdr_cache_ud_t *udata = (H5HF_hdr_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t             stored_chksum;                         /* Stored metadata checksum value */
+    uint32_t             computed_chksum;                       /* Computed metadata checksum value */
+    htri_t               ret_value = TRUE;                      /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -801,7 +803,7 @@ H5HF__cache_hdr_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_NDEBUG_UN
     } /* end if */
 
     /* Compute metadata checksum */
-    metadata_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -905,20 +907,22 @@ H5HF__cache_iblock_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5HF__cache_iblock_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5HF__cache_iblock_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *         image = (const uint8_t *)_image;          /* Pointer into raw data buffer */
+    H5HF_iblock_cache_ud_t *udata = (H5HF_iblock_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t                stored_chksum;                            /* Stored metadata checksum value */
+    uint32_t                computed_chksum;                          /* Computed metadata checksum value */
+    htri_t                  ret_value = TRUE;                         /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -1381,7 +1385,7 @@ H5HF__cache_iblock_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_NDEBUG
     }     /* end for */
 
     /* Compute checksum */
-    metadata_chksum = H5_checksum_metadata((uint8_t *)_image, (size_t)(image - (uint8_t *)_image), 0);
+    metadata_chksum = H5F_checksum_metadata(f, (uint8_t *)_image, (size_t)(image - (uint8_t *)_image), 0);
 
     /* Metadata checksum */
     UINT32ENCODE(image, metadata_chksum);
@@ -1628,6 +1632,7 @@ H5HF__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
 
     if (hdr->filter_len > 0) {
         size_t   nbytes;      /* Number of bytes used in buffer, after applying reverse filters */
+        size_t   buf_size;    /* Allocated size of buffer */
         unsigned filter_mask; /* Excluded filters for direct block */
         H5Z_cb_t filter_cb;   /* Filter callback structure */
 
@@ -1637,9 +1642,11 @@ H5HF__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
 
         /* Allocate buffer to perform I/O filtering on and copy image into
          * it.  Must do this as H5Z_pipeline() may re-size the buffer
-         * provided to it.
+         * provided to it.  Make it big enough for the uncompressed block,
+         * so the filters can expand the data without re-sizing.
          */
-        if (NULL == (read_buf = H5MM_malloc(len)))
+        buf_size = MAX(len, udata->dblock_size);
+        if (NULL == (read_buf = H5MM_malloc(buf_size)))
             HGOTO_ERROR(H5E_HEAP, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline buffer")
 
         /* Set up parameters for filter pipeline */
@@ -1649,7 +1656,7 @@ H5HF__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
 
         /* Push direct block data through I/O filter pipeline */
         if (H5Z_pipeline(&(hdr->pline), H5Z_FLAG_REVERSE, &filter_mask, H5Z_ENABLE_EDC, filter_cb, &nbytes,
-                         &len, &read_buf) < 0)
+                         &buf_size, &read_buf) < 0)
             HGOTO_ERROR(H5E_HEAP, H5E_CANTFILTER, FAIL, "output pipeline failed")
 
         /* Update info about direct block */
@@ -1673,7 +1680,7 @@ H5HF__cache_dblock_verify_chksum(const void *_image, size_t len, void *_udata)
     HDmemset(chk_p, 0, (size_t)H5HF_SIZEOF_CHKSUM);
 
     /* Compute checksum on entire direct block */
-    computed_chksum = H5_checksum_metadata(read_buf, len, 0);
+    computed_chksum = H5F_checksum_metadata(udata->f, read_buf, len, 0);
 
     /* Restore the checksum */
     UINT32ENCODE(chk_p, stored_chksum)
@@ -1779,6 +1786,7 @@ H5HF__cache_dblock_deserialize(const void *_image, size_t len, void *_udata, hbo
         else {
             H5Z_cb_t filter_cb;   /* Filter callback structure */
             size_t   nbytes;      /* Number of bytes used in buffer, after applying reverse filters */
+            size_t   buf_size;    /* Allocated size of buffer */
             unsigned filter_mask; /* Excluded filters for direct block */
 
             /* Sanity check */
@@ -1790,9 +1798,11 @@ H5HF__cache_dblock_deserialize(const void *_image, size_t len, void *_udata, hbo
 
             /* Allocate buffer to perform I/O filtering on and copy image into
              * it.  Must do this as H5Z_pipeline() may resize the buffer
-             * provided to it.
+             * provided to it.  Make it big enough for the uncompressed block,
+             * so the filters can expand the data without resizing.
              */
-            if (NULL == (read_buf = H5MM_malloc(len)))
+            buf_size = MAX(len, dblock->size);
+            if (NULL == (read_buf = H5MM_malloc(buf_size)))
                 HGOTO_ERROR(H5E_HEAP, H5E_NOSPACE, NULL, "memory allocation failed for pipeline buffer")
 
             /* Copy compressed image into buffer */
@@ -1802,7 +1812,7 @@ H5HF__cache_dblock_deserialize(const void *_image, size_t len, void *_udata, hbo
             nbytes      = len;
             filter_mask = udata->filter_mask;
             if (H5Z_pipeline(&(hdr->pline), H5Z_FLAG_REVERSE, &filter_mask, H5Z_ENABLE_EDC, filter_cb,
-                             &nbytes, &len, &read_buf) < 0)
+                             &nbytes, &buf_size, &read_buf) < 0)
                 HGOTO_ERROR(H5E_HEAP, H5E_CANTFILTER, NULL, "output pipeline failed")
 
             /* Sanity check */
@@ -2133,7 +2143,7 @@ H5HF__cache_dblock_pre_serialize(H5F_t *f, void *_thing, haddr_t addr, size_t le
         HDmemset(image, 0, (size_t)H5HF_SIZEOF_CHKSUM);
 
         /* Compute checksum on entire direct block */
-        metadata_chksum = H5_checksum_metadata(dblock->blk, dblock->size, 0);
+        metadata_chksum = H5F_checksum_metadata(f, dblock->blk, dblock->size, 0);
 
         /* Metadata checksum */
         UINT32ENCODE(image, metadata_chksum);
@@ -69,6 +69,12 @@
 /* Local Typedefs */
 /******************/
 
+/* Object of a batch being read, sorted by collection address */
+typedef struct H5HG_read_order_t {
+    haddr_t addr; /* Address of the object's collection */
+    size_t  u;    /* Index of the object in the batch */
+} H5HG_read_order_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -79,6 +85,7 @@
 
 static haddr_t H5HG__create(H5F_t *f, size_t size);
 static size_t  H5HG__alloc(H5F_t *f, H5HG_heap_t *heap, size_t size, unsigned *heap_flags_ptr);
+static int     H5HG__read_order_cmp(const void *_a, const void *_b);
 
 /*********************/
 /* Package Variables */
@@ -562,6 +569,109 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* H5HG_insert() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_insert_multi
+ *
+ * Purpose:	Inserts a batch of NOBJS new objects into the global heap.
+ *		Each object is placed the same way as H5HG_insert() would,
+ *		but consecutive objects are copied into a collection while
+ *		it stays protected, and a collection created for the batch
+ *		is sized to hold as much of the rest of the batch as a
+ *		collection may, instead of just the next object.
+ *
+ * Return:	Success:	Non-negative, and the heap object handles
+ *				returned through the HOBJ array.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_insert_multi(H5F_t *f, size_t nobjs, const size_t size[], const void *const obj[], H5HG_t hobj[] /*out*/)
+{
+    size_t       remain = 0; /* Space needed for the objects not inserted yet */
+    size_t       idx;
+    H5HG_heap_t *heap       = NULL;
+    unsigned     heap_flags = H5AC__NO_FLAGS_SET;
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(0 == nobjs || (size && obj && hobj));
+
+    if (0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    /* Total up the space needed for the whole batch */
+    for (u = 0; u < nobjs; u++)
+        remain += H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[u]);
+
+    for (u = 0; u < nobjs; u++) {
+        size_t need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[u]); /* Space needed for this object */
+
+        HDassert(0 == size[u] || obj[u]);
+
+        /* Release the collection we've been filling once this object doesn't fit */
+        if (heap && heap->obj[0].size < need) {
+            if (H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+            heap       = NULL;
+            heap_flags = H5AC__NO_FLAGS_SET;
+        } /* end if */
+
+        if (NULL == heap) {
+            haddr_t addr = HADDR_UNDEF; /* Address of heap to add objects within */
+
+            /* Look for a heap in the file's CWFS that has enough space for the object */
+            if (H5F_cwfs_find_free_heap(f, need, &addr) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_NOTFOUND, FAIL, "error trying to locate heap")
+
+            /*
+             * If we didn't find any collection with enough free space then
+             * allocate a new collection large enough for the rest of the batch,
+             * up to the usual limit on a collection's size, plus the collection
+             * header.
+             */
+            if (!H5F_addr_defined(addr)) {
+                size_t heap_need = MAX(need, MIN(remain, H5HG_MAXSIZE - H5HG_SIZEOF_HDR(f)));
+
+                addr = H5HG__create(f, heap_need + H5HG_SIZEOF_HDR(f));
+
+                if (!H5F_addr_defined(addr))
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+            } /* end if */
+            HDassert(H5F_addr_defined(addr));
+
+            if (NULL == (heap = H5HG__protect(f, addr, H5AC__NO_FLAGS_SET)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        } /* end if */
+
+        /* Split the free space to make room for the new object */
+        if (0 == (idx = H5HG__alloc(f, heap, size[u], &heap_flags)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+
+        /* Copy data into the heap */
+        if (size[u] > 0)
+            H5MM_memcpy(heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), obj[u], size[u]);
+        heap_flags |= H5AC__DIRTIED_FLAG;
+
+        /* Return value */
+        hobj[u].addr = heap->addr;
+        hobj[u].idx  = idx;
+
+        remain -= need;
+    } /* end for */
+
+done:
+    if (heap && H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* H5HG_insert_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5HG_read
  *
@@ -634,6 +744,122 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5HG_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG__read_order_cmp
+ *
+ * Purpose:	Compares two objects of a batch being read, by the address
+ *		of their collection and then by their position in the batch.
+ *
+ * Return:	Negative, zero or positive, as for qsort()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HG__read_order_cmp(const void *_a, const void *_b)
+{
+    const H5HG_read_order_t *a         = (const H5HG_read_order_t *)_a; /* First object to compare */
+    const H5HG_read_order_t *b         = (const H5HG_read_order_t *)_b; /* Second object to compare */
+    int                      ret_value = 0;                             /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_addr_lt(a->addr, b->addr))
+        ret_value = -1;
+    else if (H5F_addr_gt(a->addr, b->addr))
+        ret_value = 1;
+    else if (a->u < b->u)
+        ret_value = -1;
+    else if (a->u > b->u)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HG__read_order_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_multi
+ *
+ * Purpose:	Reads a batch of NOBJS global heap objects into the buffers
+ *		in the OBJECT array, which the caller supplies.  SIZE holds
+ *		the size each object is expected to have, and it's an error
+ *		for an object's size to differ from that.
+ *
+ *		The objects are visited in order of their collection's
+ *		address, so each collection referenced by the batch is
+ *		protected only once, however its objects are interleaved
+ *		with those of other collections.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_read_multi(H5F_t *f, size_t nobjs, const H5HG_t hobj[], void *const object[], const size_t size[])
+{
+    H5HG_heap_t *      heap      = NULL;    /* Pointer to global heap object */
+    H5HG_read_order_t *order     = NULL;    /* Objects sorted by collection, if they need to be */
+    size_t             u;                   /* Local index variable */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(0 == nobjs || (hobj && object && size));
+
+    /* Sort the objects by collection, unless they're already in that order */
+    for (u = 1; u < nobjs; u++)
+        if (H5F_addr_gt(hobj[u - 1].addr, hobj[u].addr))
+            break;
+    if (u < nobjs) {
+        if (NULL == (order = (H5HG_read_order_t *)H5MM_malloc(nobjs * sizeof(H5HG_read_order_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for (u = 0; u < nobjs; u++) {
+            order[u].addr = hobj[u].addr;
+            order[u].u    = u;
+        } /* end for */
+        HDqsort(order, nobjs, sizeof(H5HG_read_order_t), H5HG__read_order_cmp);
+    } /* end if */
+
+    for (u = 0; u < nobjs; u++) {
+        size_t        v   = order ? order[u].u : u; /* Index of the object in the batch */
+        const H5HG_t *obj = &hobj[v];               /* Object to read */
+
+        /* Switch to the object's collection, if we're not in it already */
+        if (!heap || !H5F_addr_eq(heap->addr, obj->addr)) {
+            if (heap) {
+                if (H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+                heap = NULL;
+            } /* end if */
+
+            /* Load the heap */
+            if (NULL == (heap = H5HG__protect(f, obj->addr, H5AC__READ_ONLY_FLAG)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+
+            /* Advance the heap in the CWFS list */
+            if (heap->obj[0].begin)
+                if (H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+        } /* end if */
+
+        if (obj->idx >= heap->nused || NULL == heap->obj[obj->idx].begin)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADVALUE, FAIL, "invalid global heap object ID")
+        if (heap->obj[obj->idx].size != size[v])
+            HGOTO_ERROR(H5E_HEAP, H5E_BADSIZE, FAIL, "expected global heap object size does not match")
+
+        if (size[v] > 0)
+            H5MM_memcpy(object[v], heap->obj[obj->idx].begin + H5HG_SIZEOF_OBJHDR(f), size[v]);
+    } /* end for */
+
+done:
+    if (heap && H5AC_unprotect(f, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+    if (order)
+        H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
  *
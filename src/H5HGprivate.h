@@ -54,7 +54,11 @@ typedef struct H5HG_heap_t H5HG_heap_t;
 
 /* Main global heap routines */
 H5_DLL herr_t H5HG_insert(H5F_t *f, size_t size, const void *obj, H5HG_t *hobj /*out*/);
+H5_DLL herr_t H5HG_insert_multi(H5F_t *f, size_t nobjs, const size_t size[], const void *const obj[],
+                                H5HG_t hobj[] /*out*/);
 H5_DLL void * H5HG_read(H5F_t *f, H5HG_t *hobj, void *object, size_t *buf_size /*out*/);
+H5_DLL herr_t H5HG_read_multi(H5F_t *f, size_t nobjs, const H5HG_t hobj[], void *const object[],
+                              const size_t size[]);
 H5_DLL int    H5HG_link(H5F_t *f, const H5HG_t *hobj, int adjust);
 H5_DLL herr_t H5HG_get_obj_size(H5F_t *f, H5HG_t *hobj, size_t *obj_size);
 H5_DLL herr_t H5HG_remove(H5F_t *f, H5HG_t *hobj);
@@ -29,6 +29,7 @@
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Ipkg.h"      /* IDs                                      */
+#include "H5Mprivate.h"  /* Maps                                     */
 #include "H5RSprivate.h" /* Reference-counted strings                */
 #include "H5Tprivate.h"  /* Datatypes                                */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -118,10 +119,15 @@ H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
             break;
         }
 
-        /* TODO: Maps will have to be added when they are supported in the
-         *       native VOL connector.
-         */
-        case H5I_MAP:
+        case H5I_MAP: {
+            const H5VL_object_t *vol_obj = (const H5VL_object_t *)info->object;
+            H5M_t *              map     = (H5M_t *)H5VL_object_data(vol_obj);
+
+            object = map;
+            if (H5_VOL_NATIVE == vol_obj->connector->cls->value)
+                path = H5M_nameof(map);
+            break;
+        }
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -275,7 +275,8 @@ H5I__unwrap(void *object, H5I_type_t type)
     /* The stored object pointer might be an H5VL_object_t, in which
      * case we'll need to get the wrapped object struct (H5F_t *, etc.).
      */
-    if (H5I_FILE == type || H5I_GROUP == type || H5I_DATASET == type || H5I_ATTR == type) {
+    if (H5I_FILE == type || H5I_GROUP == type || H5I_DATASET == type || H5I_ATTR == type ||
+        H5I_MAP == type) {
         const H5VL_object_t *vol_obj;
 
         vol_obj   = (const H5VL_object_t *)object;
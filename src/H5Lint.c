@@ -137,6 +137,7 @@ typedef struct {
 /********************/
 
 static int    H5L__find_class_idx(H5L_type_t id);
+static int    H5L__name_cmp(const void *_name1, const void *_name2);
 static herr_t H5L__link_cb(H5G_loc_t *grp_loc /*in*/, const char *name, const H5O_link_t *lnk,
                            H5G_loc_t *obj_loc, void *_udata /*in,out*/, H5G_own_loc_t *own_loc /*out*/);
 static herr_t H5L__create_real(const H5G_loc_t *link_loc, const char *link_name, H5G_name_t *obj_path,
@@ -553,6 +554,164 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5L_link_object() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5L__name_cmp
+ *
+ * Purpose:     Compares two link names, for qsort.
+ *
+ * Return:      <0, 0 or >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5L__name_cmp(const void *_name1, const void *_name2)
+{
+    const char *const *name1 = (const char *const *)_name1;
+    const char *const *name2 = (const char *const *)_name2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp(*name1, *name2))
+} /* end H5L__name_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5L_link_object_multi
+ *
+ * Purpose:     Creates COUNT new objects of the same type and links them
+ *              into the group at NEW_LOC, under the link names in
+ *              NEW_NAME.
+ *
+ *              The objects are all created before any of them is linked,
+ *              so their object headers are allocated next to each other
+ *              in the file, and then the links are inserted into the
+ *              group in one batch.
+ *
+ *              Each name must be the name of a link within the group
+ *              (not a path), must not already be in the group and must
+ *              not be repeated.  The new objects are returned in the
+ *              NEW_OBJ fields of OCRT_INFO, even on failure, for the
+ *              caller to release.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5L_link_object_multi(const H5G_loc_t *new_loc, size_t count, const char *new_name[],
+                      H5O_obj_create_t ocrt_info[], hid_t lcpl_id)
+{
+    H5G_loc_t *   obj_loc  = NULL;         /* Locations of the new objects */
+    H5O_link_t *  lnk      = NULL;         /* Links to insert */
+    const char ** names    = NULL;         /* Link names, sorted */
+    const void ** crt_info = NULL;         /* Creation information for the objects */
+    H5O_type_t    grp_type;                /* Type of object at the location */
+    H5T_cset_t    cset = H5F_DEFAULT_CSET; /* Character encoding for the links */
+    hbool_t       exists;                  /* Whether a link exists */
+    size_t        u;                       /* Local index variable */
+    herr_t        ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(new_loc);
+    HDassert(new_name);
+    HDassert(ocrt_info);
+
+    /* Check that the links go into a group */
+    if (H5O_obj_type(new_loc->oloc, &grp_type) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get object type")
+    if (H5O_TYPE_GROUP != grp_type)
+        HGOTO_ERROR(H5E_LINK, H5E_BADTYPE, FAIL, "location is not a group")
+
+    /* Allocate space for the objects' links and locations */
+    if (NULL == (names = (const char **)H5MM_malloc(count * sizeof(const char *))))
+        HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed for link names")
+    if (NULL == (crt_info = (const void **)H5MM_malloc(count * sizeof(const void *))))
+        HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed for creation information")
+    if (NULL == (lnk = (H5O_link_t *)H5MM_calloc(count * sizeof(H5O_link_t))))
+        HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed for links")
+    if (NULL == (obj_loc = (H5G_loc_t *)H5MM_calloc(count * sizeof(H5G_loc_t))))
+        HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed for object locations")
+
+    /* Check the link names */
+    for (u = 0; u < count; u++) {
+        HDassert(ocrt_info[u].obj_type == ocrt_info[0].obj_type);
+        ocrt_info[u].new_obj = NULL;
+
+        if (!new_name[u] || !*new_name[u])
+            HGOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "no link name")
+        if (HDstrchr(new_name[u], '/') || !HDstrcmp(new_name[u], "."))
+            HGOTO_ERROR(H5E_LINK, H5E_BADVALUE, FAIL, "link name is not the name of a link in the group")
+        if (H5L_exists_tolerant(new_loc, new_name[u], &exists) < 0)
+            HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't check if link exists")
+        if (exists)
+            HGOTO_ERROR(H5E_LINK, H5E_EXISTS, FAIL, "name already exists")
+        names[u] = new_name[u];
+    } /* end for */
+    HDqsort(names, count, sizeof(const char *), H5L__name_cmp);
+    for (u = 1; u < count; u++)
+        if (!HDstrcmp(names[u - 1], names[u]))
+            HGOTO_ERROR(H5E_LINK, H5E_EXISTS, FAIL, "name repeated")
+
+    /* Get the character encoding for the links */
+    if (lcpl_id != H5P_DEFAULT)
+        if (H5CX_get_encoding(&cset) < 0)
+            HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get 'character set' property")
+
+    /* Create the new objects */
+    if (H5O_obj_create_multi(new_loc->oloc->file, count, ocrt_info, obj_loc) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create objects")
+
+    /* Construct the links */
+    for (u = 0; u < count; u++) {
+        lnk[u].type         = H5L_TYPE_HARD;
+        /* (creation order will be re-written during group insertion, if the group is tracking it) */
+        lnk[u].corder       = 0;
+        lnk[u].corder_valid = FALSE;
+        lnk[u].cset         = cset;
+        lnk[u].u.hard.addr  = obj_loc[u].oloc->addr;
+        crt_info[u]         = ocrt_info[u].crt_info;
+        if (NULL == (lnk[u].name = H5MM_strdup(new_name[u])))
+            HGOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "memory allocation failed for link name")
+    } /* end for */
+
+    /* Insert the links into the group */
+    if (H5G_obj_insert_multi(new_loc->oloc, count, lnk, TRUE, ocrt_info[0].obj_type, crt_info) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create new links for objects")
+
+    /* Set the objects' paths */
+    for (u = 0; u < count; u++)
+        if (obj_loc[u].path->user_path_r == NULL)
+            if (H5G_name_set(new_loc->path, obj_loc[u].path, new_name[u]) < 0)
+                HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "cannot set name")
+
+done:
+    /* Decrement refcount on the new objects' object headers in memory */
+    for (u = 0; u < count; u++)
+        if (ocrt_info[u].new_obj) {
+            H5O_loc_t oloc; /* Object location for created object */
+
+            /* Set up object location */
+            HDmemset(&oloc, 0, sizeof(oloc));
+            oloc.file = new_loc->oloc->file;
+            oloc.addr = obj_loc[u].oloc->addr;
+
+            if (H5O_dec_rc_by_loc(&oloc) < 0)
+                HDONE_ERROR(H5E_LINK, H5E_CANTDEC, FAIL,
+                            "unable to decrement refcount on newly created object")
+        } /* end if */
+
+    H5MM_xfree(obj_loc);
+    if (lnk)
+        for (u = 0; u < count; u++)
+            H5MM_xfree(lnk[u].name);
+    H5MM_xfree(lnk);
+    H5MM_xfree(crt_info);
+    H5MM_xfree(names);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5L_link_object_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5L__link_cb
  *
@@ -533,7 +533,7 @@ H5M__open_api_common(hid_t loc_id, const char *name, hid_t mapl_id, void **token
     /* Open the map */
     if (H5VL_optional(*vol_obj_ptr, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, token_ptr) < 0)
         HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, H5I_INVALID_HID, "unable to open map")
-    map = map_args.create.map;
+    map = map_args.open.map;
 
     /* Register an ID for the map */
     if ((ret_value = H5VL_register(H5I_MAP, map, (*vol_obj_ptr)->connector, TRUE)) < 0)
@@ -1234,6 +1234,133 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Mget_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Mput_multi
+ *
+ * Purpose:     H5Mput_multi adds COUNT key-value pairs to the Map
+ *              specified by MAP_ID, as H5Mput does for one pair.  KEYS
+ *              and VALUES are arrays of COUNT elements with the datatypes
+ *              KEY_MEM_TYPE_ID and VAL_MEM_TYPE_ID.  If a key appears
+ *              more than once in KEYS, its last value is kept.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Mput_multi(hid_t map_id, size_t count, hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+             const void *values, hid_t dxpl_id)
+{
+    H5VL_object_t *      vol_obj = NULL;
+    H5VL_optional_args_t vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_map_args_t      map_args;            /* Arguments for map operations */
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "izi*xi*xi", map_id, count, key_mem_type_id, keys, val_mem_type_id, values, dxpl_id);
+
+    /* Check arguments */
+    if (key_mem_type_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid key memory datatype ID")
+    if (val_mem_type_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid value memory datatype ID")
+    if (count > 0 && (!keys || !values))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no keys or values given")
+
+    /* Get map pointer */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(map_id, H5I_MAP)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "map_id is not a map ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Set up VOL callback arguments */
+    map_args.put_multi.count             = count;
+    map_args.put_multi.key_mem_type_id   = key_mem_type_id;
+    map_args.put_multi.keys              = keys;
+    map_args.put_multi.value_mem_type_id = val_mem_type_id;
+    map_args.put_multi.values            = values;
+    vol_cb_args.op_type                  = H5VL_MAP_PUT_MULTI;
+    vol_cb_args.args                     = &map_args;
+
+    /* Set the key/value pairs */
+    if (H5VL_optional(vol_obj, &vol_cb_args, dxpl_id, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "unable to put key/value pairs")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Mput_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Mget_multi
+ *
+ * Purpose:     H5Mget_multi retrieves the values of COUNT keys from the
+ *              Map specified by MAP_ID, as H5Mget does for one key.  KEYS
+ *              is an array of COUNT elements with the datatype
+ *              KEY_MEM_TYPE_ID, and VALUES receives COUNT elements with
+ *              the datatype VAL_MEM_TYPE_ID.  It is an error for any of
+ *              the keys not to be in the map.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Mget_multi(hid_t map_id, size_t count, hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+             void *values, hid_t dxpl_id)
+{
+    H5VL_object_t *      vol_obj = NULL;
+    H5VL_optional_args_t vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_map_args_t      map_args;            /* Arguments for map operations */
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "izi*xi*xi", map_id, count, key_mem_type_id, keys, val_mem_type_id, values, dxpl_id);
+
+    /* Check arguments */
+    if (key_mem_type_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid key memory datatype ID")
+    if (val_mem_type_id < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid value memory datatype ID")
+    if (count > 0 && (!keys || !values))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no keys or value buffer given")
+
+    /* Get map pointer */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(map_id, H5I_MAP)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "map_id is not a map ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Set up VOL callback arguments */
+    map_args.get_multi.count             = count;
+    map_args.get_multi.key_mem_type_id   = key_mem_type_id;
+    map_args.get_multi.keys              = keys;
+    map_args.get_multi.value_mem_type_id = val_mem_type_id;
+    map_args.get_multi.values            = values;
+    vol_cb_args.op_type                  = H5VL_MAP_GET_MULTI;
+    vol_cb_args.args                     = &map_args;
+
+    /* Get the values */
+    if (H5VL_optional(vol_obj, &vol_cb_args, dxpl_id, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to get values")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Mget_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Mexists
  *
@@ -1360,6 +1487,7 @@ H5Miterate(hid_t map_id, hsize_t *idx, hid_t key_mem_type_id, H5M_iterate_t op,
     map_args.specific.args.iterate.loc_params.type     = H5VL_OBJECT_BY_SELF;
     map_args.specific.args.iterate.loc_params.obj_type = H5I_get_type(map_id);
     map_args.specific.args.iterate.idx                 = (idx ? *idx : 0);
+    map_args.specific.args.iterate.key_mem_type_id     = key_mem_type_id;
     map_args.specific.args.iterate.op                  = op;
     map_args.specific.args.iterate.op_data             = op_data;
     vol_cb_args.op_type                                = H5VL_MAP_SPECIFIC;
@@ -1450,6 +1578,7 @@ H5Miterate_by_name(hid_t loc_id, const char *map_name, hsize_t *idx, hid_t key_m
     map_args.specific.args.iterate.loc_params.loc_data.loc_by_name.name    = map_name;
     map_args.specific.args.iterate.loc_params.loc_data.loc_by_name.lapl_id = lapl_id;
     map_args.specific.args.iterate.idx                                     = (idx ? *idx : 0);
+    map_args.specific.args.iterate.key_mem_type_id                         = key_mem_type_id;
     map_args.specific.args.iterate.op                                      = op;
     map_args.specific.args.iterate.op_data                                 = op_data;
     vol_cb_args.op_type                                                    = H5VL_MAP_SPECIFIC;
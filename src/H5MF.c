@@ -1060,6 +1060,152 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5MF_alloc_tmp() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_ohdr_reserve
+ *
+ * Purpose:     Starts a batch of NOBJS new objects, whose object headers
+ *              are allocated with H5MF_ohdr_alloc().  The headers are
+ *              carved, one after another, from one block of file space,
+ *              which is allocated when the first header is, so that all
+ *              the new object headers end up next to each other in the
+ *              file.
+ *
+ *              Files using paged aggregation or alignment allocate object
+ *              headers one at a time as usual, so each header still starts
+ *              where it would have.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_ohdr_reserve(H5F_t *f, size_t nobjs)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Batches don't nest */
+    if (f->shared->ohdr_resv.nobjs > 0 || H5F_addr_defined(f->shared->ohdr_resv.addr))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_BADVALUE, FAIL, "object header space already reserved")
+
+    /* Only reserve space when there are several headers to allocate */
+    if (nobjs > 1 && !H5F_PAGED_AGGR(f) && f->shared->alignment <= 1) {
+        f->shared->ohdr_resv.nobjs = nobjs;
+        f->shared->ohdr_resv.addr  = HADDR_UNDEF;
+        f->shared->ohdr_resv.size  = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_ohdr_reserve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_ohdr_alloc
+ *
+ * Purpose:     Allocates SIZE bytes of file space for an object header.
+ *
+ *              Within a batch started with H5MF_ohdr_reserve(), the space
+ *              comes from the block reserved for the batch.  The block is
+ *              sized for the rest of the batch from the first header
+ *              allocated in it, and is replaced with a new block, the
+ *              unused part of the old one being freed, if a header won't
+ *              fit in what is left.
+ *
+ * Return:      Success:        The file address of the object header
+ *              Failure:        HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+haddr_t
+H5MF_ohdr_alloc(H5F_t *f, hsize_t size)
+{
+    H5F_ohdr_resv_t *resv;                    /* Reserved object header space */
+    haddr_t          ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_NOAPI(HADDR_UNDEF)
+
+    /* check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(size > 0);
+
+    resv = &f->shared->ohdr_resv;
+
+    /* Allocate headers outside a batch one at a time */
+    if (0 == resv->nobjs) {
+        if (HADDR_UNDEF == (ret_value = H5MF_alloc(f, H5FD_MEM_OHDR, size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "file allocation failed for object header")
+        HGOTO_DONE(ret_value)
+    } /* end if */
+
+    /* Reserve a new block for the rest of the batch, if the header won't fit in the current one */
+    if (resv->size < size) {
+        if (H5F_addr_defined(resv->addr) && resv->size > 0)
+            if (H5MF_xfree(f, H5FD_MEM_OHDR, resv->addr, resv->size) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, HADDR_UNDEF,
+                            "unable to free reserved object header space")
+        resv->addr = HADDR_UNDEF;
+        resv->size = 0;
+
+        if (HADDR_UNDEF == (resv->addr = H5MF_alloc(f, H5FD_MEM_OHDR, size * resv->nobjs)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF,
+                        "file allocation failed for object header space")
+        resv->size = size * resv->nobjs;
+    } /* end if */
+
+    /* Carve the header from the reserved block */
+    ret_value = resv->addr;
+    resv->addr += size;
+    resv->size -= size;
+    resv->nobjs--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_ohdr_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF_ohdr_release
+ *
+ * Purpose:     Ends a batch started with H5MF_ohdr_reserve(), freeing the
+ *              reserved space no object header was allocated in.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF_ohdr_release(H5F_t *f)
+{
+    H5F_ohdr_resv_t *resv;                /* Reserved object header space */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    resv = &f->shared->ohdr_resv;
+
+    /* Free the unused part of the reserved block */
+    if (H5F_addr_defined(resv->addr) && resv->size > 0)
+        if (H5MF_xfree(f, H5FD_MEM_OHDR, resv->addr, resv->size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "unable to free reserved object header space")
+
+done:
+    /* End the batch */
+    resv->nobjs = 0;
+    resv->addr  = HADDR_UNDEF;
+    resv->size  = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF_ohdr_release() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5MF_xfree
  *
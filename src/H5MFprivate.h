@@ -62,6 +62,11 @@ H5_DLL herr_t H5MF_get_free_sections(H5F_t *f, H5FD_mem_t type, size_t nsects, H
 /* File 'temporary' space allocation routines */
 H5_DLL haddr_t H5MF_alloc_tmp(H5F_t *f, hsize_t size);
 
+/* Object header space reservation routines */
+H5_DLL herr_t  H5MF_ohdr_reserve(H5F_t *f, size_t nobjs);
+H5_DLL haddr_t H5MF_ohdr_alloc(H5F_t *f, hsize_t size);
+H5_DLL herr_t  H5MF_ohdr_release(H5F_t *f);
+
 /* 'block aggregator' routines */
 H5_DLL herr_t H5MF_free_aggrs(H5F_t *f);
 
@@ -0,0 +1,300 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Mbtree2.c
+ *
+ * Purpose:     v2 B-tree callbacks for indexing the key-value pairs of
+ *              maps by the hash of their keys
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Mmodule.h" /* This source code file is part of the H5M module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Mpkg.h"      /* Maps                                     */
+#include "H5MMprivate.h" /* Memory management                        */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/*
+ * Data exchange structure for comparing keys.  This structure is passed
+ * through the fractal heap layer to compare a key with the key of a
+ * key-value pair.
+ */
+typedef struct H5M_fh_ud_cmp_t {
+    /* downward */
+    const H5M_bt2_ud_t *bt2_udata; /* User data for the v2 B-tree operation */
+
+    /* upward */
+    int cmp; /* Comparison of the two keys */
+} H5M_fh_ud_cmp_t;
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* v2 B-tree driver callbacks */
+static herr_t H5M__btree2_store(void *native, const void *udata);
+static herr_t H5M__btree2_compare(const void *rec1, const void *rec2, int *result);
+static herr_t H5M__btree2_encode(uint8_t *raw, const void *native, void *ctx);
+static herr_t H5M__btree2_decode(const uint8_t *raw, void *native, void *ctx);
+static herr_t H5M__btree2_debug(FILE *stream, int indent, int fwidth, const void *record, const void *_udata);
+
+/* Fractal heap function callbacks */
+static herr_t H5M__fh_key_cmp(const void *obj, size_t obj_len, void *op_data);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* v2 B-tree class for indexing the key-value pairs of maps */
+const H5B2_class_t H5M_BT2[1] = {{
+    /* B-tree class information */
+    H5B2_MAP_ID,           /* Type of B-tree */
+    "H5B2_MAP_ID",         /* Name of B-tree class */
+    sizeof(H5M_bt2_rec_t), /* Size of native record */
+    NULL,                  /* Create client callback context */
+    NULL,                  /* Destroy client callback context */
+    H5M__btree2_store,     /* Record storage callback */
+    H5M__btree2_compare,   /* Record comparison callback */
+    H5M__btree2_encode,    /* Record encoding callback */
+    H5M__btree2_decode,    /* Record decoding callback */
+    H5M__btree2_debug      /* Record debugging callback */
+}};
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__fh_key_cmp
+ *
+ * Purpose:     Compares the key of a key-value pair in a fractal heap to
+ *              another key, and makes the 'found' callback for the value
+ *              if they are the same.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__fh_key_cmp(const void *_obj, size_t obj_len, void *_udata)
+{
+    H5M_fh_ud_cmp_t *   udata     = (H5M_fh_ud_cmp_t *)_udata; /* User data for 'op' callback */
+    const H5M_bt2_ud_t *bt2_udata = udata->bt2_udata;          /* User data for B-tree operation */
+    const uint8_t *     obj       = (const uint8_t *)_obj;     /* Key-value pair */
+    size_t              key_len;                               /* Length of the pair's key */
+    size_t              val_len;                               /* Length of the pair's value */
+    herr_t              ret_value = SUCCEED;                   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get the length of the pair's key */
+    if (H5M__elmt_len(bt2_udata->key_info, obj, obj_len, &key_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "corrupt key in map")
+
+    /* Compare the keys, shorter keys first */
+    if (bt2_udata->key_len < key_len)
+        udata->cmp = -1;
+    else if (bt2_udata->key_len > key_len)
+        udata->cmp = 1;
+    else
+        udata->cmp = HDmemcmp(bt2_udata->key, obj, key_len);
+
+    /* Check for correct key & callback to make */
+    if (udata->cmp == 0 && bt2_udata->val_op) {
+        if (H5M__elmt_len(bt2_udata->val_info, obj + key_len, obj_len - key_len, &val_len) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "corrupt value in map")
+        if ((bt2_udata->val_op)(obj + key_len, val_len, bt2_udata->val_op_data) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "value found callback failed")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__fh_key_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__btree2_store
+ *
+ * Purpose:     Store user information into native record for v2 B-tree
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__btree2_store(void *_nrecord, const void *_udata)
+{
+    const H5M_bt2_ud_t *udata   = (const H5M_bt2_ud_t *)_udata;
+    H5M_bt2_rec_t *     nrecord = (H5M_bt2_rec_t *)_nrecord;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Copy user information info native record */
+    nrecord->hash = udata->hash;
+    H5MM_memcpy(nrecord->id, udata->id, (size_t)H5M_FHEAP_ID_LEN);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5M__btree2_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__btree2_compare
+ *
+ * Purpose:     Compare two native information records, according to some
+ *              key.  Keys are ordered by their hash, then by their length
+ *              and bytes.
+ *
+ * Return:      <0 if rec1 < rec2
+ *              =0 if rec1 == rec2
+ *              >0 if rec1 > rec2
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__btree2_compare(const void *_bt2_udata, const void *_bt2_rec, int *result)
+{
+    const H5M_bt2_ud_t * bt2_udata = (const H5M_bt2_ud_t *)_bt2_udata;
+    const H5M_bt2_rec_t *bt2_rec   = (const H5M_bt2_rec_t *)_bt2_rec;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(bt2_udata);
+    HDassert(bt2_rec);
+
+    /* Check hash value */
+    if (bt2_udata->hash < bt2_rec->hash)
+        *result = (-1);
+    else if (bt2_udata->hash > bt2_rec->hash)
+        *result = 1;
+    else {
+        H5M_fh_ud_cmp_t fh_udata; /* User data for fractal heap 'op' callback */
+
+        /* Prepare user data for callback */
+        /* down */
+        fh_udata.bt2_udata = bt2_udata;
+
+        /* up */
+        fh_udata.cmp = 0;
+
+        /* Check if the user's key and the B-tree's key are the same */
+        if (H5HF_op(bt2_udata->fheap, bt2_rec->id, H5M__fh_key_cmp, &fh_udata) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTCOMPARE, FAIL, "can't compare btree2 records")
+
+        /* Callback will set comparison value */
+        *result = fh_udata.cmp;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5M__btree2_compare() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__btree2_encode
+ *
+ * Purpose:     Encode native information into raw form for storing on disk
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__btree2_encode(uint8_t *raw, const void *_nrecord, void H5_ATTR_UNUSED *ctx)
+{
+    const H5M_bt2_rec_t *nrecord = (const H5M_bt2_rec_t *)_nrecord;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Encode the record's fields */
+    UINT32ENCODE(raw, nrecord->hash)
+    H5MM_memcpy(raw, nrecord->id, (size_t)H5M_FHEAP_ID_LEN);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5M__btree2_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__btree2_decode
+ *
+ * Purpose:     Decode raw disk form of record into native form
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__btree2_decode(const uint8_t *raw, void *_nrecord, void H5_ATTR_UNUSED *ctx)
+{
+    H5M_bt2_rec_t *nrecord = (H5M_bt2_rec_t *)_nrecord;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Decode the record's fields */
+    UINT32DECODE(raw, nrecord->hash)
+    H5MM_memcpy(nrecord->id, raw, (size_t)H5M_FHEAP_ID_LEN);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5M__btree2_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__btree2_debug
+ *
+ * Purpose:     Debug native form of record
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__btree2_debug(FILE *stream, int indent, int fwidth, const void *_nrecord,
+                  const void H5_ATTR_UNUSED *_udata)
+{
+    const H5M_bt2_rec_t *nrecord = (const H5M_bt2_rec_t *)_nrecord;
+    unsigned             u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDfprintf(stream, "%*s%-*s {%x, ", indent, "", fwidth, "Record:", (unsigned)nrecord->hash);
+    for (u = 0; u < H5M_FHEAP_ID_LEN; u++)
+        HDfprintf(stream, "%02x%s", nrecord->id[u], (u < (H5M_FHEAP_ID_LEN - 1) ? " " : "}\n"));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5M__btree2_debug() */
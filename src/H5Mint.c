@@ -0,0 +1,1808 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Mint.c
+ *
+ * Purpose:     "Internal" routines for maps stored in the native file
+ *              format.  A map's key-value pairs are kept in a fractal
+ *              heap and indexed by the hash of their key in a v2 B-tree
+ *              (see H5Mstorage.c).
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Mmodule.h" /* This source code file is part of the H5M module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5ACprivate.h" /* Metadata cache                           */
+#include "H5CXprivate.h" /* API Contexts                             */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Fprivate.h"  /* Files                                    */
+#include "H5FOprivate.h" /* File objects                             */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5Lprivate.h"  /* Links                                    */
+#include "H5Mpkg.h"      /* Maps                                     */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Pprivate.h"  /* Property lists                           */
+#include "H5VLprivate.h" /* Virtual Object Layer                     */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/*
+ * Conversion between keys or values in memory and the way they are
+ * stored.  For variable-length sequences, the base type elements are
+ * converted; the characters of variable-length strings aren't converted.
+ */
+typedef struct H5M_conv_t {
+    const H5M_type_info_t *info;          /* How the keys or values are stored */
+    size_t                 mem_size;      /* Size of a memory element */
+    size_t                 mem_elmt_size; /* Size of a memory element, or of a base type element if VL */
+    H5T_t *                mem_base;      /* Base type of a memory variable-length sequence, or NULL */
+    H5T_path_t *           tpath;         /* Conversion path, or NULL if no conversion is needed */
+    hid_t                  src_id;        /* Temporary ID for source datatype of conversion */
+    hid_t                  dst_id;        /* Temporary ID for destination datatype of conversion */
+} H5M_conv_t;
+
+/* Position of a key in a batch, for visiting the keys in hash order */
+typedef struct H5M_key_order_t {
+    uint32_t hash; /* Hash of key */
+    size_t   idx;  /* Index of key in batch */
+} H5M_key_order_t;
+
+/* User data for gathering the values found for a batch of keys */
+typedef struct H5M_get_ud_t {
+    uint8_t *buf;      /* Buffer holding the values found */
+    size_t   buf_size; /* Size of buffer */
+    size_t   len;      /* Number of bytes used in buffer */
+} H5M_get_ud_t;
+
+/* User data for application-style iteration over the keys of a map */
+typedef struct H5M_iter_ud_t {
+    hid_t         map_id;  /* The map ID for the application callback */
+    H5M_conv_t *  conv;    /* Conversion of keys to memory */
+    void *        key_buf; /* Buffer for key in memory */
+    hsize_t *     idx;     /* Index of next key */
+    H5M_iterate_t op;      /* Application callback */
+    void *        op_data; /* Application's op data */
+} H5M_iter_ud_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5M__open_oid(H5M_t *map);
+static herr_t H5M__shared_free(H5M_shared_t *shared);
+static herr_t H5M__set_access_plist(H5M_t *map, hid_t mapl_id);
+static herr_t H5M__conv_init(H5M_conv_t *conv, const H5M_type_info_t *info, hid_t mem_type_id,
+                             hbool_t to_file);
+static herr_t H5M__conv_reset(H5M_conv_t *conv);
+static herr_t H5M__conv_convert(const H5M_conv_t *conv, size_t nelmts, uint8_t *buf);
+static herr_t H5M__encode(const H5M_conv_t *conv, size_t count, const void *mem, H5M_elmts_t *elmts);
+static herr_t H5M__decode(const H5M_conv_t *conv, size_t nelmts, const uint8_t *buf, const size_t *off,
+                          void *mem, const H5T_vlen_alloc_info_t *vl_alloc_info);
+static void   H5M__free_vl(const H5M_conv_t *conv, size_t count, void *mem,
+                           const H5T_vlen_alloc_info_t *vl_alloc_info);
+static void   H5M__elmts_reset(H5M_elmts_t *elmts);
+static int    H5M__key_order_cmp(const void *_order1, const void *_order2);
+static herr_t H5M__key_order(const H5M_elmts_t *keys, H5M_key_order_t **order);
+static herr_t H5M__get_val_cb(const uint8_t *val, size_t val_len, void *_udata);
+static herr_t H5M__iterate_cb(const uint8_t *key, size_t key_len, void *_udata);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Declare a free list to manage the H5M_t struct */
+H5FL_DEFINE(H5M_t);
+H5FL_DEFINE(H5M_shared_t);
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__create_named
+ *
+ * Purpose:     Internal routine to create a new "named" map.
+ *
+ * Return:      Success:    Non-NULL, pointer to new map object.
+ *
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5M_t *
+H5M__create_named(const H5G_loc_t *loc, const char *name, hid_t lcpl_id, H5M_obj_create_t *mcrt_info)
+{
+    H5O_obj_create_t ocrt_info;        /* Information for object creation */
+    H5M_t *          ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(name && *name);
+    HDassert(lcpl_id != H5P_DEFAULT);
+    HDassert(mcrt_info);
+
+    /* Set up object creation information */
+    ocrt_info.obj_type = H5O_TYPE_MAP;
+    ocrt_info.crt_info = mcrt_info;
+    ocrt_info.new_obj  = NULL;
+
+    /* Create the new map and link it to its parent group */
+    if (H5L_link_object(loc, name, &ocrt_info, lcpl_id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "unable to create and link to map")
+    HDassert(ocrt_info.new_obj);
+
+    /* Set the return value */
+    ret_value = (H5M_t *)ocrt_info.new_obj;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__create_named() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__create
+ *
+ * Purpose:     Creates a new, empty map in a file, with the key and value
+ *              datatypes in MCRT_INFO.
+ *
+ * Return:      Success:    A handle for the map.  The map is opened
+ *                          and should eventually be closed by calling
+ *                          H5M_close().
+ *
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5M_t *
+H5M__create(H5F_t *file, H5M_obj_create_t *mcrt_info)
+{
+    H5M_t *       map = NULL;          /* New map */
+    H5M_shared_t *shared;              /* Shared map info */
+    H5P_genplist_t *plist;             /* Map creation property list */
+    size_t        ohdr_size;           /* Size hint for the object header */
+    hbool_t       oloc_init = FALSE;   /* Whether the map's object location was created */
+    H5M_t *       ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(file);
+    HDassert(mcrt_info);
+    HDassert(mcrt_info->key_type);
+    HDassert(mcrt_info->val_type);
+    HDassert(mcrt_info->mcpl_id != H5P_DEFAULT);
+
+    /* Create an open map */
+    if (NULL == (map = H5FL_CALLOC(H5M_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    map->mapl_id = H5I_INVALID_HID;
+    if (NULL == (map->shared = shared = H5FL_CALLOC(H5M_shared_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    shared->mcpl_id         = H5I_INVALID_HID;
+    shared->mesg.fheap_addr = HADDR_UNDEF;
+    shared->mesg.bt2_addr   = HADDR_UNDEF;
+
+    /* Copy the datatypes, for storing in the file */
+    if (H5T_is_sensible(mcrt_info->key_type) != TRUE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "key datatype is not sensible")
+    if (H5T_is_sensible(mcrt_info->val_type) != TRUE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "value datatype is not sensible")
+    if (NULL == (shared->mesg.key_type = H5T_copy(mcrt_info->key_type, H5T_COPY_TRANSIENT)) ||
+        NULL == (shared->mesg.val_type = H5T_copy(mcrt_info->val_type, H5T_COPY_TRANSIENT)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "unable to copy datatype")
+    if (H5T_set_version(file, shared->mesg.key_type) < 0 || H5T_set_version(file, shared->mesg.val_type) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSET, NULL, "can't set latest version of datatype")
+    if (H5T_set_loc(shared->mesg.key_type, H5F_VOL_OBJ(file), H5T_LOC_DISK) < 0 ||
+        H5T_set_loc(shared->mesg.val_type, H5F_VOL_OBJ(file), H5T_LOC_DISK) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't set datatype location")
+
+    /* Set up how the keys & values are stored, failing early for unsupported datatypes */
+    if (H5M__type_info_init(shared->mesg.key_type, &shared->key) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "unsupported key datatype")
+    if (H5M__type_info_init(shared->mesg.val_type, &shared->val) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "unsupported value datatype")
+
+    /* Keep a copy of the creation property list */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(mcrt_info->mcpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a property list")
+    if ((shared->mcpl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "can't copy map creation property list")
+    if (H5M__set_access_plist(map, mcrt_info->mapl_id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSET, NULL, "can't set map access property list")
+
+    /* Create the object header, with room for the map message */
+    ohdr_size = H5O_msg_size_f(file, mcrt_info->mcpl_id, H5O_MAP_ID, &shared->mesg, (size_t)0);
+    if (H5O_create(file, ohdr_size, (size_t)1, mcrt_info->mcpl_id, &(map->oloc) /*out*/) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "unable to create map object header")
+    oloc_init = TRUE;
+
+    /* Create the storage for the key-value pairs, then describe it in the map message */
+    H5_BEGIN_TAG(map->oloc.addr)
+    if (H5M__storage_create(file, &shared->mesg) < 0)
+        HGOTO_ERROR_TAG(H5E_MAP, H5E_CANTINIT, NULL, "unable to create map storage")
+    /* (Libraries that don't know the map message must not open the file for writing) */
+    if (H5O_msg_create(&(map->oloc), H5O_MAP_ID,
+                       H5O_MSG_FLAG_CONSTANT | H5O_MSG_FLAG_FAIL_IF_UNKNOWN_AND_OPEN_FOR_WRITE,
+                       H5O_UPDATE_TIME, &shared->mesg) < 0)
+        HGOTO_ERROR_TAG(H5E_MAP, H5E_CANTINIT, NULL, "unable to create map message")
+    H5_END_TAG
+
+    /* Add map to list of open objects in file */
+    if (H5FO_top_incr(map->oloc.file, map->oloc.addr) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINC, NULL, "can't incr object ref. count")
+    if (H5FO_insert(map->oloc.file, map->oloc.addr, shared, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, NULL, "can't insert map into list of open objects")
+
+    /* Set the count of times the object is opened */
+    shared->fo_count = 1;
+
+    /* Set return value */
+    ret_value = map;
+
+done:
+    if (ret_value == NULL) {
+        /* Release the map's object header, if it was created */
+        if (oloc_init) {
+            if (H5O_dec_rc_by_loc(&(map->oloc)) < 0)
+                HDONE_ERROR(H5E_MAP, H5E_CANTDEC, NULL,
+                            "unable to decrement refcount on newly created object")
+            if (H5O_close(&(map->oloc), NULL) < 0)
+                HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, NULL, "unable to release object header")
+            if (H5O_delete(file, map->oloc.addr) < 0)
+                HDONE_ERROR(H5E_MAP, H5E_CANTDELETE, NULL, "unable to delete object header")
+        } /* end if */
+        if (map != NULL) {
+            if (map->shared != NULL && H5M__shared_free(map->shared) < 0)
+                HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, NULL, "unable to release shared map info")
+            if (map->mapl_id > 0 && H5I_dec_ref(map->mapl_id) < 0)
+                HDONE_ERROR(H5E_MAP, H5E_CANTDEC, NULL, "unable to release map access property list")
+            map = H5FL_FREE(H5M_t, map);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__open_name
+ *
+ * Purpose:     Opens an existing map by name.
+ *
+ * Return:      Success:    Ptr to a new map.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5M_t *
+H5M__open_name(const H5G_loc_t *loc, const char *name, hid_t mapl_id)
+{
+    H5M_t *    map = NULL;        /* Map to open */
+    H5G_loc_t  map_loc;           /* Location used to open map */
+    H5G_name_t map_path;          /* Opened object group hier. path */
+    H5O_loc_t  map_oloc;          /* Opened object object location */
+    hbool_t    loc_found = FALSE; /* Location at 'name' found */
+    H5O_type_t obj_type;          /* Type of object at location */
+    H5M_t *    ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(loc);
+    HDassert(name);
+
+    /* Set up opened map location to fill in */
+    map_loc.oloc = &map_oloc;
+    map_loc.path = &map_path;
+    H5G_loc_reset(&map_loc);
+
+    /* Find the map object */
+    if (H5G_loc_find(loc, name, &map_loc /*out*/) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, NULL, "map not found")
+    loc_found = TRUE;
+
+    /* Check that the object found is the correct type */
+    if (H5O_obj_type(&map_oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get object type")
+    if (obj_type != H5O_TYPE_MAP)
+        HGOTO_ERROR(H5E_MAP, H5E_BADTYPE, NULL, "not a map")
+
+    /* Open the map */
+    if (NULL == (map = H5M_open(&map_loc)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "unable to open map")
+
+    /* Use the access property list given */
+    if (H5M__set_access_plist(map, mapl_id) < 0) {
+        if (H5M_close(map) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, NULL, "unable to release map")
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSET, NULL, "can't set map access property list")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = map;
+
+done:
+    if (!ret_value)
+        if (loc_found && !map && H5G_loc_free(&map_loc) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, NULL, "can't free location")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__open_name() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M_open
+ *
+ * Purpose:     Opens an existing map, with the default access property
+ *              list.  The map should eventually be closed by calling
+ *              H5M_close().
+ *
+ * Return:      Success:    Ptr to a new map.
+ *
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5M_t *
+H5M_open(const H5G_loc_t *loc)
+{
+    H5M_t *       map = NULL;       /* Map opened */
+    H5M_shared_t *shared_fo;        /* Shared map object */
+    H5M_t *       ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Check args */
+    HDassert(loc);
+
+    /* Allocate the map structure */
+    if (NULL == (map = H5FL_CALLOC(H5M_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate space for map")
+    map->mapl_id = H5I_INVALID_HID;
+
+    /* Shallow copy (take ownership) of the map location object */
+    if (H5O_loc_copy_shallow(&(map->oloc), loc->oloc) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "can't copy object location")
+    if (H5G_name_copy(&(map->path), loc->path, H5_COPY_SHALLOW) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "can't copy path")
+
+    /* Check if map was already open */
+    if ((shared_fo = (H5M_shared_t *)H5FO_opened(map->oloc.file, map->oloc.addr)) == NULL) {
+
+        /* Clear any errors from H5FO_opened() */
+        H5E_clear_stack(NULL);
+
+        /* Open the map object */
+        if (H5M__open_oid(map) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, NULL, "not found")
+
+        /* Add map to list of open objects in file */
+        if (H5FO_insert(map->oloc.file, map->oloc.addr, map->shared, FALSE) < 0) {
+            H5M__shared_free(map->shared);
+            map->shared = NULL;
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, NULL, "can't insert map into list of open objects")
+        } /* end if */
+
+        /* Increment object count for the object in the top file */
+        if (H5FO_top_incr(map->oloc.file, map->oloc.addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINC, NULL, "can't increment object count")
+
+        /* Set open object count */
+        map->shared->fo_count = 1;
+    } /* end if */
+    else {
+        /* Point to shared map info */
+        map->shared = shared_fo;
+
+        /* Increment shared reference count */
+        shared_fo->fo_count++;
+
+        /* Check if the object has been opened through the top file yet */
+        if (H5FO_top_count(map->oloc.file, map->oloc.addr) == 0) {
+            /* Open the object through this top file */
+            if (H5O_open(&(map->oloc)) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "unable to open object header")
+        } /* end if */
+
+        /* Increment object count for the object in the top file */
+        if (H5FO_top_incr(map->oloc.file, map->oloc.addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINC, NULL, "can't increment object count")
+    } /* end else */
+
+    /* Use the default access property list */
+    if (H5M__set_access_plist(map, H5P_MAP_ACCESS_DEFAULT) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSET, NULL, "can't set map access property list")
+
+    /* Set return value */
+    ret_value = map;
+
+done:
+    if (!ret_value && map) {
+        if (map->shared)
+            H5M_close(map);
+        else {
+            H5O_loc_free(&(map->oloc));
+            H5G_name_free(&(map->path));
+            map = H5FL_FREE(H5M_t, map);
+        } /* end else */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__open_oid
+ *
+ * Purpose:     Opens the object header of a map, and reads its map
+ *              message into new shared map info.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__open_oid(H5M_t *map)
+{
+    H5M_shared_t *shared;              /* Shared map info */
+    hbool_t       obj_opened = FALSE;  /* Whether the object header was opened */
+    herr_t        ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(map);
+
+    /* Allocate the shared information for the map */
+    if (NULL == (map->shared = shared = H5FL_CALLOC(H5M_shared_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    shared->mcpl_id = H5I_INVALID_HID;
+
+    /* Grab the object header */
+    if (H5O_open(&(map->oloc)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open map")
+    obj_opened = TRUE;
+
+    /* Get the map message, with the datatypes & storage addresses */
+    if (NULL == H5O_msg_read(&(map->oloc), H5O_MAP_ID, &shared->mesg))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "not a map")
+
+    /* Set up how the keys & values are stored */
+    if (H5M__type_info_init(shared->mesg.key_type, &shared->key) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unsupported key datatype")
+    if (H5M__type_info_init(shared->mesg.val_type, &shared->val) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unsupported value datatype")
+
+    /* Map creation properties aren't stored, so use the defaults */
+    if ((shared->mcpl_id = H5P_copy_plist((H5P_genplist_t *)H5I_object(H5P_MAP_CREATE_DEFAULT), FALSE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy map creation property list")
+
+done:
+    if (ret_value < 0) {
+        if (obj_opened)
+            H5O_close(&(map->oloc), NULL);
+        if (map->shared) {
+            H5M__shared_free(map->shared);
+            map->shared = NULL;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__open_oid() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__shared_free
+ *
+ * Purpose:     Releases the info shared by the open handles to a map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__shared_free(H5M_shared_t *shared)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(shared);
+
+    if (H5M__type_info_reset(&shared->key) < 0 || H5M__type_info_reset(&shared->val) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype info")
+    if (H5O_msg_reset(H5O_MAP_ID, &shared->mesg) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRESET, FAIL, "can't reset map message")
+    if (shared->mcpl_id > 0 && H5I_dec_ref(shared->mcpl_id) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "can't release map creation property list")
+    shared = H5FL_FREE(H5M_shared_t, shared);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__shared_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__set_access_plist
+ *
+ * Purpose:     Keeps a copy of MAPL_ID as the access property list of a
+ *              map handle.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__set_access_plist(H5M_t *map, hid_t mapl_id)
+{
+    H5P_genplist_t *plist;               /* Map access property list */
+    hid_t           new_mapl_id;         /* Copy of property list */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(map);
+
+    if (H5P_DEFAULT == mapl_id)
+        mapl_id = H5P_MAP_ACCESS_DEFAULT;
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(mapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a property list")
+    if ((new_mapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy map access property list")
+
+    /* Replace any previous property list */
+    if (map->mapl_id > 0 && H5I_dec_ref(map->mapl_id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "can't release map access property list")
+    map->mapl_id = new_mapl_id;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__set_access_plist() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M_close
+ *
+ * Purpose:     Closes the specified map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M_close(H5M_t *map)
+{
+    hbool_t corked;                /* Whether the map is corked or not     */
+    hbool_t file_closed = TRUE;    /* H5O_close also closed the file?      */
+    herr_t  ret_value   = SUCCEED; /* Return value                         */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(map && map->shared);
+    HDassert(map->shared->fo_count > 0);
+
+    --map->shared->fo_count;
+
+    if (0 == map->shared->fo_count) {
+        /* Uncork cache entries with object address tag */
+        if (H5AC_cork(map->oloc.file, map->oloc.addr, H5AC__GET_CORKED, &corked) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to retrieve an object's cork status")
+        if (corked)
+            if (H5AC_cork(map->oloc.file, map->oloc.addr, H5AC__UNCORK, NULL) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTUNCORK, FAIL, "unable to uncork an object")
+
+        /* Remove the map from the list of opened objects in the file */
+        if (H5FO_top_decr(map->oloc.file, map->oloc.addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't decrement count for object")
+        if (H5FO_delete(map->oloc.file, map->oloc.addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't remove map from list of open objects")
+        if (H5O_close(&(map->oloc), &file_closed) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to close")
+
+        /* Evict map metadata if evicting on close */
+        if (!file_closed && H5F_SHARED(map->oloc.file) && H5F_EVICT_ON_CLOSE(map->oloc.file)) {
+            if (H5AC_flush_tagged_metadata(map->oloc.file, map->oloc.addr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush tagged metadata")
+            if (H5AC_evict_tagged_metadata(map->oloc.file, map->oloc.addr, FALSE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to evict tagged metadata")
+        } /* end if */
+
+        /* Free memory */
+        if (H5M__shared_free(map->shared) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "unable to release shared map info")
+        map->shared = NULL;
+    } /* end if */
+    else {
+        /* Decrement the ref. count for this object in the top file */
+        if (H5FO_top_decr(map->oloc.file, map->oloc.addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't decrement count for object")
+
+        /* Check reference count for this object in the top file */
+        if (H5FO_top_count(map->oloc.file, map->oloc.addr) == 0) {
+            if (H5O_close(&(map->oloc), NULL) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to close")
+        } /* end if */
+        else
+            /* Free object location (i.e. "unhold" the file if appropriate) */
+            if (H5O_loc_free(&(map->oloc)) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "problem attempting to free location")
+    } /* end else */
+
+    /* Release the access property list */
+    if (map->mapl_id > 0 && H5I_dec_ref(map->mapl_id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "can't release map access property list")
+
+    if (H5G_name_free(&(map->path)) < 0) {
+        map = H5FL_FREE(H5M_t, map);
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't free map entry name")
+    } /* end if */
+
+    map = H5FL_FREE(H5M_t, map);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M_oloc
+ *
+ * Purpose:     Returns a pointer to the object location for a map.
+ *
+ * Return:      Success:    Ptr to object location
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5O_loc_t *
+H5M_oloc(H5M_t *map)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(map ? &(map->oloc) : NULL)
+} /* end H5M_oloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M_nameof
+ *
+ * Purpose:     Returns a pointer to the hier. name for a map.
+ *
+ * Return:      Success:    Ptr to hier. name
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5G_name_t *
+H5M_nameof(H5M_t *map)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(map ? &(map->path) : NULL)
+} /* end H5M_nameof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get_type
+ *
+ * Purpose:     Gets an ID for a copy of the key datatype of a map, if KEY
+ *              is TRUE, or of the value datatype otherwise.
+ *
+ * Return:      Success:    ID for datatype
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5M__get_type(const H5M_t *map, hbool_t key)
+{
+    H5T_t *dt        = NULL;            /* Copy of datatype */
+    hid_t  ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(map);
+
+    /* Copy the map's datatype */
+    if (NULL ==
+        (dt = H5T_copy(key ? map->shared->mesg.key_type : map->shared->mesg.val_type, H5T_COPY_TRANSIENT)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, H5I_INVALID_HID, "unable to copy datatype")
+
+    /* Mark any datatypes as being in memory now */
+    if (H5T_set_loc(dt, NULL, H5T_LOC_MEMORY) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, H5I_INVALID_HID, "invalid datatype location")
+
+    /* Lock copied type */
+    if (H5T_lock(dt, FALSE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, H5I_INVALID_HID, "unable to lock transient datatype")
+
+    /* Create an ID */
+    if ((ret_value = H5I_register(H5I_DATATYPE, dt, TRUE)) < 0)
+        HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register datatype")
+
+done:
+    if (ret_value < 0)
+        if (dt && H5T_close_real(dt) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, H5I_INVALID_HID, "unable to release datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__get_type() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get_create_plist
+ *
+ * Purpose:     Gets an ID for a copy of the creation property list of a
+ *              map.
+ *
+ * Return:      Success:    ID for property list
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5M__get_create_plist(const H5M_t *map)
+{
+    H5P_genplist_t *plist;                       /* Map creation property list */
+    hid_t           ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(map);
+
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(map->shared->mcpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "can't get property list")
+    if ((ret_value = H5P_copy_plist(plist, TRUE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, H5I_INVALID_HID, "can't copy map creation properties")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__get_create_plist() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get_access_plist
+ *
+ * Purpose:     Gets an ID for a copy of the access property list of a
+ *              map.
+ *
+ * Return:      Success:    ID for property list
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5M__get_access_plist(const H5M_t *map)
+{
+    H5P_genplist_t *plist;                       /* Map access property list */
+    hid_t           ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(map);
+
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(map->mapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5I_INVALID_HID, "can't get property list")
+    if ((ret_value = H5P_copy_plist(plist, TRUE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, H5I_INVALID_HID, "can't copy map access properties")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__get_access_plist() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get_count
+ *
+ * Purpose:     Gets the number of key-value pairs in a map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__get_count(const H5M_t *map, hsize_t *count)
+{
+    H5M_storage_t storage;                /* Open storage of map */
+    hbool_t       storage_open = FALSE;   /* Whether the storage is open */
+    herr_t        ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(map->oloc.addr)
+
+    /* Check args */
+    HDassert(count);
+
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    storage_open = TRUE;
+    if (H5M__storage_count(&storage, count) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOUNT, FAIL, "can't get number of keys in map")
+
+done:
+    if (storage_open && H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5M__get_count() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__conv_init
+ *
+ * Purpose:     Sets up the conversion between keys or values with the
+ *              memory datatype MEM_TYPE_ID and the way INFO says they are
+ *              stored, in the direction given by TO_FILE.  The memory
+ *              datatype must be a variable-length string or sequence
+ *              exactly when the stored datatype is.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__conv_init(H5M_conv_t *conv, const H5M_type_info_t *info, hid_t mem_type_id, hbool_t to_file)
+{
+    const H5T_t *mem_type;            /* Memory datatype */
+    const H5T_t *mem_elmt_type;       /* Memory datatype of elements converted */
+    const H5T_t *file_elmt_type;      /* Stored datatype of elements converted */
+    htri_t       is_vlstr;            /* Whether the memory datatype is a variable-length string */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(conv);
+    HDassert(info);
+
+    HDmemset(conv, 0, sizeof(*conv));
+    conv->info   = info;
+    conv->src_id = H5I_INVALID_HID;
+    conv->dst_id = H5I_INVALID_HID;
+
+    if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+    if (0 == (conv->mem_size = H5T_get_size(mem_type)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get datatype size")
+    if ((is_vlstr = H5T_is_variable_str(mem_type)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable-length string")
+
+    /* Check that the memory datatype has the same layout as the stored one */
+    if (info->is_vlstr || is_vlstr) {
+        if (!info->is_vlstr || !is_vlstr)
+            HGOTO_ERROR(H5E_MAP, H5E_BADTYPE, FAIL,
+                        "memory and map datatypes must both be variable-length strings")
+
+        /* The characters of strings are copied as-is */
+        conv->mem_elmt_size = 1;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    else if (info->is_vl || H5T_VLEN == H5T_get_class(mem_type, FALSE)) {
+        if (!info->is_vl || H5T_VLEN != H5T_get_class(mem_type, FALSE))
+            HGOTO_ERROR(H5E_MAP, H5E_BADTYPE, FAIL,
+                        "memory and map datatypes must both be variable-length sequences")
+        if (NULL == (conv->mem_base = H5T_get_super(mem_type)))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get base type of variable-length sequence")
+        mem_elmt_type  = conv->mem_base;
+        file_elmt_type = info->base;
+    } /* end else-if */
+    else {
+        mem_elmt_type  = mem_type;
+        file_elmt_type = info->type;
+    } /* end else */
+    if (0 == (conv->mem_elmt_size = H5T_get_size(mem_elmt_type)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get datatype size")
+
+    /* Set up the conversion path */
+    if (NULL == (conv->tpath = to_file ? H5T_path_find(mem_elmt_type, file_elmt_type)
+                                       : H5T_path_find(file_elmt_type, mem_elmt_type)))
+        HGOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dst datatypes")
+    if (H5T_path_noop(conv->tpath))
+        conv->tpath = NULL;
+    else {
+        const H5T_t *src_type = to_file ? mem_elmt_type : file_elmt_type; /* Source of conversion */
+        const H5T_t *dst_type = to_file ? file_elmt_type : mem_elmt_type; /* Destination of conversion */
+
+        if ((conv->src_id = H5I_register(H5I_DATATYPE, H5T_copy(src_type, H5T_COPY_ALL), FALSE)) < 0 ||
+            (conv->dst_id = H5I_register(H5I_DATATYPE, H5T_copy(dst_type, H5T_COPY_ALL), FALSE)) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTREGISTER, FAIL, "unable to register types for conversion")
+    } /* end else */
+
+done:
+    if (ret_value < 0)
+        if (H5M__conv_reset(conv) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__conv_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__conv_reset
+ *
+ * Purpose:     Releases the resources held by a datatype conversion set
+ *              up with H5M__conv_init().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__conv_reset(H5M_conv_t *conv)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(conv);
+
+    if (conv->src_id >= 0 && H5I_dec_ref(conv->src_id) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "unable to close temporary object")
+    if (conv->dst_id >= 0 && H5I_dec_ref(conv->dst_id) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "unable to close temporary object")
+    if (conv->mem_base && H5T_close_real(conv->mem_base) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "unable to close base type")
+    conv->src_id   = H5I_INVALID_HID;
+    conv->dst_id   = H5I_INVALID_HID;
+    conv->mem_base = NULL;
+    conv->tpath    = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__conv_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__conv_convert
+ *
+ * Purpose:     Converts NELMTS (base type) elements in BUF, which must be
+ *              large enough for the larger of the source and destination
+ *              elements.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__conv_convert(const H5M_conv_t *conv, size_t nelmts, uint8_t *buf)
+{
+    uint8_t *bkg_buf   = NULL;    /* Background buffer */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(conv);
+
+    if (conv->tpath && nelmts > 0) {
+        /* Allocate a background buffer, if the conversion needs one */
+        if (H5T_BKG_NO != H5T_path_bkg(conv->tpath))
+            if (NULL ==
+                (bkg_buf = (uint8_t *)H5MM_calloc(nelmts * MAX(conv->mem_elmt_size, conv->info->size))))
+                HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+        /* Perform datatype conversion */
+        if (H5T_convert(conv->tpath, conv->src_id, conv->dst_id, nelmts, (size_t)0, (size_t)0, buf, bkg_buf) <
+            0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    } /* end if */
+
+done:
+    H5MM_xfree(bkg_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__conv_convert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__encode
+ *
+ * Purpose:     Converts COUNT keys or values in memory to the way they are
+ *              stored, packed in order in ELMTS.  All the (base type)
+ *              elements of the batch are converted at once.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__encode(const H5M_conv_t *conv, size_t count, const void *mem, H5M_elmts_t *elmts)
+{
+    const H5M_type_info_t *info      = conv->info;                                 /* Stored layout */
+    size_t                 elmt_size = MAX(conv->mem_elmt_size, conv->info->size); /* Conversion size */
+    const uint8_t *        p         = (const uint8_t *)mem;                       /* Memory element */
+    uint8_t *              tconv_buf = NULL;                                       /* Conversion buffer */
+    size_t                 u;                                                      /* Local index variable */
+    herr_t                 ret_value = SUCCEED;                                    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(conv);
+    HDassert(mem || count == 0);
+    HDassert(elmts);
+
+    HDmemset(elmts, 0, sizeof(*elmts));
+    elmts->nelmts = count;
+    if (NULL == (elmts->off = (size_t *)H5MM_malloc((count + 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    if (!info->is_vl) {
+        /* Convert the elements in place */
+        if (NULL == (elmts->buf = (uint8_t *)H5MM_malloc(MAX(count * elmt_size, 1))))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        H5MM_memcpy(elmts->buf, mem, count * conv->mem_size);
+        if (H5M__conv_convert(conv, count, elmts->buf) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert elements")
+        for (u = 0; u <= count; u++)
+            elmts->off[u] = u * info->size;
+    } /* end if */
+    else {
+        const uint8_t *src;       /* Base type elements in memory */
+        uint8_t *      q;         /* Position in buffers */
+        size_t         nbase = 0; /* Number of base type elements */
+
+        /* Get the length of each element, temporarily in the offsets */
+        for (u = 0; u < count; u++, p += conv->mem_size) {
+            size_t len; /* Number of base type elements */
+
+            if (info->is_vlstr) {
+                const char *s; /* String */
+
+                H5MM_memcpy(&s, p, sizeof(char *));
+                len = s ? HDstrlen(s) : 0;
+            } /* end if */
+            else {
+                hvl_t vl; /* Sequence */
+
+                H5MM_memcpy(&vl, p, sizeof(hvl_t));
+                if (vl.len > 0 && NULL == vl.p)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "variable-length sequence has no data")
+                len = vl.len;
+            } /* end else */
+            if (len > (size_t)UINT32_MAX)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "variable-length element is too long")
+            elmts->off[u] = len;
+            nbase += len;
+        } /* end for */
+
+        /* Gather the base type elements and convert them all at once */
+        if (NULL == (tconv_buf = (uint8_t *)H5MM_malloc(MAX(nbase * elmt_size, 1))))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        for (u = 0, p = (const uint8_t *)mem, q = tconv_buf; u < count; u++, p += conv->mem_size) {
+            const void *data; /* Element data */
+
+            if (info->is_vlstr)
+                H5MM_memcpy(&data, p, sizeof(char *));
+            else
+                H5MM_memcpy(&data, p + HOFFSET(hvl_t, p), sizeof(void *));
+            if (elmts->off[u] > 0) {
+                H5MM_memcpy(q, data, elmts->off[u] * conv->mem_elmt_size);
+                q += elmts->off[u] * conv->mem_elmt_size;
+            } /* end if */
+        }     /* end for */
+        if (H5M__conv_convert(conv, nbase, tconv_buf) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert elements")
+
+        /* Lay out each element as its length, then its base type elements */
+        if (NULL ==
+            (elmts->buf = (uint8_t *)H5MM_malloc(MAX(count * H5M_VL_LEN_SIZE + nbase * info->size, 1))))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        for (u = 0, src = tconv_buf, q = elmts->buf; u < count; u++) {
+            size_t len = elmts->off[u]; /* Number of base type elements */
+
+            elmts->off[u] = (size_t)(q - elmts->buf);
+            UINT32ENCODE(q, len);
+            H5MM_memcpy(q, src, len * info->size);
+            q += len * info->size;
+            src += len * info->size;
+        } /* end for */
+        elmts->off[count] = (size_t)(q - elmts->buf);
+    } /* end else */
+
+done:
+    H5MM_xfree(tconv_buf);
+    if (ret_value < 0)
+        H5M__elmts_reset(elmts);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__decode
+ *
+ * Purpose:     Converts NELMTS stored keys or values, at offsets OFF in
+ *              BUF, to memory.
+ *              Memory for variable-length elements is allocated with
+ *              VL_ALLOC_INFO, or with the system allocator if it is NULL
+ *              or has no allocation routine.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__decode(const H5M_conv_t *conv, size_t nelmts, const uint8_t *buf, const size_t *off, void *mem,
+            const H5T_vlen_alloc_info_t *vl_alloc_info)
+{
+    const H5M_type_info_t *info      = conv->info;                                 /* Stored layout */
+    size_t                 elmt_size = MAX(conv->mem_elmt_size, conv->info->size); /* Conversion size */
+    uint8_t *              p         = (uint8_t *)mem;                             /* Memory element */
+    uint8_t *              tconv_buf = NULL;                                       /* Conversion buffer */
+    size_t                 nalloc    = 0;     /* Number of elements with memory allocated */
+    size_t                 u;                 /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(conv);
+    HDassert(buf || nelmts == 0);
+    HDassert(off || nelmts == 0);
+    HDassert(mem || nelmts == 0);
+
+    if (!info->is_vl) {
+        /* Gather the elements and convert them */
+        if (NULL == (tconv_buf = (uint8_t *)H5MM_malloc(MAX(nelmts * elmt_size, 1))))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        for (u = 0; u < nelmts; u++)
+            H5MM_memcpy(tconv_buf + u * info->size, buf + off[u], info->size);
+        if (H5M__conv_convert(conv, nelmts, tconv_buf) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert elements")
+        H5MM_memcpy(mem, tconv_buf, nelmts * conv->mem_size);
+    } /* end if */
+    else {
+        const uint8_t *src;       /* Base type elements converted */
+        uint8_t *      q;         /* Position in buffers */
+        size_t         nbase = 0; /* Number of base type elements */
+        uint32_t       len;       /* Number of base type elements in element */
+
+        /* Count the base type elements */
+        for (u = 0; u < nelmts; u++) {
+            const uint8_t *e = buf + off[u]; /* Stored element */
+
+            UINT32DECODE(e, len);
+            nbase += len;
+        } /* end for */
+
+        /* Gather the base type elements and convert them all at once */
+        if (NULL == (tconv_buf = (uint8_t *)H5MM_malloc(MAX(nbase * elmt_size, 1))))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        for (u = 0, q = tconv_buf; u < nelmts; u++) {
+            const uint8_t *e = buf + off[u]; /* Stored element */
+
+            UINT32DECODE(e, len);
+            H5MM_memcpy(q, e, len * info->size);
+            q += len * info->size;
+        } /* end for */
+        if (H5M__conv_convert(conv, nbase, tconv_buf) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert elements")
+
+        /* Set each memory element to a copy of its converted base type elements */
+        for (u = 0, src = tconv_buf; u < nelmts; u++, p += conv->mem_size) {
+            const uint8_t *e = buf + off[u]; /* Stored element */
+            size_t         size;                          /* Size of memory for element */
+            uint8_t *      data = NULL;                   /* Memory for element */
+
+            UINT32DECODE(e, len);
+            size = info->is_vlstr ? (size_t)len + 1 : (size_t)len * conv->mem_elmt_size;
+            if (size > 0) {
+                if (vl_alloc_info && vl_alloc_info->alloc_func) {
+                    if (NULL ==
+                        (data = (uint8_t *)(vl_alloc_info->alloc_func)(size, vl_alloc_info->alloc_info)))
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL,
+                                    "application memory allocation routine failed for VL data")
+                } /* end if */
+                else if (NULL == (data = (uint8_t *)HDmalloc(size)))
+                    HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed for VL data")
+                H5MM_memcpy(data, src, (size_t)len * conv->mem_elmt_size);
+            } /* end if */
+            src += (size_t)len * conv->mem_elmt_size;
+
+            /* Set the pointers in the user's buffer with memcpy, to avoid alignment issues */
+            if (info->is_vlstr) {
+                data[len] = '\0';
+                H5MM_memcpy(p, &data, sizeof(char *));
+            } /* end if */
+            else {
+                hvl_t vl; /* Sequence */
+
+                vl.len = len;
+                vl.p   = data;
+                H5MM_memcpy(p, &vl, sizeof(hvl_t));
+            } /* end else */
+            nalloc++;
+        } /* end for */
+    }     /* end else */
+
+done:
+    H5MM_xfree(tconv_buf);
+    if (ret_value < 0 && nalloc > 0)
+        H5M__free_vl(conv, nalloc, mem, vl_alloc_info);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__free_vl
+ *
+ * Purpose:     Frees the memory of COUNT variable-length keys or values
+ *              set by H5M__decode().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5M__free_vl(const H5M_conv_t *conv, size_t count, void *mem, const H5T_vlen_alloc_info_t *vl_alloc_info)
+{
+    const uint8_t *p = (const uint8_t *)mem; /* Memory element */
+    size_t         u;                        /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (conv->info->is_vl)
+        for (u = 0; u < count; u++, p += conv->mem_size) {
+            void *data; /* Memory for element */
+
+            if (conv->info->is_vlstr)
+                H5MM_memcpy(&data, p, sizeof(char *));
+            else
+                H5MM_memcpy(&data, p + HOFFSET(hvl_t, p), sizeof(void *));
+            if (data) {
+                if (vl_alloc_info && vl_alloc_info->free_func)
+                    (vl_alloc_info->free_func)(data, vl_alloc_info->free_info);
+                else
+                    HDfree(data);
+            } /* end if */
+        }     /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5M__free_vl() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__elmts_reset
+ *
+ * Purpose:     Frees the buffers of a batch of stored keys or values.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5M__elmts_reset(H5M_elmts_t *elmts)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    elmts->buf    = (uint8_t *)H5MM_xfree(elmts->buf);
+    elmts->off    = (size_t *)H5MM_xfree(elmts->off);
+    elmts->nelmts = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5M__elmts_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__key_order_cmp
+ *
+ * Purpose:     Compares the positions of two keys in a batch, by hash
+ *              and then by index, for qsort.
+ *
+ * Return:      <0, 0 or >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5M__key_order_cmp(const void *_order1, const void *_order2)
+{
+    const H5M_key_order_t *order1    = (const H5M_key_order_t *)_order1;
+    const H5M_key_order_t *order2    = (const H5M_key_order_t *)_order2;
+    int                    ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (order1->hash != order2->hash)
+        ret_value = order1->hash < order2->hash ? -1 : 1;
+    else if (order1->idx != order2->idx)
+        ret_value = order1->idx < order2->idx ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__key_order_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__key_order
+ *
+ * Purpose:     Hashes a batch of stored keys, and sorts them by hash, so
+ *              a batch operation walks the map's index in order.  Keys
+ *              with the same hash stay in batch order, so the last of
+ *              several puts of the same key wins.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__key_order(const H5M_elmts_t *keys, H5M_key_order_t **order)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(keys);
+    HDassert(order);
+
+    if (NULL == (*order = (H5M_key_order_t *)H5MM_malloc(MAX(keys->nelmts, 1) * sizeof(H5M_key_order_t))))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    for (u = 0; u < keys->nelmts; u++) {
+        (*order)[u].hash = H5M__hash(keys->buf + keys->off[u], keys->off[u + 1] - keys->off[u]);
+        (*order)[u].idx  = u;
+    } /* end for */
+    if (keys->nelmts > 1)
+        HDqsort(*order, keys->nelmts, sizeof(H5M_key_order_t), H5M__key_order_cmp);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__key_order() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__put
+ *
+ * Purpose:     Sets the values of COUNT keys in a map, adding the keys
+ *              that aren't there yet.  The keys and values are converted
+ *              as one batch each, and the map's heap and index are opened
+ *              once for the batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__put(H5M_t *map, size_t count, hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+         const void *values)
+{
+    H5M_conv_t       key_conv;                  /* Conversion of keys */
+    H5M_conv_t       val_conv;                  /* Conversion of values */
+    H5M_elmts_t      key_elmts;                 /* Keys as stored */
+    H5M_elmts_t      val_elmts;                 /* Values as stored */
+    H5M_key_order_t *order = NULL;              /* Order to visit keys in */
+    H5M_storage_t    storage;                   /* Open storage of map */
+    hbool_t          key_conv_init = FALSE;     /* Whether key_conv is set up */
+    hbool_t          val_conv_init = FALSE;     /* Whether val_conv is set up */
+    hbool_t          storage_open  = FALSE;     /* Whether the storage is open */
+    size_t           u;                         /* Local index variable */
+    herr_t           ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(map->oloc.addr)
+
+    /* Check args */
+    HDassert(keys || count == 0);
+    HDassert(values || count == 0);
+
+    HDmemset(&key_elmts, 0, sizeof(key_elmts));
+    HDmemset(&val_elmts, 0, sizeof(val_elmts));
+
+    /* Check for write access */
+    if (0 == (H5F_INTENT(map->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Convert the keys & values to the way they are stored */
+    if (H5M__conv_init(&key_conv, &map->shared->key, key_mem_type_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert keys")
+    key_conv_init = TRUE;
+    if (H5M__conv_init(&val_conv, &map->shared->val, val_mem_type_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert values")
+    val_conv_init = TRUE;
+    if (H5M__encode(&key_conv, count, keys, &key_elmts) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert keys")
+    if (H5M__encode(&val_conv, count, values, &val_elmts) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert values")
+
+    /* Store the key-value pairs, in hash order */
+    if (H5M__key_order(&key_elmts, &order) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSORT, FAIL, "can't sort keys")
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    storage_open = TRUE;
+    for (u = 0; u < count; u++) {
+        size_t i = order[u].idx; /* Index of key-value pair in batch */
+
+        if (H5M__storage_put(&storage, key_elmts.buf + key_elmts.off[i],
+                             key_elmts.off[i + 1] - key_elmts.off[i], order[u].hash,
+                             val_elmts.buf + val_elmts.off[i], val_elmts.off[i + 1] - val_elmts.off[i]) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, FAIL, "can't store key-value pair")
+    } /* end for */
+
+done:
+    if (storage_open && H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    if (key_conv_init && H5M__conv_reset(&key_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    if (val_conv_init && H5M__conv_reset(&val_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    H5M__elmts_reset(&key_elmts);
+    H5M__elmts_reset(&val_elmts);
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5M__put() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get_val_cb
+ *
+ * Purpose:     Copies the stored value found for a key out of the heap.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__get_val_cb(const uint8_t *val, size_t val_len, void *_udata)
+{
+    H5M_get_ud_t *udata     = (H5M_get_ud_t *)_udata;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (udata->len + val_len > udata->buf_size) {
+        size_t   new_size = MAX(udata->len + val_len, 2 * udata->buf_size);
+        uint8_t *new_buf;
+
+        if (NULL == (new_buf = (uint8_t *)H5MM_realloc(udata->buf, new_size)))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "unable to grow value buffer")
+        udata->buf      = new_buf;
+        udata->buf_size = new_size;
+    } /* end if */
+    H5MM_memcpy(udata->buf + udata->len, val, val_len);
+    udata->len += val_len;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__get_val_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__get
+ *
+ * Purpose:     Gets the values of COUNT keys in a map.  It is an error for
+ *              any of the keys not to be in the map.  The keys are looked
+ *              up in hash order, with the map's heap and index opened
+ *              once for the batch, and the values found are converted to
+ *              memory as one batch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__get(H5M_t *map, size_t count, hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+         void *values)
+{
+    H5M_conv_t            key_conv;                  /* Conversion of keys */
+    H5M_conv_t            val_conv;                  /* Conversion of values */
+    H5M_elmts_t           key_elmts;                 /* Keys as stored */
+    H5M_elmts_t           val_elmts;                 /* Values as stored */
+    H5M_get_ud_t          udata;                     /* Values found */
+    H5M_key_order_t *     order = NULL;              /* Order to visit keys in */
+    H5M_storage_t         storage;                   /* Open storage of map */
+    H5T_vlen_alloc_info_t vl_alloc_info;             /* VL memory allocation info */
+    hbool_t               key_conv_init = FALSE;     /* Whether key_conv is set up */
+    hbool_t               val_conv_init = FALSE;     /* Whether val_conv is set up */
+    hbool_t               storage_open  = FALSE;     /* Whether the storage is open */
+    size_t                u;                         /* Local index variable */
+    herr_t                ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(map->oloc.addr)
+
+    /* Check args */
+    HDassert(keys || count == 0);
+    HDassert(values || count == 0);
+
+    HDmemset(&key_elmts, 0, sizeof(key_elmts));
+    HDmemset(&val_elmts, 0, sizeof(val_elmts));
+    HDmemset(&udata, 0, sizeof(udata));
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Convert the keys to the way they are stored */
+    if (H5M__conv_init(&key_conv, &map->shared->key, key_mem_type_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert keys")
+    key_conv_init = TRUE;
+    if (H5M__conv_init(&val_conv, &map->shared->val, val_mem_type_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert values")
+    val_conv_init = TRUE;
+    if (H5M__encode(&key_conv, count, keys, &key_elmts) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert keys")
+
+    /* Look up the keys in hash order, gathering the values found */
+    if (H5M__key_order(&key_elmts, &order) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTSORT, FAIL, "can't sort keys")
+    if (NULL == (val_elmts.off = (size_t *)H5MM_malloc((count + 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    storage_open = TRUE;
+    for (u = 0; u < count; u++) {
+        size_t  i     = order[u].idx; /* Index of key in batch */
+        hbool_t found = FALSE;        /* Whether the key was found */
+
+        val_elmts.off[i] = udata.len;
+        if (H5M__storage_get(&storage, key_elmts.buf + key_elmts.off[i],
+                             key_elmts.off[i + 1] - key_elmts.off[i], order[u].hash, &found, H5M__get_val_cb,
+                             &udata) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't look up key")
+        if (!found)
+            HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, FAIL, "key not found in map")
+    } /* end for */
+    val_elmts.off[count] = udata.len;
+    val_elmts.buf        = udata.buf;
+    val_elmts.nelmts     = count;
+    udata.buf            = NULL;
+
+    /* Convert the values to memory */
+    if (H5CX_get_vlen_alloc_info(&vl_alloc_info) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to retrieve VL allocation info")
+    if (H5M__decode(&val_conv, val_elmts.nelmts, val_elmts.buf, val_elmts.off, values, &vl_alloc_info) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert values")
+
+done:
+    if (storage_open && H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    if (key_conv_init && H5M__conv_reset(&key_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    if (val_conv_init && H5M__conv_reset(&val_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    H5M__elmts_reset(&key_elmts);
+    H5M__elmts_reset(&val_elmts);
+    H5MM_xfree(udata.buf);
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5M__get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__exists
+ *
+ * Purpose:     Checks whether a key is in a map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__exists(H5M_t *map, hid_t key_mem_type_id, const void *key, hbool_t *exists)
+{
+    H5M_conv_t    key_conv;                /* Conversion of key */
+    H5M_elmts_t   key_elmts;               /* Key as stored */
+    H5M_storage_t storage;                 /* Open storage of map */
+    hbool_t       key_conv_init = FALSE;   /* Whether key_conv is set up */
+    hbool_t       storage_open  = FALSE;   /* Whether the storage is open */
+    herr_t        ret_value     = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(map->oloc.addr)
+
+    /* Check args */
+    HDassert(key);
+    HDassert(exists);
+
+    HDmemset(&key_elmts, 0, sizeof(key_elmts));
+
+    /* Convert the key to the way it is stored */
+    if (H5M__conv_init(&key_conv, &map->shared->key, key_mem_type_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key")
+    key_conv_init = TRUE;
+    if (H5M__encode(&key_conv, (size_t)1, key, &key_elmts) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert key")
+
+    /* Look up the key */
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    storage_open = TRUE;
+    if (H5M__storage_get(&storage, key_elmts.buf, key_elmts.off[1],
+                         H5M__hash(key_elmts.buf, key_elmts.off[1]), exists, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't look up key")
+
+done:
+    if (storage_open && H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    if (key_conv_init && H5M__conv_reset(&key_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    H5M__elmts_reset(&key_elmts);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5M__exists() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__delete_key
+ *
+ * Purpose:     Removes a key and its value from a map.  It is an error
+ *              for the key not to be in the map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__delete_key(H5M_t *map, hid_t key_mem_type_id, const void *key)
+{
+    H5M_conv_t    key_conv;                /* Conversion of key */
+    H5M_elmts_t   key_elmts;               /* Key as stored */
+    H5M_storage_t storage;                 /* Open storage of map */
+    hbool_t       key_conv_init = FALSE;   /* Whether key_conv is set up */
+    hbool_t       storage_open  = FALSE;   /* Whether the storage is open */
+    herr_t        ret_value     = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(map->oloc.addr)
+
+    /* Check args */
+    HDassert(key);
+
+    HDmemset(&key_elmts, 0, sizeof(key_elmts));
+
+    /* Check for write access */
+    if (0 == (H5F_INTENT(map->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    /* Convert the key to the way it is stored */
+    if (H5M__conv_init(&key_conv, &map->shared->key, key_mem_type_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key")
+    key_conv_init = TRUE;
+    if (H5M__encode(&key_conv, (size_t)1, key, &key_elmts) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't convert key")
+
+    /* Remove the key */
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    storage_open = TRUE;
+    if (H5M__storage_remove(&storage, key_elmts.buf, key_elmts.off[1],
+                            H5M__hash(key_elmts.buf, key_elmts.off[1])) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "can't remove key")
+
+done:
+    if (storage_open && H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    if (key_conv_init && H5M__conv_reset(&key_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    H5M__elmts_reset(&key_elmts);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5M__delete_key() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__iterate_cb
+ *
+ * Purpose:     Converts a stored key to memory and makes the application
+ *              callback for it.  The key's memory is only valid during
+ *              the callback.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__iterate_cb(const uint8_t *key, size_t key_len, void *_udata)
+{
+    H5M_iter_ud_t *udata = (H5M_iter_ud_t *)_udata; /* User data for callback */
+    size_t         off[2];                          /* Offsets of key */
+    herr_t         ret_value = H5_ITER_CONT;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Convert the key to memory */
+    off[0] = 0;
+    off[1] = key_len;
+    if (H5M__decode(udata->conv, (size_t)1, key, off, udata->key_buf, NULL) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, H5_ITER_ERROR, "can't convert key")
+
+    /* Make the application callback */
+    ret_value = (udata->op)(udata->map_id, udata->key_buf, udata->op_data);
+    (*udata->idx)++;
+
+    /* Release the key's memory */
+    H5M__free_vl(udata->conv, (size_t)1, udata->key_buf, NULL);
+
+    if (ret_value < 0)
+        HERROR(H5E_MAP, H5E_CANTNEXT, "iteration operator failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__iterate_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__iterate
+ *
+ * Purpose:     Calls OP for the keys of the map MAP_NAME at LOC, in hash
+ *              order, starting at the key with index *IDX.  *IDX is set to
+ *              the index of the key after the last one visited.
+ *
+ * Return:      Success:    The last value returned by OP (zero if all
+ *                          keys were visited)
+ *
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__iterate(const H5G_loc_t *loc, const char *map_name, hsize_t *idx, hid_t key_mem_type_id,
+             H5M_iterate_t op, void *op_data)
+{
+    H5M_t *       map    = NULL;            /* Map opened */
+    hid_t         map_id = H5I_INVALID_HID; /* ID of map, for the application callback */
+    H5M_conv_t    key_conv;                 /* Conversion of keys */
+    H5M_iter_ud_t udata;                    /* User data for callback */
+    H5M_storage_t storage;                  /* Open storage of map */
+    hbool_t       key_conv_init = FALSE;    /* Whether key_conv is set up */
+    herr_t        ret_value     = FAIL;     /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(loc);
+    HDassert(map_name && *map_name);
+    HDassert(idx);
+    HDassert(op);
+
+    udata.key_buf = NULL;
+
+    /* Open the map and register an ID for it, for the application callback */
+    if (NULL == (map = H5M__open_name(loc, map_name, H5P_MAP_ACCESS_DEFAULT)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open map")
+    if ((map_id = H5VL_wrap_register(H5I_MAP, map, TRUE)) < 0) {
+        if (H5M_close(map) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "unable to release map")
+        HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to register map")
+    } /* end if */
+
+    /* Set up the conversion of keys to memory */
+    if (H5M__conv_init(&key_conv, &map->shared->key, key_mem_type_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert keys")
+    key_conv_init = TRUE;
+    if (NULL == (udata.key_buf = H5MM_malloc(key_conv.mem_size)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Iterate over the keys */
+    udata.map_id  = map_id;
+    udata.conv    = &key_conv;
+    udata.idx     = idx;
+    udata.op      = op;
+    udata.op_data = op_data;
+    H5_BEGIN_TAG(map->oloc.addr)
+    if (H5M__storage_open(map->oloc.file, map->shared, &storage) < 0)
+        HGOTO_ERROR_TAG(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map storage")
+    if ((ret_value = H5M__storage_iterate(&storage, *idx, H5M__iterate_cb, &udata)) < 0)
+        HERROR(H5E_MAP, H5E_BADITER, "map iteration failed");
+    if (H5M__storage_close(&storage) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    H5_END_TAG
+
+done:
+    if (key_conv_init && H5M__conv_reset(&key_conv) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype conversion")
+    H5MM_xfree(udata.key_buf);
+    if (map_id >= 0 && H5I_dec_app_ref(map_id) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "unable to close map")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__iterate() */
@@ -30,9 +30,12 @@
  * \defgroup H5M H5M
  * \brief Map Interface
  *
- * \details \Bold{The interface can only be used with the HDF5 VOL connectors that
- *          implement map objects.} The native HDF5 library does not support this
- *          feature.
+ * \details \Bold{The interface is only built when the library is configured
+ *          with the map API enabled.} The native HDF5 library stores a map's
+ *          key-value pairs in a fractal heap, indexed by the hash of each key
+ *          in a version 2 B-tree. Keys and values may have any fixed-size
+ *          datatype, or be variable-length strings or sequences of a
+ *          fixed-size datatype.
  *
  *          While the HDF5 data model is a flexible way to store data, some
  *          applications require a more general way to index information. HDF5
@@ -44,6 +47,7 @@
  *          be added, and from which values can be retrieved by key.
  *
  *          HDF5 VOL connectors with support for map objects:
+ *          - Native
  *          - DAOS
  *
  * \par Example:
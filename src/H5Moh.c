@@ -0,0 +1,252 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Mmodule.h" /* This source code file is part of the H5M module */
+#define H5O_FRIEND     /*suppress error about including H5Opkg	  */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5Mpkg.h"      /* Maps				*/
+#include "H5Opkg.h"      /* Object headers			*/
+#include "H5VLprivate.h" /* Virtual Object Layer                     */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static htri_t     H5O__map_isa(const H5O_t *loc);
+static void *     H5O__map_open(const H5G_loc_t *obj_loc, H5I_type_t *opened_type);
+static void *     H5O__map_create(H5F_t *f, void *_crt_info, H5G_loc_t *obj_loc);
+static H5O_loc_t *H5O__map_get_oloc(hid_t obj_id);
+static herr_t     H5O__map_bh_info(const H5O_loc_t *loc, H5O_t *oh, H5_ih_info_t *bh_info);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* This message derives from H5O object class */
+const H5O_obj_class_t H5O_OBJ_MAP[1] = {{
+    H5O_TYPE_MAP,      /* object type			*/
+    "map",             /* object name, for debugging	*/
+    NULL,              /* get 'copy file' user data	*/
+    NULL,              /* free 'copy file' user data	*/
+    H5O__map_isa,      /* "isa" message		*/
+    H5O__map_open,     /* open an object of this class */
+    H5O__map_create,   /* create an object of this class */
+    H5O__map_get_oloc, /* get an object header location for an object */
+    H5O__map_bh_info,  /* get the index & heap info for an object */
+    NULL               /* flush an opened object of this class */
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__map_isa
+ *
+ * Purpose:	Determines if an object has the requisite messages for being
+ *		a map.
+ *
+ * Return:	Success:	TRUE if the required map messages are
+ *				present; FALSE otherwise.
+ *
+ *		Failure:	FAIL if the existence of certain messages
+ *				cannot be determined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5O__map_isa(const H5O_t *oh)
+{
+    htri_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(oh);
+
+    /* Check for the map message */
+    if ((ret_value = H5O_msg_exists_oh(oh, H5O_MAP_ID)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, FAIL, "unable to read object header")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_isa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_open
+ *
+ * Purpose:     Open a map at a particular location
+ *
+ * Return:      Success:    Pointer to map data
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__map_open(const H5G_loc_t *obj_loc, H5I_type_t *opened_type)
+{
+    H5M_t *map       = NULL; /* Map opened */
+    void * ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(obj_loc);
+
+    *opened_type = H5I_MAP;
+
+    /* Open the map */
+    if (NULL == (map = H5M_open(obj_loc)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "unable to open map")
+
+    ret_value = (void *)map;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__map_create
+ *
+ * Purpose:	Create a map in a file
+ *
+ * Return:	Success:	Pointer to the map data structure
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__map_create(H5F_t *f, void *_crt_info, H5G_loc_t *obj_loc)
+{
+    H5M_obj_create_t *crt_info  = (H5M_obj_create_t *)_crt_info; /* Map creation parameters */
+    H5M_t *           map       = NULL;                          /* New map created */
+    void *            ret_value = NULL;                          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(crt_info);
+    HDassert(obj_loc);
+
+    /* Create the the map */
+    if (NULL == (map = H5M__create(f, crt_info)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "unable to create map")
+
+    /* Set up the new map's location */
+    if (NULL == (obj_loc->oloc = H5M_oloc(map)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to get object location of map")
+    if (NULL == (obj_loc->path = H5M_nameof(map)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to get path of map")
+
+    /* Set the return value */
+    ret_value = map;
+
+done:
+    if (ret_value == NULL)
+        if (map && H5M_close(map) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, NULL, "unable to release map")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__map_get_oloc
+ *
+ * Purpose:	Retrieve the object header location for an open object
+ *
+ * Return:	Success:	Pointer to object header location
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5O_loc_t *
+H5O__map_get_oloc(hid_t obj_id)
+{
+    H5M_t *    map;              /* Map opened */
+    H5O_loc_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get the map */
+    if (NULL == (map = (H5M_t *)H5VL_object(obj_id)))
+        HGOTO_ERROR(H5E_OHDR, H5E_BADID, NULL, "couldn't get object from ID")
+
+    /* Get the map's object header location */
+    if (NULL == (ret_value = H5M_oloc(map)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, NULL, "unable to get object location from object")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_get_oloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_bh_info
+ *
+ * Purpose:     Retrieve storage for the v2 B-tree and fractal heap that
+ *              hold a map's key-value pairs
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_bh_info(const H5O_loc_t *loc, H5O_t *oh, H5_ih_info_t *bh_info)
+{
+    H5O_map_t map;                 /* Map message */
+    hbool_t   msg_read  = FALSE;   /* Whether the map message was read */
+    herr_t    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(oh);
+    HDassert(bh_info);
+
+    /* Get the map message */
+    if (NULL == H5O_msg_read_oh(loc->file, oh, H5O_MAP_ID, &map))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't read map message")
+    msg_read = TRUE;
+
+    /* Get the storage sizes */
+    if (H5M__storage_size(loc->file, &map, bh_info) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't retrieve map storage info")
+
+done:
+    if (msg_read && H5O_msg_reset(H5O_MAP_ID, &map) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRESET, FAIL, "can't reset map message")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_bh_info() */
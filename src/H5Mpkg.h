@@ -27,21 +27,166 @@
 #include "H5Mprivate.h"
 
 /* Other private headers needed by this file */
+#include "H5B2private.h" /* v2 B-trees                         */
+#include "H5FLprivate.h" /* Free Lists                          */
+#include "H5HFprivate.h" /* Fractal heaps                       */
+#include "H5Tprivate.h"  /* Datatypes                           */
 
 /**************************/
 /* Package Private Macros */
 /**************************/
 
+/* Size of the fractal heap IDs of a map's key-value pairs */
+#define H5M_FHEAP_ID_LEN 7
+
+/* Size of the element count stored before a variable-length key or value */
+#define H5M_VL_LEN_SIZE 4
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
 
+/*
+ * How the keys or values of a map are stored.  A key or value of a
+ * fixed-size datatype is stored as an element of its datatype in the file.
+ * A key or value of a variable-length sequence or string datatype is stored
+ * as its number of base type elements, followed by those elements in the
+ * file's base type.
+ */
+typedef struct H5M_type_info_t {
+    H5T_t * type;     /* Datatype in the file (owned by the map message) */
+    hbool_t is_vl;    /* Whether the datatype is a variable-length sequence or string */
+    hbool_t is_vlstr; /* Whether the datatype is a variable-length string */
+    H5T_t * base;     /* Base type of a variable-length sequence, or NULL */
+    size_t  size;     /* Size of an element, or of a base type element if variable-length */
+} H5M_type_info_t;
+
+/*
+ * A batch of keys or values, converted to the way they are stored in the
+ * file.  Element 'i' starts at buf + off[i].  Elements converted from
+ * memory are packed in order, so element 'i' is off[i + 1] - off[i] bytes
+ * long.
+ */
+typedef struct H5M_elmts_t {
+    size_t   nelmts; /* Number of elements */
+    uint8_t *buf;    /* Buffer holding the elements */
+    size_t * off;    /* Offsets of the elements in the buffer (nelmts + 1 entries) */
+} H5M_elmts_t;
+
+/* Information shared by all the handles to a map that are open */
+typedef struct H5M_shared_t {
+    int             fo_count; /* Reference count on shared map info */
+    H5O_map_t       mesg;     /* Map message: datatypes and storage addresses */
+    H5M_type_info_t key;      /* How the map's keys are stored */
+    H5M_type_info_t val;      /* How the map's values are stored */
+    hid_t           mcpl_id;  /* Map creation property list */
+} H5M_shared_t;
+
+/* A map handle */
+struct H5M_t {
+    H5O_loc_t     oloc;    /* Object location for map */
+    H5G_name_t    path;    /* Group hierarchy path */
+    H5M_shared_t *shared;  /* Shared map info */
+    hid_t         mapl_id; /* Map access property list */
+};
+
+/* Data passed through the object creation layer to create a map */
+typedef struct H5M_obj_create_t {
+    H5T_t *key_type; /* Datatype of the map's keys */
+    H5T_t *val_type; /* Datatype of the map's values */
+    hid_t  mcpl_id;  /* Map creation property list */
+    hid_t  mapl_id;  /* Map access property list */
+} H5M_obj_create_t;
+
+/* Open fractal heap & v2 B-tree of a map, for a batch of operations */
+typedef struct H5M_storage_t {
+    H5HF_t *               fheap;    /* Fractal heap holding the key-value pairs */
+    H5B2_t *               bt2;      /* v2 B-tree indexing the key-value pairs by key hash */
+    const H5M_type_info_t *key;      /* How the map's keys are stored */
+    const H5M_type_info_t *val;      /* How the map's values are stored */
+    uint8_t *              buf;      /* Buffer for building or copying key-value pairs */
+    size_t                 buf_size; /* Size of buffer */
+} H5M_storage_t;
+
+/* Native record for the v2 B-tree indexing the key-value pairs of a map */
+typedef struct H5M_bt2_rec_t {
+    uint8_t  id[H5M_FHEAP_ID_LEN]; /* Heap ID for key-value pair */
+    uint32_t hash;                 /* Hash of key */
+} H5M_bt2_rec_t;
+
+/* Callback made for the value of a key-value pair found in a map */
+typedef herr_t (*H5M_val_op_t)(const uint8_t *val, size_t val_len, void *op_data);
+
+/* Callback made for each key of a map during iteration */
+typedef herr_t (*H5M_key_op_t)(const uint8_t *key, size_t key_len, void *op_data);
+
+/*
+ * User data for the v2 B-tree indexing the key-value pairs of a map.  It is
+ * passed through the v2 B-tree layer to the record callbacks.
+ */
+typedef struct H5M_bt2_ud_t {
+    /* downward */
+    H5HF_t *               fheap;       /* Fractal heap holding the key-value pairs */
+    const H5M_type_info_t *key_info;    /* How the map's keys are stored */
+    const H5M_type_info_t *val_info;    /* How the map's values are stored */
+    const uint8_t *        key;         /* Key to look for, as stored */
+    size_t                 key_len;     /* Length of key */
+    uint32_t               hash;        /* Hash of key */
+    const uint8_t *        id;          /* Heap ID of key-value pair being inserted */
+    H5M_val_op_t           val_op;      /* Callback when the key is found */
+    void *                 val_op_data; /* Callback data when the key is found */
+} H5M_bt2_ud_t;
+
 /*****************************/
 /* Package Private Variables */
 /*****************************/
 
+/* v2 B-tree class for indexing the key-value pairs of maps */
+H5_DLLVAR const H5B2_class_t H5M_BT2[1];
+
+/* The cache of free list blocks for H5M_t and H5M_shared_t structs */
+H5FL_EXTERN(H5M_t);
+H5FL_EXTERN(H5M_shared_t);
+
 /******************************/
 /* Package Private Prototypes */
 /******************************/
 
-#endif /*H5Dpkg_H*/
+/* Map object routines */
+H5_DLL H5M_t *H5M__create(H5F_t *file, H5M_obj_create_t *mcrt_info);
+H5_DLL H5M_t *H5M__create_named(const H5G_loc_t *loc, const char *name, hid_t lcpl_id,
+                                H5M_obj_create_t *mcrt_info);
+H5_DLL H5M_t *H5M__open_name(const H5G_loc_t *loc, const char *name, hid_t mapl_id);
+H5_DLL hid_t  H5M__get_type(const H5M_t *map, hbool_t key);
+H5_DLL hid_t  H5M__get_create_plist(const H5M_t *map);
+H5_DLL hid_t  H5M__get_access_plist(const H5M_t *map);
+H5_DLL herr_t H5M__get_count(const H5M_t *map, hsize_t *count);
+H5_DLL herr_t H5M__put(H5M_t *map, size_t count, hid_t key_mem_type_id, const void *keys,
+                       hid_t val_mem_type_id, const void *values);
+H5_DLL herr_t H5M__get(H5M_t *map, size_t count, hid_t key_mem_type_id, const void *keys,
+                       hid_t val_mem_type_id, void *values);
+H5_DLL herr_t H5M__exists(H5M_t *map, hid_t key_mem_type_id, const void *key, hbool_t *exists);
+H5_DLL herr_t H5M__delete_key(H5M_t *map, hid_t key_mem_type_id, const void *key);
+H5_DLL herr_t H5M__iterate(const H5G_loc_t *loc, const char *map_name, hsize_t *idx, hid_t key_mem_type_id,
+                           H5M_iterate_t op, void *op_data);
+
+/* Key & value storage routines */
+H5_DLL herr_t H5M__storage_create(H5F_t *f, H5O_map_t *mesg);
+H5_DLL herr_t H5M__storage_delete(H5F_t *f, const H5O_map_t *mesg);
+H5_DLL herr_t H5M__storage_copy(H5F_t *f_src, const H5O_map_t *mesg_src, H5F_t *f_dst, H5O_map_t *mesg_dst);
+H5_DLL herr_t H5M__storage_size(H5F_t *f, const H5O_map_t *mesg, H5_ih_info_t *bh_info);
+H5_DLL herr_t H5M__storage_open(H5F_t *f, const H5M_shared_t *shared, H5M_storage_t *storage);
+H5_DLL herr_t H5M__storage_close(H5M_storage_t *storage);
+H5_DLL herr_t H5M__storage_put(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash,
+                               const uint8_t *val, size_t val_len);
+H5_DLL herr_t H5M__storage_get(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash,
+                               hbool_t *found, H5M_val_op_t op, void *op_data);
+H5_DLL herr_t H5M__storage_remove(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash);
+H5_DLL herr_t H5M__storage_iterate(H5M_storage_t *storage, hsize_t skip, H5M_key_op_t op, void *op_data);
+H5_DLL herr_t H5M__storage_count(H5M_storage_t *storage, hsize_t *count);
+H5_DLL herr_t H5M__type_info_init(H5T_t *type, H5M_type_info_t *info);
+H5_DLL herr_t H5M__type_info_reset(H5M_type_info_t *info);
+H5_DLL herr_t H5M__elmt_len(const H5M_type_info_t *info, const uint8_t *p, size_t avail, size_t *len);
+H5_DLL uint32_t H5M__hash(const uint8_t *key, size_t key_len);
+
+#endif /*H5Mpkg_H*/
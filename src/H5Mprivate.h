@@ -21,6 +21,7 @@
 #include "H5Mpublic.h"
 
 /* Private headers needed by this file */
+#include "H5Gprivate.h" /* Groups                      */
 #include "H5Oprivate.h" /* Object headers              */
 #include "H5Sprivate.h" /* Dataspaces                  */
 #include "H5Zprivate.h" /* Data filters                */
@@ -64,7 +65,9 @@
 /****************************/
 /* Library Private Typedefs */
 /****************************/
-H5_DLL herr_t H5M_init(void);
+
+/* Forward references of package typedefs */
+typedef struct H5M_t H5M_t;
 
 /*****************************/
 /* Library Private Variables */
@@ -73,5 +76,10 @@ H5_DLL herr_t H5M_init(void);
 /******************************/
 /* Library Private Prototypes */
 /******************************/
+H5_DLL herr_t      H5M_init(void);
+H5_DLL H5M_t *     H5M_open(const H5G_loc_t *loc);
+H5_DLL herr_t      H5M_close(H5M_t *map);
+H5_DLL H5O_loc_t * H5M_oloc(H5M_t *map);
+H5_DLL H5G_name_t *H5M_nameof(H5M_t *map);
 
 #endif /* H5Mprivate_H */
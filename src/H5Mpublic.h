@@ -33,15 +33,17 @@
 
 /* Macros defining operation IDs for map VOL callbacks (implemented using the
  * "optional" VOL callback) */
-#define H5VL_MAP_CREATE   1
-#define H5VL_MAP_OPEN     2
-#define H5VL_MAP_GET_VAL  3
-#define H5VL_MAP_EXISTS   4
-#define H5VL_MAP_PUT      5
-#define H5VL_MAP_GET      6
-#define H5VL_MAP_SPECIFIC 7
-#define H5VL_MAP_OPTIONAL 8
-#define H5VL_MAP_CLOSE    9
+#define H5VL_MAP_CREATE    1
+#define H5VL_MAP_OPEN      2
+#define H5VL_MAP_GET_VAL   3
+#define H5VL_MAP_EXISTS    4
+#define H5VL_MAP_PUT       5
+#define H5VL_MAP_GET       6
+#define H5VL_MAP_SPECIFIC  7
+#define H5VL_MAP_OPTIONAL  8
+#define H5VL_MAP_CLOSE     9
+#define H5VL_MAP_PUT_MULTI 10
+#define H5VL_MAP_GET_MULTI 11
 
 /*******************/
 /* Public Typedefs */
@@ -174,6 +176,24 @@ typedef union H5VL_map_args_t {
     /* H5VL_MAP_OPTIONAL */
     /* Unused */
 
+    /* H5VL_MAP_PUT_MULTI */
+    struct {
+        size_t      count;             /* Number of key-value pairs */
+        hid_t       key_mem_type_id;   /* Memory datatype for keys */
+        const void *keys;              /* Array of keys */
+        hid_t       value_mem_type_id; /* Memory datatype for values */
+        const void *values;            /* Array of values */
+    } put_multi;
+
+    /* H5VL_MAP_GET_MULTI */
+    struct {
+        size_t      count;             /* Number of keys */
+        hid_t       key_mem_type_id;   /* Memory datatype for keys */
+        const void *keys;              /* Array of keys */
+        hid_t       value_mem_type_id; /* Memory datatype for values */
+        void *      values;            /* Buffer for values (OUT) */
+    } get_multi;
+
     /* H5VL_MAP_CLOSE */
     /* No args */
 } H5VL_map_args_t;
@@ -189,10 +209,7 @@ typedef union H5VL_map_args_t {
 extern "C" {
 #endif
 
-/* The map API is only built when requested since there's no support in
- * the native file format at this time. It's only supported in a few VOL
- * connectors.
- */
+/* The map API is only built when requested */
 #ifdef H5_HAVE_MAP_API
 
 /**
@@ -459,6 +476,64 @@ H5_DLL herr_t H5Mget_async(const char *app_file, const char *app_func, unsigned
                            hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id, void *value,
                            hid_t dxpl_id, hid_t es_id);
 
+/**
+ * \ingroup H5M
+ *
+ * \brief Adds several key-value pairs to a map object
+ *
+ * \map_id
+ * \param[in] count Number of key-value pairs
+ * \type_id{key_mem_type_id}
+ * \param[in] keys Array of \p count keys
+ * \type_id{val_mem_type_id}
+ * \param[in] values Array of \p count values
+ * \dxpl_id
+ * \returns \herr_t
+ *
+ * \details H5Mput_multi() adds each of the \p count key-value pairs in \p
+ *          keys and \p values to a map object specified by \p map_id, as
+ *          H5Mput() does for one pair. If a key appears more than once in
+ *          \p keys, the last of its values is kept.
+ *
+ *          For maps in the native file format, the keys are visited in the
+ *          order of the map's index, and the map's storage is opened only
+ *          once for the whole batch.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Mput_multi(hid_t map_id, size_t count, hid_t key_mem_type_id, const void *keys,
+                           hid_t val_mem_type_id, const void *values, hid_t dxpl_id);
+
+/**
+ * \ingroup H5M
+ *
+ * \brief Retrieves the values of several keys from a map object
+ *
+ * \map_id
+ * \param[in] count Number of keys
+ * \type_id{key_mem_type_id}
+ * \param[in] keys Array of \p count keys
+ * \type_id{val_mem_type_id}
+ * \param[out] values Buffer for \p count values
+ * \dxpl_id
+ * \returns \herr_t
+ *
+ * \details H5Mget_multi() retrieves from a map object specified by \p
+ *          map_id the value of each of the \p count keys in \p keys, as
+ *          H5Mget() does for one key. It fails if any of the keys isn't
+ *          in the map.
+ *
+ *          For maps in the native file format, the keys are looked up in
+ *          the order of the map's index, and the map's storage is opened
+ *          only once for the whole batch.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Mget_multi(hid_t map_id, size_t count, hid_t key_mem_type_id, const void *keys,
+                           hid_t val_mem_type_id, void *values, hid_t dxpl_id);
+
 /**
  * \ingroup H5M
  *
@@ -0,0 +1,1045 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Mstorage.c
+ *
+ * Purpose:     Routines for storing the key-value pairs of maps in the
+ *              file.
+ *
+ *              Each key-value pair is an object in a fractal heap, holding
+ *              the key followed by the value, as they are stored in the
+ *              file (see H5M_type_info_t).  A v2 B-tree indexes the pairs
+ *              by the hash of their keys.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Mmodule.h" /* This source code file is part of the H5M module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Mpkg.h"      /* Maps                                     */
+#include "H5MMprivate.h" /* Memory management                        */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Fractal heap creation parameters for key-value pairs */
+#define H5M_FHEAP_MAN_WIDTH            4
+#define H5M_FHEAP_MAN_START_BLOCK_SIZE 512
+#define H5M_FHEAP_MAN_MAX_DIRECT_SIZE  (64 * 1024)
+#define H5M_FHEAP_MAN_MAX_INDEX        32
+#define H5M_FHEAP_MAN_START_ROOT_ROWS  1
+#define H5M_FHEAP_CHECKSUM_DBLOCKS     TRUE
+#define H5M_FHEAP_MAX_MAN_SIZE         (4 * 1024)
+
+/* v2 B-tree creation parameters for the key hash index */
+#define H5M_BT2_NODE_SIZE  512
+#define H5M_BT2_MERGE_PERC 40
+#define H5M_BT2_SPLIT_PERC 100
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* User data for replacing the heap object of a key-value pair */
+typedef struct H5M_storage_replace_ud_t {
+    H5HF_t *       fheap;   /* Fractal heap holding the key-value pairs */
+    const uint8_t *obj;     /* New key-value pair */
+    size_t         obj_len; /* Length of new key-value pair */
+} H5M_storage_replace_ud_t;
+
+/* User data for iterating over the keys of a map */
+typedef struct H5M_storage_iter_ud_t {
+    H5M_storage_t *storage; /* Open storage of the map */
+    hsize_t        skip;    /* Number of keys left to skip */
+    H5M_key_op_t   op;      /* Callback for each key */
+    void *         op_data; /* Callback data */
+    size_t         key_len; /* Length of key copied to the storage buffer */
+} H5M_storage_iter_ud_t;
+
+/* User data for copying the key-value pairs of a map to another file */
+typedef struct H5M_storage_copy_ud_t {
+    H5HF_t *       fheap_src; /* Fractal heap of the source map */
+    H5M_storage_t *dst;       /* Open storage of the destination map */
+    size_t         obj_len;   /* Length of key-value pair copied to the buffer */
+} H5M_storage_copy_ud_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5M__storage_reserve(H5M_storage_t *storage, size_t size);
+static herr_t H5M__storage_found_cb(const void *_record, void *_op_data);
+static herr_t H5M__storage_replace_cb(void *_record, void *_op_data, hbool_t *changed);
+static herr_t H5M__storage_remove_cb(const void *_record, void *_op_data);
+static herr_t H5M__storage_copy_key_cb(const void *obj, size_t obj_len, void *_udata);
+static int    H5M__storage_iterate_cb(const void *_record, void *_udata);
+static herr_t H5M__storage_copy_obj_cb(const void *obj, size_t obj_len, void *_udata);
+static int    H5M__storage_copy_cb(const void *_record, void *_udata);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__type_info_init
+ *
+ * Purpose:     Sets up how the keys or values of a map with datatype TYPE
+ *              are stored.  Fixed-size datatypes and top-level
+ *              variable-length sequences and strings are supported, but
+ *              not datatypes with nested variable-length or reference
+ *              datatypes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__type_info_init(H5T_t *type, H5M_type_info_t *info)
+{
+    htri_t is_vlstr;            /* Whether the datatype is a variable-length string */
+    htri_t has_class;           /* Whether a datatype contains a class */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(type);
+    HDassert(info);
+
+    HDmemset(info, 0, sizeof(*info));
+    info->type = type;
+
+    if ((is_vlstr = H5T_is_variable_str(type)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable-length string")
+    if (is_vlstr) {
+        /* Strings are stored as their characters, without a terminator */
+        info->is_vl    = TRUE;
+        info->is_vlstr = TRUE;
+        info->size     = 1;
+    } /* end if */
+    else if (H5T_VLEN == H5T_get_class(type, FALSE)) {
+        info->is_vl = TRUE;
+        if (NULL == (info->base = H5T_get_super(type)))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get base type of variable-length sequence")
+        if (0 == (info->size = H5T_get_size(info->base)))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get size of base type")
+    } /* end else-if */
+    else if (0 == (info->size = H5T_get_size(type)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get datatype size")
+
+    /* The stored elements must not refer to other data in the file */
+    if ((has_class = H5T_detect_class(info->base ? info->base : type, H5T_VLEN, FALSE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable-length datatype")
+    if (has_class && !is_vlstr)
+        HGOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL,
+                    "nested variable-length datatypes are not supported for map keys or values")
+    if ((has_class = H5T_detect_class(info->base ? info->base : type, H5T_REFERENCE, FALSE)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for reference datatype")
+    if (has_class)
+        HGOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL,
+                    "reference datatypes are not supported for map keys or values")
+
+done:
+    if (ret_value < 0)
+        if (H5M__type_info_reset(info) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__type_info_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__type_info_reset
+ *
+ * Purpose:     Releases the resources held by INFO.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__type_info_reset(H5M_type_info_t *info)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(info);
+
+    if (info->base && H5T_close_real(info->base) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't close base type")
+    HDmemset(info, 0, sizeof(*info));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__type_info_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__elmt_len
+ *
+ * Purpose:     Gets the length of the stored key or value at P, which
+ *              has AVAIL bytes after it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__elmt_len(const H5M_type_info_t *info, const uint8_t *p, size_t avail, size_t *len)
+{
+    uint32_t nelmts;              /* Number of base type elements */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(info);
+    HDassert(p);
+    HDassert(len);
+
+    if (info->is_vl) {
+        if (avail < H5M_VL_LEN_SIZE)
+            HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "variable-length element is truncated")
+        UINT32DECODE(p, nelmts)
+        if ((avail - H5M_VL_LEN_SIZE) / info->size < nelmts)
+            HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "variable-length element is truncated")
+        *len = H5M_VL_LEN_SIZE + nelmts * info->size;
+    } /* end if */
+    else {
+        if (avail < info->size)
+            HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "element is truncated")
+        *len = info->size;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__elmt_len() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__hash
+ *
+ * Purpose:     Computes the hash of a stored key, which orders the
+ *              key-value pairs of a map in its index.
+ *
+ * Return:      The hash of the key (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5M__hash(const uint8_t *key, size_t key_len)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(H5_checksum_lookup3(key, key_len, 0))
+} /* end H5M__hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_create
+ *
+ * Purpose:     Creates the fractal heap and v2 B-tree that store the
+ *              key-value pairs of a map, and sets their addresses in
+ *              MESG.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_create(H5F_t *f, H5O_map_t *mesg)
+{
+    H5HF_create_t fheap_cparam;        /* Fractal heap creation parameters */
+    H5B2_create_t bt2_cparam;          /* v2 B-tree creation parameters */
+    H5HF_t *      fheap = NULL;        /* Fractal heap handle */
+    H5B2_t *      bt2   = NULL;        /* v2 B-tree handle */
+    size_t        fheap_id_len;        /* Fractal heap ID length */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(mesg);
+
+    /* Set fractal heap creation parameters */
+    HDmemset(&fheap_cparam, 0, sizeof(fheap_cparam));
+    fheap_cparam.managed.width            = H5M_FHEAP_MAN_WIDTH;
+    fheap_cparam.managed.start_block_size = H5M_FHEAP_MAN_START_BLOCK_SIZE;
+    fheap_cparam.managed.max_direct_size  = H5M_FHEAP_MAN_MAX_DIRECT_SIZE;
+    fheap_cparam.managed.max_index        = H5M_FHEAP_MAN_MAX_INDEX;
+    fheap_cparam.managed.start_root_rows  = H5M_FHEAP_MAN_START_ROOT_ROWS;
+    fheap_cparam.checksum_dblocks         = H5M_FHEAP_CHECKSUM_DBLOCKS;
+    fheap_cparam.max_man_size             = H5M_FHEAP_MAX_MAN_SIZE;
+
+    /* Create fractal heap for storing key-value pairs */
+    if (NULL == (fheap = H5HF_create(f, &fheap_cparam)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to create fractal heap")
+
+    /* Retrieve the heap's address in the file */
+    if (H5HF_get_heap_addr(fheap, &(mesg->fheap_addr)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get fractal heap address")
+
+    /* Retrieve the heap's ID length in the file */
+    if (H5HF_get_id_len(fheap, &fheap_id_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGETSIZE, FAIL, "can't get fractal heap ID length")
+    HDassert(fheap_id_len == H5M_FHEAP_ID_LEN);
+
+    /* Create the key hash index v2 B-tree */
+    HDmemset(&bt2_cparam, 0, sizeof(bt2_cparam));
+    bt2_cparam.cls       = H5M_BT2;
+    bt2_cparam.node_size = (size_t)H5M_BT2_NODE_SIZE;
+    H5_CHECK_OVERFLOW(fheap_id_len, /* From: */ hsize_t, /* To: */ uint32_t);
+    bt2_cparam.rrec_size = 4 +                     /* Key's hash value */
+                           (uint32_t)fheap_id_len; /* Fractal heap ID */
+    bt2_cparam.split_percent = H5M_BT2_SPLIT_PERC;
+    bt2_cparam.merge_percent = H5M_BT2_MERGE_PERC;
+    if (NULL == (bt2 = H5B2_create(f, &bt2_cparam, NULL)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to create v2 B-tree for key index")
+
+    /* Retrieve the v2 B-tree's address in the file */
+    if (H5B2_get_addr(bt2, &(mesg->bt2_addr)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get v2 B-tree address for key index")
+
+done:
+    /* Close the open objects */
+    if (fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if (bt2 && H5B2_close(bt2) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for key index")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_delete
+ *
+ * Purpose:     Deletes the fractal heap and v2 B-tree that store the
+ *              key-value pairs of a map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_delete(H5F_t *f, const H5O_map_t *mesg)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(mesg);
+
+    /* Delete the key index v2 B-tree (the pairs go with the heap) */
+    if (H5F_addr_defined(mesg->bt2_addr))
+        if (H5B2_delete(f, mesg->bt2_addr, NULL, NULL, NULL) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTDELETE, FAIL, "unable to delete v2 B-tree for key index")
+
+    /* Delete the fractal heap holding the key-value pairs */
+    if (H5F_addr_defined(mesg->fheap_addr))
+        if (H5HF_delete(f, mesg->fheap_addr) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTDELETE, FAIL, "unable to delete fractal heap")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_size
+ *
+ * Purpose:     Adds the sizes of the fractal heap and v2 B-tree that store
+ *              the key-value pairs of a map to BH_INFO.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_size(H5F_t *f, const H5O_map_t *mesg, H5_ih_info_t *bh_info)
+{
+    H5HF_t *fheap     = NULL;    /* Fractal heap handle */
+    H5B2_t *bt2       = NULL;    /* v2 B-tree handle */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(mesg);
+    HDassert(bh_info);
+
+    /* Get the key index v2 B-tree size */
+    if (NULL == (bt2 = H5B2_open(f, mesg->bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for key index")
+    if (H5B2_size(bt2, &bh_info->index_size) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't retrieve B-tree storage info for key index")
+
+    /* Get the fractal heap size */
+    if (NULL == (fheap = H5HF_open(f, mesg->fheap_addr)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+    if (H5HF_size(fheap, &bh_info->heap_size) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't retrieve fractal heap storage info")
+
+done:
+    if (fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if (bt2 && H5B2_close(bt2) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for key index")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_open
+ *
+ * Purpose:     Opens the fractal heap and v2 B-tree that store the
+ *              key-value pairs of a map, so a batch of operations can use
+ *              them.  They should be closed with H5M__storage_close().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_open(H5F_t *f, const H5M_shared_t *shared, H5M_storage_t *storage)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(shared);
+    HDassert(storage);
+
+    HDmemset(storage, 0, sizeof(*storage));
+    storage->key = &shared->key;
+    storage->val = &shared->val;
+
+    /* Open the fractal heap */
+    if (NULL == (storage->fheap = H5HF_open(f, shared->mesg.fheap_addr)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+
+    /* Open the key index v2 B-tree */
+    if (NULL == (storage->bt2 = H5B2_open(f, shared->mesg.bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for key index")
+
+done:
+    if (ret_value < 0)
+        if (H5M__storage_close(storage) < 0)
+            HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_close
+ *
+ * Purpose:     Closes the fractal heap and v2 B-tree of a map opened with
+ *              H5M__storage_open().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_close(H5M_storage_t *storage)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+
+    if (storage->fheap && H5HF_close(storage->fheap) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    storage->fheap = NULL;
+    if (storage->bt2 && H5B2_close(storage->bt2) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for key index")
+    storage->bt2      = NULL;
+    storage->buf      = (uint8_t *)H5MM_xfree(storage->buf);
+    storage->buf_size = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_reserve
+ *
+ * Purpose:     Makes the buffer of STORAGE at least SIZE bytes long.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_reserve(H5M_storage_t *storage, size_t size)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (size > storage->buf_size) {
+        size_t   new_size = MAX(size, 2 * storage->buf_size);
+        uint8_t *new_buf;
+
+        if (NULL == (new_buf = (uint8_t *)H5MM_realloc(storage->buf, new_size)))
+            HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "unable to grow key-value pair buffer")
+        storage->buf      = new_buf;
+        storage->buf_size = new_size;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_reserve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_found_cb
+ *
+ * Purpose:     Copies the heap ID of a key-value pair found in the index.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_found_cb(const void *_record, void *_op_data)
+{
+    const H5M_bt2_rec_t *record = (const H5M_bt2_rec_t *)_record;
+    uint8_t *            id     = (uint8_t *)_op_data;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5MM_memcpy(id, record->id, (size_t)H5M_FHEAP_ID_LEN);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5M__storage_found_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_replace_cb
+ *
+ * Purpose:     Replaces the heap object of a key-value pair with one of a
+ *              different size, updating the heap ID in its index record.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_replace_cb(void *_record, void *_op_data, hbool_t *changed)
+{
+    H5M_bt2_rec_t *           record    = (H5M_bt2_rec_t *)_record;
+    H5M_storage_replace_ud_t *udata     = (H5M_storage_replace_ud_t *)_op_data;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5HF_remove(udata->fheap, record->id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "unable to remove key-value pair from heap")
+    if (H5HF_insert(udata->fheap, udata->obj_len, udata->obj, record->id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, FAIL, "unable to insert key-value pair into heap")
+    *changed = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_replace_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_put
+ *
+ * Purpose:     Sets the value of a key in a map, adding the key if it
+ *              isn't there yet.  KEY and VAL are as stored in the file,
+ *              and HASH is the hash of the key from H5M__hash().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_put(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash,
+                 const uint8_t *val, size_t val_len)
+{
+    H5M_bt2_ud_t udata;                 /* User data for v2 B-tree operations */
+    uint8_t      id[H5M_FHEAP_ID_LEN];  /* Heap ID of the key-value pair */
+    size_t       obj_len;               /* Length of the key-value pair in the heap */
+    size_t       old_len;               /* Length of the key-value pair being replaced */
+    hbool_t      found     = FALSE;     /* Whether the key is in the map already */
+    herr_t       ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+    HDassert(key);
+    HDassert(val || val_len == 0);
+
+    /* Build the key-value pair.  Pairs small enough to fit in a heap ID
+     * would be stored in the ID, where they can't be overwritten, so they
+     * are padded. */
+    obj_len = MAX(key_len + val_len, (size_t)H5M_FHEAP_ID_LEN);
+    if (H5M__storage_reserve(storage, obj_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "unable to allocate key-value pair")
+    H5MM_memcpy(storage->buf, key, key_len);
+    if (val_len)
+        H5MM_memcpy(storage->buf + key_len, val, val_len);
+    if (obj_len > key_len + val_len)
+        HDmemset(storage->buf + key_len + val_len, 0, obj_len - (key_len + val_len));
+
+    /* Look for the key */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.fheap    = storage->fheap;
+    udata.key_info = storage->key;
+    udata.val_info = storage->val;
+    udata.key      = key;
+    udata.key_len  = key_len;
+    udata.hash     = hash;
+    if (H5B2_find(storage->bt2, &udata, &found, H5M__storage_found_cb, id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, FAIL, "unable to search key index")
+
+    if (found) {
+        /* Overwrite the key-value pair in place, if it's the same size */
+        if (H5HF_get_obj_len(storage->fheap, id, &old_len) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTGETSIZE, FAIL, "can't get length of key-value pair")
+        if (old_len == obj_len) {
+            hbool_t id_changed = FALSE; /* Whether the heap ID changed */
+
+            if (H5HF_write(storage->fheap, id, &id_changed, storage->buf) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "unable to overwrite key-value pair")
+            HDassert(!id_changed);
+        } /* end if */
+        else {
+            H5M_storage_replace_ud_t replace_udata; /* User data for replacing the pair */
+
+            replace_udata.fheap   = storage->fheap;
+            replace_udata.obj     = storage->buf;
+            replace_udata.obj_len = obj_len;
+            if (H5B2_modify(storage->bt2, &udata, H5M__storage_replace_cb, &replace_udata) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTMODIFY, FAIL, "unable to replace key-value pair")
+        } /* end else */
+    }     /* end if */
+    else {
+        /* Insert the key-value pair into the heap, then index it */
+        if (H5HF_insert(storage->fheap, obj_len, storage->buf, id) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, FAIL, "unable to insert key-value pair into heap")
+        udata.id = id;
+        if (H5B2_insert(storage->bt2, &udata) < 0)
+            HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, FAIL, "unable to insert key into index")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_put() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_get
+ *
+ * Purpose:     Looks for a key in a map, calling OP with the stored value
+ *              if the key is found.  KEY is as stored in the file, and
+ *              HASH is the hash of the key from H5M__hash().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_get(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash, hbool_t *found,
+                 H5M_val_op_t op, void *op_data)
+{
+    H5M_bt2_ud_t udata;               /* User data for v2 B-tree find */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+    HDassert(key);
+    HDassert(found);
+
+    /* Look for the key, making the callback from the heap when it matches */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.fheap       = storage->fheap;
+    udata.key_info    = storage->key;
+    udata.val_info    = storage->val;
+    udata.key         = key;
+    udata.key_len     = key_len;
+    udata.hash        = hash;
+    udata.val_op      = op;
+    udata.val_op_data = op_data;
+    if (H5B2_find(storage->bt2, &udata, found, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_NOTFOUND, FAIL, "unable to search key index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_remove_cb
+ *
+ * Purpose:     Removes the heap object of a key-value pair removed from
+ *              the index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_remove_cb(const void *_record, void *_op_data)
+{
+    const H5M_bt2_rec_t *record    = (const H5M_bt2_rec_t *)_record;
+    H5HF_t *             fheap     = (H5HF_t *)_op_data;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5HF_remove(fheap, record->id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "unable to remove key-value pair from heap")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_remove_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_remove
+ *
+ * Purpose:     Removes a key and its value from a map.  KEY is as stored
+ *              in the file, and HASH is the hash of the key from
+ *              H5M__hash().
+ *
+ * Return:      Non-negative on success/Negative on failure (including if
+ *              the key isn't in the map)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_remove(H5M_storage_t *storage, const uint8_t *key, size_t key_len, uint32_t hash)
+{
+    H5M_bt2_ud_t udata;               /* User data for v2 B-tree remove */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+    HDassert(key);
+
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.fheap    = storage->fheap;
+    udata.key_info = storage->key;
+    udata.val_info = storage->val;
+    udata.key      = key;
+    udata.key_len  = key_len;
+    udata.hash     = hash;
+    if (H5B2_remove(storage->bt2, &udata, H5M__storage_remove_cb, storage->fheap) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "unable to remove key from map")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_copy_key_cb
+ *
+ * Purpose:     Copies the key of a key-value pair in the heap to the
+ *              storage buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_copy_key_cb(const void *obj, size_t obj_len, void *_udata)
+{
+    H5M_storage_iter_ud_t *udata     = (H5M_storage_iter_ud_t *)_udata;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5M__elmt_len(udata->storage->key, (const uint8_t *)obj, obj_len, &udata->key_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "corrupt key in map")
+    if (H5M__storage_reserve(udata->storage, MAX(udata->key_len, 1)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "unable to allocate key buffer")
+    H5MM_memcpy(udata->storage->buf, obj, udata->key_len);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_copy_key_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_iterate_cb
+ *
+ * Purpose:     Makes the iteration callback for the key of a record in a
+ *              map's index.  The key is copied out of the heap first, so
+ *              the callback may operate on the map.
+ *
+ * Return:      H5_ITER_CONT, H5_ITER_ERROR or the callback's return value
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5M__storage_iterate_cb(const void *_record, void *_udata)
+{
+    const H5M_bt2_rec_t *  record    = (const H5M_bt2_rec_t *)_record;
+    H5M_storage_iter_ud_t *udata     = (H5M_storage_iter_ud_t *)_udata;
+    int                    ret_value = H5_ITER_CONT; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Skip keys before the starting index */
+    if (udata->skip > 0) {
+        udata->skip--;
+        HGOTO_DONE(H5_ITER_CONT)
+    } /* end if */
+
+    /* Get the key */
+    if (H5HF_op(udata->storage->fheap, record->id, H5M__storage_copy_key_cb, udata) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, H5_ITER_ERROR, "unable to read key")
+
+    /* Make the callback */
+    ret_value = (udata->op)(udata->storage->buf, udata->key_len, udata->op_data);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_iterate_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_iterate
+ *
+ * Purpose:     Calls OP for the keys of a map, in hash order, after
+ *              skipping the first SKIP.  Iteration stops early if OP
+ *              returns non-zero.
+ *
+ * Return:      H5_ITER_CONT, or the non-zero value from OP (negative on
+ *              failure)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_iterate(H5M_storage_t *storage, hsize_t skip, H5M_key_op_t op, void *op_data)
+{
+    H5M_storage_iter_ud_t udata;               /* User data for iteration callback */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+    HDassert(op);
+
+    udata.storage = storage;
+    udata.skip    = skip;
+    udata.op      = op;
+    udata.op_data = op_data;
+    udata.key_len = 0;
+    if ((ret_value = H5B2_iterate(storage->bt2, H5M__storage_iterate_cb, &udata)) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_iterate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_count
+ *
+ * Purpose:     Gets the number of key-value pairs in a map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_count(H5M_storage_t *storage, hsize_t *count)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(storage);
+    HDassert(count);
+
+    if (H5B2_get_nrec(storage->bt2, count) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOUNT, FAIL, "can't get number of keys in map")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_count() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_copy_obj_cb
+ *
+ * Purpose:     Copies a key-value pair of the source map to the storage
+ *              buffer of the destination map.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5M__storage_copy_obj_cb(const void *obj, size_t obj_len, void *_udata)
+{
+    H5M_storage_copy_ud_t *udata     = (H5M_storage_copy_ud_t *)_udata;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5M__storage_reserve(udata->dst, obj_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "unable to allocate key-value pair buffer")
+    H5MM_memcpy(udata->dst->buf, obj, obj_len);
+    udata->obj_len = obj_len;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_copy_obj_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_copy_cb
+ *
+ * Purpose:     Copies the key-value pair of a record in the source map's
+ *              index to the destination map.
+ *
+ * Return:      H5_ITER_CONT or H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5M__storage_copy_cb(const void *_record, void *_udata)
+{
+    const H5M_bt2_rec_t *  record = (const H5M_bt2_rec_t *)_record;
+    H5M_storage_copy_ud_t *udata  = (H5M_storage_copy_ud_t *)_udata;
+    H5M_bt2_ud_t           bt2_udata;                /* User data for v2 B-tree insert */
+    uint8_t                id[H5M_FHEAP_ID_LEN];     /* Heap ID of the copied key-value pair */
+    int                    ret_value = H5_ITER_CONT; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Copy the key-value pair to the destination heap */
+    if (H5HF_op(udata->fheap_src, record->id, H5M__storage_copy_obj_cb, udata) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, H5_ITER_ERROR, "unable to read key-value pair")
+    if (H5HF_insert(udata->dst->fheap, udata->obj_len, udata->dst->buf, id) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, H5_ITER_ERROR, "unable to insert key-value pair into heap")
+
+    /* Index it in the destination map */
+    HDmemset(&bt2_udata, 0, sizeof(bt2_udata));
+    bt2_udata.fheap    = udata->dst->fheap;
+    bt2_udata.key_info = udata->dst->key;
+    bt2_udata.val_info = udata->dst->val;
+    bt2_udata.key      = udata->dst->buf;
+    if (H5M__elmt_len(udata->dst->key, udata->dst->buf, udata->obj_len, &bt2_udata.key_len) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_BADVALUE, H5_ITER_ERROR, "corrupt key in map")
+    bt2_udata.hash = record->hash;
+    bt2_udata.id   = id;
+    if (H5B2_insert(udata->dst->bt2, &bt2_udata) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINSERT, H5_ITER_ERROR, "unable to insert key into index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_copy_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5M__storage_copy
+ *
+ * Purpose:     Creates the storage for a copy of a map in file F_DST and
+ *              copies the key-value pairs of the source map into it,
+ *              setting the storage addresses in MESG_DST.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5M__storage_copy(H5F_t *f_src, const H5O_map_t *mesg_src, H5F_t *f_dst, H5O_map_t *mesg_dst)
+{
+    H5M_type_info_t       key_info;                /* How the map's keys are stored */
+    H5M_type_info_t       val_info;                /* How the map's values are stored */
+    H5M_storage_t         dst;                     /* Open storage of destination map */
+    H5M_storage_copy_ud_t udata;                   /* User data for copying pairs */
+    H5B2_t *              bt2_src       = NULL;    /* v2 B-tree of source map */
+    hbool_t               key_info_init = FALSE;   /* Whether key_info is set up */
+    hbool_t               val_info_init = FALSE;   /* Whether val_info is set up */
+    herr_t                ret_value     = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f_src);
+    HDassert(mesg_src);
+    HDassert(f_dst);
+    HDassert(mesg_dst);
+
+    HDmemset(&dst, 0, sizeof(dst));
+    udata.fheap_src = NULL;
+
+    /* Set up how the keys & values are stored */
+    if (H5M__type_info_init(mesg_src->key_type, &key_info) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unsupported key datatype")
+    key_info_init = TRUE;
+    if (H5M__type_info_init(mesg_src->val_type, &val_info) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unsupported value datatype")
+    val_info_init = TRUE;
+
+    /* Create the destination storage */
+    if (H5M__storage_create(f_dst, mesg_dst) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to create map storage")
+
+    /* Open the source and destination storage */
+    if (NULL == (udata.fheap_src = H5HF_open(f_src, mesg_src->fheap_addr)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+    if (NULL == (bt2_src = H5B2_open(f_src, mesg_src->bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for key index")
+    dst.key = &key_info;
+    dst.val = &val_info;
+    if (NULL == (dst.fheap = H5HF_open(f_dst, mesg_dst->fheap_addr)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+    if (NULL == (dst.bt2 = H5B2_open(f_dst, mesg_dst->bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for key index")
+
+    /* Copy the key-value pairs */
+    udata.dst     = &dst;
+    udata.obj_len = 0;
+    if (H5B2_iterate(bt2_src, H5M__storage_copy_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "unable to copy key-value pairs")
+
+done:
+    if (udata.fheap_src && H5HF_close(udata.fheap_src) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if (bt2_src && H5B2_close(bt2_src) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for key index")
+    if (H5M__storage_close(&dst) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map storage")
+    if (key_info_init && H5M__type_info_reset(&key_info) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype info")
+    if (val_info_init && H5M__type_info_reset(&val_info) < 0)
+        HDONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release datatype info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5M__storage_copy() */
@@ -1318,6 +1318,70 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__attr_iterate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_build_table
+ *
+ * Purpose:     Builds a table holding a copy of every attribute on an
+ *              object, in a single pass over the object header's
+ *              attribute messages or over the dense attribute storage.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__attr_build_table(const H5O_loc_t *loc, H5_index_t idx_type, H5_iter_order_t order,
+                      H5A_attr_table_t *atable)
+{
+    H5O_t *     oh = NULL;           /* Pointer to actual object header */
+    H5O_ainfo_t ainfo;               /* Attribute information for object */
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(loc->addr)
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(atable);
+
+    /* Protect the object header */
+    if (NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Check for attribute info stored */
+    ainfo.fheap_addr = HADDR_UNDEF;
+    if (oh->version > H5O_VERSION_1) {
+        /* Check for (& retrieve if available) attribute info */
+        if (H5A__get_ainfo(loc->file, oh, &ainfo) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
+    } /* end if */
+
+    /* Check for attributes stored densely */
+    if (H5F_addr_defined(ainfo.fheap_addr)) {
+        /* Release the object header */
+        if (H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+
+        /* Build table of attributes for dense storage */
+        if (H5A__dense_build_table(loc->file, &ainfo, idx_type, order, atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end if */
+    else {
+        /* Build table of attributes for compact storage */
+        if (H5A__compact_build_table(loc->file, oh, idx_type, order, atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end else */
+
+done:
+    /* Release resources */
+    if (oh && H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5O__attr_build_table() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_remove_update
  *
@@ -246,7 +246,7 @@ H5O__cache_verify_chksum(const void *_image, size_t len, void *_udata)
         uint32_t computed_chksum; /* Computed metadata checksum value */
 
         /* Get stored and computed checksums */
-        H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+        H5F_get_checksums(udata->common.f, image, len, &stored_chksum, &computed_chksum);
 
         if (stored_chksum != computed_chksum) {
             /* These fields are not deserialized yet in H5O__prefix_deserialize() */
@@ -711,7 +711,7 @@ H5O__cache_chk_verify_chksum(const void *_image, size_t len, void *_udata)
         uint32_t computed_chksum; /* Computed metadata checksum value */
 
         /* Get stored and computed checksums */
-        H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+        H5F_get_checksums(udata->common.f, image, len, &stored_chksum, &computed_chksum);
 
         if (stored_chksum != computed_chksum)
             ret_value = FALSE;
@@ -1660,8 +1660,8 @@ H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno)
                      0, oh->chunk[chunkno].gap);
 
         /* Compute metadata checksum */
-        metadata_chksum =
-            H5_checksum_metadata(oh->chunk[chunkno].image, (oh->chunk[chunkno].size - H5O_SIZEOF_CHKSUM), 0);
+        metadata_chksum = H5F_checksum_metadata(f, oh->chunk[chunkno].image,
+                                                (oh->chunk[chunkno].size - H5O_SIZEOF_CHKSUM), 0);
 
         /* Metadata checksum */
         chunk_image = oh->chunk[chunkno].image + (oh->chunk[chunkno].size - H5O_SIZEOF_CHKSUM);
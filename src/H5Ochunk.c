@@ -181,9 +181,10 @@ H5O__chunk_protect(H5F_t *f, H5O_t *oh, unsigned idx)
         /* Construct the user data for protecting chunk proxy */
         /* (and _not_ decoding it) */
         HDmemset(&chk_udata, 0, sizeof(chk_udata));
-        chk_udata.oh      = oh;
-        chk_udata.chunkno = idx;
-        chk_udata.size    = oh->chunk[idx].size;
+        chk_udata.oh       = oh;
+        chk_udata.chunkno  = idx;
+        chk_udata.size     = oh->chunk[idx].size;
+        chk_udata.common.f = f; /* For verifying the chunk's checksum */
 
         /* Get the chunk proxy */
         if (NULL == (chk_proxy = (H5O_chunk_proxy_t *)H5AC_protect(f, H5AC_OHDR_CHK, oh->chunk[idx].addr,
@@ -326,9 +327,10 @@ H5O__chunk_update_idx(H5F_t *f, H5O_t *oh, unsigned idx)
     /* Construct the user data for protecting chunk proxy */
     /* (and _not_ decoding it) */
     HDmemset(&chk_udata, 0, sizeof(chk_udata));
-    chk_udata.oh      = oh;
-    chk_udata.chunkno = idx;
-    chk_udata.size    = oh->chunk[idx].size;
+    chk_udata.oh       = oh;
+    chk_udata.chunkno  = idx;
+    chk_udata.size     = oh->chunk[idx].size;
+    chk_udata.common.f = f; /* For verifying the chunk's checksum */
 
     /* Get the chunk proxy */
     if (NULL == (chk_proxy = (H5O_chunk_proxy_t *)H5AC_protect(f, H5AC_OHDR_CHK, oh->chunk[idx].addr,
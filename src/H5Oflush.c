@@ -41,6 +41,7 @@
 #include "H5Fprivate.h"  /* Files    */
 #include "H5Gprivate.h"  /* Groups   */
 #include "H5Iprivate.h"  /* IDs      */
+#include "H5Mprivate.h"  /* Maps     */
 #include "H5Opkg.h"      /* Objects  */
 #include "H5Tpkg.h"      /* Datatypes */
 
@@ -220,6 +221,10 @@ H5O_refresh_metadata(H5O_loc_t *oloc, hid_t oid)
         H5F_incr_nopen_objs(oloc->file);
         objs_incr = TRUE;
 
+        /* Forget the links cached for the file, since the writer may have changed them */
+        if (H5G_path_cache_dest(oloc->file) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "unable to release path cache")
+
         /* Save important datatype state */
         if (H5I_get_type(oid) == H5I_DATATYPE)
             if (H5T_save_refresh_state(oid, &cached_H5O_shared) < 0)
@@ -391,7 +396,10 @@ H5O_refresh_metadata_reopen(hid_t oid, H5G_loc_t *obj_loc, H5VL_t *vol_connector
             break;
 
         case H5I_MAP:
-            HGOTO_ERROR(H5E_OHDR, H5E_BADTYPE, FAIL, "maps not supported in native VOL connector")
+            /* Re-open the map */
+            if (NULL == (object = H5M_open(obj_loc)))
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTOPENOBJ, FAIL, "unable to open map")
+            break;
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -35,6 +35,7 @@
 #include "H5Fprivate.h"  /* File access                              */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5FOprivate.h" /* File objects                             */
+#include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5Lprivate.h"  /* Links                                    */
 #include "H5MFprivate.h" /* File memory management                   */
@@ -120,7 +121,8 @@ const H5O_msg_class_t *const H5O_msg_class_g[] = {
     H5O_MSG_REFCOUNT,    /*0x0016 Object's ref. count             */
     H5O_MSG_FSINFO,      /*0x0017 Free-space manager info         */
     H5O_MSG_MDCI,        /*0x0018 Metadata cache image            */
-    H5O_MSG_UNKNOWN      /*0x0019 Placeholder for unknown message */
+    H5O_MSG_MAP,         /*0x0019 Map                             */
+    H5O_MSG_UNKNOWN      /*0x001A Placeholder for unknown message */
 };
 
 /* Format version bounds for object header */
@@ -172,6 +174,7 @@ H5FL_EXTERN(H5_obj_t);
  * datatype message is a datatype but only some of them are datasets.
  */
 static const H5O_obj_class_t *const H5O_obj_class_g[] = {
+    H5O_OBJ_MAP,      /* Map object (H5O_TYPE_MAP - 3) */
     H5O_OBJ_DATATYPE, /* Datatype object (H5O_TYPE_NAMED_DATATYPE - 2) */
     H5O_OBJ_DATASET,  /* Dataset object (H5O_TYPE_DATASET - 1) */
     H5O_OBJ_GROUP,    /* Group object (H5O_TYPE_GROUP - 0) */
@@ -470,7 +473,7 @@ H5O_apply_ohdr(H5F_t *f, H5O_t *oh, hid_t ocpl_id, size_t size_hint, size_t init
     oh_size = (size_t)H5O_SIZEOF_HDR(oh) + size_hint;
 
     /* Allocate disk space for header and first chunk */
-    oh_addr = H5MF_alloc(f, H5FD_MEM_OHDR, (hsize_t)oh_size);
+    oh_addr = H5MF_ohdr_alloc(f, (hsize_t)oh_size);
     if (HADDR_UNDEF == oh_addr)
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "file allocation failed for object header")
 
@@ -1566,6 +1569,9 @@ H5O_delete(H5F_t *f, haddr_t addr)
     if (H5O__delete_oh(f, oh) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTDELETE, FAIL, "can't delete object from file")
 
+    /* Forget any links cached for the object, before its address can be reused */
+    H5G_path_cache_evict(f, addr);
+
     /* Uncork cache entries with tag: addr */
     if (H5AC_cork(f, addr, H5AC__GET_CORKED, &corked) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to retrieve an object's cork status")
@@ -1816,7 +1822,9 @@ H5O_get_loc(hid_t object_id)
             break;
 
         case H5I_MAP:
-            HGOTO_ERROR(H5E_OHDR, H5E_BADTYPE, NULL, "maps not supported in native VOL connector")
+            if (NULL == (ret_value = H5O_OBJ_MAP->get_oloc(object_id)))
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, NULL, "unable to get object location from map ID")
+            break;
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -2456,7 +2464,7 @@ H5O_obj_create(H5F_t *f, H5O_type_t obj_type, void *crt_info, H5G_loc_t *obj_loc
 
     /* Sanity checks */
     HDassert(f);
-    HDassert(obj_type >= H5O_TYPE_GROUP && obj_type <= H5O_TYPE_NAMED_DATATYPE);
+    HDassert(obj_type >= H5O_TYPE_GROUP && obj_type <= H5O_TYPE_MAP);
     HDassert(crt_info);
     HDassert(obj_loc);
 
@@ -2479,6 +2487,54 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_obj_create() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O_obj_create_multi
+ *
+ * Purpose:     Creates COUNT objects, in an abstract manner, with their
+ *              object headers allocated next to each other in the file.
+ *
+ *              The new objects are returned in the NEW_OBJ fields of
+ *              OCRT_INFO and their locations in OBJ_LOC.  On failure,
+ *              the objects created before the failure are left for the
+ *              caller to release.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_obj_create_multi(H5F_t *f, size_t count, H5O_obj_create_t ocrt_info[], H5G_loc_t obj_loc[])
+{
+    hbool_t reserved = FALSE;    /* Whether object header space is reserved */
+    size_t  u;                   /* Local index variable */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(ocrt_info);
+    HDassert(obj_loc);
+
+    /* Reserve space for the object headers */
+    if (H5MF_ohdr_reserve(f, count) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "unable to reserve space for object headers")
+    reserved = TRUE;
+
+    /* Create the objects */
+    for (u = 0; u < count; u++)
+        if (NULL == (ocrt_info[u].new_obj =
+                         H5O_obj_create(f, ocrt_info[u].obj_type, ocrt_info[u].crt_info, &obj_loc[u])))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to create object")
+
+done:
+    /* Release the space no object header was allocated in */
+    if (reserved && H5MF_ohdr_release(f) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTFREE, FAIL, "unable to release reserved object header space")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_obj_create_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O_get_oh_addr
  *
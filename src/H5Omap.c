@@ -0,0 +1,441 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:             H5Omap.c
+ *
+ * Purpose:             Map messages.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#define H5M_FRIEND     /*suppress error about including H5Mpkg   */
+#include "H5Omodule.h" /* This source code file is part of the H5O module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5ACprivate.h" /* Metadata cache                       */
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5FLprivate.h" /* Free lists                           */
+#include "H5Mpkg.h"      /* Maps                                 */
+#include "H5Opkg.h"      /* Object headers			*/
+#include "H5Tprivate.h"  /* Datatypes                            */
+
+/* PRIVATE PROTOTYPES */
+static void * H5O__map_decode(H5F_t *f, H5O_t *open_oh, unsigned mesg_flags, unsigned *ioflags,
+                              size_t p_size, const uint8_t *p);
+static herr_t H5O__map_encode(H5F_t *f, hbool_t disable_shared, uint8_t *p, const void *_mesg);
+static void * H5O__map_copy(const void *_mesg, void *_dest);
+static size_t H5O__map_size(const H5F_t *f, hbool_t disable_shared, const void *_mesg);
+static herr_t H5O__map_reset(void *_mesg);
+static herr_t H5O__map_free(void *_mesg);
+static herr_t H5O__map_delete(H5F_t *f, H5O_t *open_oh, void *_mesg);
+static void * H5O__map_copy_file(H5F_t *file_src, void *native_src, H5F_t *file_dst, hbool_t *recompute_size,
+                                 unsigned *mesg_flags, H5O_copy_t *cpy_info, void *udata);
+static herr_t H5O__map_debug(H5F_t *f, const void *_mesg, FILE *stream, int indent, int fwidth);
+
+/* This message derives from H5O message class */
+const H5O_msg_class_t H5O_MSG_MAP[1] = {{
+    H5O_MAP_ID,         /*message id number             */
+    "map",              /*message name for debugging    */
+    sizeof(H5O_map_t),  /*native message size           */
+    0,                  /* messages are sharable?       */
+    H5O__map_decode,    /*decode message                */
+    H5O__map_encode,    /*encode message                */
+    H5O__map_copy,      /*copy the native value         */
+    H5O__map_size,      /*size of map message           */
+    H5O__map_reset,     /*reset method                  */
+    H5O__map_free,      /* free method			*/
+    H5O__map_delete,    /* file delete method		*/
+    NULL,               /* link method			*/
+    NULL,               /*set share method		*/
+    NULL,               /*can share method		*/
+    NULL,               /* pre copy native value to file */
+    H5O__map_copy_file, /* copy native value to file    */
+    NULL,               /* post copy native value to file */
+    NULL,               /* get creation index		*/
+    NULL,               /* set creation index		*/
+    H5O__map_debug      /*debug the message             */
+}};
+
+/* Current version of map information */
+#define H5O_MAP_VERSION 0
+
+/* Declare a free list to manage the H5O_map_t struct */
+H5FL_DEFINE_STATIC(H5O_map_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_decode
+ *
+ * Purpose:     Decode a message and return a pointer to a newly allocated one.
+ *
+ * Return:      Success:        Ptr to new message in native form.
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__map_decode(H5F_t *f, H5O_t *open_oh, unsigned H5_ATTR_UNUSED mesg_flags, unsigned *ioflags,
+                size_t p_size, const uint8_t *p)
+{
+    const uint8_t *p_end = p + p_size; /* End of the message */
+    H5O_map_t *    map   = NULL;       /* Map message */
+    size_t         dt_size;            /* Size of an encoded datatype */
+    void *         ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(p);
+
+    /* Version of message */
+    if (*p++ != H5O_MAP_VERSION)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "bad version number for message")
+
+    /* Allocate space for message */
+    if (NULL == (map = H5FL_CALLOC(H5O_map_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Address of fractal heap to store the key-value pairs */
+    H5F_addr_decode(f, &p, &(map->fheap_addr));
+
+    /* Address of v2 B-tree to index the key-value pairs */
+    H5F_addr_decode(f, &p, &(map->bt2_addr));
+
+    /* Datatype of the keys */
+    UINT16DECODE(p, dt_size);
+    if (dt_size > (size_t)(p_end - p))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "key datatype extends past end of message")
+    if (NULL == (map->key_type = (H5T_t *)(H5O_MSG_DTYPE->decode)(f, open_oh, 0, ioflags, dt_size, p)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "can't decode key datatype")
+    p += dt_size;
+
+    /* Datatype of the values */
+    UINT16DECODE(p, dt_size);
+    if (dt_size > (size_t)(p_end - p))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "value datatype extends past end of message")
+    if (NULL == (map->val_type = (H5T_t *)(H5O_MSG_DTYPE->decode)(f, open_oh, 0, ioflags, dt_size, p)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "can't decode value datatype")
+
+    /* Set return value */
+    ret_value = map;
+
+done:
+    if (ret_value == NULL)
+        if (map != NULL) {
+            if (H5O__map_reset(map) < 0)
+                HDONE_ERROR(H5E_OHDR, H5E_CANTRELEASE, NULL, "can't reset map message")
+            map = H5FL_FREE(H5O_map_t, map);
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_encode
+ *
+ * Purpose:     Encodes a message.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p, const void *_mesg)
+{
+    const H5O_map_t *map = (const H5O_map_t *)_mesg;
+    size_t           dt_size;             /* Size of an encoded datatype */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(p);
+    HDassert(map);
+
+    /* Message version */
+    *p++ = H5O_MAP_VERSION;
+
+    /* Address of fractal heap to store the key-value pairs */
+    H5F_addr_encode(f, &p, map->fheap_addr);
+
+    /* Address of v2 B-tree to index the key-value pairs */
+    H5F_addr_encode(f, &p, map->bt2_addr);
+
+    /* Datatype of the keys */
+    dt_size = (H5O_MSG_DTYPE->raw_size)(f, FALSE, map->key_type);
+    UINT16ENCODE(p, dt_size);
+    if ((H5O_MSG_DTYPE->encode)(f, FALSE, p, map->key_type) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "can't encode key datatype")
+    p += dt_size;
+
+    /* Datatype of the values */
+    dt_size = (H5O_MSG_DTYPE->raw_size)(f, FALSE, map->val_type);
+    UINT16ENCODE(p, dt_size);
+    if ((H5O_MSG_DTYPE->encode)(f, FALSE, p, map->val_type) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "can't encode value datatype")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_copy
+ *
+ * Purpose:     Copies a message from _MESG to _DEST, allocating _DEST if
+ *              necessary.
+ *
+ * Return:      Success:        Ptr to _DEST
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__map_copy(const void *_mesg, void *_dest)
+{
+    const H5O_map_t *map       = (const H5O_map_t *)_mesg;
+    H5O_map_t *      dest      = (H5O_map_t *)_dest;
+    void *           ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(map);
+    if (!dest && NULL == (dest = H5FL_MALLOC(H5O_map_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* copy */
+    *dest          = *map;
+    dest->key_type = NULL;
+    dest->val_type = NULL;
+    if (NULL == (dest->key_type = H5T_copy(map->key_type, H5T_COPY_ALL)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "can't copy key datatype")
+    if (NULL == (dest->val_type = H5T_copy(map->val_type, H5T_COPY_ALL)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "can't copy value datatype")
+
+    /* Set return value */
+    ret_value = dest;
+
+done:
+    if (!ret_value && dest) {
+        if (H5O__map_reset(dest) < 0)
+            HDONE_ERROR(H5E_OHDR, H5E_CANTRELEASE, NULL, "can't reset map message")
+        if (!_dest)
+            dest = H5FL_FREE(H5O_map_t, dest);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_size
+ *
+ * Purpose:     Returns the size of the raw message in bytes not counting
+ *              the message type or size fields, but only the data fields.
+ *              This function doesn't take into account alignment.
+ *
+ * Return:      Success:        Message data size in bytes without alignment.
+ *              Failure:        zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5O__map_size(const H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, const void *_mesg)
+{
+    const H5O_map_t *map       = (const H5O_map_t *)_mesg;
+    size_t           ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = 1                                                       /* Version */
+                + (size_t)H5F_SIZEOF_ADDR(f)                            /* Address of fractal heap */
+                + (size_t)H5F_SIZEOF_ADDR(f)                            /* Address of v2 B-tree */
+                + 2 + (H5O_MSG_DTYPE->raw_size)(f, FALSE, map->key_type) /* Key datatype */
+                + 2 + (H5O_MSG_DTYPE->raw_size)(f, FALSE, map->val_type); /* Value datatype */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_reset
+ *
+ * Purpose:     Frees resources within a map message, but doesn't free
+ *              the message itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_reset(void *_mesg)
+{
+    H5O_map_t *map       = (H5O_map_t *)_mesg;
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(map);
+
+    /* Close the datatypes */
+    if (map->key_type && H5T_close_real(map->key_type) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "unable to free key datatype")
+    map->key_type = NULL;
+    if (map->val_type && H5T_close_real(map->val_type) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "unable to free value datatype")
+    map->val_type = NULL;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__map_free
+ *
+ * Purpose:	Frees the message
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_free(void *mesg)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mesg);
+
+    mesg = H5FL_FREE(H5O_map_t, mesg);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__map_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_delete
+ *
+ * Purpose:     Free file space referenced by message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_delete(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, void *_mesg)
+{
+    H5O_map_t *map       = (H5O_map_t *)_mesg;
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(map);
+
+    /* Delete the key-value pairs */
+    if (H5M__storage_delete(f, map) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTFREE, FAIL, "unable to free map storage")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_copy_file
+ *
+ * Purpose:     Copies a message from _MESG to _DEST in file, copying the
+ *              map's key-value pairs into new storage in the destination
+ *              file.
+ *
+ * Return:      Success:        Ptr to _DEST
+ *
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__map_copy_file(H5F_t *file_src, void *native_src, H5F_t *file_dst, hbool_t H5_ATTR_UNUSED *recompute_size,
+                   unsigned H5_ATTR_UNUSED *mesg_flags, H5O_copy_t H5_ATTR_UNUSED *cpy_info,
+                   void H5_ATTR_UNUSED *_udata)
+{
+    H5O_map_t *map_src   = (H5O_map_t *)native_src;
+    H5O_map_t *map_dst   = NULL;
+    void *     ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_TAG(H5AC__COPIED_TAG)
+
+    /* check args */
+    HDassert(map_src);
+
+    /* Copy the source message */
+    if (NULL == (map_dst = (H5O_map_t *)H5O__map_copy(map_src, NULL)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "memory allocation failed")
+
+    /* Copy the key-value pairs to new storage in the destination file */
+    if (H5M__storage_copy(file_src, map_src, file_dst, map_dst) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "unable to copy map storage")
+
+    /* Set return value */
+    ret_value = map_dst;
+
+done:
+    if (!ret_value && map_dst) {
+        if (H5O__map_reset(map_dst) < 0)
+            HDONE_ERROR(H5E_OHDR, H5E_CANTRELEASE, NULL, "can't reset map message")
+        map_dst = H5FL_FREE(H5O_map_t, map_dst);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* H5O__map_copy_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__map_debug
+ *
+ * Purpose:     Prints debugging info for a message.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__map_debug(H5F_t *f, const void *_mesg, FILE *stream, int indent, int fwidth)
+{
+    const H5O_map_t *map = (const H5O_map_t *)_mesg;
+    int              sub_fwidth;          /* Field width of the datatypes */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(map);
+    HDassert(stream);
+    HDassert(indent >= 0);
+    HDassert(fwidth >= 0);
+
+    sub_fwidth = fwidth > 3 ? fwidth - 3 : 0;
+
+    HDfprintf(stream, "%*s%-*s %" PRIuHADDR "\n", indent, "", fwidth,
+              "Fractal heap address:", map->fheap_addr);
+    HDfprintf(stream, "%*s%-*s %" PRIuHADDR "\n", indent, "", fwidth,
+              "v2 B-tree address:", map->bt2_addr);
+    HDfprintf(stream, "%*sKey datatype...\n", indent, "");
+    if ((H5O_MSG_DTYPE->debug)(f, map->key_type, stream, indent + 3, sub_fwidth) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to display key datatype")
+    HDfprintf(stream, "%*sValue datatype...\n", indent, "");
+    if ((H5O_MSG_DTYPE->debug)(f, map->val_type, stream, indent + 3, sub_fwidth) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to display value datatype")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__map_debug() */
@@ -30,7 +30,7 @@
 #define H5O_NCHUNKS 2 /*initial number of chunks	     */
 #define H5O_MIN_SIZE                                                                                         \
     22 /* Min. obj header data size (must be big enough for a message prefix and a continuation message) */
-#define H5O_MSG_TYPES         26    /* # of types of messages            */
+#define H5O_MSG_TYPES         27    /* # of types of messages            */
 #define H5O_MAX_CRT_ORDER_IDX 65535 /* Max. creation order index value   */
 
 /* Versions of object header structure */
@@ -523,7 +523,10 @@ H5_DLLVAR const H5O_msg_class_t H5O_MSG_FSINFO[1];
 /* Metadata Cache Image message. (0x0018) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_MDCI[1];
 
-/* Placeholder for unknown message. (0x0019) */
+/* Map message. (0x0019) */
+H5_DLLVAR const H5O_msg_class_t H5O_MSG_MAP[1];
+
+/* Placeholder for unknown message. (0x001a) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_UNKNOWN[1];
 
 /*
@@ -539,6 +542,9 @@ H5_DLLVAR const H5O_obj_class_t H5O_OBJ_DATASET[1];
 /* Datatype Object. (H5O_TYPE_NAMED_DATATYPE - 2) */
 H5_DLLVAR const H5O_obj_class_t H5O_OBJ_DATATYPE[1];
 
+/* Map Object. (H5O_TYPE_MAP - 3) */
+H5_DLLVAR const H5O_obj_class_t H5O_OBJ_MAP[1];
+
 /* Package-local function prototypes */
 H5_DLL void *H5O__open_by_addr(const H5G_loc_t *loc, haddr_t addr, H5I_type_t *opened_type /*out*/);
 H5_DLL void *H5O__open_by_idx(const H5G_loc_t *loc, const char *name, H5_index_t idx_type,
@@ -231,7 +231,8 @@ typedef struct H5O_copy_t {
 #define H5O_REFCOUNT_ID    0x0016 /* Reference count message.  */
 #define H5O_FSINFO_ID      0x0017 /* File space info message.  */
 #define H5O_MDCI_MSG_ID    0x0018 /* Metadata Cache Image Message */
-#define H5O_UNKNOWN_ID     0x0019 /* Placeholder message ID for unknown message.  */
+#define H5O_MAP_ID         0x0019 /* Map Message. */
+#define H5O_UNKNOWN_ID     0x001a /* Placeholder message ID for unknown message.  */
 /* (this should never exist in a file) */
 /*
  * Note: Must increment H5O_MSG_TYPES in H5Opkg.h and update H5O_msg_class_g
@@ -241,7 +242,7 @@ typedef struct H5O_copy_t {
  *
  * (this should never exist in a file)
  */
-#define H5O_BOGUS_INVALID_ID 0x001a /* "Bogus invalid" Message.  */
+#define H5O_BOGUS_INVALID_ID 0x001b /* "Bogus invalid" Message.  */
 
 /* Shared object message types.
  * Shared objects can be committed, in which case the shared message contains
@@ -512,6 +513,10 @@ typedef struct H5O_storage_virtual_srcdset_t {
     struct H5D_t *dset;                   /* Source dataset                     */
     hbool_t       dset_exists;            /* Whether the dataset exists (was opened successfully) */
 
+    /* Not stored - links in the list of open source datasets (see H5D_virtual_src_lru_t) */
+    struct H5O_storage_virtual_srcdset_t *lru_prev; /* More recently used open source dataset */
+    struct H5O_storage_virtual_srcdset_t *lru_next; /* Less recently used open source dataset */
+
     /* Temporary - only used during I/O operation, NULL at all other times */
     struct H5S_t *projected_mem_space; /* Selection within mem_space for this mapping */
 } H5O_storage_virtual_srcdset_t;
@@ -583,6 +588,9 @@ typedef struct H5O_storage_virtual_t {
     hid_t   source_fapl; /* FAPL to use to open source files */
     hid_t   source_dapl; /* DAPL to use to open source datasets */
     hbool_t init;        /* Whether all information has been completely initialized */
+
+    /* Index of the mappings by their bounds in the VDS, built when the dataset is opened */
+    struct H5D_virtual_index_t *index;
 } H5O_storage_virtual_t;
 
 typedef struct H5O_storage_t {
@@ -865,6 +873,20 @@ typedef struct H5O_mdci_t {
     hsize_t size; /* size of MDC image block    */
 } H5O_mdci_t;
 
+/*
+ * Map Message.
+ * Contains the key & value datatypes of a map and the addresses of the
+ * fractal heap that stores its key-value pairs and the v2 B-tree that
+ * indexes them by the hash of their keys.
+ * (Data structure in memory)
+ */
+typedef struct H5O_map_t {
+    H5T_t * key_type;   /* Datatype of keys in the file */
+    H5T_t * val_type;   /* Datatype of values in the file */
+    haddr_t fheap_addr; /* Address of fractal heap for key-value pairs */
+    haddr_t bt2_addr;   /* Address of v2 B-tree to index the pairs by key hash */
+} H5O_map_t;
+
 /* Typedef for "application" iteration operations */
 typedef herr_t (*H5O_operator_t)(const void *mesg /*in*/, unsigned idx, void *operator_data /*in,out*/);
 
@@ -929,6 +951,8 @@ H5_DLL herr_t  H5O_get_create_plist(const H5O_loc_t *loc, struct H5P_genplist_t
 H5_DLL void *  H5O_open_name(const H5G_loc_t *loc, const char *name, H5I_type_t *opened_type /*out*/);
 H5_DLL herr_t  H5O_get_nlinks(const H5O_loc_t *loc, hsize_t *nlinks);
 H5_DLL void *  H5O_obj_create(H5F_t *f, H5O_type_t obj_type, void *crt_info, H5G_loc_t *obj_loc);
+H5_DLL herr_t  H5O_obj_create_multi(H5F_t *f, size_t count, H5O_obj_create_t ocrt_info[],
+                                    H5G_loc_t obj_loc[]);
 H5_DLL haddr_t H5O_get_oh_addr(const H5O_t *oh);
 H5_DLL uint8_t H5O_get_oh_flags(const H5O_t *oh);
 H5_DLL time_t  H5O_get_oh_mtime(const H5O_t *oh);
@@ -91,7 +91,7 @@
     {                                                                                                        \
         {HADDR_UNDEF, 0}, 0, NULL, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,                       \
                                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                      \
-            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE                                                        \
+            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE, NULL                                                  \
     }
 #ifdef H5_HAVE_C99_DESIGNATED_INITIALIZER
 #define H5D_DEF_STORAGE_COMPACT                                                                              \
@@ -230,6 +230,11 @@
 #define H5D_CRT_MIN_DSET_HDR_SIZE_DEF  FALSE
 #define H5D_CRT_MIN_DSET_HDR_SIZE_ENC  H5P__encode_hbool_t
 #define H5D_CRT_MIN_DSET_HDR_SIZE_DEC  H5P__decode_hbool_t
+/* Definitions for storing incompressible chunks unfiltered */
+#define H5D_CRT_MIN_FILTER_RATIO_SIZE sizeof(double)
+#define H5D_CRT_MIN_FILTER_RATIO_DEF  0.0
+#define H5D_CRT_MIN_FILTER_RATIO_ENC  H5P__encode_double
+#define H5D_CRT_MIN_FILTER_RATIO_DEC  H5P__decode_double
 
 /******************/
 /* Local Typedefs */
@@ -318,6 +323,8 @@ static const unsigned     H5D_def_alloc_time_state_g =
     H5D_CRT_ALLOC_TIME_STATE_DEF;                                     /* Default allocation time state */
 static const H5O_efl_t H5D_def_efl_g = H5D_CRT_EXT_FILE_LIST_DEF;     /* Default external file list */
 static const unsigned H5O_ohdr_min_g = H5D_CRT_MIN_DSET_HDR_SIZE_DEF; /* Default object header minimization */
+static const double   H5D_def_min_filter_ratio_g =
+    H5D_CRT_MIN_FILTER_RATIO_DEF; /* Default minimum compression ratio */
 
 /* Defaults for each type of layout */
 #ifdef H5_HAVE_C99_DESIGNATED_INITIALIZER
@@ -385,6 +392,12 @@ H5P__dcrt_reg_prop(H5P_genclass_t *pclass)
                            H5D_CRT_MIN_DSET_HDR_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the minimum compression ratio property */
+    if (H5P__register_real(pclass, H5D_CRT_MIN_FILTER_RATIO_NAME, H5D_CRT_MIN_FILTER_RATIO_SIZE,
+                           &H5D_def_min_filter_ratio_g, NULL, NULL, NULL, H5D_CRT_MIN_FILTER_RATIO_ENC,
+                           H5D_CRT_MIN_FILTER_RATIO_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dcrt_reg_prop() */
@@ -3878,3 +3891,73 @@ H5Pset_dset_no_attrs_hint(hid_t dcpl_id, hbool_t minimize)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pset_dset_no_attrs_hint() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_filter_min_ratio
+ *
+ * Purpose:     Sets the minimum compression ratio a chunk must reach to be
+ *              stored filtered.  Chunks that the filter pipeline shrinks
+ *              less are stored unfiltered, with every filter skipped in
+ *              their filter mask.  A ratio of 0 (the default) stores all
+ *              chunks filtered.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_min_ratio(hid_t plist_id, double min_ratio)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "id", plist_id, min_ratio);
+
+    /* Check arguments */
+    if (!(min_ratio >= 0.0) || min_ratio > DBL_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "minimum ratio must be a non-negative number")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5D_CRT_MIN_FILTER_RATIO_NAME, &min_ratio) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set minimum compression ratio")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_min_ratio() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_filter_min_ratio
+ *
+ * Purpose:     Retrieves the minimum compression ratio set with
+ *              H5Pset_filter_min_ratio().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_min_ratio(hid_t plist_id, double *min_ratio /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, min_ratio);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (min_ratio)
+        if (H5P_get(plist, H5D_CRT_MIN_FILTER_RATIO_NAME, min_ratio) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get minimum compression ratio")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_min_ratio() */
@@ -84,6 +84,9 @@
 /* Definitions for vlen free info property */
 #define H5D_XFER_VLEN_FREE_INFO_SIZE sizeof(void *)
 #define H5D_XFER_VLEN_FREE_INFO_DEF  H5D_VLEN_FREE_INFO
+/* Definitions for vlen arena property */
+#define H5D_XFER_VLEN_ARENA_SIZE sizeof(H5D_vlen_arena_t *)
+#define H5D_XFER_VLEN_ARENA_DEF  NULL
 /* Definitions for hyperslab vector size property */
 /* (Be cautious about increasing the default size, there are arrays allocated
  *      on the stack which depend on it - QAK)
@@ -148,6 +151,16 @@
     {                                                                                                        \
         NULL, NULL                                                                                           \
     }
+/* Definitions for type conversion threads property */
+#define H5D_XFER_CONV_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_CONV_NTHREADS_DEF  1
+#define H5D_XFER_CONV_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_CONV_NTHREADS_DEC  H5P__decode_unsigned
+/* Definitions for filter threads property */
+#define H5D_XFER_FILTER_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_FILTER_NTHREADS_DEF  1
+#define H5D_XFER_FILTER_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_FILTER_NTHREADS_DEC  H5P__decode_unsigned
 /* Definitions for data transform property */
 #define H5D_XFER_XFORM_SIZE  sizeof(void *)
 #define H5D_XFER_XFORM_DEF   NULL
@@ -258,6 +271,8 @@ static const H5MM_free_t H5D_def_vlen_free_g =
     H5D_XFER_VLEN_FREE_DEF; /* Default value for vlen free function */
 static const void *H5D_def_vlen_free_info_g =
     H5D_XFER_VLEN_FREE_INFO_DEF; /* Default value for vlen free information */
+static const H5D_vlen_arena_t *H5D_def_vlen_arena_g =
+    H5D_XFER_VLEN_ARENA_DEF; /* Default value for vlen arena */
 static const size_t H5D_def_hyp_vec_size_g =
     H5D_XFER_HYPER_VECTOR_SIZE_DEF; /* Default value for vector size */
 static const H5FD_mpio_xfer_t H5D_def_io_xfer_mode_g =
@@ -275,6 +290,10 @@ static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;       /* Default
 static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
     H5D_XFER_CONV_CB_DEF; /* Default value for datatype conversion callback */
+static const unsigned H5D_def_conv_nthreads_g =
+    H5D_XFER_CONV_NTHREADS_DEF; /* Default number of datatype conversion threads */
+static const unsigned H5D_def_filter_nthreads_g =
+    H5D_XFER_FILTER_NTHREADS_DEF; /* Default number of filter threads */
 static const void * H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF; /* Default value for data transform */
 static const H5S_t *H5D_def_dset_io_sel_g =
     H5D_XFER_DSET_IO_SEL_DEF; /* Default value for dataset I/O selection */
@@ -353,6 +372,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the vlen arena property */
+    /* (Note: this property should not have an encode/decode callback) */
+    if (H5P__register_real(pclass, H5D_XFER_VLEN_ARENA_NAME, H5D_XFER_VLEN_ARENA_SIZE, &H5D_def_vlen_arena_g,
+                           NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the vector size property */
     if (H5P__register_real(pclass, H5D_XFER_HYPER_VECTOR_SIZE_NAME, H5D_XFER_HYPER_VECTOR_SIZE_SIZE,
                            &H5D_def_hyp_vec_size_g, NULL, NULL, NULL, H5D_XFER_HYPER_VECTOR_SIZE_ENC,
@@ -428,6 +453,18 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the type conversion threads property */
+    if (H5P__register_real(pclass, H5D_XFER_CONV_NTHREADS_NAME, H5D_XFER_CONV_NTHREADS_SIZE,
+                           &H5D_def_conv_nthreads_g, NULL, NULL, NULL, H5D_XFER_CONV_NTHREADS_ENC,
+                           H5D_XFER_CONV_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the filter threads property */
+    if (H5P__register_real(pclass, H5D_XFER_FILTER_NTHREADS_NAME, H5D_XFER_FILTER_NTHREADS_SIZE,
+                           &H5D_def_filter_nthreads_g, NULL, NULL, NULL, H5D_XFER_FILTER_NTHREADS_ENC,
+                           H5D_XFER_FILTER_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the data transform property */
     if (H5P__register_real(pclass, H5D_XFER_XFORM_NAME, H5D_XFER_XFORM_SIZE, &H5D_def_xfer_xform_g, NULL,
                            H5D_XFER_XFORM_SET, H5D_XFER_XFORM_GET, H5D_XFER_XFORM_ENC, H5D_XFER_XFORM_DEC,
@@ -1432,6 +1469,143 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_type_conv_nthreads
+ *
+ * Purpose:     Sets the number of threads that may share the datatype
+ *              conversion of a large buffer during dataset I/O.  Values
+ *              greater than 1 also let the conversion of one strip of
+ *              the transfer overlap the gathering of the next.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_type_conv_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_type_conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_type_conv_nthreads
+ *
+ * Purpose:     Gets the number of datatype conversion threads for a
+ *              dataset transfer property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_type_conv_nthreads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get property */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_type_conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_filter_nthreads
+ *
+ * Purpose:     Sets the number of threads that filters which can split
+ *              their work, such as the LZ compression filter, may use
+ *              for each chunk written during dataset I/O.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_filter_nthreads
+ *
+ * Purpose:     Gets the number of filter threads for a dataset transfer
+ *              property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get property */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_nthreads() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pget_btree_ratios
  *
@@ -1655,6 +1829,71 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_vlen_mem_manager() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_vlen_arena
+ *
+ * Purpose:     Sets the arena to receive the variable-length data of each
+ *              dataset read with this property list, instead of allocating
+ *              each sequence or string separately.  A NULL arena restores
+ *              the normal allocation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlen_arena(hid_t plist_id, H5D_vlen_arena_t *arena)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*#", plist_id, arena);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_VLEN_ARENA_NAME, &arena) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlen_arena() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_vlen_arena
+ *
+ * Purpose:     Gets the arena for variable-length data set with
+ *              H5Pset_vlen_arena().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_vlen_arena(hid_t plist_id, H5D_vlen_arena_t **arena /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, arena);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get property */
+    if (arena)
+        if (H5P_get(plist, H5D_XFER_VLEN_ARENA_NAME, arena) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_vlen_arena() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_hyper_vector_size
  *
@@ -118,6 +118,11 @@
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_DEF  H5F_FILE_SPACE_PAGE_SIZE_DEF
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_ENC  H5P__encode_hsize_t
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_DEC  H5P__decode_hsize_t
+/* Definitions for metadata checksum algorithm */
+#define H5F_CRT_METADATA_CHECKSUM_SIZE sizeof(H5F_metadata_checksum_t)
+#define H5F_CRT_METADATA_CHECKSUM_DEF  H5F_METADATA_CHECKSUM_LOOKUP3
+#define H5F_CRT_METADATA_CHECKSUM_ENC  H5P__fcrt_metadata_checksum_enc
+#define H5F_CRT_METADATA_CHECKSUM_DEC  H5P__fcrt_metadata_checksum_dec
 
 /******************/
 /* Local Typedefs */
@@ -143,6 +148,8 @@ static herr_t H5P__fcrt_shmsg_index_minsize_enc(const void *value, void **_pp, s
 static herr_t H5P__fcrt_shmsg_index_minsize_dec(const void **_pp, void *value);
 static herr_t H5P__fcrt_fspace_strategy_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__fcrt_fspace_strategy_dec(const void **_pp, void *_value);
+static herr_t H5P__fcrt_metadata_checksum_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__fcrt_metadata_checksum_dec(const void **_pp, void *_value);
 
 /*********************/
 /* Package Variables */
@@ -195,6 +202,7 @@ static const H5F_fspace_strategy_t H5F_def_file_space_strategy_g  = H5F_CRT_FILE
 static const hbool_t               H5F_def_free_space_persist_g   = H5F_CRT_FREE_SPACE_PERSIST_DEF;
 static const hsize_t               H5F_def_free_space_threshold_g = H5F_CRT_FREE_SPACE_THRESHOLD_DEF;
 static const hsize_t               H5F_def_file_space_page_size_g = H5F_CRT_FILE_SPACE_PAGE_SIZE_DEF;
+static const H5F_metadata_checksum_t H5F_def_metadata_checksum_g  = H5F_CRT_METADATA_CHECKSUM_DEF;
 
 /*-------------------------------------------------------------------------
  * Function:    H5P__fcrt_reg_prop
@@ -301,6 +309,12 @@ H5P__fcrt_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the metadata checksum algorithm */
+    if (H5P__register_real(pclass, H5F_CRT_METADATA_CHECKSUM_NAME, H5F_CRT_METADATA_CHECKSUM_SIZE,
+                           &H5F_def_metadata_checksum_g, NULL, NULL, NULL, H5F_CRT_METADATA_CHECKSUM_ENC,
+                           H5F_CRT_METADATA_CHECKSUM_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__fcrt_reg_prop() */
@@ -1475,3 +1489,134 @@ H5Pget_file_space_page_size(hid_t plist_id, hsize_t *fsp_size /*out*/)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_file_space_page_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__fcrt_metadata_checksum_enc
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 checksum property in the file creation property list
+ *                 is encoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__fcrt_metadata_checksum_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_metadata_checksum_t *alg = (const H5F_metadata_checksum_t *)value; /* Create local alias */
+    uint8_t **                     pp  = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(alg);
+    HDassert(size);
+
+    if (NULL != *pp)
+        /* Encode metadata checksum algorithm */
+        *(*pp)++ = (uint8_t)*alg;
+
+    /* Size of metadata checksum algorithm */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__fcrt_metadata_checksum_enc() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__fcrt_metadata_checksum_dec
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 checksum property in the file creation property list
+ *                 is decoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__fcrt_metadata_checksum_dec(const void **_pp, void *_value)
+{
+    H5F_metadata_checksum_t *alg = (H5F_metadata_checksum_t *)_value; /* Metadata checksum algorithm */
+    const uint8_t **         pp  = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(alg);
+
+    /* Decode metadata checksum algorithm */
+    *alg = (H5F_metadata_checksum_t) * (*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__fcrt_metadata_checksum_dec() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_metadata_checksum
+ *
+ * Purpose:     Sets the checksum algorithm for the metadata of files
+ *              created with the property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_metadata_checksum(hid_t plist_id, H5F_metadata_checksum_t alg)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFc", plist_id, alg);
+
+    /* Check arguments */
+    if (alg < H5F_METADATA_CHECKSUM_LOOKUP3 || alg >= H5F_METADATA_CHECKSUM_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid metadata checksum algorithm")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_CRT_METADATA_CHECKSUM_NAME, &alg) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata checksum algorithm")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_metadata_checksum() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_metadata_checksum
+ *
+ * Purpose:     Retrieves the checksum algorithm for file metadata.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_metadata_checksum(hid_t plist_id, H5F_metadata_checksum_t *alg /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, alg);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (alg)
+        if (H5P_get(plist, H5F_CRT_METADATA_CHECKSUM_NAME, alg) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata checksum algorithm")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_metadata_checksum() */
@@ -1189,6 +1189,48 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_fletcher32() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lz
+ *
+ * Purpose:     Sets the compression method for a dataset or group link
+ *              filter pipeline (depending on whether PLIST_ID is a dataset
+ *              creation or group creation property list) to H5Z_FILTER_LZ,
+ *              the library's built-in fast LZ compressor.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lz(hid_t plist_id)
+{
+    H5P_genplist_t *plist;               /* Property list */
+    H5O_pline_t     pline;               /* Filter pipeline */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_OBJECT_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get the pipeline property to append to */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+
+    /* Add the filter */
+    if (H5Z_append(&pline, H5Z_FILTER_LZ, H5Z_FLAG_OPTIONAL, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add lz filter to pipeline")
+
+    /* Put the I/O pipeline information back into the property list */
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lz() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P__get_filter
  *
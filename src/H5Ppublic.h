@@ -2573,6 +2573,37 @@ H5_DLL herr_t H5Pset_filter(hid_t plist_id, H5Z_filter_t filter, unsigned int fl
  *
  */
 H5_DLL herr_t H5Pset_fletcher32(hid_t plist_id);
+/**
+ * \ingroup OCPL
+ *
+ * \brief Sets up use of the built-in LZ compression filter
+ *
+ * \ocpl_id{plist_id}
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_lz() sets the LZ compression filter,
+ *          #H5Z_FILTER_LZ, in a dataset or group creation property list,
+ *          \p plist_id.
+ *
+ *          The LZ filter is a fast, byte-oriented compressor from the LZ77
+ *          family that is built into the library and needs no external
+ *          library. It compresses less than the gzip filter
+ *          (#H5Z_FILTER_DEFLATE), but compresses and, in particular,
+ *          decompresses much faster. Data is compressed in 64 KB blocks,
+ *          and blocks that don't compress are stored as-is.
+ *
+ *          The blocks of each chunk can be compressed by several threads;
+ *          the number of threads is set for each transfer with
+ *          H5Pset_filter_nthreads().
+ *
+ *          The filter is optional: a chunk that the filter fails to
+ *          compress is stored unfiltered.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_lz(hid_t plist_id);
 /**
  * \ingroup OCPL
  *
@@ -2681,6 +2712,27 @@ H5_DLL herr_t H5Pget_file_space_strategy(hid_t plist_id, H5F_fspace_strategy_t *
  *
  */
 H5_DLL herr_t H5Pget_istore_k(hid_t plist_id, unsigned *ik /*out*/);
+/**
+ * \ingroup FCPL
+ *
+ * \brief Retrieves the checksum algorithm used for file metadata
+ *
+ * \fcpl_id{plist_id}
+ * \param[out] alg Metadata checksum algorithm
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_metadata_checksum() retrieves the algorithm used to
+ *          checksum the file's metadata, as set with
+ *          H5Pset_metadata_checksum(), or, for the creation property list
+ *          of an open file, as recorded in the file's superblock.
+ *
+ * \see H5Pset_metadata_checksum()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_metadata_checksum(hid_t plist_id, H5F_metadata_checksum_t *alg /*out*/);
 /**
  * \ingroup FCPL
  *
@@ -2935,6 +2987,39 @@ H5_DLL herr_t H5Pset_file_space_strategy(hid_t plist_id, H5F_fspace_strategy_t s
  *
  */
 H5_DLL herr_t H5Pset_istore_k(hid_t plist_id, unsigned ik);
+/**
+ * \ingroup FCPL
+ *
+ * \brief Sets the checksum algorithm used for file metadata
+ *
+ * \fcpl_id{plist_id}
+ * \param[in] alg Metadata checksum algorithm
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_metadata_checksum() sets the algorithm used to checksum
+ *          the metadata of files created with the property list
+ *          \p plist_id.  Valid values of \p alg are:
+ *
+ *          \li #H5F_METADATA_CHECKSUM_LOOKUP3 (default) uses Jenkins'
+ *              lookup3 hash, as in all previous versions of the file format.
+ *          \li #H5F_METADATA_CHECKSUM_CRC32C uses CRC-32C, which is computed
+ *              with a single instruction per 8 bytes on CPUs that support
+ *              it, speeding up metadata cache loads and flushes.
+ *
+ *          The algorithm is recorded in the file's superblock, so files
+ *          using lookup3 checksums remain readable by any version of the
+ *          library.  Choosing CRC-32C requires a version 4 superblock:
+ *          file creation fails unless the high bound of the library
+ *          version bounds is #H5F_LIBVER_LATEST, and earlier versions of
+ *          the library will refuse to open the file.
+ *
+ * \see H5Pget_metadata_checksum(), H5Pset_libver_bounds()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_metadata_checksum(hid_t plist_id, H5F_metadata_checksum_t alg);
 /**
  * \ingroup FCPL
  *
@@ -5760,6 +5845,25 @@ H5_DLL herr_t H5Pget_fill_time(hid_t plist_id, H5D_fill_time_t *fill_time /*out*
  *
  */
 H5_DLL herr_t H5Pget_fill_value(hid_t plist_id, hid_t type_id, void *value /*out*/);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Retrieves the minimum compression ratio for storing chunks filtered
+ *
+ * \dcpl_id{plist_id}
+ * \param[out] min_ratio Minimum compression ratio
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_filter_min_ratio() retrieves the minimum compression
+ *          ratio set with H5Pset_filter_min_ratio() for the dataset
+ *          creation property list \p plist_id. A value of 0 means
+ *          chunks are always stored filtered.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_filter_min_ratio(hid_t plist_id, double *min_ratio /*out*/);
 /**
  * \ingroup DCPL
  *
@@ -6257,6 +6361,41 @@ H5_DLL herr_t H5Pset_fill_time(hid_t plist_id, H5D_fill_time_t fill_time);
  *
  */
 H5_DLL herr_t H5Pset_fill_value(hid_t plist_id, hid_t type_id, const void *value);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Sets the minimum compression ratio for storing chunks filtered
+ *
+ * \dcpl_id{plist_id}
+ * \param[in] min_ratio Minimum ratio of a chunk's unfiltered size to its
+ *                      filtered size
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_filter_min_ratio() sets a policy for storing chunks
+ *          that the dataset's filter pipeline doesn't compress well.
+ *          When a chunk is written, its unfiltered size is divided by
+ *          its size after the pipeline has been applied; if that ratio is
+ *          less than \p min_ratio, the chunk is stored uncompressed
+ *          instead.  The compression filters (and the shuffle filter) are
+ *          marked as skipped in its filter mask, so reading it back
+ *          doesn't run them, while Fletcher32 checksums and any other
+ *          filters are still applied.
+ *
+ *          A \p min_ratio of 0, the default, stores every chunk filtered.
+ *          A value of 1 stores a chunk unfiltered only when filtering would
+ *          make it larger, and for example 1.1 requires a saving of about
+ *          10 percent.
+ *
+ *          The policy applies to writes through datasets created with
+ *          \p plist_id. It is not stored in the file, so datasets that are
+ *          reopened store all chunks filtered again, and it is not applied
+ *          to chunks written collectively with parallel I/O.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_filter_min_ratio(hid_t plist_id, double min_ratio);
 /**
  * \ingroup DCPL
  *
@@ -7476,6 +7615,25 @@ H5_DLL ssize_t H5Pget_data_transform(hid_t plist_id, char *expression /*out*/, s
  *
  */
 H5_DLL H5Z_EDC_t H5Pget_edc_check(hid_t plist_id);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Gets the number of threads filters may use for each chunk
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] nthreads Number of filter threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_filter_nthreads() retrieves the number of threads that
+ *          filters may use to process each chunk during dataset I/O, as set
+ *          by H5Pset_filter_nthreads().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads);
 /**
  *
  * \ingroup  DXPL
@@ -7547,6 +7705,25 @@ H5_DLL int H5Pget_preserve(hid_t plist_id);
  *
  */
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void **operate_data);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Gets the number of threads used for datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] nthreads Number of datatype conversion threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_type_conv_nthreads() retrieves the number of threads
+ *          that may share datatype conversion during dataset I/O, as set
+ *          by H5Pset_type_conv_nthreads().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_type_conv_nthreads(hid_t plist_id, unsigned *nthreads);
 /**
  *
  * \ingroup DXPL
@@ -7571,6 +7748,24 @@ H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, voi
  */
 H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t *alloc_func, void **alloc_info,
                                       H5MM_free_t *free_func, void **free_info);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Gets the arena for variable-length data read with H5Dread()
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] arena Arena set with H5Pset_vlen_arena(), or NULL
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_vlen_arena() retrieves the arena set with
+ *          H5Pset_vlen_arena().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_vlen_arena(hid_t plist_id, H5D_vlen_arena_t **arena);
 /**
  *
  * \ingroup DXPL
@@ -7636,7 +7831,12 @@ H5_DLL herr_t H5Pset_btree_ratios(hid_t plist_id, double left, double middle, do
  *          If \p tconv and/or \p bkg are null pointers, then buffers will be
  *          allocated and freed during the data transfer.
  *
- *          The default value for the maximum buffer is 1 MiB.
+ *          The default value for the maximum buffer is 1 MiB.  While the
+ *          default is in effect and no buffers are supplied, the library
+ *          chooses the size for each transfer instead, from the size of the
+ *          selection (or of one chunk, for chunked datasets) up to 8 MiB, and
+ *          from the number of conversion threads set with
+ *          H5Pset_type_conv_nthreads().
  *
  * \version 1.6.0 The \p size parameter has changed from type hsize_t to \c size_t.
  * \version 1.4.0 The \p size parameter has changed to type hsize_t.
@@ -7755,6 +7955,37 @@ H5_DLL herr_t H5Pset_edc_check(hid_t plist_id, H5Z_EDC_t check);
  *
  */
 H5_DLL herr_t H5Pset_filter_callback(hid_t plist_id, H5Z_filter_func_t func, void *op_data);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Sets the number of threads filters may use for each chunk
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] nthreads Number of filter threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_filter_nthreads() sets the number of threads,
+ *          \p nthreads, that filters may use to process each chunk
+ *          written during H5Dwrite().  The default, 1, runs filters in
+ *          the calling thread.
+ *
+ *          Only filters that can split a chunk into independent parts
+ *          use the threads; currently that is the LZ compression filter
+ *          (#H5Z_FILTER_LZ).  The number of threads is a property of the
+ *          transfer, not of the data, and is not stored in the file.
+ *          Chunks flushed from the chunk cache outside of H5Dwrite(),
+ *          for example when the dataset is closed, use the default.
+ *
+ *          Threads are only used when the library is built thread-safe;
+ *          otherwise the property is accepted and filters run in the
+ *          calling thread.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads);
 
 /**
  * \ingroup DXPL
@@ -7844,6 +8075,45 @@ H5_DLL herr_t H5Pset_preserve(hid_t plist_id, hbool_t status);
  *
  */
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void *operate_data);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Sets the number of threads used for datatype conversion
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] nthreads Number of datatype conversion threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_type_conv_nthreads() sets the number of threads,
+ *          \p nthreads, that may share the conversion of a large buffer
+ *          between datatypes during H5Dread() and H5Dwrite().  The
+ *          default, 1, converts in the calling thread.
+ *
+ *          Conversions between native integer and floating-point
+ *          types are split when no conversion exception callback is
+ *          set (see H5Pset_type_conv_cb()), as are conversions that
+ *          just change the byte order of integer, floating-point or
+ *          bitfield elements.  Compound conversions split the
+ *          conversion of each such member.  Other conversions,
+ *          including those with a user-defined conversion function,
+ *          are always done in the calling thread.
+ *
+ *          When \p nthreads is greater than 1 and a transfer takes more
+ *          than one pass through the type conversion buffer, the
+ *          conversion of each pass also overlaps gathering the elements
+ *          of the next.
+ *
+ *          Threads are only used when the library is built thread-safe;
+ *          otherwise the property is accepted and conversion stays in the
+ *          calling thread.  The threads are started the first time a
+ *          conversion needs them and kept until the library is closed.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_type_conv_nthreads(hid_t plist_id, unsigned nthreads);
 
 /**
  * \ingroup DXPL
@@ -7894,6 +8164,46 @@ H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void
  */
 H5_DLL herr_t H5Pset_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t alloc_func, void *alloc_info,
                                       H5MM_free_t free_func, void *free_info);
+/**
+ *
+ * \ingroup DXPL
+ *
+ * \brief Sets an arena to receive the variable-length data read with H5Dread()
+ *
+ * \dxpl_id{plist_id}
+ * \param[in] arena Arena for the data of each read, or NULL
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_vlen_arena() makes H5Dread() place the data of all the
+ *          variable-length sequences and strings it reads in a single
+ *          block, described by \p arena, instead of allocating each one
+ *          separately with the routines set by H5Pset_vlen_mem_manager().
+ *          The pointers in the buffer read point into the block, and the
+ *          arena's offset array gives the offset of each sequence's or
+ *          string's data in the block, in the order they were converted.
+ *
+ *          The arena must be empty (zeroed, or freed by
+ *          H5Dvlen_arena_free()) when H5Dread() is called.  After the
+ *          read, the application owns the block: it must be freed with
+ *          H5Dvlen_arena_free(), all at once, and not with H5Treclaim()
+ *          or H5Dvlen_reclaim().  If the read fails, the arena stays
+ *          empty.
+ *
+ *          H5Dread_multi() places the data read for all of its datasets
+ *          in the one block, in the order the datasets are listed.
+ *
+ *          The block is filled in pieces that are never moved while the
+ *          read is in progress.  When there is more than one piece at the
+ *          end of the read, the data is moved into one block and the
+ *          pointers in the buffer read are adjusted to match.
+ *
+ *          Passing NULL for \p arena restores the normal allocation.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_vlen_arena(hid_t plist_id, H5D_vlen_arena_t *arena);
 
 #ifdef H5_HAVE_PARALLEL
 /**
@@ -159,20 +159,22 @@ H5SM__cache_table_get_initial_load_size(void *_udata, size_t *image_len)
  *-------------------------------------------------------------------------
  */
 htri_t
-H5SM__cache_table_verify_chksum(const void *_image, size_t len, void H5_ATTR_UNUSED *_udata)
+H5SM__cache_table_verify_chksum(const void *_image, size_t len, void *_udata)
 {
-    const uint8_t *image = (const uint8_t *)_image; /* Pointer into raw data buffer */
-    uint32_t       stored_chksum;                   /* Stored metadata checksum value */
-    uint32_t       computed_chksum;                 /* Computed metadata checksum value */
-    htri_t         ret_value = TRUE;                /* Return value */
+    const uint8_t *        image = (const uint8_t *)_image;         /* Pointer into raw data buffer */
+    H5SM_table_cache_ud_t *udata = (H5SM_table_cache_ud_t *)_udata; /* User data for callback */
+    uint32_t               stored_chksum;                           /* Stored metadata checksum value */
+    uint32_t               computed_chksum;                         /* Computed metadata checksum value */
+    htri_t                 ret_value = TRUE;                        /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
     HDassert(image);
+    HDassert(udata);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, len, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, len, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -406,7 +408,7 @@ H5SM__cache_table_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_NDEBUG_
     } /* end for */
 
     /* Compute checksum on buffer */
-    computed_chksum = H5_checksum_metadata(_image, (table->table_size - H5SM_SIZEOF_CHECKSUM), 0);
+    computed_chksum = H5F_checksum_metadata(f, _image, (table->table_size - H5SM_SIZEOF_CHECKSUM), 0);
     UINT32ENCODE(image, computed_chksum);
 
     /* sanity check */
@@ -524,7 +526,7 @@ H5SM__cache_list_verify_chksum(const void *_image, size_t H5_ATTR_UNUSED len, vo
     chk_size = H5SM_LIST_SIZE(udata->f, udata->header->num_messages);
 
     /* Get stored and computed checksums */
-    H5F_get_checksums(image, chk_size, &stored_chksum, &computed_chksum);
+    H5F_get_checksums(udata->f, image, chk_size, &stored_chksum, &computed_chksum);
 
     if (stored_chksum != computed_chksum)
         ret_value = FALSE;
@@ -706,7 +708,7 @@ H5SM__cache_list_serialize(const H5F_t *f, void *_image, size_t H5_ATTR_NDEBUG_U
     HDassert(mesgs_serialized == list->header->num_messages);
 
     /* Compute checksum on buffer */
-    computed_chksum = H5_checksum_metadata(_image, (size_t)(image - (uint8_t *)_image), 0);
+    computed_chksum = H5F_checksum_metadata(f, _image, (size_t)(image - (uint8_t *)_image), 0);
     UINT32ENCODE(image, computed_chksum);
 
     /* sanity check */
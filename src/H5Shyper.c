@@ -60,6 +60,14 @@
         (curr_span) = saved_next_span;                                                                       \
     } while (0)
 
+/* Initial number of slots in a table of shared span trees */
+#define H5S_HYPER_CONS_INIT_NSLOTS 64
+
+/* Size of the stack of finished span trees when building a span tree from
+ * blocks (each tree on the stack has at least twice as many blocks as the one
+ * above it, so this is enough for any number of blocks) */
+#define H5S_HYPER_BUILD_STACK_SIZE 64
+
 /* Macro to add "skipped" elements to projection during the execution of
  * H5S__hyper_project_intersect() */
 #define H5S_HYPER_PROJ_INT_ADD_SKIP(UDATA, ADD, ERR)                                                         \
@@ -99,6 +107,43 @@ typedef struct {
     hbool_t  share_selection; /* Whether span trees in dst_space can be shared with proj_space */
 } H5S_hyper_project_intersect_ud_t;
 
+/* Entry in a table of shared span trees */
+typedef struct {
+    uint64_t               hash;  /* Hash of the span tree's list of spans */
+    H5S_hyper_span_info_t *spans; /* Span tree */
+} H5S_hyper_cons_ent_t;
+
+/* Table of finished span trees, used to share ("hash-cons") identical 'down
+ * span' trees between spans while a span tree is built or merged.  Span
+ * trees are equal in the table when their spans have the same bounds and the
+ * same 'down span' pointers, so sharing bottom-up finds equal trees at every
+ * level.  The table holds a reference to each span tree in it.
+ */
+typedef struct {
+    size_t                nslots; /* Number of slots in the table (a power of two, or zero) */
+    size_t                nused;  /* Number of slots in use */
+    H5S_hyper_cons_ent_t *ent;    /* Slots in the table */
+} H5S_hyper_cons_t;
+
+/* Struct for holding the state of building a span tree from a list of
+ * blocks, with H5S__hyper_build_add().  Blocks which come after the blocks
+ * already added (in the order that they are iterated over) are appended to
+ * the span tree being built, and any other block starts a new span tree.
+ * Finished span trees are merged on a stack, keeping each tree at least twice
+ * the size of the one above it, so that unsorted blocks still cost only a
+ * logarithmic number of merges each.
+ */
+typedef struct {
+    unsigned               rank;               /* Rank of the span trees */
+    H5S_hyper_span_info_t *spans;              /* Span tree being appended to */
+    hsize_t                nblocks;            /* # of blocks in 'spans' */
+    H5S_hyper_span_t *     prev[H5S_MAX_RANK]; /* Span before the last span in each dimension, if known */
+    unsigned               nstack;             /* # of span trees on the stack */
+    H5S_hyper_span_info_t *stack[H5S_HYPER_BUILD_STACK_SIZE];         /* Finished span trees */
+    hsize_t                stack_nblocks[H5S_HYPER_BUILD_STACK_SIZE]; /* # of blocks in finished trees */
+    H5S_hyper_cons_t       cons;                                      /* Table of shared 'down span' trees */
+} H5S_hyper_build_t;
+
 /* Assert that H5S_MAX_RANK is <= 32 so our trick with using a 32 bit bitmap
  * (ps_clean_bitmap) works.  If H5S_MAX_RANK increases either increase the size
  * of ps_clean_bitmap or change the algorithm to use an array. */
@@ -129,6 +174,14 @@ static herr_t  H5S__hyper_append_span(H5S_hyper_span_info_t **span_tree, unsigne
 static herr_t  H5S__hyper_clip_spans(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_info_t *b_spans,
                                      unsigned selector, unsigned ndims, H5S_hyper_span_info_t **a_not_b,
                                      H5S_hyper_span_info_t **a_and_b, H5S_hyper_span_info_t **b_not_a);
+static uint64_t H5S__hyper_cons_hash(const H5S_hyper_span_info_t *spans);
+static hbool_t  H5S__hyper_cons_same(const H5S_hyper_span_info_t *spans1,
+                                     const H5S_hyper_span_info_t *spans2);
+static H5S_hyper_span_info_t *H5S__hyper_cons_span(H5S_hyper_cons_t *cons, H5S_hyper_span_info_t *spans);
+static void                   H5S__hyper_cons_free(H5S_hyper_cons_t *cons);
+static H5S_hyper_span_info_t *H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans,
+                                                            H5S_hyper_span_info_t *b_spans, unsigned ndims,
+                                                            H5S_hyper_cons_t *cons);
 static herr_t  H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans);
 static hsize_t H5S__hyper_spans_nelem_helper(H5S_hyper_span_info_t *spans, unsigned op_info_i,
                                              uint64_t op_gen);
@@ -137,6 +190,13 @@ static herr_t  H5S__hyper_add_disjoint_spans(H5S_t *space, H5S_hyper_span_info_t
 static H5S_hyper_span_info_t *H5S__hyper_make_spans(unsigned rank, const hsize_t *start,
                                                     const hsize_t *stride, const hsize_t *count,
                                                     const hsize_t *block);
+static herr_t H5S__hyper_build_seal(H5S_hyper_build_t *build, H5S_hyper_span_info_t *spans, unsigned depth);
+static htri_t H5S__hyper_build_append(H5S_hyper_build_t *build, H5S_hyper_span_info_t *spans, unsigned depth,
+                                      const hsize_t *start, const hsize_t *end, const hsize_t *block);
+static herr_t H5S__hyper_build_push(H5S_hyper_build_t *build);
+static herr_t H5S__hyper_build_add(H5S_hyper_build_t *build, const hsize_t *start, const hsize_t *end);
+static H5S_hyper_span_info_t *H5S__hyper_build_finish(H5S_hyper_build_t *build);
+static void                   H5S__hyper_build_release(H5S_hyper_build_t *build);
 static herr_t                 H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op,
                                                         const H5S_hyper_dim_t *new_hyper_diminfo);
 static herr_t                 H5S__hyper_generate_spans(H5S_t *space);
@@ -145,6 +205,8 @@ static hbool_t                H5S__check_spans_overlap(const H5S_hyper_span_info
 static herr_t  H5S__fill_in_new_space(H5S_t *space1, H5S_seloper_t op, H5S_hyper_span_info_t *space2_span_lst,
                                       hbool_t can_own_span2, hbool_t *span2_owned, hbool_t *updated_spans,
                                       H5S_t **result);
+static herr_t  H5S__select_hyper_spans(H5S_t *space, H5S_seloper_t op, H5S_hyper_span_info_t *new_spans);
+static htri_t  H5S__hyper_fixup_op(H5S_t *space, H5S_seloper_t *op);
 static herr_t  H5S__generate_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[],
                                        const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
 static herr_t  H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[], const hsize_t *app_stride,
@@ -3181,6 +3243,246 @@ H5S__hyper_free_span(H5S_hyper_span_t *span)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5S__hyper_free_span() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_cons_hash
+ PURPOSE
+    Compute the hash of a span tree, for a table of shared span trees
+ USAGE
+    uint64_t H5S__hyper_cons_hash(spans)
+        const H5S_hyper_span_info_t *spans;   IN: Span tree to hash
+ RETURNS
+    Hash of the span tree, can't fail
+ DESCRIPTION
+    Hashes the bounds and 'down span' pointers of the spans in the top list
+    of a span tree.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5_ATTR_PURE uint64_t
+H5S__hyper_cons_hash(const H5S_hyper_span_info_t *spans)
+{
+    const H5S_hyper_span_t *span;          /* Hyperslab span */
+    uint64_t                ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(spans);
+
+    for (span = spans->head; span != NULL; span = span->next) {
+        ret_value = (ret_value * 31) + span->low;
+        ret_value = (ret_value * 31) + span->high;
+        ret_value = (ret_value * 31) + (uint64_t)(uintptr_t)span->down;
+    } /* end for */
+
+    /* Mix the bits, so the low bits can be used to pick a slot */
+    ret_value ^= ret_value >> 33;
+    ret_value *= 0xff51afd7ed558ccdULL;
+    ret_value ^= ret_value >> 33;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_cons_hash() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_cons_same
+ PURPOSE
+    Check if two span trees can be shared in a table of shared span trees
+ USAGE
+    hbool_t H5S__hyper_cons_same(spans1, spans2)
+        const H5S_hyper_span_info_t *spans1;  IN: First span tree to compare
+        const H5S_hyper_span_info_t *spans2;  IN: Second span tree to compare
+ RETURNS
+    TRUE (1) or FALSE (0), can't fail
+ DESCRIPTION
+    Compare the top lists of two span trees, which are the same when their
+    spans have the same bounds and point to the same 'down span' trees.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Unlike H5S__hyper_cmp_spans(), this doesn't descend into the 'down span'
+    trees, which have already been shared if they are equal.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5_ATTR_PURE hbool_t
+H5S__hyper_cons_same(const H5S_hyper_span_info_t *spans1, const H5S_hyper_span_info_t *spans2)
+{
+    const H5S_hyper_span_t *span1;            /* Hyperslab span from first tree */
+    const H5S_hyper_span_t *span2;            /* Hyperslab span from second tree */
+    hbool_t                 ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(spans1);
+    HDassert(spans2);
+
+    for (span1 = spans1->head, span2 = spans2->head; span1 != NULL && span2 != NULL;
+         span1 = span1->next, span2 = span2->next)
+        if (span1->low != span2->low || span1->high != span2->high || span1->down != span2->down)
+            HGOTO_DONE(FALSE)
+
+    /* Check that both lists ended */
+    if (span1 != NULL || span2 != NULL)
+        ret_value = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_cons_same() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_cons_span
+ PURPOSE
+    Share a finished span tree with an identical one, through a table of
+    shared span trees
+ USAGE
+    H5S_hyper_span_info_t *H5S__hyper_cons_span(cons, spans)
+        H5S_hyper_cons_t *cons;         IN/OUT: Table of shared span trees
+        H5S_hyper_span_info_t *spans;   IN: Span tree to share
+ RETURNS
+    Pointer to the span tree to use instead of SPANS on success, NULL on
+    failure
+ DESCRIPTION
+    Looks for a span tree identical to SPANS in the table, returning it
+    (with its reference count incremented) if there is one and releasing
+    SPANS, otherwise adds SPANS to the table and returns it.  The caller's
+    reference to SPANS is taken over, even on failure.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Span trees in the table must not be changed in place, and should only be
+    shared between the spans of one selection.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S__hyper_cons_span(H5S_hyper_cons_t *cons, H5S_hyper_span_info_t *spans)
+{
+    uint64_t               hash;             /* Hash of the span tree */
+    size_t                 mask;             /* Mask for slot numbers */
+    size_t                 slot;             /* Slot in the table */
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cons);
+    HDassert(spans);
+
+    /* Make room in the table when it gets half full */
+    if (cons->nused >= cons->nslots / 2) {
+        H5S_hyper_cons_ent_t *new_ent;    /* New slots */
+        size_t                new_nslots; /* New number of slots */
+        size_t                nlive = 0;  /* Number of span trees still in use */
+        size_t                u;          /* Local index variable */
+
+        /* Count the span trees that are used by something besides the table */
+        for (u = 0; u < cons->nslots; u++)
+            if (cons->ent[u].spans && cons->ent[u].spans->count > 1)
+                nlive++;
+
+        /* Grow the table, unless releasing span trees frees enough slots */
+        if (0 == cons->nslots)
+            new_nslots = H5S_HYPER_CONS_INIT_NSLOTS;
+        else if (nlive >= cons->nslots / 4)
+            new_nslots = cons->nslots * 2;
+        else
+            new_nslots = cons->nslots;
+        if (NULL ==
+            (new_ent = (H5S_hyper_cons_ent_t *)H5MM_calloc(new_nslots * sizeof(H5S_hyper_cons_ent_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate table of shared span trees")
+
+        /* Move the span trees in use to the new slots, releasing the others */
+        mask        = new_nslots - 1;
+        cons->nused = 0;
+        for (u = 0; u < cons->nslots; u++)
+            if (cons->ent[u].spans) {
+                if (cons->ent[u].spans->count > 1) {
+                    for (slot = (size_t)cons->ent[u].hash & mask; new_ent[slot].spans;
+                         slot = (slot + 1) & mask)
+                        ;
+                    new_ent[slot] = cons->ent[u];
+                    cons->nused++;
+                } /* end if */
+                else
+                    H5S__hyper_free_span_info(cons->ent[u].spans);
+            } /* end if */
+        H5MM_xfree(cons->ent);
+        cons->ent    = new_ent;
+        cons->nslots = new_nslots;
+    } /* end if */
+
+    /* Look for an identical span tree */
+    hash = H5S__hyper_cons_hash(spans);
+    mask = cons->nslots - 1;
+    for (slot = (size_t)hash & mask; cons->ent[slot].spans; slot = (slot + 1) & mask)
+        if (cons->ent[slot].hash == hash && H5S__hyper_cons_same(cons->ent[slot].spans, spans)) {
+            ret_value = cons->ent[slot].spans;
+            break;
+        } /* end if */
+
+    if (ret_value) {
+        /* Use the span tree from the table instead */
+        ret_value->count++;
+        H5S__hyper_free_span_info(spans);
+    } /* end if */
+    else {
+        /* Add the span tree to the table */
+        cons->ent[slot].hash  = hash;
+        cons->ent[slot].spans = spans;
+        cons->nused++;
+        spans->count++;
+        ret_value = spans;
+    } /* end else */
+
+done:
+    /* Release the caller's span tree on failure */
+    if (NULL == ret_value)
+        H5S__hyper_free_span_info(spans);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_cons_span() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_cons_free
+ PURPOSE
+    Release a table of shared span trees
+ USAGE
+    void H5S__hyper_cons_free(cons)
+        H5S_hyper_cons_t *cons;         IN/OUT: Table of shared span trees
+ RETURNS
+    None
+ DESCRIPTION
+    Releases the table's references to the span trees in it, and the table.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5S__hyper_cons_free(H5S_hyper_cons_t *cons)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(cons);
+
+    for (u = 0; u < cons->nslots; u++)
+        if (cons->ent[u].spans)
+            H5S__hyper_free_span_info(cons->ent[u].spans);
+    cons->ent    = (H5S_hyper_cons_ent_t *)H5MM_xfree(cons->ent);
+    cons->nslots = 0;
+    cons->nused  = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_cons_free() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_copy
@@ -4228,6 +4530,7 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
     hsize_t        dims[H5S_MAX_RANK];  /* Dimenion sizes */
     hsize_t        start[H5S_MAX_RANK]; /* hyperslab start information */
     hsize_t        block[H5S_MAX_RANK]; /* hyperslab block information */
+    H5S_hyper_build_t build;            /* State of span tree being built */
     uint32_t       version;             /* Version number */
     uint8_t        flags    = 0;        /* Flags */
     uint8_t        enc_size = 0;        /* Encoded size of selection info */
@@ -4238,6 +4541,9 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
 
     FUNC_ENTER_STATIC
 
+    /* Initialize the span tree building state (before anything can fail) */
+    HDmemset(&build, 0, sizeof(build));
+
     /* Check args */
     HDassert(p);
     pp = (*p);
@@ -4368,14 +4674,12 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
     } /* end if */
     else {
-        const hsize_t *stride;            /* Hyperslab stride information */
-        const hsize_t *count;             /* Hyperslab count information */
-        hsize_t        end[H5S_MAX_RANK]; /* Hyperslab end information */
-        hsize_t *      tstart;            /* Temporary hyperslab pointers */
-        hsize_t *      tend;              /* Temporary hyperslab pointers */
-        hsize_t *      tblock;            /* Temporary hyperslab pointers */
-        size_t         num_elem;          /* Number of elements in selection */
-        unsigned       v;                 /* Local counting variable */
+        H5S_hyper_span_info_t *spans = NULL;      /* Span tree for the blocks */
+        hsize_t                end[H5S_MAX_RANK]; /* Hyperslab end information */
+        hsize_t *              tstart;            /* Temporary hyperslab pointers */
+        hsize_t *              tend;              /* Temporary hyperslab pointers */
+        size_t                 num_elem;          /* Number of elements in selection */
+        unsigned               v;                 /* Local counting variable */
 
         /* Decode the number of blocks */
         switch (enc_size) {
@@ -4396,8 +4700,8 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
                 break;
         } /* end switch */
 
-        /* Set the count & stride for all blocks */
-        stride = count = H5S_hyper_ones_g;
+        /* Set up to build the span tree for the blocks */
+        build.rank = rank;
 
         /* Retrieve the coordinates from the buffer */
         for (u = 0; u < num_elem; u++) {
@@ -4430,16 +4734,24 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
                     break;
             } /* end switch */
 
-            /* Change the ending points into blocks */
-            for (tblock = block, tstart = start, tend = end, v = 0; v < rank; v++, tstart++, tend++, tblock++)
-                *tblock = (*tend - *tstart) + 1;
+            /* Check the block */
+            for (v = 0; v < rank; v++)
+                if (start[v] > end[v])
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "invalid hyperslab block")
 
-            /* Select or add the hyperslab to the current selection */
-            if ((ret_value = H5S_select_hyperslab(tmp_space, (u == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), start,
-                                                  stride, count, block)) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
+            /* Add the block to the span tree */
+            /* (Blocks are serialized in order, so each one is appended to the tree) */
+            if (H5S__hyper_build_add(&build, start, end) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't add hyperslab block")
         } /* end for */
-    }     /* end else */
+        if (num_elem > 0)
+            if (NULL == (spans = H5S__hyper_build_finish(&build)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't build hyperslab spans")
+
+        /* Set the selection to the blocks */
+        if ((ret_value = H5S__select_hyper_spans(tmp_space, H5S_SELECT_SET, spans)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't change selection")
+    } /* end else */
 
     /* Update decoding pointer */
     *p = pp;
@@ -4449,6 +4761,9 @@ H5S__hyper_deserialize(H5S_t **space, const uint8_t **p)
         *space = tmp_space;
 
 done:
+    /* Release the span tree being built (only happens on error) */
+    H5S__hyper_build_release(&build);
+
     /* Free temporary space if not passed to caller (only happens on error) */
     if (!*space && tmp_space)
         if (H5S_close(tmp_space) < 0)
@@ -7958,17 +8273,19 @@ done:
  PURPOSE
     Merge two hyperslab span tree together
  USAGE
-    H5S_hyper_span_info_t *H5S__hyper_merge_spans_helper(a_spans, b_spans)
+    H5S_hyper_span_info_t *H5S__hyper_merge_spans_helper(a_spans, b_spans, ndims, cons)
         H5S_hyper_span_info_t *a_spans; IN: First hyperslab spans to merge
                                                 together
         H5S_hyper_span_info_t *b_spans; IN: Second hyperslab spans to merge
                                                 together
         unsigned ndims;                 IN: Number of dimensions of this span tree
+        H5S_hyper_cons_t *cons;         IN/OUT: Table of shared span trees, or NULL
  RETURNS
     Pointer to span tree containing the merged spans on success, NULL on failure
  DESCRIPTION
     Merge two sets of hyperslab spans together and return the span tree from
-    the merged set.
+    the merged set.  If CONS is given, the merged 'down span' trees are shared
+    with identical trees already in the table.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     Handles merging span trees that overlap.
@@ -7976,7 +8293,8 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 static H5S_hyper_span_info_t *
-H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_info_t *b_spans, unsigned ndims)
+H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_info_t *b_spans, unsigned ndims,
+                              H5S_hyper_cons_t *cons)
 {
     H5S_hyper_span_info_t *merged_spans = NULL; /* Pointer to the merged span tree */
     H5S_hyper_span_info_t *ret_value    = NULL; /* Return value */
@@ -7991,9 +8309,11 @@ H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_inf
         if (a_spans == NULL)
             merged_spans = NULL;
         else {
-            /* Copy one of the span trees to return */
-            if (NULL == (merged_spans = H5S__hyper_copy_span(a_spans, ndims)))
-                HGOTO_ERROR(H5E_INTERNAL, H5E_CANTCOPY, NULL, "can't copy hyperslab span tree")
+            /* Share one of the span trees to return */
+            /* (The merged span tree is never modified in place, so it doesn't
+             *  need to be a copy) */
+            merged_spans = a_spans;
+            merged_spans->count++;
         } /* end else */
     }     /* end if */
     else {
@@ -8046,7 +8366,13 @@ H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_inf
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
 
                     /* Get merged span tree for overlapped section */
-                    tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down, ndims - 1);
+                    if (NULL == (tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down,
+                                                                           ndims - 1, cons)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+
+                    /* Share the merged span tree with an identical one, if there is one */
+                    if (cons && NULL == (tmp_spans = H5S__hyper_cons_span(cons, tmp_spans)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't share hyperslab spans")
 
                     /* Merge/add overlapped section to merged spans */
                     if (H5S__hyper_append_span(&merged_spans, ndims, span_b->low, span_a->high, tmp_spans) <
@@ -8099,7 +8425,13 @@ H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_inf
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span")
 
                     /* Get merged span tree for overlapped section */
-                    tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down, ndims - 1);
+                    if (NULL == (tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down,
+                                                                           ndims - 1, cons)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+
+                    /* Share the merged span tree with an identical one, if there is one */
+                    if (cons && NULL == (tmp_spans = H5S__hyper_cons_span(cons, tmp_spans)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't share hyperslab spans")
 
                     /* Merge/add overlapped section to merged spans */
                     if (H5S__hyper_append_span(&merged_spans, ndims, span_b->low, span_b->high, tmp_spans) <
@@ -8149,7 +8481,13 @@ H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_inf
                     } /* end else */
 
                     /* Get merged span tree for overlapped section */
-                    tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down, ndims - 1);
+                    if (NULL == (tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down,
+                                                                           ndims - 1, cons)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+
+                    /* Share the merged span tree with an identical one, if there is one */
+                    if (cons && NULL == (tmp_spans = H5S__hyper_cons_span(cons, tmp_spans)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't share hyperslab spans")
 
                     /* Merge/add overlapped section to merged spans */
                     if (H5S__hyper_append_span(&merged_spans, ndims, span_a->low, span_a->high, tmp_spans) <
@@ -8209,7 +8547,13 @@ H5S__hyper_merge_spans_helper(H5S_hyper_span_info_t *a_spans, H5S_hyper_span_inf
                     } /* end else */
 
                     /* Get merged span tree for overlapped section */
-                    tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down, ndims - 1);
+                    if (NULL == (tmp_spans = H5S__hyper_merge_spans_helper(span_a->down, span_b->down,
+                                                                           ndims - 1, cons)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+
+                    /* Share the merged span tree with an identical one, if there is one */
+                    if (cons && NULL == (tmp_spans = H5S__hyper_cons_span(cons, tmp_spans)))
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't share hyperslab spans")
 
                     /* Merge/add overlapped section to merged spans */
                     if (H5S__hyper_append_span(&merged_spans, ndims, span_a->low, span_b->high, tmp_spans) <
@@ -8307,7 +8651,8 @@ done:
 static herr_t
 H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5S_hyper_cons_t cons      = {0, 0, NULL}; /* Table of shared span trees */
+    herr_t           ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -8324,8 +8669,9 @@ H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans)
         H5S_hyper_span_info_t *merged_spans;
 
         /* Get the merged spans */
+        /* (Sharing identical 'down span' trees in the merged span tree) */
         if (NULL == (merged_spans = H5S__hyper_merge_spans_helper(space->select.sel_info.hslab->span_lst,
-                                                                  new_spans, space->extent.rank)))
+                                                                  new_spans, space->extent.rank, &cons)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, FAIL, "can't merge hyperslab spans")
 
         /* Free the previous spans */
@@ -8336,6 +8682,9 @@ H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans)
     } /* end else */
 
 done:
+    /* Release the table of shared span trees */
+    H5S__hyper_cons_free(&cons);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_merge_spans() */
 
@@ -8649,130 +8998,519 @@ done:
 
 /*--------------------------------------------------------------------------
  NAME
-    H5S__hyper_update_diminfo
+    H5S__hyper_build_seal
  PURPOSE
-    Attempt to update optimized hyperslab information quickly.  (It can be
-    recovered with regular selection).  If this algorithm cannot determine
-    the optimized dimension info quickly, this function will simply mark it
-    as invalid and unknown if it can be built (H5S_DIMINFO_VALID_NO), so
-    H5S__hyper_rebuild can be run later to determine for sure.
+    Finish the last span of a span list, while building a span tree from
+    blocks
  USAGE
-    herr_t H5S__hyper_update_diminfo(space, op, new_hyper_diminfo)
-        H5S_t *space;       IN: Dataspace to check
-        H5S_seloper_t op;   IN: The operation being performed on the
-                                selection
-        const H5S_hyper_dim_t new_hyper_diminfo; IN: The new selection that
-                                                     is being combined with
-                                                     the current
+    herr_t H5S__hyper_build_seal(build, spans, depth)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+        H5S_hyper_span_info_t *spans;   IN/OUT: Span list to finish
+        unsigned depth;                 IN: Dimension of the span list
  RETURNS
-    >=0 on success, <0 on failure
+    Non-negative on success, negative on failure
  DESCRIPTION
-    Examine the span tree for a hyperslab selection and rebuild
-    the start/stride/count/block information for the selection, if possible.
-
+    Finishes the last span in the dimension below first, then shares the
+    last span's 'down span' tree with an identical one already built, if
+    there is one.  The last span is then merged into the span before it, if
+    they are next to each other and select the same elements below.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
+    Blocks can't be added to a span after it is finished.
  EXAMPLES
  REVISION LOG
 --------------------------------------------------------------------------*/
 static herr_t
-H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op, const H5S_hyper_dim_t *new_hyper_diminfo)
+H5S__hyper_build_seal(H5S_hyper_build_t *build, H5S_hyper_span_info_t *spans, unsigned depth)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5S_hyper_span_t *tail;                /* Last span in the list */
+    H5S_hyper_span_t *prev;                /* Span before the last span */
+    herr_t            ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
-    /* Check args */
-    HDassert(space);
-    HDassert(new_hyper_diminfo);
+    /* Sanity checks */
+    HDassert(build);
+    HDassert(spans);
+    HDassert(depth < build->rank);
 
-    /* Check for conditions that prevent us from using the fast algorithm here */
-    /* (and instead require H5S__hyper_rebuild) */
-    if (!((op == H5S_SELECT_OR) || (op == H5S_SELECT_XOR)) ||
-        space->select.sel_info.hslab->diminfo_valid != H5S_DIMINFO_VALID_YES ||
-        !space->select.sel_info.hslab->span_lst->head)
-        space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
-    else {
-        H5S_hyper_dim_t tmp_diminfo[H5S_MAX_RANK]; /* Temporary dimension info */
-        hbool_t         found_nonidentical_dim = FALSE;
-        unsigned        curr_dim;
+    tail = spans->tail;
+    prev = build->prev[depth];
+    HDassert(NULL == prev || prev->next == tail);
 
-        /* Copy current diminfo.opt values */
-        H5MM_memcpy(tmp_diminfo, space->select.sel_info.hslab->diminfo.opt, sizeof(tmp_diminfo));
+    if (tail->down) {
+        /* Finish the dimension below */
+        if (H5S__hyper_build_seal(build, tail->down, depth + 1) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't finish hyperslab spans")
 
-        /* Loop over dimensions */
-        for (curr_dim = 0; curr_dim < space->extent.rank; curr_dim++) {
-            /* Check for this being identical */
-            if ((tmp_diminfo[curr_dim].start != new_hyper_diminfo[curr_dim].start) ||
-                (tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride) ||
-                (tmp_diminfo[curr_dim].count != new_hyper_diminfo[curr_dim].count) ||
-                (tmp_diminfo[curr_dim].block != new_hyper_diminfo[curr_dim].block)) {
-                hsize_t high_start, high_count,
-                    high_block; /* The start, count & block values for the higher block */
+        /* Share the 'down span' tree */
+        if (NULL == (tail->down = H5S__hyper_cons_span(&build->cons, tail->down)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't share hyperslab spans")
+    } /* end if */
 
-                /* Dimension is not identical */
-                /* Check if we already found a nonidentical dim - only one is
-                 * allowed */
-                if (found_nonidentical_dim) {
-                    space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
-                    break;
-                } /* end if */
+    /* Merge the last span into the span before it, if possible */
+    /* (Shared 'down span' trees are equal if and only if they are the same tree) */
+    if (prev && (prev->high + 1) == tail->low && prev->down == tail->down) {
+        prev->high  = tail->high;
+        prev->next  = NULL;
+        spans->tail = prev;
+        H5S__hyper_free_span(tail);
 
-                /* Check that strides are the same, or count is 1 for one of the
-                 * slabs */
-                if ((tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride) &&
-                    (tmp_diminfo[curr_dim].count > 1) && (new_hyper_diminfo[curr_dim].count > 1)) {
-                    space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
-                    break;
-                } /* end if */
+        /* The span before the (new) last span isn't known */
+        build->prev[depth] = NULL;
+    } /* end if */
 
-                /* Patch tmp_diminfo.stride if its count is 1 */
-                if ((tmp_diminfo[curr_dim].count == 1) && (new_hyper_diminfo[curr_dim].count > 1))
-                    tmp_diminfo[curr_dim].stride = new_hyper_diminfo[curr_dim].stride;
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_seal() */
 
-                /* Determine lowest start, and set tmp_diminfo.start, count and
-                 *  block to use the lowest, and high_start, high_count and
-                 *  high_block to use the highest
-                 */
-                if (tmp_diminfo[curr_dim].start < new_hyper_diminfo[curr_dim].start) {
-                    high_start = new_hyper_diminfo[curr_dim].start;
-                    high_count = new_hyper_diminfo[curr_dim].count;
-                    high_block = new_hyper_diminfo[curr_dim].block;
-                } /* end if */
-                else {
-                    high_start                  = tmp_diminfo[curr_dim].start;
-                    tmp_diminfo[curr_dim].start = new_hyper_diminfo[curr_dim].start;
-                    high_count                  = tmp_diminfo[curr_dim].count;
-                    tmp_diminfo[curr_dim].count = new_hyper_diminfo[curr_dim].count;
-                    high_block                  = tmp_diminfo[curr_dim].block;
-                    tmp_diminfo[curr_dim].block = new_hyper_diminfo[curr_dim].block;
-                } /* end else */
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_build_append
+ PURPOSE
+    Append a block to the end of a span tree being built
+ USAGE
+    htri_t H5S__hyper_build_append(build, spans, depth, start, end, block)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+        H5S_hyper_span_info_t *spans;   IN/OUT: Span list to append to
+        unsigned depth;                 IN: Dimension of the span list
+        const hsize_t *start;           IN: Starting coordinates of block, from DEPTH
+        const hsize_t *end;             IN: Ending coordinates of block, from DEPTH
+        const hsize_t *block;           IN: Size of block, from DEPTH
+ RETURNS
+    TRUE if the block was appended, FALSE if it doesn't come after the span
+    tree, negative on failure
+ DESCRIPTION
+    Appends a block which starts after the last span of the list in this
+    dimension as a new span, or one which covers the same range as the last
+    span in this dimension to the span list below that span.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The span tree is unchanged when FALSE is returned.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static htri_t
+H5S__hyper_build_append(H5S_hyper_build_t *build, H5S_hyper_span_info_t *spans, unsigned depth,
+                        const hsize_t *start, const hsize_t *end, const hsize_t *block)
+{
+    unsigned               ndims    = build->rank - depth; /* # of dimensions in span list */
+    H5S_hyper_span_t *     tail     = spans->tail;         /* Last span in the list */
+    H5S_hyper_span_info_t *down     = NULL;                /* Span tree for the block, below this dimension */
+    H5S_hyper_span_t *     new_span = NULL;                /* New span for the block */
+    unsigned               u;                              /* Local index variable */
+    htri_t                 ret_value = TRUE;               /* Return value */
 
-                /* If count is 1 for both slabs, take different actions */
-                if ((tmp_diminfo[curr_dim].count == 1) && (high_count == 1)) {
-                    /* Check for overlap */
-                    if ((tmp_diminfo[curr_dim].start + tmp_diminfo[curr_dim].block) > high_start) {
-                        /* Check operation type */
-                        if (op == H5S_SELECT_OR)
-                            /* Merge blocks */
-                            tmp_diminfo[curr_dim].block =
-                                ((high_start + high_block) >=
-                                 (tmp_diminfo[curr_dim].start + tmp_diminfo[curr_dim].block))
-                                    ? (high_start + high_block - tmp_diminfo[curr_dim].start)
-                                    : tmp_diminfo[curr_dim].block;
-                        else {
-                            /* Block values must be the same */
-                            if (tmp_diminfo[curr_dim].block != high_block) {
-                                space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
-                                break;
-                            } /* end if */
+    FUNC_ENTER_STATIC
 
-                            /* XOR - overlap creates 2 blocks */
-                            tmp_diminfo[curr_dim].stride = high_block;
-                            tmp_diminfo[curr_dim].count  = 2;
-                            tmp_diminfo[curr_dim].block  = high_start - tmp_diminfo[curr_dim].start;
-                        } /* end else */
-                    }     /* end if */
+    /* Check if the block starts after the last span */
+    if (start[0] > tail->high) {
+        /* Finish the last span, since nothing more can be added to it */
+        if (H5S__hyper_build_seal(build, spans, depth) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't finish hyperslab spans")
+
+        /* Make the spans for the block in the lower dimensions */
+        if (ndims > 1)
+            if (NULL == (down = H5S__hyper_make_spans(ndims - 1, &start[1], H5S_hyper_ones_g,
+                                                      H5S_hyper_ones_g, &block[1])))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab spans")
+
+        /* Append a new span (which takes its own reference to the 'down span' tree) */
+        if (NULL == (new_span = H5S__hyper_new_span(start[0], end[0], down, NULL)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab span")
+        build->prev[depth]    = spans->tail;
+        spans->tail->next     = new_span;
+        spans->tail           = new_span;
+        spans->high_bounds[0] = end[0];
+
+        /* Any lower dimensions start new span lists */
+        for (u = depth + 1; u < build->rank; u++)
+            build->prev[u] = NULL;
+    } /* end if */
+    /* Check if the block covers the same range as the last span */
+    else if (ndims > 1 && start[0] == tail->low && end[0] == tail->high) {
+        /* Append to the span list below the last span */
+        if ((ret_value = H5S__hyper_build_append(build, tail->down, depth + 1, &start[1], &end[1],
+                                                 &block[1])) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append block to hyperslab spans")
+        if (!ret_value)
+            HGOTO_DONE(FALSE)
+    } /* end if */
+    else
+        HGOTO_DONE(FALSE)
+
+    /* Update the bounds in the lower dimensions */
+    for (u = 1; u < ndims; u++) {
+        if (start[u] < spans->low_bounds[u])
+            spans->low_bounds[u] = start[u];
+        if (end[u] > spans->high_bounds[u])
+            spans->high_bounds[u] = end[u];
+    } /* end for */
+
+done:
+    /* Release the span list's reference to the 'down span' tree */
+    if (down)
+        H5S__hyper_free_span_info(down);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_append() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_build_push
+ PURPOSE
+    Finish the span tree being built from blocks and push it on the stack
+ USAGE
+    herr_t H5S__hyper_build_push(build)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Finishes the span tree being appended to and pushes it on the stack of
+    finished span trees, first merging it with the trees on the top of the
+    stack that have less than twice as many blocks.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_build_push(H5S_hyper_build_t *build)
+{
+    H5S_hyper_span_info_t *spans;               /* Finished span tree */
+    hsize_t                nblocks;             /* # of blocks in finished span tree */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(build);
+
+    if (build->spans) {
+        /* Finish the span tree */
+        if (H5S__hyper_build_seal(build, build->spans, 0) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't finish hyperslab spans")
+        spans          = build->spans;
+        nblocks        = build->nblocks;
+        build->spans   = NULL;
+        build->nblocks = 0;
+
+        /* Merge with the trees on the stack that aren't much bigger */
+        while (build->nstack > 0 && build->stack_nblocks[build->nstack - 1] < 2 * nblocks) {
+            H5S_hyper_span_info_t *merged_spans; /* Merged span tree */
+
+            build->nstack--;
+            merged_spans = H5S__hyper_merge_spans_helper(build->stack[build->nstack], spans, build->rank,
+                                                         &build->cons);
+            H5S__hyper_free_span_info(build->stack[build->nstack]);
+            H5S__hyper_free_span_info(spans);
+            if (NULL == merged_spans)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, FAIL, "can't merge hyperslab spans")
+            spans = merged_spans;
+            nblocks += build->stack_nblocks[build->nstack];
+        } /* end while */
+
+        /* Push the span tree on the stack */
+        HDassert(build->nstack < H5S_HYPER_BUILD_STACK_SIZE);
+        build->stack[build->nstack]         = spans;
+        build->stack_nblocks[build->nstack] = nblocks;
+        build->nstack++;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_push() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_build_add
+ PURPOSE
+    Add a block to a span tree being built
+ USAGE
+    herr_t H5S__hyper_build_add(build, start, end)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+        const hsize_t *start;           IN: Starting coordinates of block
+        const hsize_t *end;             IN: Ending coordinates of block
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Adds a block to the span tree being built from a list of blocks.  Blocks
+    may overlap and be in any order, but are added in constant time when
+    each block comes after the blocks before it in the order the selection
+    is iterated over (for example, when sorted by their starting coordinates
+    and not overlapping), or covers the same range in the slower changing
+    dimensions as the block before it.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_build_add(H5S_hyper_build_t *build, const hsize_t *start, const hsize_t *end)
+{
+    hsize_t  block[H5S_MAX_RANK]; /* Size of block */
+    htri_t   appended = FALSE;    /* Whether the block was appended to the span tree */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(build);
+    HDassert(start);
+    HDassert(end);
+
+    for (u = 0; u < build->rank; u++) {
+        HDassert(start[u] <= end[u]);
+        block[u] = (end[u] - start[u]) + 1;
+    } /* end for */
+
+    /* Try appending the block to the span tree being built */
+    if (build->spans)
+        if ((appended = H5S__hyper_build_append(build, build->spans, 0, start, end, block)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, FAIL, "can't append block to hyperslab spans")
+
+    /* Start a new span tree with the block if it couldn't be appended */
+    if (!appended) {
+        if (H5S__hyper_build_push(build) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, FAIL, "can't merge hyperslab spans")
+        if (NULL == (build->spans = H5S__hyper_make_spans(build->rank, start, H5S_hyper_ones_g,
+                                                          H5S_hyper_ones_g, block)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab spans")
+        for (u = 0; u < build->rank; u++)
+            build->prev[u] = NULL;
+    } /* end if */
+    build->nblocks++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_add() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_build_finish
+ PURPOSE
+    Finish building a span tree from blocks
+ USAGE
+    H5S_hyper_span_info_t *H5S__hyper_build_finish(build)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+ RETURNS
+    Pointer to the span tree on success, NULL on failure
+ DESCRIPTION
+    Merges all the span trees built into one, and releases the state of
+    building the span tree.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    At least one block must have been added.  H5S__hyper_build_release()
+    must still be called if this fails.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5S_hyper_span_info_t *
+H5S__hyper_build_finish(H5S_hyper_build_t *build)
+{
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(build);
+    HDassert(build->spans || build->nstack > 0);
+
+    /* Finish the span tree being appended to */
+    if (H5S__hyper_build_push(build) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+
+    /* Merge the finished span trees, from the top of the stack */
+    while (build->nstack > 1) {
+        H5S_hyper_span_info_t *merged_spans; /* Merged span tree */
+
+        build->nstack--;
+        merged_spans = H5S__hyper_merge_spans_helper(build->stack[build->nstack - 1],
+                                                     build->stack[build->nstack], build->rank, &build->cons);
+        H5S__hyper_free_span_info(build->stack[build->nstack]);
+        if (NULL == merged_spans)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTMERGE, NULL, "can't merge hyperslab spans")
+        H5S__hyper_free_span_info(build->stack[build->nstack - 1]);
+        build->stack[build->nstack - 1] = merged_spans;
+    } /* end while */
+
+    /* Take the span tree */
+    HDassert(build->nstack == 1);
+    ret_value     = build->stack[0];
+    build->nstack = 0;
+
+    /* Release the table of shared span trees */
+    H5S__hyper_cons_free(&build->cons);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_build_finish() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_build_release
+ PURPOSE
+    Release the state of building a span tree from blocks
+ USAGE
+    void H5S__hyper_build_release(build)
+        H5S_hyper_build_t *build;       IN/OUT: State of span tree being built
+ RETURNS
+    None
+ DESCRIPTION
+    Releases the span trees that are being built, after a failure.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static void
+H5S__hyper_build_release(H5S_hyper_build_t *build)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(build);
+
+    if (build->spans) {
+        H5S__hyper_free_span_info(build->spans);
+        build->spans = NULL;
+    } /* end if */
+    while (build->nstack > 0) {
+        build->nstack--;
+        H5S__hyper_free_span_info(build->stack[build->nstack]);
+    } /* end while */
+    H5S__hyper_cons_free(&build->cons);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5S__hyper_build_release() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_update_diminfo
+ PURPOSE
+    Attempt to update optimized hyperslab information quickly.  (It can be
+    recovered with regular selection).  If this algorithm cannot determine
+    the optimized dimension info quickly, this function will simply mark it
+    as invalid and unknown if it can be built (H5S_DIMINFO_VALID_NO), so
+    H5S__hyper_rebuild can be run later to determine for sure.
+ USAGE
+    herr_t H5S__hyper_update_diminfo(space, op, new_hyper_diminfo)
+        H5S_t *space;       IN: Dataspace to check
+        H5S_seloper_t op;   IN: The operation being performed on the
+                                selection
+        const H5S_hyper_dim_t new_hyper_diminfo; IN: The new selection that
+                                                     is being combined with
+                                                     the current
+ RETURNS
+    >=0 on success, <0 on failure
+ DESCRIPTION
+    Examine the span tree for a hyperslab selection and rebuild
+    the start/stride/count/block information for the selection, if possible.
+
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__hyper_update_diminfo(H5S_t *space, H5S_seloper_t op, const H5S_hyper_dim_t *new_hyper_diminfo)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(space);
+    HDassert(new_hyper_diminfo);
+
+    /* Check for conditions that prevent us from using the fast algorithm here */
+    /* (and instead require H5S__hyper_rebuild) */
+    if (!((op == H5S_SELECT_OR) || (op == H5S_SELECT_XOR)) ||
+        space->select.sel_info.hslab->diminfo_valid != H5S_DIMINFO_VALID_YES ||
+        !space->select.sel_info.hslab->span_lst->head)
+        space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+    else {
+        H5S_hyper_dim_t tmp_diminfo[H5S_MAX_RANK]; /* Temporary dimension info */
+        hbool_t         found_nonidentical_dim = FALSE;
+        unsigned        curr_dim;
+
+        /* Copy current diminfo.opt values */
+        H5MM_memcpy(tmp_diminfo, space->select.sel_info.hslab->diminfo.opt, sizeof(tmp_diminfo));
+
+        /* Loop over dimensions */
+        for (curr_dim = 0; curr_dim < space->extent.rank; curr_dim++) {
+            /* Check for this being identical */
+            if ((tmp_diminfo[curr_dim].start != new_hyper_diminfo[curr_dim].start) ||
+                (tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride) ||
+                (tmp_diminfo[curr_dim].count != new_hyper_diminfo[curr_dim].count) ||
+                (tmp_diminfo[curr_dim].block != new_hyper_diminfo[curr_dim].block)) {
+                hsize_t high_start, high_count,
+                    high_block; /* The start, count & block values for the higher block */
+
+                /* Dimension is not identical */
+                /* Check if we already found a nonidentical dim - only one is
+                 * allowed */
+                if (found_nonidentical_dim) {
+                    space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+                    break;
+                } /* end if */
+
+                /* Check that strides are the same, or count is 1 for one of the
+                 * slabs */
+                if ((tmp_diminfo[curr_dim].stride != new_hyper_diminfo[curr_dim].stride) &&
+                    (tmp_diminfo[curr_dim].count > 1) && (new_hyper_diminfo[curr_dim].count > 1)) {
+                    space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+                    break;
+                } /* end if */
+
+                /* Patch tmp_diminfo.stride if its count is 1 */
+                if ((tmp_diminfo[curr_dim].count == 1) && (new_hyper_diminfo[curr_dim].count > 1))
+                    tmp_diminfo[curr_dim].stride = new_hyper_diminfo[curr_dim].stride;
+
+                /* Determine lowest start, and set tmp_diminfo.start, count and
+                 *  block to use the lowest, and high_start, high_count and
+                 *  high_block to use the highest
+                 */
+                if (tmp_diminfo[curr_dim].start < new_hyper_diminfo[curr_dim].start) {
+                    high_start = new_hyper_diminfo[curr_dim].start;
+                    high_count = new_hyper_diminfo[curr_dim].count;
+                    high_block = new_hyper_diminfo[curr_dim].block;
+                } /* end if */
+                else {
+                    high_start                  = tmp_diminfo[curr_dim].start;
+                    tmp_diminfo[curr_dim].start = new_hyper_diminfo[curr_dim].start;
+                    high_count                  = tmp_diminfo[curr_dim].count;
+                    tmp_diminfo[curr_dim].count = new_hyper_diminfo[curr_dim].count;
+                    high_block                  = tmp_diminfo[curr_dim].block;
+                    tmp_diminfo[curr_dim].block = new_hyper_diminfo[curr_dim].block;
+                } /* end else */
+
+                /* If count is 1 for both slabs, take different actions */
+                if ((tmp_diminfo[curr_dim].count == 1) && (high_count == 1)) {
+                    /* Check for overlap */
+                    if ((tmp_diminfo[curr_dim].start + tmp_diminfo[curr_dim].block) > high_start) {
+                        /* Check operation type */
+                        if (op == H5S_SELECT_OR)
+                            /* Merge blocks */
+                            tmp_diminfo[curr_dim].block =
+                                ((high_start + high_block) >=
+                                 (tmp_diminfo[curr_dim].start + tmp_diminfo[curr_dim].block))
+                                    ? (high_start + high_block - tmp_diminfo[curr_dim].start)
+                                    : tmp_diminfo[curr_dim].block;
+                        else {
+                            /* Block values must be the same */
+                            if (tmp_diminfo[curr_dim].block != high_block) {
+                                space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+                                break;
+                            } /* end if */
+
+                            /* XOR - overlap creates 2 blocks */
+                            tmp_diminfo[curr_dim].stride = high_block;
+                            tmp_diminfo[curr_dim].count  = 2;
+                            tmp_diminfo[curr_dim].block  = high_start - tmp_diminfo[curr_dim].start;
+                        } /* end else */
+                    }     /* end if */
                     else if ((tmp_diminfo[curr_dim].start + tmp_diminfo[curr_dim].block) == high_start)
                         /* Blocks border, merge them */
                         tmp_diminfo[curr_dim].block += high_block;
@@ -9879,18 +10617,126 @@ done:
 } /* end H5S__hyper_regular_and_single_block() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5S_select_hyperslab
- *
- * Purpose:     Internal version of H5Sselect_hyperslab().
+ * Function:    H5S__hyper_fixup_op
  *
- * Return:      Non-negative on success/Negative on failure
+ * Purpose:     Adjust a hyperslab operation, *OP, for the current
+ *              selection of a dataspace.  Operations on "none" and "all"
+ *              selections map to simpler ones, or convert the selection
+ *              to a hyperslab first.  Only "set" operations can be
+ *              applied to point selections.
  *
- * Programmer:  Quincey Koziol
- *              Wednesday, January 10, 2001
+ * Return:      TRUE if *OP must still be applied to the selection, FALSE
+ *              if the selection is already complete, negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
+static htri_t
+H5S__hyper_fixup_op(H5S_t *space, H5S_seloper_t *op)
+{
+    htri_t ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(op);
+
+    switch (H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE: /* No elements selected in dataspace */
+            switch (*op) {
+                case H5S_SELECT_SET: /* Select "set" operation */
+                    /* Change "none" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:       /* Binary "or" operation for hyperslabs */
+                case H5S_SELECT_XOR:      /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTA:     /* Binary "B not A" operation for hyperslabs */
+                    *op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
+                    break;
+
+                case H5S_SELECT_AND:   /* Binary "and" operation for hyperslabs */
+                case H5S_SELECT_NOTB:  /* Binary "A not B" operation for hyperslabs */
+                    HGOTO_DONE(FALSE); /* Selection stays "none" */
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_ALL: /* All elements selected in dataspace */
+            switch (*op) {
+                case H5S_SELECT_SET: /* Select "set" operation */
+                    /* Change "all" selection to hyperslab selection */
+                    break;
+
+                case H5S_SELECT_OR:    /* Binary "or" operation for hyperslabs */
+                    HGOTO_DONE(FALSE); /* Selection stays "all" */
+
+                case H5S_SELECT_AND:      /* Binary "and" operation for hyperslabs */
+                    *op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "all" selection */
+                    break;
+
+                case H5S_SELECT_XOR:  /* Binary "xor" operation for hyperslabs */
+                case H5S_SELECT_NOTB: /* Binary "A not B" operation for hyperslabs */
+                    /* Convert current "all" selection to "real" hyperslab selection */
+                    /* Then allow operation to proceed */
+                    if (H5S_select_hyperslab(space, H5S_SELECT_SET, H5S_hyper_zeros_g, H5S_hyper_ones_g,
+                                             H5S_hyper_ones_g, space->extent.size) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
+                    break;
+
+                case H5S_SELECT_NOTA: /* Binary "B not A" operation for hyperslabs */
+                    /* Convert to "none" selection */
+                    if (H5S_select_none(space) < 0)
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                    HGOTO_DONE(FALSE);
+
+                case H5S_SELECT_NOOP:
+                case H5S_SELECT_APPEND:
+                case H5S_SELECT_PREPEND:
+                case H5S_SELECT_INVALID:
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+            } /* end switch */
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            /* Hyperslab operation on hyperslab selection, OK */
+            break;
+
+        case H5S_SEL_POINTS:           /* Can't combine hyperslab operations and point selections currently */
+            if (*op == H5S_SELECT_SET) /* Allow only "set" operation to proceed */
+                break;
+            /* FALLTHROUGH (to error) */
+            H5_ATTR_FALLTHROUGH
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_fixup_op() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S_select_hyperslab
+ *
+ * Purpose:     Internal version of H5Sselect_hyperslab().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Quincey Koziol
+ *              Wednesday, January 10, 2001
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
 H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[], const hsize_t *stride,
                      const hsize_t count[], const hsize_t *block)
 {
@@ -9901,6 +10747,7 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[], cons
     const hsize_t *opt_count;                /* Optimized count information */
     const hsize_t *opt_block;                /* Optimized block information */
     int            unlim_dim = -1;           /* Unlimited dimension in selection, of -1 if none */
+    htri_t         proceed;                  /* Whether the operation must still be applied */
     unsigned       u;                        /* Local index variable */
     herr_t         ret_value = SUCCEED;      /* Return value */
 
@@ -10025,97 +10872,10 @@ H5S_select_hyperslab(H5S_t *space, H5S_seloper_t op, const hsize_t start[], cons
     } /* end if */
 
     /* Fixup operation for non-hyperslab selections */
-    switch (H5S_GET_SELECT_TYPE(space)) {
-        case H5S_SEL_NONE: /* No elements selected in dataspace */
-            switch (op) {
-                case H5S_SELECT_SET: /* Select "set" operation */
-                    /* Change "none" selection to hyperslab selection */
-                    break;
-
-                case H5S_SELECT_OR:      /* Binary "or" operation for hyperslabs */
-                case H5S_SELECT_XOR:     /* Binary "xor" operation for hyperslabs */
-                case H5S_SELECT_NOTA:    /* Binary "B not A" operation for hyperslabs */
-                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
-                    break;
-
-                case H5S_SELECT_AND:     /* Binary "and" operation for hyperslabs */
-                case H5S_SELECT_NOTB:    /* Binary "A not B" operation for hyperslabs */
-                    HGOTO_DONE(SUCCEED); /* Selection stays "none" */
-
-                case H5S_SELECT_NOOP:
-                case H5S_SELECT_APPEND:
-                case H5S_SELECT_PREPEND:
-                case H5S_SELECT_INVALID:
-                default:
-                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-            } /* end switch */
-            break;
-
-        case H5S_SEL_ALL: /* All elements selected in dataspace */
-            switch (op) {
-                case H5S_SELECT_SET: /* Select "set" operation */
-                    /* Change "all" selection to hyperslab selection */
-                    break;
-
-                case H5S_SELECT_OR:      /* Binary "or" operation for hyperslabs */
-                    HGOTO_DONE(SUCCEED); /* Selection stays "all" */
-
-                case H5S_SELECT_AND:     /* Binary "and" operation for hyperslabs */
-                    op = H5S_SELECT_SET; /* Maps to "set" operation when applied to "none" selection */
-                    break;
-
-                case H5S_SELECT_XOR:  /* Binary "xor" operation for hyperslabs */
-                case H5S_SELECT_NOTB: /* Binary "A not B" operation for hyperslabs */
-                    /* Convert current "all" selection to "real" hyperslab selection */
-                    /* Then allow operation to proceed */
-                    {
-                        const hsize_t *tmp_start;  /* Temporary start information */
-                        const hsize_t *tmp_stride; /* Temporary stride information */
-                        const hsize_t *tmp_count;  /* Temporary count information */
-                        const hsize_t *tmp_block;  /* Temporary block information */
-
-                        /* Set up temporary information for the dimensions */
-                        tmp_start  = H5S_hyper_zeros_g;
-                        tmp_stride = tmp_count = H5S_hyper_ones_g;
-                        tmp_block              = space->extent.size;
-
-                        /* Convert to hyperslab selection */
-                        if (H5S_select_hyperslab(space, H5S_SELECT_SET, tmp_start, tmp_stride, tmp_count,
-                                                 tmp_block) < 0)
-                            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection")
-                    } /* end case */
-                    break;
-
-                case H5S_SELECT_NOTA: /* Binary "B not A" operation for hyperslabs */
-                    /* Convert to "none" selection */
-                    if (H5S_select_none(space) < 0)
-                        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
-                    HGOTO_DONE(SUCCEED);
-
-                case H5S_SELECT_NOOP:
-                case H5S_SELECT_APPEND:
-                case H5S_SELECT_PREPEND:
-                case H5S_SELECT_INVALID:
-                default:
-                    HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-            } /* end switch */
-            break;
-
-        case H5S_SEL_HYPERSLABS:
-            /* Hyperslab operation on hyperslab selection, OK */
-            break;
-
-        case H5S_SEL_POINTS:          /* Can't combine hyperslab operations and point selections currently */
-            if (op == H5S_SELECT_SET) /* Allow only "set" operation to proceed */
-                break;
-            /* FALLTHROUGH (to error) */
-            H5_ATTR_FALLTHROUGH
-
-        case H5S_SEL_ERROR:
-        case H5S_SEL_N:
-        default:
-            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
-    } /* end switch */
+    if ((proceed = H5S__hyper_fixup_op(space, &op)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust selection operation")
+    if (!proceed)
+        HGOTO_DONE(SUCCEED)
 
     if (op == H5S_SELECT_SET) {
         /* Set selection to regular hyperslab */
@@ -10266,6 +11026,214 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_hyperslab() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__select_hyper_spans
+ PURPOSE
+    Combine a span tree with the current selection
+ USAGE
+    herr_t H5S__select_hyper_spans(space, op, new_spans)
+        H5S_t *space;                   IN/OUT: Dataspace to modify selection of
+        H5S_seloper_t op;               IN: Operation to perform on current selection
+        H5S_hyper_span_info_t *new_spans; IN: Span tree to combine with selection
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the hyperslab selection described by NEW_SPANS with the current
+    selection for a dataspace, in the same way as H5S_select_hyperslab().
+    NEW_SPANS may be NULL for no elements.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The caller's reference to NEW_SPANS is taken over, even on failure.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__select_hyper_spans(H5S_t *space, H5S_seloper_t op, H5S_hyper_span_info_t *new_spans)
+{
+    htri_t proceed;             /* Whether the operation must still be applied */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+
+    /* Handle an empty new selection */
+    if (NULL == new_spans) {
+        switch (op) {
+            case H5S_SELECT_SET:  /* Select "set" operation */
+            case H5S_SELECT_AND:  /* Binary "and" operation for hyperslabs */
+            case H5S_SELECT_NOTA: /* Binary "B not A" operation for hyperslabs */
+                /* Convert to "none" selection */
+                if (H5S_select_none(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection")
+                HGOTO_DONE(SUCCEED);
+
+            case H5S_SELECT_OR:      /* Binary "or" operation for hyperslabs */
+            case H5S_SELECT_XOR:     /* Binary "xor" operation for hyperslabs */
+            case H5S_SELECT_NOTB:    /* Binary "A not B" operation for hyperslabs */
+                HGOTO_DONE(SUCCEED); /* Selection stays same */
+
+            case H5S_SELECT_NOOP:
+            case H5S_SELECT_APPEND:
+            case H5S_SELECT_PREPEND:
+            case H5S_SELECT_INVALID:
+            default:
+                HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+        } /* end switch */
+    }     /* end if */
+
+    /* Check for operating on unlimited selection */
+    if (H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS && space->select.sel_info.hslab->unlim_dim >= 0 &&
+        op != H5S_SELECT_SET)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unsupported operation on unlimited selection")
+
+    /* Fixup operation for non-hyperslab selections */
+    if ((proceed = H5S__hyper_fixup_op(space, &op)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust selection operation")
+    if (!proceed)
+        HGOTO_DONE(SUCCEED)
+
+    if (op == H5S_SELECT_SET) {
+        /* If we are setting a new selection, remove current selection first */
+        if (H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection")
+
+        /* Allocate space for the hyperslab selection information */
+        if (NULL == (space->select.sel_info.hslab = H5FL_MALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab info")
+
+        /* Set the hyperslab selection to the new span tree */
+        space->select.sel_info.hslab->span_lst  = new_spans;
+        space->select.sel_info.hslab->unlim_dim = -1;
+        space->select.num_elem                  = H5S__hyper_spans_nelem(new_spans);
+        space->select.type                      = H5S_sel_hyper;
+        new_spans                               = NULL;
+
+        /* Recover the regular hyperslab information, if possible */
+        H5S__hyper_rebuild(space);
+    } /* end if */
+    else if (op >= H5S_SELECT_OR && op <= H5S_SELECT_NOTA) {
+        hbool_t new_spans_owned = FALSE;
+        hbool_t updated_spans   = FALSE;
+
+        /* Sanity check */
+        HDassert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+
+        /* Check if there's no hyperslab span information currently */
+        if (NULL == space->select.sel_info.hslab->span_lst)
+            if (H5S__hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree")
+
+        /* Set selection type */
+        space->select.type = H5S_sel_hyper;
+
+        /* Generate new spans for space */
+        if (H5S__fill_in_new_space(space, op, new_spans, TRUE, &new_spans_owned, &updated_spans, &space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't generate the specified hyperslab")
+
+        /* Mark the regular hyperslab information as unknown, if the spans changed */
+        if (updated_spans)
+            space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+
+        /* Indicate that the new_spans are owned, there's no need to free */
+        if (new_spans_owned)
+            new_spans = NULL;
+    } /* end if */
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+done:
+    if (new_spans)
+        H5S__hyper_free_span_info(new_spans);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__select_hyper_spans() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_hyper_blocklist
+ PURPOSE
+    Specify a list of hyperslab blocks to combine with the current selection
+ USAGE
+    herr_t H5Sselect_hyper_blocklist(dsid, op, numblocks, buf)
+        hid_t dsid;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;       IN: Operation to perform on current selection
+        hsize_t numblocks;      IN: Number of hyperslab blocks in list
+        const hsize_t buf[];    IN: List of hyperslab blocks
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of hyperslab blocks with the current
+    selection for a dataspace, as H5Sselect_hyperslab() does for one block.
+    The list of blocks has the same format as the list returned by
+    H5Sget_select_hyper_blocklist(): the "start" coordinate of each block
+    followed by its "opposite" corner coordinate.
+        Blocks may overlap and be in any order, but the selection is built
+    faster when each block comes after the blocks before it, as the blocks
+    returned by H5Sget_select_hyper_blocklist() do.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_hyper_blocklist(hid_t space_id, H5S_seloper_t op, hsize_t numblocks, const hsize_t buf[])
+{
+    H5S_t *                space;               /* Dataspace to modify selection of */
+    H5S_hyper_build_t      build;               /* State of span tree being built */
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for the blocks */
+    hsize_t                u;                   /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iSsh*h", space_id, op, numblocks, buf);
+
+    /* Initialize the span tree building state (before anything can fail) */
+    HDmemset(&build, 0, sizeof(build));
+
+    /* Check args */
+    if (NULL == (space = (H5S_t *)H5I_object_verify(space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+    if (H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space")
+    if (H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space")
+    if (numblocks > 0 && buf == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "hyperslab blocks not specified")
+    if (!(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation")
+
+    /* Build the span tree for the blocks */
+    build.rank = space->extent.rank;
+    for (u = 0; u < numblocks; u++) {
+        const hsize_t *start = &buf[u * 2 * build.rank];  /* Starting coordinates of block */
+        const hsize_t *end   = start + build.rank;        /* Ending coordinates of block */
+        unsigned       v;                                 /* Local index variable */
+
+        for (v = 0; v < build.rank; v++)
+            if (start[v] > end[v])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "hyperslab block ends before it starts")
+
+        if (H5S__hyper_build_add(&build, start, end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't add hyperslab block")
+    } /* end for */
+    if (numblocks > 0)
+        if (NULL == (new_spans = H5S__hyper_build_finish(&build)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't build hyperslab spans")
+
+    /* Combine the blocks with the current selection */
+    if (H5S__select_hyper_spans(space, op, new_spans) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to set hyperslab selection")
+
+done:
+    H5S__hyper_build_release(&build);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_hyper_blocklist() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_combine_hyperslab
@@ -1185,6 +1185,40 @@ H5_DLL herr_t H5Sselect_elements(hid_t space_id, H5S_seloper_t op, size_t num_el
 H5_DLL herr_t H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
                                   const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
 /*--------------------------------------------------------------------------*/
+/**\ingroup H5S
+ *
+ * \brief Selects a list of hyperslab blocks for a dataspace
+ *
+ * \space_id
+ * \param[in] op        Operation to perform on current selection
+ * \param[in] numblocks Number of hyperslab blocks in \p buf
+ * \param[in] buf       List of hyperslab blocks
+ *
+ * \return \herr_t
+ *
+ * \details H5Sselect_hyper_blocklist() selects the union of a list of
+ *          hyperslab blocks, and combines it with the existing selection
+ *          for the dataspace \p space_id using the operator \p op, as
+ *          H5Sselect_hyperslab() does for a single hyperslab.
+ *
+ *          The list of blocks in \p buf has the same format as the list
+ *          returned by H5Sget_select_hyper_blocklist(): the "start"
+ *          coordinate of each block, followed by its "opposite" corner
+ *          coordinate. The blocks may overlap and may be listed in any
+ *          order.
+ *
+ *          The selection is built in a single pass when each block comes
+ *          after the blocks listed before it in C order, as the blocks
+ *          returned by H5Sget_select_hyper_blocklist() do. This is much
+ *          faster than calling H5Sselect_hyperslab() with #H5S_SELECT_OR
+ *          for each block.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Sselect_hyper_blocklist(hid_t space_id, H5S_seloper_t op, hsize_t numblocks,
+                                        const hsize_t buf[]);
+/*--------------------------------------------------------------------------*/
 /**\ingroup H5S
  *
  * \brief Checks if current selection intersects with a block
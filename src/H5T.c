@@ -49,6 +49,16 @@
 
 #define H5T_ENCODE_VERSION 0
 
+/* Most threads a conversion is split across */
+#define H5T_CONV_MAX_THREADS 32
+
+/* Initial number of slots in the conversion path hash index */
+#define H5T_PATH_INDEX_MIN 256
+
+/* Fold a value into a datatype fingerprint (FNV-1a style) */
+#define H5T_FP_INIT      ((uint64_t)0xcbf29ce484222325ULL)
+#define H5T_FP_MIX(H, V) ((H) = ((H) ^ (uint64_t)(V)) * (uint64_t)0x100000001b3ULL)
+
 /*
  * Type initialization macros
  *
@@ -338,6 +348,51 @@
 /* Typedef for recursive const-correct datatype copying routines */
 typedef H5T_t *(*H5T_copy_func_t)(H5T_t *old_dt);
 
+#ifdef H5T_CONV_HAVE_THREADS
+/* One thread's share of a datatype conversion.  Everything a piece needs
+ * is resolved before it's queued, so the threads never look up IDs, use
+ * the API context or touch the conversion path.
+ */
+typedef struct H5T_conv_work_t {
+    struct H5T_conv_req_t * req;    /* Conversion the piece belongs to */
+    struct H5T_conv_work_t *next;   /* Next piece waiting in the pool's queue */
+    uint8_t *               buf;    /* Elements to convert in place */
+    size_t                  start;  /* Index of the piece's first element in the conversion */
+    size_t                  nelmts; /* Number of elements to convert */
+} H5T_conv_work_t;
+
+/* The conversion threads, started as conversions need them and kept until
+ * the library shuts down, and the queue of pieces waiting for them
+ */
+typedef struct H5T_conv_pool_t {
+    H5TS_mutex_simple_t lock;                          /* Protects the pool and the requests' counts */
+    pthread_cond_t      work_cond;                     /* Signaled when a piece is queued or on shutdown */
+    pthread_cond_t      done_cond;                     /* Broadcast when a request's last piece is done */
+    H5T_conv_work_t *   head;                          /* First piece waiting to be converted */
+    H5T_conv_work_t *   tail;                          /* Last piece waiting to be converted */
+    unsigned            nthreads;                      /* Number of threads started */
+    hbool_t             shutdown;                      /* Whether the threads should exit */
+    pthread_t           threads[H5T_CONV_MAX_THREADS]; /* The threads */
+} H5T_conv_pool_t;
+#endif /* H5T_CONV_HAVE_THREADS */
+
+/* A datatype conversion that may still be running in other threads */
+struct H5T_conv_req_t {
+#ifdef H5T_CONV_HAVE_THREADS
+    H5T_lib_conv_t  func;                       /* Hard conversion function, or NULL to swap bytes */
+    H5T_cdata_t     cdata;                      /* Conversion data passed to FUNC */
+    size_t          src_size;                   /* Size of source elements */
+    size_t          dst_size;                   /* Size of destination elements */
+    size_t          buf_stride;                 /* Distance between elements, or 0 when packed */
+    uint8_t *       buf;                        /* Buffer being converted */
+    unsigned        nwork;                      /* Number of pieces */
+    unsigned        npending;                   /* Pieces not converted yet (protected by the pool's lock) */
+    H5T_conv_work_t work[H5T_CONV_MAX_THREADS]; /* Pieces of the conversion */
+#else
+    int dummy; /* Conversions finish before H5T_convert_start returns */
+#endif /* H5T_CONV_HAVE_THREADS */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -350,10 +405,25 @@ static herr_t H5T__set_size(H5T_t *dt, size_t size);
 static herr_t H5T__close_cb(H5T_t *dt, void **request);
 static H5T_path_t *H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name,
                                        H5T_conv_func_t *conv);
+static uint64_t    H5T__fingerprint(const H5T_t *dt);
+static uint64_t    H5T__fp_avalanche(uint64_t h);
+static herr_t      H5T__path_index_build(void);
+static herr_t      H5T__path_index_insert(H5T_path_t *path);
+static void        H5T__path_index_replace(const H5T_path_t *old_path, H5T_path_t *new_path);
+static H5T_path_t *H5T__path_index_lookup(const H5T_t *src, const H5T_t *dst, uint64_t hash);
 static hbool_t     H5T__detect_vlen_ref(const H5T_t *dt);
 static H5T_t *     H5T__initiate_copy(const H5T_t *old_dt);
 static H5T_t *     H5T__copy_transient(H5T_t *old_dt);
 static H5T_t *     H5T__copy_all(H5T_t *old_dt);
+#ifdef H5T_CONV_HAVE_THREADS
+static herr_t H5T__conv_nthreads(const H5T_path_t *tpath, size_t nelmts, size_t buf_stride,
+                                 unsigned max_nthreads, unsigned *nthreads);
+static void   H5T__convert_piece(const H5T_conv_work_t *work);
+static void * H5T__convert_thread(void *udata);
+static void   H5T__convert_split(H5T_conv_req_t *req, const H5T_path_t *tpath, size_t nelmts,
+                                 size_t buf_stride, void *buf, unsigned nthreads, hbool_t async);
+static void   H5T__conv_pool_term(void);
+#endif /* H5T_CONV_HAVE_THREADS */
 static herr_t      H5T__complete_copy(H5T_t *new_dt, const H5T_t *old_dt, H5T_shared_t *reopened_fo,
                                       hbool_t set_memory_type, H5T_copy_func_t copyfn);
 
@@ -578,6 +648,9 @@ const unsigned H5O_dtype_ver_bounds[] = {
     H5O_DTYPE_VERSION_LATEST /* H5F_LIBVER_LATEST */
 };
 
+/* Number of conversions split across threads so far (for testing) */
+unsigned H5T_conv_nsplit_g = 0;
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -585,6 +658,14 @@ const unsigned H5O_dtype_ver_bounds[] = {
 /*
  * The path database. Each path has a source and destination data type pair
  * which is used as the key by which the `entries' array is sorted.
+ *
+ * The paths (other than the no-op path) are also hashed on a fingerprint of
+ * their datatype pair, so that finding an existing path usually takes one
+ * pair of datatype comparisons instead of a binary search's worth.  The
+ * index is an open-addressed table kept at most half full, and is rebuilt
+ * lazily after paths are removed.  The generation count changes whenever a
+ * path is replaced or removed, which invalidates remembered lookups (see
+ * H5T_path_find_memo).
  */
 static struct {
     int          npaths; /*number of paths defined               */
@@ -593,11 +674,23 @@ static struct {
     int          nsoft;  /*number of soft conversions defined    */
     size_t       asoft;  /*number of soft conversions allocated  */
     H5T_soft_t * soft;   /*unsorted array of soft conversions    */
+    H5T_path_t **index;  /*hash index of paths, or NULL          */
+    size_t       aindex; /*number of index slots (a power of two)*/
+    uint64_t     gen;    /*path table generation                 */
 } H5T_g;
 
 /* Declare the free list for H5T_path_t's */
 H5FL_DEFINE_STATIC(H5T_path_t);
 
+/* Declare the free list for H5T_conv_req_t's */
+H5FL_DEFINE_STATIC(H5T_conv_req_t);
+
+#ifdef H5T_CONV_HAVE_THREADS
+/* The conversion threads */
+static H5T_conv_pool_t H5T_conv_pool_g = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0, FALSE, {0}};
+#endif /* H5T_CONV_HAVE_THREADS */
+
 /* Datatype ID class */
 static const H5I_class_t H5I_DATATYPE_CLS[1] = {{
     H5I_DATATYPE,             /* ID class value */
@@ -1601,6 +1694,9 @@ H5T_top_term_package(void)
             H5T_g.path   = (H5T_path_t **)H5MM_xfree(H5T_g.path);
             H5T_g.npaths = 0;
             H5T_g.apaths = 0;
+            H5T_g.index  = (H5T_path_t **)H5MM_xfree(H5T_g.index);
+            H5T_g.aindex = 0;
+            H5T_g.gen++;
             H5T_g.soft   = (H5T_soft_t *)H5MM_xfree(H5T_g.soft);
             H5T_g.nsoft  = 0;
             H5T_g.asoft  = 0;
@@ -1758,6 +1854,11 @@ H5T_term_package(void)
         HDassert(0 == H5I_nmembers(H5I_DATATYPE));
         HDassert(FALSE == H5T_top_package_initialize_s);
 
+#ifdef H5T_CONV_HAVE_THREADS
+        /* Stop the conversion threads */
+        H5T__conv_pool_term();
+#endif /* H5T_CONV_HAVE_THREADS */
+
         /* Destroy the datatype object id group */
         n += (H5I_dec_type_ref(H5I_DATATYPE) > 0);
 
@@ -2694,10 +2795,13 @@ H5T__register(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst, H5T_con
             new_path->conv    = *conv;
             new_path->is_hard = FALSE;
             new_path->cdata   = cdata;
+            new_path->hash    = old_path->hash;
 
             /* Replace previous path */
             H5T_g.path[i] = new_path;
-            new_path      = NULL; /*so we don't free it on error*/
+            H5T__path_index_replace(old_path, new_path);
+            H5T_g.gen++;
+            new_path = NULL; /*so we don't free it on error*/
 
             /* Free old path */
             H5T__print_stats(old_path, &nprint);
@@ -2874,10 +2978,13 @@ H5T__unregister(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst, H5T_c
             path->cdata.recalc = TRUE;
         } /* end if */
         else {
-            /* Remove from table */
+            /* Remove from table (the hash index is rebuilt when next needed) */
             HDmemmove(H5T_g.path + i, H5T_g.path + i + 1,
                       (size_t)(H5T_g.npaths - (i + 1)) * sizeof(H5T_path_t *));
             --H5T_g.npaths;
+            H5T_g.index  = (H5T_path_t **)H5MM_xfree(H5T_g.index);
+            H5T_g.aindex = 0;
+            H5T_g.gen++;
 
             /* Shut down path */
             H5T__print_stats(path, &nprint);
@@ -3068,6 +3175,7 @@ H5Tconvert(hid_t src_id, hid_t dst_id, size_t nelmts, void *buf, void *backgroun
 {
     H5T_path_t *tpath;               /* type conversion info    */
     H5T_t *     src, *dst;           /* unregistered types      */
+    unsigned    nthreads;            /* conversion threads      */
     herr_t      ret_value = SUCCEED; /* Return value            */
 
     FUNC_ENTER_API(FAIL)
@@ -3089,7 +3197,11 @@ H5Tconvert(hid_t src_id, hid_t dst_id, size_t nelmts, void *buf, void *backgroun
     if (NULL == (tpath = H5T_path_find(src, dst)))
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to convert between src and dst data types")
 
-    if (H5T_convert(tpath, src_id, dst_id, nelmts, (size_t)0, (size_t)0, buf, background) < 0)
+    /* Get the number of conversion threads */
+    if (H5CX_get_conv_nthreads(&nthreads) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get number of conversion threads")
+
+    if (H5T_convert_mt(tpath, src_id, dst_id, nelmts, (size_t)0, (size_t)0, buf, background, nthreads) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "data type conversion failed")
 
 done:
@@ -4598,6 +4710,24 @@ H5T_cmp(const H5T_t *dt1, const H5T_t *dt2, hbool_t superset)
             if (dt1->shared->u.compnd.nmembs > dt2->shared->u.compnd.nmembs)
                 HGOTO_DONE(1);
 
+            /* Compound types being compared are usually equal with their
+             * members in the same order (a memory type and the file type built
+             * from it, say), so check for that member-by-member before sorting
+             * the names.  The sorted comparison below is still needed to order
+             * types that differ.
+             */
+            for (u = 0; u < dt1->shared->u.compnd.nmembs; u++) {
+                const H5T_cmemb_t *memb1 = &dt1->shared->u.compnd.memb[u];
+                const H5T_cmemb_t *memb2 = &dt2->shared->u.compnd.memb[u];
+
+                if (memb1->offset != memb2->offset || memb1->size != memb2->size ||
+                    HDstrcmp(memb1->name, memb2->name) != 0 ||
+                    H5T_cmp(memb1->type, memb2->type, superset) != 0)
+                    break;
+            } /* end for */
+            if (u == dt1->shared->u.compnd.nmembs)
+                HGOTO_DONE(0);
+
             /* Build an index for each type so the names are sorted */
             if (NULL == (idx1 = (unsigned *)H5MM_malloc(dt1->shared->u.compnd.nmembs * sizeof(unsigned))) ||
                 NULL == (idx2 = (unsigned *)H5MM_malloc(dt2->shared->u.compnd.nmembs * sizeof(unsigned))))
@@ -4999,6 +5129,148 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_cmp() */
 
+/*-------------------------------------------------------------------------
+ * Function:  H5T__fp_avalanche
+ *
+ * Purpose:   Mixes the bits of a partial datatype fingerprint, so that
+ *            fingerprints can be summed and used to pick hash slots.
+ *
+ * Return:    The mixed value (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5T__fp_avalanche(uint64_t h)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    h ^= h >> 33;
+    h *= (uint64_t)0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= (uint64_t)0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    FUNC_LEAVE_NOAPI(h)
+} /* end H5T__fp_avalanche() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__fingerprint
+ *
+ * Purpose:   Computes a hash of the properties of DT that H5T_cmp compares
+ *            exactly, so that datatypes which compare equal (when not
+ *            doing a "superset" comparison) have the same fingerprint.
+ *            Compound and enumeration members are combined without regard
+ *            to their order, since H5T_cmp compares them sorted by name.
+ *            Opaque tags and variable-length locations are left out, as
+ *            H5T_cmp doesn't always compare them.
+ *
+ * Return:    The fingerprint (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5T__fingerprint(const H5T_t *dt)
+{
+    uint64_t membs     = 0;           /* Order-independent sum over members */
+    unsigned u;                       /* Local index variable */
+    uint64_t ret_value = H5T_FP_INIT; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(dt);
+    HDassert(dt->shared);
+
+    H5T_FP_MIX(ret_value, dt->shared->type);
+    H5T_FP_MIX(ret_value, dt->shared->size);
+    if (dt->shared->parent)
+        H5T_FP_MIX(ret_value, H5T__fingerprint(dt->shared->parent));
+
+    switch (dt->shared->type) {
+        case H5T_COMPOUND:
+            H5T_FP_MIX(ret_value, dt->shared->u.compnd.nmembs);
+            for (u = 0; u < dt->shared->u.compnd.nmembs; u++) {
+                const H5T_cmemb_t *memb = &dt->shared->u.compnd.memb[u];
+                uint64_t           h;
+
+                h = H5_checksum_lookup3(memb->name, HDstrlen(memb->name), 0);
+                H5T_FP_MIX(h, memb->offset);
+                H5T_FP_MIX(h, memb->size);
+                H5T_FP_MIX(h, H5T__fingerprint(memb->type));
+                membs += H5T__fp_avalanche(h);
+            } /* end for */
+            H5T_FP_MIX(ret_value, membs);
+            break;
+
+        case H5T_ENUM:
+            H5T_FP_MIX(ret_value, dt->shared->u.enumer.nmembs);
+            for (u = 0; u < dt->shared->u.enumer.nmembs; u++) {
+                size_t   base_size = dt->shared->parent->shared->size;
+                uint64_t h;
+
+                h = H5_checksum_lookup3(dt->shared->u.enumer.name[u], HDstrlen(dt->shared->u.enumer.name[u]),
+                                        0);
+                H5T_FP_MIX(h, H5_checksum_lookup3((uint8_t *)dt->shared->u.enumer.value + u * base_size,
+                                                  base_size, 0));
+                membs += H5T__fp_avalanche(h);
+            } /* end for */
+            H5T_FP_MIX(ret_value, membs);
+            break;
+
+        case H5T_VLEN:
+            H5T_FP_MIX(ret_value, dt->shared->u.vlen.type);
+            H5T_FP_MIX(ret_value, (uintptr_t)dt->shared->u.vlen.file);
+            break;
+
+        case H5T_OPAQUE:
+            break;
+
+        case H5T_ARRAY:
+            H5T_FP_MIX(ret_value, dt->shared->u.array.ndims);
+            for (u = 0; u < dt->shared->u.array.ndims; u++)
+                H5T_FP_MIX(ret_value, dt->shared->u.array.dim[u]);
+            break;
+
+        case H5T_NO_CLASS:
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_STRING:
+        case H5T_BITFIELD:
+        case H5T_REFERENCE:
+        case H5T_NCLASSES:
+        default:
+            H5T_FP_MIX(ret_value, dt->shared->u.atomic.order);
+            H5T_FP_MIX(ret_value, dt->shared->u.atomic.prec);
+            H5T_FP_MIX(ret_value, dt->shared->u.atomic.offset);
+            H5T_FP_MIX(ret_value, dt->shared->u.atomic.lsb_pad);
+            H5T_FP_MIX(ret_value, dt->shared->u.atomic.msb_pad);
+            if (H5T_INTEGER == dt->shared->type)
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.i.sign);
+            else if (H5T_FLOAT == dt->shared->type) {
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.sign);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.epos);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.esize);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.ebias);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.mpos);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.msize);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.norm);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.f.pad);
+            } /* end if */
+            else if (H5T_STRING == dt->shared->type) {
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.s.cset);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.s.pad);
+            } /* end if */
+            else if (H5T_REFERENCE == dt->shared->type) {
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.r.rtype);
+                H5T_FP_MIX(ret_value, dt->shared->u.atomic.u.r.loc);
+                H5T_FP_MIX(ret_value, (uintptr_t)dt->shared->u.atomic.u.r.file);
+            } /* end if */
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__fingerprint() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T_path_find
  *
@@ -5045,6 +5317,67 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_path_find() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T_path_find_memo
+ *
+ * Purpose:     Like H5T_path_find, but remembers the path in MEMO, which
+ *              belongs to a dataset or attribute whose own datatype is
+ *              OWN_TYPE.  A remembered path is reused without looking at
+ *              the datatypes at all, as long as it's asked for the same
+ *              SRC and DST objects and no conversion path has been
+ *              replaced or removed since.
+ *
+ *              That's only safe when neither datatype can have changed
+ *              or been freed in between, so a lookup is only remembered
+ *              if each datatype is either OWN_TYPE or immutable (the
+ *              predefined types and any locked with H5Tlock).  Types
+ *              which force conversion are never remembered, as the file
+ *              of variable-length and reference types can be patched.
+ *
+ * Return:      Success:    Pointer to the path, valid until the path
+ *                          database is modified.
+ *
+ *              Failure:    NULL if the path does not exist and no
+ *                          function can be found to apply to the new path.
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_path_t *
+H5T_path_find_memo(const H5T_t *src, const H5T_t *dst, const H5T_t *own_type, H5T_path_memo_t *memo)
+{
+    H5T_path_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Sanity check */
+    HDassert(src);
+    HDassert(src->shared);
+    HDassert(dst);
+    HDassert(dst->shared);
+    HDassert(memo);
+
+    /* Reuse the remembered path, if it still applies */
+    if (memo->path && memo->src == src && memo->dst == dst && memo->gen == H5T_g.gen)
+        HGOTO_DONE(memo->path)
+
+    if (NULL == (ret_value = H5T_path_find(src, dst)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, NULL, "can't find datatype conversion path")
+
+    /* Remember the path, if both datatypes are stable */
+    if ((src == own_type || H5T_STATE_IMMUTABLE == src->shared->state) && !src->shared->force_conv &&
+        (dst == own_type || H5T_STATE_IMMUTABLE == dst->shared->state) && !dst->shared->force_conv) {
+        memo->src  = src;
+        memo->dst  = dst;
+        memo->path = ret_value;
+        memo->gen  = H5T_g.gen;
+    } /* end if */
+    else
+        memo->path = NULL;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_find_memo() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__path_find_real
  *
@@ -5078,6 +5411,7 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_co
     int         md;                       /* middle */
     int         cmp;                      /* comparison result  */
     int         old_npaths;               /* Previous number of paths in table */
+    uint64_t    hash   = 0;               /* fingerprint of src/dst pair */
     H5T_path_t *table  = NULL;            /* path existing in the table */
     H5T_path_t *path   = NULL;            /* new path */
     hid_t       src_id = -1, dst_id = -1; /* src and dst type identifiers */
@@ -5138,6 +5472,18 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_co
         rt      = H5T_g.npaths;
         cmp     = -1;
 
+        /* Look the pair up in the hash index first, unless a new conversion
+         * function is being installed (which needs the path's position in the
+         * sorted table)
+         */
+        hash = H5T__fp_avalanche(H5T__fingerprint(src) * 31 + H5T__fingerprint(dst));
+        if (!conv->u.app_func && H5T_g.npaths > 1) {
+            if (NULL == H5T_g.index && H5T__path_index_build() < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, NULL, "unable to build conversion path index")
+            if (NULL != (table = H5T__path_index_lookup(src, dst, hash)))
+                cmp = 0;
+        } /* end if */
+
         while (cmp && lt < rt) {
             md = (lt + rt) / 2;
             HDassert(H5T_g.path[md]);
@@ -5178,6 +5524,7 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_co
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, NULL, "unable to copy datatype for conversion path")
         if (NULL == (path->dst = H5T_copy(dst, H5T_COPY_ALL)))
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, NULL, "unable to copy datatype for conversion path")
+        path->hash = hash;
     } /* end if */
     else
         path = table;
@@ -5315,6 +5662,8 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_co
             (void)H5T_close_real(table->src);
         if (table->dst)
             (void)H5T_close_real(table->dst);
+        H5T__path_index_replace(table, path);
+        H5T_g.gen++;
         table          = H5FL_FREE(H5T_path_t, table);
         table          = path;
         H5T_g.path[md] = path;
@@ -5336,6 +5685,8 @@ H5T__path_find_real(const H5T_t *src, const H5T_t *dst, const char *name, H5T_co
         H5T_g.npaths++;
         H5T_g.path[md] = path;
         table          = path;
+        if (H5T__path_index_insert(path) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINSERT, NULL, "unable to index conversion path")
     } /* end else-if */
 
     /* Set the flag to indicate both source and destination types are compound types
@@ -5365,6 +5716,154 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__path_find_real() */
 
+/*-------------------------------------------------------------------------
+ * Function:  H5T__path_index_build
+ *
+ * Purpose:   (Re)builds the hash index over the conversion path table,
+ *            sized so that it is at most half full.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__path_index_build(void)
+{
+    H5T_path_t **index;               /* New index */
+    size_t       na;                  /* Number of slots in new index */
+    size_t       mask;                /* Mask for slot numbers */
+    int          i;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (na = H5T_PATH_INDEX_MIN; na < 2 * (size_t)H5T_g.npaths; na *= 2)
+        ;
+    if (NULL == (index = (H5T_path_t **)H5MM_calloc(na * sizeof(H5T_path_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for conversion path index")
+
+    /* Hash the paths, skipping the no-op path */
+    mask = na - 1;
+    for (i = 1; i < H5T_g.npaths; i++) {
+        size_t slot = (size_t)H5T_g.path[i]->hash & mask;
+
+        while (index[slot])
+            slot = (slot + 1) & mask;
+        index[slot] = H5T_g.path[i];
+    } /* end for */
+
+    H5MM_xfree(H5T_g.index);
+    H5T_g.index  = index;
+    H5T_g.aindex = na;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__path_index_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__path_index_insert
+ *
+ * Purpose:   Adds PATH, which has just been added to the path table, to
+ *            the hash index, if the index has been built.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__path_index_insert(H5T_path_t *path)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(path);
+
+    if (H5T_g.index) {
+        /* Grow the index (which re-hashes PATH as well) when it gets half full */
+        if (2 * (size_t)H5T_g.npaths > H5T_g.aindex) {
+            if (H5T__path_index_build() < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to rebuild conversion path index")
+        } /* end if */
+        else {
+            size_t mask = H5T_g.aindex - 1;
+            size_t slot = (size_t)path->hash & mask;
+
+            while (H5T_g.index[slot])
+                slot = (slot + 1) & mask;
+            H5T_g.index[slot] = path;
+        } /* end else */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__path_index_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__path_index_replace
+ *
+ * Purpose:   Puts NEW_PATH in place of OLD_PATH (which converts between
+ *            the same datatypes) in the hash index.
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__path_index_replace(const H5T_path_t *old_path, H5T_path_t *new_path)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(old_path);
+    HDassert(new_path);
+
+    if (H5T_g.index) {
+        size_t mask = H5T_g.aindex - 1;
+        size_t slot;
+
+        for (slot = (size_t)old_path->hash & mask; H5T_g.index[slot]; slot = (slot + 1) & mask)
+            if (H5T_g.index[slot] == old_path) {
+                H5T_g.index[slot] = new_path;
+                break;
+            } /* end if */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__path_index_replace() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__path_index_lookup
+ *
+ * Purpose:   Looks up the path converting SRC to DST in the hash index,
+ *            given HASH, the fingerprint of the pair.
+ *
+ * Return:    The path, or NULL if it's not in the index (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_path_t *
+H5T__path_index_lookup(const H5T_t *src, const H5T_t *dst, uint64_t hash)
+{
+    size_t      mask;             /* Mask for slot numbers */
+    size_t      slot;             /* Slot being probed */
+    H5T_path_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(H5T_g.index);
+
+    mask = H5T_g.aindex - 1;
+    for (slot = (size_t)hash & mask; H5T_g.index[slot]; slot = (slot + 1) & mask) {
+        H5T_path_t *path = H5T_g.index[slot];
+
+        if (path->hash == hash && 0 == H5T_cmp(src, path->src, FALSE) && 0 == H5T_cmp(dst, path->dst, FALSE))
+            HGOTO_DONE(path)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__path_index_lookup() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5T_path_noop
  *
@@ -5543,6 +6042,488 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_convert() */
 
+#ifdef H5T_CONV_HAVE_THREADS
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_nthreads
+ *
+ * Purpose:   Decide how many threads, up to MAX_NTHREADS, a conversion
+ *            can be split across, returning 0 in *NTHREADS if it must be
+ *            done in the caller.
+ *
+ *            Two kinds of library conversions are split, since their
+ *            pieces need no datatype IDs, API context or conversion path
+ *            and can't fail:
+ *
+ *            - The hard conversions between native integer and
+ *              floating-point types, when there's no conversion
+ *              exception callback.  Without one they are plain loops
+ *              over packed or strided elements (see H5T_CONV in
+ *              H5Tconv.c).
+ *
+ *            - Byte order conversions of packed integer, floating-point
+ *              and bitfield elements, through H5T__conv_swap().
+ *
+ *            The other conversion functions look up their datatypes by
+ *            ID, update the path's conversion data or push errors, which
+ *            only the thread holding the library's lock may do.
+ *            (Compound conversions are split a member at a time instead,
+ *            since H5T__conv_struct_opt() converts each member through
+ *            H5T_convert_mt().)
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_nthreads(const H5T_path_t *tpath, size_t nelmts, size_t buf_stride, unsigned max_nthreads,
+                   unsigned *nthreads)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(tpath);
+    HDassert(nthreads);
+
+    *nthreads = 0;
+
+    if (max_nthreads == 0 || nelmts < H5T_CONV_MIN_THREAD_NELMTS)
+        HGOTO_DONE(SUCCEED)
+    if (tpath->is_noop || tpath->conv.is_app)
+        HGOTO_DONE(SUCCEED)
+    if (tpath->is_hard) {
+#ifdef H5T_DEBUG
+        /* (The conversions count elements in the path's conversion data) */
+        HGOTO_DONE(SUCCEED)
+#else
+        H5T_conv_cb_t cb_struct; /* Conversion exception callback */
+
+        if (tpath->conv.u.lib_func == H5T__conv_noop)
+            HGOTO_DONE(SUCCEED)
+        if (H5CX_get_dt_conv_cb(&cb_struct) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+        if (cb_struct.func)
+            HGOTO_DONE(SUCCEED)
+#endif /* H5T_DEBUG */
+    } /* end if */
+    else {
+        if (buf_stride || tpath->cdata.recalc)
+            HGOTO_DONE(SUCCEED)
+        if (tpath->conv.u.lib_func != H5T__conv_order && tpath->conv.u.lib_func != H5T__conv_order_opt)
+            HGOTO_DONE(SUCCEED)
+        if (tpath->src->shared->type != H5T_INTEGER && tpath->src->shared->type != H5T_FLOAT &&
+            tpath->src->shared->type != H5T_BITFIELD)
+            HGOTO_DONE(SUCCEED)
+    } /* end else */
+
+    *nthreads =
+        (unsigned)MIN3((size_t)max_nthreads, nelmts / H5T_CONV_MIN_THREAD_NELMTS, H5T_CONV_MAX_THREADS);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__convert_piece
+ *
+ * Purpose:   Convert one piece of a split conversion, in whichever thread
+ *            takes it.
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__convert_piece(const H5T_conv_work_t *work)
+{
+    H5T_conv_req_t *req = work->req;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (req->func) {
+        H5T_cdata_t cdata = req->cdata;      /* This thread's copy of the conversion data */
+        herr_t H5_ATTR_NDEBUG_UNUSED status; /* Status of the conversion */
+
+        /* The invalid IDs tell the hard conversion that it has no exception
+         * callback and mustn't use the API context (see H5T_CONV)
+         */
+        status = (req->func)(H5I_INVALID_HID, H5I_INVALID_HID, &cdata, work->nelmts, req->buf_stride,
+                             (size_t)0, work->buf, NULL);
+        HDassert(status >= 0);
+    } /* end if */
+    else
+        H5T__conv_swap(work->buf, req->src_size, work->nelmts);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__convert_piece() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__convert_thread
+ *
+ * Purpose:   Conversion thread: converts queued pieces until the library
+ *            shuts the pool down.
+ *
+ * Return:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5T__convert_thread(void H5_ATTR_UNUSED *udata)
+{
+    H5T_conv_pool_t *pool = &H5T_conv_pool_g;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5TS_mutex_lock_simple(&pool->lock);
+    for (;;) {
+        H5T_conv_work_t *work; /* Piece to convert */
+
+        while (!pool->shutdown && NULL == pool->head)
+            HDpthread_cond_wait(&pool->work_cond, &pool->lock);
+        if (NULL == (work = pool->head))
+            break;
+        if (NULL == (pool->head = work->next))
+            pool->tail = NULL;
+        H5TS_mutex_unlock_simple(&pool->lock);
+
+        H5T__convert_piece(work);
+
+        H5TS_mutex_lock_simple(&pool->lock);
+        if (0 == --work->req->npending)
+            HDpthread_cond_broadcast(&pool->done_cond);
+    } /* end for */
+    H5TS_mutex_unlock_simple(&pool->lock);
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5T__convert_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__convert_split
+ *
+ * Purpose:   Split the conversion of NELMTS elements of BUF into
+ *            NTHREADS contiguous pieces, each converted in place, and
+ *            queue them for the conversion threads, starting more
+ *            threads if the pool has fewer than that.  When ASYNC is
+ *            false, the caller converts the first piece itself.
+ *
+ *            A packed conversion between types of different sizes can't
+ *            have its pieces converted in place side by side, so they
+ *            are moved around the conversion: a widening conversion's
+ *            pieces are first moved to where their results go, and a
+ *            narrowing conversion's results are packed together by
+ *            H5T_convert_wait().
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__convert_split(H5T_conv_req_t *req, const H5T_path_t *tpath, size_t nelmts, size_t buf_stride,
+                   void *buf, unsigned nthreads, hbool_t async)
+{
+    H5T_conv_pool_t *pool = &H5T_conv_pool_g;
+    unsigned         u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(nthreads > 0 && nthreads <= H5T_CONV_MAX_THREADS);
+
+    req->func          = tpath->is_hard ? tpath->conv.u.lib_func : NULL;
+    req->cdata         = tpath->cdata;
+    req->cdata.command = H5T_CONV_CONV;
+    req->src_size      = tpath->src->shared->size;
+    req->dst_size      = tpath->dst->shared->size;
+    req->buf_stride    = buf_stride;
+    req->buf           = (uint8_t *)buf;
+    req->nwork         = nthreads;
+    req->npending      = async ? nthreads : nthreads - 1;
+    HDassert(req->func || req->src_size == req->dst_size);
+
+    /* Each piece converts in place from where its results go, so widening
+     * pieces are moved there first (the last one first, so none overwrites
+     * another that hasn't moved yet)
+     */
+    for (u = nthreads; u > 0; u--) {
+        H5T_conv_work_t *work  = &req->work[u - 1];
+        size_t           start = (nelmts * (u - 1)) / nthreads;
+
+        work->req    = req;
+        work->next   = NULL;
+        work->start  = start;
+        work->nelmts = ((nelmts * u) / nthreads) - start;
+        if (buf_stride)
+            work->buf = req->buf + (start * buf_stride);
+        else if (req->dst_size > req->src_size) {
+            work->buf = req->buf + (start * req->dst_size);
+            HDmemmove(work->buf, req->buf + (start * req->src_size), work->nelmts * req->src_size);
+        } /* end if */
+        else
+            work->buf = req->buf + (start * req->src_size);
+    } /* end for */
+
+    /* Queue the pieces, starting threads for them as needed.  Pieces that
+     * no thread takes are converted by H5T_convert_wait().
+     */
+    H5TS_mutex_lock_simple(&pool->lock);
+    for (u = async ? 0 : 1; u < nthreads; u++) {
+        if (pool->tail)
+            pool->tail->next = &req->work[u];
+        else
+            pool->head = &req->work[u];
+        pool->tail = &req->work[u];
+    } /* end for */
+    while (pool->nthreads < nthreads && !pool->shutdown &&
+           0 == HDpthread_create(&pool->threads[pool->nthreads], NULL, H5T__convert_thread, NULL))
+        pool->nthreads++;
+    HDpthread_cond_broadcast(&pool->work_cond);
+    H5TS_mutex_unlock_simple(&pool->lock);
+
+    if (!async)
+        H5T__convert_piece(&req->work[0]);
+
+    H5T_conv_nsplit_g++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__convert_split() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T__conv_pool_term
+ *
+ * Purpose:   Stop the conversion threads, when the library shuts down.
+ *            No conversions are running then, since each is waited for
+ *            by the thread that started it.
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_pool_term(void)
+{
+    H5T_conv_pool_t *pool = &H5T_conv_pool_g;
+    unsigned         nthreads; /* Number of threads to join */
+    unsigned         u;        /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5TS_mutex_lock_simple(&pool->lock);
+    HDassert(NULL == pool->head);
+    nthreads       = pool->nthreads;
+    pool->shutdown = TRUE;
+    HDpthread_cond_broadcast(&pool->work_cond);
+    H5TS_mutex_unlock_simple(&pool->lock);
+
+    /* (The threads never take the library's lock, so they can be joined) */
+    for (u = 0; u < nthreads; u++)
+        (void)HDpthread_join(pool->threads[u], NULL);
+
+    /* Allow the pool to start again if the library does */
+    H5TS_mutex_lock_simple(&pool->lock);
+    pool->nthreads = 0;
+    pool->shutdown = FALSE;
+    H5TS_mutex_unlock_simple(&pool->lock);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_pool_term() */
+#endif /* H5T_CONV_HAVE_THREADS */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_mt
+ *
+ * Purpose:   Like H5T_convert(), but splits a large conversion across
+ *            up to NTHREADS threads when the conversion allows it (see
+ *            H5T__conv_nthreads and H5Pset_type_conv_nthreads).
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_mt(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t buf_stride,
+               size_t bkg_stride, void *buf, void *bkg, unsigned nthreads)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+#ifdef H5T_CONV_HAVE_THREADS
+    if (H5T__conv_nthreads(tpath, nelmts, buf_stride, nthreads, &nthreads) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't decide how to split datatype conversion")
+    if (nthreads > 1) {
+        H5T_conv_req_t *req;
+
+        if (NULL == (req = H5FL_CALLOC(H5T_conv_req_t)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate conversion request")
+        H5T__convert_split(req, tpath, nelmts, buf_stride, buf, nthreads, FALSE);
+        if (H5T_convert_wait(req) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#else
+    (void)nthreads;
+#endif /* H5T_CONV_HAVE_THREADS */
+
+    if (H5T_convert(tpath, src_id, dst_id, nelmts, buf_stride, bkg_stride, buf, bkg) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_mt() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_can_split
+ *
+ * Purpose:   Check whether large packed conversions along TPATH are split
+ *            across conversion threads, so that callers only set aside a
+ *            second buffer to overlap conversion with other work when the
+ *            conversion will really run in the background.
+ *
+ * Return:    TRUE/FALSE/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5T_convert_can_split(const H5T_path_t H5_ATTR_NDEBUG_UNUSED *tpath)
+{
+    htri_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(tpath);
+
+#ifdef H5T_CONV_HAVE_THREADS
+    {
+        unsigned nthreads; /* Number of threads a conversion would use */
+
+        if (H5T__conv_nthreads(tpath, (size_t)H5T_CONV_MIN_THREAD_NELMTS, (size_t)0, 1, &nthreads) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't decide how to split datatype conversion")
+        ret_value = (htri_t)(nthreads > 0);
+    }
+#endif /* H5T_CONV_HAVE_THREADS */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_can_split() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_start
+ *
+ * Purpose:   Start converting a packed buffer in up to NTHREADS other
+ *            threads, so the caller can do other work until it calls
+ *            H5T_convert_wait() on *REQ.  The caller must not touch BUF
+ *            or BKG until then.
+ *
+ *            Conversions that can't be split are done before returning;
+ *            H5T_convert_wait() must still be called.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_start(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, void *buf, void *bkg,
+                  unsigned nthreads, H5T_conv_req_t **req)
+{
+    H5T_conv_req_t *new_req   = NULL;    /* New conversion request */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(req);
+
+    if (NULL == (new_req = H5FL_CALLOC(H5T_conv_req_t)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate conversion request")
+
+#ifdef H5T_CONV_HAVE_THREADS
+    /* (Unlike H5T_convert_mt(), a single thread is worth using here,
+     *  since the caller keeps working meanwhile)
+     */
+    if (H5T__conv_nthreads(tpath, nelmts, (size_t)0, nthreads, &nthreads) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't decide how to split datatype conversion")
+    if (nthreads > 0) {
+        H5T__convert_split(new_req, tpath, nelmts, (size_t)0, buf, nthreads, TRUE);
+        *req    = new_req;
+        new_req = NULL;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#else
+    (void)nthreads;
+#endif /* H5T_CONV_HAVE_THREADS */
+
+    if (H5T_convert(tpath, src_id, dst_id, nelmts, (size_t)0, (size_t)0, buf, bkg) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+    *req    = new_req;
+    new_req = NULL;
+
+done:
+    if (new_req)
+        new_req = H5FL_FREE(H5T_conv_req_t, new_req);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_convert_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5T_convert_wait
+ *
+ * Purpose:   Wait for a conversion started with H5T_convert_start() to
+ *            finish, and release REQ.  Pieces no conversion thread has
+ *            taken yet are converted by the caller.
+ *
+ * Return:    SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_convert_wait(H5T_conv_req_t *req)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(req);
+
+#ifdef H5T_CONV_HAVE_THREADS
+    if (req->nwork > 0) {
+        H5T_conv_pool_t *pool = &H5T_conv_pool_g;
+        unsigned         u; /* Local index variable */
+
+        H5TS_mutex_lock_simple(&pool->lock);
+        while (req->npending > 0) {
+            H5T_conv_work_t *prev = NULL; /* Piece before WORK in the queue */
+            H5T_conv_work_t *work;        /* Piece of this request still queued */
+
+            for (work = pool->head; work && work->req != req; work = work->next)
+                prev = work;
+            if (work) {
+                if (prev)
+                    prev->next = work->next;
+                else
+                    pool->head = work->next;
+                if (pool->tail == work)
+                    pool->tail = prev;
+                H5TS_mutex_unlock_simple(&pool->lock);
+
+                H5T__convert_piece(work);
+
+                H5TS_mutex_lock_simple(&pool->lock);
+                req->npending--;
+            } /* end if */
+            else
+                HDpthread_cond_wait(&pool->done_cond, &pool->lock);
+        } /* end while */
+        H5TS_mutex_unlock_simple(&pool->lock);
+
+        /* Pack a narrowing conversion's results together */
+        if (!req->buf_stride && req->dst_size < req->src_size)
+            for (u = 1; u < req->nwork; u++)
+                HDmemmove(req->buf + (req->work[u].start * req->dst_size), req->work[u].buf,
+                          req->work[u].nelmts * req->dst_size);
+    } /* end if */
+#endif /* H5T_CONV_HAVE_THREADS */
+
+    req = H5FL_FREE(H5T_conv_req_t, req);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5T_convert_wait() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5T_oloc
  *
@@ -38,6 +38,16 @@
 /* Local Macros */
 /****************/
 
+/* The vectorized conversion kernels are compiled for SSE2 and AVX2 with
+ * H5_ATTR_TARGET() and only called after checking the CPU with H5_CPU_HAS().
+ */
+#ifdef H5_HAVE_X86_DISPATCH
+#include <immintrin.h>
+
+/* Swap the two bytes of each 16-bit word of an SSE2 vector */
+#define H5T_CONV_SSE2_SWAP16(V) _mm_or_si128(_mm_slli_epi16(V, 8), _mm_srli_epi16(V, 8))
+#endif /* H5_HAVE_X86_DISPATCH */
+
 /*
  * These macros are for the bodies of functions that convert buffers of one
  * atomic type to another using hardware.
@@ -767,18 +777,28 @@
                     CI_INC_SRC(s_mv)                                                                         \
                     CI_INC_DST(d_mv)                                                                         \
                                                                                                              \
-                    /* Get conversion exception callback property */                                         \
-                    if (H5CX_get_dt_conv_cb(&cb_struct) < 0)                                                 \
-                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL,                                         \
-                                    "unable to get conversion exception callback")                           \
+                    if (src_id == H5I_INVALID_HID && dst_id == H5I_INVALID_HID) {                            \
+                        /* One piece of a conversion split across threads, which */                          \
+                        /* has no exception callback and mustn't use the API */                              \
+                        /* context or IDs (see H5T_convert_mt) */                                            \
+                        cb_struct.func      = NULL;                                                          \
+                        cb_struct.user_data = NULL;                                                          \
+                        H5T_CONV_CLEAR_PREC(PREC) /*clear precision variables, or not */                     \
+                    }                                                                                        \
+                    else {                                                                                   \
+                        /* Get conversion exception callback property */                                     \
+                        if (H5CX_get_dt_conv_cb(&cb_struct) < 0)                                             \
+                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL,                                     \
+                                        "unable to get conversion exception callback")                       \
                                                                                                              \
-                    /* Get source and destination datatypes */                                               \
-                    if (NULL == (st = (H5T_t *)H5I_object(src_id)) ||                                        \
-                        NULL == (dt = (H5T_t *)H5I_object(dst_id)))                                          \
-                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,                                        \
-                                    "unable to dereference datatype object ID")                              \
+                        /* Get source and destination datatypes */                                           \
+                        if (NULL == (st = (H5T_t *)H5I_object(src_id)) ||                                    \
+                            NULL == (dt = (H5T_t *)H5I_object(dst_id)))                                      \
+                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,                                    \
+                                        "unable to dereference datatype object ID")                          \
                                                                                                              \
-                    H5T_CONV_SET_PREC(PREC) /*init precision variables, or not */                            \
+                        H5T_CONV_SET_PREC(PREC) /*init precision variables, or not */                        \
+                    }                                                                                        \
                                                                                                              \
                     /* The outer loop of the type conversion macro, controlling which */                     \
                     /* direction the buffer is walked */                                                     \
@@ -835,6 +855,11 @@
                             H5T_CONV_LOOP_OUTER(PRE_SNOALIGN, PRE_DALIGN, POST_SNOALIGN, POST_DALIGN, GUTS,  \
                                                 STYPE, DTYPE, src, d, ST, DT, D_MIN, D_MAX)                  \
                         }                                                                                    \
+                        else if (!cb_struct.func && s_stride == (ssize_t)sizeof(ST) &&                       \
+                                 d_stride == (ssize_t)sizeof(DT)) {                                          \
+                            /* Packed and aligned with no exception handling routine */                      \
+                            H5T_CONV_LOOP_BLOCK(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                    \
+                        }                                                                                    \
                         else {                                                                               \
                             /* Alignment is not required for both source and destination */                  \
                             H5T_CONV_LOOP_OUTER(PRE_SNOALIGN, PRE_DNOALIGN, POST_SNOALIGN, POST_DNOALIGN,    \
@@ -885,6 +910,16 @@ done:
 
 #define H5T_CONV_SET_PREC_N /*don't init precision variables */
 
+/* Clear the source & destination precision variables, which only matter for exceptions */
+#define H5T_CONV_CLEAR_PREC(PREC) H5_GLUE(H5T_CONV_CLEAR_PREC_, PREC)
+
+#define H5T_CONV_CLEAR_PREC_Y                                                                                \
+    {                                                                                                        \
+        sprec = dprec = 0;                                                                                   \
+    }
+
+#define H5T_CONV_CLEAR_PREC_N /*no precision variables */
+
 /* Macro defining action on source data which needs to be aligned (before main action) */
 #define H5T_CONV_LOOP_PRE_SALIGN(ST)                                                                         \
     {                                                                                                        \
@@ -967,6 +1002,69 @@ done:
         dst         = (DT *)dst_buf;                                                                         \
     }
 
+/* Number of elements converted per pass of the blocked conversion loop */
+#define H5T_CONV_BLOCK_NELMTS 128
+
+/* The inner loop for packed, aligned buffers when there's no exception
+ * handling routine.  Each block of converted values is staged in a local
+ * array and then copied out, so the compiler knows the loads and stores
+ * don't alias and is free to vectorize the conversion.  Staging a whole
+ * block before storing it is safe for in-place conversions because the
+ * outer loop only walks forward when the destination stride is no larger
+ * than the source stride, or when the elements don't overlap at all.
+ *
+ * Conversions the compiler can't vectorize on its own may supply a hand
+ * written kernel through their "_VEC" macro, which converts a prefix of
+ * the block and evaluates to the number of elements it handled.
+ */
+#define H5T_CONV_LOOP_BLOCK(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                        \
+    {                                                                                                        \
+        DT     dst_blk[H5T_CONV_BLOCK_NELMTS]; /*converted values of one block */                            \
+        size_t blk_nelmts;                     /*number of elements in the block */                          \
+        size_t u;                                                                                            \
+                                                                                                             \
+        for (elmtno = 0; elmtno < safe; elmtno += blk_nelmts) {                                              \
+            blk_nelmts = MIN(safe - elmtno, H5T_CONV_BLOCK_NELMTS);                                          \
+            u          = H5_GLUE(GUTS, _VEC)(STYPE, DTYPE, src, dst_blk, blk_nelmts);                        \
+            if (u == 0 && blk_nelmts == H5T_CONV_BLOCK_NELMTS) {                                             \
+                /* Fixed trip count, which the vectorizer prefers */                                         \
+                for (u = 0; u < H5T_CONV_BLOCK_NELMTS; u++)                                                  \
+                    H5T_CONV_LOOP_GUTS(H5_GLUE(GUTS, _NOEX), STYPE, DTYPE, src + u, dst_blk + u, ST, DT,     \
+                                       D_MIN, D_MAX)                                                         \
+            }                                                                                                \
+            else                                                                                             \
+                for (/*void*/; u < blk_nelmts; u++)                                                          \
+                    H5T_CONV_LOOP_GUTS(H5_GLUE(GUTS, _NOEX), STYPE, DTYPE, src + u, dst_blk + u, ST, DT,     \
+                                       D_MIN, D_MAX)                                                         \
+            HDmemcpy(dst, dst_blk, blk_nelmts * sizeof(DT));                                                 \
+            src += blk_nelmts;                                                                               \
+            dst += blk_nelmts;                                                                               \
+        }                                                                                                    \
+    }
+
+/* Hand written vector kernels for the blocked loop.  Only the floating-point
+ * narrowing conversion needs one: its range checks are floating-point
+ * comparisons, which the compiler won't turn into vector selects.
+ */
+#define H5T_CONV_xX_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_Xx_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_Ux_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_sU_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_uS_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_Su_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_su_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_us_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_xF_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_Fx_VEC(STYPE, DTYPE, S, D, N) 0
+#define H5T_CONV_Ff_VEC(STYPE, DTYPE, S, D, N) H5_GLUE4(H5T_CONV_Ff_VEC_, STYPE, _, DTYPE)(S, D, N)
+#ifdef H5_HAVE_X86_DISPATCH
+#define H5T_CONV_Ff_VEC_DOUBLE_FLOAT(S, D, N) (H5_CPU_HAS("sse2") ? H5T__conv_vec_double_float(S, D, N) : 0)
+#else
+#define H5T_CONV_Ff_VEC_DOUBLE_FLOAT(S, D, N) 0
+#endif
+#define H5T_CONV_Ff_VEC_LDOUBLE_FLOAT(S, D, N)  0
+#define H5T_CONV_Ff_VEC_LDOUBLE_DOUBLE(S, D, N) 0
+
 /* Macro to call the actual "guts" of the type conversion, or call the "no exception" guts */
 #ifdef H5_WANT_DCONV_EXCEPTION
 #define H5T_CONV_LOOP_GUTS(GUTS, STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                   \
@@ -1032,20 +1130,49 @@ done:
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
+/* Most sequences, and bytes of sequence data, read or written in a batch by H5T__conv_vlen() */
+#define H5T_VLEN_BATCH_NSEQ 1024
+#define H5T_VLEN_BATCH_SIZE (1024 * 1024)
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* A run of bytes copied unchanged from each source compound element to the
+ * destination, covering one or more members with identical types */
+typedef struct H5T_conv_struct_run_t {
+    size_t src_offset; /*offset of the run in a source element      */
+    size_t dst_offset; /*offset of the run in a destination element */
+    size_t size;       /*number of bytes in the run                 */
+} H5T_conv_struct_run_t;
+
 /* Conversion data for H5T__conv_struct() */
 typedef struct H5T_conv_struct_t {
-    int *             src2dst;     /*mapping from src to dst member num */
-    hid_t *           src_memb_id; /*source member type ID's         */
-    hid_t *           dst_memb_id; /*destination member type ID's         */
-    H5T_path_t **     memb_path;   /*conversion path for each member    */
-    H5T_subset_info_t subset_info; /*info related to compound subsets   */
-    unsigned          src_nmembs;  /*needed by free function            */
+    int *                  src2dst;     /*mapping from src to dst member num */
+    hid_t *                src_memb_id; /*source member type ID's         */
+    hid_t *                dst_memb_id; /*destination member type ID's         */
+    H5T_path_t **          memb_path;   /*conversion path for each member    */
+    H5T_subset_info_t      subset_info; /*info related to compound subsets   */
+    unsigned               src_nmembs;  /*needed by free function            */
+    H5T_conv_struct_run_t *copy_run;    /*merged runs of unconverted members */
+    unsigned               ncopy_runs;  /*number of copy runs                */
+    unsigned               nconv_membs; /*number of members needing conversion */
 } H5T_conv_struct_t;
 
+/* VL sequences read from or written to a file as a batch by H5T__conv_vlen() */
+typedef struct H5T_conv_vlen_batch_t {
+    size_t   nseq;      /*number of sequences in the batch          */
+    size_t   nalloc;    /*number of sequences there's room for      */
+    size_t   next;      /*next sequence to use, when reading        */
+    void **  vl;        /*file VL information for each sequence     */
+    void **  buf;       /*each sequence's data (NULL while staged)  */
+    size_t * len;       /*bytes to read, or elements written        */
+    size_t * off;       /*offset of each sequence's data in 'data'  */
+    uint8_t *data;      /*sequence data held for the batch          */
+    size_t   data_used; /*bytes of 'data' in use                    */
+    size_t   data_size; /*bytes allocated for 'data'                */
+} H5T_conv_vlen_batch_t;
+
 /* Conversion data for H5T__conv_enum() */
 typedef struct H5T_enum_struct_t {
     int      base;    /*lowest `in' value             */
@@ -1068,6 +1195,18 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T__reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static herr_t H5T__conv_vlen_batch_init(H5T_conv_vlen_batch_t *batch, size_t nelmts);
+static herr_t H5T__conv_vlen_batch_read(H5T_conv_vlen_batch_t *batch, const H5T_t *src, uint8_t *s,
+                                        ssize_t s_stride, size_t nelmts, size_t base_size);
+static herr_t H5T__conv_vlen_batch_add(H5T_conv_vlen_batch_t *batch, const H5T_t *dst, void *d, void *b,
+                                       void *seq, hbool_t direct, size_t seq_len, size_t base_size);
+static herr_t H5T__conv_vlen_batch_flush(H5T_conv_vlen_batch_t *batch, const H5T_t *dst, size_t base_size);
+static void   H5T__conv_vlen_batch_free(H5T_conv_vlen_batch_t *batch);
+#ifdef H5_HAVE_X86_DISPATCH
+static size_t H5T__conv_vec_double_float(const double *src, float *dst, size_t nelmts);
+static size_t H5T__conv_vec_swap(uint8_t *buf, size_t size, size_t nelmts);
+static size_t H5T__conv_vec_swap_avx2(uint8_t *buf, size_t size, size_t nelmts);
+#endif /* H5_HAVE_X86_DISPATCH */
 
 /*********************/
 /* Public Variables */
@@ -1136,6 +1275,183 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_noop() */
 
+#ifdef H5_HAVE_X86_DISPATCH
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_float
+ *
+ * Purpose:     Convert a packed array of native `double' to native `float'
+ *              with SSE2, four values at a time.  Values outside the range
+ *              of `float' become infinities, exactly as in the scalar
+ *              H5T_CONV_Ff_NOEX_CORE.  SRC and DST may be the same buffer.
+ *
+ * Return:      Number of elements converted, a multiple of four
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("sse2")
+static size_t
+H5T__conv_vec_double_float(const double *src, float *dst, size_t nelmts)
+{
+    const __m128d hi_lim = _mm_set1_pd((double)FLT_MAX);
+    const __m128d lo_lim = _mm_set1_pd((double)-FLT_MAX);
+    const __m128  pinf   = _mm_set1_ps(H5T_NATIVE_FLOAT_POS_INF_g);
+    const __m128  ninf   = _mm_set1_ps(H5T_NATIVE_FLOAT_NEG_INF_g);
+    size_t        u;
+    size_t        ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u + 4 <= nelmts; u += 4) {
+        __m128d s0 = _mm_loadu_pd(src + u);
+        __m128d s1 = _mm_loadu_pd(src + u + 2);
+        __m128  d  = _mm_movelh_ps(_mm_cvtpd_ps(s0), _mm_cvtpd_ps(s1));
+        __m128  hi = _mm_shuffle_ps(_mm_castpd_ps(_mm_cmpgt_pd(s0, hi_lim)),
+                                   _mm_castpd_ps(_mm_cmpgt_pd(s1, hi_lim)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128  lo = _mm_shuffle_ps(_mm_castpd_ps(_mm_cmplt_pd(s0, lo_lim)),
+                                   _mm_castpd_ps(_mm_cmplt_pd(s1, lo_lim)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        d = _mm_or_ps(_mm_and_ps(hi, pinf), _mm_andnot_ps(hi, d));
+        d = _mm_or_ps(_mm_and_ps(lo, ninf), _mm_andnot_ps(lo, d));
+        _mm_storeu_ps(dst + u, d);
+    } /* end for */
+
+    ret_value = u;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vec_double_float() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_swap
+ *
+ * Purpose:     Reverse the bytes of each element of a packed array in
+ *              place, sixteen bytes at a time.  SSE2 has no byte shuffle,
+ *              so elements are reversed as 16-bit words with the word
+ *              shuffles and then the bytes within each word are swapped
+ *              with shifts.  Uses the AVX2 kernel when the CPU has it.
+ *
+ * Return:      Number of elements swapped
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("sse2")
+static size_t
+H5T__conv_vec_swap(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t nbytes    = (size * nelmts) & ~(size_t)15;
+    size_t u;
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size == 2 || size == 4 || size == 8 || size == 16);
+
+    if (H5_CPU_HAS("avx2"))
+        HGOTO_DONE(H5T__conv_vec_swap_avx2(buf, size, nelmts))
+
+    /* Keep the size switch outside the loops, so each loop is just a few
+     * shuffles and shifts */
+    switch (size) {
+        case 2:
+            for (u = 0; u < nbytes; u += 16) {
+                __m128i v = _mm_loadu_si128((const void *)(buf + u));
+
+                _mm_storeu_si128((void *)(buf + u), H5T_CONV_SSE2_SWAP16(v));
+            } /* end for */
+            break;
+
+        case 4:
+            for (u = 0; u < nbytes; u += 16) {
+                __m128i v = _mm_loadu_si128((const void *)(buf + u));
+
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+                _mm_storeu_si128((void *)(buf + u), H5T_CONV_SSE2_SWAP16(v));
+            } /* end for */
+            break;
+
+        case 8:
+            for (u = 0; u < nbytes; u += 16) {
+                __m128i v = _mm_loadu_si128((const void *)(buf + u));
+
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);
+                _mm_storeu_si128((void *)(buf + u), H5T_CONV_SSE2_SWAP16(v));
+            } /* end for */
+            break;
+
+        case 16:
+        default:
+            for (u = 0; u < nbytes; u += 16) {
+                __m128i v = _mm_loadu_si128((const void *)(buf + u));
+
+                v = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B), 0x4E);
+                _mm_storeu_si128((void *)(buf + u), H5T_CONV_SSE2_SWAP16(v));
+            } /* end for */
+            break;
+    } /* end switch */
+
+    ret_value = nbytes / size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vec_swap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_swap_avx2
+ *
+ * Purpose:     AVX2 version of H5T__conv_vec_swap(), reversing the bytes
+ *              of 32 bytes' worth of elements with a single byte shuffle.
+ *
+ * Return:      Number of elements swapped
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("avx2")
+static size_t
+H5T__conv_vec_swap_avx2(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t  nbytes = (size * nelmts) & ~(size_t)31;
+    __m256i mask;
+    size_t  u;
+    size_t  ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* The shuffle works within each 128-bit lane, which holds whole elements */
+    switch (size) {
+        case 2:
+            mask = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7,
+                                    6, 9, 8, 11, 10, 13, 12, 15, 14);
+            break;
+
+        case 4:
+            mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5,
+                                    4, 11, 10, 9, 8, 15, 14, 13, 12);
+            break;
+
+        case 8:
+            mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+                                    0, 15, 14, 13, 12, 11, 10, 9, 8);
+            break;
+
+        case 16:
+        default:
+            mask = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11,
+                                    10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            break;
+    } /* end switch */
+
+    for (u = 0; u < nbytes; u += 32) {
+        __m256i v = _mm256_loadu_si256((const void *)(buf + u));
+
+        _mm256_storeu_si256((void *)(buf + u), _mm256_shuffle_epi8(v, mask));
+    } /* end for */
+
+    ret_value = nbytes / size;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vec_swap_avx2() */
+#endif /* H5_HAVE_X86_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_order_opt
  *
@@ -1242,6 +1558,18 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmt
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+#ifdef H5_HAVE_X86_DISPATCH
+            /* Swap packed elements with vector instructions, leaving any
+             * remainder to the loops below */
+            if (buf_stride == src->shared->size && src->shared->size > 1 && H5_CPU_HAS("sse2")) {
+                size_t nswapped = H5T__conv_vec_swap(buf, src->shared->size, nelmts);
+
+                buf += nswapped * buf_stride;
+                nelmts -= nswapped;
+            } /* end if */
+#endif /* H5_HAVE_X86_DISPATCH */
+
             switch (src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -1645,6 +1973,45 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_order() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_swap
+ *
+ * Purpose:     Reverse the bytes of each of NELMTS packed elements of SIZE
+ *              bytes, as H5T__conv_order() and H5T__conv_order_opt() do
+ *              for integer, floating-point and bitfield types.  Unlike
+ *              them, this needs no datatype IDs or conversion data and
+ *              can't fail, so threads may run it on parts of a buffer
+ *              without the library's lock.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__conv_swap(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t i, j, md;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5_HAVE_X86_DISPATCH
+    /* Swap with vector instructions, leaving any remainder to the loop below */
+    if ((size == 2 || size == 4 || size == 8 || size == 16) && H5_CPU_HAS("sse2")) {
+        size_t nswapped = H5T__conv_vec_swap(buf, size, nelmts);
+
+        buf += nswapped * size;
+        nelmts -= nswapped;
+    } /* end if */
+#endif /* H5_HAVE_X86_DISPATCH */
+
+    md = size / 2;
+    for (i = 0; i < nelmts; i++, buf += size)
+        for (j = 0; j < md; j++)
+            H5_SWAP_BYTES(buf, j, size - (j + 1));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_swap() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_b_b
  *
@@ -1928,6 +2295,7 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->copy_run);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T__conv_struct_free() */
@@ -1971,6 +2339,14 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
  *              The optimization is simply moving data to the appropriate
  *              places in the buffer.
  *
+ *              The conversion is also compiled into a plan: members whose
+ *              types are the same in the source and destination are
+ *              merged into runs of bytes which are simply copied, and only
+ *              the remaining members are converted.  When every byte of
+ *              the destination is written by some member, the background
+ *              buffer's contents aren't needed, and when no member needs
+ *              converting, no background buffer is needed at all.
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Robb Matzke
@@ -1984,6 +2360,8 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     H5T_conv_struct_t *priv    = (H5T_conv_struct_t *)(cdata->priv);
     int *              src2dst = NULL;
     unsigned           src_nmembs, dst_nmembs;
+    unsigned           nmapped  = 0;     /* Number of source members in the destination */
+    hbool_t            memb_bkg = FALSE; /* Whether a member conversion needs a background */
     unsigned           i, j;
     herr_t             ret_value = SUCCEED; /* Return value */
 
@@ -2075,8 +2453,67 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
         }     /* end if */
     }         /* end for */
 
-    /* The compound conversion functions need a background buffer */
+    /* Build the runs of members copied without conversion.  The source
+     * members are sorted by offset, so a run grows while the next member
+     * also follows on in the destination.
+     */
+    H5MM_xfree(priv->copy_run);
+    priv->copy_run    = NULL;
+    priv->ncopy_runs  = 0;
+    priv->nconv_membs = 0;
+    for (i = 0; i < src_nmembs; i++) {
+        const H5T_cmemb_t *src_memb, *dst_memb;
+
+        if (src2dst[i] < 0)
+            continue;
+        nmapped++;
+        if (!priv->memb_path[i]->is_noop) {
+            if (H5T_BKG_YES == priv->memb_path[i]->cdata.need_bkg)
+                memb_bkg = TRUE;
+            priv->nconv_membs++;
+            continue;
+        } /* end if */
+
+        src_memb = &src->shared->u.compnd.memb[i];
+        dst_memb = &dst->shared->u.compnd.memb[src2dst[i]];
+        if (priv->ncopy_runs > 0) {
+            H5T_conv_struct_run_t *run = &priv->copy_run[priv->ncopy_runs - 1];
+
+            if (run->src_offset + run->size == src_memb->offset &&
+                run->dst_offset + run->size == dst_memb->offset) {
+                run->size += dst_memb->size;
+                continue;
+            } /* end if */
+        }     /* end if */
+        if (NULL == priv->copy_run &&
+            NULL == (priv->copy_run =
+                         (H5T_conv_struct_run_t *)H5MM_malloc(src_nmembs * sizeof(H5T_conv_struct_run_t)))) {
+            cdata->priv = H5T__conv_struct_free(priv);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        } /* end if */
+        priv->copy_run[priv->ncopy_runs].src_offset = src_memb->offset;
+        priv->copy_run[priv->ncopy_runs].dst_offset = dst_memb->offset;
+        priv->copy_run[priv->ncopy_runs].size       = dst_memb->size;
+        priv->ncopy_runs++;
+    } /* end for */
+
+    /* The compound conversion functions need a background buffer, unless
+     * every destination member has a source member and there are no gaps
+     * between them and no member conversion needs its destination's values.
+     * (The destination members are sorted by offset.)
+     */
     cdata->need_bkg = H5T_BKG_YES;
+    if (!memb_bkg && priv->ncopy_runs + priv->nconv_membs > 0 && nmapped == dst_nmembs) {
+        size_t covered = 0; /* Bytes of destination covered so far */
+
+        for (j = 0; j < dst_nmembs; j++) {
+            if (dst->shared->u.compnd.memb[j].offset != covered)
+                break;
+            covered += dst->shared->u.compnd.memb[j].size;
+        } /* end for */
+        if (covered == dst->shared->size)
+            cdata->need_bkg = priv->nconv_membs ? H5T_BKG_TEMP : H5T_BKG_NO;
+    } /* end if */
 
     if (src_nmembs < dst_nmembs) {
         priv->subset_info.subset = H5T_SUBSET_SRC;
@@ -2171,6 +2608,74 @@ H5T__conv_struct_subset(const H5T_cdata_t *cdata)
     FUNC_LEAVE_NOAPI((H5T_subset_info_t *)&priv->subset_info)
 } /* end H5T__conv_struct_subset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_struct_copy
+ *
+ * Purpose:     Copies the runs of unconverted members of NELMTS compound
+ *              elements in BUF to the background buffer BKG.  If BKG is
+ *              NULL, every destination member must come from a copy run,
+ *              and the elements are rearranged within BUF instead,
+ *              completing the conversion.
+ *
+ *              Strides are interpreted as for H5T__conv_struct_opt().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_struct_copy(const H5T_conv_struct_t *priv, size_t src_size, size_t dst_size, size_t nelmts,
+                      size_t buf_stride, size_t bkg_stride, uint8_t *buf, uint8_t *bkg)
+{
+    const H5T_conv_struct_run_t *run;                 /* Copy run */
+    uint8_t *                    tmp = NULL;          /* One rearranged element */
+    uint8_t *                    xdst;                /* Destination of rearranged element */
+    size_t                       src_step, dst_step;  /* Distance between elements */
+    size_t                       elmtno;              /* Element counter */
+    unsigned                     u;                   /* Local index variable */
+    herr_t                       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(priv);
+    HDassert(buf);
+
+    src_step = buf_stride ? buf_stride : src_size;
+
+    if (bkg) {
+        dst_step = (buf_stride && bkg_stride) ? bkg_stride : dst_size;
+        for (elmtno = 0; elmtno < nelmts; elmtno++) {
+            for (u = 0, run = priv->copy_run; u < priv->ncopy_runs; u++, run++)
+                H5MM_memcpy(bkg + run->dst_offset, buf + run->src_offset, run->size);
+            buf += src_step;
+            bkg += dst_step;
+        } /* end for */
+    }     /* end if */
+    else {
+        /* Each element is no larger than before, since nothing is converted,
+         * so the elements can be rearranged in order from the start of the
+         * buffer.  They're assembled in a temporary buffer because an
+         * element's runs may overlap each other's destinations.
+         */
+        HDassert(dst_size <= src_size);
+        dst_step = buf_stride ? buf_stride : dst_size;
+        if (NULL == (tmp = (uint8_t *)H5MM_malloc(dst_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for (elmtno = 0, xdst = buf; elmtno < nelmts; elmtno++) {
+            for (u = 0, run = priv->copy_run; u < priv->ncopy_runs; u++, run++)
+                H5MM_memcpy(tmp + run->dst_offset, buf + run->src_offset, run->size);
+            HDmemmove(xdst, tmp, dst_size);
+            buf += src_step;
+            xdst += dst_step;
+        } /* end for */
+    }     /* end else */
+
+done:
+    H5MM_xfree(tmp);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_struct_copy() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_struct
  *
@@ -2253,7 +2758,6 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if (NULL == (src = (H5T_t *)H5I_object(src_id)) || NULL == (dst = (H5T_t *)H5I_object(dst_id)))
                 HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a datatype")
             HDassert(priv);
-            HDassert(bkg && cdata->need_bkg);
 
             if (cdata->recalc && H5T__conv_struct_init(src, dst, cdata) < 0)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
@@ -2265,6 +2769,18 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             H5T__sort_value(dst, NULL);
             src2dst = priv->src2dst;
 
+            /* When no member needs converting and the destination is
+             * covered, the conversion is just a rearrangement of bytes.
+             */
+            if (H5T_BKG_NO == cdata->need_bkg) {
+                if (H5T__conv_struct_copy(priv, src->shared->size, dst->shared->size, nelmts, buf_stride,
+                                          bkg_stride, buf, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to copy compound members")
+                break;
+            } /* end if */
+            if (NULL == bkg)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "no background buffer for compound conversion")
+
             /*
              * Direction of conversion and striding through background.
              */
@@ -2297,11 +2813,15 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  * it is larger than the source type.  Then move the member to the
                  * left-most unoccupied position in the buffer.  This makes the
                  * data point as small as possible with all the free space on the
-                 * right side.
+                 * right side.  Members which aren't converted are copied
+                 * straight to the background buffer first.
                  */
+                for (u = 0; u < priv->ncopy_runs; u++)
+                    H5MM_memcpy(xbkg + priv->copy_run[u].dst_offset, xbuf + priv->copy_run[u].src_offset,
+                                priv->copy_run[u].size);
                 for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if (src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[u] < 0 || priv->memb_path[u]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
@@ -2330,8 +2850,8 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  */
                 H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
                 for (i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if (src2dst[i] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[i] < 0 || priv->memb_path[i]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + i;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[i];
 
@@ -2442,6 +2962,7 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
     size_t             copy_size;                  /*size of element for copying   */
     H5T_conv_struct_t *priv      = NULL;           /*private data            */
     hbool_t            no_stride = FALSE;          /*flag to indicate no stride    */
+    unsigned           nthreads  = 1;              /*number of conversion threads  */
     unsigned           u;                          /*counters            */
     int                i;                          /*counters            */
     herr_t             ret_value = SUCCEED;        /* Return value */
@@ -2526,7 +3047,6 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
             priv = (H5T_conv_struct_t *)(cdata->priv);
             HDassert(priv);
             src2dst = priv->src2dst;
-            HDassert(bkg && cdata->need_bkg);
 
             /*
              * Insure that members are sorted.
@@ -2534,6 +3054,18 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
             H5T__sort_value(src, NULL);
             H5T__sort_value(dst, NULL);
 
+            /* When no member needs converting and the destination is
+             * covered, the conversion is just a rearrangement of bytes.
+             */
+            if (H5T_BKG_NO == cdata->need_bkg) {
+                if (H5T__conv_struct_copy(priv, src->shared->size, dst->shared->size, nelmts, buf_stride,
+                                          bkg_stride, buf, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to copy compound members")
+                break;
+            } /* end if */
+            if (NULL == bkg)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "no background buffer for compound conversion")
+
             /*
              * Calculate strides. If BUF_STRIDE is non-zero then convert one
              * data element at every BUF_STRIDE bytes through the main buffer
@@ -2568,6 +3100,17 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                 } /* end for */
             }     /* end if */
             else {
+                /* Each member's conversion may be split across threads */
+                if (H5CX_get_conv_nthreads(&nthreads) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get conversion thread count")
+
+                /* Copy the members which aren't converted straight to the bkg
+                 * buffer, before the buffer is rearranged below.
+                 */
+                if (priv->ncopy_runs > 0 && H5T__conv_struct_copy(priv, src->shared->size, dst->shared->size,
+                                                                  nelmts, buf_stride, bkg_stride, buf, bkg) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to copy compound members")
+
                 /*
                  * For each member where the destination is not larger than the
                  * source, stride through all the elements converting only that member
@@ -2576,17 +3119,17 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                  * left as possible in the buffer.
                  */
                 for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if (src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[u] < 0 || priv->memb_path[u]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
                     if (dst_memb->size <= src_memb->size) {
                         xbuf = buf + src_memb->offset;
                         xbkg = bkg + dst_memb->offset;
-                        if (H5T_convert(priv->memb_path[u], priv->src_memb_id[u],
-                                        priv->dst_memb_id[src2dst[u]], nelmts, buf_stride, bkg_stride, xbuf,
-                                        xbkg) < 0)
+                        if (H5T_convert_mt(priv->memb_path[u], priv->src_memb_id[u],
+                                           priv->dst_memb_id[src2dst[u]], nelmts, buf_stride, bkg_stride,
+                                           xbuf, xbkg, nthreads) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
                                         "unable to convert compound datatype member")
                         for (elmtno = 0; elmtno < nelmts; elmtno++) {
@@ -2612,7 +3155,7 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                  */
                 H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
                 for (i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if (src2dst[i] < 0)
+                    if (src2dst[i] < 0 || priv->memb_path[i]->is_noop)
                         continue;
                     src_memb = src->shared->u.compnd.memb + i;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[i];
@@ -2621,9 +3164,9 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                         offset -= src_memb->size;
                         xbuf = buf + offset;
                         xbkg = bkg + dst_memb->offset;
-                        if (H5T_convert(priv->memb_path[i], priv->src_memb_id[i],
-                                        priv->dst_memb_id[src2dst[i]], nelmts, buf_stride, bkg_stride, xbuf,
-                                        xbkg) < 0)
+                        if (H5T_convert_mt(priv->memb_path[i], priv->src_memb_id[i],
+                                           priv->dst_memb_id[src2dst[i]], nelmts, buf_stride, bkg_stride,
+                                           xbuf, xbkg, nthreads) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
                                         "unable to convert compound datatype member")
                         for (elmtno = 0; elmtno < nelmts; elmtno++) {
@@ -3075,6 +3618,239 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_enum_numeric() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_init
+ *
+ * Purpose:     Sets up a batch of VL sequences for a conversion of NELMTS
+ *              elements.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_init(H5T_conv_vlen_batch_t *batch, size_t nelmts)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+
+    batch->nalloc    = MIN(nelmts, H5T_VLEN_BATCH_NSEQ);
+    batch->data_size = H5T_VLEN_MIN_CONF_BUF_SIZE;
+    if (NULL == (batch->vl = (void **)H5MM_malloc(batch->nalloc * sizeof(void *))) ||
+        NULL == (batch->buf = (void **)H5MM_malloc(batch->nalloc * sizeof(void *))) ||
+        NULL == (batch->len = (size_t *)H5MM_malloc(batch->nalloc * sizeof(size_t))) ||
+        NULL == (batch->off = (size_t *)H5MM_malloc(batch->nalloc * sizeof(size_t))) ||
+        NULL == (batch->data = (uint8_t *)H5MM_malloc(batch->data_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for VL sequence batch")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_read
+ *
+ * Purpose:     Reads the data for the next batch of VL sequences in the
+ *              file, starting at element S and looking at no more than
+ *              NELMTS elements.  The batch ends when it holds as many
+ *              sequences or bytes of data as a batch may, and always
+ *              holds at least one sequence if there are any.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_read(H5T_conv_vlen_batch_t *batch, const H5T_t *src, uint8_t *s, ssize_t s_stride,
+                          size_t nelmts, size_t base_size)
+{
+    size_t total = 0;           /* Bytes of data in the batch */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(src);
+    HDassert(src->shared->u.vlen.cls->read_multi);
+
+    batch->nseq = batch->next = 0;
+    for (u = 0; u < nelmts && batch->nseq < batch->nalloc; u++, s += s_stride) {
+        hbool_t is_nil;  /* Whether sequence is "nil" */
+        size_t  seq_len; /* The number of elements in the sequence */
+
+        if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &is_nil) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check if VL data is 'nil'")
+        if (is_nil)
+            continue;
+        if ((*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &seq_len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
+
+        if (batch->nseq > 0 && total + seq_len * base_size > H5T_VLEN_BATCH_SIZE)
+            break;
+
+        batch->vl[batch->nseq]  = s;
+        batch->len[batch->nseq] = seq_len * base_size;
+        batch->off[batch->nseq] = total;
+        total += batch->len[batch->nseq];
+        batch->nseq++;
+    } /* end for */
+
+    /* Make room for the batch's data */
+    if (batch->data_size < total) {
+        uint8_t *new_data; /* Resized data buffer */
+
+        if (NULL == (new_data = (uint8_t *)H5MM_realloc(batch->data, total)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for VL sequence batch")
+        batch->data      = new_data;
+        batch->data_size = total;
+    } /* end if */
+    for (u = 0; u < batch->nseq; u++)
+        batch->buf[u] = batch->data + batch->off[u];
+
+    /* Read in the VL sequences */
+    if ((*(src->shared->u.vlen.cls->read_multi))(src->shared->u.vlen.file, batch->nseq, batch->vl, batch->buf,
+                                                 batch->len) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_add
+ *
+ * Purpose:     Adds a VL sequence to the batch to be written to the file,
+ *              writing out the batch first if it's full.  The sequence's
+ *              data is copied into the batch, unless DIRECT is set, when
+ *              SEQ is the application's own buffer and will stay valid
+ *              until the batch is written.  Any old data in the file for
+ *              the element, given by B, is deleted now.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_add(H5T_conv_vlen_batch_t *batch, const H5T_t *dst, void *d, void *b, void *seq,
+                         hbool_t direct, size_t seq_len, size_t base_size)
+{
+    size_t size      = seq_len * base_size; /* Bytes of data in the sequence */
+    herr_t ret_value = SUCCEED;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(dst);
+    HDassert(dst->shared->u.vlen.cls->write_multi);
+
+    /* Write out the sequences so far, if there isn't room for this one */
+    if (batch->nseq == batch->nalloc ||
+        (batch->nseq > 0 && !direct && batch->data_used + size > H5T_VLEN_BATCH_SIZE))
+        if (H5T__conv_vlen_batch_flush(batch, dst, base_size) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+
+    /* Free heap object for old data, if non-NULL */
+    if (b != NULL)
+        if ((*(dst->shared->u.vlen.cls->del))(dst->shared->u.vlen.file, b) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREMOVE, FAIL, "unable to remove background heap object")
+
+    batch->vl[batch->nseq]  = d;
+    batch->len[batch->nseq] = seq_len;
+    if (direct)
+        batch->buf[batch->nseq] = seq;
+    else {
+        /* Make room for the sequence's data */
+        if (batch->data_size < batch->data_used + size) {
+            size_t   new_size = MAX(2 * batch->data_size, batch->data_used + size); /* New buffer size */
+            uint8_t *new_data;                                                     /* Resized buffer */
+
+            if (NULL == (new_data = (uint8_t *)H5MM_realloc(batch->data, new_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                            "memory allocation failed for VL sequence batch")
+            batch->data      = new_data;
+            batch->data_size = new_size;
+        } /* end if */
+
+        if (size > 0)
+            H5MM_memcpy(batch->data + batch->data_used, seq, size);
+        batch->buf[batch->nseq] = NULL;
+        batch->off[batch->nseq] = batch->data_used;
+        batch->data_used += size;
+    } /* end else */
+    batch->nseq++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_flush
+ *
+ * Purpose:     Writes the batch of VL sequences to the file and empties it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_flush(H5T_conv_vlen_batch_t *batch, const H5T_t *dst, size_t base_size)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(batch);
+    HDassert(dst);
+
+    if (batch->nseq > 0) {
+        /* Point the staged sequences at their data, now it won't move */
+        for (u = 0; u < batch->nseq; u++)
+            if (NULL == batch->buf[u])
+                batch->buf[u] = batch->data + batch->off[u];
+
+        if ((*(dst->shared->u.vlen.cls->write_multi))(dst->shared->u.vlen.file, batch->nseq, batch->vl,
+                                                      (const void *const *)batch->buf, batch->len,
+                                                      base_size) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+    } /* end if */
+
+    batch->nseq      = 0;
+    batch->data_used = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_free
+ *
+ * Purpose:     Releases the memory for a batch of VL sequences.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vlen_batch_free(H5T_conv_vlen_batch_t *batch)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(batch);
+
+    batch->vl   = (void **)H5MM_xfree(batch->vl);
+    batch->buf  = (void **)H5MM_xfree(batch->buf);
+    batch->len  = (size_t *)H5MM_xfree(batch->len);
+    batch->off  = (size_t *)H5MM_xfree(batch->off);
+    batch->data = (uint8_t *)H5MM_xfree(batch->data);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vlen_batch_free() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_vlen
  *
@@ -3124,11 +3900,16 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
     void *                tmp_buf       = NULL;         /*temporary background buffer          */
     size_t                tmp_buf_size  = 0;            /*size of temporary bkg buffer         */
     hbool_t               nested        = FALSE;        /*flag of nested VL case             */
+    H5T_conv_vlen_batch_t rbatch;                       /*sequences read from the file together */
+    H5T_conv_vlen_batch_t wbatch;                       /*sequences written to the file together */
     size_t                elmtno;                       /*element number counter         */
     herr_t                ret_value = SUCCEED;          /* Return value */
 
     FUNC_ENTER_PACKAGE
 
+    HDmemset(&rbatch, 0, sizeof(rbatch));
+    HDmemset(&wbatch, 0, sizeof(wbatch));
+
     switch (cdata->command) {
         case H5T_CONV_INIT:
             /*
@@ -3247,6 +4028,18 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
             if (write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Read and write the sequences in files in batches, when there's
+             * more than one and the file's VL class can.  (The nested case
+             * reads each sequence's old data first, so it isn't batched.) */
+            if (nelmts > 1) {
+                if (src->shared->u.vlen.cls->read_multi)
+                    if (H5T__conv_vlen_batch_init(&rbatch, nelmts) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't set up VL sequence batch")
+                if (write_to_file && !nested && dst->shared->u.vlen.cls->write_multi)
+                    if (H5T__conv_vlen_batch_init(&wbatch, nelmts) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't set up VL sequence batch")
+            } /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while (nelmts > 0) {
@@ -3338,9 +4131,21 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                                 HDmemset(conv_buf, 0, conv_buf_size);
                             } /* end else-if */
 
-                            /* Read in VL sequence */
-                            if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s, conv_buf,
-                                                                   src_size) < 0)
+                            /* Read in VL sequence, from the current batch if there is one */
+                            if (rbatch.nalloc) {
+                                if (rbatch.next == rbatch.nseq)
+                                    if (H5T__conv_vlen_batch_read(&rbatch, src, s, s_stride, safe - elmtno,
+                                                                  src_base_size) < 0)
+                                        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                                HDassert(rbatch.next < rbatch.nseq);
+                                HDassert(rbatch.vl[rbatch.next] == s);
+                                HDassert(rbatch.len[rbatch.next] == src_size);
+                                if (src_size > 0)
+                                    H5MM_memcpy(conv_buf, rbatch.buf[rbatch.next], src_size);
+                                rbatch.next++;
+                            } /* end if */
+                            else if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s, conv_buf,
+                                                                        src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
                         } /* end else */
 
@@ -3397,9 +4202,15 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "datatype conversion failed")
                         } /* end if */
 
-                        /* Write sequence to destination location */
-                        if ((*(dst->shared->u.vlen.cls->write))(dst->shared->u.vlen.file, &vl_alloc_info, d,
-                                                                conv_buf, b, seq_len, dst_base_size) < 0)
+                        /* Write sequence to destination location, or add it to the batch */
+                        if (wbatch.nalloc) {
+                            if (H5T__conv_vlen_batch_add(&wbatch, dst, d, b, conv_buf, noop_conv, seq_len,
+                                                         dst_base_size) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                        } /* end if */
+                        else if ((*(dst->shared->u.vlen.cls->write))(dst->shared->u.vlen.file,
+                                                                     &vl_alloc_info, d, conv_buf, b, seq_len,
+                                                                     dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if (!noop_conv) {
@@ -3429,6 +4240,11 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                     b += b_stride;
                 } /* end for */
 
+                /* Finish the pass's batches */
+                if (wbatch.nalloc && H5T__conv_vlen_batch_flush(&wbatch, dst, dst_base_size) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                rbatch.nseq = rbatch.next = 0;
+
                 /* Decrement number of elements left to convert */
                 nelmts -= safe;
             } /* end while */
@@ -3454,6 +4270,9 @@ done:
     /* Release the background buffer, if we have one */
     if (tmp_buf)
         tmp_buf = H5FL_BLK_FREE(vlen_seq, tmp_buf);
+    /* Release the batches */
+    H5T__conv_vlen_batch_free(&rbatch);
+    H5T__conv_vlen_batch_free(&wbatch);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_vlen() */
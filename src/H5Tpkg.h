@@ -58,6 +58,18 @@
 /* Macro to ease detecting variable-length "string" datatypes */
 #define H5T_IS_VL_STRING(dt) (H5T_VLEN == (dt)->type && H5T_VLEN_STRING == (dt)->u.vlen.type)
 
+/* Conversions are only split across threads when the library is built
+ * thread-safe, since that is when it links with the thread package.
+ * (The allocation sanity checks keep global lists, so they rule threads
+ * out too.)
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+#define H5T_CONV_HAVE_THREADS
+#endif
+
+/* Fewest elements worth handing to a conversion thread */
+#define H5T_CONV_MIN_THREAD_NELMTS 16384
+
 /* Macro to ease detecting fixed or variable-length "string" datatypes */
 #define H5T_IS_STRING(dt) (H5T_IS_FIXED_STRING(dt) || H5T_IS_VL_STRING(dt))
 
@@ -176,6 +188,7 @@ struct H5T_path_t {
     hbool_t         is_hard;           /*is it a hard function?	     */
     hbool_t         is_noop;           /*is it the noop conversion?	     */
     hbool_t         are_compounds;     /*are source and dest both compounds?*/
+    uint64_t        hash;              /*fingerprint of src/dst, for the path index*/
     H5T_stats_t     stats;             /*statistics for the conversion	     */
     H5T_cdata_t     cdata;             /*data for this function	     */
 };
@@ -288,16 +301,23 @@ typedef herr_t (*H5T_vlen_read_func_t)(H5VL_object_t *file, void *_vl, void *buf
 typedef herr_t (*H5T_vlen_write_func_t)(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info,
                                         void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size);
 typedef herr_t (*H5T_vlen_delete_func_t)(H5VL_object_t *file, const void *_vl);
+typedef herr_t (*H5T_vlen_read_multi_func_t)(H5VL_object_t *file, size_t nseq, void *const vl[],
+                                             void *const buf[], const size_t len[]);
+typedef herr_t (*H5T_vlen_write_multi_func_t)(H5VL_object_t *file, size_t nseq, void *const vl[],
+                                              const void *const buf[], const size_t seq_len[],
+                                              size_t base_size);
 
 /* VL datatype callbacks */
 typedef struct H5T_vlen_class_t {
-    H5T_vlen_getlen_func_t  getlen;  /* Function to get VL sequence size (in element units, not bytes) */
-    H5T_vlen_getptr_func_t  getptr;  /* Function to get VL sequence pointer */
-    H5T_vlen_isnull_func_t  isnull;  /* Function to check if VL value is NIL */
-    H5T_vlen_setnull_func_t setnull; /* Function to set a VL value to NIL */
-    H5T_vlen_read_func_t    read;    /* Function to read VL sequence into buffer */
-    H5T_vlen_write_func_t   write;   /* Function to write VL sequence from buffer */
-    H5T_vlen_delete_func_t  del;     /* Function to delete VL sequence */
+    H5T_vlen_getlen_func_t      getlen;      /* Function to get VL sequence size (in elements, not bytes) */
+    H5T_vlen_getptr_func_t      getptr;      /* Function to get VL sequence pointer */
+    H5T_vlen_isnull_func_t      isnull;      /* Function to check if VL value is NIL */
+    H5T_vlen_setnull_func_t     setnull;     /* Function to set a VL value to NIL */
+    H5T_vlen_read_func_t        read;        /* Function to read VL sequence into buffer */
+    H5T_vlen_write_func_t       write;       /* Function to write VL sequence from buffer */
+    H5T_vlen_delete_func_t      del;         /* Function to delete VL sequence */
+    H5T_vlen_read_multi_func_t  read_multi;  /* Function to read a batch of VL sequences into buffers */
+    H5T_vlen_write_multi_func_t write_multi; /* Function to write a batch of VL sequences from buffers */
 } H5T_vlen_class_t;
 
 /* A VL datatype */
@@ -411,6 +431,9 @@ H5_DLLVAR size_t H5T_HOBJREF_COMP_ALIGN_g;
 H5_DLLVAR size_t H5T_HDSETREGREF_COMP_ALIGN_g;
 H5_DLLVAR size_t H5T_REF_COMP_ALIGN_g;
 
+/* Number of conversions split across threads so far */
+H5_DLLVAR unsigned H5T_conv_nsplit_g;
+
 /*
  * Alignment information for native types. A value of N indicates that the
  * data must be aligned on an address ADDR such that 0 == ADDR mod N. When
@@ -501,6 +524,7 @@ H5_DLL herr_t H5T__conv_order(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, si
                               size_t buf_stride, size_t bkg_stride, void *_buf, void *bkg);
 H5_DLL herr_t H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                   size_t buf_stride, size_t bkg_stride, void *_buf, void *bkg);
+H5_DLL void   H5T__conv_swap(uint8_t *buf, size_t size, size_t nelmts);
 H5_DLL herr_t H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                size_t buf_stride, size_t bkg_stride, void *_buf, void *bkg);
 H5_DLL herr_t H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
@@ -891,4 +915,9 @@ H5_DLL herr_t H5T__sort_name(const H5T_t *dt, int *map);
 /* Debugging functions */
 H5_DLL herr_t H5T__print_stats(H5T_path_t *path, int *nprint /*in,out*/);
 
+/* Testing functions */
+#ifdef H5T_TESTING
+H5_DLL unsigned H5T__conv_nsplit_test(void);
+#endif /* H5T_TESTING */
+
 #endif /* H5Tpkg_H */
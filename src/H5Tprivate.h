@@ -55,6 +55,9 @@ typedef struct H5T_t H5T_t;
 typedef struct H5T_stats_t H5T_stats_t;
 typedef struct H5T_path_t  H5T_path_t;
 
+/* A datatype conversion that may still be running (see H5T_convert_start) */
+typedef struct H5T_conv_req_t H5T_conv_req_t;
+
 /* Forward reference of H5S_t */
 struct H5S_t;
 
@@ -69,12 +72,23 @@ typedef enum {
     H5T_LOC_MAXLOC      /* highest value (Invalid as true value) */
 } H5T_loc_t;
 
+/* Arena taking all the VL data of a dataset read (defined in H5Tvlen.c) */
+typedef struct H5T_vlen_arena_t H5T_vlen_arena_t;
+
+/* Buffer holding elements whose VL data is in an arena */
+typedef struct H5T_vlen_arena_buf_t {
+    const H5T_t *       dt;    /* Datatype of the elements */
+    const struct H5S_t *space; /* Selection of the elements in the buffer */
+    void *              buf;   /* Buffer of elements */
+} H5T_vlen_arena_buf_t;
+
 /* VL allocation information */
 typedef struct {
-    H5MM_allocate_t alloc_func; /* Allocation function */
-    void *          alloc_info; /* Allocation information */
-    H5MM_free_t     free_func;  /* Free function */
-    void *          free_info;  /* Free information */
+    H5MM_allocate_t   alloc_func; /* Allocation function */
+    void *            alloc_info; /* Allocation information */
+    H5MM_free_t       free_func;  /* Free function */
+    void *            free_info;  /* Free information */
+    H5T_vlen_arena_t *arena;      /* Arena for VL data, instead of the functions above, or NULL */
 } H5T_vlen_alloc_info_t;
 
 /* Structure for conversion callback property */
@@ -100,6 +114,14 @@ typedef struct H5T_subset_info_t {
     size_t       copy_size; /* Size in bytes, to copy for each element */
 } H5T_subset_info_t;
 
+/* A conversion path lookup remembered by a dataset or attribute (see H5T_path_find_memo) */
+typedef struct H5T_path_memo_t {
+    const H5T_t *src;  /* Source datatype of the remembered lookup */
+    const H5T_t *dst;  /* Destination datatype of the remembered lookup */
+    H5T_path_t * path; /* Path found for them, or NULL */
+    uint64_t     gen;  /* Path table generation the path was found in */
+} H5T_path_memo_t;
+
 /* Forward declarations for prototype arguments */
 struct H5O_shared_t;
 
@@ -129,14 +151,26 @@ H5_DLL htri_t      H5T_is_named(const H5T_t *dt);
 H5_DLL herr_t      H5T_convert_committed_datatype(H5T_t *dt, H5F_t *f);
 H5_DLL htri_t      H5T_is_relocatable(const H5T_t *dt);
 H5_DLL H5T_path_t *H5T_path_find(const H5T_t *src, const H5T_t *dst);
+H5_DLL H5T_path_t *H5T_path_find_memo(const H5T_t *src, const H5T_t *dst, const H5T_t *own_type,
+                                      H5T_path_memo_t *memo);
 H5_DLL hbool_t     H5T_path_noop(const H5T_path_t *p);
 H5_DLL H5T_bkg_t   H5T_path_bkg(const H5T_path_t *p);
 H5_DLL H5T_subset_info_t *H5T_path_compound_subset(const H5T_path_t *p);
 H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t buf_stride,
                           size_t bkg_stride, void *buf, void *bkg);
+H5_DLL herr_t H5T_convert_mt(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, size_t buf_stride,
+                             size_t bkg_stride, void *buf, void *bkg, unsigned nthreads);
+H5_DLL htri_t H5T_convert_can_split(const H5T_path_t *tpath);
+H5_DLL herr_t H5T_convert_start(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts, void *buf,
+                                void *bkg, unsigned nthreads, H5T_conv_req_t **req);
+H5_DLL herr_t H5T_convert_wait(H5T_conv_req_t *req);
 H5_DLL herr_t H5T_reclaim(hid_t type_id, struct H5S_t *space, void *buf);
 H5_DLL herr_t H5T_reclaim_cb(void *elem, const H5T_t *dt, unsigned ndim, const hsize_t *point, void *op_data);
 H5_DLL herr_t H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt);
+H5_DLL H5T_vlen_arena_t *H5T_vlen_arena_create(void);
+H5_DLL herr_t H5T_vlen_arena_finish(H5T_vlen_arena_t *arena, size_t nbufs, const H5T_vlen_arena_buf_t *bufs,
+                                    void **block, size_t *size, size_t **offset, size_t *nseqs);
+H5_DLL herr_t H5T_vlen_arena_discard(H5T_vlen_arena_t *arena);
 H5_DLL htri_t H5T_set_loc(H5T_t *dt, H5VL_object_t *file, H5T_loc_t loc);
 H5_DLL htri_t H5T_is_sensible(const H5T_t *dt);
 H5_DLL uint32_t H5T_hash(H5F_t *file, const H5T_t *dt);
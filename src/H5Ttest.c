@@ -0,0 +1,67 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * H5Ttest.c - Datatype testing functions
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Tmodule.h" /* This source code file is part of the H5T module */
+#define H5T_TESTING    /*suppress warning about H5T testing funcs*/
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h" /* Generic Functions                        */
+#include "H5Tpkg.h"    /* Datatypes                                */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_nsplit_test
+ *
+ * Purpose:     Retrieve the number of datatype conversions split across
+ *              threads so far.
+ *
+ * Return:      Number of split conversions (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5T__conv_nsplit_test(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(H5T_conv_nsplit_g)
+} /* end H5T__conv_nsplit_test() */
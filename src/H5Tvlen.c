@@ -30,19 +30,58 @@
 #include "H5CXprivate.h" /* API Contexts         */
 #include "H5Eprivate.h"  /* Error handling       */
 #include "H5Fpkg.h"      /* File                 */
+#include "H5FLprivate.h" /* Free Lists           */
 #include "H5Iprivate.h"  /* IDs                  */
 #include "H5MMprivate.h" /* Memory management    */
+#include "H5Sprivate.h"  /* Dataspaces           */
 #include "H5Tpkg.h"      /* Datatypes            */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
 
+/* Size of the first block of a VL data arena */
+#define H5T_VLEN_ARENA_BLOCK_SIZE ((size_t)64 * 1024)
+
+/* Alignment of each block's data within an arena's final block (and the
+ * largest alignment of any sequence's data)
+ */
+#define H5T_VLEN_ARENA_ALIGN ((size_t)16)
+
+/* Round X up to a multiple of A, a power of two */
+#define H5T_VLEN_ARENA_ROUND(X, A) (((X) + (A)-1) & ~((A)-1))
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* One block of a VL data arena */
+typedef struct H5T_vlen_arena_block_t {
+    uint8_t *buf;   /* Block's memory */
+    size_t   size;  /* Size of the block */
+    size_t   used;  /* Number of bytes used in the block */
+    size_t   start; /* Offset of the block's data in the arena's final block */
+} H5T_vlen_arena_block_t;
+
+/* Arena for the VL data of a dataset read.  Sequences are packed into
+ * blocks which are never moved while the read is in progress, so that the
+ * pointers already handed out stay valid.  When the read is finished, any
+ * blocks after the first are moved into a single block and the pointers in
+ * the application's buffer are adjusted to match.
+ */
+struct H5T_vlen_arena_t {
+    H5T_vlen_arena_block_t *block;   /* Blocks holding the data so far */
+    size_t                  nblocks; /* Number of blocks in use */
+    size_t                  nalloc;  /* Number of entries allocated in 'block' */
+    uint8_t *               final;   /* Final block, while it's being assembled */
+    size_t *                offset;  /* Offset of each sequence's data in the final block */
+    size_t                  nseqs;   /* Number of sequences with data */
+    size_t                  noffs;   /* Number of entries allocated in 'offset' */
+};
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -77,6 +116,15 @@ static herr_t H5T__vlen_disk_read(H5VL_object_t *file, void *_vl, void *_buf, si
 static herr_t H5T__vlen_disk_write(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl,
                                    void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T__vlen_disk_delete(H5VL_object_t *file, const void *_vl);
+static herr_t H5T__vlen_disk_read_multi(H5VL_object_t *file, size_t nseq, void *const vl[], void *const buf[],
+                                        const size_t len[]);
+static herr_t H5T__vlen_disk_write_multi(H5VL_object_t *file, size_t nseq, void *const vl[],
+                                         const void *const buf[], const size_t seq_len[], size_t base_size);
+
+/* VL data arena routines */
+static void * H5T__vlen_arena_alloc(H5T_vlen_arena_t *arena, size_t size, size_t base_size);
+static herr_t H5T__vlen_arena_rebase(void *elem, const H5T_t *dt, unsigned ndim, const hsize_t *point,
+                                     void *op_data);
 
 /*********************/
 /* Public Variables */
@@ -94,6 +142,9 @@ static herr_t H5T__vlen_disk_delete(H5VL_object_t *file, const void *_vl);
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage VL data arenas */
+H5FL_DEFINE_STATIC(H5T_vlen_arena_t);
+
 /* Class for VL sequences in memory */
 static const H5T_vlen_class_t H5T_vlen_mem_seq_g = {
     H5T__vlen_mem_seq_getlen,  /* 'getlen' */
@@ -102,7 +153,9 @@ static const H5T_vlen_class_t H5T_vlen_mem_seq_g = {
     H5T__vlen_mem_seq_setnull, /* 'setnull' */
     H5T__vlen_mem_seq_read,    /* 'read' */
     H5T__vlen_mem_seq_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL,                      /* 'read_multi' */
+    NULL                       /* 'write_multi' */
 };
 
 /* Class for VL strings in memory */
@@ -113,18 +166,22 @@ static const H5T_vlen_class_t H5T_vlen_mem_str_g = {
     H5T__vlen_mem_str_setnull, /* 'setnull' */
     H5T__vlen_mem_str_read,    /* 'read' */
     H5T__vlen_mem_str_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL,                      /* 'read_multi' */
+    NULL                       /* 'write_multi' */
 };
 
 /* Class for both VL strings and sequences in file */
 static const H5T_vlen_class_t H5T_vlen_disk_g = {
-    H5T__vlen_disk_getlen,  /* 'getlen' */
-    NULL,                   /* 'getptr' */
-    H5T__vlen_disk_isnull,  /* 'isnull' */
-    H5T__vlen_disk_setnull, /* 'setnull' */
-    H5T__vlen_disk_read,    /* 'read' */
-    H5T__vlen_disk_write,   /* 'write' */
-    H5T__vlen_disk_delete   /* 'delete' */
+    H5T__vlen_disk_getlen,     /* 'getlen' */
+    NULL,                      /* 'getptr' */
+    H5T__vlen_disk_isnull,     /* 'isnull' */
+    H5T__vlen_disk_setnull,    /* 'setnull' */
+    H5T__vlen_disk_read,       /* 'read' */
+    H5T__vlen_disk_write,      /* 'write' */
+    H5T__vlen_disk_delete,     /* 'delete' */
+    H5T__vlen_disk_read_multi, /* 'read_multi' */
+    H5T__vlen_disk_write_multi /* 'write_multi' */
 };
 
 /*-------------------------------------------------------------------------
@@ -565,12 +622,17 @@ H5T__vlen_mem_seq_write(H5VL_object_t H5_ATTR_UNUSED *file, const H5T_vlen_alloc
     if (seq_len) {
         size_t len = seq_len * base_size; /* Sequence size */
 
+        /* Place the sequence in the read's arena, if there is one */
+        if (vl_alloc_info->arena != NULL) {
+            if (NULL == (vl.p = H5T__vlen_arena_alloc(vl_alloc_info->arena, len, base_size)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate VL data in arena")
+        } /* end if */
         /* Use the user's memory allocation routine is one is defined */
-        if (vl_alloc_info->alloc_func != NULL) {
+        else if (vl_alloc_info->alloc_func != NULL) {
             if (NULL == (vl.p = (vl_alloc_info->alloc_func)(len, vl_alloc_info->alloc_info)))
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL,
                             "application memory allocation routine failed for VL data")
-        }    /* end if */
+        }    /* end else-if */
         else /* Default to system malloc */
             if (NULL == (vl.p = HDmalloc(len)))
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "memory allocation failed for VL data")
@@ -781,13 +843,19 @@ H5T__vlen_mem_str_write(H5VL_object_t H5_ATTR_UNUSED *file, const H5T_vlen_alloc
     /* check parameters */
     HDassert(buf);
 
+    /* Place the string in the read's arena, if there is one */
+    if (vl_alloc_info->arena != NULL) {
+        if (NULL == (t = (char *)H5T__vlen_arena_alloc(vl_alloc_info->arena, (seq_len + 1) * base_size,
+                                                       base_size)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate VL data in arena")
+    } /* end if */
     /* Use the user's memory allocation routine if one is defined */
-    if (vl_alloc_info->alloc_func != NULL) {
+    else if (vl_alloc_info->alloc_func != NULL) {
         if (NULL ==
             (t = (char *)(vl_alloc_info->alloc_func)((seq_len + 1) * base_size, vl_alloc_info->alloc_info)))
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL,
                         "application memory allocation routine failed for VL data")
-    }    /* end if */
+    }    /* end else-if */
     else /* Default to system malloc */
         if (NULL == (t = (char *)HDmalloc((seq_len + 1) * base_size)))
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "memory allocation failed for VL data")
@@ -1044,6 +1112,119 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__vlen_disk_delete() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_read_multi
+ *
+ * Purpose:	Reads a batch of disk based VL elements into buffers.  When
+ *		the file uses the native VOL connector, the sequences are
+ *		read from the global heap together, so each heap collection
+ *		is only visited once for the whole batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_disk_read_multi(H5VL_object_t *file, size_t nseq, void *const vl[], void *const buf[],
+                          const size_t len[])
+{
+    const void **blob_id   = NULL;    /* Blob ID for each sequence */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(file);
+    HDassert(0 == nseq || (vl && buf && len));
+
+    /* Go straight to the global heap for files using the native VOL connector */
+    if (H5_VOL_NATIVE == file->connector->cls->value) {
+        if (NULL == (blob_id = (const void **)H5MM_malloc(nseq * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate blob IDs")
+
+        /* Skip the length of each sequence */
+        for (u = 0; u < nseq; u++)
+            blob_id[u] = (const uint8_t *)vl[u] + 4;
+
+        /* Retrieve blobs */
+        if (H5VL_native_blob_get_multi(file->data, nseq, blob_id, buf, len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get blobs")
+    } /* end if */
+    else
+        for (u = 0; u < nseq; u++)
+            if (H5T__vlen_disk_read(file, vl[u], buf[u], len[u]) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    H5MM_xfree(blob_id);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_disk_read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_write_multi
+ *
+ * Purpose:	Writes a batch of disk based VL elements from buffers.  When
+ *		the file uses the native VOL connector, the sequences are
+ *		inserted into the global heap together, filling collections
+ *		sized for the batch.  Unlike H5T__vlen_disk_write(), any old
+ *		data for the elements must already have been deleted.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_disk_write_multi(H5VL_object_t *file, size_t nseq, void *const vl[], const void *const buf[],
+                           const size_t seq_len[], size_t base_size)
+{
+    void **  blob_id   = NULL;    /* Blob ID for each sequence */
+    size_t * size      = NULL;    /* Size of each sequence, in bytes */
+    uint8_t *p;                   /* Pointer into an element's disk VL data */
+    size_t   u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(file);
+    HDassert(0 == nseq || (vl && buf && seq_len));
+
+    /* Set the length of each sequence */
+    for (u = 0; u < nseq; u++) {
+        p = (uint8_t *)vl[u];
+        UINT32ENCODE(p, seq_len[u]);
+    } /* end for */
+
+    /* Go straight to the global heap for files using the native VOL connector */
+    if (H5_VOL_NATIVE == file->connector->cls->value) {
+        if (NULL == (blob_id = (void **)H5MM_malloc(nseq * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate blob IDs")
+        if (NULL == (size = (size_t *)H5MM_malloc(nseq * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't allocate blob sizes")
+
+        for (u = 0; u < nseq; u++) {
+            blob_id[u] = (uint8_t *)vl[u] + 4;
+            size[u]    = seq_len[u] * base_size;
+        } /* end for */
+
+        /* Store blobs */
+        if (H5VL_native_blob_put_multi(file->data, nseq, buf, size, blob_id) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "unable to put blobs")
+    } /* end if */
+    else
+        for (u = 0; u < nseq; u++)
+            if (H5VL_blob_put(file, buf[u], (seq_len[u] * base_size), (uint8_t *)vl[u] + 4, NULL) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "unable to put blob")
+
+done:
+    H5MM_xfree(size);
+    H5MM_xfree(blob_id);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_disk_write_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__vlen_reclaim
  *
@@ -1071,6 +1252,10 @@ H5T__vlen_reclaim(void *elem, const H5T_t *dt, H5T_vlen_alloc_info_t *alloc_info
     HDassert(dt);
     HDassert(alloc_info);
 
+    /* VL data in an arena is only freed with the whole arena */
+    if (alloc_info->arena)
+        HGOTO_DONE(SUCCEED)
+
     free_func = alloc_info->free_func;
     free_info = alloc_info->free_info;
 
@@ -1206,3 +1391,337 @@ H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5T_vlen_reclaim_elmt() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_vlen_arena_create
+ *
+ * Purpose:     Create an empty arena for the VL data of a dataset read.
+ *
+ * Return:      Success:    Pointer to the new arena
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5T_vlen_arena_t *
+H5T_vlen_arena_create(void)
+{
+    H5T_vlen_arena_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    if (NULL == (ret_value = H5FL_CALLOC(H5T_vlen_arena_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate VL data arena")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_arena_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__vlen_arena_alloc
+ *
+ * Purpose:     Allocate SIZE bytes in an arena for a sequence of elements
+ *              of BASE_SIZE bytes each, and record its offset.  The data
+ *              is aligned for the base type: to the largest power of two
+ *              that divides BASE_SIZE, up to H5T_VLEN_ARENA_ALIGN, so that
+ *              strings are packed without gaps.
+ *
+ * Return:      Success:    Pointer to the space for the sequence
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5T__vlen_arena_alloc(H5T_vlen_arena_t *arena, size_t size, size_t base_size)
+{
+    H5T_vlen_arena_block_t *blk;              /* Block to allocate from */
+    size_t                  align;            /* Alignment of the data */
+    size_t                  off = 0;          /* Offset of the data in the block */
+    void *                  ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(arena);
+    HDassert(size > 0);
+
+    align = base_size & (~base_size + 1);
+    if (0 == align || align > H5T_VLEN_ARENA_ALIGN)
+        align = H5T_VLEN_ARENA_ALIGN;
+
+    /* Use the last block, if the data fits in it */
+    blk = arena->nblocks ? &arena->block[arena->nblocks - 1] : NULL;
+    if (blk) {
+        off = H5T_VLEN_ARENA_ROUND(blk->used, align);
+        if (off > blk->size || size > blk->size - off)
+            blk = NULL;
+    } /* end if */
+
+    /* Start a new block, at least twice the size of the previous one */
+    if (NULL == blk) {
+        size_t blk_size = H5T_VLEN_ARENA_BLOCK_SIZE;
+        size_t start    = 0;
+
+        if (arena->nblocks == arena->nalloc) {
+            size_t                  n = MAX(arena->nalloc * 2, 8);
+            H5T_vlen_arena_block_t *x;
+
+            if (NULL == (x = (H5T_vlen_arena_block_t *)H5MM_realloc(arena->block,
+                                                                     n * sizeof(H5T_vlen_arena_block_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't grow VL data arena")
+            arena->block  = x;
+            arena->nalloc = n;
+        } /* end if */
+        if (arena->nblocks) {
+            const H5T_vlen_arena_block_t *last = &arena->block[arena->nblocks - 1];
+
+            blk_size = last->size * 2;
+            start    = H5T_VLEN_ARENA_ROUND(last->start + last->used, H5T_VLEN_ARENA_ALIGN);
+        } /* end if */
+        blk_size = MAX(blk_size, size);
+
+        blk = &arena->block[arena->nblocks];
+        if (NULL == (blk->buf = (uint8_t *)HDmalloc(blk_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate VL data arena block")
+        blk->size  = blk_size;
+        blk->used  = 0;
+        blk->start = start;
+        arena->nblocks++;
+        off = 0;
+    } /* end if */
+
+    /* Record the sequence's offset in the final block */
+    if (arena->nseqs == arena->noffs) {
+        size_t  n = MAX(arena->noffs * 2, 1024);
+        size_t *x;
+
+        if (NULL == (x = (size_t *)HDrealloc(arena->offset, n * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't grow VL data arena offsets")
+        arena->offset = x;
+        arena->noffs  = n;
+    } /* end if */
+    arena->offset[arena->nseqs++] = blk->start + off;
+
+    blk->used = off + size;
+    ret_value = blk->buf + off;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_arena_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__vlen_arena_rebase
+ *
+ * Purpose:     Adjust the VL pointers in an element, and in the data they
+ *              point to, from the arena's blocks to its final block.  The
+ *              data must already have been copied to the final block.
+ *
+ *              Called through H5S_select_iterate(), with the arena as
+ *              OP_DATA.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_arena_rebase(void *elem, const H5T_t *dt, unsigned H5_ATTR_UNUSED ndim,
+                       const hsize_t H5_ATTR_UNUSED *point, void *op_data)
+{
+    const H5T_vlen_arena_t *arena = (const H5T_vlen_arena_t *)op_data; /* Arena being finished */
+    unsigned                u;                                         /* Local index variable */
+    herr_t                  ret_value = SUCCEED;                       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(elem);
+    HDassert(dt);
+    HDassert(arena);
+
+    switch (dt->shared->type) {
+        case H5T_ARRAY:
+            if (H5T_IS_COMPLEX(dt->shared->parent->shared->type))
+                for (u = 0; u < dt->shared->u.array.nelem; u++)
+                    if (H5T__vlen_arena_rebase((uint8_t *)elem + u * dt->shared->parent->shared->size,
+                                               dt->shared->parent, 0, NULL, op_data) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to adjust array element")
+            break;
+
+        case H5T_COMPOUND:
+            for (u = 0; u < dt->shared->u.compnd.nmembs; u++)
+                if (H5T_IS_COMPLEX(dt->shared->u.compnd.memb[u].type->shared->type))
+                    if (H5T__vlen_arena_rebase((uint8_t *)elem + dt->shared->u.compnd.memb[u].offset,
+                                               dt->shared->u.compnd.memb[u].type, 0, NULL, op_data) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to adjust compound field")
+            break;
+
+        case H5T_VLEN: {
+            void *   ptr; /* Sequence's data */
+            uint8_t *p;   /* Sequence's data, as bytes */
+            size_t   len; /* Number of elements in the sequence */
+            size_t   v;   /* Local index variable */
+
+            if (dt->shared->u.vlen.type == H5T_VLEN_SEQUENCE) {
+                hvl_t vl;
+
+                H5MM_memcpy(&vl, elem, sizeof(hvl_t));
+                ptr = vl.p;
+                len = vl.len;
+            } /* end if */
+            else {
+                H5MM_memcpy(&ptr, elem, sizeof(char *));
+                len = 0;
+            } /* end else */
+            if (NULL == ptr)
+                break;
+
+            /* Find the block holding the data */
+            p = (uint8_t *)ptr;
+            for (v = 0; v < arena->nblocks; v++)
+                if (p >= arena->block[v].buf && p < arena->block[v].buf + arena->block[v].size)
+                    break;
+            if (v < arena->nblocks) {
+                p = arena->final + arena->block[v].start + (size_t)(p - arena->block[v].buf);
+                if (dt->shared->u.vlen.type == H5T_VLEN_SEQUENCE) {
+                    hvl_t vl;
+
+                    vl.p   = p;
+                    vl.len = len;
+                    H5MM_memcpy(elem, &vl, sizeof(hvl_t));
+                } /* end if */
+                else
+                    H5MM_memcpy(elem, &p, sizeof(char *));
+            } /* end if */
+
+            /* Adjust nested VL data */
+            if (len && H5T_IS_COMPLEX(dt->shared->parent->shared->type))
+                for (v = 0; v < len; v++)
+                    if (H5T__vlen_arena_rebase(p + v * dt->shared->parent->shared->size, dt->shared->parent,
+                                               0, NULL, op_data) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to adjust VL element")
+        } break;
+
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_STRING:
+        case H5T_BITFIELD:
+        case H5T_OPAQUE:
+        case H5T_ENUM:
+        case H5T_REFERENCE:
+            break;
+
+        case H5T_NO_CLASS:
+        case H5T_NCLASSES:
+        default:
+            HGOTO_ERROR(H5E_DATATYPE, H5E_BADRANGE, FAIL, "invalid datatype class")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_arena_rebase() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_vlen_arena_finish
+ *
+ * Purpose:     Finish an arena once the read(s) using it have succeeded:
+ *              move the data into a single block if it was spread over
+ *              more than one, adjusting the pointers to it in the NBUFS
+ *              buffers BUFS that the data was read into, then hand the
+ *              block and the sequences' offsets in it over to the caller
+ *              and free the arena.
+ *
+ *              The arena is freed even if this fails, along with the
+ *              data.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_vlen_arena_finish(H5T_vlen_arena_t *arena, size_t nbufs, const H5T_vlen_arena_buf_t *bufs, void **block,
+                      size_t *size, size_t **offset, size_t *nseqs)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(arena);
+    HDassert(nbufs == 0 || bufs);
+    HDassert(block && size && offset && nseqs);
+
+    *block  = NULL;
+    *size   = 0;
+    *offset = NULL;
+    *nseqs  = 0;
+
+    if (arena->nblocks > 0) {
+        H5T_vlen_arena_block_t *last = &arena->block[arena->nblocks - 1];
+        size_t                  total;
+
+        total = last->start + last->used;
+        if (arena->nblocks > 1) {
+            H5S_sel_iter_op_t dset_op; /* Operator for iteration */
+            size_t            u;
+
+            /* Gather the data into one block.  Each block's data starts at
+             * a multiple of the arena's alignment, which keeps the sequences
+             * aligned.
+             */
+            if (NULL == (arena->final = (uint8_t *)HDmalloc(total)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate VL data block")
+            for (u = 0; u < arena->nblocks; u++)
+                H5MM_memcpy(arena->final + arena->block[u].start, arena->block[u].buf, arena->block[u].used);
+
+            /* Point the elements read at the new block */
+            dset_op.op_type  = H5S_SEL_ITER_OP_LIB;
+            dset_op.u.lib_op = H5T__vlen_arena_rebase;
+            for (u = 0; u < nbufs; u++)
+                if (H5S_select_iterate(bufs[u].buf, bufs[u].dt, bufs[u].space, &dset_op, arena) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to adjust VL data pointers")
+        } /* end if */
+        else {
+            arena->final        = arena->block[0].buf;
+            arena->block[0].buf = NULL;
+        } /* end else */
+
+        /* Hand the data over */
+        *block       = arena->final;
+        *size        = total;
+        arena->final = NULL;
+    } /* end if */
+    *offset       = arena->offset;
+    *nseqs        = arena->nseqs;
+    arena->offset = NULL;
+
+done:
+    if (H5T_vlen_arena_discard(arena) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTFREE, FAIL, "unable to free VL data arena")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_arena_finish() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T_vlen_arena_discard
+ *
+ * Purpose:     Free an arena and any data it still holds.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_vlen_arena_discard(H5T_vlen_arena_t *arena)
+{
+    size_t u;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(arena);
+
+    for (u = 0; u < arena->nblocks; u++)
+        HDfree(arena->block[u].buf);
+    H5MM_xfree(arena->block);
+    HDfree(arena->final);
+    HDfree(arena->offset);
+    arena = H5FL_FREE(H5T_vlen_arena_t, arena);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5T_vlen_arena_discard() */
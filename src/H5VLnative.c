@@ -32,6 +32,7 @@
 #include "H5Fprivate.h" /* Files                                    */
 #include "H5Gprivate.h" /* Groups                                   */
 #include "H5Iprivate.h" /* IDs                                      */
+#include "H5Mprivate.h" /* Maps                                     */
 #include "H5Oprivate.h" /* Object headers                           */
 #include "H5Pprivate.h" /* Property lists                           */
 #include "H5Tprivate.h" /* Datatypes                                */
@@ -42,6 +43,15 @@
 /* The VOL connector identification number */
 static hid_t H5VL_NATIVE_ID_g = H5I_INVALID_HID;
 
+/* Capability flags, including asynchronous execution when there's a
+ * background thread for it
+ */
+#ifdef H5VL_NATIVE_ASYNC
+#define H5VL_NATIVE_CAP_FLAGS (H5VL_CAP_FLAG_NATIVE_FILES | H5VL_CAP_FLAG_ASYNC)
+#else /* H5VL_NATIVE_ASYNC */
+#define H5VL_NATIVE_CAP_FLAGS H5VL_CAP_FLAG_NATIVE_FILES
+#endif /* H5VL_NATIVE_ASYNC */
+
 /* Prototypes */
 static herr_t H5VL__native_term(void);
 
@@ -51,7 +61,7 @@ static const H5VL_class_t H5VL_native_cls_g = {
     H5VL_NATIVE_VALUE,          /* value        */
     H5VL_NATIVE_NAME,           /* name         */
     H5VL_NATIVE_VERSION,        /* connector version */
-    H5VL_CAP_FLAG_NATIVE_FILES, /* capability flags */
+    H5VL_NATIVE_CAP_FLAGS,      /* capability flags */
     NULL,                       /* initialize   */
     H5VL__native_term,          /* terminate    */
     {
@@ -145,12 +155,21 @@ static const H5VL_class_t H5VL_native_cls_g = {
     },
     {
         /* request_cls */
+#ifdef H5VL_NATIVE_ASYNC
+        H5VL__native_request_wait,     /* wait         */
+        NULL,                          /* notify       */
+        H5VL__native_request_cancel,   /* cancel       */
+        H5VL__native_request_specific, /* specific     */
+        NULL,                          /* optional     */
+        H5VL__native_request_free      /* free         */
+#else  /* H5VL_NATIVE_ASYNC */
         NULL, /* wait         */
         NULL, /* notify       */
         NULL, /* cancel       */
         NULL, /* specific     */
         NULL, /* optional     */
         NULL  /* free         */
+#endif /* H5VL_NATIVE_ASYNC */
     },
     {
         /* blob_cls */
@@ -165,7 +184,7 @@ static const H5VL_class_t H5VL_native_cls_g = {
         H5VL__native_token_to_str, /* to_str         */
         H5VL__native_str_to_token  /* from_str       */
     },
-    NULL /* optional     */
+    H5VL__native_map_optional /* optional     */
 };
 
 /*-------------------------------------------------------------------------
@@ -212,6 +231,9 @@ H5VL__native_term(void)
 {
     FUNC_ENTER_STATIC_NOERR
 
+    /* Stop the background thread for asynchronous requests */
+    (void)H5VL__native_request_term();
+
     /* Reset VOL ID */
     H5VL_NATIVE_ID_g = H5I_INVALID_HID;
 
@@ -570,7 +592,8 @@ H5VL_native_get_file_struct(void *obj, H5I_type_t type, H5F_t **file)
             break;
 
         case H5I_MAP:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "maps not supported in native VOL connector")
+            oloc = H5M_oloc((H5M_t *)obj);
+            break;
 
         case H5I_UNINIT:
         case H5I_BADID:
@@ -75,6 +75,8 @@ typedef union H5VL_native_attr_optional_args_t {
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8  /* H5Dvlen_get_buf_size         */
 #define H5VL_NATIVE_DATASET_GET_OFFSET              9  /* H5Dget_offset                */
 #define H5VL_NATIVE_DATASET_CHUNK_ITER              10 /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_READ_MULTI              11 /* H5Dread_multi                */
+#define H5VL_NATIVE_DATASET_WRITE_MULTI             12 /* H5Dwrite_multi               */
 /* NOTE: If values over 1023 are added, the H5VL_RESERVED_NATIVE_OPTIONAL macro
  *      must be updated.
  */
@@ -101,6 +103,26 @@ typedef struct H5VL_native_dataset_get_vlen_buf_size_t {
     hsize_t *size; /* Size of variable-length data buffer (OUT) */
 } H5VL_native_dataset_get_vlen_buf_size_t;
 
+/* Parameters for native connector's dataset 'read multi' operation */
+typedef struct H5VL_native_dataset_read_multi_t {
+    size_t count;         /* Number of datasets */
+    hid_t *dset_id;       /* Datasets to read from */
+    hid_t *mem_type_id;   /* Memory datatypes */
+    hid_t *mem_space_id;  /* Memory dataspaces */
+    hid_t *file_space_id; /* File dataspaces */
+    void **buf;           /* Buffers to read into (OUT) */
+} H5VL_native_dataset_read_multi_t;
+
+/* Parameters for native connector's dataset 'write multi' operation */
+typedef struct H5VL_native_dataset_write_multi_t {
+    size_t       count;         /* Number of datasets */
+    hid_t *      dset_id;       /* Datasets to write to */
+    hid_t *      mem_type_id;   /* Memory datatypes */
+    hid_t *      mem_space_id;  /* Memory dataspaces */
+    hid_t *      file_space_id; /* File dataspaces */
+    const void **buf;           /* Buffers to write from */
+} H5VL_native_dataset_write_multi_t;
+
 /* Parameters for native connector's dataset 'get chunk storage size' operation */
 typedef struct H5VL_native_dataset_get_chunk_storage_size_t {
     const hsize_t *offset; /* Offset of chunk */
@@ -173,6 +195,12 @@ typedef union H5VL_native_dataset_optional_args_t {
         void *              op_data; /* Context to pass to iteration callback */
     } chunk_iter;
 
+    /* H5VL_NATIVE_DATASET_READ_MULTI */
+    H5VL_native_dataset_read_multi_t read_multi;
+
+    /* H5VL_NATIVE_DATASET_WRITE_MULTI */
+    H5VL_native_dataset_write_multi_t write_multi;
+
 } H5VL_native_dataset_optional_args_t;
 
 /* Values for native VOL connector file optional VOL operations */
@@ -444,6 +472,8 @@ typedef union H5VL_native_group_optional_args_t {
 #define H5VL_NATIVE_OBJECT_ENABLE_MDC_FLUSHES       3 /* H5Oenable_mdc_flushes                        */
 #define H5VL_NATIVE_OBJECT_ARE_MDC_FLUSHES_DISABLED 4 /* H5Oare_mdc_flushes_disabled                  */
 #define H5VL_NATIVE_OBJECT_GET_NATIVE_INFO          5 /* H5Oget_native_info(_by_idx, _by_name)        */
+#define H5VL_NATIVE_OBJECT_CREATE_MULTI             6 /* H5Dcreate_multi, H5Gcreate_multi             */
+#define H5VL_NATIVE_OBJECT_READ_ATTR_BATCH          7 /* H5Aread_batch                                */
 /* NOTE: If values over 1023 are added, the H5VL_RESERVED_NATIVE_OPTIONAL macro
  *      must be updated.
  */
@@ -461,6 +491,29 @@ typedef struct H5VL_native_object_get_native_info_t {
     H5O_native_info_t *ninfo;  /* Native info (OUT) */
 } H5VL_native_object_get_native_info_t;
 
+/* Parameters for native connector's object 'create multi' operation */
+typedef struct H5VL_native_object_create_multi_t {
+    H5O_type_t   obj_type; /* Type of objects to create (H5O_TYPE_DATASET or H5O_TYPE_GROUP) */
+    size_t       count;    /* Number of objects */
+    const char **name;     /* Link names for the objects */
+    hid_t *      type_id;  /* Datatypes (datasets only) */
+    hid_t *      space_id; /* Dataspaces (datasets only) */
+    hid_t *      cpl_id;   /* Object creation property lists */
+    hid_t        lcpl_id;  /* Link creation property list */
+    hid_t        apl_id;   /* Object access property list */
+    void **      obj;      /* New objects (OUT) */
+} H5VL_native_object_create_multi_t;
+
+/* Parameters for native connector's object 'read attribute batch' operation */
+typedef struct H5VL_native_object_read_attr_batch_t {
+    size_t            nnames;     /* Number of attribute names */
+    const char **     names;      /* Names of the attributes to read, or NULL for all */
+    size_t *          nattrs;     /* Number of attributes (IN/OUT) */
+    H5A_batch_attr_t *attrs;      /* Attributes read (OUT) */
+    size_t *          arena_size; /* Size of arena (IN/OUT) */
+    void *            arena;      /* Buffer for attribute names & values (OUT) */
+} H5VL_native_object_read_attr_batch_t;
+
 /* Parameters for native connector's object 'optional' operations */
 typedef union H5VL_native_object_optional_args_t {
     /* H5VL_NATIVE_OBJECT_GET_COMMENT */
@@ -484,6 +537,12 @@ typedef union H5VL_native_object_optional_args_t {
 
     /* H5VL_NATIVE_OBJECT_GET_NATIVE_INFO */
     H5VL_native_object_get_native_info_t get_native_info;
+
+    /* H5VL_NATIVE_OBJECT_CREATE_MULTI */
+    H5VL_native_object_create_multi_t create_multi;
+
+    /* H5VL_NATIVE_OBJECT_READ_ATTR_BATCH */
+    H5VL_native_object_read_attr_batch_t read_attr_batch;
 } H5VL_native_object_optional_args_t;
 
 /*******************/
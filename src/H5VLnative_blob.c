@@ -21,6 +21,7 @@
 #include "H5Eprivate.h"         /* Error handling                       */
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5HGprivate.h"        /* Global Heaps				*/
+#include "H5MMprivate.h"        /* Memory management                    */
 #include "H5VLnative_private.h" /* Native VOL connector                 */
 
 /****************/
@@ -132,6 +133,117 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_blob_get() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_native_blob_put_multi
+ *
+ * Purpose:     Stores a batch of blobs in the global heap at once, with
+ *              H5HG_insert_multi(), instead of one 'put' callback per
+ *              blob.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_native_blob_put_multi(void *obj, size_t nblobs, const void *const buf[], const size_t size[],
+                           void *const blob_id[])
+{
+    H5F_t * f         = (H5F_t *)obj; /* Retrieve file pointer */
+    H5HG_t *hobjid    = NULL;         /* New VL sequences' heap IDs */
+    size_t  u;                        /* Local index variable */
+    herr_t  ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check parameters */
+    HDassert(f);
+    HDassert(0 == nblobs || (buf && size && blob_id));
+
+    if (NULL == (hobjid = (H5HG_t *)H5MM_malloc(nblobs * sizeof(H5HG_t))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate heap IDs")
+
+    /* Write the VL information to disk (allocates space also) */
+    if (H5HG_insert_multi(f, nblobs, size, buf, hobjid) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "unable to write blob information")
+
+    /* Encode the heap information */
+    for (u = 0; u < nblobs; u++) {
+        uint8_t *id = (uint8_t *)blob_id[u]; /* Pointer to blob ID */
+
+        H5F_addr_encode(f, &id, hobjid[u].addr);
+        UINT32ENCODE(id, hobjid[u].idx);
+    } /* end for */
+
+done:
+    H5MM_xfree(hobjid);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_native_blob_put_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_native_blob_get_multi
+ *
+ * Purpose:     Retrieves a batch of blobs from the global heap at once,
+ *              with H5HG_read_multi(), instead of one 'get' callback per
+ *              blob.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_native_blob_get_multi(void *obj, size_t nblobs, const void *const blob_id[], void *const buf[],
+                           const size_t size[])
+{
+    H5F_t * f         = (H5F_t *)obj; /* Retrieve file pointer */
+    H5HG_t *hobjid    = NULL;         /* Global heap IDs for sequences */
+    void ** hbuf      = NULL;         /* Buffers for the sequences with data */
+    size_t *hsize     = NULL;         /* Sizes of the sequences with data */
+    size_t  nhobjs    = 0;            /* Number of sequences with data */
+    size_t  u;                        /* Local index variable */
+    herr_t  ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(0 == nblobs || (blob_id && buf && size));
+
+    if (NULL == (hobjid = (H5HG_t *)H5MM_malloc(nblobs * sizeof(H5HG_t))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate heap IDs")
+    if (NULL == (hbuf = (void **)H5MM_malloc(nblobs * sizeof(void *))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate buffer pointers")
+    if (NULL == (hsize = (size_t *)H5MM_malloc(nblobs * sizeof(size_t))))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate buffer sizes")
+
+    /* Get the heap information, skipping sequences which don't have any data */
+    for (u = 0; u < nblobs; u++) {
+        const uint8_t *id = (const uint8_t *)blob_id[u]; /* Pointer to the disk blob ID */
+
+        H5F_addr_decode(f, &id, &hobjid[nhobjs].addr);
+        UINT32DECODE(id, hobjid[nhobjs].idx);
+
+        if (hobjid[nhobjs].addr > 0) {
+            hbuf[nhobjs]  = buf[u];
+            hsize[nhobjs] = size[u];
+            nhobjs++;
+        } /* end if */
+        else if (size[u] != 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTDECODE, FAIL, "Expected global heap object size does not match")
+    } /* end for */
+
+    /* Read the VL information from disk */
+    if (H5HG_read_multi(f, nhobjs, hobjid, hbuf, hsize) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "unable to read VL information")
+
+done:
+    H5MM_xfree(hsize);
+    H5MM_xfree(hbuf);
+    H5MM_xfree(hobjid);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_native_blob_get_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_blob_specific
  *
@@ -31,6 +31,7 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -52,6 +53,9 @@
 /* Helper routines for read/write API calls */
 static herr_t H5VL__native_dataset_io_setup(H5D_t *dset, hid_t dxpl_id, hid_t file_space_id,
                                             hid_t mem_space_id, H5S_t **file_space, H5S_t **mem_space);
+static herr_t H5VL__native_dataset_io_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                                            const hid_t mem_space_id[], const hid_t file_space_id[],
+                                            hid_t dxpl_id, void *rbuf[], const void *wbuf[]);
 
 /*********************/
 /* Package Variables */
@@ -159,6 +163,83 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_dataset_io_setup() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_io_multi
+ *
+ * Purpose:     Reads into RBUF or writes from WBUF (whichever isn't NULL)
+ *              several datasets, for H5Dread_multi / H5Dwrite_multi
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_dataset_io_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+                              const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+                              void *rbuf[], const void *wbuf[])
+{
+    H5D_t **dsets       = NULL;      /* Datasets */
+    H5S_t **mem_spaces  = NULL;      /* Memory dataspaces */
+    H5S_t **file_spaces = NULL;      /* File dataspaces */
+    size_t  nsetup      = 0;         /* Number of datasets with dataspaces set up */
+    size_t  u;                       /* Local index variable */
+    herr_t  ret_value   = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(count > 0);
+    HDassert((NULL == rbuf) != (NULL == wbuf));
+
+    /* Allocate space for the datasets and their dataspaces */
+    if (NULL == (dsets = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate dataset array")
+    if (NULL == (mem_spaces = (H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory dataspace array")
+    if (NULL == (file_spaces = (H5S_t **)H5MM_calloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file dataspace array")
+
+    /* Get the datasets and their file & memory dataspaces */
+    for (u = 0; u < count; u++) {
+        if (NULL == (dsets[u] = (H5D_t *)H5VL_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+        if (NULL == dsets[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+        nsetup = u + 1;
+        if (H5VL__native_dataset_io_setup(dsets[u], dxpl_id, file_space_id[u], mem_space_id[u],
+                                          &file_spaces[u], &mem_spaces[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up file and memory dataspaces")
+    } /* end for */
+
+    /* Read or write the raw data */
+    if (rbuf) {
+        if (H5D__read_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, rbuf /*out*/) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else if (H5D__write_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, wbuf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    /* Clean up */
+    for (u = 0; u < nsetup; u++) {
+        if (H5S_BLOCK == mem_space_id[u] && mem_spaces[u]) {
+            if (H5S_close(mem_spaces[u]) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL,
+                            "unable to release temporary memory dataspace for H5S_BLOCK")
+        } /* end if */
+        else if (H5S_PLIST == file_space_id[u] && file_spaces[u])
+            if (H5S_select_all(file_spaces[u], TRUE) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL,
+                            "unable to release file dataspace selection for H5S_PLIST")
+    } /* end for */
+    H5MM_xfree(file_spaces);
+    H5MM_xfree(mem_spaces);
+    H5MM_xfree(dsets);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_io_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_create
  *
@@ -268,7 +349,7 @@ done:
  */
 herr_t
 H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
-                          hid_t dxpl_id, void *buf, void H5_ATTR_UNUSED **req)
+                          hid_t dxpl_id, void *buf, void **req)
 {
     H5D_t *dset       = (H5D_t *)obj;
     H5S_t *mem_space  = NULL;
@@ -289,8 +370,20 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid_
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
+    /* Queue the read for the background thread, for asynchronous requests */
+    if (req) {
+        if (H5VL__native_request_dataset_io(dset, mem_type_id, mem_space, file_space, buf, NULL, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous read")
+        if (*req)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Complete any queued operations on the dataset's file first */
+    if (H5VL__native_request_drain(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     /* Read raw data */
-    if (H5D__read(dset, mem_type_id, mem_space, file_space, buf /*out*/) < 0)
+    if (H5D__read(dset, mem_type_id, mem_space, file_space, NULL, buf /*out*/) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
@@ -319,7 +412,7 @@ done:
  */
 herr_t
 H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
-                           hid_t dxpl_id, const void *buf, void H5_ATTR_UNUSED **req)
+                           hid_t dxpl_id, const void *buf, void **req)
 {
     H5D_t *dset       = (H5D_t *)obj;
     H5S_t *mem_space  = NULL;
@@ -340,8 +433,20 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
+    /* Queue the write for the background thread, for asynchronous requests */
+    if (req) {
+        if (H5VL__native_request_dataset_io(dset, mem_type_id, mem_space, file_space, NULL, buf, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous write")
+        if (*req)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Complete any queued operations on the dataset's file first */
+    if (H5VL__native_request_drain(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     /* Write the data */
-    if (H5D__write(dset, mem_type_id, mem_space, file_space, buf) < 0)
+    if (H5D__write(dset, mem_type_id, mem_space, file_space, NULL, buf) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
 
 done:
@@ -451,6 +556,10 @@ H5VL__native_dataset_specific(void *obj, H5VL_dataset_specific_args_t *args, hid
 
     FUNC_ENTER_PACKAGE
 
+    /* Complete any queued operations on the dataset's file first */
+    if (H5VL__native_request_drain(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     switch (args->op_type) {
         /* H5Dset_extent (H5Dextend - deprecated) */
         case H5VL_DATASET_SET_EXTENT: {
@@ -504,6 +613,10 @@ H5VL__native_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_
     /* Sanity checks */
     HDassert(dset);
 
+    /* Complete any queued operations on the dataset's file first */
+    if (H5VL__native_request_drain(dset->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
@@ -725,6 +838,32 @@ H5VL__native_dataset_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_
             break;
         }
 
+        /* H5Dread_multi */
+        case H5VL_NATIVE_DATASET_READ_MULTI: {
+            H5VL_native_dataset_read_multi_t *read_multi_args = &opt_args->read_multi;
+
+            if (H5VL__native_dataset_io_multi(read_multi_args->count, read_multi_args->dset_id,
+                                              read_multi_args->mem_type_id, read_multi_args->mem_space_id,
+                                              read_multi_args->file_space_id, dxpl_id, read_multi_args->buf,
+                                              NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+            break;
+        }
+
+        /* H5Dwrite_multi */
+        case H5VL_NATIVE_DATASET_WRITE_MULTI: {
+            H5VL_native_dataset_write_multi_t *write_multi_args = &opt_args->write_multi;
+
+            if (H5VL__native_dataset_io_multi(write_multi_args->count, write_multi_args->dset_id,
+                                              write_multi_args->mem_type_id, write_multi_args->mem_space_id,
+                                              write_multi_args->file_space_id, dxpl_id, NULL,
+                                              write_multi_args->buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
@@ -750,6 +889,10 @@ H5VL__native_dataset_close(void *dset, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATT
 
     FUNC_ENTER_PACKAGE
 
+    /* Complete any queued operations on the dataset's file first */
+    if (H5VL__native_request_drain(((H5D_t *)dset)->oloc.file) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     if (H5D_close((H5D_t *)dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close dataset")
 
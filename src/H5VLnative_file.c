@@ -272,6 +272,50 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_file_get() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_file_flush
+ *
+ * Purpose:     Flushes a file, and the files mounted in its hierarchy
+ *              for H5F_SCOPE_GLOBAL
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_file_flush(H5F_t *f, H5F_scope_t scope)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(f);
+
+    /* Nothing to do if the file is read only. This determination is
+     * made at the shared open(2) flags level, implying that opening a
+     * file twice, once for read-only and once for read-write, and then
+     * calling H5Fflush() with the read-only handle, still causes data
+     * to be flushed.
+     */
+    if (H5F_ACC_RDWR & H5F_INTENT(f)) {
+        /* Flush other files, depending on scope */
+        if (H5F_SCOPE_GLOBAL == scope) {
+            /* Call the flush routine for mounted file hierarchies */
+            if (H5F_flush_mounts(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush mounted file hierarchy")
+        } /* end if */
+        else {
+            /* Call the flush routine, for this file */
+            if (H5F__flush(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file's cached information")
+        } /* end else */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_file_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_file_specific
  *
@@ -283,7 +327,7 @@ done:
  */
 herr_t
 H5VL__native_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t H5_ATTR_UNUSED dxpl_id,
-                           void H5_ATTR_UNUSED **req)
+                           void **req)
 {
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -298,26 +342,22 @@ H5VL__native_file_specific(void *obj, H5VL_file_specific_args_t *args, hid_t H5_
             if (H5VL_native_get_file_struct(obj, args->args.flush.obj_type, &f) < 0)
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
-            /* Nothing to do if the file is read only. This determination is
-             * made at the shared open(2) flags level, implying that opening a
-             * file twice, once for read-only and once for read-write, and then
-             * calling H5Fflush() with the read-only handle, still causes data
-             * to be flushed.
+            /* Queue the flush for the background thread, for asynchronous requests */
+            if (req) {
+                if (H5VL__native_request_file_flush(f, args->args.flush.scope, req) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTINSERT, FAIL, "can't queue asynchronous flush")
+                if (*req)
+                    break;
+            } /* end if */
+
+            /* Complete any queued operations on the file (or, for a global
+             * flush, on any file, which covers the mounted ones) first
              */
-            if (H5F_ACC_RDWR & H5F_INTENT(f)) {
-                /* Flush other files, depending on scope */
-                if (H5F_SCOPE_GLOBAL == args->args.flush.scope) {
-                    /* Call the flush routine for mounted file hierarchies */
-                    if (H5F_flush_mounts(f) < 0)
-                        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush mounted file hierarchy")
-                } /* end if */
-                else {
-                    /* Call the flush routine, for this file */
-                    if (H5F__flush(f) < 0)
-                        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL,
-                                    "unable to flush file's cached information")
-                } /* end else */
-            }     /* end if */
+            if (H5VL__native_request_drain(H5F_SCOPE_GLOBAL == args->args.flush.scope ? NULL : f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
+            if (H5VL__native_file_flush(f, args->args.flush.scope) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
 
             break;
         }
@@ -397,6 +437,10 @@ H5VL__native_file_optional(void *obj, H5VL_optional_args_t *args, hid_t H5_ATTR_
 
     FUNC_ENTER_PACKAGE
 
+    /* Complete any queued operations on the file first */
+    if (H5VL__native_request_drain(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     switch (args->op_type) {
         /* H5Fget_filesize */
         case H5VL_NATIVE_FILE_GET_SIZE: {
@@ -755,6 +799,10 @@ H5VL__native_file_close(void *file, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR_U
     /* This routine should only be called when a file ID's ref count drops to zero */
     HDassert(H5F_ID_EXISTS(f));
 
+    /* Complete any queued operations on the file first */
+    if (H5VL__native_request_drain(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     /* Flush file if this is the last reference to this id and we have write
      * intent, unless it will be flushed by the "shared" file being closed.
      * This is only necessary to replicate previous behaviour, and could be
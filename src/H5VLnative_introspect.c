@@ -24,6 +24,7 @@
 /***********/
 #include "H5private.h"   /* Generic Functions                        */
 #include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Mprivate.h"  /* Maps                                     */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -83,7 +84,34 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
     /* Set appropriate flags for each operation in each subclass */
     switch (subcls) {
         case H5VL_SUBCLS_NONE:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional 'none' operation")
+            switch (opt_type) {
+                case H5VL_MAP_CREATE:
+                case H5VL_MAP_PUT:
+                case H5VL_MAP_PUT_MULTI:
+                    *flags |= H5VL_OPT_QUERY_MODIFY_METADATA;
+                    break;
+
+                case H5VL_MAP_OPEN:
+                case H5VL_MAP_GET_VAL:
+                case H5VL_MAP_EXISTS:
+                case H5VL_MAP_GET:
+                case H5VL_MAP_GET_MULTI:
+                    *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
+                    break;
+
+                case H5VL_MAP_SPECIFIC:
+                    /* Don't allow asynchronous execution, due to iterator callbacks */
+                    *flags |= H5VL_OPT_QUERY_NO_ASYNC | H5VL_OPT_QUERY_MODIFY_METADATA;
+                    break;
+
+                case H5VL_MAP_CLOSE:
+                    break;
+
+                default:
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional 'none' operation")
+                    break;
+            } /* end switch */
+            break;
 
         case H5VL_SUBCLS_INFO:
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional info operation")
@@ -130,6 +158,14 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     *flags |= H5VL_OPT_QUERY_WRITE_DATA;
                     break;
 
+                case H5VL_NATIVE_DATASET_READ_MULTI:
+                    *flags |= H5VL_OPT_QUERY_READ_DATA | H5VL_OPT_QUERY_MULTI_OBJ;
+                    break;
+
+                case H5VL_NATIVE_DATASET_WRITE_MULTI:
+                    *flags |= H5VL_OPT_QUERY_WRITE_DATA | H5VL_OPT_QUERY_MULTI_OBJ;
+                    break;
+
                 default:
                     HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional dataset operation")
                     break;
@@ -236,6 +272,14 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
                     break;
 
+                case H5VL_NATIVE_OBJECT_CREATE_MULTI:
+                    *flags |= H5VL_OPT_QUERY_MODIFY_METADATA;
+                    break;
+
+                case H5VL_NATIVE_OBJECT_READ_ATTR_BATCH:
+                    *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
+                    break;
+
                 default:
                     HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional object operation")
                     break;
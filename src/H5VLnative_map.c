@@ -0,0 +1,270 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Map callbacks for the native VOL connector
+ *
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5M_FRIEND /* Suppress error about including H5Mpkg    */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Gprivate.h"  /* Groups                                   */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5Mpkg.h"      /* Maps                                     */
+#include "H5Oprivate.h"  /* Object headers                           */
+#include "H5Pprivate.h"  /* Property lists                           */
+#include "H5VLprivate.h" /* Virtual Object Layer                     */
+
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_map_optional
+ *
+ * Purpose:     Handles the map operations, which come through the
+ *              connector's optional callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_map_optional(void *obj, H5VL_optional_args_t *args, hid_t H5_ATTR_UNUSED dxpl_id,
+                          void H5_ATTR_UNUSED **req)
+{
+    H5VL_map_args_t *map_args  = (H5VL_map_args_t *)args->args; /* Pointer to map operation's arguments */
+    H5M_t *          map       = (H5M_t *)obj;                  /* Map, for operations on a map */
+    herr_t           ret_value = SUCCEED;                       /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    switch (args->op_type) {
+        /* H5Mcreate / H5Mcreate_anon */
+        case H5VL_MAP_CREATE: {
+            H5M_obj_create_t mcrt_info; /* Information for map creation */
+            H5G_loc_t        loc;       /* Location to create map */
+            H5M_t *          new_map = NULL;
+
+            /* Set up the location */
+            if (H5G_loc_real(obj, map_args->create.loc_params.obj_type, &loc) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+
+            /* Set up map creation info */
+            if (NULL == (mcrt_info.key_type =
+                             (H5T_t *)H5I_object_verify(map_args->create.key_type_id, H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "key type is not a datatype")
+            if (NULL == (mcrt_info.val_type =
+                             (H5T_t *)H5I_object_verify(map_args->create.val_type_id, H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "value type is not a datatype")
+            mcrt_info.mcpl_id = map_args->create.mcpl_id;
+            mcrt_info.mapl_id = map_args->create.mapl_id;
+
+            /* if name is NULL then this is from H5Mcreate_anon */
+            if (map_args->create.name == NULL) {
+                if (NULL == (new_map = H5M__create(loc.oloc->file, &mcrt_info)))
+                    HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to create map")
+
+                /* Decrement refcount on map's object header in memory */
+                if (H5O_dec_rc_by_loc(H5M_oloc(new_map)) < 0) {
+                    if (H5M_close(new_map) < 0)
+                        HDONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "unable to release map")
+                    HGOTO_ERROR(H5E_MAP, H5E_CANTDEC, FAIL,
+                                "unable to decrement refcount on newly created object")
+                } /* end if */
+            }     /* end if */
+            /* otherwise it's from H5Mcreate */
+            else {
+                if (NULL == (new_map = H5M__create_named(&loc, map_args->create.name,
+                                                         map_args->create.lcpl_id, &mcrt_info)))
+                    HGOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "unable to create map")
+            } /* end else */
+
+            map_args->create.map = new_map;
+
+            break;
+        }
+
+        /* H5Mopen */
+        case H5VL_MAP_OPEN: {
+            H5G_loc_t loc; /* Location of map */
+
+            /* Set up the location */
+            if (H5G_loc_real(obj, map_args->open.loc_params.obj_type, &loc) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+
+            /* Open the map */
+            if (NULL == (map_args->open.map = H5M__open_name(&loc, map_args->open.name, map_args->open.mapl_id)))
+                HGOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "unable to open map")
+
+            break;
+        }
+
+        /* H5Mget */
+        case H5VL_MAP_GET_VAL:
+            if (H5M__get(map, (size_t)1, map_args->get_val.key_mem_type_id, map_args->get_val.key,
+                         map_args->get_val.value_mem_type_id, map_args->get_val.value) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to get value")
+            break;
+
+        /* H5Mexists */
+        case H5VL_MAP_EXISTS:
+            if (H5M__exists(map, map_args->exists.key_mem_type_id, map_args->exists.key,
+                            &map_args->exists.exists) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to check if key exists")
+            break;
+
+        /* H5Mput */
+        case H5VL_MAP_PUT:
+            if (H5M__put(map, (size_t)1, map_args->put.key_mem_type_id, map_args->put.key,
+                         map_args->put.value_mem_type_id, map_args->put.value) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "unable to put key-value pair")
+            break;
+
+        /* H5Mget_* */
+        case H5VL_MAP_GET:
+            switch (map_args->get.get_type) {
+                /* H5Mget_access_plist */
+                case H5VL_MAP_GET_MAPL:
+                    if ((map_args->get.args.get_mapl.mapl_id = H5M__get_access_plist(map)) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map access property list")
+                    break;
+
+                /* H5Mget_create_plist */
+                case H5VL_MAP_GET_MCPL:
+                    if ((map_args->get.args.get_mcpl.mcpl_id = H5M__get_create_plist(map)) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map creation property list")
+                    break;
+
+                /* H5Mget_key_type */
+                case H5VL_MAP_GET_KEY_TYPE:
+                    if ((map_args->get.args.get_key_type.type_id = H5M__get_type(map, TRUE)) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get key datatype")
+                    break;
+
+                /* H5Mget_val_type */
+                case H5VL_MAP_GET_VAL_TYPE:
+                    if ((map_args->get.args.get_val_type.type_id = H5M__get_type(map, FALSE)) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get value datatype")
+                    break;
+
+                /* H5Mget_count */
+                case H5VL_MAP_GET_COUNT:
+                    if (H5M__get_count(map, &map_args->get.args.get_count.count) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get number of key-value pairs")
+                    break;
+
+                default:
+                    HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get this type of information from map")
+            } /* end switch */
+            break;
+
+        /* H5Miterate / H5Miterate_by_name / H5Mdelete */
+        case H5VL_MAP_SPECIFIC:
+            switch (map_args->specific.specific_type) {
+                case H5VL_MAP_ITER: {
+                    H5VL_loc_params_t *loc_params = &map_args->specific.args.iterate.loc_params;
+                    H5G_loc_t          loc;      /* Location of map, or to look up map from */
+                    const char *       map_name; /* Name of map, relative to loc */
+
+                    /* Set up the location */
+                    if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+                    if (loc_params->type == H5VL_OBJECT_BY_SELF)
+                        map_name = ".";
+                    else if (loc_params->type == H5VL_OBJECT_BY_NAME)
+                        map_name = loc_params->loc_data.loc_by_name.name;
+                    else
+                        HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "unknown map iterate location type")
+
+                    /* Iterate over the keys */
+                    if ((ret_value = H5M__iterate(&loc, map_name, &map_args->specific.args.iterate.idx,
+                                                  map_args->specific.args.iterate.key_mem_type_id,
+                                                  map_args->specific.args.iterate.op,
+                                                  map_args->specific.args.iterate.op_data)) < 0)
+                        HERROR(H5E_MAP, H5E_BADITER, "error iterating over map's keys");
+                    break;
+                }
+
+                case H5VL_MAP_DELETE:
+                    if (map_args->specific.args.del.loc_params.type != H5VL_OBJECT_BY_SELF)
+                        HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "unknown map delete location type")
+                    if (H5M__delete_key(map, map_args->specific.args.del.key_mem_type_id,
+                                        map_args->specific.args.del.key) < 0)
+                        HGOTO_ERROR(H5E_MAP, H5E_CANTDELETE, FAIL, "unable to delete key")
+                    break;
+
+                default:
+                    HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid specific operation")
+            } /* end switch */
+            break;
+
+        /* H5Mclose */
+        case H5VL_MAP_CLOSE:
+            if (H5M_close(map) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map")
+            break;
+
+        /* H5Mput_multi */
+        case H5VL_MAP_PUT_MULTI:
+            if (H5M__put(map, map_args->put_multi.count, map_args->put_multi.key_mem_type_id,
+                         map_args->put_multi.keys, map_args->put_multi.value_mem_type_id,
+                         map_args->put_multi.values) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "unable to put key-value pairs")
+            break;
+
+        /* H5Mget_multi */
+        case H5VL_MAP_GET_MULTI:
+            if (H5M__get(map, map_args->get_multi.count, map_args->get_multi.key_mem_type_id,
+                         map_args->get_multi.keys, map_args->get_multi.value_mem_type_id,
+                         map_args->get_multi.values) < 0)
+                HGOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "unable to get values")
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_map_optional() */
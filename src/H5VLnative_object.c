@@ -19,17 +19,23 @@
 /* Module Setup */
 /****************/
 
+#define H5A_FRIEND /* Suppress error about including H5Apkg    */
+#define H5D_FRIEND /* Suppress error about including H5Dpkg    */
 #define H5F_FRIEND /* Suppress error about including H5Fpkg    */
+#define H5G_FRIEND /* Suppress error about including H5Gpkg    */
 #define H5O_FRIEND /* Suppress error about including H5Opkg    */
 
 /***********/
 /* Headers */
 /***********/
 #include "H5private.h"   /* Generic Functions                        */
+#include "H5Apkg.h"      /* Attributes                               */
+#include "H5Dpkg.h"      /* Datasets                                 */
 #include "H5Eprivate.h"  /* Error handling                           */
 #include "H5Fpkg.h"      /* Files (pkg needed for id_exists)         */
-#include "H5Gprivate.h"  /* Groups                                   */
+#include "H5Gpkg.h"      /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Opkg.h"      /* Object headers                           */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -151,6 +157,11 @@ H5VL__native_object_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, co
     if (H5G_loc_real(dst_obj, loc_params2->obj_type, &dst_loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
+    /* Complete any queued operations on the files first, so their raw data is copied */
+    if (H5VL__native_request_drain(src_loc.oloc->file) < 0 ||
+        H5VL__native_request_drain(dst_loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     /* Copy the object */
     if ((ret_value = H5O__copy(&src_loc, src_name, &dst_loc, dst_name, ocpypl_id, lcpl_id)) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy object")
@@ -332,6 +343,10 @@ H5VL__native_object_specific(void *obj, const H5VL_loc_params_t *loc_params,
     if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
+    /* Complete any queued operations on the file first */
+    if (H5VL__native_request_drain(loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't complete asynchronous operations")
+
     switch (args->op_type) {
         /* H5Oincr_refcount / H5Odecr_refcount */
         case H5VL_OBJECT_CHANGE_REF_COUNT: {
@@ -446,6 +461,7 @@ H5VL__native_object_optional(void *obj, const H5VL_loc_params_t *loc_params, H5V
                              hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR_UNUSED **req)
 {
     H5G_loc_t                           loc;                    /* Location of group */
+    const H5S_t **                      space     = NULL;       /* Dataspaces for H5Dcreate_multi */
     H5VL_native_object_optional_args_t *opt_args  = args->args; /* Pointer to native operation's arguments */
     herr_t                              ret_value = SUCCEED;    /* Return value */
 
@@ -562,10 +578,66 @@ H5VL__native_object_optional(void *obj, const H5VL_loc_params_t *loc_params, H5V
             break;
         }
 
+        /* H5Dcreate_multi / H5Gcreate_multi */
+        case H5VL_NATIVE_OBJECT_CREATE_MULTI: {
+            H5VL_native_object_create_multi_t *cm_args = &opt_args->create_multi;
+
+            if (loc_params->type != H5VL_OBJECT_BY_SELF)
+                HGOTO_ERROR(H5E_OHDR, H5E_UNSUPPORTED, FAIL, "unknown create multi parameters")
+
+            if (H5O_TYPE_DATASET == cm_args->obj_type) {
+                size_t u; /* Local index variable */
+
+                /* Get the dataspaces and check the datatypes */
+                if (NULL == (space = (const H5S_t **)H5MM_malloc(cm_args->count * sizeof(H5S_t *))))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate dataspace array")
+                for (u = 0; u < cm_args->count; u++) {
+                    if (H5I_DATATYPE != H5I_get_type(cm_args->type_id[u]))
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype ID")
+                    if (NULL == (space[u] = (const H5S_t *)H5I_object_verify(cm_args->space_id[u],
+                                                                             H5I_DATASPACE)))
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace ID")
+                } /* end for */
+
+                /* Create the new datasets */
+                if (H5D__create_named_multi(&loc, cm_args->count, cm_args->name, cm_args->type_id, space,
+                                            cm_args->lcpl_id, cm_args->cpl_id, cm_args->apl_id,
+                                            (H5D_t **)cm_args->obj) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create datasets")
+            } /* end if */
+            else if (H5O_TYPE_GROUP == cm_args->obj_type) {
+                /* Create the new groups */
+                if (H5G__create_named_multi(&loc, cm_args->count, cm_args->name, cm_args->lcpl_id,
+                                            cm_args->cpl_id, (H5G_t **)cm_args->obj) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create groups")
+            } /* end else-if */
+            else
+                HGOTO_ERROR(H5E_OHDR, H5E_BADTYPE, FAIL, "can't create objects of this type")
+
+            break;
+        }
+
+        /* H5Aread_batch */
+        case H5VL_NATIVE_OBJECT_READ_ATTR_BATCH: {
+            H5VL_native_object_read_attr_batch_t *rab_args = &opt_args->read_attr_batch;
+
+            if (loc_params->type != H5VL_OBJECT_BY_SELF)
+                HGOTO_ERROR(H5E_OHDR, H5E_UNSUPPORTED, FAIL, "unknown read attribute batch parameters")
+
+            /* Read the attributes */
+            if (H5A__read_batch(loc.oloc, rab_args->nnames, rab_args->names, rab_args->nattrs,
+                                rab_args->attrs, rab_args->arena_size, rab_args->arena) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't perform this operation on object");
     } /* end switch */
 
 done:
+    H5MM_xfree(space);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_object_optional() */
@@ -19,12 +19,18 @@
 
 /* Private headers needed by this file */
 #include "H5Fprivate.h" /* Files                                    */
+#include "H5Sprivate.h" /* Dataspaces                               */
 #include "H5VLnative.h" /* Native VOL connector                     */
 
 /**************************/
 /* Library Private Macros */
 /**************************/
 
+/* Whether operations with a request token run on a background thread */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5VL_NATIVE_ASYNC
+#endif
+
 /****************************/
 /* Library Private Typedefs */
 /****************************/
@@ -93,6 +99,7 @@ H5_DLL herr_t H5VL__native_file_specific(void *file, H5VL_file_specific_args_t *
                                          void **req);
 H5_DLL herr_t H5VL__native_file_optional(void *file, H5VL_optional_args_t *args, hid_t dxpl_id, void **req);
 H5_DLL herr_t H5VL__native_file_close(void *file, hid_t dxpl_id, void **req);
+H5_DLL herr_t H5VL__native_file_flush(H5F_t *f, H5F_scope_t scope);
 
 /* Group callbacks */
 H5_DLL void * H5VL__native_group_create(void *obj, const H5VL_loc_params_t *loc_params, const char *name,
@@ -135,6 +142,9 @@ H5_DLL herr_t H5VL__native_object_specific(void *obj, const H5VL_loc_params_t *l
 H5_DLL herr_t H5VL__native_object_optional(void *obj, const H5VL_loc_params_t *loc_params,
                                            H5VL_optional_args_t *args, hid_t dxpl_id, void **req);
 
+/* Map callbacks */
+H5_DLL herr_t H5VL__native_map_optional(void *obj, H5VL_optional_args_t *args, hid_t dxpl_id, void **req);
+
 /* Connector/container introspection functions */
 H5_DLL herr_t H5VL__native_introspect_get_conn_cls(void *obj, H5VL_get_conn_lvl_t lvl,
                                                    const H5VL_class_t **conn_cls);
@@ -146,6 +156,26 @@ H5_DLL herr_t H5VL__native_introspect_opt_query(void *obj, H5VL_subclass_t cls,
 H5_DLL herr_t H5VL__native_blob_put(void *obj, const void *buf, size_t size, void *blob_id, void *ctx);
 H5_DLL herr_t H5VL__native_blob_get(void *obj, const void *blob_id, void *buf, size_t size, void *ctx);
 H5_DLL herr_t H5VL__native_blob_specific(void *obj, void *blob_id, H5VL_blob_specific_args_t *args);
+H5_DLL herr_t H5VL_native_blob_put_multi(void *obj, size_t nblobs, const void *const buf[],
+                                         const size_t size[], void *const blob_id[]);
+H5_DLL herr_t H5VL_native_blob_get_multi(void *obj, size_t nblobs, const void *const blob_id[],
+                                         void *const buf[], const size_t size[]);
+
+/* Request callbacks */
+#ifdef H5VL_NATIVE_ASYNC
+H5_DLL herr_t H5VL__native_request_wait(void *req, uint64_t timeout, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_cancel(void *req, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_specific(void *req, H5VL_request_specific_args_t *args);
+H5_DLL herr_t H5VL__native_request_free(void *req);
+#endif /* H5VL_NATIVE_ASYNC */
+
+/* Asynchronous operations */
+H5_DLL herr_t H5VL__native_request_dataset_io(void *dset, hid_t mem_type_id, const H5S_t *mem_space,
+                                              const H5S_t *file_space, void *rbuf, const void *wbuf,
+                                              void **req);
+H5_DLL herr_t H5VL__native_request_file_flush(H5F_t *f, H5F_scope_t scope, void **req);
+H5_DLL herr_t H5VL__native_request_drain(const H5F_t *f);
+H5_DLL herr_t H5VL__native_request_term(void);
 
 /* Token callbacks */
 H5_DLL herr_t H5VL__native_token_cmp(void *obj, const H5O_token_t *token1, const H5O_token_t *token2,
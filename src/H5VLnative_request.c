@@ -0,0 +1,942 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Asynchronous request callbacks for the native VOL connector
+ *
+ *              In thread-safe builds, operations with a request token
+ *              (i.e. the *_async API routines) are queued and executed in
+ *              order by a background thread, which takes the library's
+ *              global lock for each operation.  Otherwise, no request is
+ *              ever created and operations complete synchronously.
+ *
+ *              The background thread takes a request off the queue only
+ *              while holding the library's lock, and finishes it before
+ *              releasing the lock, so a thread holding the lock knows that
+ *              every unfinished request is still queued.  Waiting for a
+ *              request (or for the requests on a file, before a
+ *              synchronous operation on it) runs the queued requests on the
+ *              file in the waiting thread, without giving up the lock.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5D_FRIEND /* Suppress error about including H5Dpkg    */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5CXprivate.h" /* API Contexts                             */
+#include "H5Dpkg.h"      /* Datasets                                 */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5ESprivate.h" /* Event Sets                               */
+#include "H5Fprivate.h"  /* Files                                    */
+#include "H5FLprivate.h" /* Free Lists                               */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Sprivate.h"  /* Dataspaces                               */
+#include "H5Tprivate.h"  /* Datatypes                                */
+
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
+#ifdef H5VL_NATIVE_ASYNC
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Whether the calling thread is the queue's current background thread
+ * (the queue's lock must be held)
+ */
+#define H5VL_NATIVE_REQ_THREAD_CURRENT(Q)                                                                    \
+    ((Q)->started && HDpthread_equal(HDpthread_self(), H5VL_native_req_thread_g))
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Operations that can be executed asynchronously */
+typedef enum H5VL_native_req_op_t {
+    H5VL_NATIVE_REQ_DATASET_READ,  /* Dataset raw data read */
+    H5VL_NATIVE_REQ_DATASET_WRITE, /* Dataset raw data write */
+    H5VL_NATIVE_REQ_FILE_FLUSH     /* File flush */
+} H5VL_native_req_op_t;
+
+/* Request token for an asynchronous operation */
+typedef struct H5VL_native_req_t {
+    H5VL_native_req_op_t      op_type;      /* Operation to perform */
+    H5VL_request_status_t     status;       /* Status of operation (protected by queue lock) */
+    const H5F_shared_t *      f_sh;         /* File the operation is on */
+    H5CX_state_t *            api_state;    /* API context state at submission */
+    hid_t                     err_stack_id; /* Error stack, if operation failed */
+    uint64_t                  exec_ts;      /* Timestamp for start of execution (in us) */
+    uint64_t                  exec_time;    /* Duration of execution (in ns) */
+    struct H5VL_native_req_t *next;         /* Next request in queue */
+
+    /* Parameters for each operation */
+    union {
+        /* H5VL_NATIVE_REQ_DATASET_READ / H5VL_NATIVE_REQ_DATASET_WRITE */
+        struct {
+            H5D_t *dset;        /* Dataset to access (a reference of the request's own) */
+            hid_t  mem_type_id; /* Memory datatype (held open) */
+            H5S_t *mem_space;   /* Copy of memory dataspace */
+            H5S_t *file_space;  /* Copy of file dataspace */
+            void * buf;         /* Caller's buffer for reads, private copy for writes */
+        } dset_io;
+
+        /* H5VL_NATIVE_REQ_FILE_FLUSH */
+        struct {
+            H5F_t *     f;     /* File to flush */
+            H5F_scope_t scope; /* Scope of flush */
+        } flush;
+    } u;
+} H5VL_native_req_t;
+
+/* Queue of requests and the background thread that executes them */
+typedef struct H5VL_native_req_queue_t {
+    H5TS_mutex_simple_t lock;      /* Protects the queue and request status */
+    pthread_cond_t      work_cond; /* Signaled when a request is queued or on shutdown */
+    H5VL_native_req_t * head;      /* First request waiting to execute */
+    H5VL_native_req_t * tail;      /* Last request waiting to execute */
+    size_t              npending;  /* # of requests queued or executing */
+    hbool_t             started;   /* Whether there's a background thread for the queue */
+} H5VL_native_req_queue_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static void * H5VL__native_request_thread(void *udata);
+static herr_t H5VL__native_request_submit(H5VL_native_req_t *request);
+static void   H5VL__native_request_unlink(H5VL_native_req_queue_t *queue, H5VL_native_req_t *prev,
+                                          H5VL_native_req_t *request);
+static herr_t H5VL__native_request_execute(H5VL_native_req_t *request);
+static herr_t H5VL__native_request_release(H5VL_native_req_t *request);
+static void   H5VL__native_request_run(H5VL_native_req_t *request);
+static void   H5VL__native_request_run_queued(const H5F_shared_t *f_sh, const H5VL_native_req_t *last,
+                                              uint64_t timeout);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5VL_native_req_t struct */
+H5FL_DEFINE_STATIC(H5VL_native_req_t);
+
+/* The request queue */
+static H5VL_native_req_queue_t H5VL_native_req_queue_g = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0, FALSE};
+
+/* The background thread (valid while the queue is 'started') */
+static H5TS_thread_t H5VL_native_req_thread_g;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_thread
+ *
+ * Purpose:     Background thread: executes queued requests in the order
+ *              they were submitted, until the queue stops using it.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5VL__native_request_thread(void H5_ATTR_UNUSED *udata)
+{
+    H5VL_native_req_queue_t *queue = &H5VL_native_req_queue_g;
+
+    FUNC_ENTER_STATIC_NAMECHECK_ONLY
+
+    for (;;) {
+        H5VL_native_req_t *request = NULL; /* Request to execute */
+        hbool_t            current;        /* Whether this is still the queue's thread */
+
+        /* Wait for a request, unless the queue has stopped using this thread */
+        H5TS_mutex_lock_simple(&queue->lock);
+        while ((current = H5VL_NATIVE_REQ_THREAD_CURRENT(queue)) && NULL == queue->head)
+            HDpthread_cond_wait(&queue->work_cond, &queue->lock);
+        H5TS_mutex_unlock_simple(&queue->lock);
+        if (!current)
+            break;
+
+        /* Take the first request off the queue and execute it, holding the
+         * library's lock throughout.  (The request may have been run by a
+         * thread waiting for it in the meantime.)
+         */
+        H5_API_LOCK
+        H5TS_mutex_lock_simple(&queue->lock);
+        if (H5VL_NATIVE_REQ_THREAD_CURRENT(queue) && NULL != (request = queue->head))
+            H5VL__native_request_unlink(queue, NULL, request);
+        H5TS_mutex_unlock_simple(&queue->lock);
+        if (request)
+            H5VL__native_request_run(request);
+        H5_API_UNLOCK
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(NULL)
+} /* end H5VL__native_request_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_submit
+ *
+ * Purpose:     Adds a request to the end of the queue, starting the
+ *              background thread if necessary.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_request_submit(H5VL_native_req_t *request)
+{
+    H5VL_native_req_queue_t *queue     = &H5VL_native_req_queue_g;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(request);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+
+    /* Start the background thread on first use.  It isn't joined, since it
+     * may be waiting for the library's lock when the queue stops using it.
+     */
+    if (!queue->started) {
+        if (0 != HDpthread_create(&H5VL_native_req_thread_g, NULL, H5VL__native_request_thread, NULL)) {
+            H5TS_mutex_unlock_simple(&queue->lock);
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCREATE, FAIL, "can't create background thread")
+        } /* end if */
+        (void)HDpthread_detach(H5VL_native_req_thread_g);
+        queue->started = TRUE;
+    } /* end if */
+
+    /* Append the request */
+    request->status = H5VL_REQUEST_STATUS_IN_PROGRESS;
+    if (queue->tail)
+        queue->tail->next = request;
+    else
+        queue->head = request;
+    queue->tail = request;
+    queue->npending++;
+    HDpthread_cond_signal(&queue->work_cond);
+
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_submit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_unlink
+ *
+ * Purpose:     Takes a request off the queue, given the request before it
+ *              (or NULL for the first request).  The queue's lock must be
+ *              held.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5VL__native_request_unlink(H5VL_native_req_queue_t *queue, H5VL_native_req_t *prev,
+                            H5VL_native_req_t *request)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(queue);
+    HDassert(request);
+    HDassert(prev ? prev->next == request : queue->head == request);
+
+    if (prev)
+        prev->next = request->next;
+    else
+        queue->head = request->next;
+    if (queue->tail == request)
+        queue->tail = prev;
+    request->next = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VL__native_request_unlink() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_execute
+ *
+ * Purpose:     Performs a request's operation, in an API context restored
+ *              from the one it was submitted in.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_request_execute(H5VL_native_req_t *request)
+{
+    hbool_t api_ctx_pushed = FALSE;   /* Whether an API context was pushed */
+    herr_t  ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(request);
+
+    request->exec_ts = H5_now_usec();
+
+    /* Set up the API context */
+    if (H5CX_push() < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+    if (H5CX_restore_state(request->api_state) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't restore API context state")
+
+    switch (request->op_type) {
+        case H5VL_NATIVE_REQ_DATASET_READ:
+            if (H5D__read(request->u.dset_io.dset, request->u.dset_io.mem_type_id,
+                          request->u.dset_io.mem_space, request->u.dset_io.file_space, NULL,
+                          request->u.dset_io.buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            break;
+
+        case H5VL_NATIVE_REQ_DATASET_WRITE:
+            if (H5D__write(request->u.dset_io.dset, request->u.dset_io.mem_type_id,
+                           request->u.dset_io.mem_space, request->u.dset_io.file_space, NULL,
+                           request->u.dset_io.buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+            break;
+
+        case H5VL_NATIVE_REQ_FILE_FLUSH:
+            if (H5VL__native_file_flush(request->u.flush.f, request->u.flush.scope) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid asynchronous operation")
+    } /* end switch */
+
+done:
+    if (api_ctx_pushed)
+        (void)H5CX_pop(FALSE);
+    request->exec_time = (H5_now_usec() - request->exec_ts) * 1000;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_execute() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_release
+ *
+ * Purpose:     Releases the resources a request holds for its operation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_request_release(H5VL_native_req_t *request)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(request);
+
+    if (H5VL_NATIVE_REQ_DATASET_READ == request->op_type ||
+        H5VL_NATIVE_REQ_DATASET_WRITE == request->op_type) {
+        if (request->u.dset_io.mem_space && H5S_close(request->u.dset_io.mem_space) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "unable to release memory dataspace")
+        if (request->u.dset_io.file_space && H5S_close(request->u.dset_io.file_space) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "unable to release file dataspace")
+        if (H5I_INVALID_HID != request->u.dset_io.mem_type_id &&
+            H5I_dec_ref(request->u.dset_io.mem_type_id) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "unable to decrement ref count on memory datatype")
+        if (request->u.dset_io.dset && H5D_close(request->u.dset_io.dset) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "unable to release dataset")
+        if (H5VL_NATIVE_REQ_DATASET_WRITE == request->op_type)
+            H5MM_xfree(request->u.dset_io.buf);
+        request->u.dset_io.dset        = NULL;
+        request->u.dset_io.mem_space   = NULL;
+        request->u.dset_io.file_space  = NULL;
+        request->u.dset_io.mem_type_id = H5I_INVALID_HID;
+        request->u.dset_io.buf         = NULL;
+    } /* end if */
+
+    if (request->api_state && H5CX_free_state(request->api_state) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "unable to release API context state")
+    request->api_state = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_run
+ *
+ * Purpose:     Executes a request taken off the queue, releases the
+ *              resources it holds and publishes its status.  The caller
+ *              must hold the library's lock.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5VL__native_request_run(H5VL_native_req_t *request)
+{
+    H5VL_native_req_queue_t *queue = &H5VL_native_req_queue_g;
+    H5VL_request_status_t    status; /* Status of request */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(request);
+
+    H5E_clear_stack(NULL);
+    if (H5VL__native_request_execute(request) < 0) {
+        status = H5VL_REQUEST_STATUS_FAIL;
+
+        /* Keep the operation's errors for H5ESget_err_info() */
+        request->err_stack_id = H5E_get_current_stack_id();
+    } /* end if */
+    else
+        status = H5VL_REQUEST_STATUS_SUCCEED;
+    if (H5VL__native_request_release(request) < 0) {
+        status = H5VL_REQUEST_STATUS_FAIL;
+        if (H5I_INVALID_HID == request->err_stack_id)
+            request->err_stack_id = H5E_get_current_stack_id();
+    } /* end if */
+    H5E_clear_stack(NULL);
+
+    /* Publish the request's status */
+    H5TS_mutex_lock_simple(&queue->lock);
+    request->status = status;
+    queue->npending--;
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VL__native_request_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_run_queued
+ *
+ * Purpose:     Runs the queued requests on the file F_SH (or on any file,
+ *              when F_SH is NULL) in the calling thread, in the order they
+ *              were submitted, until LAST (when not NULL) has completed,
+ *              there are none left, or TIMEOUT nanoseconds have passed.
+ *              The caller must hold the library's lock.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5VL__native_request_run_queued(const H5F_shared_t *f_sh, const H5VL_native_req_t *last, uint64_t timeout)
+{
+    H5VL_native_req_queue_t *queue    = &H5VL_native_req_queue_g;
+    uint64_t                 deadline = 0; /* Time to stop running requests (in us) */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (timeout != H5ES_WAIT_FOREVER)
+        deadline = H5_now_usec() + timeout / 1000;
+
+    for (;;) {
+        H5VL_native_req_t *prev = NULL; /* Previous request in queue */
+        H5VL_native_req_t *request;     /* Request to run */
+
+        /* Take the file's next request off the queue */
+        H5TS_mutex_lock_simple(&queue->lock);
+        if (last && H5VL_REQUEST_STATUS_IN_PROGRESS != last->status)
+            request = NULL;
+        else {
+            for (request = queue->head; request && f_sh && request->f_sh != f_sh; request = request->next)
+                prev = request;
+            if (request)
+                H5VL__native_request_unlink(queue, prev, request);
+        } /* end else */
+        H5TS_mutex_unlock_simple(&queue->lock);
+        if (NULL == request)
+            break;
+
+        H5VL__native_request_run(request);
+        if (timeout != H5ES_WAIT_FOREVER && H5_now_usec() >= deadline)
+            break;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VL__native_request_run_queued() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_wait
+ *
+ * Purpose:     Handles the request 'wait' callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_wait(void *req, uint64_t timeout, H5VL_request_status_t *status /*out*/)
+{
+    H5VL_native_req_t *request = (H5VL_native_req_t *)req;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(request);
+    HDassert(status);
+
+    /* Run the request and those before it on its file, unless only testing it */
+    H5TS_mutex_lock_simple(&H5VL_native_req_queue_g.lock);
+    *status = request->status;
+    H5TS_mutex_unlock_simple(&H5VL_native_req_queue_g.lock);
+    if (H5VL_REQUEST_STATUS_IN_PROGRESS == *status && timeout > 0) {
+        H5VL__native_request_run_queued(request->f_sh, request, timeout);
+
+        H5TS_mutex_lock_simple(&H5VL_native_req_queue_g.lock);
+        *status = request->status;
+        H5TS_mutex_unlock_simple(&H5VL_native_req_queue_g.lock);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_cancel
+ *
+ * Purpose:     Handles the request 'cancel' callback.  Only a request that
+ *              hasn't started executing can be canceled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_cancel(void *req, H5VL_request_status_t *status /*out*/)
+{
+    H5VL_native_req_queue_t *queue     = &H5VL_native_req_queue_g;
+    H5VL_native_req_t *      request   = (H5VL_native_req_t *)req;
+    hbool_t                  canceled  = FALSE;   /* Whether the request was removed from the queue */
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(request);
+    HDassert(status);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+    if (H5VL_REQUEST_STATUS_IN_PROGRESS == request->status) {
+        H5VL_native_req_t *prev = NULL;   /* Previous request in queue */
+        H5VL_native_req_t *curr;          /* Current request in queue */
+
+        /* Look for the request in the queue */
+        for (curr = queue->head; curr && curr != request; curr = curr->next)
+            prev = curr;
+        if (curr) {
+            H5VL__native_request_unlink(queue, prev, curr);
+            queue->npending--;
+            request->status = H5VL_REQUEST_STATUS_CANCELED;
+            canceled        = TRUE;
+        } /* end if */
+        else
+            /* Already executing */
+            *status = H5VL_REQUEST_STATUS_CANT_CANCEL;
+    } /* end if */
+    if (H5VL_REQUEST_STATUS_IN_PROGRESS != request->status)
+        *status = request->status;
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    /* Release the canceled operation's resources */
+    if (canceled && H5VL__native_request_release(request) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release canceled request")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_cancel() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_specific
+ *
+ * Purpose:     Handles the request 'specific' callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_specific(void *req, H5VL_request_specific_args_t *args)
+{
+    H5VL_native_req_t *request   = (H5VL_native_req_t *)req;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(request);
+    HDassert(args);
+
+    switch (args->op_type) {
+        /* H5VL_REQUEST_GET_ERR_STACK */
+        case H5VL_REQUEST_GET_ERR_STACK:
+            /* Give the caller its own reference to the error stack */
+            if (H5I_INVALID_HID != request->err_stack_id)
+                if (H5I_inc_ref(request->err_stack_id, TRUE) < 0)
+                    HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't increment ref count on error stack")
+            args->args.get_err_stack.err_stack_id = request->err_stack_id;
+            break;
+
+        /* H5VL_REQUEST_GET_EXEC_TIME */
+        case H5VL_REQUEST_GET_EXEC_TIME:
+            *args->args.get_exec_time.exec_ts   = request->exec_ts;
+            *args->args.get_exec_time.exec_time = request->exec_time;
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid specific operation")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_free
+ *
+ * Purpose:     Handles the request 'free' callback, running the
+ *              request's operation if it hasn't completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_free(void *req)
+{
+    H5VL_native_req_t *request   = (H5VL_native_req_t *)req;
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(request);
+
+    /* The request may still be queued */
+    H5VL__native_request_run_queued(request->f_sh, request, H5ES_WAIT_FOREVER);
+
+    if (H5I_INVALID_HID != request->err_stack_id && H5I_dec_ref(request->err_stack_id) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't decrement ref count on error stack")
+
+done:
+    request = H5FL_FREE(H5VL_native_req_t, request);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_dataset_io
+ *
+ * Purpose:     Queues a read into RBUF or a write from WBUF (whichever
+ *              isn't NULL) for execution in the background, returning a
+ *              request token in *REQ.
+ *
+ *              Read buffers must stay valid until the request completes;
+ *              write buffers are copied.  The request holds its own
+ *              reference to the dataset, the dataspaces are copied and the
+ *              API context (including the DXPL) is captured, so the caller
+ *              may release or change them after submission.
+ *
+ *              *REQ is left NULL when the operation can't be run in the
+ *              background (no thread support, or variable-length or
+ *              reference data in a write), and the caller must then
+ *              perform the operation itself.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_dataset_io(void *dset, hid_t mem_type_id, const H5S_t *mem_space,
+                                const H5S_t *file_space, void *rbuf, const void *wbuf, void **req)
+{
+    H5VL_native_req_t *request   = NULL;    /* New request */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(mem_space);
+    HDassert(file_space);
+    HDassert(req && NULL == *req);
+
+    {
+        const H5T_t *mem_type; /* Memory datatype */
+        size_t       buf_size; /* Size of write buffer */
+
+        if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+        /* Writes of pointer-based data are left to the caller, since the
+         * data the pointers refer to can't be copied here.
+         */
+        if (wbuf && (H5T_detect_class(mem_type, H5T_VLEN, FALSE) > 0 ||
+                     H5T_detect_class(mem_type, H5T_REFERENCE, FALSE) > 0))
+            HGOTO_DONE(SUCCEED)
+
+        if (NULL == (request = H5FL_CALLOC(H5VL_native_req_t)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate request")
+        request->op_type               = rbuf ? H5VL_NATIVE_REQ_DATASET_READ : H5VL_NATIVE_REQ_DATASET_WRITE;
+        request->err_stack_id          = H5I_INVALID_HID;
+        request->f_sh                  = H5F_SHARED(((H5D_t *)dset)->oloc.file);
+        request->u.dset_io.mem_type_id = H5I_INVALID_HID;
+
+        /* Hold the dataset open */
+        if (NULL == (request->u.dset_io.dset = H5D__reopen((H5D_t *)dset)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTOPENOBJ, FAIL, "can't hold dataset open")
+
+        /* Capture the API context, including the DXPL */
+        if (H5CX_retrieve_state(&request->api_state) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't retrieve API context state")
+
+        /* Hold the memory datatype open */
+        if (H5I_inc_ref(mem_type_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't increment ref count on memory datatype")
+        request->u.dset_io.mem_type_id = mem_type_id;
+
+        /* Copy the dataspaces */
+        if (NULL == (request->u.dset_io.mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy memory dataspace")
+        if (NULL == (request->u.dset_io.file_space = H5S_copy(file_space, FALSE, TRUE)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy file dataspace")
+
+        /* Use the caller's buffer for reads and a copy of it for writes */
+        if (rbuf)
+            request->u.dset_io.buf = rbuf;
+        else if (wbuf && (buf_size = (size_t)H5S_GET_EXTENT_NPOINTS(mem_space) * H5T_get_size(mem_type)) > 0) {
+            if (NULL == (request->u.dset_io.buf = H5MM_malloc(buf_size)))
+                HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate copy of write buffer")
+            H5MM_memcpy(request->u.dset_io.buf, wbuf, buf_size);
+        } /* end if */
+
+        if (H5VL__native_request_submit(request) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, FAIL, "can't queue request")
+        *req = request;
+    }
+
+done:
+    if (ret_value < 0 && request) {
+        if (H5VL__native_request_release(request) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release request")
+        request = H5FL_FREE(H5VL_native_req_t, request);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_dataset_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_file_flush
+ *
+ * Purpose:     Queues a flush of a file for execution in the background,
+ *              returning a request token in *REQ.  *REQ is left NULL
+ *              when there's no thread support, and the caller must then
+ *              flush the file itself.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_file_flush(H5F_t *f, H5F_scope_t scope, void **req)
+{
+    H5VL_native_req_t *request   = NULL;    /* New request */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(req && NULL == *req);
+
+    if (NULL == (request = H5FL_CALLOC(H5VL_native_req_t)))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate request")
+    request->op_type       = H5VL_NATIVE_REQ_FILE_FLUSH;
+    request->err_stack_id  = H5I_INVALID_HID;
+    request->f_sh          = H5F_SHARED(f);
+    request->u.flush.f     = f;
+    request->u.flush.scope = scope;
+
+    /* Capture the API context */
+    if (H5CX_retrieve_state(&request->api_state) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't retrieve API context state")
+
+    if (H5VL__native_request_submit(request) < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTINSERT, FAIL, "can't queue request")
+    *req = request;
+
+done:
+    if (ret_value < 0 && request) {
+        if (H5VL__native_request_release(request) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release request")
+        request = H5FL_FREE(H5VL_native_req_t, request);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_file_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_drain
+ *
+ * Purpose:     Completes the queued requests on file F (on any file, when
+ *              F is NULL), so that a synchronous operation on it observes
+ *              their effects.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_drain(const H5F_t *f)
+{
+    H5VL_native_req_queue_t *queue = &H5VL_native_req_queue_g;
+    hbool_t                  busy; /* Whether requests are outstanding */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Nothing to run when idle, or when called by the background thread
+     * while executing a request.
+     */
+    H5TS_mutex_lock_simple(&queue->lock);
+    busy = queue->npending > 0 && !H5VL_NATIVE_REQ_THREAD_CURRENT(queue);
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    if (busy)
+        H5VL__native_request_run_queued(f ? H5F_SHARED(f) : NULL, NULL, H5ES_WAIT_FOREVER);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_term
+ *
+ * Purpose:     Completes the queued requests and stops using the
+ *              background thread, which exits on its own (once it can
+ *              take the library's lock, if it's waiting for it).
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_term(void)
+{
+    H5VL_native_req_queue_t *queue = &H5VL_native_req_queue_g;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    (void)H5VL__native_request_drain(NULL);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+    queue->started = FALSE;
+    HDpthread_cond_signal(&queue->work_cond);
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_term() */
+
+#else /* H5VL_NATIVE_ASYNC */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_dataset_io
+ *
+ * Purpose:     Without thread support, dataset I/O is never queued and
+ *              *REQ is left NULL.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_dataset_io(void H5_ATTR_UNUSED *dset, hid_t H5_ATTR_UNUSED mem_type_id,
+                                const H5S_t H5_ATTR_UNUSED *mem_space, const H5S_t H5_ATTR_UNUSED *file_space,
+                                void H5_ATTR_UNUSED *rbuf, const void H5_ATTR_UNUSED *wbuf,
+                                void H5_ATTR_UNUSED **req)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_dataset_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_file_flush
+ *
+ * Purpose:     Without thread support, flushes are never queued and *REQ
+ *              is left NULL.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_file_flush(H5F_t H5_ATTR_UNUSED *f, H5F_scope_t H5_ATTR_UNUSED scope,
+                                void H5_ATTR_UNUSED **req)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_file_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_drain
+ *
+ * Purpose:     Without thread support, there are never queued requests.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_drain(const H5F_t H5_ATTR_UNUSED *f)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_term
+ *
+ * Purpose:     Without thread support, there's no thread to stop.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_term() */
+
+#endif /* H5VL_NATIVE_ASYNC */
@@ -97,6 +97,8 @@ H5Z__init_package(void)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register nbit filter")
     if (H5Z_register(H5Z_SCALEOFFSET) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register scaleoffset filter")
+    if (H5Z_register(H5Z_LZ) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register lz filter")
 
         /* External filters */
 #ifdef H5_HAVE_FILTER_DEFLATE
@@ -183,6 +185,11 @@ next:
         }         /* end if */
 #endif            /* H5Z_DEBUG */
 
+#ifdef H5_HAVE_FILTER_DEFLATE
+        /* Release the deflate filter's reusable zlib streams */
+        H5Z__deflate_term();
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
         /* Free the table of filters */
         if (H5Z_table_g) {
             H5Z_table_g = (H5Z_class2_t *)H5MM_xfree(H5Z_table_g);
@@ -1538,6 +1545,47 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_filter_in_pline() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5Z_compression_mask
+ *
+ * Purpose:  Builds a filter mask with a bit set for each filter in the
+ *           pipeline that only serves to make the data smaller (the
+ *           library's compression filters and the shuffle filter, which
+ *           just reorders bytes for them).  Skipping those filters
+ *           leaves the data valid and keeps checksums and any other
+ *           filters in force.
+ *
+ * Return:   Filter mask (can't fail)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5Z_compression_mask(const H5O_pline_t *pline)
+{
+    size_t   idx;           /* Index of filter in pipeline */
+    unsigned ret_value = 0; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(pline);
+
+    for (idx = 0; idx < pline->nused; idx++)
+        switch (pline->filter[idx].id) {
+            case H5Z_FILTER_DEFLATE:
+            case H5Z_FILTER_SHUFFLE:
+            case H5Z_FILTER_SZIP:
+            case H5Z_FILTER_NBIT:
+            case H5Z_FILTER_SCALEOFFSET:
+            case H5Z_FILTER_LZ:
+                ret_value |= (unsigned)1 << idx;
+                break;
+
+            default:
+                break;
+        } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_compression_mask() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_all_filters_avail
  *
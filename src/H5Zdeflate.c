@@ -32,6 +32,20 @@
 #include H5_ZLIB_HEADER /* "zlib.h" */
 #endif
 
+/* Reusable zlib stream state.  Setting up a z_stream allocates zlib's
+ * internal state (about 256KB for deflate at the default settings), which
+ * costs as much as (de)compressing a small chunk, so one of each kind of
+ * stream is kept around and reset between chunks.  (The library is
+ * serialized by its global lock, so a single context serves all threads.)
+ */
+typedef struct H5Z_deflate_ctx_t {
+    z_stream inflate_strm;  /* Stream for uncompressing */
+    hbool_t  inflate_init;  /* Whether inflate_strm is initialized */
+    z_stream deflate_strm;  /* Stream for compressing */
+    hbool_t  deflate_init;  /* Whether deflate_strm is initialized */
+    int      deflate_level; /* Aggression level deflate_strm was set up with */
+} H5Z_deflate_ctx_t;
+
 /* Local function prototypes */
 static size_t H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                                   size_t *buf_size, void **buf);
@@ -48,7 +62,34 @@ const H5Z_class2_t H5Z_DEFLATE[1] = {{
     H5Z__filter_deflate, /* The actual filter function	*/
 }};
 
-#define H5Z_DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s)) * 1.001) + 12)
+/* Reusable zlib streams */
+static H5Z_deflate_ctx_t H5Z_deflate_ctx_s;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deflate_term
+ *
+ * Purpose:	Release the reusable zlib streams
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z__deflate_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (H5Z_deflate_ctx_s.inflate_init) {
+        (void)inflateEnd(&H5Z_deflate_ctx_s.inflate_strm);
+        H5Z_deflate_ctx_s.inflate_init = FALSE;
+    } /* end if */
+    if (H5Z_deflate_ctx_s.deflate_init) {
+        (void)deflateEnd(&H5Z_deflate_ctx_s.deflate_strm);
+        H5Z_deflate_ctx_s.deflate_init = FALSE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5Z__deflate_term() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z__filter_deflate
@@ -56,6 +97,12 @@ const H5Z_class2_t H5Z_DEFLATE[1] = {{
  * Purpose:	Implement an I/O filter around the 'deflate' algorithm in
  *              libz
  *
+ *              When uncompressing, *BUF_SIZE is used as the initial size
+ *              of the output buffer, so callers that know the size of the
+ *              uncompressed data can allocate the input buffer at least
+ *              that large to have the data inflated in a single pass,
+ *              without reallocating the output.
+ *
  * Return:	Success: Size of buffer filtered
  *		Failure: 0
  *
@@ -85,58 +132,54 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
 
     if (flags & H5Z_FLAG_REVERSE) {
         /* Input; uncompress */
-        z_stream z_strm;             /* zlib parameters */
-        size_t   nalloc = *buf_size; /* Number of bytes for output (compressed) buffer */
+        z_stream *z_strm = &H5Z_deflate_ctx_s.inflate_strm; /* zlib parameters */
+        size_t    nalloc = *buf_size; /* Number of bytes for output (uncompressed) buffer */
 
-        /* Allocate space for the compressed buffer */
+        /* Allocate space for the uncompressed buffer */
         if (NULL == (outbuf = H5MM_malloc(nalloc)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for deflate uncompression")
 
+        /* Initialize the uncompression routines, or reset the stream from
+         * the last chunk */
+        if (!H5Z_deflate_ctx_s.inflate_init) {
+            HDmemset(z_strm, 0, sizeof(*z_strm));
+            if (Z_OK != inflateInit(z_strm))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflateInit() failed")
+            H5Z_deflate_ctx_s.inflate_init = TRUE;
+        } /* end if */
+        else if (Z_OK != inflateReset(z_strm))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflateReset() failed")
+
         /* Set the uncompression parameters */
-        HDmemset(&z_strm, 0, sizeof(z_strm));
-        z_strm.next_in = (Bytef *)*buf;
-        H5_CHECKED_ASSIGN(z_strm.avail_in, unsigned, nbytes, size_t);
-        z_strm.next_out = (Bytef *)outbuf;
-        H5_CHECKED_ASSIGN(z_strm.avail_out, unsigned, nalloc, size_t);
-
-        /* Initialize the uncompression routines */
-        if (Z_OK != inflateInit(&z_strm))
-            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflateInit() failed")
-
-        /* Loop to uncompress the buffer */
-        do {
-            /* Uncompress some data */
-            status = inflate(&z_strm, Z_SYNC_FLUSH);
-
-            /* Check if we are done uncompressing data */
-            if (Z_STREAM_END == status)
-                break; /*done*/
-
-            /* Check for error */
-            if (Z_OK != status) {
-                (void)inflateEnd(&z_strm);
+        z_strm->next_in = (Bytef *)*buf;
+        H5_CHECKED_ASSIGN(z_strm->avail_in, unsigned, nbytes, size_t);
+        z_strm->next_out = (Bytef *)outbuf;
+        H5_CHECKED_ASSIGN(z_strm->avail_out, unsigned, nalloc, size_t);
+
+        /* Uncompress the whole buffer in one step, which succeeds when the
+         * output buffer is big enough (the usual case, when the caller knows
+         * the size of the uncompressed data).  Otherwise, loop to grow the
+         * output buffer until the stream is finished.
+         */
+        while (Z_STREAM_END != (status = inflate(z_strm, Z_FINISH))) {
+            void *new_outbuf; /* Pointer to new output buffer */
+
+            /* Check for error.  (Z_BUF_ERROR just means that no progress was
+             * possible, which is only an error if there's output space left.)
+             */
+            if (Z_OK != status && !(Z_BUF_ERROR == status && 0 == z_strm->avail_out))
                 HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflate() failed")
-            }
-            else {
-                /* If we're not done and just ran out of buffer space, get more */
-                if (0 == z_strm.avail_out) {
-                    void *new_outbuf; /* Pointer to new output buffer */
-
-                    /* Allocate a buffer twice as big */
-                    nalloc *= 2;
-                    if (NULL == (new_outbuf = H5MM_realloc(outbuf, nalloc))) {
-                        (void)inflateEnd(&z_strm);
-                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
-                                    "memory allocation failed for deflate uncompression")
-                    } /* end if */
-                    outbuf = new_outbuf;
-
-                    /* Update pointers to buffer for next set of uncompressed data */
-                    z_strm.next_out  = (unsigned char *)outbuf + z_strm.total_out;
-                    z_strm.avail_out = (uInt)(nalloc - z_strm.total_out);
-                } /* end if */
-            }     /* end else */
-        } while (status == Z_OK);
+
+            /* Allocate a buffer twice as big */
+            nalloc *= 2;
+            if (NULL == (new_outbuf = H5MM_realloc(outbuf, nalloc)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for deflate uncompression")
+            outbuf = new_outbuf;
+
+            /* Update pointers to buffer for next set of uncompressed data */
+            z_strm->next_out  = (unsigned char *)outbuf + z_strm->total_out;
+            z_strm->avail_out = (uInt)(nalloc - z_strm->total_out);
+        } /* end while */
 
         /* Free the input buffer */
         H5MM_xfree(*buf);
@@ -145,10 +188,7 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
         *buf      = outbuf;
         outbuf    = NULL;
         *buf_size = nalloc;
-        ret_value = z_strm.total_out;
-
-        /* Finish uncompressing the stream */
-        (void)inflateEnd(&z_strm);
+        ret_value = z_strm->total_out;
     } /* end if */
     else {
         /*
@@ -156,31 +196,51 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
          * input.  The library doesn't provide in-place compression, so we
          * must allocate a separate buffer for the result.
          */
-        const Bytef *z_src = (const Bytef *)(*buf);
-        Bytef *      z_dst; /*destination buffer		*/
-        uLongf       z_dst_nbytes = (uLongf)H5Z_DEFLATE_SIZE_ADJUST(nbytes);
-        uLong        z_src_nbytes = (uLong)nbytes;
-        int          aggression; /* Compression aggression setting */
+        z_stream *z_strm = &H5Z_deflate_ctx_s.deflate_strm; /* zlib parameters */
+        size_t    z_dst_nbytes;                              /* Size of destination buffer */
+        int       aggression;                                /* Compression aggression setting */
 
         /* Set the compression aggression level */
         H5_CHECKED_ASSIGN(aggression, int, cd_values[0], unsigned);
 
-        /* Allocate output (compressed) buffer */
+        /* Initialize the compression routines, or reset the stream from the
+         * last chunk, switching to this level if it changed
+         */
+        if (H5Z_deflate_ctx_s.deflate_init && H5Z_deflate_ctx_s.deflate_level != aggression) {
+            (void)deflateEnd(z_strm);
+            H5Z_deflate_ctx_s.deflate_init = FALSE;
+        } /* end if */
+        if (!H5Z_deflate_ctx_s.deflate_init) {
+            HDmemset(z_strm, 0, sizeof(*z_strm));
+            status = deflateInit(z_strm, aggression);
+            if (Z_MEM_ERROR == status)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflate memory error")
+            else if (Z_OK != status)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflateInit() failed")
+            H5Z_deflate_ctx_s.deflate_init  = TRUE;
+            H5Z_deflate_ctx_s.deflate_level = aggression;
+        } /* end if */
+        else if (Z_OK != deflateReset(z_strm))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflateReset() failed")
+
+        /* Allocate output (compressed) buffer, big enough for the worst case */
+        z_dst_nbytes = (size_t)deflateBound(z_strm, (uLong)nbytes);
         if (NULL == (outbuf = H5MM_malloc(z_dst_nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
-        z_dst = (Bytef *)outbuf;
 
         /* Perform compression from the source to the destination buffer */
-        status = compress2(z_dst, &z_dst_nbytes, z_src, z_src_nbytes, aggression);
+        z_strm->next_in = (Bytef *)*buf;
+        H5_CHECKED_ASSIGN(z_strm->avail_in, unsigned, nbytes, size_t);
+        z_strm->next_out = (Bytef *)outbuf;
+        H5_CHECKED_ASSIGN(z_strm->avail_out, unsigned, z_dst_nbytes, size_t);
+        status = deflate(z_strm, Z_FINISH);
 
         /* Check for various zlib errors */
-        if (Z_BUF_ERROR == status)
+        if (Z_OK == status || Z_BUF_ERROR == status)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "overflow")
-        else if (Z_MEM_ERROR == status)
-            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflate memory error")
-        else if (Z_OK != status)
+        else if (Z_STREAM_END != status)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "other deflate error")
-        /* Successfully uncompressed the buffer */
+        /* Successfully compressed the buffer */
         else {
             /* Free the input buffer */
             H5MM_xfree(*buf);
@@ -189,7 +249,7 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
             *buf      = outbuf;
             outbuf    = NULL;
             *buf_size = nbytes;
-            ret_value = z_dst_nbytes;
+            ret_value = z_strm->total_out;
         } /* end else */
     }     /* end else */
 
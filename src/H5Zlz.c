@@ -0,0 +1,617 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     A fast, built-in compression filter from the LZ77 family.
+ *
+ *              The filter trades compression ratio for speed: matches are
+ *              found with a single hash probe and encoded byte-aligned, so
+ *              that decoding is a sequence of (mostly 16-byte) copies.
+ *
+ *              Filtered data is laid out as:
+ *
+ *                  version                         1 byte
+ *                  log2(block size)                1 byte
+ *                  size of the unfiltered data     8 bytes, little-endian
+ *                  blocks, each:
+ *                      size of encoded block       4 bytes, little-endian,
+ *                                                  high bit set if the block
+ *                                                  is stored uncompressed
+ *                      encoded block
+ *
+ *              Blocks are independent of each other, which lets them be
+ *              compressed in parallel.  Within a block, the encoding is a
+ *              series of sequences, each:
+ *
+ *                  token                           1 byte: literal length
+ *                                                  (high 4 bits) and match
+ *                                                  length - 4 (low 4 bits)
+ *                  [literal length extension]      255-valued bytes, then
+ *                                                  the remainder, if the
+ *                                                  literal length is >= 15
+ *                  literals
+ *                  match offset                    2 bytes, little-endian
+ *                  [match length extension]        as for literals
+ *
+ *              The last sequence of a block has only literals.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+/* Compression threads are only available when the library links with
+ * Pthreads, i.e. for thread-safe builds */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5Z_LZ_HAVE_THREADS
+#endif
+
+/* Format of filtered data */
+#define H5Z_LZ_VERSION     1
+#define H5Z_LZ_HDR_SIZE    10
+#define H5Z_LZ_BLK_HDR     4
+#define H5Z_LZ_BLK_RAW     0x80000000
+#define H5Z_LZ_BLOCK_LOG   16
+#define H5Z_LZ_BLOCK_SIZE  ((size_t)1 << H5Z_LZ_BLOCK_LOG)
+#define H5Z_LZ_MAX_THREADS 32
+
+/* Encoding parameters */
+#define H5Z_LZ_MIN_MATCH     4  /* Shortest match encoded */
+#define H5Z_LZ_LAST_LITERALS 5  /* Bytes at the end of a block always sent as literals */
+#define H5Z_LZ_MF_LIMIT      12 /* Matches don't start in this many bytes at the end of a block */
+#define H5Z_LZ_HASH_LOG      13
+#define H5Z_LZ_SKIP_TRIGGER  6 /* Speed up search through incompressible data */
+#define H5Z_LZ_COPY          16
+
+/* Number of entries in the hash table */
+#define H5Z_LZ_TABLE_SIZE ((size_t)1 << H5Z_LZ_HASH_LOG)
+
+/* Size of the worst-case encoding of an N byte block */
+#define H5Z_LZ_BLOCK_BOUND(N) ((N) + ((N) / 255) + 16)
+
+/* Hash of the four bytes at P */
+#define H5Z_LZ_HASH(P) ((H5Z__lz_read32(P) * 2654435761U) >> (32 - H5Z_LZ_HASH_LOG))
+
+/* Information for compressing a range of blocks */
+typedef struct H5Z_lz_work_t {
+    const uint8_t *src;      /* Unfiltered data */
+    size_t         nbytes;   /* Size of unfiltered data */
+    uint8_t *      dst;      /* Encoded blocks, each at a multiple of the block bound */
+    size_t *       enc_size; /* Size of each encoded block (out) */
+    uint16_t *     table;    /* Hash table for finding matches */
+    size_t         first;    /* First block to compress */
+    size_t         stride;   /* Distance between blocks to compress */
+    size_t         nblocks;  /* Total number of blocks */
+} H5Z_lz_work_t;
+
+/* Local function prototypes */
+static size_t H5Z__filter_lz(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                             size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_LZ[1] = {{
+    H5Z_CLASS_T_VERS,  /* H5Z_class_t version */
+    H5Z_FILTER_LZ,     /* Filter id number		*/
+    1,                 /* encoder_present flag (set to true) */
+    1,                 /* decoder_present flag (set to true) */
+    "lz",              /* Filter name for debugging	*/
+    NULL,              /* The "can apply" callback     */
+    NULL,              /* The "set local" callback     */
+    H5Z__filter_lz,    /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_read32
+ *
+ * Purpose:	Read four unaligned bytes, in native order
+ *
+ * Return:	The bytes, as an integer
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5Z__lz_read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    HDmemcpy(&v, p, sizeof(v));
+    return v;
+} /* end H5Z__lz_read32() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_put_length
+ *
+ * Purpose:	Encode the extension bytes for a literal or match length
+ *              that didn't fit in its token nibble
+ *
+ * Return:	Pointer past the extension bytes
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint8_t *
+H5Z__lz_put_length(uint8_t *op, size_t len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (uint8_t)len;
+
+    return op;
+} /* end H5Z__lz_put_length() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_compress_block
+ *
+ * Purpose:	Encode one block of at most H5Z_LZ_BLOCK_SIZE bytes.
+ *              DST must have room for H5Z_LZ_BLOCK_BOUND(NBYTES) bytes.
+ *              TABLE holds the most recent position of each hash.
+ *
+ * Return:	Size of the encoded block (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__lz_compress_block(const uint8_t *src, size_t nbytes, uint8_t *dst, uint16_t *table)
+{
+    const uint8_t *ip     = src; /* Current input position */
+    const uint8_t *anchor = src; /* Start of pending literals */
+    const uint8_t *iend   = src + nbytes;
+    uint8_t *      op     = dst;
+    size_t         lit_len;
+
+    HDassert(nbytes <= H5Z_LZ_BLOCK_SIZE);
+
+    if (nbytes > H5Z_LZ_MF_LIMIT) {
+        const uint8_t *mflimit    = iend - H5Z_LZ_MF_LIMIT;
+        const uint8_t *match_end  = iend - H5Z_LZ_LAST_LITERALS;
+        unsigned       search_cnt = 1U << H5Z_LZ_SKIP_TRIGGER;
+
+        HDmemset(table, 0, H5Z_LZ_TABLE_SIZE * sizeof(uint16_t));
+
+        /* Skip position 0, which every hash bucket already points at */
+        ip++;
+
+        while (ip < mflimit) {
+            uint32_t       h   = H5Z_LZ_HASH(ip);
+            const uint8_t *ref = src + table[h];
+            size_t         match_len;
+            size_t         offset;
+            uint8_t *      token;
+
+            table[h] = (uint16_t)(ip - src);
+
+            /* Move on if there's no match here, going faster the longer
+             * it's been since the last one */
+            if (H5Z__lz_read32(ref) != H5Z__lz_read32(ip) || ref >= ip) {
+                ip += search_cnt++ >> H5Z_LZ_SKIP_TRIGGER;
+                continue;
+            } /* end if */
+            search_cnt = 1U << H5Z_LZ_SKIP_TRIGGER;
+
+            /* Extend the match backward, over pending literals */
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            } /* end while */
+
+            /* Extend the match forward */
+            match_len = H5Z_LZ_MIN_MATCH;
+            while (ip + match_len < match_end && ip[match_len] == ref[match_len])
+                match_len++;
+            offset = (size_t)(ip - ref);
+
+            /* Encode the literals, then the match */
+            lit_len = (size_t)(ip - anchor);
+            token   = op++;
+            if (lit_len >= 15) {
+                *token = 15 << 4;
+                op     = H5Z__lz_put_length(op, lit_len - 15);
+            } /* end if */
+            else
+                *token = (uint8_t)(lit_len << 4);
+            HDmemcpy(op, anchor, lit_len);
+            op += lit_len;
+
+            *op++ = (uint8_t)(offset & 0xff);
+            *op++ = (uint8_t)(offset >> 8);
+            if (match_len - H5Z_LZ_MIN_MATCH >= 15) {
+                *token |= 15;
+                op = H5Z__lz_put_length(op, match_len - H5Z_LZ_MIN_MATCH - 15);
+            } /* end if */
+            else
+                *token |= (uint8_t)(match_len - H5Z_LZ_MIN_MATCH);
+
+            ip += match_len;
+            anchor = ip;
+
+            /* Remember a position inside the match, for the next search */
+            if (ip < mflimit)
+                table[H5Z_LZ_HASH(ip - 2)] = (uint16_t)(ip - 2 - src);
+        } /* end while */
+    }     /* end if */
+
+    /* Encode the remaining literals, in the last sequence */
+    lit_len = (size_t)(iend - anchor);
+    if (lit_len >= 15) {
+        *op++ = 15 << 4;
+        op    = H5Z__lz_put_length(op, lit_len - 15);
+    } /* end if */
+    else
+        *op++ = (uint8_t)(lit_len << 4);
+    HDmemcpy(op, anchor, lit_len);
+    op += lit_len;
+
+    HDassert((size_t)(op - dst) <= H5Z_LZ_BLOCK_BOUND(nbytes));
+
+    return (size_t)(op - dst);
+} /* end H5Z__lz_compress_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_get_length
+ *
+ * Purpose:	Decode the extension bytes of a literal or match length
+ *
+ * Return:	Non-negative on success/Negative on failure (for running off
+ *              the end of the input)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__lz_get_length(const uint8_t **ipp, const uint8_t *iend, size_t *len)
+{
+    const uint8_t *ip = *ipp;
+    unsigned       b;
+
+    do {
+        if (ip >= iend)
+            return FAIL;
+        b = *ip++;
+        *len += b;
+    } while (b == 255);
+    *ipp = ip;
+
+    return SUCCEED;
+} /* end H5Z__lz_get_length() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_decompress_block
+ *
+ * Purpose:	Decode one block into exactly DST_SIZE bytes.
+ *
+ *              Every access is bounds-checked, so corrupted input fails
+ *              instead of reading or writing outside the buffers.  Away
+ *              from the ends of the buffers, literals and matches are
+ *              copied 16 bytes at a time, which compilers turn into vector
+ *              loads and stores.  (HDmemcpy is used throughout, since
+ *              the small fixed-size copies must be inlined.)
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__lz_decompress_block(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size)
+{
+    const uint8_t *ip   = src;
+    const uint8_t *iend = src + src_size;
+    uint8_t *      op   = dst;
+    uint8_t *      oend = dst + dst_size;
+
+    for (;;) {
+        unsigned token;
+        size_t   lit_len;
+        size_t   match_len;
+        size_t   offset;
+        uint8_t *match;
+
+        if (ip >= iend)
+            return FAIL;
+        token = *ip++;
+
+        /* Literals */
+        lit_len = token >> 4;
+        if (lit_len == 15 && H5Z__lz_get_length(&ip, iend, &lit_len) < 0)
+            return FAIL;
+        if (lit_len > (size_t)(iend - ip) || lit_len > (size_t)(oend - op))
+            return FAIL;
+        if (lit_len <= H5Z_LZ_COPY && (size_t)(iend - ip) >= H5Z_LZ_COPY &&
+            (size_t)(oend - op) >= H5Z_LZ_COPY)
+            HDmemcpy(op, ip, H5Z_LZ_COPY);
+        else
+            HDmemcpy(op, ip, lit_len);
+        ip += lit_len;
+        op += lit_len;
+
+        /* The last sequence has only literals */
+        if (ip == iend)
+            break;
+
+        /* Match */
+        if ((size_t)(iend - ip) < 2)
+            return FAIL;
+        offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst))
+            return FAIL;
+        match_len = token & 15;
+        if (match_len == 15 && H5Z__lz_get_length(&ip, iend, &match_len) < 0)
+            return FAIL;
+        match_len += H5Z_LZ_MIN_MATCH;
+        if (match_len > (size_t)(oend - op))
+            return FAIL;
+
+        match = op - offset;
+        if (offset >= H5Z_LZ_COPY && (size_t)(oend - op) >= match_len + H5Z_LZ_COPY) {
+            /* Copy 16 bytes at a time, overrunning the end of the match
+             * (which the next sequence overwrites) */
+            uint8_t *copy_end = op + match_len;
+
+            do {
+                HDmemcpy(op, match, H5Z_LZ_COPY);
+                op += H5Z_LZ_COPY;
+                match += H5Z_LZ_COPY;
+            } while (op < copy_end);
+            op = copy_end;
+        } /* end if */
+        else if (offset >= match_len) {
+            HDmemcpy(op, match, match_len);
+            op += match_len;
+        } /* end if */
+        else {
+            /* Overlapping copy, repeating the last OFFSET bytes.  The
+             * distance from MATCH to OP stays a multiple of OFFSET, so each
+             * copy can double the length of the next one.
+             */
+            uint8_t *copy_end = op + match_len;
+
+            while (op < copy_end) {
+                size_t n = MIN((size_t)(op - match), (size_t)(copy_end - op));
+
+                HDmemcpy(op, match, n);
+                op += n;
+            } /* end while */
+        } /* end else */
+    }     /* end for */
+
+    return (op == oend ? SUCCEED : FAIL);
+} /* end H5Z__lz_decompress_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__lz_compress_blocks
+ *
+ * Purpose:	Compress every STRIDE'th block, starting at FIRST.  Used
+ *              directly, and as the body of each compression thread.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5Z__lz_compress_blocks(void *_work)
+{
+    H5Z_lz_work_t *work = (H5Z_lz_work_t *)_work;
+    size_t         bound = H5Z_LZ_BLOCK_BOUND(H5Z_LZ_BLOCK_SIZE);
+    size_t         u;
+
+    for (u = work->first; u < work->nblocks; u += work->stride) {
+        size_t blk_off  = u * H5Z_LZ_BLOCK_SIZE;
+        size_t blk_size = MIN(H5Z_LZ_BLOCK_SIZE, work->nbytes - blk_off);
+
+        work->enc_size[u] =
+            H5Z__lz_compress_block(work->src + blk_off, blk_size, work->dst + (u * bound), work->table);
+    } /* end for */
+
+    return NULL;
+} /* end H5Z__lz_compress_blocks() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_lz
+ *
+ * Purpose:	Implement an I/O filter for the built-in LZ compression.
+ *              The filter has no parameters; the number of threads to
+ *              compress with comes from the transfer property list of the
+ *              API call.  (Files written by earlier versions may have the
+ *              number of threads in CD_VALUES[0], which is ignored.)
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_lz(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts, const unsigned H5_ATTR_UNUSED cd_values[],
+               size_t nbytes, size_t *buf_size, void **buf)
+{
+    const uint8_t *src      = (const uint8_t *)*buf; /* Input buffer */
+    uint8_t *      outbuf   = NULL;                  /* Output buffer */
+    uint8_t *      scratch  = NULL;                  /* Encoded blocks, before being packed */
+    size_t *       enc_size = NULL;                  /* Sizes of encoded blocks */
+    uint16_t *     tables   = NULL;                  /* Hash tables, one per thread */
+    size_t         ret_value = 0;                    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        const uint8_t *ip   = src;
+        const uint8_t *iend = src + nbytes;
+        uint64_t       out_size;
+        uint8_t *      op;
+        uint8_t *      oend;
+
+        /* Decode the header */
+        if (nbytes < H5Z_LZ_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "lz compressed data too short")
+        if (*ip++ != H5Z_LZ_VERSION)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "unknown lz compressed data version")
+        if (*ip++ != H5Z_LZ_BLOCK_LOG)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "unsupported lz block size")
+        UINT64DECODE(ip, out_size);
+        if (out_size > (uint64_t)SIZE_MAX || out_size == 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "invalid lz uncompressed size")
+
+        /* The size of the output is known, so allocate it exactly once */
+        if (NULL == (outbuf = (uint8_t *)H5MM_malloc((size_t)out_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for lz uncompression")
+        op   = outbuf;
+        oend = outbuf + out_size;
+
+        /* Decode the blocks */
+        while (op < oend) {
+            size_t   blk_size = MIN(H5Z_LZ_BLOCK_SIZE, (size_t)(oend - op));
+            uint32_t enc_word;
+            size_t   enc_len;
+
+            if ((size_t)(iend - ip) < H5Z_LZ_BLK_HDR)
+                HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "lz compressed data truncated")
+            UINT32DECODE(ip, enc_word);
+            enc_len = (size_t)(enc_word & ~H5Z_LZ_BLK_RAW);
+            if (enc_len > (size_t)(iend - ip))
+                HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "lz compressed data truncated")
+
+            if (enc_word & H5Z_LZ_BLK_RAW) {
+                if (enc_len != blk_size)
+                    HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "invalid lz uncompressed block")
+                H5MM_memcpy(op, ip, blk_size);
+            } /* end if */
+            else if (H5Z__lz_decompress_block(ip, enc_len, op, blk_size) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "corrupt lz compressed block")
+
+            ip += enc_len;
+            op += blk_size;
+        } /* end while */
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        outbuf    = NULL;
+        *buf_size = (size_t)out_size;
+        ret_value = (size_t)out_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        H5Z_lz_work_t work;
+        size_t        bound    = H5Z_LZ_BLOCK_BOUND(H5Z_LZ_BLOCK_SIZE);
+        size_t        nblocks  = (nbytes + H5Z_LZ_BLOCK_SIZE - 1) / H5Z_LZ_BLOCK_SIZE;
+        size_t        out_size = H5Z_LZ_HDR_SIZE + (nblocks * H5Z_LZ_BLK_HDR) + nbytes;
+        unsigned      nthreads = 1;
+        uint8_t *     op;
+        size_t        u;
+
+#ifdef H5Z_LZ_HAVE_THREADS
+        /* Get the number of threads for this transfer, but don't start
+         * more threads than there are blocks */
+        if (H5CX_get_filter_nthreads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get number of filter threads")
+        nthreads = (unsigned)MAX(1, MIN3(nthreads, nblocks, H5Z_LZ_MAX_THREADS));
+#endif /* H5Z_LZ_HAVE_THREADS */
+
+        /* Allocate the output buffer.  Blocks that don't compress are
+         * stored as-is, so the output is never much bigger than the input.
+         */
+        if (NULL == (outbuf = (uint8_t *)H5MM_malloc(out_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz destination buffer")
+        if (NULL == (scratch = (uint8_t *)H5MM_malloc(nblocks * bound)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz scratch buffer")
+        if (NULL == (enc_size = (size_t *)H5MM_malloc(nblocks * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz block sizes")
+        if (NULL == (tables = (uint16_t *)H5MM_malloc(nthreads * H5Z_LZ_TABLE_SIZE * sizeof(uint16_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate lz hash tables")
+
+        /* Encode the blocks */
+        work.src      = src;
+        work.nbytes   = nbytes;
+        work.dst      = scratch;
+        work.enc_size = enc_size;
+        work.first    = 0;
+        work.stride   = 1;
+        work.nblocks  = nblocks;
+        work.table    = tables;
+#ifdef H5Z_LZ_HAVE_THREADS
+        if (nthreads > 1) {
+            H5Z_lz_work_t thr_work[H5Z_LZ_MAX_THREADS];
+            pthread_t     threads[H5Z_LZ_MAX_THREADS];
+            hbool_t       started[H5Z_LZ_MAX_THREADS];
+
+            /* Each thread compresses every NTHREADS'th block, and the calling
+             * thread takes the first share.  (If a thread can't be started,
+             * its share is done in the calling thread.)
+             */
+            for (u = 0; u < nthreads; u++) {
+                thr_work[u]        = work;
+                thr_work[u].first  = u;
+                thr_work[u].stride = nthreads;
+                thr_work[u].table  = tables + (u * H5Z_LZ_TABLE_SIZE);
+                started[u] =
+                    (u > 0 && 0 == HDpthread_create(&threads[u], NULL, H5Z__lz_compress_blocks, &thr_work[u]));
+            } /* end for */
+            for (u = 0; u < nthreads; u++)
+                if (!started[u])
+                    H5Z__lz_compress_blocks(&thr_work[u]);
+            for (u = 1; u < nthreads; u++)
+                if (started[u])
+                    (void)HDpthread_join(threads[u], NULL);
+        } /* end if */
+        else
+#endif /* H5Z_LZ_HAVE_THREADS */
+            H5Z__lz_compress_blocks(&work);
+
+        /* Pack the header and the blocks */
+        op    = outbuf;
+        *op++ = H5Z_LZ_VERSION;
+        *op++ = H5Z_LZ_BLOCK_LOG;
+        UINT64ENCODE(op, (uint64_t)nbytes);
+        for (u = 0; u < nblocks; u++) {
+            size_t blk_off  = u * H5Z_LZ_BLOCK_SIZE;
+            size_t blk_size = MIN(H5Z_LZ_BLOCK_SIZE, nbytes - blk_off);
+
+            if (enc_size[u] < blk_size) {
+                UINT32ENCODE(op, (uint32_t)enc_size[u]);
+                H5MM_memcpy(op, scratch + (u * bound), enc_size[u]);
+                op += enc_size[u];
+            } /* end if */
+            else {
+                UINT32ENCODE(op, (uint32_t)blk_size | H5Z_LZ_BLK_RAW);
+                H5MM_memcpy(op, src + blk_off, blk_size);
+                op += blk_size;
+            } /* end else */
+        }     /* end for */
+        HDassert((size_t)(op - outbuf) <= out_size);
+
+        /* Free the input buffer */
+        H5MM_xfree(*buf);
+
+        /* Set return values */
+        *buf      = outbuf;
+        outbuf    = NULL;
+        *buf_size = out_size;
+        ret_value = (size_t)(op - (uint8_t *)*buf);
+    } /* end else */
+
+done:
+    H5MM_xfree(outbuf);
+    H5MM_xfree(scratch);
+    H5MM_xfree(enc_size);
+    H5MM_xfree(tables);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_lz() */
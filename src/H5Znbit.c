@@ -33,6 +33,9 @@ typedef struct {
     unsigned offset;    /* datatype offset */
 } parms_atomic;
 
+/* Largest atomic datatype size (in bytes) handled a word at a time */
+#define H5Z_NBIT_WORD_SIZE 8
+
 /* Local function prototypes */
 static htri_t H5Z__can_apply_nbit(hid_t dcpl_id, hid_t type_id, hid_t space_id);
 static herr_t H5Z__set_local_nbit(hid_t dcpl_id, hid_t type_id, hid_t space_id);
@@ -71,8 +74,15 @@ static herr_t H5Z__nbit_decompress_one_array(unsigned char *data, size_t data_of
 static herr_t H5Z__nbit_decompress_one_compound(unsigned char *data, size_t data_offset,
                                                 unsigned char *buffer, size_t *j, size_t *buf_len,
                                                 const unsigned parms[], unsigned *parms_index);
+static uint64_t H5Z__nbit_load_atomic(const unsigned char *data, const parms_atomic *p, hbool_t native);
+static void     H5Z__nbit_store_atomic(unsigned char *data, uint64_t val, const parms_atomic *p, hbool_t native);
+static herr_t   H5Z__nbit_decompress_atomic_word(unsigned char *data, unsigned d_nelmts,
+                                                 const unsigned char *buffer, size_t buffer_size,
+                                                 const parms_atomic *p);
+static void     H5Z__nbit_compress_atomic_word(const unsigned char *data, unsigned d_nelmts,
+                                               unsigned char *buffer, size_t *j, const parms_atomic *p);
 static herr_t H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
-                                   const unsigned parms[]);
+                                   size_t buffer_size, const unsigned parms[]);
 static void   H5Z__nbit_compress_one_nooptype(const unsigned char *data, size_t data_offset,
                                               unsigned char *buffer, size_t *j, size_t *buf_len, unsigned size);
 static void   H5Z__nbit_compress_one_array(unsigned char *data, size_t data_offset, unsigned char *buffer,
@@ -982,7 +992,7 @@ H5Z__filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], s
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for nbit decompression")
 
         /* decompress the buffer */
-        if (H5Z__nbit_decompress(outbuf, d_nelmts, (unsigned char *)*buf, cd_values) < 0)
+        if (H5Z__nbit_decompress(outbuf, d_nelmts, (unsigned char *)*buf, nbytes, cd_values) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't decompress buffer")
     } /* end if */
     /* output; compress */
@@ -1026,6 +1036,189 @@ H5Z__nbit_next_byte(size_t *j, size_t *buf_len)
     *buf_len = 8 * sizeof(unsigned char);
 }
 
+/* ======== Word-at-a-time Nbit Algorithm ================================
+ * For atomic datatypes of up to 64 bits (the common case of an integer or
+ * floating-point dataset), each value is loaded as a whole integer, its
+ * significant bits are extracted with a shift and a mask, and they are
+ * moved through a 64-bit bit buffer, a byte at a time only at the buffer's
+ * edge.  The packed bits are identical to those produced by the byte-by-byte
+ * routines above, which remain in use for array and compound datatypes.
+ */
+
+static uint64_t
+H5Z__nbit_load_atomic(const unsigned char *data, const parms_atomic *p, hbool_t native)
+{
+    uint64_t val = 0;
+    unsigned k;
+
+    /* Let the compiler use a single load for native-order values */
+    if (native)
+        switch (p->size) {
+            case 1:
+                return data[0];
+
+            case 2: {
+                uint16_t val16;
+
+                HDmemcpy(&val16, data, sizeof(val16));
+                return val16;
+            }
+
+            case 4: {
+                uint32_t val32;
+
+                HDmemcpy(&val32, data, sizeof(val32));
+                return val32;
+            }
+
+            case 8:
+                HDmemcpy(&val, data, sizeof(val));
+                return val;
+
+            default:
+                break;
+        } /* end switch */
+
+    if (p->order == H5Z_NBIT_ORDER_LE)
+        for (k = p->size; k > 0; k--)
+            val = (val << 8) | data[k - 1];
+    else
+        for (k = 0; k < p->size; k++)
+            val = (val << 8) | data[k];
+
+    return val;
+}
+
+static void
+H5Z__nbit_store_atomic(unsigned char *data, uint64_t val, const parms_atomic *p, hbool_t native)
+{
+    unsigned k;
+
+    if (native)
+        switch (p->size) {
+            case 1:
+                data[0] = (unsigned char)val;
+                return;
+
+            case 2: {
+                uint16_t val16 = (uint16_t)val;
+
+                HDmemcpy(data, &val16, sizeof(val16));
+                return;
+            }
+
+            case 4: {
+                uint32_t val32 = (uint32_t)val;
+
+                HDmemcpy(data, &val32, sizeof(val32));
+                return;
+            }
+
+            case 8:
+                HDmemcpy(data, &val, sizeof(val));
+                return;
+
+            default:
+                break;
+        } /* end switch */
+
+    if (p->order == H5Z_NBIT_ORDER_LE)
+        for (k = 0; k < p->size; k++, val >>= 8)
+            data[k] = (unsigned char)val;
+    else
+        for (k = p->size; k > 0; k--, val >>= 8)
+            data[k - 1] = (unsigned char)val;
+}
+
+static herr_t
+H5Z__nbit_decompress_atomic_word(unsigned char *data, unsigned d_nelmts, const unsigned char *buffer,
+                                 size_t buffer_size, const parms_atomic *p)
+{
+    hbool_t  native = ((p->order == H5Z_NBIT_ORDER_LE) == (H5T_native_order_g == H5T_ORDER_LE));
+    unsigned part_len[2]; /* values wider than 56 bits are read in two parts */
+    unsigned nparts;
+    uint64_t bits  = 0; /* bit buffer, holding NBITS unread bits */
+    unsigned nbits = 0;
+    size_t   j     = 0; /* index of the next byte of BUFFER */
+    unsigned i, u;
+
+    if (p->precision > 56) {
+        part_len[0] = p->precision - 32;
+        part_len[1] = 32;
+        nparts      = 2;
+    } /* end if */
+    else {
+        part_len[0] = p->precision;
+        nparts      = 1;
+    } /* end else */
+
+    for (i = 0; i < d_nelmts; i++) {
+        uint64_t val = 0;
+
+        for (u = 0; u < nparts; u++) {
+            unsigned len = part_len[u];
+
+            /* Refill the bit buffer, which can hold up to 63 bits */
+            while (nbits < len) {
+                if (j >= buffer_size)
+                    return FAIL;
+                bits = (bits << 8) | buffer[j++];
+                nbits += 8;
+            } /* end while */
+            nbits -= len;
+            val = (val << len) | ((bits >> nbits) & (((uint64_t)1 << len) - 1));
+        } /* end for */
+
+        H5Z__nbit_store_atomic(data + (size_t)i * p->size, val << p->offset, p, native);
+    } /* end for */
+
+    return SUCCEED;
+}
+
+static void
+H5Z__nbit_compress_atomic_word(const unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t *j,
+                               const parms_atomic *p)
+{
+    hbool_t  native = ((p->order == H5Z_NBIT_ORDER_LE) == (H5T_native_order_g == H5T_ORDER_LE));
+    uint64_t mask   = (p->precision < 64 ? ((uint64_t)1 << p->precision) - 1 : ~(uint64_t)0);
+    uint64_t bits   = 0;  /* bit buffer, holding NBITS unwritten bits */
+    unsigned nbits  = 0;
+    size_t   pos    = *j; /* index of the next byte of BUFFER */
+    unsigned i;
+
+    for (i = 0; i < d_nelmts; i++) {
+        uint64_t val = (H5Z__nbit_load_atomic(data + (size_t)i * p->size, p, native) >> p->offset) & mask;
+
+        /* Values wider than 56 bits don't fit in the bit buffer at once */
+        if (p->precision > 56) {
+            bits = (bits << (p->precision - 32)) | (val >> 32);
+            nbits += p->precision - 32;
+            while (nbits >= 8) {
+                nbits -= 8;
+                buffer[pos++] = (unsigned char)(bits >> nbits);
+            } /* end while */
+            bits  = (bits << 32) | (val & 0xffffffff);
+            nbits += 32;
+        } /* end if */
+        else {
+            bits = (bits << p->precision) | val;
+            nbits += p->precision;
+        } /* end else */
+
+        while (nbits >= 8) {
+            nbits -= 8;
+            buffer[pos++] = (unsigned char)(bits >> nbits);
+        } /* end while */
+    }     /* end for */
+
+    /* Leftover bits go in the high end of the last byte */
+    if (nbits > 0)
+        buffer[pos] = (unsigned char)(bits << (8 - nbits));
+
+    /* Index of the last byte, as for the byte-by-byte algorithm */
+    *j = pos;
+}
+
 static void
 H5Z__nbit_decompress_one_byte(unsigned char *data, size_t data_offset, unsigned k, unsigned begin_i,
                               unsigned end_i, const unsigned char *buffer, size_t *j, size_t *buf_len,
@@ -1277,7 +1470,8 @@ done:
 }
 
 static herr_t
-H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, const unsigned parms[])
+H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t buffer_size,
+                     const unsigned parms[])
 {
     /* i: index of data, j: index of buffer,
        buf_len: number of bits to be filled in current byte */
@@ -1308,8 +1502,13 @@ H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buff
             if (p.precision > p.size * 8 || (p.precision + p.offset) > p.size * 8)
                 HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "invalid datatype precision/offset")
 
-            for (i = 0; i < d_nelmts; i++)
-                H5Z__nbit_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, &p);
+            if (p.size <= H5Z_NBIT_WORD_SIZE) {
+                if (H5Z__nbit_decompress_atomic_word(data, d_nelmts, buffer, buffer_size, &p) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "nbit compressed data too short")
+            } /* end if */
+            else
+                for (i = 0; i < d_nelmts; i++)
+                    H5Z__nbit_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, &p);
             break;
 
         case H5Z_NBIT_ARRAY:
@@ -1573,8 +1772,11 @@ H5Z__nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer
             p.precision = parms[6];
             p.offset    = parms[7];
 
-            for (i = 0; i < d_nelmts; i++)
-                H5Z__nbit_compress_one_atomic(data, i * p.size, buffer, &new_size, &buf_len, &p);
+            if (p.size <= H5Z_NBIT_WORD_SIZE)
+                H5Z__nbit_compress_atomic_word(data, d_nelmts, buffer, &new_size, &p);
+            else
+                for (i = 0; i < d_nelmts; i++)
+                    H5Z__nbit_compress_one_atomic(data, i * p.size, buffer, &new_size, &buf_len, &p);
             break;
 
         case H5Z_NBIT_ARRAY:
@@ -37,6 +37,9 @@ H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
 /* Scale/offset filter */
 H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
 
+/* LZ filter */
+H5_DLLVAR const H5Z_class2_t H5Z_LZ[1];
+
 /********************/
 /* External filters */
 /********************/
@@ -53,5 +56,8 @@ H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 
 /* Package internal routines */
 H5_DLL herr_t H5Z__unregister(H5Z_filter_t filter_id);
+#ifdef H5_HAVE_FILTER_DEFLATE
+H5_DLL herr_t H5Z__deflate_term(void);
+#endif /* H5_HAVE_FILTER_DEFLATE */
 
 #endif /* H5Zpkg_H */
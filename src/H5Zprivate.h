@@ -91,6 +91,7 @@ H5_DLL herr_t        H5Z_set_local_direct(const struct H5O_pline_t *pline);
 H5_DLL htri_t        H5Z_ignore_filters(hid_t dcpl_id, const H5T_t *type, const H5S_t *space);
 H5_DLL H5Z_filter_info_t *H5Z_filter_info(const struct H5O_pline_t *pline, H5Z_filter_t filter);
 H5_DLL htri_t             H5Z_filter_in_pline(const struct H5O_pline_t *pline, H5Z_filter_t filter);
+H5_DLL unsigned           H5Z_compression_mask(const struct H5O_pline_t *pline);
 H5_DLL htri_t             H5Z_all_filters_avail(const struct H5O_pline_t *pline);
 H5_DLL htri_t             H5Z_filter_avail(H5Z_filter_t id);
 H5_DLL herr_t             H5Z_delete(struct H5O_pline_t *pline, H5Z_filter_t filter);
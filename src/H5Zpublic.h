@@ -65,6 +65,10 @@ typedef int H5Z_filter_t;
  * scale+offset compression
  */
 #define H5Z_FILTER_SCALEOFFSET 6
+/**
+ * fast LZ compression
+ */
+#define H5Z_FILTER_LZ 7
 /**
  * filter ids below this value are reserved for library use
  */
@@ -71,22 +71,11 @@ static herr_t H5Z__scaleoffset_precompress_fd(void *data, unsigned d_nelmts, enu
 static herr_t H5Z__scaleoffset_postdecompress_fd(void *data, unsigned d_nelmts, enum H5Z_scaleoffset_t type,
                                                  unsigned filavail, const unsigned cd_values[],
                                                  uint32_t minbits, unsigned long long minval, double D_val);
-static void   H5Z__scaleoffset_next_byte(size_t *j, unsigned *buf_len);
-static void   H5Z__scaleoffset_decompress_one_byte(unsigned char *data, size_t data_offset, unsigned k,
-                                                   unsigned begin_i, const unsigned char *buffer, size_t *j,
-                                                   unsigned *buf_len, parms_atomic p, unsigned dtype_len);
-static void   H5Z__scaleoffset_compress_one_byte(const unsigned char *data, size_t data_offset, unsigned k,
-                                                 unsigned begin_i, unsigned char *buffer, size_t *j,
-                                                 unsigned *buf_len, parms_atomic p, unsigned dtype_len);
-static void   H5Z__scaleoffset_decompress_one_atomic(unsigned char *data, size_t data_offset,
-                                                     unsigned char *buffer, size_t *j, unsigned *buf_len,
-                                                     parms_atomic p);
-static void   H5Z__scaleoffset_compress_one_atomic(unsigned char *data, size_t data_offset,
-                                                   unsigned char *buffer, size_t *j, unsigned *buf_len,
-                                                   parms_atomic p);
-static void   H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
-                                          parms_atomic p);
-static void   H5Z__scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
+static unsigned long long H5Z__scaleoffset_load(const unsigned char *data, unsigned size);
+static void               H5Z__scaleoffset_store(unsigned char *data, unsigned long long val, unsigned size);
+static herr_t H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, const unsigned char *buffer,
+                                          size_t buffer_size, parms_atomic p);
+static void   H5Z__scaleoffset_compress(const unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
                                         size_t buffer_size, parms_atomic p);
 
 /* This message derives from H5Z */
@@ -1236,7 +1225,8 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
             minval |= minval_mask;
         }
 
-        HDassert(minbits <= p.size * 8);
+        if (minbits > p.size * 8 || nbytes < buf_offset)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "invalid scaleoffset compressed data")
         p.minbits = minbits;
 
         /* calculate size of output buffer after decompression */
@@ -1265,8 +1255,11 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
         }
 
         /* decompress the buffer if minbits not equal to zero */
-        if (minbits != 0)
-            H5Z__scaleoffset_decompress(outbuf, d_nelmts, (unsigned char *)(*buf) + buf_offset, p);
+        if (minbits != 0) {
+            if (H5Z__scaleoffset_decompress(outbuf, d_nelmts, (unsigned char *)(*buf) + buf_offset,
+                                            nbytes - buf_offset, p) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "scaleoffset compressed data too short")
+        }
         else {
             /* fill value is not defined and all data elements have the same value */
             for (i = 0; i < size_out; i++)
@@ -1599,180 +1592,163 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
-static void
-H5Z__scaleoffset_next_byte(size_t *j, unsigned *buf_len)
+/*
+ * The packing routines below move the MINBITS low-order bits of each element
+ * through a 64-bit bit buffer, most significant bit first, so whole values
+ * are loaded and stored rather than assembled a byte at a time.  By this point
+ * the elements are always in the machine's native byte order.
+ */
+static unsigned long long
+H5Z__scaleoffset_load(const unsigned char *data, unsigned size)
 {
-    ++(*j);
-    *buf_len = 8 * sizeof(unsigned char);
-}
+    switch (size) {
+        case 1:
+            return data[0];
 
-static void
-H5Z__scaleoffset_decompress_one_byte(unsigned char *data, size_t data_offset, unsigned k, unsigned begin_i,
-                                     const unsigned char *buffer, size_t *j, unsigned *buf_len,
-                                     parms_atomic p, unsigned dtype_len)
-{
-    unsigned      dat_len; /* dat_len is the number of bits to be copied in each data byte */
-    unsigned char val;     /* value to be copied in each data byte */
+        case 2: {
+            uint16_t val16;
 
-    /* initialize value and bits of unsigned char to be copied */
-    val = buffer[*j];
-    if (k == begin_i)
-        dat_len = 8 - (dtype_len - p.minbits) % 8;
-    else
-        dat_len = 8;
+            HDmemcpy(&val16, data, sizeof(val16));
+            return val16;
+        }
 
-    if (*buf_len > dat_len) {
-        data[data_offset + k] =
-            (unsigned char)((unsigned)(val >> (*buf_len - dat_len)) & (unsigned)(~((unsigned)~0 << dat_len)));
-        *buf_len -= dat_len;
-    } /* end if */
-    else {
-        data[data_offset + k] =
-            (unsigned char)((val & ~((unsigned)(~0) << *buf_len)) << (dat_len - *buf_len));
-        dat_len -= *buf_len;
-        H5Z__scaleoffset_next_byte(j, buf_len);
-        if (dat_len == 0)
-            return;
-
-        val = buffer[*j];
-        data[data_offset + k] |=
-            (unsigned char)((unsigned)(val >> (*buf_len - dat_len)) & ~((unsigned)(~0) << dat_len));
-        *buf_len -= dat_len;
-    } /* end else */
+        case 4: {
+            uint32_t val32;
+
+            HDmemcpy(&val32, data, sizeof(val32));
+            return val32;
+        }
+
+        default: {
+            uint64_t val64;
+
+            HDassert(size == 8);
+            HDmemcpy(&val64, data, sizeof(val64));
+            return val64;
+        }
+    } /* end switch */
 }
 
 static void
-H5Z__scaleoffset_decompress_one_atomic(unsigned char *data, size_t data_offset, unsigned char *buffer,
-                                       size_t *j, unsigned *buf_len, parms_atomic p)
+H5Z__scaleoffset_store(unsigned char *data, unsigned long long val, unsigned size)
 {
-    /* begin_i: the index of byte having first significant bit */
-    unsigned begin_i;
-    unsigned dtype_len;
-    int      k;
-
-    HDassert(p.minbits > 0);
+    switch (size) {
+        case 1:
+            data[0] = (unsigned char)val;
+            break;
 
-    dtype_len = p.size * 8;
+        case 2: {
+            uint16_t val16 = (uint16_t)val;
 
-    if (p.mem_order == H5Z_SCALEOFFSET_ORDER_LE) { /* little endian */
-        begin_i = p.size - 1 - (dtype_len - p.minbits) / 8;
+            HDmemcpy(data, &val16, sizeof(val16));
+            break;
+        }
 
-        for (k = (int)begin_i; k >= 0; k--)
-            H5Z__scaleoffset_decompress_one_byte(data, data_offset, (unsigned)k, begin_i, buffer, j, buf_len,
-                                                 p, dtype_len);
-    }
-    else { /* big endian */
-        HDassert(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE);
+        case 4: {
+            uint32_t val32 = (uint32_t)val;
 
-        begin_i = (dtype_len - p.minbits) / 8;
+            HDmemcpy(data, &val32, sizeof(val32));
+            break;
+        }
 
-        for (k = (int)begin_i; k <= (int)(p.size - 1); k++)
-            H5Z__scaleoffset_decompress_one_byte(data, data_offset, (unsigned)k, begin_i, buffer, j, buf_len,
-                                                 p, dtype_len);
-    }
-}
+        default: {
+            uint64_t val64 = (uint64_t)val;
 
-static void
-H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, parms_atomic p)
-{
-    /* i: index of data, j: index of buffer,
-       buf_len: number of bits to be filled in current byte */
-    size_t   i, j;
-    unsigned buf_len;
-
-    /* must initialize to zeros */
-    for (i = 0; i < d_nelmts * p.size; i++)
-        data[i] = 0;
-
-    /* initialization before the loop */
-    j       = 0;
-    buf_len = sizeof(unsigned char) * 8;
-
-    /* decompress */
-    for (i = 0; i < d_nelmts; i++)
-        H5Z__scaleoffset_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, p);
+            HDassert(size == 8);
+            HDmemcpy(data, &val64, sizeof(val64));
+            break;
+        }
+    } /* end switch */
 }
 
-static void
-H5Z__scaleoffset_compress_one_byte(const unsigned char *data, size_t data_offset, unsigned k,
-                                   unsigned begin_i, unsigned char *buffer, size_t *j, unsigned *buf_len,
-                                   parms_atomic p, unsigned dtype_len)
+static herr_t
+H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, const unsigned char *buffer,
+                            size_t buffer_size, parms_atomic p)
 {
-    unsigned      dat_len; /* dat_len is the number of bits to be copied in each data byte */
-    unsigned char val;     /* value to be copied in each data byte */
-
-    /* initialize value and bits of unsigned char to be copied */
-    val = data[data_offset + k];
-    if (k == begin_i)
-        dat_len = 8 - (dtype_len - p.minbits) % 8;
-    else
-        dat_len = 8;
-
-    if (*buf_len > dat_len) {
-        buffer[*j] |= (unsigned char)((val & ~((unsigned)(~0) << dat_len)) << (*buf_len - dat_len));
-        *buf_len -= dat_len;
-    }
+    unsigned part_len[2]; /* values wider than 56 bits are read in two parts */
+    unsigned nparts;
+    uint64_t bits  = 0; /* bit buffer, holding NBITS unread bits */
+    unsigned nbits = 0;
+    size_t   j     = 0; /* index of the next byte of BUFFER */
+    unsigned i, u;
+
+    HDassert(p.minbits > 0 && p.minbits < p.size * 8);
+    HDassert(p.mem_order == (unsigned)H5T_native_order_g);
+
+    if (p.minbits > 56) {
+        part_len[0] = p.minbits - 32;
+        part_len[1] = 32;
+        nparts      = 2;
+    } /* end if */
     else {
-        buffer[*j] |=
-            (unsigned char)((unsigned)(val >> (dat_len - *buf_len)) & ~((unsigned)(~0) << *buf_len));
-        dat_len -= *buf_len;
-        H5Z__scaleoffset_next_byte(j, buf_len);
-        if (dat_len == 0)
-            return;
-
-        buffer[*j] = (unsigned char)((val & ~((unsigned)(~0) << dat_len)) << (*buf_len - dat_len));
-        *buf_len -= dat_len;
+        part_len[0] = p.minbits;
+        nparts      = 1;
     } /* end else */
-}
 
-static void
-H5Z__scaleoffset_compress_one_atomic(unsigned char *data, size_t data_offset, unsigned char *buffer,
-                                     size_t *j, unsigned *buf_len, parms_atomic p)
-{
-    /* begin_i: the index of byte having first significant bit */
-    unsigned begin_i;
-    unsigned dtype_len;
-    int      k;
-
-    HDassert(p.minbits > 0);
+    for (i = 0; i < d_nelmts; i++) {
+        unsigned long long val = 0;
 
-    dtype_len = p.size * 8;
+        for (u = 0; u < nparts; u++) {
+            unsigned len = part_len[u];
 
-    if (p.mem_order == H5Z_SCALEOFFSET_ORDER_LE) { /* little endian */
-        begin_i = p.size - 1 - (dtype_len - p.minbits) / 8;
+            while (nbits < len) {
+                if (j >= buffer_size)
+                    return FAIL;
+                bits = (bits << 8) | buffer[j++];
+                nbits += 8;
+            } /* end while */
+            nbits -= len;
+            val = (val << len) | ((bits >> nbits) & (((uint64_t)1 << len) - 1));
+        } /* end for */
 
-        for (k = (int)begin_i; k >= 0; k--)
-            H5Z__scaleoffset_compress_one_byte(data, data_offset, (unsigned)k, begin_i, buffer, j, buf_len, p,
-                                               dtype_len);
-    }
-    else { /* big endian */
-        HDassert(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE);
-        begin_i = (dtype_len - p.minbits) / 8;
+        H5Z__scaleoffset_store(data + (size_t)i * p.size, val, p.size);
+    } /* end for */
 
-        for (k = (int)begin_i; k <= (int)(p.size - 1); k++)
-            H5Z__scaleoffset_compress_one_byte(data, data_offset, (unsigned)k, begin_i, buffer, j, buf_len, p,
-                                               dtype_len);
-    }
+    return SUCCEED;
 }
 
 static void
-H5Z__scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t buffer_size,
-                          parms_atomic p)
+H5Z__scaleoffset_compress(const unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
+                          size_t buffer_size, parms_atomic p)
 {
-    /* i: index of data, j: index of buffer,
-       buf_len: number of bits to be filled in current byte */
-    size_t   i, j;
-    unsigned buf_len;
-
-    /* must initialize buffer to be zeros */
-    for (j = 0; j < buffer_size; j++)
-        buffer[j] = 0;
-
-    /* initialization before the loop */
-    j       = 0;
-    buf_len = sizeof(unsigned char) * 8;
-
-    /* compress */
-    for (i = 0; i < d_nelmts; i++)
-        H5Z__scaleoffset_compress_one_atomic(data, i * p.size, buffer, &j, &buf_len, p);
+    uint64_t mask  = ((uint64_t)1 << p.minbits) - 1;
+    uint64_t bits  = 0; /* bit buffer, holding NBITS unwritten bits */
+    unsigned nbits = 0;
+    size_t   j     = 0; /* index of the next byte of BUFFER */
+    unsigned i;
+
+    HDassert(p.minbits > 0 && p.minbits < p.size * 8);
+    HDassert(p.mem_order == (unsigned)H5T_native_order_g);
+
+    for (i = 0; i < d_nelmts; i++) {
+        uint64_t val = (uint64_t)H5Z__scaleoffset_load(data + (size_t)i * p.size, p.size) & mask;
+
+        /* Values wider than 56 bits don't fit in the bit buffer at once */
+        if (p.minbits > 56) {
+            bits = (bits << (p.minbits - 32)) | (val >> 32);
+            nbits += p.minbits - 32;
+            while (nbits >= 8) {
+                nbits -= 8;
+                buffer[j++] = (unsigned char)(bits >> nbits);
+            } /* end while */
+            bits = (bits << 32) | (val & 0xffffffff);
+            nbits += 32;
+        } /* end if */
+        else {
+            bits = (bits << p.minbits) | val;
+            nbits += p.minbits;
+        } /* end else */
+
+        while (nbits >= 8) {
+            nbits -= 8;
+            buffer[j++] = (unsigned char)(bits >> nbits);
+        } /* end while */
+    }     /* end for */
+
+    /* Leftover bits go in the high end of the next byte; zero the rest */
+    if (nbits > 0)
+        buffer[j++] = (unsigned char)(bits << (8 - nbits));
+    HDassert(j <= buffer_size);
+    if (j < buffer_size)
+        HDmemset(buffer + j, 0, buffer_size - j);
 }
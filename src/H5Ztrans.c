@@ -54,10 +54,34 @@ typedef struct H5Z_node {
     H5Z_num_val      value;
 } H5Z_node;
 
+/* Forms of the instructions in a compiled transform */
+typedef enum {
+    H5Z_XFORM_INSN_LOAD, /* Push a copy of the data                           */
+    H5Z_XFORM_INSN_SC,   /* Top of stack OP constant                          */
+    H5Z_XFORM_INSN_CS,   /* Constant OP top of stack                          */
+    H5Z_XFORM_INSN_SS    /* Pop the top of stack, combine with the next one   */
+} H5Z_xform_insn_form_t;
+
+/* An instruction in a compiled transform */
+typedef struct {
+    H5Z_xform_insn_form_t form; /* Operand form                       */
+    H5Z_token_type        op;   /* Operator (PLUS, MINUS, MULT, DIVIDE) */
+    double                val;  /* Constant operand for SC and CS     */
+} H5Z_xform_insn_t;
+
+/* A transform compiled into a flat program for a stack of value blocks */
+typedef struct {
+    H5Z_xform_insn_t *insn;   /* Instructions, in evaluation order      */
+    size_t            ninsn;  /* Number of instructions                 */
+    unsigned          depth;  /* Largest stack depth                    */
+    unsigned          nloads; /* Number of LOAD instructions            */
+} H5Z_xform_prog_t;
+
 struct H5Z_data_xform_t {
     char *           xform_exp;
     H5Z_node *       parse_root;
     H5Z_datval_ptrs *dat_val_pointers;
+    H5Z_xform_prog_t prog; /* Compiled form of parse_root, if it could be compiled */
 };
 
 typedef struct result {
@@ -96,6 +120,14 @@ static void *     H5Z__xform_parse(const char *expression, H5Z_datval_ptrs *dat_
 static void *     H5Z__xform_copy_tree(H5Z_node *tree, H5Z_datval_ptrs *dat_val_pointers,
                                        H5Z_datval_ptrs *new_dat_val_pointers);
 static void       H5Z__xform_reduce_tree(H5Z_node *tree);
+static size_t     H5Z__xform_count_nodes(const H5Z_node *tree);
+static htri_t     H5Z__xform_compile_node(const H5Z_node *tree, H5Z_xform_prog_t *prog, unsigned *depth);
+static herr_t     H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t     H5Z__xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size,
+                                       hid_t array_type);
+
+/* Number of elements evaluated at a time by a compiled transform */
+#define H5Z_XFORM_BLOCK 512
 
 /* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before
  * doing the operation.  So I break down the command into two lines:
@@ -365,6 +397,78 @@ static void       H5Z__xform_reduce_tree(H5Z_node *tree);
         }                                                                                                    \
     }
 
+/* Runs one instruction of a compiled transform over the N values of a block,
+ * rounding each result to TYPE just as H5Z_XFORM_DO_OP1 does for whole arrays.
+ */
+#define H5Z_XFORM_BLOCK_OP(TYPE, FORM, OP)                                                                   \
+    {                                                                                                        \
+        if ((FORM) == H5Z_XFORM_INSN_SC)                                                                     \
+            for (u = 0; u < n; u++)                                                                          \
+                top[u] = (TYPE)((double)top[u] OP c);                                                        \
+        else if ((FORM) == H5Z_XFORM_INSN_CS)                                                                \
+            for (u = 0; u < n; u++)                                                                          \
+                top[u] = (TYPE)(c OP(double) top[u]);                                                        \
+        else                                                                                                 \
+            for (u = 0; u < n; u++)                                                                          \
+                next[u] = (TYPE)(next[u] OP top[u]);                                                         \
+    }
+
+/* Evaluates a compiled transform over an array of TYPE, a block at a time.
+ * Stack slot 0 works on the array in place when the data is loaded only once;
+ * otherwise every slot is in TMP and the result is copied back at the end.
+ */
+#define H5Z_XFORM_RUN_PROG(TYPE)                                                                             \
+    {                                                                                                        \
+        TYPE * data = (TYPE *)array;                                                                         \
+        TYPE * regs = (TYPE *)tmp;                                                                           \
+        size_t start, n, u, k;                                                                               \
+                                                                                                             \
+        for (start = 0; start < array_size; start += H5Z_XFORM_BLOCK) {                                      \
+            TYPE *   x  = data + start;                                                                      \
+            unsigned sp = 0;                                                                                 \
+                                                                                                             \
+            n = MIN(H5Z_XFORM_BLOCK, array_size - start);                                                    \
+            for (k = 0; k < prog->ninsn; k++) {                                                              \
+                const H5Z_xform_insn_t *insn = &prog->insn[k];                                               \
+                double                  c    = insn->val;                                                    \
+                TYPE *                  top, *next;                                                          \
+                                                                                                             \
+                if (insn->form == H5Z_XFORM_INSN_LOAD) {                                                     \
+                    top = (in_place && sp == 0) ? x : regs + (size_t)sp * H5Z_XFORM_BLOCK;                   \
+                    if (top != x)                                                                            \
+                        H5MM_memcpy(top, x, n * sizeof(TYPE));                                               \
+                    sp++;                                                                                    \
+                    continue;                                                                                \
+                }                                                                                            \
+                top  = (in_place && sp == 1) ? x : regs + (size_t)(sp - 1) * H5Z_XFORM_BLOCK;                \
+                next = NULL;                                                                                 \
+                if (insn->form == H5Z_XFORM_INSN_SS) {                                                       \
+                    next = (in_place && sp == 2) ? x : regs + (size_t)(sp - 2) * H5Z_XFORM_BLOCK;            \
+                    sp--;                                                                                    \
+                }                                                                                            \
+                switch (insn->op) {                                                                          \
+                    case H5Z_XFORM_PLUS:                                                                     \
+                        H5Z_XFORM_BLOCK_OP(TYPE, insn->form, +)                                              \
+                        break;                                                                               \
+                    case H5Z_XFORM_MINUS:                                                                    \
+                        H5Z_XFORM_BLOCK_OP(TYPE, insn->form, -)                                              \
+                        break;                                                                               \
+                    case H5Z_XFORM_MULT:                                                                     \
+                        H5Z_XFORM_BLOCK_OP(TYPE, insn->form, *)                                              \
+                        break;                                                                               \
+                    case H5Z_XFORM_DIVIDE:                                                                   \
+                        H5Z_XFORM_BLOCK_OP(TYPE, insn->form, /)                                              \
+                        break;                                                                               \
+                    default:                                                                                 \
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid compiled transform")              \
+                } /* end switch */                                                                           \
+            }     /* end for */                                                                              \
+            HDassert(sp == 1);                                                                               \
+            if (!in_place)                                                                                   \
+                H5MM_memcpy(x, regs, n * sizeof(TYPE));                                                      \
+        } /* end for */                                                                                      \
+    }
+
 /*
  *  Programmer: Bill Wendling
  *              25. August 2003
@@ -1062,6 +1166,11 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
 #endif
 
     } /* end if */
+    /* Use the compiled form of the transform, when there is one */
+    else if (data_xform_prop->prog.insn) {
+        if (H5Z__xform_eval_prog(&data_xform_prop->prog, array, array_size, array_type) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+    } /* end if */
     /* Otherwise, do the full data transform */
     else {
         /* Optimization for linear transform: */
@@ -1209,6 +1318,82 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z__xform_eval_full() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_eval_prog
+ *
+ * Purpose:     Applies a compiled transform to array.  Rather than making
+ *              a pass over the whole array for each operator, as
+ *              H5Z__xform_eval_full does, the whole expression is evaluated
+ *              for a block of elements at a time, with the temporaries for
+ *              each block kept small enough to stay in cache.  Each
+ *              instruction is a simple loop over a block, which the
+ *              compiler can vectorize.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size, hid_t array_type)
+{
+    hbool_t in_place = (prog->nloads == 1); /* Whether the data is only needed once */
+    size_t  type_size;                      /* Size of the array's elements */
+    void *  tmp       = NULL;               /* Stack slots not held in the array */
+    herr_t  ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(prog->insn && prog->depth > 0);
+
+    /* Stack slot 0 is the array itself when the data is only loaded once */
+    if (!in_place || prog->depth > 1) {
+        type_size = H5T_get_size((H5T_t *)H5I_object(array_type));
+        if (NULL == (tmp = H5MM_malloc((size_t)prog->depth * H5Z_XFORM_BLOCK * type_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate data transform workspace")
+    } /* end if */
+
+    if (array_type == H5T_NATIVE_CHAR)
+        H5Z_XFORM_RUN_PROG(char)
+#if CHAR_MIN >= 0
+    else if (array_type == H5T_NATIVE_SCHAR)
+        H5Z_XFORM_RUN_PROG(signed char)
+#else  /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_UCHAR)
+        H5Z_XFORM_RUN_PROG(unsigned char)
+#endif /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_SHORT)
+        H5Z_XFORM_RUN_PROG(short)
+    else if (array_type == H5T_NATIVE_USHORT)
+        H5Z_XFORM_RUN_PROG(unsigned short)
+    else if (array_type == H5T_NATIVE_INT)
+        H5Z_XFORM_RUN_PROG(int)
+    else if (array_type == H5T_NATIVE_UINT)
+        H5Z_XFORM_RUN_PROG(unsigned int)
+    else if (array_type == H5T_NATIVE_LONG)
+        H5Z_XFORM_RUN_PROG(long)
+    else if (array_type == H5T_NATIVE_ULONG)
+        H5Z_XFORM_RUN_PROG(unsigned long)
+    else if (array_type == H5T_NATIVE_LLONG)
+        H5Z_XFORM_RUN_PROG(long long)
+    else if (array_type == H5T_NATIVE_ULLONG)
+        H5Z_XFORM_RUN_PROG(unsigned long long)
+    else if (array_type == H5T_NATIVE_FLOAT)
+        H5Z_XFORM_RUN_PROG(float)
+    else if (array_type == H5T_NATIVE_DOUBLE)
+        H5Z_XFORM_RUN_PROG(double)
+#if H5_SIZEOF_LONG_DOUBLE != 0
+    else if (array_type == H5T_NATIVE_LDOUBLE)
+        H5Z_XFORM_RUN_PROG(long double)
+#endif
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "could not find matching type")
+
+done:
+    H5MM_xfree(tmp);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_eval_prog() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
  *
@@ -1348,6 +1533,165 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_count_nodes
+ *
+ * Purpose:     Counts the nodes in a parse tree.
+ *
+ * Return:      The number of nodes
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__xform_count_nodes(const H5Z_node *tree)
+{
+    size_t ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (tree)
+        ret_value = 1 + H5Z__xform_count_nodes(tree->lchild) + H5Z__xform_count_nodes(tree->rchild);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_count_nodes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile_node
+ *
+ * Purpose:     Appends the instructions for a (reduced) parse tree to a
+ *              compiled transform.  Constants are folded into the
+ *              instructions that use them, so only subtrees that depend on
+ *              the data occupy a stack slot.  DEPTH tracks the current
+ *              stack depth.
+ *
+ * Return:      TRUE if the subtree depends on the data, FALSE if it's a
+ *              constant, negative if it can't be compiled
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5Z__xform_compile_node(const H5Z_node *tree, H5Z_xform_prog_t *prog, unsigned *depth)
+{
+    H5Z_xform_insn_t *insn;
+    const H5Z_node *  cnode;            /* Constant operand node */
+    htri_t            lsym      = FALSE; /* Whether the left subtree depends on the data */
+    htri_t            rsym      = FALSE; /* Whether the right subtree depends on the data */
+    htri_t            ret_value = TRUE;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(tree);
+
+    switch (tree->type) {
+        case H5Z_XFORM_INTEGER:
+        case H5Z_XFORM_FLOAT:
+            HGOTO_DONE(FALSE)
+
+        case H5Z_XFORM_SYMBOL:
+            insn       = &prog->insn[prog->ninsn++];
+            insn->form = H5Z_XFORM_INSN_LOAD;
+            insn->op   = H5Z_XFORM_SYMBOL;
+            insn->val  = 0.0;
+            if (++(*depth) > prog->depth)
+                prog->depth = *depth;
+            prog->nloads++;
+            break;
+
+        case H5Z_XFORM_PLUS:
+        case H5Z_XFORM_MINUS:
+        case H5Z_XFORM_MULT:
+        case H5Z_XFORM_DIVIDE:
+            if (!tree->rchild)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid expression tree")
+            if (tree->lchild && (lsym = H5Z__xform_compile_node(tree->lchild, prog, depth)) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't compile expression tree")
+            if ((rsym = H5Z__xform_compile_node(tree->rchild, prog, depth)) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't compile expression tree")
+
+            /* Operations on two constants should have been reduced away */
+            if (!lsym && !rsym)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unreduced constant expression")
+
+            insn     = &prog->insn[prog->ninsn++];
+            insn->op = tree->type;
+            if (lsym && rsym) {
+                insn->form = H5Z_XFORM_INSN_SS;
+                insn->val  = 0.0;
+                (*depth)--;
+            } /* end if */
+            else {
+                /* A missing left operand, as in -x or +x, counts as zero */
+                cnode      = lsym ? tree->rchild : tree->lchild;
+                insn->form = lsym ? H5Z_XFORM_INSN_SC : H5Z_XFORM_INSN_CS;
+                if (!cnode)
+                    insn->val = 0.0;
+                else if (cnode->type == H5Z_XFORM_INTEGER)
+                    insn->val = (double)cnode->value.int_val;
+                else
+                    insn->val = cnode->value.float_val;
+            } /* end else */
+            break;
+
+        case H5Z_XFORM_ERROR:
+        case H5Z_XFORM_LPAREN:
+        case H5Z_XFORM_RPAREN:
+        case H5Z_XFORM_END:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid expression tree")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile_node() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile
+ *
+ * Purpose:     Compiles the parse tree of a data transform into a flat
+ *              program for H5Z__xform_eval_prog.  Trivial (constant)
+ *              transforms aren't compiled, and if the tree can't be
+ *              compiled the transform is left to H5Z__xform_eval_full.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop)
+{
+    H5Z_xform_prog_t *prog  = &data_xform_prop->prog;
+    unsigned          depth = 0;
+    htri_t            is_sym;
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(data_xform_prop->parse_root);
+    HDassert(NULL == prog->insn);
+
+    if (data_xform_prop->parse_root->type == H5Z_XFORM_INTEGER ||
+        data_xform_prop->parse_root->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (prog->insn = (H5Z_xform_insn_t *)H5MM_malloc(
+                     H5Z__xform_count_nodes(data_xform_prop->parse_root) * sizeof(H5Z_xform_insn_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate compiled data transform")
+
+    /* Fall back to evaluating the parse tree if it can't be compiled */
+    H5E_BEGIN_TRY
+    {
+        is_sym = H5Z__xform_compile_node(data_xform_prop->parse_root, prog, &depth);
+    }
+    H5E_END_TRY;
+    if (is_sym <= 0) {
+        prog->insn = (H5Z_xform_insn_t *)H5MM_xfree(prog->insn);
+        HDmemset(prog, 0, sizeof(*prog));
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Z__op_is_numbs
  *
@@ -1577,6 +1921,10 @@ H5Z_xform_create(const char *expr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL,
                     "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the parse tree for evaluation */
+    if (H5Z__xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTINIT, NULL, "unable to compile data transform")
+
     /* Assign return value */
     ret_value = data_xform_prop;
 
@@ -1588,6 +1936,7 @@ done:
                 H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
             if (data_xform_prop->xform_exp)
                 H5MM_xfree(data_xform_prop->xform_exp);
+            H5MM_xfree(data_xform_prop->prog.insn);
             if (count > 0 && data_xform_prop->dat_val_pointers->ptr_dat_val)
                 H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val);
             if (data_xform_prop->dat_val_pointers)
@@ -1626,6 +1975,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
 
+        /* Free the compiled transform */
+        H5MM_xfree(data_xform_prop->prog.insn);
+
         /* Free the pointers to the temp. arrays, if there are any */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 0)
             H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val);
@@ -1712,6 +2064,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL,
                         "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the copied parse tree */
+        if (H5Z__xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_CANTINIT, FAIL, "unable to compile data transform")
+
         /* Copy new information on top of old information */
         *data_xform_prop = new_data_xform_prop;
     } /* end if */
@@ -1724,6 +2080,7 @@ done:
                 H5Z__xform_destroy_parse_tree(new_data_xform_prop->parse_root);
             if (new_data_xform_prop->xform_exp)
                 H5MM_xfree(new_data_xform_prop->xform_exp);
+            H5MM_xfree(new_data_xform_prop->prog.insn);
             H5MM_xfree(new_data_xform_prop);
         } /* end if */
     }     /* end if */
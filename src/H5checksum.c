@@ -32,6 +32,10 @@
 /***********/
 #include "H5private.h" /* Generic Functions			*/
 
+#ifdef H5_HAVE_X86_DISPATCH
+#include <immintrin.h>
+#endif /* H5_HAVE_X86_DISPATCH */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -40,10 +44,46 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Polynomial quotient for CRC-32C, in reversed bit order */
+/* (the Castagnoli polynomial, as used by iSCSI and SSE4.2's crc32 instruction) */
+#define H5_CRC32C_QUOTIENT 0x82F63B78
+
+/* Number of vectors summed per lane by the vectorized Fletcher-32 kernels
+ * before the lane sums are folded into the running checksum.  This is the
+ * largest power of two for which the second-order lane sums can't overflow
+ * 32 bits: 65535 * n * (n - 1) / 2 < 2^32
+ */
+#define H5_FLETCHER32_BLOCK_VECS 256
+
+/* Buffers with fewer 16-bit words than this use the scalar Fletcher-32 loop */
+#define H5_FLETCHER32_VEC_MIN_WORDS 64
+
+/* Load 32-bit words directly in lookup3 when the host is little-endian,
+ * which gives the same values as assembling them from individual bytes.
+ */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define H5_LOOKUP3_WORD_LOADS
+#endif
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Running state for the block-wise Fletcher-32 computation */
+typedef struct H5_fletcher32_t {
+    uint32_t sum1;    /* First-order sum, reduced modulo 65535 */
+    uint32_t sum2;    /* Second-order sum, reduced modulo 65535 */
+    hbool_t  nonzero; /* Whether any non-zero 16-bit word has been summed */
+} H5_fletcher32_t;
+
+/* Vectorized Fletcher-32 kernel: sums as many whole vectors of 16-bit words
+ * as possible into the running state and returns the # of words consumed.
+ */
+typedef size_t (*H5_fletcher32_kernel_t)(H5_fletcher32_t *state, const uint8_t *data, size_t nwords);
+
+/* CRC-32C update routine, operating on the non-inverted running CRC */
+typedef uint32_t (*H5_crc32c_update_t)(uint32_t crc, const uint8_t *buf, size_t len);
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -51,6 +91,14 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static void     H5__checksum_init_dispatch(void);
+static void     H5__checksum_fletcher32_fold(H5_fletcher32_t *state, uint64_t s1, uint64_t s2, size_t nwords);
+static uint32_t H5__checksum_crc32c_update(uint32_t crc, const uint8_t *buf, size_t len);
+#ifdef H5_HAVE_X86_DISPATCH
+static size_t   H5__checksum_fletcher32_sse2(H5_fletcher32_t *state, const uint8_t *data, size_t nwords);
+static size_t   H5__checksum_fletcher32_avx2(H5_fletcher32_t *state, const uint8_t *data, size_t nwords);
+static uint32_t H5__checksum_crc32c_update_sse42(uint32_t crc, const uint8_t *buf, size_t len);
+#endif /* H5_HAVE_X86_DISPATCH */
 
 /*********************/
 /* Package Variables */
@@ -70,6 +118,209 @@ static uint32_t H5_crc_table[256];
 /* Flag: has the table been computed? */
 static hbool_t H5_crc_table_computed = FALSE;
 
+/* Table of CRC-32C values of all 8-bit messages */
+static uint32_t H5_crc32c_table[256];
+
+/* Flag: has the CRC-32C table been computed? */
+static hbool_t H5_crc32c_table_computed = FALSE;
+
+/* Flag: have the checksum kernels for this CPU been selected? */
+static hbool_t H5_checksum_dispatch_init = FALSE;
+
+/* Vectorized Fletcher-32 kernel for this CPU (NULL if none is available) */
+static H5_fletcher32_kernel_t H5_fletcher32_kernel = NULL;
+
+/* CRC-32C update routine for this CPU */
+static H5_crc32c_update_t H5_crc32c_update = H5__checksum_crc32c_update;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_init_dispatch
+ *
+ * Purpose:	Select the fastest checksum kernels supported by the CPU
+ *              the library is running on.
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5__checksum_init_dispatch(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_X86_DISPATCH
+    if (H5_CPU_HAS("avx2"))
+        H5_fletcher32_kernel = H5__checksum_fletcher32_avx2;
+    else if (H5_CPU_HAS("sse2"))
+        H5_fletcher32_kernel = H5__checksum_fletcher32_sse2;
+
+    if (H5_CPU_HAS("sse4.2"))
+        H5_crc32c_update = H5__checksum_crc32c_update_sse42;
+#endif /* H5_HAVE_X86_DISPATCH */
+
+    H5_checksum_dispatch_init = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_init_dispatch() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_fletcher32_fold
+ *
+ * Purpose:	Fold the exact sums of a block of 16-bit words into the
+ *              running Fletcher-32 state.
+ *
+ *              's1' is the sum of the block's words and 's2' is the sum
+ *              of its running sums, i.e. the sum of w[i] * (nwords - i).
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5__checksum_fletcher32_fold(H5_fletcher32_t *state, uint64_t s1, uint64_t s2, size_t nwords)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    state->sum2 = (uint32_t)((state->sum2 + ((uint64_t)nwords * state->sum1) + s2) % 65535);
+    state->sum1 = (uint32_t)((state->sum1 + s1) % 65535);
+    if (s1)
+        state->nonzero = TRUE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5__checksum_fletcher32_fold() */
+
+#ifdef H5_HAVE_X86_DISPATCH
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_fletcher32_sse2
+ *
+ * Purpose:	Fletcher-32 kernel processing eight 16-bit words at a time
+ *              with SSE2.
+ *
+ *              Each 32-bit lane keeps its own first- and second-order
+ *              sums, which are combined with the lane's word weights at
+ *              the end of every H5_FLETCHER32_BLOCK_VECS vectors.
+ *
+ * Return:	# of 16-bit words summed (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("sse2")
+static size_t
+H5__checksum_fletcher32_sse2(H5_fletcher32_t *state, const uint8_t *data, size_t nwords)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t        nvecs;     /* # of vectors in current block */
+    size_t        done = 0;  /* # of words summed */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while ((nvecs = MIN((nwords - done) / 8, H5_FLETCHER32_BLOCK_VECS)) > 0) {
+        __m128i  vs1_lo = zero, vs1_hi = zero; /* First-order lane sums */
+        __m128i  vs2_lo = zero, vs2_hi = zero; /* Second-order lane sums */
+        uint32_t a1[8], a2[8];                 /* Lane sums, in word order */
+        uint64_t s1 = 0, s2 = 0;               /* Exact sums for block */
+        size_t   u;                            /* Local index variable */
+
+        for (u = 0; u < nvecs; u++) {
+            __m128i x;
+
+            HDmemcpy(&x, data, sizeof(x));
+
+            /* Words are stored big-endian */
+            x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+
+            vs2_lo = _mm_add_epi32(vs2_lo, vs1_lo);
+            vs2_hi = _mm_add_epi32(vs2_hi, vs1_hi);
+            vs1_lo = _mm_add_epi32(vs1_lo, _mm_unpacklo_epi16(x, zero));
+            vs1_hi = _mm_add_epi32(vs1_hi, _mm_unpackhi_epi16(x, zero));
+            data += 16;
+        } /* end for */
+
+        HDmemcpy(&a1[0], &vs1_lo, sizeof(vs1_lo));
+        HDmemcpy(&a1[4], &vs1_hi, sizeof(vs1_hi));
+        HDmemcpy(&a2[0], &vs2_lo, sizeof(vs2_lo));
+        HDmemcpy(&a2[4], &vs2_hi, sizeof(vs2_hi));
+
+        /* Word 'u' of vector 'v' has weight 8 * (nvecs - 1 - v) + (8 - u) */
+        for (u = 0; u < 8; u++) {
+            s1 += a1[u];
+            s2 += (8 * (uint64_t)a2[u]) + ((8 - u) * (uint64_t)a1[u]);
+        } /* end for */
+
+        H5__checksum_fletcher32_fold(state, s1, s2, nvecs * 8);
+        done += nvecs * 8;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(done)
+} /* end H5__checksum_fletcher32_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_fletcher32_avx2
+ *
+ * Purpose:	Fletcher-32 kernel processing sixteen 16-bit words at a
+ *              time with AVX2.  Same scheme as the SSE2 kernel.
+ *
+ * Return:	# of 16-bit words summed (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("avx2")
+static size_t
+H5__checksum_fletcher32_avx2(H5_fletcher32_t *state, const uint8_t *data, size_t nwords)
+{
+    /* Position in the input vector of the word held in each stored lane
+     * (the AVX2 unpack instructions work within 128-bit halves)
+     */
+    static const unsigned word_pos[16] = {0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15};
+    const __m256i         zero         = _mm256_setzero_si256();
+    size_t                nvecs;    /* # of vectors in current block */
+    size_t                done = 0; /* # of words summed */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while ((nvecs = MIN((nwords - done) / 16, H5_FLETCHER32_BLOCK_VECS)) > 0) {
+        __m256i  vs1_lo = zero, vs1_hi = zero; /* First-order lane sums */
+        __m256i  vs2_lo = zero, vs2_hi = zero; /* Second-order lane sums */
+        uint32_t a1[16], a2[16];               /* Lane sums, in stored lane order */
+        uint64_t s1 = 0, s2 = 0;               /* Exact sums for block */
+        size_t   u;                            /* Local index variable */
+
+        for (u = 0; u < nvecs; u++) {
+            __m256i x;
+
+            HDmemcpy(&x, data, sizeof(x));
+
+            /* Words are stored big-endian */
+            x = _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+
+            vs2_lo = _mm256_add_epi32(vs2_lo, vs1_lo);
+            vs2_hi = _mm256_add_epi32(vs2_hi, vs1_hi);
+            vs1_lo = _mm256_add_epi32(vs1_lo, _mm256_unpacklo_epi16(x, zero));
+            vs1_hi = _mm256_add_epi32(vs1_hi, _mm256_unpackhi_epi16(x, zero));
+            data += 32;
+        } /* end for */
+
+        HDmemcpy(&a1[0], &vs1_lo, sizeof(vs1_lo));
+        HDmemcpy(&a1[8], &vs1_hi, sizeof(vs1_hi));
+        HDmemcpy(&a2[0], &vs2_lo, sizeof(vs2_lo));
+        HDmemcpy(&a2[8], &vs2_hi, sizeof(vs2_hi));
+
+        /* Word 'p' of vector 'v' has weight 16 * (nvecs - 1 - v) + (16 - p) */
+        for (u = 0; u < 16; u++) {
+            s1 += a1[u];
+            s2 += (16 * (uint64_t)a2[u]) + ((16 - word_pos[u]) * (uint64_t)a1[u]);
+        } /* end for */
+
+        H5__checksum_fletcher32_fold(state, s1, s2, nvecs * 16);
+        done += nvecs * 16;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(done)
+} /* end H5__checksum_fletcher32_avx2() */
+
+#endif /* H5_HAVE_X86_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:	H5_checksum_fletcher32
  *
@@ -90,6 +341,15 @@ static hbool_t H5_crc_table_computed = FALSE;
  *              0xffff (for backward compatibility reasons with earlier
  *              HDF5 fletcher32 I/O filter routine, mostly).
  *
+ * Note #4:     Larger buffers are summed with a vectorized kernel when one
+ *              is available for the CPU.  The scalar loop below keeps its
+ *              sums below 2^32 by partially reducing them, which always
+ *              ends with a value congruent to the exact sum modulo 65535,
+ *              in the range [1, 0xffff] for a non-zero sum and zero
+ *              otherwise.  The vectorized path reduces the exact sums
+ *              fully and maps a non-zero multiple of 65535 to 0xffff,
+ *              producing bit-identical checksums.
+ *
  * Return:	32-bit fletcher checksum of input buffer (can't fail)
  *
  * Programmer:	Quincey Koziol
@@ -110,33 +370,66 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     HDassert(_data);
     HDassert(_len > 0);
 
-    /* Compute checksum for pairs of bytes */
-    /* (the magic "360" value is is the largest number of sums that can be
-     *  performed without numeric overflow)
-     */
-    while (len) {
-        size_t tlen = len > 360 ? 360 : len;
-        len -= tlen;
-        do {
-            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+    /* Select the checksum kernels for this CPU, if not done yet */
+    if (!H5_checksum_dispatch_init)
+        H5__checksum_init_dispatch();
+
+    /* Use the vectorized kernel for larger buffers */
+    if (H5_fletcher32_kernel && len >= H5_FLETCHER32_VEC_MIN_WORDS) {
+        H5_fletcher32_t state = {0, 0, FALSE}; /* Running checksum state */
+        uint64_t        s1 = 0, s2 = 0;        /* Exact sums of remaining words */
+        size_t          nrem;                  /* # of words left for scalar loop */
+        size_t          done;                  /* # of words summed by the kernel */
+
+        done = (*H5_fletcher32_kernel)(&state, data, len);
+        data += 2 * done;
+        nrem = len - done;
+
+        /* Sum the remaining words, plus the odd byte (if any) as a final word */
+        while (nrem--) {
+            s1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            s2 += s1;
             data += 2;
+        } /* end while */
+        if (_len % 2) {
+            s1 += (uint32_t)(((uint16_t)*data) << 8);
+            s2 += s1;
+        } /* end if */
+        H5__checksum_fletcher32_fold(&state, s1, s2, (len - done) + (_len % 2));
+
+        /* Map non-zero multiples of 65535 to the scalar loop's representation */
+        sum1 = (state.sum1 == 0 && state.nonzero) ? 0xffff : state.sum1;
+        sum2 = (state.sum2 == 0 && state.nonzero) ? 0xffff : state.sum2;
+    } /* end if */
+    else {
+        /* Compute checksum for pairs of bytes */
+        /* (the magic "360" value is is the largest number of sums that can be
+         *  performed without numeric overflow)
+         */
+        while (len) {
+            size_t tlen = len > 360 ? 360 : len;
+            len -= tlen;
+            do {
+                sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+                data += 2;
+                sum2 += sum1;
+            } while (--tlen);
+            sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+            sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+        }
+
+        /* Check for odd # of bytes */
+        if (_len % 2) {
+            sum1 += (uint32_t)(((uint16_t)*data) << 8);
             sum2 += sum1;
-        } while (--tlen);
-        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
-        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
-    }
+            sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+            sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+        } /* end if */
 
-    /* Check for odd # of bytes */
-    if (_len % 2) {
-        sum1 += (uint32_t)(((uint16_t)*data) << 8);
-        sum2 += sum1;
+        /* Second reduction step to reduce sums to 16 bits */
         sum1 = (sum1 & 0xffff) + (sum1 >> 16);
         sum2 = (sum2 & 0xffff) + (sum2 >> 16);
-    } /* end if */
-
-    /* Second reduction step to reduce sums to 16 bits */
-    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
-    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end else */
 
     FUNC_LEAVE_NOAPI((sum2 << 16) | sum1)
 } /* end H5_checksum_fletcher32() */
@@ -239,6 +532,124 @@ H5_checksum_crc(const void *_data, size_t len)
                      0xffffffffL)
 } /* end H5_checksum_crc() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_crc32c_update
+ *
+ * Purpose:	Update a running CRC-32C with the bytes buf[0..len-1], using
+ *              a lookup table.  The running CRC is kept inverted, as in
+ *              H5__checksum_crc_update().
+ *
+ * Return:	32-bit CRC-32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5__checksum_crc32c_update(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    size_t n; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Initialize the CRC-32C table if necessary */
+    if (!H5_crc32c_table_computed) {
+        uint32_t c;    /* Checksum for each byte value */
+        unsigned u, k; /* Local index variables */
+
+        for (u = 0; u < 256; u++) {
+            c = (uint32_t)u;
+            for (k = 0; k < 8; k++)
+                c = (c & 1) ? (H5_CRC32C_QUOTIENT ^ (c >> 1)) : (c >> 1);
+            H5_crc32c_table[u] = c;
+        } /* end for */
+        H5_crc32c_table_computed = TRUE;
+    } /* end if */
+
+    /* Update the CRC with the results from this buffer */
+    for (n = 0; n < len; n++)
+        crc = H5_crc32c_table[(crc ^ buf[n]) & 0xff] ^ (crc >> 8);
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5__checksum_crc32c_update() */
+
+#ifdef H5_HAVE_X86_DISPATCH
+
+/*-------------------------------------------------------------------------
+ * Function:	H5__checksum_crc32c_update_sse42
+ *
+ * Purpose:	Update a running CRC-32C with the SSE4.2 crc32 instruction.
+ *
+ * Return:	32-bit CRC-32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_TARGET("sse4.2")
+static uint32_t
+H5__checksum_crc32c_update_sse42(uint32_t crc, const uint8_t *buf, size_t len)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef __x86_64__
+    {
+        uint64_t crc64 = crc; /* Running CRC, in 64-bit form */
+
+        while (len >= 8) {
+            uint64_t word; /* Next 8 bytes of buffer */
+
+            HDmemcpy(&word, buf, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            buf += 8;
+            len -= 8;
+        } /* end while */
+        crc = (uint32_t)crc64;
+    }
+#endif /* __x86_64__ */
+    while (len >= 4) {
+        uint32_t word; /* Next 4 bytes of buffer */
+
+        HDmemcpy(&word, buf, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+        buf += 4;
+        len -= 4;
+    } /* end while */
+    while (len--)
+        crc = _mm_crc32_u8(crc, *buf++);
+
+    FUNC_LEAVE_NOAPI(crc)
+} /* end H5__checksum_crc32c_update_sse42() */
+
+#endif /* H5_HAVE_X86_DISPATCH */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_crc32c
+ *
+ * Purpose:	Compute the CRC-32C (Castagnoli) checksum of a buffer, using
+ *              the CPU's crc32 instruction when available.
+ *
+ *              'initval' is the checksum of any preceding data (or zero),
+ *              so that a checksum can be computed over several buffers:
+ *                  H5_checksum_crc32c(b2, l2, H5_checksum_crc32c(b1, l1, 0))
+ *              is the checksum of b1 followed by b2.
+ *
+ * Return:	32-bit CRC-32C checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5_checksum_crc32c(const void *data, size_t len, uint32_t initval)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(data);
+    HDassert(len > 0);
+
+    /* Select the checksum kernels for this CPU, if not done yet */
+    if (!H5_checksum_dispatch_init)
+        H5__checksum_init_dispatch();
+
+    FUNC_LEAVE_NOAPI((*H5_crc32c_update)(~initval, (const uint8_t *)data, len) ^ 0xffffffff)
+} /* end H5_checksum_crc32c() */
+
 /*
 -------------------------------------------------------------------------------
 H5_lookup3_mix -- mix 3 32-bit values reversibly.
@@ -392,7 +803,19 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
+    /* (each block depends on the mixed state from the previous one, so the
+     *  loop can't be vectorized, but on little-endian hosts each 32-bit value
+     *  can be loaded with a single word-sized access)
+     */
     while (length > 12) {
+#ifdef H5_LOOKUP3_WORD_LOADS
+        uint32_t w[3]; /* Block of key, as 32-bit values */
+
+        HDmemcpy(w, k, sizeof(w));
+        a += w[0];
+        b += w[1];
+        c += w[2];
+#else  /* H5_LOOKUP3_WORD_LOADS */
         a += k[0];
         a += ((uint32_t)k[1]) << 8;
         a += ((uint32_t)k[2]) << 16;
@@ -405,6 +828,7 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
         c += ((uint32_t)k[9]) << 8;
         c += ((uint32_t)k[10]) << 16;
         c += ((uint32_t)k[11]) << 24;
+#endif /* H5_LOOKUP3_WORD_LOADS */
         H5_lookup3_mix(a, b, c);
         length -= 12;
         k += 12;
@@ -310,6 +310,25 @@
 #define H5_ATTR_FALLTHROUGH     /*void*/
 #endif
 
+/*
+ * Runtime CPU dispatch for vectorized internal kernels.
+ *
+ * When the compiler can generate code for instruction set extensions on a
+ * per-function basis (GCC >= 4.9 and clang on x86), kernels are compiled
+ * with H5_ATTR_TARGET() and selected at runtime with H5_CPU_HAS(), so the
+ * library stays runnable on any CPU of the target architecture.  Callers
+ * must always provide a portable fallback for when H5_HAVE_X86_DISPATCH
+ * is not defined.
+ */
+#if defined(H5_HAVE_ATTRIBUTE) && (defined(__x86_64__) || defined(__i386__)) &&                              \
+    ((defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) ||                    \
+     defined(__clang__)) &&                                                                                  \
+    !defined(__INTEL_COMPILER) && !defined(__PGI)
+#define H5_HAVE_X86_DISPATCH 1
+#define H5_ATTR_TARGET(X)    __attribute__((target(X)))
+#define H5_CPU_HAS(X)        __builtin_cpu_supports(X)
+#endif
+
 /*
  * Networking headers used by the mirror VFD and related tests and utilities.
  */
@@ -1228,6 +1247,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_attr_setscope
 #define HDpthread_attr_setscope(A, S) pthread_attr_setscope(A, S)
 #endif /* HDpthread_attr_setscope */
+#ifndef HDpthread_cond_broadcast
+#define HDpthread_cond_broadcast(C) pthread_cond_broadcast(C)
+#endif /* HDpthread_cond_broadcast */
 #ifndef HDpthread_cond_init
 #define HDpthread_cond_init(C, A) pthread_cond_init(C, A)
 #endif /* HDpthread_cond_init */
@@ -1240,6 +1262,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_create
 #define HDpthread_create(R, A, F, U) pthread_create(R, A, F, U)
 #endif /* HDpthread_create */
+#ifndef HDpthread_detach
+#define HDpthread_detach(T) pthread_detach(T)
+#endif /* HDpthread_detach */
 #ifndef HDpthread_equal
 #define HDpthread_equal(T1, T2) pthread_equal(T1, T2)
 #endif /* HDpthread_equal */
@@ -2681,6 +2706,7 @@ H5_DLL int H5Z_term_package(void);
 H5_DLL uint32_t H5_checksum_fletcher32(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_crc(const void *data, size_t len);
 H5_DLL uint32_t H5_checksum_lookup3(const void *data, size_t len, uint32_t initval);
+H5_DLL uint32_t H5_checksum_crc32c(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_checksum_metadata(const void *data, size_t len, uint32_t initval);
 H5_DLL uint32_t H5_hash_string(const char *str);
 
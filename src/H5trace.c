@@ -1195,6 +1195,27 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                         } /* end block */
                         break;
 
+                        case 'c': /* H5F_metadata_checksum_t */
+                        {
+                            H5F_metadata_checksum_t alg = (H5F_metadata_checksum_t)HDva_arg(ap, int);
+
+                            switch (alg) {
+                                case H5F_METADATA_CHECKSUM_LOOKUP3:
+                                    H5RS_acat(rs, "H5F_METADATA_CHECKSUM_LOOKUP3");
+                                    break;
+
+                                case H5F_METADATA_CHECKSUM_CRC32C:
+                                    H5RS_acat(rs, "H5F_METADATA_CHECKSUM_CRC32C");
+                                    break;
+
+                                case H5F_METADATA_CHECKSUM_NTYPES:
+                                default:
+                                    H5RS_asprintf_cat(rs, "%ld", (long)alg);
+                                    break;
+                            } /* end switch */
+                        }     /* end block */
+                        break;
+
                         case 'd': /* H5F_close_degree_t */
                         {
                             H5F_close_degree_t degree = (H5F_close_degree_t)HDva_arg(ap, int);
@@ -3502,6 +3523,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_READ_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_READ_MULTI");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_WRITE_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_WRITE_MULTI");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3706,6 +3735,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_OBJECT_GET_NATIVE_INFO");
                                     break;
 
+                                case H5VL_NATIVE_OBJECT_CREATE_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_OBJECT_CREATE_MULTI");
+                                    break;
+
+                                case H5VL_NATIVE_OBJECT_READ_ATTR_BATCH:
+                                    H5RS_acat(rs, "H5VL_NATIVE_OBJECT_READ_ATTR_BATCH");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3810,6 +3847,8 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                 H5RS_acat(rs, "H5Z_FILTER_NBIT");
                             else if (H5Z_FILTER_SCALEOFFSET == id)
                                 H5RS_acat(rs, "H5Z_FILTER_SCALEOFFSET");
+                            else if (H5Z_FILTER_LZ == id)
+                                H5RS_acat(rs, "H5Z_FILTER_LZ");
                             else
                                 H5RS_asprintf_cat(rs, "%ld", (long)id);
                         } /* end block */
@@ -402,6 +402,7 @@ set (test_CLEANFILES
     mirror_rw/*
     mirror_wo/*
     event_set_*.h5
+    maps.h5
     h5s_block.h5
     h5s_plist.h5
 )
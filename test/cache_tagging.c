@@ -353,6 +353,12 @@ evict_entries(hid_t fid)
      */
     H5C_flush_cache(f, H5C__FLUSH_INVALIDATE_FLAG);
 
+    /* Forget the links cached for resolving paths, so that paths are
+     * resolved from the groups' metadata again
+     */
+    if (H5G_path_cache_dest(f) < 0)
+        TEST_ERROR;
+
     /* shutdown the slist -- allow it to be non-empty */
     if (H5C_set_slist_enabled(f->shared->cache, FALSE, TRUE) < 0)
         TEST_ERROR;
@@ -39,6 +39,7 @@
 #include "H5Spkg.h" /* Dataspace                            */
 
 #define H5T_FRIEND  /*suppress error about including H5Tpkg */
+#define H5T_TESTING
 #include "H5Tpkg.h" /* Datatype                             */
 
 #define H5A_FRIEND  /*suppress error about including H5Apkg     */
@@ -85,6 +86,12 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "alloc_0sized",        /* 26 */
                           "h5s_block",           /* 27 */
                           "h5s_plist",           /* 28 */
+                          "chunk_map_reuse",     /* 29 */
+                          "read_write_multi",    /* 30 */
+                          "read_write_multi2",   /* 31 */
+                          "sieve_windows",       /* 32 */
+                          "create_multi",        /* 33 */
+                          "deflate_reuse",       /* 34 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -105,11 +112,16 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_COMPACT_MAX2_NAME    "max_compact_2"
 #define DSET_CONV_BUF_NAME        "conv_buf"
 #define DSET_TCONV_NAME           "tconv"
+#define DSET_CONV_NTHREADS_NAME   "conv_nthreads"
+#define DSET_CONV_BUF_SIZE_NAME   "conv_buf_size"
+#define DSET_CONV_BUF_SIZE_NAME_2 "conv_buf_size_2"
+#define DSET_CONV_BUF_SIZE_NAME_3 "conv_buf_size_3"
 #define DSET_DEFLATE_NAME         "deflate"
 #define DSET_SHUFFLE_NAME         "shuffle"
 #define DSET_FLETCHER32_NAME      "fletcher32"
 #define DSET_FLETCHER32_NAME_2    "fletcher32_2"
 #define DSET_FLETCHER32_NAME_3    "fletcher32_3"
+#define DSET_LZ_NAME              "lz"
 #define DSET_SHUF_DEF_FLET_NAME   "shuffle+deflate+fletcher32"
 #define DSET_SHUF_DEF_FLET_NAME_2 "shuffle+deflate+fletcher32_2"
 #define DSET_OPTIONAL_SCALAR      "dataset_with_scalar_space"
@@ -131,6 +143,7 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_SET_LOCAL_NAME_2          "set_local_2"
 #define DSET_ONEBYTE_SHUF_NAME         "onebyte_shuffle"
 #define DSET_NBIT_INT_NAME             "nbit_int"
+#define DSET_NBIT_LLONG_NAME           "nbit_llong"
 #define DSET_NBIT_FLOAT_NAME           "nbit_float"
 #define DSET_NBIT_DOUBLE_NAME          "nbit_double"
 #define DSET_NBIT_ARRAY_NAME           "nbit_array"
@@ -145,6 +158,10 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_SCALEOFFSET_FLOAT_NAME_2  "scaleoffset_float_2"
 #define DSET_SCALEOFFSET_DOUBLE_NAME   "scaleoffset_double"
 #define DSET_SCALEOFFSET_DOUBLE_NAME_2 "scaleoffset_double_2"
+#define DSET_LZ_BLOCKS_NAME            "lz_blocks"
+#define DSET_LZ_SMALL_NAME             "lz_small"
+#define DSET_MIN_RATIO_NAME            "min_filter_ratio"
+#define DSET_MIN_RATIO_EDC_NAME        "min_filter_ratio_edc"
 #define DSET_COMPARE_DCPL_NAME         "compare_dcpl"
 #define DSET_COMPARE_DCPL_NAME_2       "compare_dcpl_2"
 #define DSET_COPY_DCPL_NAME_1          "copy_dcpl_1"
@@ -1522,6 +1539,436 @@ error:
     return FAIL;
 } /* end test_conv_buffer() */
 
+/*-------------------------------------------------------------------------
+ * Function:  test_conv_nthreads
+ *
+ * Purpose:   Test datatype conversion with several conversion threads,
+ *            over several passes through a small conversion buffer.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_conv_nthreads(hid_t fid)
+{
+    const hsize_t dims[1]   = {100000};
+    hid_t         space     = -1;
+    hid_t         dset      = -1;
+    hid_t         dxpl      = -1;
+    int *         orig      = NULL;
+    int *         new_data  = NULL;
+    double *      new_ddata = NULL;
+    uint8_t *     serial    = NULL;
+    uint8_t *     threaded  = NULL;
+    uint8_t *     bkg       = NULL;
+    hid_t         src_cmpd  = -1;
+    hid_t         dst_cmpd  = -1;
+    unsigned      nthreads  = 0;
+    unsigned      nsplit    = 0;
+    herr_t        status;
+    size_t        u;
+
+    TESTING("datatype conversion threads");
+
+    if (NULL == (orig = (int *)HDmalloc((size_t)dims[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (new_data = (int *)HDmalloc((size_t)dims[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (new_ddata = (double *)HDmalloc((size_t)dims[0] * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (serial = (uint8_t *)HDmalloc((size_t)dims[0] * 2 * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (threaded = (uint8_t *)HDmalloc((size_t)dims[0] * 2 * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (bkg = (uint8_t *)HDcalloc((size_t)dims[0], 2 * sizeof(double))))
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        orig[u] = (int)u - 50000;
+
+    /* Check the default and argument checking */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_type_conv_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 1)
+        FAIL_PUTS_ERROR("    Default number of conversion threads is incorrect.")
+    H5E_BEGIN_TRY
+    {
+        status = H5Pset_type_conv_nthreads(dxpl, 0);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        FAIL_PUTS_ERROR("    Zero conversion threads was accepted.")
+    if (H5Pset_type_conv_nthreads(dxpl, 4) < 0)
+        TEST_ERROR
+    if (H5Pget_type_conv_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 4)
+        FAIL_PUTS_ERROR("    Number of conversion threads is incorrect.")
+
+    /* Use a conversion buffer of a fraction of the transfer, holding enough
+     * of the largest elements converted below to split each strip in two
+     */
+    if (H5Pset_buffer(dxpl, 2 * H5T_CONV_MIN_THREAD_NELMTS * sizeof(double), NULL, NULL) < 0)
+        TEST_ERROR
+
+    /* Write big-endian, reading back unconverted data with the default DXPL */
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dset = H5Dcreate2(fid, DSET_CONV_NTHREADS_NAME, H5T_STD_I32BE, space, H5P_DEFAULT, H5P_DEFAULT,
+                           H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    nsplit = H5T__conv_nsplit_test();
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, orig) < 0)
+        TEST_ERROR
+#ifdef H5T_CONV_HAVE_THREADS
+    if (H5T__conv_nsplit_test() == nsplit)
+        FAIL_PUTS_ERROR("    Write conversion wasn't split across threads.")
+#else
+    if (H5T__conv_nsplit_test() != nsplit)
+        FAIL_PUTS_ERROR("    Write conversion was split without threads.")
+#endif
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(orig, new_data, (size_t)dims[0] * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("    Threaded write converted incorrectly.")
+
+    /* Read back, converting to a larger type */
+    if (H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, new_ddata) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (!H5_DBL_ABS_EQUAL(new_ddata[u], (double)orig[u]))
+            FAIL_PUTS_ERROR("    Threaded read converted incorrectly.")
+
+    /* Read back through a data transform */
+    if (H5Pset_data_transform(dxpl, "2*x") < 0)
+        TEST_ERROR
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, new_data) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (new_data[u] != 2 * orig[u])
+            FAIL_PUTS_ERROR("    Threaded read transformed incorrectly.")
+
+    /* Convert directly, swapping bytes and converting to a larger type */
+    HDmemcpy(new_data, orig, (size_t)dims[0] * sizeof(int));
+    nsplit = H5T__conv_nsplit_test();
+    if (H5Tconvert(H5T_NATIVE_INT, H5T_STD_I32BE, (size_t)dims[0], new_data, NULL, dxpl) < 0)
+        TEST_ERROR
+#ifdef H5T_CONV_HAVE_THREADS
+    if (H5T__conv_nsplit_test() == nsplit)
+        FAIL_PUTS_ERROR("    H5Tconvert wasn't split across threads.")
+#endif
+    if (H5Tconvert(H5T_STD_I32BE, H5T_NATIVE_INT, (size_t)dims[0], new_data, NULL, dxpl) < 0)
+        TEST_ERROR
+    if (HDmemcmp(orig, new_data, (size_t)dims[0] * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("    Threaded H5Tconvert swapped bytes incorrectly.")
+    HDmemcpy(new_ddata, orig, (size_t)dims[0] * sizeof(int));
+    if (H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, (size_t)dims[0], new_ddata, NULL, dxpl) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        if (!H5_DBL_ABS_EQUAL(new_ddata[u], (double)orig[u]))
+            FAIL_PUTS_ERROR("    Threaded H5Tconvert converted incorrectly.")
+
+    /* Convert between floating-point types and from integers, which must
+     * give exactly the same bytes with threads as without
+     */
+    for (u = 0; u < (size_t)dims[0]; u++)
+        new_ddata[u] = (double)orig[u] * 1.1 + 0.3;
+    HDmemcpy(serial, new_ddata, (size_t)dims[0] * sizeof(double));
+    HDmemcpy(threaded, new_ddata, (size_t)dims[0] * sizeof(double));
+    if (H5Tconvert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, (size_t)dims[0], serial, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    nsplit = H5T__conv_nsplit_test();
+    if (H5Tconvert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, (size_t)dims[0], threaded, NULL, dxpl) < 0)
+        TEST_ERROR
+#ifdef H5T_CONV_HAVE_THREADS
+    if (H5T__conv_nsplit_test() == nsplit)
+        FAIL_PUTS_ERROR("    Double to float conversion wasn't split across threads.")
+#endif
+    if (HDmemcmp(serial, threaded, (size_t)dims[0] * sizeof(float)) != 0)
+        FAIL_PUTS_ERROR("    Threaded double to float conversion differs.")
+    if (H5Tconvert(H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, (size_t)dims[0], serial, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Tconvert(H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, (size_t)dims[0], threaded, NULL, dxpl) < 0)
+        TEST_ERROR
+    if (HDmemcmp(serial, threaded, (size_t)dims[0] * sizeof(double)) != 0)
+        FAIL_PUTS_ERROR("    Threaded float to double conversion differs.")
+    for (u = 0; u < (size_t)dims[0]; u++)
+        new_ddata[u] = (double)(float)new_ddata[u];
+    if (HDmemcmp(new_ddata, threaded, (size_t)dims[0] * sizeof(double)) != 0)
+        FAIL_PUTS_ERROR("    Threaded floating-point conversions converted incorrectly.")
+    HDmemcpy(serial, orig, (size_t)dims[0] * sizeof(int));
+    HDmemcpy(threaded, orig, (size_t)dims[0] * sizeof(int));
+    if (H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_FLOAT, (size_t)dims[0], serial, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_FLOAT, (size_t)dims[0], threaded, NULL, dxpl) < 0)
+        TEST_ERROR
+    if (HDmemcmp(serial, threaded, (size_t)dims[0] * sizeof(float)) != 0)
+        FAIL_PUTS_ERROR("    Threaded int to float conversion differs.")
+
+    /* Convert compound elements, whose members are converted with threads */
+    if ((src_cmpd = H5Tcreate(H5T_COMPOUND, sizeof(double) + sizeof(int))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(src_cmpd, "a", 0, H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(src_cmpd, "b", sizeof(double), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if ((dst_cmpd = H5Tcreate(H5T_COMPOUND, sizeof(float) + sizeof(double))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(dst_cmpd, "a", 0, H5T_NATIVE_FLOAT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(dst_cmpd, "b", sizeof(float), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++) {
+        uint8_t *elmt = serial + u * (sizeof(double) + sizeof(int));
+
+        HDmemcpy(elmt, &new_ddata[u], sizeof(double));
+        HDmemcpy(elmt + sizeof(double), &orig[u], sizeof(int));
+    } /* end for */
+    HDmemcpy(threaded, serial, (size_t)dims[0] * (sizeof(double) + sizeof(int)));
+    if (H5Tconvert(src_cmpd, dst_cmpd, (size_t)dims[0], serial, bkg, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    nsplit = H5T__conv_nsplit_test();
+    if (H5Tconvert(src_cmpd, dst_cmpd, (size_t)dims[0], threaded, bkg, dxpl) < 0)
+        TEST_ERROR
+#ifdef H5T_CONV_HAVE_THREADS
+    if (H5T__conv_nsplit_test() == nsplit)
+        FAIL_PUTS_ERROR("    Compound member conversions weren't split across threads.")
+#endif
+    if (HDmemcmp(serial, threaded, (size_t)dims[0] * (sizeof(float) + sizeof(double))) != 0)
+        FAIL_PUTS_ERROR("    Threaded compound conversion differs.")
+
+    if (H5Tclose(src_cmpd) < 0)
+        TEST_ERROR
+    if (H5Tclose(dst_cmpd) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+
+    HDfree(orig);
+    HDfree(new_data);
+    HDfree(new_ddata);
+    HDfree(serial);
+    HDfree(threaded);
+    HDfree(bkg);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(src_cmpd);
+        H5Tclose(dst_cmpd);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY;
+    HDfree(orig);
+    HDfree(new_data);
+    HDfree(new_ddata);
+    HDfree(serial);
+    HDfree(threaded);
+    HDfree(bkg);
+
+    return FAIL;
+} /* end test_conv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:  test_conv_buf_size
+ *
+ * Purpose:   Test datatype conversion with the conversion buffer sized
+ *            by the library: transfers larger than the biggest buffer,
+ *            transfers of a few elements, chunked datasets and
+ *            pipelined conversion threads.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_conv_buf_size(hid_t fid)
+{
+    typedef struct {
+        int    i;
+        double d;
+    } conv_buf_cmpd_t;
+
+    const hsize_t    dims[1]       = {3 * 1024 * 1024};
+    const hsize_t    chunk_dims[1] = {100000};
+    hsize_t          start[1]      = {1234567};
+    hsize_t          count[1]      = {3};
+    hid_t            space         = -1;
+    hid_t            mspace        = -1;
+    hid_t            dset          = -1;
+    hid_t            dset2         = -1;
+    hid_t            dcpl          = -1;
+    hid_t            dxpl          = -1;
+    hid_t            mtype         = -1;
+    hid_t            ftype         = -1;
+    int *            orig          = NULL;
+    double *         new_ddata     = NULL;
+    conv_buf_cmpd_t *cmpd          = NULL;
+    double           few[3];
+    int              pass;
+    size_t           u;
+
+    TESTING("datatype conversion with library-sized buffers");
+
+    if (NULL == (orig = (int *)HDmalloc((size_t)dims[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (new_ddata = (double *)HDmalloc((size_t)dims[0] * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (cmpd = (conv_buf_cmpd_t *)HDmalloc((size_t)chunk_dims[0] * sizeof(conv_buf_cmpd_t))))
+        TEST_ERROR
+    for (u = 0; u < (size_t)dims[0]; u++)
+        orig[u] = (int)u - 1000000;
+
+    /* Contiguous dataset, bigger than the largest conversion buffer once converted */
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dset = H5Dcreate2(fid, DSET_CONV_BUF_SIZE_NAME, H5T_STD_I32BE, space, H5P_DEFAULT, H5P_DEFAULT,
+                           H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Chunked dataset of the same data */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        TEST_ERROR
+    if ((dset2 = H5Dcreate2(fid, DSET_CONV_BUF_SIZE_NAME_2, H5T_STD_I32BE, space, H5P_DEFAULT, dcpl,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    if ((mspace = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+
+    /* Once serially, then with conversion pipelined through several threads */
+    for (pass = 0; pass < 2; pass++) {
+        if (pass > 0 && H5Pset_type_conv_nthreads(dxpl, 4) < 0)
+            TEST_ERROR
+
+        if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, orig) < 0)
+            TEST_ERROR
+        if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, orig) < 0)
+            TEST_ERROR
+
+        /* Read everything back, converting to a larger type */
+        HDmemset(new_ddata, 0, (size_t)dims[0] * sizeof(double));
+        if (H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, new_ddata) < 0)
+            TEST_ERROR
+        for (u = 0; u < (size_t)dims[0]; u++)
+            if (!H5_DBL_ABS_EQUAL(new_ddata[u], (double)orig[u]))
+                FAIL_PUTS_ERROR("    Contiguous read converted incorrectly.")
+        HDmemset(new_ddata, 0, (size_t)dims[0] * sizeof(double));
+        if (H5Dread(dset2, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, new_ddata) < 0)
+            TEST_ERROR
+        for (u = 0; u < (size_t)dims[0]; u++)
+            if (!H5_DBL_ABS_EQUAL(new_ddata[u], (double)orig[u]))
+                FAIL_PUTS_ERROR("    Chunked read converted incorrectly.")
+
+        /* Read a few elements */
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if (H5Dread(dset, H5T_NATIVE_DOUBLE, mspace, space, dxpl, few) < 0)
+            TEST_ERROR
+        for (u = 0; u < (size_t)count[0]; u++)
+            if (!H5_DBL_ABS_EQUAL(few[u], (double)orig[start[0] + u]))
+                FAIL_PUTS_ERROR("    Small read converted incorrectly.")
+        if (H5Sselect_all(space) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR
+
+    /* Compound conversion with a background buffer */
+    if ((mtype = H5Tcreate(H5T_COMPOUND, sizeof(conv_buf_cmpd_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(mtype, "i", HOFFSET(conv_buf_cmpd_t, i), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(mtype, "d", HOFFSET(conv_buf_cmpd_t, d), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    if ((ftype = H5Tcreate(H5T_COMPOUND, (size_t)12)) < 0)
+        TEST_ERROR
+    if (H5Tinsert(ftype, "d", (size_t)0, H5T_IEEE_F64BE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(ftype, "i", (size_t)8, H5T_STD_I32BE) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    if ((space = H5Screate_simple(1, chunk_dims, NULL)) < 0)
+        TEST_ERROR
+    if ((dset = H5Dcreate2(fid, DSET_CONV_BUF_SIZE_NAME_3, ftype, space, H5P_DEFAULT, H5P_DEFAULT,
+                           H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)chunk_dims[0]; u++) {
+        cmpd[u].i = orig[u];
+        cmpd[u].d = (double)orig[u] / 4;
+    } /* end for */
+    if (H5Dwrite(dset, mtype, H5S_ALL, H5S_ALL, dxpl, cmpd) < 0)
+        TEST_ERROR
+    HDmemset(cmpd, 0, (size_t)chunk_dims[0] * sizeof(conv_buf_cmpd_t));
+    if (H5Dread(dset, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, cmpd) < 0)
+        TEST_ERROR
+    for (u = 0; u < (size_t)chunk_dims[0]; u++)
+        if (cmpd[u].i != orig[u] || !H5_DBL_ABS_EQUAL(cmpd[u].d, (double)orig[u] / 4))
+            FAIL_PUTS_ERROR("    Compound conversion incorrect.")
+
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR
+    if (H5Tclose(mtype) < 0)
+        TEST_ERROR
+    if (H5Tclose(ftype) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+
+    HDfree(orig);
+    HDfree(new_ddata);
+    HDfree(cmpd);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Dclose(dset2);
+        H5Tclose(mtype);
+        H5Tclose(ftype);
+        H5Sclose(space);
+        H5Sclose(mspace);
+        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY;
+    HDfree(orig);
+    HDfree(new_ddata);
+    HDfree(cmpd);
+
+    return FAIL;
+} /* end test_conv_buf_size() */
+
 /*-------------------------------------------------------------------------
  * Function:  test_tconv
  *
@@ -2509,6 +2956,7 @@ test_filters(hid_t file, hid_t
 #endif /* H5_HAVE_FILTER_SZIP */
 
     hsize_t shuffle_size; /* Size of dataset with shuffle filter */
+    hsize_t lz_size;      /* Size of dataset with LZ filter */
 
 #if defined(H5_HAVE_FILTER_DEFLATE) || defined(H5_HAVE_FILTER_SZIP)
     hsize_t combo_size; /* Size of dataset with multiple filters */
@@ -2621,6 +3069,25 @@ test_filters(hid_t file, hid_t
     HDputs("    Deflate filter not enabled");
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+    /*----------------------------------------------------------
+     * STEP 2a: Test LZ compression by itself.
+     *----------------------------------------------------------
+     */
+    HDputs("Testing LZ filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_lz(dc) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_LZ_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED, &lz_size) < 0)
+        goto error;
+
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+
         /*----------------------------------------------------------
          * STEP 3: Test szip compression by itself.
          *----------------------------------------------------------
@@ -3300,60 +3767,178 @@ error:
 } /* end test_nbit_int() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_nbit_float
+ * Function:    test_nbit_llong
  *
- * Purpose:     Tests the float datatype of nbit filter
+ * Purpose:     Tests the nbit filter on a 64-bit integer datatype whose
+ *              precision is too wide to be packed in one piece
  *
  * Return:      Success:        0
  *              Failure:        -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_nbit_float(hid_t file)
+test_nbit_llong(hid_t file)
 {
-    hid_t         dataset, datatype, space, dc;
-    const hsize_t size[2]       = {2, 5};
-    const hsize_t chunk_size[2] = {2, 5};
-    /* orig_data[] are initialized to be within the range that can be represented by
-     * dataset datatype (no precision loss during datatype conversion)
-     */
-    float  orig_data[2][5] = {{188384.0f, 19.103516f, -1.0831790e9f, -84.242188f, 5.2045898f},
-                             {-49140.0f, 2350.25f, -3.2110596e-1f, 6.4998865e-5f, -0.0f}};
-    float  new_data[2][5];
-    size_t precision, offset;
-    size_t i, j;
-
-    TESTING("    nbit float (setup)");
-
-    /* Define user-defined single-precision floating-point type for dataset */
-    datatype = H5Tcopy(H5T_IEEE_F32BE);
-    if (H5Tset_fields(datatype, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
-        FAIL_STACK_ERROR
-    offset = 7;
-    if (H5Tset_offset(datatype, offset) < 0)
-        FAIL_STACK_ERROR
-    precision = 20;
+    hid_t              dataset = H5I_INVALID_HID, datatype = H5I_INVALID_HID, mem_datatype = H5I_INVALID_HID;
+    hid_t              space = H5I_INVALID_HID, dc = H5I_INVALID_HID;
+    hsize_t            size[1]       = {300};
+    hsize_t            chunk_size[1] = {300};
+    unsigned long long orig_data[300];
+    unsigned long long new_data[300];
+    unsigned long long mask;
+    size_t             precision, offset;
+    hsize_t            storage_size;
+    size_t             i;
+
+    TESTING("    nbit unsigned long long (setup)");
+
+    /* Define dataset datatype with a precision above 56 bits at an odd offset */
+    datatype  = H5Tcopy(H5T_NATIVE_ULLONG);
+    precision = 61;
     if (H5Tset_precision(datatype, precision) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tset_size(datatype, (size_t)4) < 0)
-        FAIL_STACK_ERROR
-    if (H5Tset_ebias(datatype, (size_t)31) < 0)
-        FAIL_STACK_ERROR
+        goto error;
+    offset = 3;
+    if (H5Tset_offset(datatype, offset) < 0)
+        goto error;
 
-    /* Create the data space */
-    if ((space = H5Screate_simple(2, size, NULL)) < 0)
-        FAIL_STACK_ERROR
+    /* Copy to memory datatype before setting order */
+    if ((mem_datatype = H5Tcopy(datatype)) < 0)
+        goto error;
 
-    /* Use nbit filter  */
+    /* Set order of dataset datatype */
+    if (H5Tset_order(datatype, H5T_ORDER_BE) < 0)
+        goto error;
+
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        goto error;
     if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        FAIL_STACK_ERROR
-    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
-        FAIL_STACK_ERROR
+        goto error;
+    if (H5Pset_chunk(dc, 1, chunk_size) < 0)
+        goto error;
     if (H5Pset_nbit(dc) < 0)
-        FAIL_STACK_ERROR
+        goto error;
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_LLONG_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+        goto error;
 
-    /* Create the dataset */
-    if ((dataset = H5Dcreate2(file, DSET_NBIT_FLOAT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+    /* Fill every bit of the significant field with random values */
+    mask = (((unsigned long long)1 << precision) - 1) << offset;
+    for (i = 0; i < (size_t)size[0]; i++)
+        orig_data[i] = ((((unsigned long long)HDrandom() << 40) ^ ((unsigned long long)HDrandom() << 20) ^
+                         (unsigned long long)HDrandom())
+                        << offset) &
+                       mask;
+
+    PASSED();
+
+    TESTING("    nbit unsigned long long (write)");
+
+    if (H5Dwrite(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        goto error;
+
+    /* The packed chunk holds 61 bits per value, plus a partial byte */
+    if ((storage_size = H5Dget_storage_size(dataset)) != ((hsize_t)size[0] * precision) / 8 + 1) {
+        H5_FAILED();
+        HDprintf("    Storage size of %llu bytes is incorrect\n", (unsigned long long)storage_size);
+        goto error;
+    }
+    PASSED();
+
+    TESTING("    nbit unsigned long long (read)");
+
+    if (H5Dread(dataset, mem_datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        goto error;
+
+    for (i = 0; i < (size_t)size[0]; i++)
+        if ((new_data[i] & mask) != orig_data[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written.\n");
+            HDprintf("    At index %lu\n", (unsigned long)i);
+            goto error;
+        }
+
+    if (H5Tclose(datatype) < 0)
+        goto error;
+    if (H5Tclose(mem_datatype) < 0)
+        goto error;
+    if (H5Pclose(dc) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Dclose(dataset) < 0)
+        goto error;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(datatype);
+        H5Tclose(mem_datatype);
+        H5Pclose(dc);
+        H5Sclose(space);
+        H5Dclose(dataset);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_nbit_llong() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_float
+ *
+ * Purpose:     Tests the float datatype of nbit filter
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_nbit_float(hid_t file)
+{
+    hid_t         dataset, datatype, space, dc;
+    const hsize_t size[2]       = {2, 5};
+    const hsize_t chunk_size[2] = {2, 5};
+    /* orig_data[] are initialized to be within the range that can be represented by
+     * dataset datatype (no precision loss during datatype conversion)
+     */
+    float  orig_data[2][5] = {{188384.0f, 19.103516f, -1.0831790e9f, -84.242188f, 5.2045898f},
+                             {-49140.0f, 2350.25f, -3.2110596e-1f, 6.4998865e-5f, -0.0f}};
+    float  new_data[2][5];
+    size_t precision, offset;
+    size_t i, j;
+
+    TESTING("    nbit float (setup)");
+
+    /* Define user-defined single-precision floating-point type for dataset */
+    datatype = H5Tcopy(H5T_IEEE_F32BE);
+    if (H5Tset_fields(datatype, (size_t)26, (size_t)20, (size_t)6, (size_t)7, (size_t)13) < 0)
+        FAIL_STACK_ERROR
+    offset = 7;
+    if (H5Tset_offset(datatype, offset) < 0)
+        FAIL_STACK_ERROR
+    precision = 20;
+    if (H5Tset_precision(datatype, precision) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_size(datatype, (size_t)4) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tset_ebias(datatype, (size_t)31) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the data space */
+    if ((space = H5Screate_simple(2, size, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Use nbit filter  */
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_nbit(dc) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the dataset */
+    if ((dataset = H5Dcreate2(file, DSET_NBIT_FLOAT_NAME, datatype, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
         FAIL_STACK_ERROR
     PASSED();
 
@@ -5636,125 +6221,445 @@ error:
 } /* end test_scaleoffset_double_2() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_multiopen
+ * Function:    test_lz
  *
- * Purpose:     Tests that a bug no longer exists.  If a dataset is opened
- *              twice and one of the handles is used to extend the dataset,
- *              then the other handle should return the new size when
- *              queried.
+ * Purpose:     Tests the LZ filter on data that spans several of its
+ *              blocks, mixing compressible and incompressible blocks and
+ *              compressed with several filter threads, and on a chunk too
+ *              small to hold a match.
  *
- * Return:      Success:    0
- *
- *              Failure:    -1
+ * Return:      Success:        0
  *
- * Programmer:  Robb Matzke
- *              Tuesday, June  9, 1998
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_multiopen(hid_t file)
+test_lz(hid_t file)
 {
-    hid_t          dcpl = -1, space = -1, dset1 = -1, dset2 = -1;
-    hsize_t        cur_size[1] = {10};
-    hsize_t        tmp_size[1];
-    static hsize_t max_size[1] = {H5S_UNLIMITED};
+    hid_t          dataset = -1, space = -1, dc = -1, dxpl = -1;
+    const hsize_t  size[1]       = {300000};
+    const hsize_t  small_size[1] = {7};
+    unsigned char *orig_data     = NULL;
+    unsigned char *new_data      = NULL;
+    hsize_t        storage_size;
+    unsigned       nthreads;
+    size_t         cd_nelmts = 1;
+    unsigned       cd_values[1];
+    unsigned       filter_flags;
+    herr_t         status;
+    size_t         i;
 
-    TESTING("multi-open with extending");
+    TESTING("LZ filter (multiple blocks)");
 
-    /* Create the dataset and open it twice */
-    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        goto error;
-    if (H5Pset_chunk(dcpl, 1, cur_size) < 0)
-        goto error;
-    if ((space = H5Screate_simple(1, cur_size, max_size)) < 0)
-        goto error;
-    if ((dset1 = H5Dcreate2(file, "multiopen", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        goto error;
-    if ((dset2 = H5Dopen2(dset1, ".", H5P_DEFAULT)) < 0)
-        goto error;
-    if (H5Sclose(space) < 0)
-        goto error;
+    if (NULL == (orig_data = (unsigned char *)HDmalloc((size_t)size[0])))
+        TEST_ERROR
+    if (NULL == (new_data = (unsigned char *)HDcalloc(1, (size_t)size[0])))
+        TEST_ERROR
 
-    /* Extend with the first handle */
-    cur_size[0] = 20;
-    if (H5Dset_extent(dset1, cur_size) < 0)
-        goto error;
+    /* Short repeats, incompressible data, a long run and overlapping
+     * matches, with the block boundaries falling inside each of them
+     */
+    for (i = 0; i < 70000; i++)
+        orig_data[i] = (unsigned char)("abcdefghijklmnopqrstuvwxyz0123456789"[(i / 3) % 36] + (i % 7 == 0));
+    for (; i < 140000; i++)
+        orig_data[i] = (unsigned char)HDrandom();
+    for (; i < 230000; i++)
+        orig_data[i] = 0;
+    for (; i < (size_t)size[0]; i++)
+        orig_data[i] = (unsigned char)((i % 3) + (i / 1000));
 
-    /* Get the size from the second handle */
-    if ((space = H5Dget_space(dset2)) < 0)
-        goto error;
-    if (H5Sget_simple_extent_dims(space, tmp_size, NULL) < 0)
-        goto error;
-    if (cur_size[0] != tmp_size[0]) {
-        H5_FAILED();
-        HDprintf("    Got %d instead of %d!\n", (int)tmp_size[0], (int)cur_size[0]);
-        goto error;
-    } /* end if */
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        TEST_ERROR
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dc, 1, size) < 0)
+        TEST_ERROR
+    if (H5Pset_lz(dc) < 0)
+        TEST_ERROR
 
-    if (H5Dclose(dset1) < 0)
-        goto error;
-    if (H5Dclose(dset2) < 0)
-        goto error;
+    /* The filter has no parameters to store in the file */
+    if (H5Pget_filter_by_id2(dc, H5Z_FILTER_LZ, &filter_flags, &cd_nelmts, cd_values, (size_t)0, NULL,
+                             NULL) < 0)
+        TEST_ERROR
+    if (cd_nelmts != 0 || !(filter_flags & H5Z_FLAG_OPTIONAL))
+        FAIL_PUTS_ERROR("    LZ filter parameters are incorrect.")
+
+    /* Check the default number of filter threads and argument checking */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 1)
+        FAIL_PUTS_ERROR("    Default number of filter threads is incorrect.")
+    H5E_BEGIN_TRY
+    {
+        status = H5Pset_filter_nthreads(dxpl, 0);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        FAIL_PUTS_ERROR("    Zero filter threads was accepted.")
+
+    /* Compress the blocks with several threads, where available */
+    if (H5Pset_filter_nthreads(dxpl, 3) < 0)
+        TEST_ERROR
+    if (H5Pget_filter_nthreads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 3)
+        FAIL_PUTS_ERROR("    Number of filter threads is incorrect.")
+
+    if ((dataset = H5Dcreate2(file, DSET_LZ_BLOCKS_NAME, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, dxpl, orig_data) < 0)
+        TEST_ERROR
+
+    /* The data should compress, but not by more than the random part allows */
+    storage_size = H5Dget_storage_size(dataset);
+    if (storage_size >= size[0] || storage_size < 70000)
+        FAIL_PUTS_ERROR("    Size after LZ compression is incorrect.")
+
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    for (i = 0; i < (size_t)size[0]; i++)
+        if (new_data[i] != orig_data[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written.\n");
+            HDprintf("    At index %lu\n", (unsigned long)i);
+            goto error;
+        } /* end if */
+
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
     if (H5Sclose(space) < 0)
-        goto error;
-    if (H5Pclose(dcpl) < 0)
-        goto error;
+        TEST_ERROR
+
+    /* A chunk too small to hold a match */
+    if ((space = H5Screate_simple(1, small_size, NULL)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dc, 1, small_size) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, DSET_LZ_SMALL_NAME, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        TEST_ERROR
+    HDmemset(new_data, 0, (size_t)small_size[0]);
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(new_data, orig_data, (size_t)small_size[0]) != 0)
+        FAIL_PUTS_ERROR("    Read different values than written.")
+
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Pclose(dc) < 0)
+        TEST_ERROR
+
+    HDfree(orig_data);
+    HDfree(new_data);
 
     PASSED();
+
     return SUCCEED;
 
 error:
     H5E_BEGIN_TRY
     {
-        H5Dclose(dset1);
-        H5Dclose(dset2);
+        H5Dclose(dataset);
         H5Sclose(space);
-        H5Pclose(dcpl);
+        H5Pclose(dxpl);
+        H5Pclose(dc);
     }
     H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+
     return FAIL;
-} /* end test_multiopen() */
+} /* end test_lz() */
 
 /*-------------------------------------------------------------------------
- * Function:    test_types
+ * Function:    test_filter_min_ratio
  *
- * Purpose:    Make some datasets with various types so we can test h5ls.
- *
- * Return:    Success:    0
- *
- *        Failure:    -1
- *
- * Programmer:    Robb Matzke
- *              Monday, June  7, 1999
+ * Purpose:     Tests that chunks which don't compress well enough are
+ *              stored uncompressed when a minimum compression ratio is
+ *              set, with the compression filters skipped in their filter
+ *              masks and a checksum filter still applied.
  *
+ * Return:      Success:        0
+ *              Failure:        -1
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_types(hid_t file)
+test_filter_min_ratio(hid_t file)
 {
-    hid_t         grp = -1, type = -1, space = -1, dset = -1;
-    size_t        i;
-    hsize_t       nelmts;
-    unsigned char buf[32];
+    hid_t          dataset = -1, space = -1, dc = -1;
+    const hsize_t  chunk_size[1] = {8192};
+    const hsize_t  size[1]       = {4 * 8192};
+    unsigned char *orig_data     = NULL;
+    unsigned char *new_data      = NULL;
+    hsize_t        offset[1];
+    hsize_t        chunk_nbytes;
+    haddr_t        addr;
+    unsigned       filter_mask;
+    double         min_ratio;
+    herr_t         status;
+    hsize_t        u;
+    size_t         i;
 
-    TESTING("various datatypes");
-    if ((grp = H5Gcreate2(file, "typetests", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
-        goto error;
+    TESTING("storing incompressible chunks unfiltered");
 
-    /* bitfield_1 */
-    nelmts = sizeof(buf);
-    if ((type = H5Tcopy(H5T_STD_B8LE)) < 0 || (space = H5Screate_simple(1, &nelmts, NULL)) < 0 ||
-        (dset = H5Dcreate2(grp, "bitfield_1", type, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
-        goto error;
-    for (i = 0; i < sizeof buf; i++)
-        buf[i] = (unsigned char)(0xff ^ i);
-    if (H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
-        goto error;
+    if (NULL == (orig_data = (unsigned char *)HDmalloc((size_t)size[0])))
+        TEST_ERROR
+    if (NULL == (new_data = (unsigned char *)HDcalloc(1, (size_t)size[0])))
+        TEST_ERROR
 
-    if (H5Sclose(space) < 0)
-        goto error;
-    if (H5Tclose(type) < 0)
+    /* Odd chunks are random, even chunks are easily compressed */
+    for (i = 0; i < (size_t)size[0]; i++)
+        orig_data[i] = (unsigned char)(((i / chunk_size[0]) % 2) ? HDrandom() : (int)(i % 5));
+
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+
+    /* Check the default and argument checking */
+    if (H5Pget_filter_min_ratio(dc, &min_ratio) < 0)
+        TEST_ERROR
+    if (min_ratio != 0.0)
+        FAIL_PUTS_ERROR("    Default minimum ratio is incorrect.")
+    H5E_BEGIN_TRY
+    {
+        status = H5Pset_filter_min_ratio(dc, -1.0);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        FAIL_PUTS_ERROR("    Negative minimum ratio was accepted.")
+
+    if (H5Pset_filter_min_ratio(dc, 1.1) < 0)
+        TEST_ERROR
+    if (H5Pget_filter_min_ratio(dc, &min_ratio) < 0)
+        TEST_ERROR
+    if (min_ratio != 1.1)
+        FAIL_PUTS_ERROR("    Minimum ratio is incorrect.")
+
+    if (H5Pset_chunk(dc, 1, chunk_size) < 0)
+        TEST_ERROR
+    if (H5Pset_shuffle(dc) < 0)
+        TEST_ERROR
+    if (H5Pset_lz(dc) < 0)
+        TEST_ERROR
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, DSET_MIN_RATIO_NAME, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+
+    /* Check how each chunk was stored */
+    if ((dataset = H5Dopen2(file, DSET_MIN_RATIO_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < size[0] / chunk_size[0]; u++) {
+        if (H5Dget_chunk_info(dataset, H5S_ALL, u, offset, &filter_mask, &addr, &chunk_nbytes) < 0)
+            TEST_ERROR
+        if ((offset[0] / chunk_size[0]) % 2) {
+            if (filter_mask != 0x3 || chunk_nbytes != chunk_size[0])
+                FAIL_PUTS_ERROR("    Incompressible chunk was stored filtered.")
+        } /* end if */
+        else if (filter_mask != 0 || chunk_nbytes >= chunk_size[0])
+            FAIL_PUTS_ERROR("    Compressible chunk was stored unfiltered.")
+    } /* end for */
+
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(new_data, orig_data, (size_t)size[0]) != 0)
+        FAIL_PUTS_ERROR("    Read different values than written.")
+
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+
+    /* The checksum must still be computed for chunks stored uncompressed */
+    if (H5Pset_fletcher32(dc) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, DSET_MIN_RATIO_EDC_NAME, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+
+    if ((dataset = H5Dopen2(file, DSET_MIN_RATIO_EDC_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (u = 0; u < size[0] / chunk_size[0]; u++) {
+        if (H5Dget_chunk_info(dataset, H5S_ALL, u, offset, &filter_mask, &addr, &chunk_nbytes) < 0)
+            TEST_ERROR
+        if ((offset[0] / chunk_size[0]) % 2) {
+            if (filter_mask != 0x3 || chunk_nbytes != chunk_size[0] + 4)
+                FAIL_PUTS_ERROR("    Incompressible chunk was stored without its checksum.")
+        } /* end if */
+        else if (filter_mask != 0 || chunk_nbytes >= chunk_size[0])
+            FAIL_PUTS_ERROR("    Compressible chunk was stored unfiltered.")
+    } /* end for */
+
+    HDmemset(new_data, 0, (size_t)size[0]);
+    if (H5Dread(dataset, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(new_data, orig_data, (size_t)size[0]) != 0)
+        FAIL_PUTS_ERROR("    Read different values than written.")
+
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    if (H5Pclose(dc) < 0)
+        TEST_ERROR
+
+    HDfree(orig_data);
+    HDfree(new_data);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Sclose(space);
+        H5Pclose(dc);
+    }
+    H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+
+    return FAIL;
+} /* end test_filter_min_ratio() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multiopen
+ *
+ * Purpose:     Tests that a bug no longer exists.  If a dataset is opened
+ *              twice and one of the handles is used to extend the dataset,
+ *              then the other handle should return the new size when
+ *              queried.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    -1
+ *
+ * Programmer:  Robb Matzke
+ *              Tuesday, June  9, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multiopen(hid_t file)
+{
+    hid_t          dcpl = -1, space = -1, dset1 = -1, dset2 = -1;
+    hsize_t        cur_size[1] = {10};
+    hsize_t        tmp_size[1];
+    static hsize_t max_size[1] = {H5S_UNLIMITED};
+
+    TESTING("multi-open with extending");
+
+    /* Create the dataset and open it twice */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, cur_size) < 0)
+        goto error;
+    if ((space = H5Screate_simple(1, cur_size, max_size)) < 0)
+        goto error;
+    if ((dset1 = H5Dcreate2(file, "multiopen", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if ((dset2 = H5Dopen2(dset1, ".", H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+
+    /* Extend with the first handle */
+    cur_size[0] = 20;
+    if (H5Dset_extent(dset1, cur_size) < 0)
+        goto error;
+
+    /* Get the size from the second handle */
+    if ((space = H5Dget_space(dset2)) < 0)
+        goto error;
+    if (H5Sget_simple_extent_dims(space, tmp_size, NULL) < 0)
+        goto error;
+    if (cur_size[0] != tmp_size[0]) {
+        H5_FAILED();
+        HDprintf("    Got %d instead of %d!\n", (int)tmp_size[0], (int)cur_size[0]);
+        goto error;
+    } /* end if */
+
+    if (H5Dclose(dset1) < 0)
+        goto error;
+    if (H5Dclose(dset2) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset1);
+        H5Dclose(dset2);
+        H5Sclose(space);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_multiopen() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_types
+ *
+ * Purpose:    Make some datasets with various types so we can test h5ls.
+ *
+ * Return:    Success:    0
+ *
+ *        Failure:    -1
+ *
+ * Programmer:    Robb Matzke
+ *              Monday, June  7, 1999
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_types(hid_t file)
+{
+    hid_t         grp = -1, type = -1, space = -1, dset = -1;
+    size_t        i;
+    hsize_t       nelmts;
+    unsigned char buf[32];
+
+    TESTING("various datatypes");
+    if ((grp = H5Gcreate2(file, "typetests", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+
+    /* bitfield_1 */
+    nelmts = sizeof(buf);
+    if ((type = H5Tcopy(H5T_STD_B8LE)) < 0 || (space = H5Screate_simple(1, &nelmts, NULL)) < 0 ||
+        (dset = H5Dcreate2(grp, "bitfield_1", type, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    for (i = 0; i < sizeof buf; i++)
+        buf[i] = (unsigned char)(0xff ^ i);
+    if (H5Dwrite(dset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Tclose(type) < 0)
         goto error;
     if (H5Dclose(dset) < 0)
         goto error;
@@ -13188,6 +14093,1181 @@ error:
     return FAIL;
 } /* end test_power2up() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_map_reuse
+ *
+ * Purpose:     Tests that repeated I/O on a chunked dataset with the same
+ *              selections, which reuses the chunk mapping the dataset
+ *              kept from the first I/O, still transfers the right data,
+ *              and that selections which differ only in their position
+ *              or point order, or a change to the dataset's extent,
+ *              don't reuse a mapping which doesn't apply.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MAP_REUSE_DIM0  20
+#define MAP_REUSE_DIM1  20
+#define MAP_REUSE_CHUNK 4
+static herr_t
+test_chunk_map_reuse(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid           = -1;                                 /* File ID */
+    hid_t    dcpl          = -1;                                 /* Dataset creation property list */
+    hid_t    fsid          = -1;                                 /* File dataspace ID */
+    hid_t    msid          = -1;                                 /* Memory dataspace ID */
+    hid_t    did           = -1;                                 /* Dataset ID */
+    hsize_t  dims[2]       = {MAP_REUSE_DIM0, MAP_REUSE_DIM1};   /* Dataset dimension sizes */
+    hsize_t  max_dims[2]   = {H5S_UNLIMITED, MAP_REUSE_DIM1};    /* Maximum dimension sizes */
+    hsize_t  chunk_dims[2] = {MAP_REUSE_CHUNK, MAP_REUSE_CHUNK}; /* Chunk dimensions */
+    hsize_t  pdims[1]      = {2};                                /* Memory dimensions for coords */
+    hsize_t  coords[2][2]  = {{1, 5}, {13, 17}};                 /* Coordinates of coords */
+    hsize_t  start[2];                                           /* Hyperslab start */
+    hsize_t  count[2];                                           /* Hyperslab count */
+    hssize_t offset[2];                                          /* Selection offset */
+    int      fill = -1;                                          /* Fill value */
+    int      wbuf[MAP_REUSE_DIM0 + 4][MAP_REUSE_DIM1];           /* Buffer for writing */
+    int      rbuf[MAP_REUSE_DIM0 + 4][MAP_REUSE_DIM1];           /* Buffer for reading */
+    int      expect[MAP_REUSE_DIM0 + 4][MAP_REUSE_DIM1];         /* Expected data */
+    int      pbuf[2];                                            /* Buffer for reading coords */
+    int      i, j, n;                                            /* Local index variables */
+
+    TESTING("reuse of chunk mappings for repeated I/O");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        FAIL_STACK_ERROR
+    if ((fsid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, fsid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < MAP_REUSE_DIM0 + 4; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            expect[i][j] = -1;
+
+    /* Write the same two-row "halo" several times, with new data each time */
+    start[0] = 1;
+    start[1] = 0;
+    count[0] = 2;
+    count[1] = MAP_REUSE_DIM1;
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    for (n = 0; n < 3; n++) {
+        for (i = 0; i < MAP_REUSE_DIM0; i++)
+            for (j = 0; j < MAP_REUSE_DIM1; j++)
+                wbuf[i][j] = n * 1000 + i * MAP_REUSE_DIM1 + j;
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    for (i = 1; i < 3; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            expect[i][j] = wbuf[i][j];
+
+    /* Write a selection of the same shape at another place in the file */
+    start[0] = 6;
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    for (i = 6; i < 8; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            expect[i][j] = wbuf[i - 5][j];
+    if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the same selection again, moved by the dataspace's offset */
+    offset[0] = 5;
+    offset[1] = 0;
+    if (H5Soffset_simple(fsid, offset) < 0)
+        FAIL_STACK_ERROR
+    for (i = 11; i < 13; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            expect[i][j] = wbuf[i - 10][j];
+    if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 0;
+    if (H5Soffset_simple(fsid, offset) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the last file selection from another place in memory */
+    start[0] = 14;
+    if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    for (i = 6; i < 8; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            expect[i][j] = wbuf[i + 8][j];
+    if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read the whole dataset back, twice */
+    for (n = 0; n < 2; n++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < MAP_REUSE_DIM0; i++)
+            for (j = 0; j < MAP_REUSE_DIM1; j++)
+                if (rbuf[i][j] != expect[i][j]) {
+                    H5_FAILED();
+                    HDprintf("    rbuf[%d][%d] = %d, expected %d\n", i, j, rbuf[i][j], expect[i][j]);
+                    goto error;
+                } /* end if */
+    }             /* end for */
+
+    /* Read the same coords, in both orders */
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(1, pdims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)2, (const hsize_t *)coords) < 0)
+        FAIL_STACK_ERROR
+    for (n = 0; n < 2; n++) {
+        if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, pbuf) < 0)
+            FAIL_STACK_ERROR
+        if (pbuf[0] != expect[coords[0][0]][coords[0][1]] || pbuf[1] != expect[coords[1][0]][coords[1][1]])
+            TEST_ERROR
+    } /* end for */
+    coords[0][0] = 13;
+    coords[0][1] = 17;
+    coords[1][0] = 1;
+    coords[1][1] = 5;
+    if (H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)2, (const hsize_t *)coords) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, pbuf) < 0)
+        FAIL_STACK_ERROR
+    if (pbuf[0] != expect[coords[0][0]][coords[0][1]] || pbuf[1] != expect[coords[1][0]][coords[1][1]])
+        TEST_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(fsid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Extend the dataset, which changes the chunks' indices, and read it all back again */
+    dims[0] += 4;
+    if (H5Dset_extent(did, dims) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < MAP_REUSE_DIM0 + 4; i++)
+        for (j = 0; j < MAP_REUSE_DIM1; j++)
+            if (rbuf[i][j] != expect[i][j]) {
+                H5_FAILED();
+                HDprintf("    rbuf[%d][%d] = %d, expected %d\n", i, j, rbuf[i][j], expect[i][j]);
+                goto error;
+            } /* end if */
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(msid);
+        H5Sclose(fsid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_map_reuse() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_read_write_multi
+ *
+ * Purpose:     Tests H5Dwrite_multi and H5Dread_multi on datasets with
+ *              different layouts, selections and files, including a
+ *              dataset listed twice, a datatype conversion and data left
+ *              in a dataset's sieve buffer by single-dataset I/O.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NELMTS 64
+#define MULTI_NDSETS 6
+#define MULTI_NIO    7
+static herr_t
+test_read_write_multi(hid_t fapl)
+{
+    char         filename[FILENAME_BUF_SIZE];
+    char         filename2[FILENAME_BUF_SIZE];
+    hid_t        fid         = -1;                   /* File ID */
+    hid_t        fid2        = -1;                   /* Second file ID */
+    hid_t        dcpl        = -1;                   /* Dataset creation property list */
+    hid_t        sid         = -1;                   /* Dataspace ID */
+    hid_t        strided_sid = -1;                   /* Dataspace ID for every other element */
+    hid_t        points_sid  = -1;                   /* Dataspace ID for a few elements */
+    hid_t        did[MULTI_NDSETS];                  /* Dataset IDs */
+    hid_t        io_did[MULTI_NIO];                  /* Dataset IDs for each I/O */
+    hid_t        mem_tid[MULTI_NIO];                 /* Memory datatype IDs for each I/O */
+    hid_t        mem_sid[MULTI_NIO];                 /* Memory dataspace IDs for each I/O */
+    hid_t        file_sid[MULTI_NIO];                /* File dataspace IDs for each I/O */
+    const void * wbufs[MULTI_NIO];                   /* Buffers for each write */
+    void *       rbufs[MULTI_NIO];                   /* Buffers for each read */
+    hsize_t      dims[1]     = {MULTI_NELMTS};       /* Dataset dimensions */
+    hsize_t      chunk[1]    = {16};                 /* Chunk dimensions */
+    hsize_t      start[1]    = {0};                  /* Hyperslab start */
+    hsize_t      stride[1]   = {2};                  /* Hyperslab stride */
+    hsize_t      count[1]    = {MULTI_NELMTS / 2};   /* Hyperslab count */
+    hsize_t      coords[3]   = {3, 10, 40};          /* Coordinates of the few elements */
+    int          wbuf[MULTI_NDSETS][MULTI_NELMTS];   /* Buffers for writing */
+    int          rbuf[MULTI_NDSETS][MULTI_NELMTS];   /* Buffers for reading */
+    int          expect[MULTI_NDSETS][MULTI_NELMTS]; /* Expected data */
+    short        sbuf[MULTI_NELMTS];                 /* Buffer for writing with conversion */
+    int          pbuf[3]     = {-1, -2, -3};         /* Buffer for the few elements */
+    int          odd[MULTI_NELMTS / 2];              /* Buffer for reading the odd elements */
+    int          val;                                /* Value to write */
+    int          i, u;                               /* Local index variables */
+
+    TESTING("H5Dread_multi and H5Dwrite_multi");
+
+    for (u = 0; u < MULTI_NDSETS; u++)
+        did[u] = -1;
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+    h5_fixname(FILENAME[31], fapl, filename2, sizeof filename2);
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((fid2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create datasets with each layout, and one in another file */
+    if ((did[0] = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((did[1] = H5Dcreate2(fid, "strided", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR
+    if ((did[2] = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_layout(dcpl, H5D_COMPACT) < 0)
+        FAIL_STACK_ERROR
+    if ((did[3] = H5Dcreate2(fid, "compact", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if ((did[4] = H5Dcreate2(fid, "convert", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((did[5] = H5Dcreate2(fid2, "other", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    if ((strided_sid = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(strided_sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if ((points_sid = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_elements(points_sid, H5S_SELECT_SET, (size_t)3, coords) < 0)
+        FAIL_STACK_ERROR
+
+    /* Leave data for the first dataset in its sieve buffer */
+    for (i = 0; i < MULTI_NELMTS; i++)
+        wbuf[0][i] = -5;
+    if (H5Dwrite(did[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[0]) < 0)
+        FAIL_STACK_ERROR
+
+    for (u = 0, val = 0; u < MULTI_NDSETS; u++)
+        for (i = 0; i < MULTI_NELMTS; i++, val++) {
+            wbuf[u][i]   = val;
+            expect[u][i] = val;
+        } /* end for */
+    for (i = 0; i < MULTI_NELMTS; i++) {
+        sbuf[i]      = (short)(i * 3);
+        expect[4][i] = i * 3;
+        expect[1][i] = (i % 2) ? 0 : wbuf[1][i / 2];
+    } /* end for */
+    for (i = 0; i < 3; i++)
+        expect[0][coords[i]] = pbuf[i];
+
+    /* Write the datasets, with the first one listed again for a few elements */
+    for (u = 0; u < MULTI_NIO; u++) {
+        io_did[u]   = did[u < 5 ? u : (u == 5 ? 0 : 5)];
+        mem_tid[u]  = H5T_NATIVE_INT;
+        mem_sid[u]  = H5S_ALL;
+        file_sid[u] = H5S_ALL;
+        wbufs[u]    = wbuf[u < 5 ? u : 5];
+    } /* end for */
+    mem_sid[1]  = H5S_BLOCK;
+    file_sid[1] = strided_sid;
+    mem_tid[4]  = H5T_NATIVE_SHORT;
+    wbufs[4]    = sbuf;
+    mem_sid[5]  = H5S_BLOCK;
+    file_sid[5] = points_sid;
+    wbufs[5]    = pbuf;
+    if (H5Dwrite_multi((size_t)MULTI_NIO, io_did, mem_tid, mem_sid, file_sid, H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+
+    /* Leave data for the second dataset in its sieve buffer */
+    val      = 777;
+    start[0] = 1;
+    count[0] = 1;
+    if (H5Sselect_hyperslab(strided_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did[1], H5T_NATIVE_INT, H5S_BLOCK, strided_sid, H5P_DEFAULT, &val) < 0)
+        FAIL_STACK_ERROR
+    expect[1][1] = val;
+
+    /* Read all the datasets back, and the odd elements of the second one */
+    start[0] = 1;
+    count[0] = MULTI_NELMTS / 2;
+    if (H5Sselect_hyperslab(strided_sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    HDmemset(odd, 0, sizeof(odd));
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        io_did[u]   = did[u];
+        mem_tid[u]  = H5T_NATIVE_INT;
+        mem_sid[u]  = H5S_ALL;
+        file_sid[u] = H5S_ALL;
+        rbufs[u]    = rbuf[u];
+    } /* end for */
+    io_did[MULTI_NDSETS]   = did[1];
+    mem_tid[MULTI_NDSETS]  = H5T_NATIVE_INT;
+    mem_sid[MULTI_NDSETS]  = H5S_BLOCK;
+    file_sid[MULTI_NDSETS] = strided_sid;
+    rbufs[MULTI_NDSETS]    = odd;
+    if (H5Dread_multi((size_t)MULTI_NIO, io_did, mem_tid, mem_sid, file_sid, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < MULTI_NDSETS; u++)
+        for (i = 0; i < MULTI_NELMTS; i++)
+            if (rbuf[u][i] != expect[u][i]) {
+                H5_FAILED();
+                HDprintf("    dataset %d: rbuf[%d] = %d, expected %d\n", u, i, rbuf[u][i], expect[u][i]);
+                goto error;
+            } /* end if */
+    for (i = 0; i < MULTI_NELMTS / 2; i++)
+        if (odd[i] != expect[1][2 * i + 1])
+            TEST_ERROR
+
+    /* An empty list does nothing, but missing arrays are an error */
+    if (H5Dread_multi((size_t)0, NULL, NULL, NULL, NULL, H5P_DEFAULT, NULL) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Dread_multi((size_t)MULTI_NIO, NULL, mem_tid, mem_sid, file_sid, H5P_DEFAULT, rbufs) >= 0)
+            TEST_ERROR
+    }
+    H5E_END_TRY;
+
+    /* Check that the data written made it to the file */
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        if (H5Dclose(did[u]) < 0)
+            FAIL_STACK_ERROR
+        did[u] = -1;
+    } /* end for */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((did[0] = H5Dopen2(fid, "contig", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(did[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[0]) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < MULTI_NELMTS; i++)
+        if (rbuf[0][i] != expect[0][i])
+            TEST_ERROR
+    if (H5Dclose(did[0]) < 0)
+        FAIL_STACK_ERROR
+    did[0] = -1;
+
+    if (H5Sclose(points_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(strided_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid2) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < MULTI_NDSETS; u++)
+            H5Dclose(did[u]);
+        H5Sclose(points_sid);
+        H5Sclose(strided_sid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid2);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_read_write_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_sieve_windows
+ *
+ * Purpose:     Tests that small I/O alternating between two distant parts
+ *              of a contiguous dataset gets a data sieve window for each
+ *              part, that sequential I/O drops back to a single window,
+ *              and that data written through several windows is correct
+ *              in memory and in the file.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SIEVE_WIN_NELMTS   (2 * 1024 * 1024)
+#define SIEVE_WIN_BUF_SIZE (64 * 1024)
+#define SIEVE_WIN_PIECE    10
+#define SIEVE_WIN_SCAN     1024
+static herr_t
+test_sieve_windows(hid_t fapl)
+{
+    char          filename[FILENAME_BUF_SIZE];
+    hid_t         fid       = -1;                 /* File ID */
+    hid_t         my_fapl   = -1;                 /* File access property list */
+    hid_t         sid       = -1;                 /* Dataspace ID */
+    hid_t         msid      = -1;                 /* Memory dataspace ID for small pieces */
+    hid_t         scan_sid  = -1;                 /* Memory dataspace ID for scanning */
+    hid_t         did       = -1;                 /* Dataset ID */
+    hsize_t       dims[1]   = {SIEVE_WIN_NELMTS}; /* Dataset dimensions */
+    hsize_t       start[1]  = {0};                /* Hyperslab start */
+    hsize_t       count[1]  = {SIEVE_WIN_PIECE};  /* Hyperslab count */
+    hsize_t       scan[1]   = {SIEVE_WIN_SCAN};   /* Hyperslab count for scanning */
+    unsigned long drv_flags = 0;                  /* File driver feature flags */
+    hbool_t       check_wins;                     /* Whether the driver sieves data */
+    unsigned      nwins, max_nwins;               /* Number of sieve windows */
+    int *         expect = NULL;                  /* Expected data */
+    int *         rbuf   = NULL;                  /* Buffer for reading */
+    int           piece[SIEVE_WIN_PIECE];         /* Buffer for small pieces */
+    int           i, j, k, pass;                  /* Local index variables */
+
+    TESTING("data sieve windows for interleaved I/O");
+
+    h5_fixname(FILENAME[32], fapl, filename, sizeof filename);
+
+    /* Use a known sieve buffer size */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_sieve_buf_size(my_fapl, (size_t)SIEVE_WIN_BUF_SIZE) < 0)
+        FAIL_STACK_ERROR
+
+    /* Only drivers that sieve raw data have windows to check */
+    if (H5FDdriver_query(H5Pget_driver(my_fapl), &drv_flags) < 0)
+        FAIL_STACK_ERROR
+    check_wins = (drv_flags & H5FD_FEAT_DATA_SIEVE) ? TRUE : FALSE;
+
+    if (NULL == (expect = (int *)HDmalloc(SIEVE_WIN_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(SIEVE_WIN_NELMTS * sizeof(int))))
+        TEST_ERROR
+    for (i = 0; i < SIEVE_WIN_NELMTS; i++)
+        expect[i] = i;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((scan_sid = H5Screate_simple(1, scan, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expect) < 0)
+        FAIL_STACK_ERROR
+
+    /* Start over with no sieve windows */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read small pieces from the start and the middle of the dataset in turn */
+    for (i = 0; i < 100; i++)
+        for (j = 0; j < 2; j++) {
+            start[0] = (hsize_t)(j * (SIEVE_WIN_NELMTS / 2) + i * SIEVE_WIN_PIECE);
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, piece) < 0)
+                FAIL_STACK_ERROR
+            for (k = 0; k < SIEVE_WIN_PIECE; k++)
+                if (piece[k] != expect[start[0] + (hsize_t)k])
+                    FAIL_PUTS_ERROR("    Incorrect data read from interleaved pieces.")
+        } /* end for */
+
+    if (check_wins) {
+        if (H5D__sieve_nwins_test(did, &nwins, &max_nwins) < 0)
+            FAIL_STACK_ERROR
+        if (nwins != 2 || max_nwins != 2)
+            FAIL_PUTS_ERROR("    Interleaved reads didn't use two sieve windows.")
+    } /* end if */
+
+    /* Write small pieces to both parts in turn, straddling the pieces read */
+    for (i = 0; i < 100; i++)
+        for (j = 0; j < 2; j++) {
+            start[0] = (hsize_t)(j * (SIEVE_WIN_NELMTS / 2) + i * SIEVE_WIN_PIECE + 5);
+            for (k = 0; k < SIEVE_WIN_PIECE; k++) {
+                piece[k]                      = -(int)(start[0] + (hsize_t)k);
+                expect[start[0] + (hsize_t)k] = piece[k];
+            } /* end for */
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, piece) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+    /* Read the whole dataset, which is too large for the sieve windows */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(rbuf, expect, SIEVE_WIN_NELMTS * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("    Incorrect data after interleaved writes.")
+
+    /* Scan the dataset sequentially, twice */
+    for (pass = 0; pass < 2; pass++) {
+        HDmemset(rbuf, 0, SIEVE_WIN_NELMTS * sizeof(int));
+        for (i = 0; i < SIEVE_WIN_NELMTS; i += SIEVE_WIN_SCAN) {
+            start[0] = (hsize_t)i;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, scan, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(did, H5T_NATIVE_INT, scan_sid, sid, H5P_DEFAULT, rbuf + i) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+        if (HDmemcmp(rbuf, expect, SIEVE_WIN_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("    Incorrect data from sequential scan.")
+    } /* end for */
+
+    if (check_wins) {
+        if (H5D__sieve_nwins_test(did, &nwins, &max_nwins) < 0)
+            FAIL_STACK_ERROR
+        if (nwins != 1 || max_nwins != 1)
+            FAIL_PUTS_ERROR("    Sequential reads didn't drop back to one sieve window.")
+    } /* end if */
+
+    /* Check the data written through the windows made it to the file */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, SIEVE_WIN_NELMTS * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(rbuf, expect, SIEVE_WIN_NELMTS * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("    Incorrect data after reopening the file.")
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(scan_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+    HDfree(rbuf);
+    HDfree(expect);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(scan_sid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    HDfree(rbuf);
+    HDfree(expect);
+    return FAIL;
+} /* end test_sieve_windows() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_create_multi
+ *
+ * Purpose:     Tests H5Dcreate_multi and H5Gcreate_multi: the objects are
+ *              created and linked with the right names and properties,
+ *              their object headers are next to each other in the file,
+ *              groups switch to dense link storage as needed and bad
+ *              names are rejected without creating anything.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CREATE_MULTI_NDSETS  8
+#define CREATE_MULTI_NGROUPS 12
+#define CREATE_MULTI_NELMTS  16
+static herr_t
+test_create_multi(hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    char              dset_names[CREATE_MULTI_NDSETS][16]; /* Dataset names */
+    char              grp_names[CREATE_MULTI_NGROUPS][16]; /* Group names */
+    const char *      dname[CREATE_MULTI_NDSETS];          /* Dataset names to create */
+    const char *      gname[CREATE_MULTI_NGROUPS];         /* Group names to create */
+    const char *      bad_name[2];                         /* Names that can't be created */
+    hid_t             fid  = -1;                           /* File ID */
+    hid_t             gid  = -1;                           /* Group ID */
+    hid_t             gcpl = -1;                           /* Group creation property list */
+    hid_t             dcpl = -1;                           /* Dataset creation property list */
+    hid_t             sid  = -1;                           /* Dataspace ID */
+    hid_t             tid[CREATE_MULTI_NDSETS];            /* Datatype IDs */
+    hid_t             sids[CREATE_MULTI_NDSETS];           /* Dataspace IDs */
+    hid_t             dcpls[CREATE_MULTI_NDSETS];          /* Dataset creation property list IDs */
+    hid_t             gcpls[CREATE_MULTI_NGROUPS];         /* Group creation property list IDs */
+    hid_t             did[CREATE_MULTI_NDSETS];            /* Dataset IDs */
+    hid_t             grp_id[CREATE_MULTI_NGROUPS];        /* Group IDs */
+    hsize_t           dims[1]  = {CREATE_MULTI_NELMTS};    /* Dataset dimensions */
+    hsize_t           chunk[1] = {4};                      /* Chunk dimensions */
+    haddr_t           addr[CREATE_MULTI_NDSETS];           /* Object header addresses */
+    hsize_t           hdr_size[CREATE_MULTI_NDSETS];       /* Object header sizes */
+    H5O_info2_t       oinfo;                               /* Object info */
+    H5O_native_info_t ninfo;                               /* Native object info */
+    H5G_info_t        ginfo;                               /* Group info */
+    H5D_layout_t      layout;                              /* Dataset layout */
+    int               wbuf[CREATE_MULTI_NELMTS];           /* Buffer for writing */
+    int               rbuf[CREATE_MULTI_NELMTS];           /* Buffer for reading */
+    char              name[32];                            /* Link path */
+    size_t            u, v;                                /* Local index variables */
+    herr_t            ret;                                 /* Generic return value */
+
+    TESTING("creating several datasets and groups at once");
+
+    h5_fixname(FILENAME[33], fapl, filename, sizeof filename);
+
+    for (u = 0; u < CREATE_MULTI_NELMTS; u++)
+        wbuf[u] = (int)u;
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++)
+        did[u] = -1;
+    for (u = 0; u < CREATE_MULTI_NGROUPS; u++)
+        grp_id[u] = -1;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create datasets in the root group, every other one chunked.  The names
+     * are listed out of order, to check they are linked to the right objects.
+     */
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+        HDsnprintf(dset_names[u], sizeof(dset_names[u]), "dset%02u", (unsigned)(CREATE_MULTI_NDSETS - u));
+        dname[u] = dset_names[u];
+        tid[u]   = (u % 3) ? H5T_NATIVE_INT : H5T_NATIVE_SHORT;
+        sids[u]  = sid;
+        dcpls[u] = (u % 2) ? dcpl : H5P_DEFAULT;
+    } /* end for */
+    if (H5Dcreate_multi(fid, CREATE_MULTI_NDSETS, dname, tid, sids, H5P_DEFAULT, dcpls, H5P_DEFAULT, did) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check the datasets, and find where their object headers are */
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+        hid_t dset_dcpl; /* Dataset's creation property list */
+        hid_t dset_tid;  /* Dataset's datatype */
+
+        if ((dset_dcpl = H5Dget_create_plist(did[u])) < 0)
+            FAIL_STACK_ERROR
+        layout = H5Pget_layout(dset_dcpl);
+        if (H5Pclose(dset_dcpl) < 0)
+            FAIL_STACK_ERROR
+        if (layout != ((u % 2) ? H5D_CHUNKED : H5D_CONTIGUOUS))
+            TEST_ERROR
+        if ((dset_tid = H5Dget_type(did[u])) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tget_size(dset_tid) != H5Tget_size(tid[u]))
+            TEST_ERROR
+        if (H5Tclose(dset_tid) < 0)
+            FAIL_STACK_ERROR
+
+        if (H5Oget_info3(did[u], &oinfo, H5O_INFO_BASIC) < 0)
+            FAIL_STACK_ERROR
+        if (H5VLnative_token_to_addr(fid, oinfo.token, &addr[u]) < 0)
+            FAIL_STACK_ERROR
+        if (H5Oget_native_info(did[u], &ninfo, H5O_NATIVE_INFO_HDR) < 0)
+            FAIL_STACK_ERROR
+        hdr_size[u] = ninfo.hdr.space.total;
+
+        if (H5Dwrite(did[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* The object headers should be one after the other */
+    for (u = 1; u < CREATE_MULTI_NDSETS; u++)
+        if (addr[u] != addr[u - 1] + hdr_size[u - 1])
+            TEST_ERROR
+
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+        if (H5Dclose(did[u]) < 0)
+            FAIL_STACK_ERROR
+        did[u] = -1;
+    } /* end for */
+
+    /* Names that are already linked, repeated or paths can't be created */
+    bad_name[0] = "new_dset";
+    for (v = 0; v < 3; v++) {
+        bad_name[1] = (v == 0) ? dset_names[0] : (v == 1) ? "new_dset" : "a/b";
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dcreate_multi(fid, 2, bad_name, tid, sids, H5P_DEFAULT, dcpls, H5P_DEFAULT, did);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            TEST_ERROR
+        if (H5Lexists(fid, "new_dset", H5P_DEFAULT) != FALSE)
+            TEST_ERROR
+    } /* end for */
+
+    /* Create groups in a group that tracks creation order and switches to
+     * dense link storage, a few at a time and then enough to switch.
+     */
+    if ((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_link_creation_order(gcpl, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_link_phase_change(gcpl, 4, 2) < 0)
+        FAIL_STACK_ERROR
+    if ((gid = H5Gcreate2(fid, "grp", H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < CREATE_MULTI_NGROUPS; u++) {
+        HDsnprintf(grp_names[u], sizeof(grp_names[u]), "g%02u", (unsigned)((u * 7) % CREATE_MULTI_NGROUPS));
+        gname[u] = grp_names[u];
+        gcpls[u] = (u % 2) ? gcpl : H5P_DEFAULT;
+    } /* end for */
+    if (H5Gcreate_multi(gid, 3, gname, H5P_DEFAULT, gcpls, H5P_DEFAULT, grp_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gget_info(gid, &ginfo) < 0)
+        FAIL_STACK_ERROR
+    if (ginfo.nlinks != 3 || ginfo.storage_type != H5G_STORAGE_TYPE_COMPACT)
+        TEST_ERROR
+    if (H5Gcreate_multi(gid, CREATE_MULTI_NGROUPS - 3, &gname[3], H5P_DEFAULT, &gcpls[3], H5P_DEFAULT,
+                        &grp_id[3]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gget_info(gid, &ginfo) < 0)
+        FAIL_STACK_ERROR
+    if (ginfo.nlinks != CREATE_MULTI_NGROUPS || ginfo.storage_type != H5G_STORAGE_TYPE_DENSE)
+        TEST_ERROR
+
+    /* Check the groups were linked in the order they are listed */
+    for (u = 0; u < CREATE_MULTI_NGROUPS; u++) {
+        if (H5Lget_name_by_idx(gid, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)u, name, sizeof(name),
+                               H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if (HDstrcmp(name, grp_names[u]) != 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Check the groups have the right creation properties and can be used */
+    for (u = 0; u < CREATE_MULTI_NGROUPS; u++) {
+        hid_t    grp_gcpl;        /* Group's creation property list */
+        hid_t    inner_did;       /* Dataset in the group */
+        unsigned crt_order_flags; /* Group's creation order flags */
+
+        if ((grp_gcpl = H5Gget_create_plist(grp_id[u])) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pget_link_creation_order(grp_gcpl, &crt_order_flags) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pclose(grp_gcpl) < 0)
+            FAIL_STACK_ERROR
+        if (crt_order_flags != ((u % 2) ? (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) : 0))
+            TEST_ERROR
+
+        if ((inner_did = H5Dcreate2(grp_id[u], "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT,
+                                    H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(inner_did) < 0)
+            FAIL_STACK_ERROR
+        if (H5Gclose(grp_id[u]) < 0)
+            FAIL_STACK_ERROR
+        grp_id[u] = -1;
+    } /* end for */
+
+    /* A repeated group name is rejected */
+    bad_name[0] = "new_grp";
+    bad_name[1] = "new_grp";
+    H5E_BEGIN_TRY
+    {
+        ret = H5Gcreate_multi(gid, 2, bad_name, H5P_DEFAULT, gcpls, H5P_DEFAULT, grp_id);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+    if (H5Gget_info(gid, &ginfo) < 0)
+        FAIL_STACK_ERROR
+    if (ginfo.nlinks != CREATE_MULTI_NGROUPS)
+        TEST_ERROR
+
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and check the objects by name */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+        if ((did[0] = H5Dopen2(fid, dset_names[u], H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if ((tid[0] = H5Dget_type(did[0])) < 0)
+            FAIL_STACK_ERROR
+        if (H5Tget_size(tid[0]) != ((u % 3) ? sizeof(int) : sizeof(short)))
+            TEST_ERROR
+        if (H5Tclose(tid[0]) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(did[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(did[0]) < 0)
+            FAIL_STACK_ERROR
+        for (v = 0; v < CREATE_MULTI_NELMTS; v++)
+            if (rbuf[v] != wbuf[v])
+                TEST_ERROR
+    } /* end for */
+    for (u = 0; u < CREATE_MULTI_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "grp/%s/dset", grp_names[u]);
+        if (H5Lexists(fid, grp_names[u], H5P_DEFAULT) != FALSE)
+            TEST_ERROR
+        if (H5Oexists_by_name(fid, name, H5P_DEFAULT) != TRUE)
+            TEST_ERROR
+    } /* end for */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    if (H5Pclose(gcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < CREATE_MULTI_NDSETS; u++)
+            H5Dclose(did[u]);
+        for (u = 0; u < CREATE_MULTI_NGROUPS; u++)
+            H5Gclose(grp_id[u]);
+        H5Gclose(gid);
+        H5Pclose(gcpl);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_create_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_deflate_reuse
+ *
+ * Purpose:     Tests the zlib streams the deflate filter keeps between
+ *              chunks: chunks written in turn at different compression
+ *              levels are each compressed at their own level, a chunk that
+ *              inflates to more than the expected size is read through the
+ *              output buffer growth path, and corrupt or truncated chunks
+ *              fail to read without upsetting later reads.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define DEFLATE_REUSE_CHUNK   1024
+#define DEFLATE_REUSE_NCHUNKS 4
+#define DEFLATE_REUSE_NLEVELS 3
+static herr_t
+test_deflate_reuse(hid_t fapl)
+{
+#ifdef H5_HAVE_FILTER_DEFLATE
+    char          filename[FILENAME_BUF_SIZE];
+    char          dset_name[16];                                /* Dataset name */
+    const int     level[DEFLATE_REUSE_NLEVELS]  = {1, 6, 9};    /* Compression levels */
+    const uint8_t flevel[DEFLATE_REUSE_NLEVELS] = {0, 2, 3};    /* zlib header level flags */
+    hid_t         fid                           = -1;           /* File ID */
+    hid_t         sid                           = -1;           /* Dataspace ID */
+    hid_t         msid                          = -1;           /* Memory dataspace ID */
+    hid_t         dcpl                          = -1;           /* Dataset creation property list */
+    hid_t         dapl                          = -1;           /* Dataset access property list */
+    hid_t         did[DEFLATE_REUSE_NLEVELS]    = {-1, -1, -1}; /* Dataset IDs */
+    hid_t         big_did                       = -1;           /* Dataset with large chunks */
+    hid_t         grow_did                      = -1;           /* Dataset for the growth test */
+    hid_t         bad_did                       = -1;           /* Dataset with bad chunks */
+    hsize_t       dims[1]                       = {0};          /* Dataset dimensions */
+    hsize_t       cdims[1]                      = {0};          /* Chunk dimensions */
+    hsize_t       start[1]                      = {0};          /* Hyperslab start */
+    hsize_t       count[1]                      = {0};          /* Hyperslab count */
+    hsize_t       offset[1]                     = {0};          /* Chunk offset */
+    hsize_t       nbytes;                                       /* Stored size of a chunk */
+    uint32_t      filter_mask;                                  /* Filter mask of a chunk */
+    int *         expect = NULL;                                /* Expected data */
+    int *         rbuf   = NULL;                                /* Buffer for reading */
+    uint8_t *     raw    = NULL;                                /* Raw chunk data */
+    size_t        u;                                            /* Local index variable */
+    herr_t        ret;                                          /* Generic return value */
+    int           i, j;                                         /* Local index variables */
+
+    TESTING("deflate stream reuse, output growth and bad chunks");
+
+    h5_fixname(FILENAME[34], fapl, filename, sizeof filename);
+
+    dims[0]  = DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK;
+    cdims[0] = DEFLATE_REUSE_CHUNK;
+    count[0] = DEFLATE_REUSE_CHUNK;
+
+    if (NULL == (expect = (int *)HDmalloc(DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (raw = (uint8_t *)HDmalloc(DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK * sizeof(int))))
+        TEST_ERROR
+    for (i = 0; i < DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK; i++)
+        expect[i] = (i % 37) * (i % 11) + i / 64;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((msid = H5Screate_simple(1, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Disable the chunk cache, so each chunk is compressed as it's written */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, 1.0) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a dataset for each compression level */
+    for (j = 0; j < DEFLATE_REUSE_NLEVELS; j++) {
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_deflate(dcpl, (unsigned)level[j]) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "level%d", level[j]);
+        if ((did[j] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+        dcpl = -1;
+    } /* end for */
+
+    /* Write the chunks, switching compression level for each one */
+    for (i = 0; i < DEFLATE_REUSE_NCHUNKS; i++)
+        for (j = 0; j < DEFLATE_REUSE_NLEVELS; j++) {
+            start[0] = (hsize_t)(i * DEFLATE_REUSE_CHUNK);
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dwrite(did[j], H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, expect + start[0]) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+    /* Check each chunk was compressed at its dataset's level and reads back */
+    for (j = 0; j < DEFLATE_REUSE_NLEVELS; j++) {
+        for (i = 0; i < DEFLATE_REUSE_NCHUNKS; i++) {
+            offset[0] = (hsize_t)(i * DEFLATE_REUSE_CHUNK);
+            if (H5Dget_chunk_storage_size(did[j], offset, &nbytes) < 0)
+                FAIL_STACK_ERROR
+            if (nbytes < 2 || nbytes >= DEFLATE_REUSE_CHUNK * sizeof(int))
+                FAIL_PUTS_ERROR("    Chunk wasn't compressed.")
+            if (H5Dread_chunk(did[j], H5P_DEFAULT, offset, &filter_mask, raw) < 0)
+                FAIL_STACK_ERROR
+            if (filter_mask != 0)
+                FAIL_PUTS_ERROR("    Deflate filter was skipped for a chunk.")
+            if ((raw[1] >> 6) != flevel[j])
+                FAIL_PUTS_ERROR("    Chunk compressed at the wrong level.")
+        } /* end for */
+
+        HDmemset(rbuf, 0, DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK * sizeof(int));
+        if (H5Dread(did[j], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(rbuf, expect, DEFLATE_REUSE_NCHUNKS * DEFLATE_REUSE_CHUNK * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("    Incorrect data read at a compression level.")
+    } /* end for */
+
+    /* Compress a chunk twice the size of the others, then store it as a
+     * normal sized chunk, so it inflates to more than the chunk size */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    cdims[0] = 2 * DEFLATE_REUSE_CHUNK;
+    if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_deflate(dcpl, 6) < 0)
+        FAIL_STACK_ERROR
+    if ((big_did = H5Dcreate2(fid, "big", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(big_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expect) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 0;
+    if (H5Dget_chunk_storage_size(big_did, offset, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread_chunk(big_did, H5P_DEFAULT, offset, &filter_mask, raw) < 0)
+        FAIL_STACK_ERROR
+
+    cdims[0] = DEFLATE_REUSE_CHUNK;
+    if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+        FAIL_STACK_ERROR
+    if ((grow_did = H5Dcreate2(fid, "grow", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite_chunk(grow_did, H5P_DEFAULT, filter_mask, offset, (size_t)nbytes, raw) < 0)
+        FAIL_STACK_ERROR
+
+    /* Reading the chunk gets the first chunk's worth of the inflated data */
+    HDmemset(rbuf, 0, DEFLATE_REUSE_CHUNK * sizeof(int));
+    start[0] = 0;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(grow_did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(rbuf, expect, DEFLATE_REUSE_CHUNK * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("    Incorrect data read from a chunk that inflates past its size.")
+
+    /* Store a truncated chunk and a corrupted chunk */
+    if ((bad_did = H5Dcreate2(fid, "bad", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 0;
+    if (H5Dget_chunk_storage_size(did[1], offset, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread_chunk(did[1], H5P_DEFAULT, offset, &filter_mask, raw) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite_chunk(bad_did, H5P_DEFAULT, filter_mask, offset, (size_t)(nbytes / 2), raw) < 0)
+        FAIL_STACK_ERROR
+    for (u = 2; u < (size_t)nbytes - 4; u++)
+        raw[u] ^= 0x5a;
+    offset[0] = DEFLATE_REUSE_CHUNK;
+    if (H5Dwrite_chunk(bad_did, H5P_DEFAULT, filter_mask, offset, (size_t)nbytes, raw) < 0)
+        FAIL_STACK_ERROR
+
+    /* Reading either chunk fails, and good chunks still read afterwards */
+    for (i = 0; i < 2; i++) {
+        start[0] = (hsize_t)(i * DEFLATE_REUSE_CHUNK);
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dread(bad_did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            FAIL_PUTS_ERROR("    Reading a bad chunk succeeded.")
+
+        HDmemset(rbuf, 0, DEFLATE_REUSE_CHUNK * sizeof(int));
+        if (H5Dread(did[1], H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(rbuf, expect + start[0], DEFLATE_REUSE_CHUNK * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("    Incorrect data read after a bad chunk.")
+    } /* end for */
+
+    if (H5Dclose(bad_did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(grow_did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(big_did) < 0)
+        FAIL_STACK_ERROR
+    for (j = 0; j < DEFLATE_REUSE_NLEVELS; j++)
+        if (H5Dclose(did[j]) < 0)
+            FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    HDfree(raw);
+    HDfree(rbuf);
+    HDfree(expect);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(bad_did);
+        H5Dclose(grow_did);
+        H5Dclose(big_did);
+        for (j = 0; j < DEFLATE_REUSE_NLEVELS; j++)
+            H5Dclose(did[j]);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(raw);
+    HDfree(rbuf);
+    HDfree(expect);
+    return FAIL;
+#else  /* H5_HAVE_FILTER_DEFLATE */
+    (void)fapl;
+
+    TESTING("deflate stream reuse, output growth and bad chunks");
+    SKIPPED();
+    HDputs("    Deflate filter not enabled");
+
+    return SUCCEED;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+} /* end test_deflate_reuse() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -15689,10 +17769,13 @@ main(void)
                 nerrors += (test_max_compact(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_compact_open_close_dirty(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_conv_buffer(file) < 0 ? 1 : 0);
+                nerrors += (test_conv_nthreads(file) < 0 ? 1 : 0);
+                nerrors += (test_conv_buf_size(file) < 0 ? 1 : 0);
                 nerrors += (test_tconv(file) < 0 ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0 ? 1 : 0);
+                nerrors += (test_nbit_llong(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_float(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_double(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_array(file) < 0 ? 1 : 0);
@@ -15707,6 +17790,8 @@ main(void)
                 nerrors += (test_scaleoffset_float_2(file) < 0 ? 1 : 0);
                 nerrors += (test_scaleoffset_double(file) < 0 ? 1 : 0);
                 nerrors += (test_scaleoffset_double_2(file) < 0 ? 1 : 0);
+                nerrors += (test_lz(file) < 0 ? 1 : 0);
+                nerrors += (test_filter_min_ratio(file) < 0 ? 1 : 0);
                 nerrors += (test_multiopen(file) < 0 ? 1 : 0);
                 nerrors += (test_types(file) < 0 ? 1 : 0);
                 nerrors += (test_userblock_offset(envval, my_fapl, new_format) < 0 ? 1 : 0);
@@ -15744,6 +17829,11 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_map_reuse(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_read_write_multi(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_sieve_windows(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_create_multi(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_deflate_reuse(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
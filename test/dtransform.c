@@ -22,6 +22,7 @@ static int test_copy(hid_t dxpl_id_c_to_f_copy, hid_t dxpl_id_polynomial_copy);
 static int test_trivial(hid_t dxpl_id_simple);
 static int test_poly(hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_blocks(hid_t file);
 static int test_set(void);
 static int test_getset(hid_t dxpl_id_simple);
 
@@ -388,6 +389,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_blocks(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -741,6 +744,115 @@ error:
     return -1;
 }
 
+/* Transforms of arrays longer than the blocks a transform is evaluated in,
+ * using the data several times, with results rounded at every operation
+ */
+static int
+test_blocks(hid_t file)
+{
+    hid_t       dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t     dim[1]   = {2000};
+    int *       int_data = NULL, *int_res = NULL;
+    double *    dbl_data = NULL, *dbl_res = NULL;
+    const char *int_expr = "(x*x - x/3) + ((x+1)*(x-2))/7";
+    const char *dbl_expr = "(2.5-x)*(x*0.5) - 10/x";
+    size_t      i;
+
+    TESTING("data transform of a large array")
+
+    if (NULL == (int_data = (int *)HDmalloc((size_t)dim[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (int_res = (int *)HDmalloc((size_t)dim[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (dbl_data = (double *)HDmalloc((size_t)dim[0] * sizeof(double))))
+        TEST_ERROR
+    if (NULL == (dbl_res = (double *)HDmalloc((size_t)dim[0] * sizeof(double))))
+        TEST_ERROR
+    for (i = 0; i < (size_t)dim[0]; i++) {
+        int_data[i] = (int)i - 500;
+        dbl_data[i] = (double)i - 500.25;
+    }
+
+    if ((dataspace = H5Screate_simple(1, dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+
+    /* Integer data, applying the transform on read */
+    if ((dset_id = H5Dcreate2(file, "/blocks_int", H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, int_data) < 0)
+        TEST_ERROR
+    if (H5Pset_data_transform(dxpl_id, int_expr) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, int_res) < 0)
+        TEST_ERROR
+    for (i = 0; i < (size_t)dim[0]; i++) {
+        int x        = int_data[i];
+        int lhs      = x * x - (int)((double)x / 3);
+        int rhs      = (int)((double)x + 1) * (int)((double)x - 2);
+        int expected = lhs + (int)((double)rhs / 7);
+
+        if (int_res[i] != expected) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %zu is %d, should be %d\n", i, int_res[i], expected);
+            goto error;
+        }
+    }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    /* Floating-point data, applying the transform on write */
+    if (H5Pset_data_transform(dxpl_id, dbl_expr) < 0)
+        TEST_ERROR
+    if ((dset_id = H5Dcreate2(file, "/blocks_double", H5T_NATIVE_DOUBLE, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, dbl_data) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dbl_res) < 0)
+        TEST_ERROR
+    for (i = 0; i < (size_t)dim[0]; i++) {
+        double x        = dbl_data[i];
+        double expected = (2.5 - x) * (x * 0.5) - 10 / x;
+
+        if (HDfabs(dbl_res[i] - expected) > 1e-9 * HDfabs(expected)) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %zu is %g, should be %g\n", i, dbl_res[i], expected);
+            goto error;
+        }
+    }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR
+    HDfree(int_data);
+    HDfree(int_res);
+    HDfree(dbl_data);
+    HDfree(dbl_res);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dxpl_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    HDfree(int_data);
+    HDfree(int_res);
+    HDfree(dbl_data);
+    HDfree(dbl_res);
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
@@ -3748,6 +3748,198 @@ error:
     return 1;
 } /* end test_compound_18() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests compound conversions where some or all of the members
+ *              are copied without conversion: a pure rearrangement needs no
+ *              background buffer, one which converts some members and
+ *              covers the whole destination doesn't use the background
+ *              values, and one which leaves destination members untouched
+ *              keeps them from the background buffer.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct {
+        int    a;
+        double b;
+        short  c;
+    } src_t;
+    typedef struct {
+        short     c;
+        int       e;
+        long long a;
+    } part_t;
+    const size_t   nelmts = 10;
+    src_t *        orig   = NULL;
+    unsigned char *buf = NULL, *bkg = NULL;
+    part_t *       part = NULL;
+    hid_t          st = -1, copy_dt = -1, conv_dt = -1, part_dt = -1;
+    int            ai;
+    long long      all;
+    double         bd;
+    short          cs;
+    herr_t         ret;
+    size_t         i;
+
+    TESTING("compound conversions which copy members");
+
+    if (NULL == (orig = (src_t *)HDcalloc(nelmts, sizeof(src_t))))
+        TEST_ERROR
+    if (NULL == (buf = (unsigned char *)HDcalloc(nelmts, sizeof(src_t) + sizeof(part_t))))
+        TEST_ERROR
+    if (NULL == (bkg = (unsigned char *)HDcalloc(nelmts, sizeof(src_t) + sizeof(part_t))))
+        TEST_ERROR
+    if (NULL == (part = (part_t *)HDcalloc(nelmts, sizeof(part_t))))
+        TEST_ERROR
+    for (i = 0; i < nelmts; i++) {
+        orig[i].a = (int)i * 1000 - 3;
+        orig[i].b = (double)i / 4.0;
+        orig[i].c = (short)(i * 7);
+    } /* end for */
+
+    if ((st = H5Tcreate(H5T_COMPOUND, sizeof(src_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(st, "a", HOFFSET(src_t, a), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(st, "b", HOFFSET(src_t, b), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(st, "c", HOFFSET(src_t, c), H5T_NATIVE_SHORT) < 0)
+        TEST_ERROR
+
+    /* Same members, packed in a different order */
+    if ((copy_dt = H5Tcreate(H5T_COMPOUND, sizeof(short) + sizeof(int) + sizeof(double))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(copy_dt, "c", (size_t)0, H5T_NATIVE_SHORT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(copy_dt, "a", sizeof(short), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(copy_dt, "b", sizeof(short) + sizeof(int), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+
+    /* Members "b" & "c" copied together, with "a" converted */
+    if ((conv_dt = H5Tcreate(H5T_COMPOUND, sizeof(long long) + sizeof(double) + sizeof(short))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(conv_dt, "a", (size_t)0, H5T_NATIVE_LLONG) < 0)
+        TEST_ERROR
+    if (H5Tinsert(conv_dt, "b", sizeof(long long), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(conv_dt, "c", sizeof(long long) + sizeof(double), H5T_NATIVE_SHORT) < 0)
+        TEST_ERROR
+
+    /* Member "e" isn't in the source, so it comes from the background */
+    if ((part_dt = H5Tcreate(H5T_COMPOUND, sizeof(part_t))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(part_dt, "c", HOFFSET(part_t, c), H5T_NATIVE_SHORT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(part_dt, "e", HOFFSET(part_t, e), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(part_dt, "a", HOFFSET(part_t, a), H5T_NATIVE_LLONG) < 0)
+        TEST_ERROR
+
+    /* A rearrangement works without a background buffer */
+    HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+    if (H5Tconvert(st, copy_dt, nelmts, buf, NULL, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < nelmts; i++) {
+        unsigned char *p = buf + i * H5Tget_size(copy_dt);
+
+        HDmemcpy(&cs, p, sizeof(short));
+        HDmemcpy(&ai, p + sizeof(short), sizeof(int));
+        HDmemcpy(&bd, p + sizeof(short) + sizeof(int), sizeof(double));
+        if (cs != orig[i].c || ai != orig[i].a || !H5_DBL_ABS_EQUAL(bd, orig[i].b)) {
+            H5_FAILED();
+            HDprintf("    element %u of rearranged compound is wrong\n", (unsigned)i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    /* Converting a member still needs somewhere to assemble the result... */
+    HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+    H5E_BEGIN_TRY
+    {
+        ret = H5Tconvert(st, conv_dt, nelmts, buf, NULL, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        HDputs("    converted compound without a background buffer");
+        goto error;
+    } /* end if */
+
+    /* ...but doesn't care what's in it */
+    HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+    HDmemset(bkg, 0xff, nelmts * H5Tget_size(conv_dt));
+    if (H5Tconvert(st, conv_dt, nelmts, buf, bkg, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < nelmts; i++) {
+        unsigned char *p = buf + i * H5Tget_size(conv_dt);
+
+        HDmemcpy(&all, p, sizeof(long long));
+        HDmemcpy(&bd, p + sizeof(long long), sizeof(double));
+        HDmemcpy(&cs, p + sizeof(long long) + sizeof(double), sizeof(short));
+        if (all != (long long)orig[i].a || !H5_DBL_ABS_EQUAL(bd, orig[i].b) || cs != orig[i].c) {
+            H5_FAILED();
+            HDprintf("    element %u of converted compound is wrong\n", (unsigned)i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    /* Members missing from the source keep their background values */
+    HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+    for (i = 0; i < nelmts; i++) {
+        part[i].c = -1;
+        part[i].e = (int)i + 100;
+        part[i].a = -1;
+    } /* end for */
+    if (H5Tconvert(st, part_dt, nelmts, buf, part, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    HDmemcpy(part, buf, nelmts * sizeof(part_t));
+    for (i = 0; i < nelmts; i++)
+        if (part[i].c != orig[i].c || part[i].e != (int)i + 100 || part[i].a != (long long)orig[i].a) {
+            H5_FAILED();
+            HDprintf("    element %u of partial compound is wrong\n", (unsigned)i);
+            goto error;
+        } /* end if */
+
+    if (H5Tclose(part_dt) < 0)
+        TEST_ERROR
+    if (H5Tclose(conv_dt) < 0)
+        TEST_ERROR
+    if (H5Tclose(copy_dt) < 0)
+        TEST_ERROR
+    if (H5Tclose(st) < 0)
+        TEST_ERROR
+    HDfree(part);
+    HDfree(bkg);
+    HDfree(buf);
+    HDfree(orig);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(part_dt);
+        H5Tclose(conv_dt);
+        H5Tclose(copy_dt);
+        H5Tclose(st);
+    }
+    H5E_END_TRY;
+    HDfree(part);
+    HDfree(bkg);
+    HDfree(buf);
+    HDfree(orig);
+    return 1;
+} /* end test_compound_19() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_query
  *
@@ -5358,6 +5550,78 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_order
+ *
+ * Purpose:     Test byte order conversions of packed buffers, whose
+ *              lengths aren't a multiple of the vector width so that both
+ *              the vector and scalar swap loops are exercised.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_order(void)
+{
+    const size_t  sizes[]   = {2, 4, 8, 16};
+    const size_t  nelmts[]  = {1, 3, 17, 70};
+    unsigned char buf[70 * 16];
+    unsigned char orig[70 * 16];
+    hid_t         st = -1, dt = -1;
+    size_t        i, j, u, v;
+
+    TESTING("byte order conversions");
+
+    for (i = 0; i < NELMTS(sizes); i++) {
+        if ((st = H5Tcopy(H5T_STD_U8LE)) < 0)
+            TEST_ERROR
+        if (H5Tset_size(st, sizes[i]) < 0)
+            TEST_ERROR
+        if (H5Tset_precision(st, 8 * sizes[i]) < 0)
+            TEST_ERROR
+        if ((dt = H5Tcopy(st)) < 0)
+            TEST_ERROR
+        if (H5Tset_order(dt, H5T_ORDER_BE) < 0)
+            TEST_ERROR
+
+        for (j = 0; j < NELMTS(nelmts); j++) {
+            for (u = 0; u < nelmts[j] * sizes[i]; u++)
+                orig[u] = buf[u] = (unsigned char)(u * 7 + 1);
+
+            if (H5Tconvert(st, dt, nelmts[j], buf, NULL, H5P_DEFAULT) < 0)
+                TEST_ERROR
+
+            for (u = 0; u < nelmts[j]; u++)
+                for (v = 0; v < sizes[i]; v++)
+                    if (buf[u * sizes[i] + v] != orig[u * sizes[i] + sizes[i] - (v + 1)]) {
+                        H5_FAILED();
+                        HDprintf("    size %zu, %zu elements: element %zu not swapped\n", sizes[i],
+                                 nelmts[j], u);
+                        goto error;
+                    } /* end if */
+        }             /* end for */
+
+        if (H5Tclose(st) < 0)
+            TEST_ERROR
+        if (H5Tclose(dt) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(st);
+        H5Tclose(dt);
+    }
+    H5E_END_TRY;
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_bitfield_funcs
  *
@@ -7197,6 +7461,165 @@ error:
     return 1;
 } /* end test_set_order_compound() */
 
+/*-------------------------------------------------------------------------
+ * Function:    convert_int_answer
+ *
+ * Purpose:     A fake integer conversion function, which sets every
+ *              destination value to 42
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+convert_int_answer(hid_t H5_ATTR_UNUSED st, hid_t H5_ATTR_UNUSED dt, H5T_cdata_t *cdata, size_t nelmts,
+                   size_t H5_ATTR_UNUSED buf_stride, size_t H5_ATTR_UNUSED bkg_stride, void *_buf,
+                   void H5_ATTR_UNUSED *bkg, hid_t H5_ATTR_UNUSED dset_xfer_plid)
+{
+    int *  buf = (int *)_buf;
+    size_t u;
+
+    if (H5T_CONV_CONV == cdata->command)
+        for (u = 0; u < nelmts; u++)
+            buf[u] = 42;
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_memo
+ *
+ * Purpose:     Tests that the conversion paths remembered by datasets and
+ *              attributes follow conversion functions being registered
+ *              and unregistered, and that equal compound types with their
+ *              members in different orders find the same conversion path.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_memo(hid_t fapl)
+{
+    typedef struct {
+        int    a;
+        double b;
+    } memo_cmpd_t;
+
+    hid_t       file = -1, space = -1, dset = -1, attr = -1;
+    hid_t       cmpd1 = -1, cmpd2 = -1;
+    hsize_t     dims[1] = {8};
+    int         wdata[8], rdata[8];
+    memo_cmpd_t cdata[4];
+    char        filename[1024];
+    int         pass;
+    size_t      u;
+
+    TESTING("remembered conversion paths");
+
+    for (u = 0; u < 8; u++)
+        wdata[u] = (int)u;
+
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset = H5Dcreate2(file, "ints", H5T_STD_I16BE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((attr = H5Acreate2(dset, "ints", H5T_STD_I16BE, space, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        FAIL_STACK_ERROR
+    if (H5Awrite(attr, H5T_NATIVE_INT, wdata) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read with the library's conversion, then with a replacement for it,
+     * then with the library's again after the replacement is removed
+     */
+    for (pass = 0; pass < 3; pass++) {
+        if (1 == pass) {
+            if (H5Tregister(H5T_PERS_HARD, "int_answer", H5T_STD_I16BE, H5T_NATIVE_INT, convert_int_answer) <
+                0)
+                FAIL_STACK_ERROR
+        }
+        else if (2 == pass) {
+            if (H5Tunregister(H5T_PERS_HARD, "int_answer", H5T_STD_I16BE, H5T_NATIVE_INT,
+                              convert_int_answer) < 0)
+                FAIL_STACK_ERROR
+        }
+
+        HDmemset(rdata, 0, sizeof(rdata));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < 8; u++)
+            if (rdata[u] != (1 == pass ? 42 : wdata[u]))
+                FAIL_PUTS_ERROR("wrong dataset value after changing conversion functions");
+
+        HDmemset(rdata, 0, sizeof(rdata));
+        if (H5Aread(attr, H5T_NATIVE_INT, rdata) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < 8; u++)
+            if (rdata[u] != (1 == pass ? 42 : wdata[u]))
+                FAIL_PUTS_ERROR("wrong attribute value after changing conversion functions");
+    } /* end for */
+
+    /* Equal compound types, with members inserted in different orders */
+    if ((cmpd1 = H5Tcreate(H5T_COMPOUND, sizeof(memo_cmpd_t))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd1, "a", HOFFSET(memo_cmpd_t, a), H5T_NATIVE_INT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd1, "b", HOFFSET(memo_cmpd_t, b), H5T_NATIVE_DOUBLE) < 0)
+        FAIL_STACK_ERROR
+    if ((cmpd2 = H5Tcreate(H5T_COMPOUND, sizeof(memo_cmpd_t))) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd2, "b", HOFFSET(memo_cmpd_t, b), H5T_NATIVE_DOUBLE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tinsert(cmpd2, "a", HOFFSET(memo_cmpd_t, a), H5T_NATIVE_INT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tequal(cmpd1, cmpd2) <= 0)
+        FAIL_PUTS_ERROR("compound types with reordered members should be equal");
+
+    for (u = 0; u < 4; u++) {
+        cdata[u].a = (int)u;
+        cdata[u].b = (double)u / 2;
+    }
+    if (H5Tconvert(cmpd1, cmpd2, (size_t)4, cdata, NULL, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < 4; u++)
+        if (cdata[u].a != (int)u || !H5_DBL_ABS_EQUAL(cdata[u].b, (double)u / 2))
+            FAIL_PUTS_ERROR("wrong value converting between equal compound types");
+
+    if (H5Tclose(cmpd1) < 0)
+        FAIL_STACK_ERROR
+    if (H5Tclose(cmpd2) < 0)
+        FAIL_STACK_ERROR
+    if (H5Aclose(attr) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tunregister(H5T_PERS_HARD, "int_answer", H5T_STD_I16BE, H5T_NATIVE_INT, convert_int_answer);
+        H5Tclose(cmpd1);
+        H5Tclose(cmpd2);
+        H5Aclose(attr);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_path_memo() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_named_indirect_reopen
  *
@@ -8775,6 +9198,7 @@ main(void)
     nerrors += test_delete_obj_named(fapl);
     nerrors += test_delete_obj_named_fileid(fapl);
     nerrors += test_set_order_compound(fapl);
+    nerrors += test_path_memo(fapl);
     nerrors += test_str_create();
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     nerrors += test_deprec(fapl);
@@ -8803,9 +9227,11 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
+    nerrors += test_conv_order();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
     nerrors += test_set_order();
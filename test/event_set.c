@@ -21,6 +21,9 @@
 
 const char *FILENAME[] = {"event_set_1", NULL};
 
+#define ES_ASYNC_DSET_NAME "dset"
+#define ES_ASYNC_NELMTS    1024
+
 /*-------------------------------------------------------------------------
  * Function:    test_es_create
  *
@@ -158,6 +161,216 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_es_native_async
+ *
+ * Purpose:     Tests asynchronous dataset I/O and file flushes with the
+ *              native VOL connector, which run on a background thread in
+ *              thread-safe builds and complete immediately otherwise.
+ *
+ * Return:      Success:    0
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_es_native_async(hid_t fapl_id)
+{
+    char            filename[1024];                /* File name */
+    hid_t           file_id   = H5I_INVALID_HID;   /* File ID */
+    hid_t           dset_id   = H5I_INVALID_HID;   /* Dataset ID */
+    hid_t           space_id  = H5I_INVALID_HID;   /* File dataspace ID */
+    hid_t           mspace_id = H5I_INVALID_HID;   /* Memory dataspace ID */
+    hid_t           es_id     = H5I_INVALID_HID;   /* Event set ID */
+    H5ES_err_info_t err_info;                      /* Info for failed operation */
+    size_t          num_in_progress;               /* # of operations still in progress */
+    size_t          num_errs;                      /* # of failed operations */
+    size_t          num_cleared;                   /* # of failed operations retrieved */
+    hbool_t         op_failed;                     /* Whether an operation failed */
+    hbool_t         is_async;                      /* Whether operations are queued */
+    unsigned        cap_flags = 0;                 /* VOL connector capability flags */
+    hsize_t         dims[1]   = {ES_ASYNC_NELMTS}; /* Dataset dimensions */
+    hsize_t         start[1], count[1];            /* Hyperslab selection */
+    int *           wbuf  = NULL;                  /* Write buffer */
+    int *           rbuf  = NULL;                  /* Read buffer */
+    int *           rbuf2 = NULL;                  /* Read buffer for synchronous read */
+    herr_t          ret;                           /* Generic return value */
+    size_t          u;                             /* Local index variable */
+
+    TESTING("native async operations");
+
+    h5_fixname(FILENAME[0], fapl_id, filename, sizeof filename);
+
+    /* Check whether the native connector runs operations asynchronously */
+    if (H5Pget_vol_cap_flags(fapl_id, &cap_flags) < 0)
+        TEST_ERROR;
+    is_async = (cap_flags & H5VL_CAP_FLAG_ASYNC) ? TRUE : FALSE;
+
+    if (NULL == (wbuf = (int *)HDmalloc(ES_ASYNC_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)HDcalloc(ES_ASYNC_NELMTS, sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf2 = (int *)HDcalloc(ES_ASYNC_NELMTS, sizeof(int))))
+        TEST_ERROR;
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        wbuf[u] = (int)u;
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, ES_ASYNC_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Write the whole dataset, then overwrite its second half from a
+     * selection in a memory dataspace that's closed right away.  The
+     * write buffer is changed after each submission, which mustn't
+     * affect the data written.
+     */
+    if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf, es_id) < 0)
+        TEST_ERROR;
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        wbuf[u] = (int)(u * 10);
+    start[0] = ES_ASYNC_NELMTS / 2;
+    count[0] = ES_ASYNC_NELMTS / 2;
+    if ((mspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, wbuf, es_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    mspace_id = H5I_INVALID_HID;
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        wbuf[u] = -1;
+
+    /* Flush, then read back, ordered after the writes */
+    if (H5Fflush_async(file_id, H5F_SCOPE_LOCAL, es_id) < 0)
+        TEST_ERROR;
+    if (H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf, es_id) < 0)
+        TEST_ERROR;
+
+    /* Operations are either queued or already complete */
+    num_in_progress = 0;
+    if (H5ESget_count(es_id, &num_in_progress) < 0)
+        TEST_ERROR;
+    if (!is_async && num_in_progress != 0)
+        FAIL_PUTS_ERROR("synchronous operations should not be in event set");
+    if (num_in_progress > 4)
+        FAIL_PUTS_ERROR("too many operations in event set");
+
+    /* Wait for all the operations */
+    op_failed = FALSE;
+    if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress != 0 || op_failed)
+        FAIL_PUTS_ERROR("operations should have completed successfully");
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        if (rbuf[u] != (int)(u < ES_ASYNC_NELMTS / 2 ? u : u * 10))
+            FAIL_PUTS_ERROR("incorrect data read");
+
+    /* A synchronous read sees a queued asynchronous write */
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        wbuf[u] = (int)(u + 7);
+    if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf, es_id) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf2) < 0)
+        TEST_ERROR;
+    for (u = 0; u < ES_ASYNC_NELMTS; u++)
+        if (rbuf2[u] != (int)(u + 7))
+            FAIL_PUTS_ERROR("synchronous read didn't see asynchronous write");
+    if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (num_in_progress != 0 || op_failed)
+        FAIL_PUTS_ERROR("operations should have completed successfully");
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = H5I_INVALID_HID;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    file_id = H5I_INVALID_HID;
+
+    /* A write to a read-only file fails: when it's queued, the failure is
+     * reported through the event set instead of by H5Dwrite_async()
+     */
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dopen2(file_id, ES_ASYNC_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (is_async) {
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf, es_id) < 0)
+            TEST_ERROR;
+        op_failed = FALSE;
+        if (H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            TEST_ERROR;
+        if (!op_failed)
+            FAIL_PUTS_ERROR("write to read-only file should have failed");
+
+        num_errs = 0;
+        if (H5ESget_err_count(es_id, &num_errs) < 0)
+            TEST_ERROR;
+        if (num_errs != 1)
+            FAIL_PUTS_ERROR("should be one failed operation");
+        if (H5ESget_err_info(es_id, 1, &err_info, &num_cleared) < 0)
+            TEST_ERROR;
+        if (num_cleared != 1)
+            FAIL_PUTS_ERROR("should have retrieved one error");
+        if (HDstrcmp(err_info.api_name, "H5Dwrite_async") != 0)
+            FAIL_PUTS_ERROR("wrong API routine for failed operation");
+        if (err_info.err_stack_id < 0)
+            FAIL_PUTS_ERROR("no error stack for failed operation");
+        if (H5ESfree_err_info(1, &err_info) < 0)
+            TEST_ERROR;
+    } /* end if */
+    else {
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf, es_id);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            FAIL_PUTS_ERROR("write to read-only file should have failed");
+    } /* end else */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(rbuf2);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(rbuf2);
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -184,6 +397,7 @@ main(void)
     /* Tests */
     nerrors += test_es_create();
     nerrors += test_es_none();
+    nerrors += test_es_native_async(fapl_id);
 
     /* Cleanup */
     h5_cleanup(FILENAME, fapl_id);
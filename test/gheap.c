@@ -48,7 +48,7 @@
         } /* end if */                                                                                       \
     }     /* end GHEAP_REPEATED_ERR */
 
-const char *FILENAME[] = {"gheap1", "gheap2", "gheap3", "gheap4", "gheapooo", NULL};
+const char *FILENAME[] = {"gheap1", "gheap2", "gheap3", "gheap4", "gheapooo", "gheapmulti", NULL};
 
 /*-------------------------------------------------------------------------
  * Function:    test_1
@@ -564,6 +564,168 @@ error:
     return MAX(1, nerrors);
 } /* end test_ooo_indices */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi
+ *
+ * Purpose:     Writes batches of objects to the global heap with
+ *              H5HG_insert_multi() and reads them back, in a different
+ *              order, with H5HG_read_multi().
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_multi(hid_t fapl)
+{
+    hid_t         file  = H5I_INVALID_HID;
+    H5F_t *       f     = NULL;
+    H5HG_t *      obj   = NULL;
+    H5HG_t *      robj  = NULL;
+    uint8_t *     out   = NULL;
+    uint8_t *     in    = NULL;
+    const void ** obuf  = NULL;
+    void **       ibuf  = NULL;
+    size_t *      size  = NULL;
+    size_t *      rsize = NULL;
+    size_t        nobjs = GHEAP_TEST_NOBJS + 16;
+    size_t        u, v;
+    herr_t        status;
+    int           nerrors = 0;
+    char          filename[1024];
+
+    TESTING("batched insertion and reading");
+
+    /* Allocate buffers: GHEAP_TEST_NOBJS small objects, then 16 large ones */
+    if (NULL == (obj = (H5HG_t *)HDmalloc(nobjs * sizeof(H5HG_t))))
+        goto error;
+    if (NULL == (robj = (H5HG_t *)HDmalloc(nobjs * sizeof(H5HG_t))))
+        goto error;
+    if (NULL == (obuf = (const void **)HDmalloc(nobjs * sizeof(void *))))
+        goto error;
+    if (NULL == (ibuf = (void **)HDmalloc(nobjs * sizeof(void *))))
+        goto error;
+    if (NULL == (size = (size_t *)HDmalloc(nobjs * sizeof(size_t))))
+        goto error;
+    if (NULL == (rsize = (size_t *)HDmalloc(nobjs * sizeof(size_t))))
+        goto error;
+    if (NULL == (out = (uint8_t *)HDmalloc(nobjs * 8192)))
+        goto error;
+    if (NULL == (in = (uint8_t *)HDmalloc(nobjs * 8192)))
+        goto error;
+    for (u = 0; u < nobjs; u++) {
+        size[u] = u < GHEAP_TEST_NOBJS ? u % 32 : 8000;
+        obuf[u] = out + u * 8192;
+        for (v = 0; v < size[u]; v++)
+            out[u * 8192 + v] = (uint8_t)(u + v);
+    } /* end for */
+
+    /* Open a clean file */
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if (NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to create file");
+        goto error;
+    } /* end if */
+
+    /* Insert the small objects, then the large ones */
+    if (H5HG_insert_multi(f, GHEAP_TEST_NOBJS, size, obuf, obj) < 0) {
+        H5_FAILED();
+        HDputs("    Unable to insert objects into global heap");
+        goto error;
+    } /* end if */
+    if (H5HG_insert_multi(f, nobjs - GHEAP_TEST_NOBJS, size + GHEAP_TEST_NOBJS, obuf + GHEAP_TEST_NOBJS,
+                          obj + GHEAP_TEST_NOBJS) < 0) {
+        H5_FAILED();
+        HDputs("    Unable to insert objects into global heap");
+        goto error;
+    } /* end if */
+
+    /* The small objects fit in one collection, which should be sized to hold them all */
+    for (u = 1; u < GHEAP_TEST_NOBJS; u++)
+        if (!H5F_addr_eq(obj[u].addr, obj[0].addr))
+            GHEAP_REPEATED_ERR("    Batch of small objects is spread over several collections");
+
+    /* Reopen the file */
+    if (H5Fclose(file) < 0)
+        goto error;
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        goto error;
+    if (NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to open file");
+        goto error;
+    } /* end if */
+
+    /* Read the objects back, alternating between the ends of the batch so
+     * that the collections are interleaved */
+    for (u = 0; u < nobjs; u++) {
+        v        = (u % 2) ? nobjs - 1 - u / 2 : u / 2;
+        robj[u]  = obj[v];
+        rsize[u] = size[v];
+        ibuf[u]  = in + v * 8192;
+    } /* end for */
+    HDmemset(in, 0, nobjs * 8192);
+    if (H5HG_read_multi(f, nobjs, robj, ibuf, rsize) < 0) {
+        H5_FAILED();
+        HDputs("    Unable to read objects from global heap");
+        goto error;
+    } /* end if */
+    for (u = 0; u < nobjs; u++)
+        if (HDmemcmp(out + u * 8192, in + u * 8192, size[u]) != 0)
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written");
+
+    /* An object with a different size than expected is an error */
+    rsize[0]++;
+    H5E_BEGIN_TRY
+    {
+        status = H5HG_read_multi(f, nobjs, robj, ibuf, rsize);
+    }
+    H5E_END_TRY;
+    if (status >= 0) {
+        H5_FAILED();
+        HDputs("    Read of objects with the wrong size succeeded");
+        goto error;
+    } /* end if */
+
+    if (H5Fclose(file) < 0)
+        goto error;
+    if (nerrors)
+        goto error;
+
+    HDfree(in);
+    HDfree(out);
+    HDfree(rsize);
+    HDfree(size);
+    HDfree(ibuf);
+    HDfree(obuf);
+    HDfree(robj);
+    HDfree(obj);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    HDfree(in);
+    HDfree(out);
+    HDfree(rsize);
+    HDfree(size);
+    HDfree(ibuf);
+    HDfree(obuf);
+    HDfree(robj);
+    HDfree(obj);
+    return MAX(1, nerrors);
+} /* end test_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	main
  *
@@ -594,6 +756,7 @@ main(void)
     nerrors += test_3(fapl_id);
     nerrors += test_4(fapl_id);
     nerrors += test_ooo_indices(fapl_id);
+    nerrors += test_multi(fapl_id);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl_id) < 0 ? 1 : 0);
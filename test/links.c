@@ -1509,6 +1509,172 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Tests that the links cached when resolving paths are
+ *              forgotten when links are moved, deleted and created.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl, hbool_t new_format)
+{
+    hid_t       file = -1, root = -1, grp_a = -1, grp_b = -1, grp = -1;
+    H5O_info2_t oinfo1, oinfo2;
+    char        filename[NAME_BUF_SIZE];
+    char        name[NAME_BUF_SIZE];
+    int         cmp_value;
+    unsigned    u;
+
+    if (new_format)
+        TESTING("path-resolution cache (w/new group format)")
+    else
+        TESTING("path-resolution cache")
+
+    /* Create a hierarchy, with enough links in "/a" for dense storage */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((grp_a = H5Gcreate2(file, "a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if ((grp_b = H5Gcreate2(grp_a, "b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if ((grp = H5Gcreate2(grp_b, "c", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Gclose(grp) < 0)
+        TEST_ERROR
+    for (u = 0; u < 20; u++) {
+        HDsprintf(name, "g%02u", u);
+        if ((grp = H5Gcreate2(grp_a, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Gclose(grp) < 0)
+            TEST_ERROR
+    } /* end for */
+    if (H5Gclose(grp_b) < 0)
+        TEST_ERROR
+    if (H5Gclose(grp_a) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    /* Re-open the file and resolve a path, which caches each component */
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR
+    if ((root = H5Gopen2(file, "/", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(root, "a") != FALSE)
+        TEST_ERROR
+    if ((grp = H5Gopen2(file, "/a/b/c", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Gclose(grp) < 0)
+        TEST_ERROR
+    if ((grp_a = H5Gopen2(file, "/a", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if ((grp_b = H5Gopen2(file, "/a/b", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(root, "a") != TRUE)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_a, "b") != TRUE)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_b, "c") != TRUE)
+        TEST_ERROR
+
+    /* Moving a link forgets it */
+    if (H5Lmove(grp_a, "b", grp_a, "b2", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_a, "b") != FALSE)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        grp = H5Gopen2(file, "/a/b/c", H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (grp >= 0)
+        TEST_ERROR
+    if ((grp = H5Gopen2(file, "/a/b2/c", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Gclose(grp) < 0)
+        TEST_ERROR
+
+    /* Deleting a link forgets it */
+    if (H5Ldelete(file, "/a/b2/c", H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_b, "c") != FALSE)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        grp = H5Gopen2(file, "/a/b2/c", H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (grp >= 0)
+        TEST_ERROR
+
+    /* Creating a link under the deleted link's name finds the new link */
+    if (H5Lcreate_soft("/a/g00", grp_b, "c", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Oget_info_by_name3(file, "/a/b2/c", &oinfo1, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Oget_info_by_name3(file, "/a/g00", &oinfo2, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Otoken_cmp(file, &oinfo1.token, &oinfo2.token, &cmp_value) < 0)
+        TEST_ERROR
+    if (cmp_value != 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_b, "c") != TRUE)
+        TEST_ERROR
+
+    /* Deleting a link by index forgets all of the group's links */
+    if (H5G__path_cache_test(grp_a, "g00") != TRUE)
+        TEST_ERROR
+    if (H5Ldelete_by_idx(file, "/a", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)0, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_a, "g00") != FALSE)
+        TEST_ERROR
+    if (H5Lexists(file, "/a/b2", H5P_DEFAULT) != FALSE)
+        TEST_ERROR
+    if (H5Lexists(file, "/a/g00", H5P_DEFAULT) != TRUE)
+        TEST_ERROR
+
+    /* Deleting a group forgets its links, so a group created in its place
+     * (perhaps at the same address) doesn't see them
+     */
+    if (H5Gclose(grp_b) < 0)
+        TEST_ERROR
+    if ((grp_b = H5Gcreate2(grp_a, "b2", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Lexists(grp_b, "c", H5P_DEFAULT) != FALSE)
+        TEST_ERROR
+    if (H5G__path_cache_test(grp_b, "c") != FALSE)
+        TEST_ERROR
+
+    if (H5Gclose(grp_b) < 0)
+        TEST_ERROR
+    if (H5Gclose(grp_a) < 0)
+        TEST_ERROR
+    if (H5Gclose(root) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(grp);
+        H5Gclose(grp_b);
+        H5Gclose(grp_a);
+        H5Gclose(root);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_copy
  *
@@ -22604,6 +22770,7 @@ main(void)
             nerrors += test_lcpl_deprec(my_fapl, new_format);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
             nerrors += test_move(my_fapl, new_format);
+            nerrors += test_path_cache(my_fapl, new_format);
             nerrors += test_copy(my_fapl, new_format);
             nerrors += test_move_preserves(my_fapl, new_format);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
@@ -0,0 +1,840 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Tests map objects stored in the native file format.
+ */
+#include "h5test.h"
+
+#define H5M_FRIEND /*suppress error about including H5Mpkg      */
+#include "H5Mpkg.h"
+
+/* Other private headers that this test requires */
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Iprivate.h"  /* IDs                                  */
+#include "H5VLprivate.h" /* Virtual Object Layer                 */
+
+const char *FILENAME[] = {"maps", NULL};
+
+#define NKEYS      1000
+#define NVL_KEYS   50
+#define ITER_STOP  10
+#define MAP_NAME   "map"
+#define COPY_NAME  "map_copy"
+#define VLMAP_NAME "vlmap"
+
+/* Data for iteration callback */
+typedef struct {
+    int     nkeys;   /* Number of keys visited */
+    long    key_sum; /* Sum of keys visited */
+    int     stop_at; /* Number of keys to visit before stopping, or 0 */
+    hbool_t seen[NKEYS];
+} iter_ud_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    iter_cb
+ *
+ * Purpose:     Map iteration callback, counting the keys visited.
+ *
+ * Return:      0 to continue, 1 to stop, -1 on error
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+iter_cb(hid_t H5_ATTR_UNUSED map_id, const void *_key, void *_udata)
+{
+    iter_ud_t *udata = (iter_ud_t *)_udata;
+    int        key   = *(const int *)_key;
+
+    if (key < 0 || key >= NKEYS || udata->seen[key])
+        return -1;
+    udata->seen[key] = TRUE;
+    udata->nkeys++;
+    udata->key_sum += key;
+
+    return (udata->stop_at > 0 && udata->nkeys == udata->stop_at) ? 1 : 0;
+} /* end iter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_internal
+ *
+ * Purpose:     Tests storing maps through the library's package routines,
+ *              which are built even when the map API isn't.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_internal(hid_t fapl)
+{
+    char             filename[1024];
+    hid_t            file    = H5I_INVALID_HID;
+    hid_t            vl_type = H5I_INVALID_HID;
+    H5G_loc_t        loc;
+    H5M_obj_create_t mcrt_info;
+    H5M_t *          map     = NULL;
+    H5M_t *          vl_map  = NULL;
+    iter_ud_t *      udata   = NULL;
+    const char *     str     = "a";
+    char *           str_out = NULL;
+    hsize_t          count;
+    hsize_t          idx;
+    hbool_t          exists;
+    hbool_t          api_ctx_pushed = FALSE;
+    hbool_t          wrapper_set    = FALSE;
+    herr_t           ret;
+    double           val;
+    int              key;
+
+    TESTING("map storage through the package routines");
+
+    if (NULL == (udata = (iter_ud_t *)HDcalloc(1, sizeof(iter_ud_t))))
+        TEST_ERROR
+    if ((vl_type = H5Tcopy(H5T_C_S1)) < 0)
+        TEST_ERROR
+    if (H5Tset_size(vl_type, H5T_VARIABLE) < 0)
+        TEST_ERROR
+
+    /* Push API context */
+    if (H5CX_push() < 0)
+        FAIL_STACK_ERROR
+    api_ctx_pushed = TRUE;
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5G_loc(file, &loc) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a map with fixed-size keys & values, and one with string values */
+    if (NULL == (mcrt_info.key_type = (H5T_t *)H5I_object_verify(H5T_STD_I32LE, H5I_DATATYPE)))
+        FAIL_STACK_ERROR
+    if (NULL == (mcrt_info.val_type = (H5T_t *)H5I_object_verify(H5T_IEEE_F64BE, H5I_DATATYPE)))
+        FAIL_STACK_ERROR
+    mcrt_info.mcpl_id = H5P_MAP_CREATE_DEFAULT;
+    mcrt_info.mapl_id = H5P_MAP_ACCESS_DEFAULT;
+    if (NULL == (map = H5M__create_named(&loc, MAP_NAME, H5P_LINK_CREATE_DEFAULT, &mcrt_info)))
+        FAIL_STACK_ERROR
+    if (NULL == (mcrt_info.val_type = (H5T_t *)H5I_object_verify(vl_type, H5I_DATATYPE)))
+        FAIL_STACK_ERROR
+    if (NULL == (vl_map = H5M__create_named(&loc, VLMAP_NAME, H5P_LINK_CREATE_DEFAULT, &mcrt_info)))
+        FAIL_STACK_ERROR
+
+    /* Put the keys, then replace a value with one of the same size */
+    for (key = 0; key < NKEYS; key++) {
+        val = (double)key / 2.0;
+        if (H5M__put(map, (size_t)1, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    key = 7;
+    val = -1.0;
+    if (H5M__put(map, (size_t)1, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val) < 0)
+        FAIL_STACK_ERROR
+    if (H5M__get_count(map, &count) < 0)
+        FAIL_STACK_ERROR
+    if (count != NKEYS)
+        TEST_ERROR
+
+    /* Replace a string with a longer one */
+    key = 0;
+    if (H5M__put(vl_map, (size_t)1, H5T_NATIVE_INT, &key, vl_type, &str) < 0)
+        FAIL_STACK_ERROR
+    str = "a longer string than the heap ID";
+    if (H5M__put(vl_map, (size_t)1, H5T_NATIVE_INT, &key, vl_type, &str) < 0)
+        FAIL_STACK_ERROR
+
+    if (H5M_close(vl_map) < 0)
+        FAIL_STACK_ERROR
+    vl_map = NULL;
+    if (H5M_close(map) < 0)
+        FAIL_STACK_ERROR
+    map = NULL;
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the maps and check their contents */
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5G_loc(file, &loc) < 0)
+        FAIL_STACK_ERROR
+    if (NULL == (map = H5M__open_name(&loc, MAP_NAME, H5P_MAP_ACCESS_DEFAULT)))
+        FAIL_STACK_ERROR
+    for (key = 0; key < NKEYS; key++) {
+        if (H5M__get(map, (size_t)1, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val) < 0)
+            FAIL_STACK_ERROR
+        if (!H5_DBL_ABS_EQUAL(val, key == 7 ? -1.0 : (double)key / 2.0))
+            TEST_ERROR
+    } /* end for */
+    if (NULL == (vl_map = H5M__open_name(&loc, VLMAP_NAME, H5P_MAP_ACCESS_DEFAULT)))
+        FAIL_STACK_ERROR
+    key = 0;
+    if (H5M__get(vl_map, (size_t)1, H5T_NATIVE_INT, &key, vl_type, &str_out) < 0)
+        FAIL_STACK_ERROR
+    if (!str_out || HDstrcmp(str_out, str) != 0)
+        TEST_ERROR
+    H5free_memory(str_out);
+    str_out = NULL;
+    if (H5M_close(vl_map) < 0)
+        FAIL_STACK_ERROR
+    vl_map = NULL;
+
+    /* Delete a key */
+    key = NKEYS / 2;
+    if (H5M__delete_key(map, H5T_NATIVE_INT, &key) < 0)
+        FAIL_STACK_ERROR
+    if (H5M__exists(map, H5T_NATIVE_INT, &key, &exists) < 0)
+        FAIL_STACK_ERROR
+    if (exists)
+        TEST_ERROR
+    if (H5M__get_count(map, &count) < 0)
+        FAIL_STACK_ERROR
+    if (count != NKEYS - 1)
+        TEST_ERROR
+
+    /* Iterating registers an ID for the map, which needs the file's VOL connector */
+    if (H5VL_set_vol_wrapper(H5VL_vol_object(file)) < 0)
+        FAIL_STACK_ERROR
+    wrapper_set = TRUE;
+
+    /* Visit all the keys */
+    idx = 0;
+    if (H5M__iterate(&loc, MAP_NAME, &idx, H5T_NATIVE_INT, iter_cb, udata) < 0)
+        FAIL_STACK_ERROR
+    if (udata->nkeys != NKEYS - 1 || idx != (hsize_t)(NKEYS - 1))
+        TEST_ERROR
+    if (udata->key_sum != (long)NKEYS * (NKEYS - 1) / 2 - NKEYS / 2)
+        TEST_ERROR
+
+    /* Stop part way */
+    HDmemset(udata, 0, sizeof(*udata));
+    udata->stop_at = ITER_STOP;
+    idx            = 0;
+    if (H5M__iterate(&loc, MAP_NAME, &idx, H5T_NATIVE_INT, iter_cb, udata) != 1)
+        TEST_ERROR
+    if (idx != ITER_STOP)
+        TEST_ERROR
+
+    /* A failing callback should fail iteration (the keys have been seen) */
+    idx = 0;
+    H5E_BEGIN_TRY
+    {
+        ret = H5M__iterate(&loc, MAP_NAME, &idx, H5T_NATIVE_INT, iter_cb, udata);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    if (H5VL_reset_vol_wrapper() < 0)
+        FAIL_STACK_ERROR
+    wrapper_set = FALSE;
+    if (H5M_close(map) < 0)
+        FAIL_STACK_ERROR
+    map = NULL;
+    if (H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+    if (H5CX_pop(FALSE) < 0)
+        FAIL_STACK_ERROR
+    api_ctx_pushed = FALSE;
+    if (H5Tclose(vl_type) < 0)
+        FAIL_STACK_ERROR
+    HDfree(udata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (wrapper_set)
+            H5VL_reset_vol_wrapper();
+        if (vl_map)
+            H5M_close(vl_map);
+        if (map)
+            H5M_close(map);
+        H5Fclose(file);
+        if (api_ctx_pushed)
+            H5CX_pop(FALSE);
+        H5Tclose(vl_type);
+    }
+    H5E_END_TRY;
+    H5free_memory(str_out);
+    HDfree(udata);
+    return 1;
+} /* end test_internal() */
+
+#ifdef H5_HAVE_MAP_API
+
+/*-------------------------------------------------------------------------
+ * Function:    test_fixed
+ *
+ * Purpose:     Tests putting, getting, checking and deleting keys one at
+ *              a time, with fixed-size keys & values.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_fixed(hid_t fapl)
+{
+    char    filename[1024];
+    hid_t   file = H5I_INVALID_HID, map = H5I_INVALID_HID, type = H5I_INVALID_HID;
+    hsize_t count;
+    hbool_t exists;
+    herr_t  ret;
+    double  val;
+    int     key;
+
+    TESTING("map put/get/exists/delete with fixed-size keys & values");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((map = H5Mcreate(file, MAP_NAME, H5T_STD_I32LE, H5T_IEEE_F64BE, H5P_DEFAULT, H5P_DEFAULT,
+                         H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Put the keys, converting them & the values to the map's datatypes */
+    for (key = 0; key < NKEYS; key++) {
+        val = (double)key / 2.0;
+        if (H5Mput(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Replace a value */
+    key = 7;
+    val = -1.0;
+    if (H5Mput(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR
+
+    if (H5Mget_count(map, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (count != NKEYS)
+        TEST_ERROR
+
+    /* Check the datatypes */
+    if ((type = H5Mget_key_type(map)) < 0)
+        TEST_ERROR
+    if (H5Tequal(type, H5T_STD_I32LE) <= 0)
+        TEST_ERROR
+    if (H5Tclose(type) < 0)
+        TEST_ERROR
+    if ((type = H5Mget_val_type(map)) < 0)
+        TEST_ERROR
+    if (H5Tequal(type, H5T_IEEE_F64BE) <= 0)
+        TEST_ERROR
+    if (H5Tclose(type) < 0)
+        TEST_ERROR
+
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    /* Re-open the map and check its contents */
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR
+    if ((map = H5Mopen(file, MAP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (key = 0; key < NKEYS; key++) {
+        if (H5Mget(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if (!H5_DBL_ABS_EQUAL(val, key == 7 ? -1.0 : (double)key / 2.0))
+            TEST_ERROR
+    } /* end for */
+
+    /* Check for keys */
+    key = NKEYS / 2;
+    if (H5Mexists(map, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (!exists)
+        TEST_ERROR
+    key = NKEYS;
+    if (H5Mexists(map, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (exists)
+        TEST_ERROR
+
+    /* Getting a missing key should fail */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Mget(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    /* Delete a key */
+    key = NKEYS / 2;
+    if (H5Mdelete(map, H5T_NATIVE_INT, &key, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Mexists(map, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (exists)
+        TEST_ERROR
+    if (H5Mget_count(map, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (count != NKEYS - 1)
+        TEST_ERROR
+
+    /* Deleting it again should fail */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Mdelete(map, H5T_NATIVE_INT, &key, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    /* Incompatible memory datatypes should fail */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Mput(map, H5T_NATIVE_INT, &key, H5T_C_S1, "x", H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(type);
+        H5Mclose(map);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_fixed() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi
+ *
+ * Purpose:     Tests putting and getting batches of keys.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_multi(hid_t fapl)
+{
+    char      filename[1024];
+    hid_t     file = H5I_INVALID_HID, map = H5I_INVALID_HID;
+    long long keys[NKEYS + 1];
+    float     vals[NKEYS + 1];
+    int       int_keys[NKEYS];
+    double    dbl_vals[NKEYS];
+    hsize_t   count;
+    herr_t    ret;
+    int       i;
+
+    TESTING("map batch put/get");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR
+    if ((map = H5Mcreate(file, "multi", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, H5P_DEFAULT, H5P_DEFAULT,
+                         H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Put the keys in reverse, with one key repeated at the end */
+    for (i = 0; i < NKEYS; i++) {
+        keys[i] = (long long)(NKEYS - 1 - i);
+        vals[i] = (float)(NKEYS - 1 - i) * 2.0F;
+    } /* end for */
+    keys[NKEYS] = 3;
+    vals[NKEYS] = -3.0F;
+    if (H5Mput_multi(map, (size_t)(NKEYS + 1), H5T_NATIVE_LLONG, keys, H5T_NATIVE_FLOAT, vals, H5P_DEFAULT) <
+        0)
+        TEST_ERROR
+    if (H5Mget_count(map, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (count != NKEYS)
+        TEST_ERROR
+
+    /* Get them back in order, with different memory datatypes */
+    for (i = 0; i < NKEYS; i++)
+        int_keys[i] = i;
+    if (H5Mget_multi(map, (size_t)NKEYS, H5T_NATIVE_INT, int_keys, H5T_NATIVE_DOUBLE, dbl_vals, H5P_DEFAULT) <
+        0)
+        TEST_ERROR
+    for (i = 0; i < NKEYS; i++)
+        if (!H5_DBL_ABS_EQUAL(dbl_vals[i], i == 3 ? -3.0 : (double)i * 2.0))
+            TEST_ERROR
+
+    /* A batch with a missing key should fail */
+    int_keys[NKEYS / 2] = NKEYS;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Mget_multi(map, (size_t)NKEYS, H5T_NATIVE_INT, int_keys, H5T_NATIVE_DOUBLE, dbl_vals,
+                           H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    /* Empty batches are allowed */
+    if (H5Mput_multi(map, (size_t)0, H5T_NATIVE_INT, NULL, H5T_NATIVE_DOUBLE, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR
+
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vlen
+ *
+ * Purpose:     Tests maps with variable-length string keys and
+ *              variable-length sequence values.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_vlen(hid_t fapl)
+{
+    char   filename[1024];
+    hid_t  file = H5I_INVALID_HID, map = H5I_INVALID_HID;
+    hid_t  str_type = H5I_INVALID_HID, file_vl_type = H5I_INVALID_HID, mem_vl_type = H5I_INVALID_HID;
+    char   names[NVL_KEYS][16];
+    char * keys[NVL_KEYS];
+    hvl_t  vals[NVL_KEYS];
+    int    data[NVL_KEYS];
+    hvl_t  out_vals[NVL_KEYS];
+    size_t u, v;
+
+    TESTING("map with variable-length keys & values");
+
+    HDmemset(out_vals, 0, sizeof(out_vals));
+
+    if ((str_type = H5Tcopy(H5T_C_S1)) < 0)
+        TEST_ERROR
+    if (H5Tset_size(str_type, H5T_VARIABLE) < 0)
+        TEST_ERROR
+    if ((file_vl_type = H5Tvlen_create(H5T_STD_I16BE)) < 0)
+        TEST_ERROR
+    if ((mem_vl_type = H5Tvlen_create(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR
+    if ((map = H5Mcreate(file, VLMAP_NAME, str_type, file_vl_type, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR
+
+    /* Key 'u' maps to the sequence 0 .. u-1, so the first key has an empty value */
+    for (u = 0; u < NVL_KEYS; u++) {
+        HDsnprintf(names[u], sizeof(names[u]), "key %u", (unsigned)u);
+        keys[u]     = names[u];
+        data[u]     = (int)u;
+        vals[u].len = u;
+        vals[u].p   = u > 0 ? data : NULL;
+    } /* end for */
+    if (H5Mput_multi(map, (size_t)NVL_KEYS, str_type, keys, mem_vl_type, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+
+    /* Read the values back */
+    if ((map = H5Mopen(file, VLMAP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Mget_multi(map, (size_t)NVL_KEYS, str_type, keys, mem_vl_type, out_vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    for (u = 0; u < NVL_KEYS; u++) {
+        if (out_vals[u].len != u)
+            TEST_ERROR
+        for (v = 0; v < u; v++)
+            if (((int *)out_vals[u].p)[v] != (int)v)
+                TEST_ERROR
+        HDfree(out_vals[u].p);
+        out_vals[u].p = NULL;
+    } /* end for */
+
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+    if (H5Tclose(mem_vl_type) < 0)
+        TEST_ERROR
+    if (H5Tclose(file_vl_type) < 0)
+        TEST_ERROR
+    if (H5Tclose(str_type) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    for (u = 0; u < NVL_KEYS; u++)
+        HDfree(out_vals[u].p);
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map);
+        H5Fclose(file);
+        H5Tclose(mem_vl_type);
+        H5Tclose(file_vl_type);
+        H5Tclose(str_type);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_vlen() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iterate
+ *
+ * Purpose:     Tests iterating over the keys of a map, including
+ *              stopping and restarting iteration.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_iterate(hid_t fapl)
+{
+    char       filename[1024];
+    hid_t      file = H5I_INVALID_HID, map = H5I_INVALID_HID;
+    iter_ud_t *udata = NULL;
+    hsize_t    idx;
+    herr_t     ret;
+
+    TESTING("map iteration");
+
+    if (NULL == (udata = (iter_ud_t *)HDcalloc(1, sizeof(iter_ud_t))))
+        TEST_ERROR
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR
+    if ((map = H5Mopen(file, MAP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Visit all the keys (test_fixed() deleted one) */
+    idx = 0;
+    if (H5Miterate(map, &idx, H5T_NATIVE_INT, iter_cb, udata, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (udata->nkeys != NKEYS - 1 || idx != (hsize_t)(NKEYS - 1))
+        TEST_ERROR
+    if (udata->key_sum != (long)NKEYS * (NKEYS - 1) / 2 - NKEYS / 2)
+        TEST_ERROR
+
+    /* Stop part way, then pick up where iteration stopped */
+    HDmemset(udata, 0, sizeof(*udata));
+    udata->stop_at = ITER_STOP;
+    idx            = 0;
+    if ((ret = H5Miterate_by_name(file, MAP_NAME, &idx, H5T_NATIVE_INT, iter_cb, udata, H5P_DEFAULT,
+                                  H5P_DEFAULT)) != 1)
+        TEST_ERROR
+    if (idx != ITER_STOP)
+        TEST_ERROR
+    udata->stop_at = 0;
+    if (H5Miterate(map, &idx, H5T_NATIVE_INT, iter_cb, udata, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (udata->nkeys != NKEYS - 1 || idx != (hsize_t)(NKEYS - 1))
+        TEST_ERROR
+
+    /* Writing to a read-only file should fail */
+    H5E_BEGIN_TRY
+    {
+        int    key = 0;
+        double val = 0.0;
+
+        ret = H5Mput(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+    HDfree(udata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    HDfree(udata);
+    return 1;
+} /* end test_iterate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_objects
+ *
+ * Purpose:     Tests maps as objects: anonymous maps, object info,
+ *              copying and deleting.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_objects(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       file = H5I_INVALID_HID, map = H5I_INVALID_HID;
+    H5O_info2_t oinfo;
+    hsize_t     count;
+    double      val;
+    int         key;
+
+    TESTING("map objects");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR
+
+    /* Check the object type */
+    if (H5Oget_info_by_name3(file, MAP_NAME, &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (oinfo.type != H5O_TYPE_MAP)
+        TEST_ERROR
+
+    /* Create an anonymous map and link it into the file */
+    if ((map = H5Mcreate_anon(file, H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    key = 1;
+    val = 2.0;
+    if (H5Mput(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Olink(map, file, "anon", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+
+    /* Copy a map, then delete the original */
+    if (H5Ocopy(file, MAP_NAME, file, COPY_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Ldelete(file, MAP_NAME, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if ((map = H5Mopen(file, COPY_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Mget_count(map, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (count != NKEYS - 1)
+        TEST_ERROR
+    key = NKEYS - 1;
+    if (H5Mget(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (!H5_DBL_ABS_EQUAL(val, (double)key / 2.0))
+        TEST_ERROR
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+
+    /* Check the anonymous map */
+    if ((map = H5Mopen(file, "anon", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    key = 1;
+    if (H5Mget(map, H5T_NATIVE_INT, &key, H5T_NATIVE_DOUBLE, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (!H5_DBL_ABS_EQUAL(val, 2.0))
+        TEST_ERROR
+    if (H5Mclose(map) < 0)
+        TEST_ERROR
+
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* end test_objects() */
+
+#endif /* H5_HAVE_MAP_API */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Tests maps in the native file format
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t fapl    = H5I_INVALID_HID;
+    int   nerrors = 0;
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    nerrors += test_internal(fapl);
+#ifdef H5_HAVE_MAP_API
+    nerrors += test_fixed(fapl);
+    nerrors += test_multi(fapl);
+    nerrors += test_vlen(fapl);
+    nerrors += test_iterate(fapl);
+    nerrors += test_objects(fapl);
+#else  /* H5_HAVE_MAP_API */
+    TESTING("the map API");
+    SKIPPED();
+    HDputs("    Map API not built.");
+#endif /* H5_HAVE_MAP_API */
+
+    if (nerrors)
+        goto error;
+    HDputs("All map tests passed.");
+    h5_cleanup(FILENAME, fapl);
+    return EXIT_SUCCESS;
+
+error:
+    HDprintf("***** %d MAP TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
+    return EXIT_FAILURE;
+} /* end main() */
@@ -8387,6 +8387,230 @@ test_attr_create_by_name(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 } /* test_attr_create_by_name() */
 
+/****************************************************************
+**
+**  test_attr_read_batch(): Test basic H5A (attribute) code.
+**      Tests reading several attributes at once with H5Aread_batch
+**
+****************************************************************/
+static void
+test_attr_read_batch(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t             fid;                        /* HDF5 File ID            */
+    hid_t             dataset;                    /* Dataset ID            */
+    hid_t             sid;                        /* Dataspace ID            */
+    hid_t             attr;                       /* Attribute ID            */
+    hid_t             tid;                        /* Datatype ID            */
+    hid_t             dcpl;                       /* Dataset creation property list ID */
+    unsigned          max_compact;                /* Maximum # of attributes to store compactly */
+    unsigned          min_dense;                  /* Minimum # of attributes to store "densely" */
+    unsigned          nint;                       /* # of integer attributes */
+    H5A_batch_attr_t *attrs = NULL;               /* Attributes read */
+    void *            arena = NULL;               /* Arena for attribute names & values */
+    size_t            nattrs;                     /* # of attributes read */
+    size_t            arena_size;                 /* Size of arena */
+    size_t            query_size;                 /* Size of arena needed */
+    const char *      subset[3];                  /* Names of attributes in subset */
+    const char *      missing[2];                 /* Names including one that doesn't exist */
+    char              attrname[NAME_BUF_SIZE];    /* Name of attribute */
+    int *             data;                       /* Attribute data */
+    const char *      vl_string = "batch string"; /* Variable-length string attribute value */
+    hsize_t           dims;                       /* Dimension size */
+    htri_t            is_dense;                   /* Are attributes stored densely? */
+    unsigned          reopen;                     /* Whether the file was reopened */
+    unsigned          u, v;                       /* Local index variables */
+    herr_t            ret;                        /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Attributes in a Batch\n"));
+
+    /* Create dataset creation property list */
+    if (dcpl_g == H5P_DEFAULT) {
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+    }
+    else {
+        dcpl = H5Pcopy(dcpl_g);
+        CHECK(dcpl, FAIL, "H5Pcopy");
+    }
+
+    /* Query the attribute creation properties */
+    ret = H5Pget_attr_phase_change(dcpl, &max_compact, &min_dense);
+    CHECK(ret, FAIL, "H5Pget_attr_phase_change");
+    nint = max_compact + 2;
+    data = (int *)HDmalloc(nint * sizeof(int));
+    CHECK_PTR(data, "HDmalloc");
+
+    /* Create file & dataset */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+    dataset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Create integer attributes, attribute 'u' holding 'u + 1' values */
+    for (u = 0; u < nint; u++) {
+        dims = u + 1;
+        sid  = H5Screate_simple(1, &dims, NULL);
+        CHECK(sid, FAIL, "H5Screate_simple");
+        HDsprintf(attrname, "attr %02u", u);
+        attr = H5Acreate2(dataset, attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        for (v = 0; v <= u; v++)
+            data[v] = (int)(u * 100 + v);
+        ret = H5Awrite(attr, H5T_NATIVE_INT, data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Create a variable-length string attribute */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+    tid = H5Tcopy(H5T_C_S1);
+    CHECK(tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+    attr = H5Acreate2(dataset, "vlstr", tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr, tid, &vl_string);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Tclose(tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Attributes should be in dense storage with the new format */
+    if (new_format) {
+        is_dense = H5O__is_attr_dense_test(dataset);
+        VERIFY(is_dense, TRUE, "H5O__is_attr_dense_test");
+    } /* end if */
+
+    /* Read the attributes, before and after reopening the file */
+    for (reopen = FALSE; reopen <= TRUE; reopen++) {
+        if (reopen) {
+            ret = H5Dclose(dataset);
+            CHECK(ret, FAIL, "H5Dclose");
+            ret = H5Fclose(fid);
+            CHECK(ret, FAIL, "H5Fclose");
+            fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+            CHECK(fid, FAIL, "H5Fopen");
+            dataset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT);
+            CHECK(dataset, FAIL, "H5Dopen2");
+        } /* end if */
+
+        /* Query the sizes needed for all the attributes */
+        nattrs     = 0;
+        arena_size = 0;
+        ret        = H5Aread_batch(dataset, 0, NULL, &nattrs, NULL, &arena_size, NULL);
+        CHECK(ret, FAIL, "H5Aread_batch");
+        VERIFY(nattrs, nint + 1, "H5Aread_batch");
+        CHECK(arena_size, 0, "H5Aread_batch");
+        query_size = arena_size;
+
+        /* An arena that is too small should fail */
+        attrs = (H5A_batch_attr_t *)HDmalloc(nattrs * sizeof(H5A_batch_attr_t));
+        CHECK_PTR(attrs, "HDmalloc");
+        arena = HDmalloc(query_size);
+        CHECK_PTR(arena, "HDmalloc");
+        arena_size = query_size - 1;
+        H5E_BEGIN_TRY
+        {
+            ret = H5Aread_batch(dataset, 0, NULL, &nattrs, attrs, &arena_size, arena);
+        }
+        H5E_END_TRY;
+        VERIFY(ret, FAIL, "H5Aread_batch");
+
+        /* Read all the attributes */
+        arena_size = query_size;
+        ret        = H5Aread_batch(dataset, 0, NULL, &nattrs, attrs, &arena_size, arena);
+        CHECK(ret, FAIL, "H5Aread_batch");
+        VERIFY(nattrs, nint + 1, "H5Aread_batch");
+        VERIFY(arena_size, query_size, "H5Aread_batch");
+
+        /* Verify the attributes, returned in name order */
+        for (u = 0; u < nint; u++) {
+            HDsprintf(attrname, "attr %02u", u);
+            VERIFY_STR(attrs[u].name, attrname, "H5Aread_batch");
+            VERIFY(H5Tequal(attrs[u].type_id, H5T_NATIVE_INT), TRUE, "H5Tequal");
+            VERIFY(H5Sget_simple_extent_npoints(attrs[u].space_id), (hssize_t)(u + 1),
+                   "H5Sget_simple_extent_npoints");
+            VERIFY(attrs[u].size, (u + 1) * sizeof(int), "H5Aread_batch");
+            CHECK_PTR(attrs[u].value, "H5Aread_batch");
+            VERIFY(((size_t)((uint8_t *)attrs[u].value - (uint8_t *)arena) % 16), 0, "H5Aread_batch");
+            HDmemcpy(data, attrs[u].value, attrs[u].size);
+            for (v = 0; v <= u; v++)
+                VERIFY(data[v], (int)(u * 100 + v), "H5Aread_batch");
+        } /* end for */
+        VERIFY_STR(attrs[nint].name, "vlstr", "H5Aread_batch");
+        VERIFY(H5Tis_variable_str(attrs[nint].type_id), TRUE, "H5Tis_variable_str");
+        CHECK_PTR_NULL(attrs[nint].value, "H5Aread_batch");
+        VERIFY(attrs[nint].size, 0, "H5Aread_batch");
+        for (u = 0; u < nattrs; u++) {
+            ret = H5Tclose(attrs[u].type_id);
+            CHECK(ret, FAIL, "H5Tclose");
+            ret = H5Sclose(attrs[u].space_id);
+            CHECK(ret, FAIL, "H5Sclose");
+        } /* end for */
+
+        /* Read a subset of the attributes, in the order given */
+        subset[0]  = "attr 03";
+        subset[1]  = "vlstr";
+        subset[2]  = "attr 00";
+        nattrs     = 3;
+        arena_size = query_size;
+        ret        = H5Aread_batch(dataset, 3, subset, &nattrs, attrs, &arena_size, arena);
+        CHECK(ret, FAIL, "H5Aread_batch");
+        VERIFY(nattrs, 3, "H5Aread_batch");
+        for (u = 0; u < 3; u++)
+            VERIFY_STR(attrs[u].name, subset[u], "H5Aread_batch");
+        VERIFY(attrs[0].size, 4 * sizeof(int), "H5Aread_batch");
+        HDmemcpy(data, attrs[0].value, attrs[0].size);
+        VERIFY(data[3], 303, "H5Aread_batch");
+        CHECK_PTR_NULL(attrs[1].value, "H5Aread_batch");
+        VERIFY(attrs[2].size, sizeof(int), "H5Aread_batch");
+        HDmemcpy(data, attrs[2].value, attrs[2].size);
+        VERIFY(data[0], 0, "H5Aread_batch");
+        for (u = 0; u < nattrs; u++) {
+            ret = H5Tclose(attrs[u].type_id);
+            CHECK(ret, FAIL, "H5Tclose");
+            ret = H5Sclose(attrs[u].space_id);
+            CHECK(ret, FAIL, "H5Sclose");
+        } /* end for */
+
+        /* A name that isn't an attribute should fail */
+        missing[0] = "attr 01";
+        missing[1] = "no such attr";
+        nattrs     = 2;
+        arena_size = query_size;
+        H5E_BEGIN_TRY
+        {
+            ret = H5Aread_batch(dataset, 2, missing, &nattrs, attrs, &arena_size, arena);
+        }
+        H5E_END_TRY;
+        VERIFY(ret, FAIL, "H5Aread_batch");
+
+        HDfree(attrs);
+        HDfree(arena);
+    } /* end for */
+
+    /* Close dataset & file */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    HDfree(data);
+} /* test_attr_read_batch() */
+
 /****************************************************************
 **
 **  test_attr_shared_write(): Test basic H5A (attribute) code.
@@ -11285,6 +11509,7 @@ test_attr(void)
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
+                test_attr_read_batch(new_format, my_fcpl, my_fapl);     /* Test reading attributes in a batch */
 
                 /* Tests that address specific bugs */
                 test_attr_bug1(my_fcpl, my_fapl); /* Test odd allocation operations */
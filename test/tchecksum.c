@@ -32,6 +32,11 @@
 /**********/
 #define BUF_LEN 3093 /* No particular value */
 
+/* Size of buffer for comparing the vectorized checksums against reference
+ * versions; large enough to cover several blocks of the vector kernels.
+ */
+#define VEC_BUF_LEN (256 * 1024)
+
 /*******************/
 /* Local variables */
 /*******************/
@@ -213,6 +218,162 @@ test_chksum_large(void)
     HDfree(large_buf);
 } /* test_chksum_large() */
 
+/****************************************************************
+**
+**  ref_fletcher32(): Reference (byte-at-a-time) version of the
+**      Fletcher32 checksum, for checking the vectorized version.
+**
+****************************************************************/
+static uint32_t
+ref_fletcher32(const uint8_t *data, size_t _len)
+{
+    size_t   len  = _len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while (len) {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while (--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+
+    if (_len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return ((sum2 << 16) | sum1);
+} /* ref_fletcher32() */
+
+/****************************************************************
+**
+**  test_chksum_vector(): Check that the vectorized checksums give
+**      the same results as the reference versions for many
+**      lengths, alignments and data patterns.
+**
+****************************************************************/
+static void
+test_chksum_vector(void)
+{
+    uint8_t *buf;     /* Buffer for checksum calculations */
+    uint8_t *unalign; /* Buffer for misaligned copies */
+    uint32_t chksum;  /* Checksum value */
+    size_t   len;     /* Length of data to checksum */
+    size_t   off;     /* Offset of data within buffer */
+    size_t   u;       /* Local index variable */
+
+    /* Allocate the buffers */
+    buf = (uint8_t *)HDmalloc((size_t)VEC_BUF_LEN + 8);
+    CHECK_PTR(buf, "HDmalloc");
+    unalign = (uint8_t *)HDmalloc((size_t)VEC_BUF_LEN + 8);
+    CHECK_PTR(unalign, "HDmalloc");
+
+    /* Initialize buffer w/pseudo-random data */
+    for (u = 0; u < VEC_BUF_LEN + 8; u++)
+        buf[u] = (uint8_t)((u * 2654435761U) >> 13);
+
+    /* Short to medium lengths, at each offset within a vector word */
+    for (off = 0; off < 8; off++)
+        for (len = 1; len < 1100; len++) {
+            chksum = H5_checksum_fletcher32(buf + off, len);
+            VERIFY(chksum, ref_fletcher32(buf + off, len), "H5_checksum_fletcher32");
+        }
+
+    /* Long lengths, crossing vector block boundaries */
+    for (len = VEC_BUF_LEN - 33; len <= VEC_BUF_LEN; len++) {
+        chksum = H5_checksum_fletcher32(buf + 1, len);
+        VERIFY(chksum, ref_fletcher32(buf + 1, len), "H5_checksum_fletcher32");
+    }
+
+    /* All bits set, to stress the modular reductions */
+    HDmemset(buf, 0xff, (size_t)VEC_BUF_LEN + 8);
+    for (len = VEC_BUF_LEN - 5; len <= VEC_BUF_LEN; len++) {
+        chksum = H5_checksum_fletcher32(buf, len);
+        VERIFY(chksum, ref_fletcher32(buf, len), "H5_checksum_fletcher32");
+    }
+
+    /* Lookup3 doesn't depend on the alignment of the data */
+    for (u = 0; u < VEC_BUF_LEN + 8; u++)
+        buf[u] = (uint8_t)((u * 2654435761U) >> 11);
+    for (off = 1; off < 8; off++) {
+        HDmemcpy(unalign + off, buf, (size_t)VEC_BUF_LEN);
+        for (len = 1; len < 200; len++) {
+            chksum = H5_checksum_lookup3(unalign + off, len, 0);
+            VERIFY(chksum, H5_checksum_lookup3(buf, len, 0), "H5_checksum_lookup3");
+        }
+        chksum = H5_checksum_lookup3(unalign + off, (size_t)VEC_BUF_LEN, 0);
+        VERIFY(chksum, H5_checksum_lookup3(buf, (size_t)VEC_BUF_LEN, 0), "H5_checksum_lookup3");
+    }
+
+    /* Release memory for buffers */
+    HDfree(unalign);
+    HDfree(buf);
+} /* test_chksum_vector() */
+
+/****************************************************************
+**
+**  test_chksum_crc32c(): Checksum buffers with CRC-32C
+**
+****************************************************************/
+static void
+test_chksum_crc32c(void)
+{
+    const char *check = "123456789"; /* Standard check string */
+    uint8_t     buf[48];             /* Buffer for checksum calculations */
+    uint8_t *   large_buf;           /* Buffer for checksum calculations */
+    uint32_t    chksum;              /* Checksum value */
+    size_t      u;                   /* Local index variable */
+
+    /* Standard check value */
+    chksum = H5_checksum_crc32c(check, HDstrlen(check), 0);
+    VERIFY(chksum, 0xe3069283, "H5_checksum_crc32c");
+
+    /* iSCSI (RFC 3720) test vectors */
+    HDmemset(buf, 0, (size_t)32);
+    chksum = H5_checksum_crc32c(buf, (size_t)32, 0);
+    VERIFY(chksum, 0x8a9136aa, "H5_checksum_crc32c");
+
+    HDmemset(buf, 0xff, (size_t)32);
+    chksum = H5_checksum_crc32c(buf, (size_t)32, 0);
+    VERIFY(chksum, 0x62a8ab43, "H5_checksum_crc32c");
+
+    for (u = 0; u < 32; u++)
+        buf[u] = (uint8_t)u;
+    chksum = H5_checksum_crc32c(buf, (size_t)32, 0);
+    VERIFY(chksum, 0x46dd794e, "H5_checksum_crc32c");
+
+    /* Larger buffer, checksummed in one piece and in pieces */
+    large_buf = (uint8_t *)HDmalloc((size_t)BUF_LEN);
+    CHECK_PTR(large_buf, "HDmalloc");
+    for (u = 0; u < BUF_LEN; u++)
+        large_buf[u] = (uint8_t)(u * 3);
+
+    chksum = H5_checksum_crc32c(large_buf, (size_t)BUF_LEN, 0);
+    for (u = 1; u < BUF_LEN; u += 97) {
+        uint32_t part = H5_checksum_crc32c(large_buf, u, 0);
+
+        part = H5_checksum_crc32c(large_buf + u, (size_t)BUF_LEN - u, part);
+        VERIFY(part, chksum, "H5_checksum_crc32c");
+    }
+
+    /* Unaligned start */
+    chksum = H5_checksum_crc32c(large_buf, (size_t)BUF_LEN - 1, 0);
+    HDmemmove(large_buf + 1, large_buf, (size_t)BUF_LEN - 1);
+    VERIFY(H5_checksum_crc32c(large_buf + 1, (size_t)BUF_LEN - 1, 0), chksum, "H5_checksum_crc32c");
+
+    HDfree(large_buf);
+} /* test_chksum_crc32c() */
+
 /****************************************************************
 **
 **  test_checksum(): Main checksum testing routine.
@@ -230,6 +391,10 @@ test_checksum(void)
     test_chksum_size_three(); /* Test buffer w/only 3 bytes */
     test_chksum_size_four();  /* Test buffer w/only 4 bytes */
     test_chksum_large();      /* Test buffer w/larger # of bytes */
+    test_chksum_vector();     /* Test vectorized checksums against reference */
+
+    /* Checks for CRC-32C checksum algorithm */
+    test_chksum_crc32c();
 
 } /* test_checksum() */
 
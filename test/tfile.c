@@ -138,6 +138,12 @@
 /* Declaration for test_incr_filesize() */
 #define FILE8 "tfile8.h5" /* Test file */
 
+/* Declaration for test_metadata_checksum() */
+#define FILE9            "tfile9.h5" /* Test file */
+#define CHKSUM_NGROUPS   20          /* # of links, to create dense link storage */
+#define CHKSUM_NELMTS    1000        /* # of elements in dataset */
+#define CHKSUM_CHUNK_DIM 10          /* Chunk size of dataset */
+
 /* Files created under 1.6 branch and 1.8 branch--used in test_filespace_compatible() */
 const char *OLD_FILENAME[] = {
     "filespace_1_6.h5", /* 1.6 HDF5 file */
@@ -7739,6 +7745,164 @@ test_min_dset_ohdr(void)
     CHECK(ret, FAIL, "H5Fclose");
 } /* end test_min_dset_ohdr() */
 
+/****************************************************************
+**
+**  test_metadata_checksum():
+**    Verify that files can be created with CRC-32C metadata
+**    checksums, that the algorithm is recorded in a version 4
+**    superblock, and that the file's metadata can be read back.
+**
+****************************************************************/
+static void
+test_metadata_checksum(void)
+{
+    hid_t                   fid;                    /* File ID */
+    hid_t                   fcpl;                   /* File creation property list */
+    hid_t                   fapl;                   /* File access property list */
+    hid_t                   fcpl2;                  /* File creation property list from file */
+    hid_t                   gid;                    /* Group ID */
+    hid_t                   sid;                    /* Dataspace ID */
+    hid_t                   dcpl;                   /* Dataset creation property list */
+    hid_t                   did;                    /* Dataset ID */
+    hsize_t                 dims[1]    = {CHKSUM_NELMTS};
+    hsize_t                 maxdims[1] = {H5S_UNLIMITED};
+    hsize_t                 chunk[1]   = {CHKSUM_CHUNK_DIM};
+    int                     wbuf[CHKSUM_NELMTS];    /* Data written */
+    int                     rbuf[CHKSUM_NELMTS];    /* Data read */
+    char                    filename[FILENAME_LEN]; /* Filename to use */
+    char                    name[32];               /* Object name */
+    H5F_info2_t             finfo;                  /* File info */
+    H5F_metadata_checksum_t alg;                    /* Metadata checksum algorithm */
+    unsigned                u;                      /* Local index variable */
+    herr_t                  ret;                    /* Return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing metadata checksum algorithm\n"));
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILE9, fapl, filename, sizeof filename);
+
+    /* Check the default & invalid settings */
+    fcpl = H5Pcreate(H5P_FILE_CREATE);
+    CHECK(fcpl, FAIL, "H5Pcreate");
+
+    ret = H5Pget_metadata_checksum(fcpl, &alg);
+    CHECK(ret, FAIL, "H5Pget_metadata_checksum");
+    VERIFY(alg, H5F_METADATA_CHECKSUM_LOOKUP3, "H5Pget_metadata_checksum");
+
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_metadata_checksum(fcpl, H5F_METADATA_CHECKSUM_NTYPES);
+    }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_metadata_checksum");
+
+    ret = H5Pset_metadata_checksum(fcpl, H5F_METADATA_CHECKSUM_CRC32C);
+    CHECK(ret, FAIL, "H5Pset_metadata_checksum");
+
+    /* Creating the file needs the "latest" format */
+    ret = H5Pset_libver_bounds(fapl, H5F_LIBVER_EARLIEST, H5F_LIBVER_V112);
+    CHECK(ret, FAIL, "H5Pset_libver_bounds");
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    }
+    H5E_END_TRY;
+    VERIFY(fid, FAIL, "H5Fcreate");
+
+    ret = H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+    CHECK(ret, FAIL, "H5Pset_libver_bounds");
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create enough groups for dense link storage (fractal heap & v2 B-trees) */
+    for (u = 0; u < CHKSUM_NGROUPS; u++) {
+        HDsprintf(name, "group %u", u);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gcreate2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+
+    /* Create a chunked dataset (extensible array chunk index) */
+    sid = H5Screate_simple(1, dims, maxdims);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+
+    for (u = 0; u < CHKSUM_NELMTS; u++)
+        wbuf[u] = (int)(u * 7);
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file and check the superblock version & algorithm */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    ret = H5Fget_info2(fid, &finfo);
+    CHECK(ret, FAIL, "H5Fget_info2");
+    VERIFY(finfo.super.version, HDF5_SUPERBLOCK_VERSION_4, "H5Fget_info2");
+
+    fcpl2 = H5Fget_create_plist(fid);
+    CHECK(fcpl2, FAIL, "H5Fget_create_plist");
+    ret = H5Pget_metadata_checksum(fcpl2, &alg);
+    CHECK(ret, FAIL, "H5Pget_metadata_checksum");
+    VERIFY(alg, H5F_METADATA_CHECKSUM_CRC32C, "H5Pget_metadata_checksum");
+    ret = H5Pclose(fcpl2);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Read back the metadata & data */
+    for (u = 0; u < CHKSUM_NGROUPS; u++) {
+        HDsprintf(name, "group %u", u);
+        gid = H5Gopen2(fid, name, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gopen2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+
+    did = H5Dopen2(fid, "dset", H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dopen2");
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for (u = 0; u < CHKSUM_NELMTS; u++)
+        VERIFY(rbuf[u], wbuf[u], "H5Dread");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* The file can't be opened with a high bound that doesn't allow it */
+    ret = H5Pset_libver_bounds(fapl, H5F_LIBVER_EARLIEST, H5F_LIBVER_V112);
+    CHECK(ret, FAIL, "H5Pset_libver_bounds");
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    }
+    H5E_END_TRY;
+    VERIFY(fid, FAIL, "H5Fopen");
+
+    ret = H5Pclose(fcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+} /* end test_metadata_checksum() */
+
 /****************************************************************
 **
 **  test_deprec():
@@ -8037,6 +8201,7 @@ test_file(void)
     test_libver_macros2(); /* Test the macros for library version comparison */
     test_incr_filesize();  /* Test H5Fincrement_filesize() and H5Fget_eoa() */
     test_min_dset_ohdr();  /* Test datset object header minimization */
+    test_metadata_checksum(); /* Test CRC-32C metadata checksums */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_file_ishdf5(env_h5_drvr); /* Test detecting HDF5 files correctly */
     test_deprec();                 /* Test deprecated routines */
@@ -8072,5 +8237,6 @@ cleanup_file(void)
     HDremove(FILE5);
     HDremove(FILE6);
     HDremove(FILE7);
+    HDremove(FILE9);
     HDremove(DST_FILE);
 }
@@ -15913,6 +15913,318 @@ test_hyper_io_1d(void)
 
 } /* test_hyper_io_1d() */
 
+/****************************************************************
+**
+**  test_select_point_unsorted():
+**  Test that reading and writing point selections whose points
+**  jump around the dataset, repeat, or run next to each other,
+**  moves each element to and from its own place in memory, for
+**  contiguous and chunked datasets.
+**
+****************************************************************/
+#define POINT_SORT_DIM     32
+#define POINT_SORT_CHUNK   8
+#define POINT_SORT_NPOINTS 300
+static void
+test_select_point_unsorted(void)
+{
+    hid_t    fid;                                                 /* File ID */
+    hid_t    did;                                                 /* Dataset ID */
+    hid_t    sid, mid;                                            /* Dataspace IDs */
+    hid_t    dcpl;                                                /* Dataset creation property list ID */
+    hsize_t  dims[2]       = {POINT_SORT_DIM, POINT_SORT_DIM};     /* Dataset dimensions */
+    hsize_t  chunk_dims[2] = {POINT_SORT_CHUNK, POINT_SORT_CHUNK}; /* Chunk dimensions */
+    hsize_t  mdims[1]      = {2 * POINT_SORT_NPOINTS};             /* Memory dimensions */
+    hsize_t  start[1]      = {1};                                  /* Memory hyperslab start */
+    hsize_t  stride[1]     = {2};                                  /* Memory hyperslab stride */
+    hsize_t  count[1]      = {POINT_SORT_NPOINTS};                 /* Memory hyperslab count */
+    hsize_t(*coord)[2];                                            /* Coordinates of points */
+    int(*data)[POINT_SORT_DIM];                                    /* Data in the dataset */
+    int(*expect)[POINT_SORT_DIM];                                  /* Expected data in the dataset */
+    int      buf[2 * POINT_SORT_NPOINTS];                          /* Buffer for points */
+    unsigned rand_val = 1;                                         /* Pseudo-random value */
+    unsigned layout;                                               /* Dataset layout to test */
+    unsigned u, v;                                                 /* Local index variables */
+    herr_t   ret;                                                  /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing I/O on unsorted point selections\n"));
+
+    /* Allocate buffers */
+    coord = (hsize_t(*)[2])HDmalloc(sizeof(hsize_t) * POINT_SORT_NPOINTS * 2);
+    CHECK_PTR(coord, "HDmalloc");
+    data = (int(*)[POINT_SORT_DIM])HDmalloc(sizeof(int) * POINT_SORT_DIM * POINT_SORT_DIM);
+    CHECK_PTR(data, "HDmalloc");
+    expect = (int(*)[POINT_SORT_DIM])HDmalloc(sizeof(int) * POINT_SORT_DIM * POINT_SORT_DIM);
+    CHECK_PTR(expect, "HDmalloc");
+
+    /* Pick points all over the dataset, with some repeats and some runs of neighbors */
+    for (u = 0; u < POINT_SORT_NPOINTS; u++) {
+        if (u % 10 == 9) {
+            /* Repeat an earlier point */
+            coord[u][0] = coord[u / 2][0];
+            coord[u][1] = coord[u / 2][1];
+        } /* end if */
+        else if (u % 10 >= 5 && coord[u - 1][1] + 1 < POINT_SORT_DIM) {
+            /* Next to the previous point */
+            coord[u][0] = coord[u - 1][0];
+            coord[u][1] = coord[u - 1][1] + 1;
+        } /* end if */
+        else {
+            rand_val    = rand_val * 1103515245 + 12345;
+            coord[u][0] = (rand_val >> 16) % POINT_SORT_DIM;
+            rand_val    = rand_val * 1103515245 + 12345;
+            coord[u][1] = (rand_val >> 16) % POINT_SORT_DIM;
+        } /* end else */
+    }     /* end for */
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    mid = H5Screate_simple(1, mdims, NULL);
+    CHECK(mid, H5I_INVALID_HID, "H5Screate_simple");
+    ret = H5Sselect_hyperslab(mid, H5S_SELECT_SET, start, stride, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+
+    for (layout = 0; layout < 2; layout++) {
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+        if (layout == 1) {
+            ret = H5Pset_chunk(dcpl, 2, chunk_dims);
+            CHECK(ret, FAIL, "H5Pset_chunk");
+        } /* end if */
+        did = H5Dcreate2(fid, layout == 0 ? "contig" : "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl,
+                         H5P_DEFAULT);
+        CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+
+        for (u = 0; u < POINT_SORT_DIM; u++)
+            for (v = 0; v < POINT_SORT_DIM; v++)
+                expect[u][v] = (int)(u * POINT_SORT_DIM + v);
+        ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, expect);
+        CHECK(ret, FAIL, "H5Dwrite");
+
+        /* Read the points, into every other element of the buffer */
+        ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)POINT_SORT_NPOINTS, (const hsize_t *)coord);
+        CHECK(ret, FAIL, "H5Sselect_elements");
+        HDmemset(buf, 0, sizeof(buf));
+        ret = H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dread");
+        for (u = 0; u < POINT_SORT_NPOINTS; u++) {
+            VERIFY(buf[2 * u], 0, "H5Dread");
+            VERIFY(buf[2 * u + 1], expect[coord[u][0]][coord[u][1]], "H5Dread");
+        } /* end for */
+
+        /* Write the points, the last write of a repeated point should win */
+        for (u = 0; u < POINT_SORT_NPOINTS; u++) {
+            buf[2 * u + 1]                   = (int)(100000 + u);
+            expect[coord[u][0]][coord[u][1]] = (int)(100000 + u);
+        } /* end for */
+        ret = H5Dwrite(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+
+        ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        CHECK(ret, FAIL, "H5Dread");
+        for (u = 0; u < POINT_SORT_DIM; u++)
+            for (v = 0; v < POINT_SORT_DIM; v++)
+                VERIFY(data[u][v], expect[u][v], "H5Dread");
+
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Pclose(dcpl);
+        CHECK(ret, FAIL, "H5Pclose");
+    } /* end for */
+
+    ret = H5Sclose(mid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Release buffers */
+    HDfree(expect);
+    HDfree(data);
+    HDfree(coord);
+} /* test_select_point_unsorted() */
+
+/****************************************************************
+**
+**  test_select_hyper_blocklist():
+**  Test selecting lists of hyperslab blocks with
+**  H5Sselect_hyper_blocklist(), and that the selections
+**  match the same blocks selected one at a time.
+**
+****************************************************************/
+#define BLOCKLIST_RANK    3
+#define BLOCKLIST_DIM     16
+#define BLOCKLIST_NBLOCKS 200
+static void
+test_select_hyper_blocklist(void)
+{
+    hsize_t        dims[BLOCKLIST_RANK]   = {BLOCKLIST_DIM, BLOCKLIST_DIM, BLOCKLIST_DIM}; /* Dimensions */
+    hsize_t        start[BLOCKLIST_RANK]  = {1, 0, 2}; /* Hyperslab start */
+    hsize_t        stride[BLOCKLIST_RANK] = {4, 3, 5}; /* Hyperslab stride */
+    hsize_t        count[BLOCKLIST_RANK]  = {4, 5, 3}; /* Hyperslab count */
+    hsize_t        block[BLOCKLIST_RANK]  = {2, 2, 3}; /* Hyperslab block */
+    hid_t          sid1, sid2, tmp_sid;                /* Dataspace IDs */
+    hsize_t        blk_count[BLOCKLIST_RANK];          /* Size of a block */
+    hsize_t *      blocks;                             /* List of blocks */
+    hsize_t *      blocks2;                            /* List of blocks */
+    hssize_t       nblocks;                            /* Number of blocks */
+    unsigned char *sbuf;                               /* Encoded dataspace */
+    size_t         sbuf_size = 0;                      /* Size of encoded dataspace */
+    unsigned       rand_val  = 7;                      /* Pseudo-random value */
+    unsigned       u, v;                               /* Local index variables */
+    htri_t         check;                              /* Shape comparison result */
+    herr_t         ret;                                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing selecting lists of hyperslab blocks\n"));
+
+    /* Allocate buffers */
+    blocks = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * BLOCKLIST_RANK * BLOCKLIST_NBLOCKS);
+    CHECK_PTR(blocks, "HDmalloc");
+    blocks2 = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * BLOCKLIST_RANK * BLOCKLIST_NBLOCKS);
+    CHECK_PTR(blocks2, "HDmalloc");
+
+    sid1 = H5Screate_simple(BLOCKLIST_RANK, dims, NULL);
+    CHECK(sid1, H5I_INVALID_HID, "H5Screate_simple");
+    sid2 = H5Screate_simple(BLOCKLIST_RANK, dims, NULL);
+    CHECK(sid2, H5I_INVALID_HID, "H5Screate_simple");
+
+    /* Make an irregular selection and get its (sorted) list of blocks */
+    ret = H5Sselect_hyperslab(sid1, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid1, H5S_SELECT_NOTB, start, NULL, block, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    nblocks = H5Sget_select_hyper_nblocks(sid1);
+    CHECK(nblocks, FAIL, "H5Sget_select_hyper_nblocks");
+    HDassert(nblocks <= BLOCKLIST_NBLOCKS);
+    ret = H5Sget_select_hyper_blocklist(sid1, (hsize_t)0, (hsize_t)nblocks, blocks);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+
+    /* Selecting the same blocks should give the same selection, and the same list of blocks */
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_SET, (hsize_t)nblocks, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_npoints(sid2), H5Sget_select_npoints(sid1), "H5Sget_select_npoints");
+    VERIFY(H5Sget_select_hyper_nblocks(sid2), nblocks, "H5Sget_select_hyper_nblocks");
+    ret = H5Sget_select_hyper_blocklist(sid2, (hsize_t)0, (hsize_t)nblocks, blocks2);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+    for (u = 0; u < (unsigned)nblocks * 2 * BLOCKLIST_RANK; u++)
+        VERIFY(blocks2[u], blocks[u], "H5Sget_select_hyper_blocklist");
+
+    /* Pick overlapping blocks in no particular order */
+    for (u = 0; u < BLOCKLIST_NBLOCKS; u++)
+        for (v = 0; v < BLOCKLIST_RANK; v++) {
+            hsize_t *blk = &blocks[u * 2 * BLOCKLIST_RANK];
+
+            rand_val                = rand_val * 1103515245 + 12345;
+            blk[v]                  = (rand_val >> 16) % (BLOCKLIST_DIM - 3);
+            rand_val                = rand_val * 1103515245 + 12345;
+            blk[BLOCKLIST_RANK + v] = blk[v] + (rand_val >> 16) % 4;
+        } /* end for */
+
+    /* Select them one at a time, and all at once */
+    for (u = 0; u < BLOCKLIST_NBLOCKS; u++) {
+        hsize_t *blk = &blocks[u * 2 * BLOCKLIST_RANK];
+
+        for (v = 0; v < BLOCKLIST_RANK; v++)
+            blk_count[v] = (blk[BLOCKLIST_RANK + v] - blk[v]) + 1;
+        ret = H5Sselect_hyperslab(sid1, u == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, blk, NULL, blk_count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_SET, (hsize_t)BLOCKLIST_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+    /* Verify the selections are the same */
+    VERIFY(H5Sget_select_npoints(sid2), H5Sget_select_npoints(sid1), "H5Sget_select_npoints");
+    tmp_sid = H5Scombine_select(sid1, H5S_SELECT_AND, sid2);
+    CHECK(tmp_sid, H5I_INVALID_HID, "H5Scombine_select");
+    VERIFY(H5Sget_select_npoints(tmp_sid), H5Sget_select_npoints(sid1), "H5Sget_select_npoints");
+    ret = H5Sclose(tmp_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Encoding and decoding the irregular selection should give the same selection */
+    ret = H5Sencode2(sid2, NULL, &sbuf_size, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Sencode2");
+    sbuf = (unsigned char *)HDmalloc(sbuf_size);
+    CHECK_PTR(sbuf, "HDmalloc");
+    ret = H5Sencode2(sid2, sbuf, &sbuf_size, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Sencode2");
+    tmp_sid = H5Sdecode(sbuf);
+    CHECK(tmp_sid, H5I_INVALID_HID, "H5Sdecode");
+    VERIFY(H5Sget_select_npoints(tmp_sid), H5Sget_select_npoints(sid2), "H5Sget_select_npoints");
+    check = H5Sselect_shape_same(tmp_sid, sid2);
+    VERIFY(check, TRUE, "H5Sselect_shape_same");
+    ret = H5Sclose(tmp_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    HDfree(sbuf);
+
+    /* Combine blocks with an existing selection, one at a time and all at once */
+    ret = H5Sselect_hyperslab(sid1, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Sselect_hyperslab(sid2, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for (u = 0; u < BLOCKLIST_NBLOCKS / 4; u++) {
+        hsize_t *blk = &blocks[u * 2 * BLOCKLIST_RANK];
+
+        for (v = 0; v < BLOCKLIST_RANK; v++)
+            blk_count[v] = (blk[BLOCKLIST_RANK + v] - blk[v]) + 1;
+        ret = H5Sselect_hyperslab(sid1, H5S_SELECT_NOTB, blk, NULL, blk_count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_NOTB, (hsize_t)(BLOCKLIST_NBLOCKS / 4), blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_npoints(sid2), H5Sget_select_npoints(sid1), "H5Sget_select_npoints");
+    tmp_sid = H5Scombine_select(sid1, H5S_SELECT_AND, sid2);
+    CHECK(tmp_sid, H5I_INVALID_HID, "H5Scombine_select");
+    VERIFY(H5Sget_select_npoints(tmp_sid), H5Sget_select_npoints(sid1), "H5Sget_select_npoints");
+    ret = H5Sclose(tmp_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Combine blocks with "none" and "all" selections */
+    ret = H5Sselect_none(sid2);
+    CHECK(ret, FAIL, "H5Sselect_none");
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_AND, (hsize_t)BLOCKLIST_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_type(sid2), H5S_SEL_NONE, "H5Sget_select_type");
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_OR, (hsize_t)1, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_type(sid2), H5S_SEL_HYPERSLABS, "H5Sget_select_type");
+    ret = H5Sselect_all(sid2);
+    CHECK(ret, FAIL, "H5Sselect_all");
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_OR, (hsize_t)BLOCKLIST_NBLOCKS, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_type(sid2), H5S_SEL_ALL, "H5Sget_select_type");
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_AND, (hsize_t)1, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_hyper_nblocks(sid2), 1, "H5Sget_select_hyper_nblocks");
+
+    /* An empty list of blocks selects nothing */
+    ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_SET, (hsize_t)0, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    VERIFY(H5Sget_select_type(sid2), H5S_SEL_NONE, "H5Sget_select_type");
+
+    /* A block which ends before it starts is an error */
+    blocks[0] = blocks[BLOCKLIST_RANK] + 1;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Sselect_hyper_blocklist(sid2, H5S_SELECT_SET, (hsize_t)BLOCKLIST_NBLOCKS, blocks);
+    }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Release buffers */
+    HDfree(blocks2);
+    HDfree(blocks);
+} /* test_select_hyper_blocklist() */
+
 /****************************************************************
 **
 **  test_h5s_set_extent_none:
@@ -16177,6 +16489,10 @@ test_select(void)
     /* Test reading of 1-d disjoint file space to 1-d single block memory space */
     test_hyper_io_1d();
 
+    /* Test I/O on unsorted point selections */
+    test_select_point_unsorted();
+    test_select_hyper_blocklist();
+
     /* Test H5Sset_extent_none() functionality after we updated it to set
      * the class to H5S_NULL instead of H5S_NO_CLASS.
      */
@@ -41,6 +41,10 @@
 #define SPACE4_DIM_SMALL 128
 #define SPACE4_DIM_LARGE (H5D_TEMP_BUF_SIZE / 64)
 
+/* 1-D dataset read into a VL data arena, large enough to need several blocks */
+#define SPACE5_RANK 1
+#define SPACE5_DIM1 20000
+
 void *test_vltypes_alloc_custom(size_t size, void *info);
 void  test_vltypes_free_custom(void *mem, void *info);
 
@@ -2108,6 +2112,256 @@ test_vltypes_vlen_vlen_atomic(void)
 
 } /* end test_vltypes_vlen_vlen_atomic() */
 
+/****************************************************************
+**
+**  test_vltypes_arena(): Test reading VL data into an arena.
+**      Tests that nested VL sequences and VL strings read with
+**      H5Pset_vlen_arena() end up in one block, which is freed
+**      with H5Dvlen_arena_free().
+**
+****************************************************************/
+static void
+test_vltypes_arena(void)
+{
+    hvl_t *           wdata = NULL;                    /* Information to write */
+    hvl_t *           rdata = NULL;                    /* Information read in */
+    char **           wstr  = NULL;                    /* Strings to write */
+    char **           rstr  = NULL;                    /* Strings read in */
+    hvl_t *           t1, *t2;                         /* Temporary pointers to VL information */
+    H5D_vlen_arena_t  arena;                           /* Arena for VL data read */
+    H5D_vlen_arena_t *parena;                          /* Arena retrieved from the DXPL */
+    hid_t             fid1;                            /* HDF5 File IDs */
+    hid_t             dataset, dset_str;               /* Dataset IDs */
+    hid_t             sid1;                            /* Dataspace ID */
+    hid_t             tid1, tid2, tid_str;             /* Datatype IDs */
+    hid_t             xfer_pid;                        /* Dataset transfer property list ID */
+    hid_t             multi_did[2];                    /* Dataset IDs for a multi-dataset read */
+    hid_t             multi_tid[2];                    /* Datatype IDs for a multi-dataset read */
+    hid_t             multi_sid[2];                    /* Dataspace IDs for a multi-dataset read */
+    void *            multi_rbufs[2];                  /* Buffers for a multi-dataset read */
+    hsize_t           dims1[] = {SPACE5_DIM1};
+    size_t            nseqs = 0;                       /* Number of sequences written */
+    unsigned          i, j, k;                         /* counting variables */
+    herr_t            ret;                             /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading VL Data into an Arena\n"));
+
+    wdata = (hvl_t *)HDcalloc(SPACE5_DIM1, sizeof(hvl_t));
+    CHECK_PTR(wdata, "HDcalloc");
+    rdata = (hvl_t *)HDcalloc(SPACE5_DIM1, sizeof(hvl_t));
+    CHECK_PTR(rdata, "HDcalloc");
+    wstr = (char **)HDcalloc(SPACE5_DIM1, sizeof(char *));
+    CHECK_PTR(wstr, "HDcalloc");
+    rstr = (char **)HDcalloc(SPACE5_DIM1, sizeof(char *));
+    CHECK_PTR(rstr, "HDcalloc");
+
+    /* Allocate and initialize VL data to write, with some empty sequences */
+    for (i = 0; i < SPACE5_DIM1; i++) {
+        wdata[i].len = i % 5;
+        if (wdata[i].len) {
+            wdata[i].p = HDmalloc(wdata[i].len * sizeof(hvl_t));
+            CHECK_PTR(wdata[i].p, "HDmalloc");
+            nseqs++;
+        } /* end if */
+        for (t1 = (hvl_t *)(wdata[i].p), j = 0; j < wdata[i].len; j++, t1++) {
+            t1->len = j + 1;
+            t1->p   = HDmalloc(t1->len * sizeof(unsigned int));
+            CHECK_PTR(t1->p, "HDmalloc");
+            nseqs++;
+            for (k = 0; k < t1->len; k++)
+                ((unsigned int *)t1->p)[k] = i * 100 + j * 10 + k;
+        } /* end for */
+
+        wstr[i] = (char *)HDmalloc(16);
+        CHECK_PTR(wstr[i], "HDmalloc");
+        HDsnprintf(wstr[i], 16, "s%u", i);
+    } /* end for */
+
+    /* Create file */
+    fid1 = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fcreate");
+
+    /* Create dataspace for datasets */
+    sid1 = H5Screate_simple(SPACE5_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+
+    /* Create the datatypes */
+    tid1 = H5Tvlen_create(H5T_NATIVE_UINT);
+    CHECK(tid1, FAIL, "H5Tvlen_create");
+    tid2 = H5Tvlen_create(tid1);
+    CHECK(tid2, FAIL, "H5Tvlen_create");
+    tid_str = H5Tcopy(H5T_C_S1);
+    CHECK(tid_str, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid_str, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    /* Create and write the datasets */
+    dataset = H5Dcreate2(fid1, "Dataset1", tid2, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dataset, tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    dset_str = H5Dcreate2(fid1, "Strings", tid_str, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset_str, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset_str, tid_str, H5S_ALL, H5S_ALL, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Read into an arena */
+    xfer_pid = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(xfer_pid, FAIL, "H5Pcreate");
+    HDmemset(&arena, 0, sizeof(arena));
+    ret = H5Pset_vlen_arena(xfer_pid, &arena);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+    ret = H5Pget_vlen_arena(xfer_pid, &parena);
+    CHECK(ret, FAIL, "H5Pget_vlen_arena");
+    VERIFY((parena == &arena), TRUE, "H5Pget_vlen_arena");
+
+    ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+    CHECK_PTR(arena.buf, "H5Dread");
+    CHECK_PTR(arena.offset, "H5Dread");
+    VERIFY(arena.nseqs, nseqs, "H5Dread");
+
+    /* Compare data read in, and check it's all in the arena's block */
+    for (i = 0; i < SPACE5_DIM1; i++) {
+        if (wdata[i].len != rdata[i].len) {
+            TestErrPrintf("%d: VL data length don't match!, wdata[%u].len=%u, rdata[%u].len=%u\n", __LINE__, i,
+                          (unsigned)wdata[i].len, i, (unsigned)rdata[i].len);
+            break;
+        } /* end if */
+        if (rdata[i].len && ((uint8_t *)rdata[i].p < (uint8_t *)arena.buf ||
+                             (uint8_t *)rdata[i].p >= (uint8_t *)arena.buf + arena.size)) {
+            TestErrPrintf("%d: VL data for element %u isn't in the arena\n", __LINE__, i);
+            break;
+        } /* end if */
+        for (t1 = (hvl_t *)wdata[i].p, t2 = (hvl_t *)(rdata[i].p), j = 0; j < rdata[i].len; j++, t1++, t2++) {
+            if (t1->len != t2->len) {
+                TestErrPrintf("%d: VL data length don't match!, i=%u, j=%u\n", __LINE__, i, j);
+                break;
+            } /* end if */
+            if ((uint8_t *)t2->p < (uint8_t *)arena.buf ||
+                (uint8_t *)t2->p + t2->len * sizeof(unsigned int) > (uint8_t *)arena.buf + arena.size) {
+                TestErrPrintf("%d: nested VL data for element %u isn't in the arena\n", __LINE__, i);
+                break;
+            } /* end if */
+            for (k = 0; k < t2->len; k++)
+                if (((unsigned int *)t1->p)[k] != ((unsigned int *)t2->p)[k]) {
+                    TestErrPrintf("%d: VL data values don't match!, i=%u, j=%u, k=%u\n", __LINE__, i, j, k);
+                    break;
+                } /* end if */
+        }     /* end for */
+    }         /* end for */
+
+    /* A read can't add to an arena which holds data */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+    }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Dread");
+
+    ret = H5Dvlen_arena_free(&arena);
+    CHECK(ret, FAIL, "H5Dvlen_arena_free");
+    VERIFY((arena.buf == NULL && arena.offset == NULL && arena.size == 0 && arena.nseqs == 0), TRUE,
+           "H5Dvlen_arena_free");
+
+    /* Strings are packed in the order they're read */
+    ret = H5Dread(dset_str, tid_str, H5S_ALL, H5S_ALL, xfer_pid, rstr);
+    CHECK(ret, FAIL, "H5Dread");
+    VERIFY(arena.nseqs, SPACE5_DIM1, "H5Dread");
+    for (i = 0; i < SPACE5_DIM1; i++) {
+        if (rstr[i] != (char *)arena.buf + arena.offset[i]) {
+            TestErrPrintf("%d: string %u isn't at its offset in the arena\n", __LINE__, i);
+            break;
+        } /* end if */
+        if (HDstrcmp(wstr[i], rstr[i]) != 0) {
+            TestErrPrintf("%d: VL strings don't match!, wstr[%u]=%s, rstr[%u]=%s\n", __LINE__, i, wstr[i], i,
+                          rstr[i]);
+            break;
+        } /* end if */
+    }     /* end for */
+    ret = H5Dvlen_arena_free(&arena);
+    CHECK(ret, FAIL, "H5Dvlen_arena_free");
+
+    /* Both datasets read at once share the arena */
+    HDmemset(rdata, 0, SPACE5_DIM1 * sizeof(hvl_t));
+    HDmemset(rstr, 0, SPACE5_DIM1 * sizeof(char *));
+    multi_did[0]   = dataset;
+    multi_did[1]   = dset_str;
+    multi_tid[0]   = tid2;
+    multi_tid[1]   = tid_str;
+    multi_sid[0]   = H5S_ALL;
+    multi_sid[1]   = H5S_ALL;
+    multi_rbufs[0] = rdata;
+    multi_rbufs[1] = rstr;
+    ret = H5Dread_multi((size_t)2, multi_did, multi_tid, multi_sid, multi_sid, xfer_pid, multi_rbufs);
+    CHECK(ret, FAIL, "H5Dread_multi");
+    VERIFY(arena.nseqs, nseqs + SPACE5_DIM1, "H5Dread_multi");
+    for (i = 0; i < SPACE5_DIM1; i++) {
+        if (wdata[i].len != rdata[i].len) {
+            TestErrPrintf("%d: VL data length don't match!, wdata[%u].len=%u, rdata[%u].len=%u\n", __LINE__, i,
+                          (unsigned)wdata[i].len, i, (unsigned)rdata[i].len);
+            break;
+        } /* end if */
+        for (t1 = (hvl_t *)wdata[i].p, t2 = (hvl_t *)(rdata[i].p), j = 0; j < rdata[i].len; j++, t1++, t2++) {
+            if (t1->len != t2->len) {
+                TestErrPrintf("%d: VL data length don't match!, i=%u, j=%u\n", __LINE__, i, j);
+                break;
+            } /* end if */
+            if ((uint8_t *)t2->p < (uint8_t *)arena.buf ||
+                (uint8_t *)t2->p + t2->len * sizeof(unsigned int) > (uint8_t *)arena.buf + arena.size) {
+                TestErrPrintf("%d: nested VL data for element %u isn't in the arena\n", __LINE__, i);
+                break;
+            } /* end if */
+            for (k = 0; k < t2->len; k++)
+                if (((unsigned int *)t1->p)[k] != ((unsigned int *)t2->p)[k]) {
+                    TestErrPrintf("%d: VL data values don't match!, i=%u, j=%u, k=%u\n", __LINE__, i, j, k);
+                    break;
+                } /* end if */
+        }     /* end for */
+        if (rstr[i] != (char *)arena.buf + arena.offset[nseqs + i]) {
+            TestErrPrintf("%d: string %u isn't at its offset in the arena\n", __LINE__, i);
+            break;
+        } /* end if */
+        if (HDstrcmp(wstr[i], rstr[i]) != 0) {
+            TestErrPrintf("%d: VL strings don't match!, wstr[%u]=%s, rstr[%u]=%s\n", __LINE__, i, wstr[i], i,
+                          rstr[i]);
+            break;
+        } /* end if */
+    }     /* end for */
+    ret = H5Dvlen_arena_free(&arena);
+    CHECK(ret, FAIL, "H5Dvlen_arena_free");
+
+    /* Reclaim the write VL data */
+    ret = H5Treclaim(tid2, sid1, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Treclaim");
+    ret = H5Treclaim(tid_str, sid1, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Treclaim");
+
+    /* Close everything */
+    ret = H5Dclose(dset_str);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid_str);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid2);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid1);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(xfer_pid);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(rstr);
+    HDfree(wstr);
+    HDfree(rdata);
+    HDfree(wdata);
+} /* end test_vltypes_arena() */
+
 /****************************************************************
 **
 **  rewrite_longer_vltypes_vlen_vlen_atomic(): Test basic VL datatype code.
@@ -3240,6 +3494,7 @@ test_vltypes(void)
     test_vltypes_vlen_vlen_atomic();            /* Test VL datatype with VL atomic components */
     rewrite_longer_vltypes_vlen_vlen_atomic();  /*overwrite with VL data of longer sequence*/
     rewrite_shorter_vltypes_vlen_vlen_atomic(); /*overwrite with VL data of shorted sequence*/
+    test_vltypes_arena();                       /* Test reading VL data into an arena */
     test_vltypes_compound_vlen_vlen();          /* Test compound datatypes with VL atomic components */
     test_vltypes_compound_vlstr();              /* Test data rewritten of nested VL data */
     test_vltypes_fill_value();                  /* Test fill value for VL data */
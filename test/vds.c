@@ -16,8 +16,10 @@
  *
  * Purpose:     Tests datasets with virtual layout.
  */
+#define H5D_FRIEND /*suppress error about including H5Dpkg */
+#define H5D_TESTING
 #include "h5test.h"
-#include "H5Dprivate.h" /* For H5D_VIRTUAL_DEF_LIST_SIZE */
+#include "H5Dpkg.h" /* For H5D_VIRTUAL_DEF_LIST_SIZE and H5D_VIRTUAL_MAX_OPEN_SRC_DSETS */
 
 typedef enum {
     TEST_API_BASIC,
@@ -31,7 +33,7 @@ typedef enum {
 
 const char *FILENAME[] = {"vds_virt_0", "vds_virt_1", "vds_src_0",  "vds_src_1", "vds%%_src",
                           "vds_dapl",   "vds_virt_2", "vds_virt_3", "vds_src_2", "vds_src_3",
-                          "vds%%_src2", "vds_dapl2",  NULL};
+                          "vds%%_src2", "vds_dapl2",  "vds_src_lru", "vds_map_index", NULL};
 
 /* Define to enable verbose test output */
 /* #define VDS_TEST_VERBOSE 1 */
@@ -12266,6 +12268,425 @@ error:
     return 1;
 } /* end test_dapl_values() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_src_dset_lru
+ *
+ * Purpose:     Tests I/O on a virtual dataset with more source datasets
+ *              than are kept open between I/O operations.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *-------------------------------------------------------------------------
+ */
+#define SRC_LRU_NSRC  (H5D_VIRTUAL_MAX_OPEN_SRC_DSETS + 44)
+#define SRC_LRU_NCOLS 8
+static int
+test_src_dset_lru(hid_t fapl_id)
+{
+    hid_t   fid      = -1;                            /* File ID */
+    hid_t   dcpl_id  = -1;                            /* Dataset creation properties */
+    hid_t   vds_sid  = -1;                            /* VDS dataspace */
+    hid_t   src_sid  = -1;                            /* Source dataspace */
+    hid_t   did      = -1;                            /* Virtual dataset */
+    hid_t   src_did  = -1;                            /* Source dataset */
+    hsize_t dims[2]  = {SRC_LRU_NSRC, SRC_LRU_NCOLS}; /* VDS dimensions */
+    hsize_t start[2] = {0, 0};                        /* Hyperslab start */
+    hsize_t count[2] = {1, SRC_LRU_NCOLS};            /* Hyperslab count */
+    size_t  nopen;                                    /* Number of open source datasets */
+    int *   buf      = NULL;                          /* Buffer for the whole VDS */
+    int     row[SRC_LRU_NCOLS];                       /* Buffer for one row */
+    char    src_name[32];                             /* Source dataset name */
+    char    filename[FILENAME_BUF_SIZE];              /* File name */
+    int     i, j;                                     /* Local index variables */
+
+    TESTING_2("I/O with more source datasets than are kept open");
+
+    if (NULL == (buf = (int *)HDcalloc(SRC_LRU_NSRC * SRC_LRU_NCOLS, sizeof(int))))
+        TEST_ERROR
+
+    h5_fixname(FILENAME[12], fapl_id, filename, sizeof(filename));
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a source dataset for each row of the VDS, in the same file */
+    if ((src_sid = H5Screate_simple(1, &dims[1], NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((vds_sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SRC_LRU_NSRC; i++) {
+        HDsnprintf(src_name, sizeof(src_name), "src%d", i);
+        for (j = 0; j < SRC_LRU_NCOLS; j++)
+            row[j] = i * SRC_LRU_NCOLS + j;
+        if ((src_did = H5Dcreate2(fid, src_name, H5T_NATIVE_INT, src_sid, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(src_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, row) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(src_did) < 0)
+            FAIL_STACK_ERROR
+        src_did = -1;
+
+        start[0] = (hsize_t)i;
+        if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_virtual(dcpl_id, vds_sid, ".", src_name, src_sid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    if (H5Sselect_all(vds_sid) < 0)
+        FAIL_STACK_ERROR
+
+    if ((did = H5Dcreate2(fid, "vds", H5T_NATIVE_INT, vds_sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read the whole VDS, which opens every source dataset */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SRC_LRU_NSRC; i++)
+        for (j = 0; j < SRC_LRU_NCOLS; j++)
+            if (buf[i * SRC_LRU_NCOLS + j] != i * SRC_LRU_NCOLS + j)
+                TEST_ERROR
+
+    /* Only the most recently used source datasets should still be open */
+    if (H5D__virtual_open_src_dsets_test(&nopen) < 0)
+        FAIL_STACK_ERROR
+    if (nopen != H5D_VIRTUAL_MAX_OPEN_SRC_DSETS)
+        TEST_ERROR
+
+    /* Read the first row, whose source dataset was closed */
+    start[0] = 0;
+    if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, src_sid, vds_sid, H5P_DEFAULT, row) < 0)
+        FAIL_STACK_ERROR
+    for (j = 0; j < SRC_LRU_NCOLS; j++)
+        if (row[j] != j)
+            TEST_ERROR
+    if (H5D__virtual_open_src_dsets_test(&nopen) < 0)
+        FAIL_STACK_ERROR
+    if (nopen != H5D_VIRTUAL_MAX_OPEN_SRC_DSETS)
+        TEST_ERROR
+
+    /* Write the whole VDS, closing source datasets with new data */
+    for (i = 0; i < SRC_LRU_NSRC; i++)
+        for (j = 0; j < SRC_LRU_NCOLS; j++)
+            buf[i * SRC_LRU_NCOLS + j] = -(i * SRC_LRU_NCOLS + j);
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Closing the VDS closes its source datasets */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    did = -1;
+    if (H5D__virtual_open_src_dsets_test(&nopen) < 0)
+        FAIL_STACK_ERROR
+    if (nopen != 0)
+        TEST_ERROR
+
+    /* Check the source datasets directly */
+    for (i = 0; i < SRC_LRU_NSRC; i++) {
+        HDsnprintf(src_name, sizeof(src_name), "src%d", i);
+        if ((src_did = H5Dopen2(fid, src_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(src_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, row) < 0)
+            FAIL_STACK_ERROR
+        for (j = 0; j < SRC_LRU_NCOLS; j++)
+            if (row[j] != -(i * SRC_LRU_NCOLS + j))
+                TEST_ERROR
+        if (H5Dclose(src_did) < 0)
+            FAIL_STACK_ERROR
+        src_did = -1;
+    } /* end for */
+
+    /* Close everything */
+    if (H5Sclose(vds_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(src_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(src_did);
+        H5Dclose(did);
+        H5Pclose(dcpl_id);
+        H5Sclose(vds_sid);
+        H5Sclose(src_sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(buf);
+    return 1;
+} /* end test_src_dset_lru() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mapping_index
+ *
+ * Purpose:     Tests I/O on a virtual dataset with enough mappings for
+ *              them to be indexed, including an unlimited mapping.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *-------------------------------------------------------------------------
+ */
+#define MAP_INDEX_NROWS   4
+#define MAP_INDEX_NMAPS   1000
+#define MAP_INDEX_NUNLIM  10
+#define MAP_INDEX_NCOLS   (MAP_INDEX_NMAPS + MAP_INDEX_NUNLIM)
+#define MAP_INDEX_NPOINTS 6
+#define MAP_INDEX_NELMTS  (MAP_INDEX_NROWS * MAP_INDEX_NCOLS)
+static const hsize_t map_index_points[] = {0, 0, 0, 1009, 1, 1003, 2, 500, 3, 250, 3, 999};
+
+static int
+test_mapping_index(hid_t fapl_id)
+{
+    hid_t    fid         = -1;                                 /* File ID */
+    hid_t    dcpl_id     = -1;                                 /* Dataset creation properties */
+    hid_t    vds_sid     = -1;                                 /* VDS dataspace */
+    hid_t    src_sid     = -1;                                 /* Source dataspace */
+    hid_t    unlim_sid   = -1;                                 /* Unlimited source dataspace */
+    hid_t    mem_sid     = -1;                                 /* Memory dataspace */
+    hid_t    did         = -1;                                 /* Virtual dataset */
+    hid_t    src_did     = -1;                                 /* Source dataset */
+    hsize_t  dims[2]     = {MAP_INDEX_NROWS, MAP_INDEX_NMAPS}; /* VDS and source dimensions */
+    hsize_t  max_dims[2] = {MAP_INDEX_NROWS, H5S_UNLIMITED};   /* VDS maximum dimensions */
+    hsize_t  mem_dims[2] = {MAP_INDEX_NROWS, MAP_INDEX_NCOLS}; /* Memory dimensions */
+    hsize_t  start[2]    = {0, 0};                             /* Hyperslab start */
+    hsize_t  count[2]    = {1, 1};                             /* Hyperslab count */
+    hsize_t  block[2]    = {MAP_INDEX_NROWS, 1};               /* Hyperslab block */
+    size_t   nents;                                            /* Number of indexed mappings */
+    unsigned dim;                                              /* Indexed dimension */
+    int *    buf         = NULL;                               /* Expected VDS contents */
+    int *    rbuf        = NULL;                               /* Buffer for reading */
+    char     filename[FILENAME_BUF_SIZE];                      /* File name */
+    int      i, j;                                             /* Local index variables */
+
+    TESTING_2("I/O with indexed mappings");
+
+    if (NULL == (buf = (int *)HDmalloc(MAP_INDEX_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(MAP_INDEX_NELMTS * sizeof(int))))
+        TEST_ERROR
+
+    h5_fixname(FILENAME[13], fapl_id, filename, sizeof(filename));
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The VDS holds the columns of a fixed size source dataset followed by
+     * those of an unlimited one, element (i, j) being j * NROWS + i */
+    for (i = 0; i < MAP_INDEX_NROWS; i++)
+        for (j = 0; j < MAP_INDEX_NCOLS; j++)
+            buf[i * MAP_INDEX_NCOLS + j] = j * MAP_INDEX_NROWS + i;
+    if ((mem_sid = H5Screate_simple(2, mem_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the fixed size source dataset */
+    if ((src_sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((src_did = H5Dcreate2(fid, "src", H5T_NATIVE_INT, src_sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(src_did, H5T_NATIVE_INT, mem_sid, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(src_did) < 0)
+        FAIL_STACK_ERROR
+    src_did = -1;
+
+    /* Create the unlimited source dataset */
+    dims[1] = MAP_INDEX_NUNLIM;
+    if ((unlim_sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl_id, 2, block) < 0)
+        FAIL_STACK_ERROR
+    if ((src_did = H5Dcreate2(fid, "src_unlim", H5T_NATIVE_INT, unlim_sid, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    start[1] = MAP_INDEX_NMAPS;
+    if (H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(src_did, H5T_NATIVE_INT, mem_sid, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(src_did) < 0)
+        FAIL_STACK_ERROR
+    src_did = -1;
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* Map each column of the fixed size source dataset separately */
+    dims[1] = MAP_INDEX_NMAPS;
+    if ((vds_sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    for (j = 0; j < MAP_INDEX_NMAPS; j++) {
+        start[1] = (hsize_t)j;
+        if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_hyperslab(src_sid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_virtual(dcpl_id, vds_sid, ".", "src", src_sid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Map the unlimited source dataset after them */
+    start[1] = MAP_INDEX_NMAPS;
+    count[1] = H5S_UNLIMITED;
+    if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+        FAIL_STACK_ERROR
+    start[1] = 0;
+    if (H5Sselect_hyperslab(unlim_sid, H5S_SELECT_SET, start, NULL, count, block) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_virtual(dcpl_id, vds_sid, ".", "src_unlim", unlim_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_all(vds_sid) < 0)
+        FAIL_STACK_ERROR
+
+    if ((did = H5Dcreate2(fid, "vds", H5T_NATIVE_INT, vds_sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    did = -1;
+
+    /* Reopen the VDS, which indexes its mappings on the column dimension */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    fid = -1;
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, "vds", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5D__virtual_index_test(did, &nents, &dim) < 0)
+        FAIL_STACK_ERROR
+    if (nents != MAP_INDEX_NMAPS + 1 || dim != 1)
+        TEST_ERROR
+
+    /* The unlimited mapping extends the VDS */
+    if (H5Sclose(vds_sid) < 0)
+        FAIL_STACK_ERROR
+    if ((vds_sid = H5Dget_space(did)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sget_simple_extent_dims(vds_sid, dims, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (dims[0] != MAP_INDEX_NROWS || dims[1] != MAP_INDEX_NCOLS)
+        TEST_ERROR
+
+    /* Read the whole VDS */
+    HDmemset(rbuf, 0, MAP_INDEX_NELMTS * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < MAP_INDEX_NROWS; i++)
+        for (j = 0; j < MAP_INDEX_NCOLS; j++)
+            if (rbuf[i * MAP_INDEX_NCOLS + j] != buf[i * MAP_INDEX_NCOLS + j])
+                TEST_ERROR
+
+    /* Read scattered points */
+    if (H5Sselect_elements(vds_sid, H5S_SELECT_SET, (size_t)MAP_INDEX_NPOINTS, map_index_points) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_elements(mem_sid, H5S_SELECT_SET, (size_t)MAP_INDEX_NPOINTS, map_index_points) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, MAP_INDEX_NELMTS * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, mem_sid, vds_sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < MAP_INDEX_NPOINTS; i++) {
+        size_t elmt = (size_t)(map_index_points[2 * i] * MAP_INDEX_NCOLS + map_index_points[2 * i + 1]);
+
+        if (rbuf[elmt] != buf[elmt])
+            TEST_ERROR
+    } /* end for */
+
+    /* Read a block across the end of the fixed size mappings */
+    start[0] = 1;
+    start[1] = MAP_INDEX_NMAPS - 10;
+    count[0] = 2;
+    count[1] = 20;
+    if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, MAP_INDEX_NELMTS * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, mem_sid, vds_sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 1; i < 3; i++)
+        for (j = MAP_INDEX_NMAPS - 10; j < MAP_INDEX_NMAPS + 10; j++)
+            if (rbuf[i * MAP_INDEX_NCOLS + j] != buf[i * MAP_INDEX_NCOLS + j])
+                TEST_ERROR
+
+    /* Write a block of columns, then check the whole VDS */
+    start[0] = 0;
+    start[1] = 300;
+    count[0] = MAP_INDEX_NROWS;
+    count[1] = 10;
+    for (i = 0; i < MAP_INDEX_NROWS; i++)
+        for (j = 300; j < 310; j++)
+            buf[i * MAP_INDEX_NCOLS + j] = -buf[i * MAP_INDEX_NCOLS + j];
+    if (H5Sselect_hyperslab(vds_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(did, H5T_NATIVE_INT, mem_sid, vds_sid, H5P_DEFAULT, buf) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, MAP_INDEX_NELMTS * sizeof(int));
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < MAP_INDEX_NROWS; i++)
+        for (j = 0; j < MAP_INDEX_NCOLS; j++)
+            if (rbuf[i * MAP_INDEX_NCOLS + j] != buf[i * MAP_INDEX_NCOLS + j])
+                TEST_ERROR
+
+    /* Close everything */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(vds_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(src_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(unlim_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(buf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(src_did);
+        H5Dclose(did);
+        H5Pclose(dcpl_id);
+        H5Sclose(vds_sid);
+        H5Sclose(src_sid);
+        H5Sclose(unlim_sid);
+        H5Sclose(mem_sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(buf);
+    HDfree(rbuf);
+    return 1;
+} /* end test_mapping_index() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -12389,6 +12810,8 @@ main(void)
 #endif /* VDS_TEST_VERBOSE */
 
             nerrors += test_dapl_values(vds_fapl);
+            nerrors += test_src_dset_lru(vds_fapl);
+            nerrors += test_mapping_index(vds_fapl);
 
             /* Verify symbol table messages are cached */
             nerrors += (h5_verify_cached_stabs(FILENAME, vds_fapl) < 0 ? 1 : 0);
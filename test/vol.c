@@ -1985,13 +1985,18 @@ test_async_vol_props(void)
             TEST_ERROR
     } /* end if */
 
-    /* Test query w/default VOL, which should indicate no async, since native connector
-     * doesn't support async.
+    /* Test query w/default VOL, which should indicate async only in thread-safe
+     * builds, where the native connector runs async operations on a background thread.
      */
     if (H5Pget_vol_cap_flags(fapl_id, &cap_flags) < 0)
         FAIL_STACK_ERROR;
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+    if ((cap_flags & H5VL_CAP_FLAG_ASYNC) == 0)
+        TEST_ERROR
+#else
     if ((cap_flags & H5VL_CAP_FLAG_ASYNC) > 0)
         TEST_ERROR
+#endif
     if ((cap_flags & H5VL_CAP_FLAG_NATIVE_FILES) == 0)
         TEST_ERROR
 
@@ -32,6 +32,7 @@
 #define H5F_FRIEND   /*suppress error about including H5Fpkg  */
 #define H5G_FRIEND   /*suppress error about including H5Gpkg  */
 #define H5HF_FRIEND  /*suppress error about including H5HFpkg */
+#define H5M_FRIEND   /*suppress error about including H5Mpkg  */
 #define H5O_FRIEND   /*suppress error about including H5Opkg  */
 #define H5SM_FRIEND  /*suppress error about including H5SMpkg */
 
@@ -49,6 +50,7 @@
 #include "H5HFpkg.h"     /* Fractal heaps        */
 #include "H5HGprivate.h" /* Global Heaps        */
 #include "H5Iprivate.h"  /* IDs                  */
+#include "H5Mpkg.h"      /* Maps                 */
 #include "H5Opkg.h"      /* Object headers       */
 #include "H5SMpkg.h"     /* Implicitly shared messages    */
 
@@ -126,6 +128,10 @@ get_H5B2_class(const uint8_t *sig)
             cls = H5D_BT2_FILT;
             break;
 
+        case H5B2_MAP_ID:
+            cls = H5M_BT2;
+            break;
+
         case H5B2_TEST2_ID:
             cls = H5B2_TEST2;
             break;
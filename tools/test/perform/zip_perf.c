@@ -12,11 +12,11 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* ===========================================================================
- * Usage:  zip_perf [-d] [-f] [-h] [-1 to -9] [files...]
- *   -d : decompress
- *   -f : compress with Z_FILTERED
- *   -h : compress with Z_HUFFMAN_ONLY
- *   -1 to -9 : compression level
+ * Usage:  zip_perf [-h] [-1 to -9] [-L] [-t N] [options...]
+ *   -h : help
+ *   -1 to -9 : zlib compression level
+ *   -L : compress with the library's built-in LZ filter instead of zlib
+ *   -t N : number of threads for the LZ filter
  */
 
 /* our header files */
@@ -25,8 +25,8 @@
 #include "h5tools_utils.h"
 
 #ifdef H5_HAVE_FILTER_DEFLATE
-
 #include <zlib.h>
+#endif /* H5_HAVE_FILTER_DEFLATE */
 
 #define ONE_KB 1024
 #define ONE_MB (ONE_KB * ONE_KB)
@@ -54,17 +54,30 @@ static const char *prog             = NULL;
 static const char *option_prefix    = NULL;
 static char *      filename         = NULL;
 static int         compress_percent = 0;
-static int         compress_level   = Z_DEFAULT_COMPRESSION;
+static int         compress_level   = 6;
 static int         output, random_test = FALSE;
 static int         report_once_flag;
 static double      compression_time;
+static double      decompression_time;
+#ifdef H5_HAVE_FILTER_DEFLATE
+static int use_lz = FALSE;
+#else
+static int use_lz = TRUE;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+static unsigned lz_threads = 1;
+static hid_t    lz_fid     = H5I_INVALID_HID; /* in-memory file for the LZ filter */
+static hid_t    lz_dxpl    = H5I_INVALID_HID; /* transfer properties, with the LZ threads */
+static hid_t    lz_did     = H5I_INVALID_HID; /* dataset with one chunk of lz_len bytes */
+static size_t   lz_len     = 0;
 
 /* internal functions */
-static void error(const char *fmt, ...);
-static void compress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
+static void           error(const char *fmt, ...);
+static unsigned char *compress_buffer(const unsigned char *source, size_t sourceLen, size_t *destLen);
+static void uncompress_buffer(const unsigned char *source, size_t sourceLen, const unsigned char *orig,
+                              size_t origLen);
 
 /* commandline options : long and short form */
-static const char *        s_opts   = "hB:b:c:p:rs:0123456789";
+static const char *        s_opts   = "hB:b:c:Lp:rs:t:0123456789";
 static struct long_options l_opts[] = {{"help", no_arg, 'h'},
                                        {"compressability", require_arg, 'c'},
                                        {"compressabilit", require_arg, 'c'},
@@ -109,6 +122,7 @@ static struct long_options l_opts[] = {{"help", no_arg, 'h'},
                                        {"min-bu", require_arg, 'b'},
                                        {"min-b", require_arg, 'b'},
                                        {"min", require_arg, 'b'},
+                                       {"lz", no_arg, 'L'},
                                        {"prefix", require_arg, 'p'},
                                        {"prefi", require_arg, 'p'},
                                        {"pref", require_arg, 'p'},
@@ -123,6 +137,12 @@ static struct long_options l_opts[] = {{"help", no_arg, 'h'},
                                        {"rand", no_arg, 'r'},
                                        {"ran", no_arg, 'r'},
                                        {"ra", no_arg, 'r'},
+                                       {"threads", require_arg, 't'},
+                                       {"thread", require_arg, 't'},
+                                       {"threa", require_arg, 't'},
+                                       {"thre", require_arg, 't'},
+                                       {"thr", require_arg, 't'},
+                                       {"th", require_arg, 't'},
                                        {NULL, 0, '\0'}};
 
 /*
@@ -159,39 +179,111 @@ cleanup(void)
     HDfree(filename);
 }
 
+/*
+ * Function:    lz_open
+ * Purpose:     Create the in-memory file that the LZ filter is run
+ *              through, and the transfer properties with the number of
+ *              threads for the filter.
+ * Returns:     Nothing.  Exits on failure.
+ */
 static void
-write_file(Bytef *source, uLongf sourceLen)
+lz_open(void)
 {
-    Bytef *        d_ptr, *dest;
-    uLongf         d_len, destLen;
-    struct timeval timer_start, timer_stop;
+    hid_t        fapl;
+    unsigned int filter_config;
+    htri_t       avail;
+
+    avail = H5Zfilter_avail(H5Z_FILTER_LZ);
+    if (avail <= 0 || H5Zget_filter_info(H5Z_FILTER_LZ, &filter_config) < 0 ||
+        !(filter_config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) ||
+        !(filter_config & H5Z_FILTER_CONFIG_DECODE_ENABLED))
+        error("LZ filter not available");
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0 || H5Pset_fapl_core(fapl, (size_t)ONE_MB, FALSE) < 0)
+        error("can't set up in-memory file");
+    if ((lz_fid = H5Fcreate("zip_perf_lz.h5", H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        error("can't create in-memory file");
+    H5Pclose(fapl);
+
+    if ((lz_dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0 || H5Pset_filter_nthreads(lz_dxpl, lz_threads) < 0)
+        error("can't set number of LZ filter threads");
+}
 
-    /* destination buffer needs to be at least 0.1% larger than sourceLen
-     * plus 12 bytes */
-    destLen = (uLongf)((double)sourceLen + ((double)sourceLen * 0.1)) + 12;
-    dest    = (Bytef *)HDmalloc(destLen);
+/*
+ * Function:    lz_dataset
+ * Purpose:     Make lz_did a dataset compressed with the LZ filter and
+ *              stored as a single chunk of LEN bytes.  The chunk cache is
+ *              disabled, so each write compresses the chunk and each read
+ *              decompresses it.
+ * Returns:     Nothing.  Exits on failure.
+ */
+static void
+lz_dataset(size_t len)
+{
+    hid_t   sid, dcpl, dapl;
+    hsize_t dims[1];
+    char    name[32];
+
+    if (len == lz_len)
+        return;
+
+    if (lz_did >= 0)
+        H5Dclose(lz_did);
+
+    dims[0] = (hsize_t)len;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0 || (dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0 ||
+        H5Pset_chunk(dcpl, 1, dims) < 0 || H5Pset_lz(dcpl) < 0 ||
+        (dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0 || H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, 1.0) < 0)
+        error("can't set up LZ dataset");
+
+    HDsnprintf(name, sizeof(name), "%lu", (unsigned long)len);
+    if ((lz_did = H5Dcreate2(lz_fid, name, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        error("can't create LZ dataset");
+    lz_len = len;
+
+    H5Pclose(dapl);
+    H5Pclose(dcpl);
+    H5Sclose(sid);
+}
 
-    if (!dest)
-        error("out of memory");
+/*
+ * Function:    lz_close
+ * Purpose:     Release the in-memory file for the LZ filter.
+ * Returns:     Nothing
+ */
+static void
+lz_close(void)
+{
+    if (lz_did >= 0)
+        H5Dclose(lz_did);
+    if (lz_dxpl >= 0)
+        H5Pclose(lz_dxpl);
+    if (lz_fid >= 0)
+        H5Fclose(lz_fid);
+}
 
-    HDgettimeofday(&timer_start, NULL);
-    compress_buffer(dest, &destLen, source, sourceLen);
-    HDgettimeofday(&timer_stop, NULL);
+static void
+write_file(const unsigned char *source, size_t sourceLen)
+{
+    unsigned char *d_ptr, *dest;
+    size_t         d_len, destLen;
 
-    compression_time += ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / MICROSECOND) -
-                        ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / MICROSECOND);
+    dest = compress_buffer(source, sourceLen, &destLen);
 
     if (report_once_flag) {
         HDfprintf(stdout, "\tCompression Ratio: %g\n", ((double)destLen) / (double)sourceLen);
         report_once_flag = 0;
     }
 
+    /* time decompressing the data, making sure it round-trips */
+    uncompress_buffer(dest, destLen, source, sourceLen);
+
     d_ptr = dest;
     d_len = destLen;
 
     /* loop to make sure we write everything out that we want to write */
     for (;;) {
-        int rc = (int)HDwrite(output, d_ptr, (size_t)d_len);
+        int rc = (int)HDwrite(output, d_ptr, d_len);
 
         if (rc == -1)
             error(HDstrerror(errno));
@@ -208,59 +300,138 @@ write_file(Bytef *source, uLongf sourceLen)
 
 /*
  * Function:    compress_buffer
- * Purpose:     Compress the buffer.
- * Returns:     Z_OK            - success
- *              Z_MEM_ERROR     - not enough memory
- *              Z_BUF_ERROR     - not enough room in the output buffer
- *              Z_STREAM_ERROR  - level parameter is invalid
+ * Purpose:     Compress the buffer, with zlib or with the LZ filter, and
+ *              add the time taken to compression_time.  The LZ filter is
+ *              run by writing the buffer to a one chunk dataset in an
+ *              in-memory file, so its time includes a little library
+ *              overhead.
+ * Returns:     The compressed data, to be freed with HDfree, and its
+ *              size in *destLen.  Exits on failure.
  * Programmer:  Bill Wendling, 05. June 2002
  * Modifications:
  */
-static void
-compress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+static unsigned char *
+compress_buffer(const unsigned char *source, size_t sourceLen, size_t *destLen)
 {
-    int rc = compress2(dest, destLen, source, sourceLen, compress_level);
+    unsigned char *dest;
+    struct timeval timer_start, timer_stop;
 
-    if (rc != Z_OK) {
-        /* compress2 failed - cleanup and tell why */
-        cleanup();
+    if (use_lz) {
+        hsize_t  offset[1] = {0};
+        hsize_t  nbytes;
+        uint32_t filter_mask;
 
-        switch (rc) {
-            case Z_MEM_ERROR:
-                error("not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                error("not enough room in the output buffer");
-                break;
-            case Z_STREAM_ERROR:
-                error("level parameter (%d) is invalid", compress_level);
-                break;
-            default:
-                error("unknown compression error");
-                break;
+        lz_dataset(sourceLen);
+
+        HDgettimeofday(&timer_start, NULL);
+        if (H5Dwrite(lz_did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, lz_dxpl, source) < 0) {
+            cleanup();
+            error("LZ compression failed");
+        }
+        HDgettimeofday(&timer_stop, NULL);
+
+        /* get the compressed chunk */
+        if (H5Dget_chunk_storage_size(lz_did, offset, &nbytes) < 0)
+            error("can't get size of LZ compressed data");
+        if (NULL == (dest = (unsigned char *)HDmalloc((size_t)nbytes)))
+            error("out of memory");
+        if (H5Dread_chunk(lz_did, H5P_DEFAULT, offset, &filter_mask, dest) < 0)
+            error("can't read LZ compressed data");
+        *destLen = (size_t)nbytes;
+    }
+    else {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        uLongf zLen = compressBound((uLong)sourceLen);
+        int    rc;
+
+        /* time the allocation too, as the LZ filter allocates its output */
+        HDgettimeofday(&timer_start, NULL);
+        if (NULL == (dest = (unsigned char *)HDmalloc(zLen)))
+            error("out of memory");
+        rc = compress2(dest, &zLen, source, (uLong)sourceLen, compress_level);
+        HDgettimeofday(&timer_stop, NULL);
+
+        if (rc != Z_OK) {
+            /* compress2 failed - cleanup and tell why */
+            cleanup();
+
+            switch (rc) {
+                case Z_MEM_ERROR:
+                    error("not enough memory");
+                    break;
+                case Z_BUF_ERROR:
+                    error("not enough room in the output buffer");
+                    break;
+                case Z_STREAM_ERROR:
+                    error("level parameter (%d) is invalid", compress_level);
+                    break;
+                default:
+                    error("unknown compression error");
+                    break;
+            }
         }
+        *destLen = (size_t)zLen;
+#else
+        error("zlib compression was not configured");
+#endif /* H5_HAVE_FILTER_DEFLATE */
     }
+
+    compression_time += ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / MICROSECOND) -
+                        ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / MICROSECOND);
+
+    return dest;
 }
 
-#ifdef LATER
 /*
  * Function:    uncompress_buffer
- * Purpose:     Uncompress the buffer.
- * Returns:     Z_OK            - success
- *              Z_MEM_ERROR     - not enough memory
- *              Z_BUF_ERROR     - not enough room in the output buffer
- *              Z_DATA_ERROR    - the input data was corrupted
+ * Purpose:     Uncompress the buffer, add the time taken to
+ *              decompression_time, and check the result against the
+ *              original data.  The LZ filter decompresses the chunk
+ *              that compress_buffer just wrote.
+ * Returns:     Nothing.  Exits on failure.
  * Programmer:  Bill Wendling, 05. June 2002
  * Modifications:
  */
-static int
-uncompress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+static void
+uncompress_buffer(const unsigned char *source, size_t sourceLen, const unsigned char *orig, size_t origLen)
 {
-    int rc = uncompress(dest, destLen, source, sourceLen);
+    unsigned char *dest;
+    size_t         destLen = 0;
+    struct timeval timer_start, timer_stop;
+
+    if (use_lz) {
+        HDgettimeofday(&timer_start, NULL);
+        if (NULL == (dest = (unsigned char *)HDmalloc(origLen)))
+            error("out of memory");
+        if (H5Dread(lz_did, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, lz_dxpl, dest) >= 0)
+            destLen = origLen;
+        HDgettimeofday(&timer_stop, NULL);
+    }
+    else {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        uLongf zLen = (uLongf)origLen;
+
+        HDgettimeofday(&timer_start, NULL);
+        if (NULL == (dest = (unsigned char *)HDmalloc(origLen)))
+            error("out of memory");
+        if (uncompress(dest, &zLen, source, (uLong)sourceLen) == Z_OK)
+            destLen = (size_t)zLen;
+        HDgettimeofday(&timer_stop, NULL);
+#else
+        error("zlib compression was not configured");
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    }
+
+    if (destLen != origLen || HDmemcmp(dest, orig, origLen) != 0) {
+        cleanup();
+        error("decompressed data doesn't match the original data");
+    }
+
+    decompression_time += ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / MICROSECOND) -
+                          ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / MICROSECOND);
 
-    return rc;
+    HDfree(dest);
 }
-#endif /* LATER */
 
 /*
  * Function:    get_unique_name
@@ -313,7 +484,9 @@ usage(void)
     HDfprintf(stdout, "usage: %s [OPTIONS]\n", prog);
     HDfprintf(stdout, "  OPTIONS\n");
     HDfprintf(stdout, "     -h, --help                 Print this usage message and exit\n");
-    HDfprintf(stdout, "     -1...-9                    Level of compression, from 1 to 9\n");
+    HDfprintf(stdout, "     -1...-9                    Level of zlib compression, from 1 to 9\n");
+    HDfprintf(stdout, "     -L, --lz                   Use the built-in LZ filter instead of zlib\n");
+    HDfprintf(stdout, "     -t N, --threads=N          Number of threads for the LZ filter [default: 1]\n");
     HDfprintf(stdout, "     -c P, --compressability=P  Percentage of compressability of the random\n");
     HDfprintf(stdout, "                                data you want [default: 0]");
     HDfprintf(stdout, "     -s S, --file-size=S        Maximum size of uncompressed file [default: 64M]\n");
@@ -385,15 +558,15 @@ parse_size_directive(const char *size)
 }
 
 static void
-fill_with_random_data(Bytef *src, uLongf src_len)
+fill_with_random_data(unsigned char *src, size_t src_len)
 {
     register unsigned u;
     h5_stat_t         stat_buf;
 
     if (HDstat("/dev/urandom", &stat_buf) == 0) {
-        uLongf len = src_len;
-        Bytef *buf = src;
-        int    fd  = HDopen("/dev/urandom", O_RDONLY, 0);
+        size_t         len = src_len;
+        unsigned char *buf = src;
+        int            fd  = HDopen("/dev/urandom", O_RDONLY, 0);
 
         HDfprintf(stdout, "Using /dev/urandom for random data\n");
 
@@ -418,11 +591,11 @@ fill_with_random_data(Bytef *src, uLongf src_len)
         HDfprintf(stdout, "Using random() for random data\n");
 
         for (u = 0; u < src_len; ++u)
-            src[u] = (Bytef)(0xff & HDrandom());
+            src[u] = (unsigned char)(0xff & HDrandom());
     }
 
     if (compress_percent) {
-        size_t s = (size_t)((src_len * (uLongf)compress_percent) / 100);
+        size_t s = (src_len * (size_t)compress_percent) / 100;
 
         HDmemset(src, '\0', s);
     }
@@ -431,23 +604,24 @@ fill_with_random_data(Bytef *src, uLongf src_len)
 static void
 do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long max_buf_size)
 {
-    uLongf         src_len, total_len;
+    size_t         src_len, total_len;
     struct timeval timer_start, timer_stop;
     double         total_time;
-    Bytef *        src;
+    unsigned char *src;
 
     for (src_len = min_buf_size; src_len <= max_buf_size; src_len <<= 1) {
         register unsigned long i, iters;
 
         iters = file_size / src_len;
-        src   = (Bytef *)HDcalloc(1, sizeof(Bytef) * src_len);
+        src   = (unsigned char *)HDcalloc(1, src_len);
 
         if (!src) {
             cleanup();
             error("out of memory");
         }
 
-        compression_time = 0.0F;
+        compression_time   = 0.0F;
+        decompression_time = 0.0F;
 
         if (random_test)
             fill_with_random_data(src, src_len);
@@ -456,14 +630,14 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
 
         if (src_len >= ONE_KB && (src_len % ONE_KB) == 0) {
             if (src_len >= ONE_MB && (src_len % ONE_MB) == 0) {
-                HDfprintf(stdout, "%ldMB", src_len / ONE_MB);
+                HDfprintf(stdout, "%zuMB", src_len / ONE_MB);
             }
             else {
-                HDfprintf(stdout, "%ldKB", src_len / ONE_KB);
+                HDfprintf(stdout, "%zuKB", src_len / ONE_KB);
             }
         }
         else {
-            HDfprintf(stdout, "%ld", src_len);
+            HDfprintf(stdout, "%zu", src_len);
         }
 
         HDfprintf(stdout, "\n");
@@ -476,8 +650,8 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
             error(HDstrerror(errno));
 
         for (i = 0; i <= iters; ++i) {
-            Bytef *s_ptr = src;
-            uLong  s_len = src_len;
+            unsigned char *s_ptr = src;
+            size_t         s_len = src_len;
 
             /* loop to make sure we write everything out that we want to write */
             for (;;) {
@@ -526,6 +700,10 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
         HDfprintf(stdout, "\tCompressed Write Time: %.2fs\n", total_time);
         HDfprintf(stdout, "\tCompressed Write Throughput: %.2fMB/s\n", MB_PER_SEC(file_size, total_time));
         HDfprintf(stdout, "\tCompression Time: %gs\n", compression_time);
+        HDfprintf(stdout, "\tCompression Throughput: %.2fMB/s\n", MB_PER_SEC(file_size, compression_time));
+        HDfprintf(stdout, "\tDecompression Time: %gs\n", decompression_time);
+        HDfprintf(stdout, "\tDecompression Throughput: %.2fMB/s\n",
+                  MB_PER_SEC(file_size, decompression_time));
 
         HDunlink(filename);
         HDfree(src);
@@ -570,6 +748,16 @@ main(int argc, const char *argv[])
                 break;
             case 'b':
                 min_buf_size = parse_size_directive(opt_arg);
+                break;
+            case 'L':
+                use_lz = TRUE;
+                break;
+            case 't':
+                lz_threads = (unsigned)HDstrtoul(opt_arg, NULL, 10);
+
+                if (lz_threads < 1)
+                    lz_threads = 1;
+
                 break;
             case 'c':
                 compress_percent = (int)HDstrtol(opt_arg, NULL, 10);
@@ -606,32 +794,17 @@ main(int argc, const char *argv[])
 
     HDfprintf(stdout, "Filesize: %ld\n", file_size);
 
-    if (compress_level == Z_DEFAULT_COMPRESSION)
-        HDfprintf(stdout, "Compression Level: 6\n");
+    if (use_lz) {
+        lz_open();
+        HDfprintf(stdout, "Compression: LZ, %u threads\n", lz_threads);
+    }
     else
         HDfprintf(stdout, "Compression Level: %d\n", compress_level);
 
     get_unique_name();
     do_write_test(file_size, min_buf_size, max_buf_size);
+    if (use_lz)
+        lz_close();
     cleanup();
     return EXIT_SUCCESS;
 }
-
-#else
-
-/*
- * Function:    main
- * Purpose:     Dummy main() function for if HDF5 was configured without
- *              zlib stuff.
- * Return:      EXIT_SUCCESS
- * Programmer:  Bill Wendling, 10. June 2002
- * Modifications:
- */
-int
-main(void)
-{
-    HDfprintf(stdout, "No compression IO performance because zlib was not configured\n");
-    return EXIT_SUCCESS;
-}
-
-#endif /* !H5_HAVE_FILTER_DEFLATE */